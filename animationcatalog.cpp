@@ -0,0 +1,24 @@
+#include "animationcatalog.h"
+
+QList<AssetPack::SequenceSpec> AnimationCatalog::sequences()
+{
+    return {
+        {"Frame", 1, 43, SpriteSize},
+        {"FrameSad", 1, 5, SpriteSize},
+        {"Jumping", 1, 5, WideSpriteSize},
+        {"Welcome", 1, 12, SpriteSize},
+        {"Blinking", 1, 3, SpriteSize},
+        {"Boring", 1, 4, SpriteSize},
+        {"Basketball", 1, 8, WideSpriteSize},
+        {"Pointer", 1, 4, SpriteSize},
+        {"Glasses", 1, 6, GlassesSpriteSize},
+        {"Funny", 1, 12, FunnySpriteSize},
+        {"Trick", 1, 32, SpriteSize},
+    };
+}
+
+QList<qreal> AnimationCatalog::packedDevicePixelRatios()
+{
+    // 100, 125, 150 и 200 % — стандартные масштабы Windows и GNOME
+    return {1.0, 1.25, 1.5, 2.0};
+}
@@ -0,0 +1,24 @@
+#ifndef ANIMATIONCATALOG_H
+#define ANIMATIONCATALOG_H
+
+#include <QList>
+#include <QSize>
+#include "assetpack.h"
+
+// Какие анимации есть и в каких размерах их рисует MainWindow. Общий
+// список для окна, утилиты packassets (она собирает assets.pack на машине
+// сборки и не тянет за собой окно) и замеров.
+class AnimationCatalog {
+public:
+    static constexpr QSize SpriteSize{276, 386};
+    static constexpr QSize WideSpriteSize{400, 386};     // Basketball, Jumping
+    static constexpr QSize GlassesSpriteSize{350, 386};
+    static constexpr QSize FunnySpriteSize{380, 416};
+
+    static QList<AssetPack::SequenceSpec> sequences();
+    // Масштабы экрана, для которых кадры лежат в пакете готовыми; для
+    // остальных кадр строится из списка команд пакета
+    static QList<qreal> packedDevicePixelRatios();
+};
+
+#endif // ANIMATIONCATALOG_H
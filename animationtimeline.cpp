@@ -0,0 +1,189 @@
+#include "animationtimeline.h"
+#include <QDebug>
+
+AnimationTimeline::AnimationTimeline(QObject *parent) : QObject(parent)
+{
+    timer.setSingleShot(true);
+    timer.setTimerType(Qt::PreciseTimer);
+    connect(&timer, &QTimer::timeout, this, &AnimationTimeline::tick);
+}
+
+void AnimationTimeline::start(const AnimationSequence &sequence)
+{
+    current = sequence;
+    current.frameDelay = qMax(1, current.frameDelay);
+    origin = 0;
+    step = 0;
+    started = false;
+    finishing = current.frames.isEmpty();
+    clock.start();
+    pausedAt = 0;
+    scheduleAt(0);
+}
+
+void AnimationTimeline::stop()
+{
+    timer.stop();
+    pending = false;
+    finishing = false;
+    awaitingPresentation = false;
+}
+
+bool AnimationTimeline::isActive() const
+{
+    return timer.isActive() || pending;
+}
+
+void AnimationTimeline::setPaused(bool paused)
+{
+    if (paused == this->paused) {
+        return;
+    }
+    this->paused = paused;
+    if (paused) {
+        pausedAt = clock.elapsed();
+        if (timer.isActive()) {
+            timer.stop();
+            pending = true;
+        }
+        return;
+    }
+    if (pending) {
+        pending = false;
+        const qint64 shift = clock.elapsed() - pausedAt;
+        origin += shift;
+        intendedAt += shift;
+        scheduleAt(nextDeadline + shift);
+    }
+}
+
+void AnimationTimeline::setFrameGate(const FrameGate &gate)
+{
+    frameGate = gate;
+}
+
+const AnimationSequence &AnimationTimeline::sequence() const
+{
+    return current;
+}
+
+void AnimationTimeline::setFrameDropping(bool enabled)
+{
+    frameDropping = enabled;
+}
+
+bool AnimationTimeline::isFrameDropping() const
+{
+    return frameDropping;
+}
+
+quint64 AnimationTimeline::wakeups() const
+{
+    return wakeupCount;
+}
+
+AnimationTimeline::PacingStats AnimationTimeline::pacingStats() const
+{
+    return pacing;
+}
+
+void AnimationTimeline::resetPacingStats()
+{
+    pacing = PacingStats();
+    totalLatencyMs = 0;
+}
+
+void AnimationTimeline::framePresented()
+{
+    if (!awaitingPresentation) {
+        return;
+    }
+    awaitingPresentation = false;
+    const qint64 latency = qMax<qint64>(0, clock.elapsed() - intendedAt);
+    ++pacing.presented;
+    if (latency > current.frameDelay) {
+        ++pacing.late;
+    }
+    totalLatencyMs += latency;
+    pacing.lastLatencyMs = latency;
+    pacing.maxLatencyMs = qMax(pacing.maxLatencyMs, latency);
+    pacing.meanLatencyMs = double(totalLatencyMs) / pacing.presented;
+}
+
+void AnimationTimeline::scheduleAt(qint64 deadlineMs)
+{
+    nextDeadline = deadlineMs;
+    if (paused) {
+        pending = true;
+        return;
+    }
+    timer.start(int(qMax<qint64>(0, deadlineMs - clock.elapsed())));
+}
+
+void AnimationTimeline::tick()
+{
+    ++wakeupCount;
+    if (finishing) {
+        finishing = false;
+        emit finished();
+        return;
+    }
+
+    const int cycleLength = current.frames.size();
+    const qint64 totalSteps = qint64(cycleLength) * current.repetitions;
+    qint64 intended = origin + step * current.frameDelay;
+    if (frameDropping && started) {
+        // Отстали на целые кадры — перескакиваем к тому, что должен быть на экране сейчас,
+        // но последний кадр конечной анимации показываем всегда
+        qint64 behind = (clock.elapsed() - intended) / current.frameDelay;
+        if (current.repetitions > 0) {
+            behind = qMin(behind, totalSteps - 1 - step);
+        }
+        if (behind > 0) {
+            step += behind;
+            pacing.dropped += quint64(behind);
+            intended += behind * current.frameDelay;
+        }
+    }
+
+    const int frameIndex = int(step % cycleLength);
+    if (frameGate && !frameGate(frameIndex)) {
+        if (!frameDropping || !started) {
+            // Кадр ещё растеризуется — сдвигаем всю шкалу на один шаг. До первого
+            // показанного кадра так и в режиме пропуска: гейт ждёт первые кадры целиком
+            origin += current.frameDelay;
+            scheduleAt(origin + step * current.frameDelay);
+        } else if (current.repetitions == 0 || step < totalSteps - 1) {
+            // Шкала остаётся на месте: на экране прежний кадр, этот считается пропущенным
+            ++step;
+            ++pacing.dropped;
+            scheduleAt(origin + step * current.frameDelay);
+        } else {
+            // Последний кадр не пропускается: пробуем через шаг, он выйдет с опозданием
+            scheduleAt(qMax(intended, clock.elapsed()) + current.frameDelay);
+        }
+        return;
+    }
+
+    // Следующий срок планируется до сигнала: обработчик может перезапустить анимацию
+    ++step;
+    if (current.repetitions > 0 && step >= totalSteps) {
+        finishing = true;
+        scheduleAt(origin + step * current.frameDelay + current.holdLastMs);
+    } else {
+        scheduleAt(origin + step * current.frameDelay);
+    }
+    intendedAt = intended;
+    awaitingPresentation = true;
+    started = true;
+    emit frameChanged(frameIndex);
+}
+
+QDebug operator<<(QDebug debug, const AnimationTimeline::PacingStats &stats)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace() << "AnimationPacing(presented=" << stats.presented << ", late=" << stats.late
+                    << ", dropped=" << stats.dropped << ", meanLatencyMs=" << stats.meanLatencyMs
+                    << ", maxLatencyMs=" << stats.maxLatencyMs << ')';
+    return debug;
+}
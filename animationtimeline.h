@@ -0,0 +1,97 @@
+#ifndef ANIMATIONTIMELINE_H
+#define ANIMATIONTIMELINE_H
+
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <functional>
+
+class QDebug;
+
+// Описание одной анимации: кадры одного цикла, задержка, число повторов
+// (0 — бесконечно) и сколько держать последний кадр перед завершением.
+struct AnimationSequence {
+    QStringList frames;
+    int frameDelay = 100;
+    int repetitions = 1;
+    int holdLastMs = 0;
+};
+
+// Проигрывает AnimationSequence от одних монотонных часов и одного таймера:
+// время показа кадра N всегда origin + N * frameDelay, поэтому повторы
+// не накапливают дрейф и не требуют цепочек QTimer::singleShot.
+// Для каждого кадра сравнивает плановое время с фактическим выводом на
+// экран; в режиме пропуска кадров отстающая анимация перескакивает к
+// кадру по часам и сохраняет свою длительность.
+class AnimationTimeline : public QObject {
+    Q_OBJECT
+public:
+    // Возвращает false, если кадр ещё не готов: тогда показ откладывается на один шаг.
+    // В режиме пропуска кадров так только до первого показанного кадра, дальше
+    // шкала не сдвигается и неготовый кадр считается пропущенным
+    using FrameGate = std::function<bool(int frameIndex)>;
+
+    // Задержка считается от планового времени кадра до его отрисовки
+    struct PacingStats {
+        quint64 presented = 0;
+        quint64 late = 0;       // выведен позже, чем наступило время следующего кадра
+        quint64 dropped = 0;    // пропущен, чтобы догнать часы, или не готов к своему сроку
+        qint64 lastLatencyMs = 0;
+        qint64 maxLatencyMs = 0;
+        double meanLatencyMs = 0;
+    };
+
+    explicit AnimationTimeline(QObject *parent = nullptr);
+
+    void start(const AnimationSequence &sequence);
+    void stop();
+    bool isActive() const;
+    // Пауза сдвигает всю шкалу на своё время: после неё кадры идут с того же места
+    void setPaused(bool paused);
+    void setFrameGate(const FrameGate &gate);
+    void setFrameDropping(bool enabled);
+    bool isFrameDropping() const;
+
+    const AnimationSequence &sequence() const;
+    quint64 wakeups() const;
+    PacingStats pacingStats() const;
+    void resetPacingStats();
+
+public slots:
+    // Вызывается, когда кадр из frameChanged действительно нарисован
+    void framePresented();
+
+signals:
+    void frameChanged(int frameIndex);
+    void finished();
+
+private slots:
+    void tick();
+
+private:
+    void scheduleAt(qint64 deadlineMs);
+
+    QTimer timer;
+    QElapsedTimer clock;
+    AnimationSequence current;
+    FrameGate frameGate;
+    qint64 origin = 0;
+    qint64 step = 0;
+    qint64 nextDeadline = 0;
+    qint64 pausedAt = 0;
+    bool started = false;       // первый кадр уже выведен: с этого момента кадры можно пропускать
+    bool finishing = false;
+    bool paused = false;
+    bool pending = false;
+    bool frameDropping = false;
+    bool awaitingPresentation = false;
+    qint64 intendedAt = 0;
+    qint64 totalLatencyMs = 0;
+    PacingStats pacing;
+    quint64 wakeupCount = 0;
+};
+
+QDebug operator<<(QDebug debug, const AnimationTimeline::PacingStats &stats);
+
+#endif // ANIMATIONTIMELINE_H
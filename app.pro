@@ -0,0 +1,120 @@
+QT += core gui widgets svg multimedia multimediawidgets concurrent
+
+CONFIG += c++17
+
+TARGET = SystemAnalyser
+TEMPLATE = app
+
+SOURCES += \
+    animationcatalog.cpp \
+    animationtimeline.cpp \
+    assetpack.cpp \
+    bluetoothmonitor.cpp \
+    displaylist.cpp \
+    envirconfigpci.cpp \
+    framecache.cpp \
+    idsdatabase.cpp \
+    main.cpp \
+    mainwindow.cpp \
+    memorypressuremonitor.cpp \
+    pcidb.cpp \
+    pcihotplugmonitor.cpp \
+    pcihwid.cpp \
+    pcitablemodel.cpp \
+    powermonitor.cpp \
+    scenewidget.cpp \
+    spritecompositor.cpp \
+    theme.cpp \
+    timerscheduler.cpp \
+    usbmonitor.cpp \
+    webcamera.cpp
+
+HEADERS += \
+    animationcatalog.h \
+    animationtimeline.h \
+    assetpack.h \
+    bluetoothmonitor.h \
+    displaylist.h \
+    envirconfigpci.h \
+    framecache.h \
+    idsdatabase.h \
+    mainwindow.h \
+    memorypressuremonitor.h \
+    pcicodes.h \
+    pcidb.h \
+    pcihotplugmonitor.h \
+    pcihwid.h \
+    pcitablemodel.h \
+    powermonitor.h \
+    scenewidget.h \
+    spritecompositor.h \
+    theme.h \
+    timerscheduler.h \
+    usbmonitor.h \
+    webcamera.h
+
+# Фон, батарея, курсор, значок и SVG кадров (запасной путь FrameCache, если
+# в пакете нет нужного DPR) вкомпилированы в бинарник как :/assets/...
+appassets.files = $$files(assets/*.svg) $$files(assets/*.jpg)
+appassets.prefix = /
+RESOURCES += appassets
+
+# Кадры анимаций растеризует в assets.pack утилита tools/packassets,
+# собранная на машине сборки. При кросс-сборке укажите собранную под хост:
+# qmake PACKASSETS=/путь/к/packassets
+isEmpty(PACKASSETS) {
+    PACKASSETS = $$OUT_PWD/tools/packassets/packassets
+    win32: PACKASSETS = $${PACKASSETS}.exe
+}
+# Пакет кладётся туда же, где окажется бинарник: его ищут рядом с ним
+PACK_DIR = $$DESTDIR
+isEmpty(PACK_DIR) {
+    PACK_DIR = $$OUT_PWD
+    win32:debug_and_release {
+        CONFIG(debug, debug|release): PACK_DIR = $$OUT_PWD/debug
+        else: PACK_DIR = $$OUT_PWD/release
+    }
+}
+assetpack.target = $$PACK_DIR/assets.pack
+assetpack.depends = $$PACKASSETS $$files($$PWD/assets/*.svg)
+assetpack.commands = $$shell_quote($$shell_path($$PACKASSETS)) \
+                     $$shell_quote($$shell_path($$PWD/assets)) $$shell_quote($$shell_path($$assetpack.target))
+QMAKE_EXTRA_TARGETS += assetpack
+PRE_TARGETDEPS += $$assetpack.target
+QMAKE_CLEAN += $$assetpack.target
+
+# make install: бинарник и пакет рядом, как при запуске из каталога сборки
+isEmpty(PREFIX): PREFIX = /usr/local
+target.path = $$PREFIX/bin
+assetpackinstall.files = $$assetpack.target
+assetpackinstall.path = $$target.path
+assetpackinstall.CONFIG += no_check_exist
+INSTALLS += target assetpackinstall
+# В пакете приложения macOS бинарник лежит в Contents/MacOS
+macx {
+    assetpackbundle.files = $$assetpack.target
+    assetpackbundle.path = Contents/MacOS
+    QMAKE_BUNDLE_DATA += assetpackbundle
+}
+
+# Замеры: qmake CONFIG+=benchmark, затем SystemAnalyser --benchmark <каталог assets>.
+# Проверки правильности — в tests/, они идут в обычной сборке через make check
+benchmark {
+    DEFINES += SYSTEMANALYSER_BENCHMARK
+    SOURCES += \
+        benchmarkstats.cpp \
+        pcibenchmark.cpp \
+        renderbenchmark.cpp \
+        tests/common/pciidsfixture.cpp
+    HEADERS += \
+        benchmarkstats.h \
+        pcibenchmark.h \
+        renderbenchmark.h \
+        tests/common/pciidsfixture.h
+    win32: LIBS += -lpsapi
+}
+
+win32 {
+
+    LIBS += -L"C:/Program Files (x86)/Windows Kits/10/Lib/10.0.19041.0/um/x64" -lsetupapi -lpowrprof -lkernel32 -lwbemuuid -lole32 -loleaut32 -luuid -lhid -lcfgmgr32 -lrstrtmgr
+}
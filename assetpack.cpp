@@ -0,0 +1,343 @@
+#include "assetpack.h"
+#include "displaylist.h"
+#include <QDebug>
+#include <QSaveFile>
+#include <QtEndian>
+#include <cstring>
+
+namespace {
+
+const char PackMagic[8] = {'K', 'R', 'O', 'S', 'H', 'P', 'K', '1'};
+const quint32 PackVersion = 2;
+
+// Все поля выровнены естественно, записываются в little-endian
+struct PackHeader {
+    char magic[8];
+    quint32 version;
+    quint32 sequenceCount;
+    quint32 entryCount;
+    quint32 displayListCount;
+};
+struct PackSequence {
+    char prefix[32];
+    quint32 width;
+    quint32 height;
+    quint32 dprPercent;
+    quint32 firstNumber;
+    quint32 frameCount;
+    quint32 firstEntry;
+};
+struct PackEntry {
+    quint64 offset;
+    quint32 compressedSize;
+    quint32 reserved;
+};
+struct PackDisplayList {
+    char name[32];
+    quint64 offset;
+    quint32 compressedSize;
+    quint32 reserved;
+};
+static_assert(sizeof(PackHeader) == 24, "PackHeader layout");
+static_assert(sizeof(PackSequence) == 56, "PackSequence layout");
+static_assert(sizeof(PackEntry) == 16, "PackEntry layout");
+static_assert(sizeof(PackDisplayList) == 48, "PackDisplayList layout");
+
+int toDprPercent(qreal devicePixelRatio)
+{
+    return qRound(devicePixelRatio * 100);
+}
+
+// Где в имени кадра ("Frame12") начинается номер; 0, если номера или префикса нет
+qsizetype numberPosition(QStringView assetName)
+{
+    qsizetype digits = assetName.size();
+    while (digits > 0 && assetName.at(digits - 1).isDigit()) {
+        --digits;
+    }
+    return digits == assetName.size() ? 0 : digits;
+}
+
+void releaseFrameBuffer(void *buffer)
+{
+    delete static_cast<QByteArray *>(buffer);
+}
+
+}
+
+AssetPack::AssetPack() = default;
+
+AssetPack::~AssetPack()
+{
+    if (data) {
+        file.unmap(const_cast<uchar *>(data));
+    }
+}
+
+bool AssetPack::write(const QString &packPath, const QString &assetsPath,
+                      const QList<SequenceSpec> &specs, const QList<qreal> &devicePixelRatios)
+{
+    QList<PackSequence> sequenceRecords;
+    QList<PackEntry> entryRecords;
+    QList<PackDisplayList> displayListRecords;
+    QHash<QString, DisplayList> compiled;
+    QByteArray blobs;
+
+    for (const qreal devicePixelRatio : devicePixelRatios) {
+        for (const SequenceSpec &spec : specs) {
+            QByteArray prefix = spec.prefix.toUtf8();
+            if (prefix.size() >= int(sizeof(PackSequence::prefix))) {
+                qDebug() << "Asset prefix is too long for the pack:" << spec.prefix;
+                return false;
+            }
+            PackSequence sequence = {};
+            std::memcpy(sequence.prefix, prefix.constData(), prefix.size());
+            sequence.width = qToLittleEndian<quint32>(spec.size.width());
+            sequence.height = qToLittleEndian<quint32>(spec.size.height());
+            sequence.dprPercent = qToLittleEndian<quint32>(toDprPercent(devicePixelRatio));
+            sequence.firstNumber = qToLittleEndian<quint32>(spec.first);
+            sequence.frameCount = qToLittleEndian<quint32>(spec.last - spec.first + 1);
+            sequence.firstEntry = qToLittleEndian<quint32>(entryRecords.size());
+            sequenceRecords.append(sequence);
+
+            for (int number = spec.first; number <= spec.last; ++number) {
+                // SVG разбирается один раз на кадр, растры всех размеров строятся из списка команд
+                const QString assetName = spec.prefix + QString::number(number);
+                auto list = compiled.constFind(assetName);
+                if (list == compiled.constEnd()) {
+                    const DisplayList compiledList = DisplayList::compile(assetsPath + assetName + ".svg");
+                    if (compiledList.isNull()) {
+                        return false;
+                    }
+                    list = compiled.insert(assetName, compiledList);
+
+                    const QByteArray name = assetName.toUtf8();
+                    if (name.size() >= int(sizeof(PackDisplayList::name))) {
+                        qDebug() << "Asset name is too long for the pack:" << assetName;
+                        return false;
+                    }
+                    const QByteArray compressedList = qCompress(compiledList.toData());
+                    PackDisplayList record = {};
+                    std::memcpy(record.name, name.constData(), name.size());
+                    record.offset = qToLittleEndian<quint64>(blobs.size());
+                    record.compressedSize = qToLittleEndian<quint32>(compressedList.size());
+                    displayListRecords.append(record);
+                    blobs.append(compressedList);
+                }
+                QImage image = list->rasterize(spec.size, devicePixelRatio);
+
+                const QByteArray compressed = qCompress(image.constBits(), int(image.sizeInBytes()));
+                PackEntry entry = {};
+                entry.offset = qToLittleEndian<quint64>(blobs.size());
+                entry.compressedSize = qToLittleEndian<quint32>(compressed.size());
+                entryRecords.append(entry);
+                blobs.append(compressed);
+            }
+        }
+    }
+
+    PackHeader header = {};
+    std::memcpy(header.magic, PackMagic, sizeof(PackMagic));
+    header.version = qToLittleEndian(PackVersion);
+    header.sequenceCount = qToLittleEndian<quint32>(sequenceRecords.size());
+    header.entryCount = qToLittleEndian<quint32>(entryRecords.size());
+    header.displayListCount = qToLittleEndian<quint32>(displayListRecords.size());
+
+    // Смещения кадров в записях считаются от начала области данных
+    QSaveFile out(packPath);
+    if (!out.open(QIODevice::WriteOnly)) {
+        qDebug() << "Cannot write asset pack:" << packPath << out.errorString();
+        return false;
+    }
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(sequenceRecords.constData()), sequenceRecords.size() * sizeof(PackSequence));
+    out.write(reinterpret_cast<const char *>(entryRecords.constData()), entryRecords.size() * sizeof(PackEntry));
+    out.write(reinterpret_cast<const char *>(displayListRecords.constData()),
+              displayListRecords.size() * sizeof(PackDisplayList));
+    out.write(blobs);
+    return out.commit();
+}
+
+bool AssetPack::open(const QString &packPath)
+{
+    file.setFileName(packPath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    dataSize = file.size();
+    // Файл остаётся открытым: QFile::close() снимает все отображения
+    data = file.map(0, dataSize);
+    if (!data || dataSize < qint64(sizeof(PackHeader))) {
+        qDebug() << "Cannot map asset pack:" << packPath;
+        return false;
+    }
+
+    PackHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, PackMagic, sizeof(PackMagic)) != 0
+        || qFromLittleEndian(header.version) != PackVersion) {
+        qDebug() << "Unsupported asset pack:" << packPath;
+        return false;
+    }
+
+    const qint64 sequenceCount = qFromLittleEndian(header.sequenceCount);
+    const qint64 entryCount = qFromLittleEndian(header.entryCount);
+    const qint64 displayListCount = qFromLittleEndian(header.displayListCount);
+    const qint64 blobsOffset = qint64(sizeof(PackHeader)) + sequenceCount * qint64(sizeof(PackSequence))
+                               + entryCount * qint64(sizeof(PackEntry))
+                               + displayListCount * qint64(sizeof(PackDisplayList));
+    if (blobsOffset > dataSize) {
+        qDebug() << "Truncated asset pack:" << packPath;
+        return false;
+    }
+
+    const uchar *cursor = data + sizeof(PackHeader);
+    for (qint64 i = 0; i < sequenceCount; ++i, cursor += sizeof(PackSequence)) {
+        PackSequence record;
+        std::memcpy(&record, cursor, sizeof(record));
+        const QString prefix = QString::fromUtf8(record.prefix, qstrnlen(record.prefix, sizeof(record.prefix)));
+        int id = prefixId(prefix);
+        if (id < 0) {
+            id = int(prefixes.size());
+            prefixes.append(prefix);
+        }
+        const SequenceKey key = {id, int(qFromLittleEndian(record.width)), int(qFromLittleEndian(record.height)),
+                                 int(qFromLittleEndian(record.dprPercent))};
+        // Кадры последовательности должны лежать в таблице записей целиком
+        const quint32 frameCount = qFromLittleEndian(record.frameCount);
+        const quint32 firstEntry = qFromLittleEndian(record.firstEntry);
+        if (quint64(firstEntry) + frameCount > quint64(entryCount)) {
+            qDebug() << "Truncated asset pack:" << packPath;
+            prefixes.clear();
+            sequences.clear();
+            return false;
+        }
+        Sequence sequence;
+        sequence.firstNumber = qFromLittleEndian(record.firstNumber);
+        sequence.frameCount = int(frameCount);
+        sequence.firstEntry = int(firstEntry);
+        sequences.insert(key, sequence);
+    }
+
+    entries.reserve(entryCount);
+    for (qint64 i = 0; i < entryCount; ++i, cursor += sizeof(PackEntry)) {
+        PackEntry record;
+        std::memcpy(&record, cursor, sizeof(record));
+        Entry entry;
+        entry.offset = blobsOffset + qFromLittleEndian(record.offset);
+        entry.compressedSize = qFromLittleEndian(record.compressedSize);
+        if (qint64(entry.offset + entry.compressedSize) > dataSize) {
+            qDebug() << "Truncated asset pack:" << packPath;
+            prefixes.clear();
+            sequences.clear();
+            entries.clear();
+            return false;
+        }
+        entries.append(entry);
+    }
+
+    for (qint64 i = 0; i < displayListCount; ++i, cursor += sizeof(PackDisplayList)) {
+        PackDisplayList record;
+        std::memcpy(&record, cursor, sizeof(record));
+        Entry entry;
+        entry.offset = blobsOffset + qFromLittleEndian(record.offset);
+        entry.compressedSize = qFromLittleEndian(record.compressedSize);
+        if (qint64(entry.offset + entry.compressedSize) > dataSize) {
+            qDebug() << "Truncated asset pack:" << packPath;
+            prefixes.clear();
+            sequences.clear();
+            entries.clear();
+            displayLists.clear();
+            return false;
+        }
+        displayLists.insert(QString::fromUtf8(record.name, qstrnlen(record.name, sizeof(record.name))), entry);
+    }
+    return true;
+}
+
+bool AssetPack::isOpen() const
+{
+    return !entries.isEmpty();
+}
+
+bool AssetPack::contains(const QString &assetName, const QSize &size, qreal devicePixelRatio) const
+{
+    return findEntry(assetName, size, devicePixelRatio) != nullptr;
+}
+
+QImage AssetPack::frame(const QString &assetName, const QSize &size, qreal devicePixelRatio) const
+{
+    const Entry *entry = findEntry(assetName, size, devicePixelRatio);
+    if (!entry) {
+        return QImage();
+    }
+    const QSize pixelSize = size * devicePixelRatio;
+    QByteArray *pixels = new QByteArray(qUncompress(data + entry->offset, qsizetype(entry->compressedSize)));
+    if (pixels->size() != qsizetype(pixelSize.width()) * pixelSize.height() * 4) {
+        qDebug() << "Corrupted frame in asset pack:" << assetName;
+        delete pixels;
+        return QImage();
+    }
+    // QImage ссылается на распакованный буфер и освобождает его сам
+    QImage image(reinterpret_cast<uchar *>(pixels->data()), pixelSize.width(), pixelSize.height(),
+                 pixelSize.width() * 4, QImage::Format_ARGB32_Premultiplied, releaseFrameBuffer, pixels);
+    image.setDevicePixelRatio(devicePixelRatio);
+    return image;
+}
+
+DisplayList AssetPack::displayList(const QString &assetName) const
+{
+    auto it = displayLists.constFind(assetName);
+    if (it == displayLists.constEnd()) {
+        return DisplayList();
+    }
+    const DisplayList list = DisplayList::fromData(qUncompress(data + it->offset, qsizetype(it->compressedSize)));
+    if (list.isNull()) {
+        qDebug() << "Corrupted display list in asset pack:" << assetName;
+    }
+    return list;
+}
+
+bool AssetPack::splitAssetName(const QString &assetName, QString &prefix, int &number)
+{
+    const qsizetype digits = numberPosition(assetName);
+    if (digits == 0) {
+        return false;
+    }
+    prefix = assetName.left(digits);
+    number = assetName.mid(digits).toInt();
+    return true;
+}
+
+int AssetPack::prefixId(QStringView prefix) const
+{
+    // Префиксов десяток: перебор без выделения памяти дешевле хэширования строки
+    for (int id = 0; id < prefixes.size(); ++id) {
+        if (prefixes.at(id) == prefix) return id;
+    }
+    return -1;
+}
+
+const AssetPack::Entry *AssetPack::findEntry(const QString &assetName, const QSize &size, qreal devicePixelRatio) const
+{
+    if (entries.isEmpty()) {
+        return nullptr;
+    }
+    const qsizetype digits = numberPosition(assetName);
+    if (digits == 0) {
+        return nullptr;
+    }
+    const int id = prefixId(QStringView(assetName).left(digits));
+    if (id < 0) {
+        return nullptr;
+    }
+    auto it = sequences.constFind(SequenceKey{id, size.width(), size.height(), toDprPercent(devicePixelRatio)});
+    if (it == sequences.constEnd()) {
+        return nullptr;
+    }
+    const int index = QStringView(assetName).mid(digits).toInt() - it->firstNumber;
+    if (index < 0 || index >= it->frameCount) {
+        return nullptr;
+    }
+    return &entries.at(it->firstEntry + index);
+}
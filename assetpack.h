@@ -0,0 +1,83 @@
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <QFile>
+#include <QHash>
+#include <QImage>
+#include <QList>
+#include <QSize>
+#include <QString>
+
+class DisplayList;
+
+// Пакет заранее растеризованных кадров анимаций (assets.pack).
+// Собирается на машине сборки утилитой tools/packassets, при запуске
+// отображается в память; кадр ищется по префиксу и номеру за O(1).
+// Рядом с растрами лежат списки команд отрисовки (DisplayList) каждого
+// кадра — по ним кадр строится в любом другом размере без разбора SVG.
+class AssetPack {
+public:
+    struct SequenceSpec {
+        QString prefix;
+        int first;
+        int last;
+        QSize size;
+    };
+
+    AssetPack();
+    ~AssetPack();
+
+    // Каждая последовательность растеризуется во всех devicePixelRatios
+    static bool write(const QString &packPath, const QString &assetsPath,
+                      const QList<SequenceSpec> &sequences, const QList<qreal> &devicePixelRatios);
+
+    bool open(const QString &packPath);
+    bool isOpen() const;
+    bool contains(const QString &assetName, const QSize &size, qreal devicePixelRatio) const;
+    QImage frame(const QString &assetName, const QSize &size, qreal devicePixelRatio) const;
+    DisplayList displayList(const QString &assetName) const;
+
+    static bool splitAssetName(const QString &assetName, QString &prefix, int &number);
+
+private:
+    // Ключ последовательности без строк: номер префикса в prefixes и размер в пикселях
+    struct SequenceKey {
+        int prefixId;
+        int width;
+        int height;
+        int dprPercent;
+
+        bool operator==(const SequenceKey &other) const
+        {
+            return prefixId == other.prefixId && width == other.width && height == other.height
+                   && dprPercent == other.dprPercent;
+        }
+    };
+    friend size_t qHash(const SequenceKey &key, size_t seed)
+    {
+        return qHashMulti(seed, key.prefixId, key.width, key.height, key.dprPercent);
+    }
+
+    struct Sequence {
+        int firstNumber;
+        int frameCount;
+        int firstEntry;
+    };
+    struct Entry {
+        quint64 offset;
+        quint32 compressedSize;
+    };
+
+    int prefixId(QStringView prefix) const;
+    const Entry *findEntry(const QString &assetName, const QSize &size, qreal devicePixelRatio) const;
+
+    QFile file;
+    const uchar *data = nullptr;
+    qint64 dataSize = 0;
+    QList<QString> prefixes;
+    QHash<SequenceKey, Sequence> sequences;
+    QList<Entry> entries;
+    QHash<QString, Entry> displayLists;
+};
+
+#endif // ASSETPACK_H
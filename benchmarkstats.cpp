@@ -0,0 +1,176 @@
+#include "benchmarkstats.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#if defined(_MSC_VER) && defined(_DEBUG)
+#include <crtdbg.h>
+#endif
+#elif defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
+static std::atomic<quint64> allocationCounter{0};
+
+#if defined(__GLIBC__)
+// В glibc функции выделения можно подменить прямо в бинарнике: вызовы из Qt
+// тоже проходят здесь. operator new (и с выравниванием) в libstdc++ сводится
+// к malloc и aligned_alloc, поэтому отдельно не перехватывается.
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *pointer, size_t size);
+extern "C" void *__libc_memalign(size_t alignment, size_t size);
+extern "C" void *__libc_valloc(size_t size);
+extern "C" void *__libc_pvalloc(size_t size);
+
+static void countAllocation()
+{
+    allocationCounter.fetch_add(1, std::memory_order_relaxed);
+}
+
+extern "C" void *malloc(size_t size)
+{
+    countAllocation();
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    countAllocation();
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *pointer, size_t size)
+{
+    countAllocation();
+    return __libc_realloc(pointer, size);
+}
+
+extern "C" void *memalign(size_t alignment, size_t size)
+{
+    countAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" void *aligned_alloc(size_t alignment, size_t size)
+{
+    countAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void **result, size_t alignment, size_t size)
+{
+    // Те же проверки, что у glibc: степень двойки, кратная размеру указателя
+    if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    countAllocation();
+    void *pointer = __libc_memalign(alignment, size);
+    if (!pointer) {
+        return ENOMEM;
+    }
+    *result = pointer;
+    return 0;
+}
+
+extern "C" void *valloc(size_t size)
+{
+    countAllocation();
+    return __libc_valloc(size);
+}
+
+extern "C" void *pvalloc(size_t size)
+{
+    countAllocation();
+    return __libc_pvalloc(size);
+}
+#elif defined(_MSC_VER) && defined(_DEBUG)
+// Под Windows выделения видны только через хук отладочной CRT
+static int countAllocation(int allocType, void *, size_t, int, long, const unsigned char *, int)
+{
+    if (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC) {
+        allocationCounter.fetch_add(1, std::memory_order_relaxed);
+    }
+    return TRUE;
+}
+#endif
+
+void BenchmarkStats::installAllocationHook()
+{
+#if defined(_MSC_VER) && defined(_DEBUG)
+    _CrtSetAllocHook(countAllocation);
+#endif
+}
+
+quint64 BenchmarkStats::allocations()
+{
+    return allocationCounter.load(std::memory_order_relaxed);
+}
+
+bool BenchmarkStats::allocationsTracked()
+{
+#if defined(__GLIBC__) || (defined(_MSC_VER) && defined(_DEBUG))
+    return true;
+#else
+    return false;
+#endif
+}
+
+qint64 BenchmarkStats::peakResidentBytes()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return qint64(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#elif defined(Q_OS_UNIX)
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(Q_OS_MACOS)
+    return usage.ru_maxrss;
+#else
+    return qint64(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+qint64 BenchmarkStats::percentile(QList<qint64> samples, int percent)
+{
+    if (samples.isEmpty()) {
+        return 0;
+    }
+    const qsizetype index = (samples.size() - 1) * percent / 100;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+void BenchmarkStats::printHeader(QTextStream &out)
+{
+    out << qSetFieldWidth(28) << Qt::left << "scenario" << qSetFieldWidth(8) << Qt::right << "frames"
+        << qSetFieldWidth(12) << "cold p50" << "cold p99" << "warm p50" << "warm p99"
+        << qSetFieldWidth(14) << "allocs/frame" << qSetFieldWidth(0) << Qt::endl;
+}
+
+void BenchmarkStats::report(QTextStream &out, const QString &scenario, const BenchmarkSamples &samples)
+{
+    const qsizetype frames = samples.cold.size() + samples.warm.size();
+    auto ms = [](const QList<qint64> &values, int percent) {
+        return values.isEmpty() ? QString("-") : QString::number(percentile(values, percent) / 1e6, 'f', 3);
+    };
+    out << qSetFieldWidth(28) << Qt::left << scenario << qSetFieldWidth(8) << Qt::right << frames
+        << qSetFieldWidth(12) << ms(samples.cold, 50) << ms(samples.cold, 99)
+        << ms(samples.warm, 50) << ms(samples.warm, 99) << qSetFieldWidth(14);
+    if (allocationsTracked() && !samples.warm.isEmpty()) {
+        out << QString::number(double(samples.warmAllocations) / samples.warm.size(), 'f', 1);
+    } else {
+        out << "n/a";
+    }
+    out << qSetFieldWidth(0) << Qt::endl;
+}
@@ -0,0 +1,32 @@
+#ifndef BENCHMARKSTATS_H
+#define BENCHMARKSTATS_H
+
+#include <QList>
+#include <QString>
+#include <QTextStream>
+
+// Выборка одного сценария замеров: cold — первый проход (кэши пустые),
+// warm — остальные; выделения памяти считаются только в warm
+struct BenchmarkSamples {
+    QList<qint64> cold;
+    QList<qint64> warm;
+    quint64 warmAllocations = 0;
+};
+
+// Общее для всех замеров (qmake CONFIG+=benchmark): счётчик выделений
+// памяти, пиковый RSS и строка отчёта с p50/p99. Выделения видны в glibc
+// (перехват семейства malloc, через него идёт и operator new) и в
+// отладочной CRT MSVC; в остальных сборках в отчёте n/a.
+class BenchmarkStats {
+public:
+    static void installAllocationHook();
+    static quint64 allocations();
+    static bool allocationsTracked();
+    static qint64 peakResidentBytes();
+    static qint64 percentile(QList<qint64> samples, int percent);
+
+    static void printHeader(QTextStream &out);
+    static void report(QTextStream &out, const QString &scenario, const BenchmarkSamples &samples);
+};
+
+#endif // BENCHMARKSTATS_H
@@ -0,0 +1,97 @@
+#include "displaylist.h"
+#include <QDataStream>
+#include <QDebug>
+#include <QPainter>
+#include <QPicture>
+#include <QSvgRenderer>
+
+namespace {
+
+const quint32 DisplayListMagic = 0x4b444c31; // "KDL1"
+
+}
+
+DisplayList DisplayList::compile(const QString &svgPath)
+{
+    DisplayList list;
+    QSvgRenderer renderer(svgPath);
+    if (!renderer.isValid()) {
+        qDebug() << "Invalid SVG content in:" << svgPath;
+        return list;
+    }
+    // Команды пишутся в координатах исходного размера SVG, масштаб задаётся при воспроизведении
+    list.logicalSize = renderer.defaultSize();
+    QPicture recording;
+    QPainter painter(&recording);
+    painter.setRenderHint(QPainter::Antialiasing);
+    renderer.render(&painter, QRectF(QPointF(0, 0), list.logicalSize));
+    painter.end();
+    list.picture = QByteArray(recording.data(), recording.size());
+    return list;
+}
+
+DisplayList DisplayList::fromData(const QByteArray &data)
+{
+    DisplayList list;
+    QDataStream stream(data);
+    stream.setVersion(QDataStream::Qt_6_0);
+    quint32 magic = 0;
+    stream >> magic;
+    if (magic != DisplayListMagic) {
+        return list;
+    }
+    stream >> list.logicalSize >> list.picture;
+    if (stream.status() != QDataStream::Ok) {
+        return DisplayList();
+    }
+    return list;
+}
+
+QByteArray DisplayList::toData() const
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << DisplayListMagic << logicalSize << picture;
+    return data;
+}
+
+bool DisplayList::isNull() const
+{
+    return picture.isEmpty() || logicalSize.isEmpty();
+}
+
+QSizeF DisplayList::size() const
+{
+    return logicalSize;
+}
+
+void DisplayList::replay(QPainter *painter, const QRectF &target) const
+{
+    if (isNull()) {
+        return;
+    }
+    // QPicture::play сдвигает позицию общего буфера, поэтому у каждого потока своя копия
+    QPicture recording;
+    recording.setData(picture.constData(), uint(picture.size()));
+    painter->save();
+    painter->translate(target.topLeft());
+    painter->scale(target.width() / logicalSize.width(), target.height() / logicalSize.height());
+    painter->drawPicture(0, 0, recording);
+    painter->restore();
+}
+
+QImage DisplayList::rasterize(const QSize &size, qreal devicePixelRatio) const
+{
+    if (isNull()) {
+        return QImage();
+    }
+    QImage image(size * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    replay(&painter, QRectF(QPointF(0, 0), QSizeF(size)));
+    painter.end();
+    return image;
+}
@@ -0,0 +1,34 @@
+#ifndef DISPLAYLIST_H
+#define DISPLAYLIST_H
+
+#include <QByteArray>
+#include <QImage>
+#include <QRectF>
+#include <QSizeF>
+
+class QPainter;
+
+// SVG-кадр, скомпилированный в список команд QPainter (пути, кисти,
+// преобразования) в формате QPicture. Воспроизводится в любом размере и
+// при любом DPR без разбора XML, поэтому смена размера окна или экрана
+// стоит одной растеризации, а не повторного чтения SVG.
+class DisplayList {
+public:
+    DisplayList() = default;
+
+    static DisplayList compile(const QString &svgPath);
+    static DisplayList fromData(const QByteArray &data);
+    QByteArray toData() const;
+
+    bool isNull() const;
+    QSizeF size() const;
+
+    void replay(QPainter *painter, const QRectF &target) const;
+    QImage rasterize(const QSize &size, qreal devicePixelRatio) const;
+
+private:
+    QSizeF logicalSize;
+    QByteArray picture;
+};
+
+#endif // DISPLAYLIST_H
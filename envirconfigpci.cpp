@@ -1,65 +1,208 @@
 #include "envirconfigpci.h"
+#include "pcidb.h"
+#include "pcihwid.h"
 #include <vector>
-#include <string>
-#include <regex>
 #include <QStringList>
+#include <QFile>
+#include <QFuture>
+#include <QSet>
 
 #ifdef Q_OS_WIN
 #include <windows.h>
 #include <setupapi.h>
 #include <devguid.h>
+#elif defined(Q_OS_LINUX)
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
-static std::vector<std::string> splitMultiSz(const std::vector<char>& buf) {
-    std::vector<std::string> out;
-    size_t i = 0;
-    while (i < buf.size() && buf[i] != '\0') {
-        std::string s(&buf[i]);
-        out.push_back(s);
-        i += s.size() + 1;
+static QString hexId(quint32 value) {
+    static const char digits[] = "0123456789ABCDEF";
+    const QChar text[4] = {QLatin1Char(digits[(value >> 12) & 0xF]), QLatin1Char(digits[(value >> 8) & 0xF]),
+                           QLatin1Char(digits[(value >> 4) & 0xF]), QLatin1Char(digits[value & 0xF])};
+    return QString(text, 4);
+}
+
+#ifdef Q_OS_WIN
+// Строковое свойство устройства (REG_MULTI_SZ) в общий буфер; буфер растёт,
+// если список не поместился. size — сколько байт заполнено
+static bool readDeviceProperty(HDEVINFO devInfo, SP_DEVINFO_DATA &devData, DWORD property,
+                               std::vector<char> &buffer, size_t &size) {
+    DWORD required = 0;
+    if (!SetupDiGetDeviceRegistryPropertyA(devInfo, &devData, property, nullptr,
+                                           (PBYTE)buffer.data(), (DWORD)buffer.size(), &required)) {
+        if (GetLastError() != ERROR_INSUFFICIENT_BUFFER) return false;
+        buffer.resize(required);
+        if (!SetupDiGetDeviceRegistryPropertyA(devInfo, &devData, property, nullptr,
+                                               (PBYTE)buffer.data(), (DWORD)buffer.size(), &required)) return false;
+    }
+    size = qMin<size_t>(required, buffer.size());
+    return true;
+}
+#endif
+
+#ifdef Q_OS_LINUX
+// Числовые атрибуты sysfs короткие: "0x8086\n", "-1\n"; одного буфера на стеке хватает
+static constexpr size_t SysfsAttrSize = 64;
+
+static int readAttr(int deviceFd, const char *name, char *buf) {
+    int fd = openat(deviceFd, name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return -1;
+    ssize_t n = pread(fd, buf, SysfsAttrSize - 1, 0);
+    close(fd);
+    if (n < 0) return -1;
+    while (n > 0 && (buf[n - 1] == '\n' || buf[n - 1] == ' ')) --n;
+    buf[n] = '\0';
+    return int(n);
+}
+
+// label — строка прошивки (SMBIOS/ACPI) произвольной длины, может быть в UTF-8:
+// читается целиком, а не в короткий буфер, чтобы не обрезать символ посередине
+static QByteArray readTextAttr(int deviceFd, const char *name) {
+    QByteArray text;
+    int fd = openat(deviceFd, name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return text;
+    char chunk[256];
+    ssize_t n;
+    while ((n = pread(fd, chunk, sizeof(chunk), text.size())) > 0) text.append(chunk, n);
+    close(fd);
+    if (n < 0) return QByteArray();
+    while (text.endsWith('\n') || text.endsWith(' ')) text.chop(1);
+    return text;
+}
+
+static bool parseHexAttr(int deviceFd, const char *name, char *buf, quint32 &value) {
+    if (readAttr(deviceFd, name, buf) <= 0) return false;
+    const char *p = buf;
+    if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) p += 2;
+    quint32 result = 0;
+    for (; *p; ++p) {
+        const char c = *p;
+        int digit;
+        if (c >= '0' && c <= '9') digit = c - '0';
+        else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+        else return false;
+        result = (result << 4) | quint32(digit);
     }
-    return out;
+    value = result;
+    return true;
 }
 
-envirconfigPCI::envirconfigPCI() {}
+// Атрибуты одного устройства каталога bus/pci/devices; false — это не функция PCI
+static bool readSysfsDevice(int dirFd, const char *name, PCIDevice &dev) {
+    int deviceFd = openat(dirFd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (deviceFd < 0) return false;
+
+    char buf[SysfsAttrSize];
+    quint32 vendor = 0, device = 0;
+    if (!parseHexAttr(deviceFd, "vendor", buf, vendor) || !parseHexAttr(deviceFd, "device", buf, device)) {
+        close(deviceFd);
+        return false;
+    }
+    dev.vendorID = hexId(vendor);
+    dev.deviceID = hexId(device);
+    dev.instanceID = QString::fromLatin1(name);
+    dev.bdf = dev.instanceID;
+    parseHexAttr(deviceFd, "class", buf, dev.classCode);
+    quint32 subsystem = 0;
+    if (parseHexAttr(deviceFd, "subsystem_vendor", buf, subsystem)) dev.subsystemVendorID = hexId(subsystem);
+    if (parseHexAttr(deviceFd, "subsystem_device", buf, subsystem)) dev.subsystemID = hexId(subsystem);
+    if (readAttr(deviceFd, "numa_node", buf) > 0) dev.numaNode = atoi(buf);
+    dev.vendorName = PciDatabase::vendorName(quint16(vendor));
+    dev.deviceName = PciDatabase::deviceName(quint16(vendor), quint16(device));
+    // Своего названия у устройства в sysfs обычно нет — берём из таблицы
+    const QByteArray label = readTextAttr(deviceFd, "label");
+    if (!label.isEmpty()) dev.friendlyName = QString::fromUtf8(label);
+    else dev.friendlyName = PciDatabase::displayName(quint16(vendor), quint16(device));
+
+    // driver — ссылка вида ../../../bus/pci/drivers/ahci, нужно только последнее имя
+    char link[256];
+    const ssize_t linkSize = readlinkat(deviceFd, "driver", link, sizeof(link) - 1);
+    if (linkSize > 0) {
+        link[linkSize] = '\0';
+        const char *slash = strrchr(link, '/');
+        dev.driver = QString::fromLatin1(slash ? slash + 1 : link);
+    }
+    close(deviceFd);
+    return true;
+}
+
+static void enumerateSysfs(const QString &sysfsRoot, QPromise<PCIDevice> &promise) {
+    const QByteArray devicesPath = QFile::encodeName(sysfsRoot + "/bus/pci/devices");
+    int dirFd = open(devicesPath.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd < 0) return;
+    // fdopendir забирает дескриптор себе, поэтому для openat держим копию
+    DIR *dir = fdopendir(dup(dirFd));
+    if (!dir) {
+        close(dirFd);
+        return;
+    }
+    // Сначала одни имена: так известно общее число для хода перечисления, а
+    // результаты сразу идут по адресу на шине (порядок readdir не определён)
+    QList<QByteArray> names;
+    while (dirent *entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') names.append(QByteArray(entry->d_name));
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+
+    promise.setProgressRange(0, int(names.size()));
+    for (int i = 0; i < names.size(); ++i) {
+        if (promise.isCanceled()) break;
+        PCIDevice dev;
+        if (readSysfsDevice(dirFd, names[i].constData(), dev)) promise.addResult(dev);
+        promise.setProgressValue(i + 1);
+    }
+    close(dirFd);
+}
+#endif
+
+envirconfigPCI::envirconfigPCI(const QString &sysfsRoot)
+    : sysfsRoot(sysfsRoot.isEmpty() ? QStringLiteral("/sys") : sysfsRoot) {}
 
 QList<PCIDevice> envirconfigPCI::getPCIDevices() {
-    QList<PCIDevice> list;
+    QPromise<PCIDevice> promise;
+    QFuture<PCIDevice> future = promise.future();
+    promise.start();
+    enumerate(promise);
+    promise.finish();
+    return future.results();
+}
 
+void envirconfigPCI::enumerate(QPromise<PCIDevice> &promise) const {
 #ifdef Q_OS_WIN
     HDEVINFO devInfo = SetupDiGetClassDevsA(nullptr, nullptr, nullptr, DIGCF_ALLCLASSES | DIGCF_PRESENT);
-    if (devInfo == INVALID_HANDLE_VALUE) return list;
+    if (devInfo == INVALID_HANDLE_VALUE) return;
 
     SP_DEVINFO_DATA devData;
     devData.cbSize = sizeof(SP_DEVINFO_DATA);
 
+    // Перебор без чтения свойств быстрый — заранее узнаём общее число для хода перечисления
+    DWORD total = 0;
+    while (SetupDiEnumDeviceInfo(devInfo, total, &devData)) ++total;
+    promise.setProgressRange(0, int(total));
+
+    // Буфер один на всё перечисление и растёт только под самый длинный список ID
+    std::vector<char> buffer(4096);
     for (DWORD index = 0; SetupDiEnumDeviceInfo(devInfo, index, &devData); ++index) {
-        DWORD required = 0;
-        std::vector<char> buffer(4096);
-        if (!SetupDiGetDeviceRegistryPropertyA(devInfo, &devData, SPDRP_HARDWAREID, nullptr,
-                                               (PBYTE)buffer.data(), (DWORD)buffer.size(), &required)) {
-            if (GetLastError() == ERROR_INSUFFICIENT_BUFFER) {
-                buffer.resize(required);
-                if (!SetupDiGetDeviceRegistryPropertyA(devInfo, &devData, SPDRP_HARDWAREID, nullptr,
-                                                       (PBYTE)buffer.data(), (DWORD)buffer.size(), &required)) continue;
-            } else continue;
-        }
+        if (promise.isCanceled()) break;
+        promise.setProgressValue(int(index));
+        size_t size = 0;
+        if (!readDeviceProperty(devInfo, devData, SPDRP_HARDWAREID, buffer, size)) continue;
+
+        PciHardwareId hwid;
+        if (!findPciHardwareId(buffer.data(), size, hwid)) continue;
 
-        auto hwids = splitMultiSz(buffer);
-        QString vendor, device;
-        bool foundPCI = false;
-        std::regex pci_re(R"(PCI\\VEN_([0-9A-Fa-f]{4})&DEV_([0-9A-Fa-f]{4}))");
-
-        for (const auto& s : hwids) {
-            std::smatch m;
-            if (std::regex_search(s, m, pci_re) && m.size() >= 3) {
-                vendor = QString::fromStdString(m[1]).toUpper();
-                device = QString::fromStdString(m[2]).toUpper();
-                foundPCI = true;
-                break;
-            }
+        // Код класса есть только в совместимых ID; буфер hardware ID уже разобран, берём его же
+        quint32 classCode = 0;
+        if (readDeviceProperty(devInfo, devData, SPDRP_COMPATIBLEIDS, buffer, size)) {
+            findPciClassCode(buffer.data(), size, classCode);
         }
-        if (!foundPCI) continue;
 
         char instanceIdBuf[512] = {};
         SetupDiGetDeviceInstanceIdA(devInfo, &devData, instanceIdBuf, sizeof(instanceIdBuf), nullptr);
@@ -71,11 +214,93 @@ QList<PCIDevice> envirconfigPCI::getPCIDevices() {
                                               (PBYTE)friendly, sizeof(friendly), nullptr);
         }
 
-        list.append({vendor, device,
-                     QString::fromLocal8Bit(instanceIdBuf),
-                     QString::fromLocal8Bit(friendly)});
+        PCIDevice dev;
+        dev.vendorID = hexId(hwid.vendor);
+        dev.deviceID = hexId(hwid.device);
+        dev.instanceID = QString::fromLocal8Bit(instanceIdBuf);
+        // Ключ снимка — instance ID: SPDRP_BUSNUMBER и SPDRP_ADDRESS не сообщают домен,
+        // и на хостах с несколькими сегментами PCI адреса совпадали бы
+        dev.bdf = dev.instanceID;
+        dev.friendlyName = QString::fromLocal8Bit(friendly);
+        dev.vendorName = PciDatabase::vendorName(hwid.vendor);
+        dev.deviceName = PciDatabase::deviceName(hwid.vendor, hwid.device);
+        if (dev.friendlyName.isEmpty()) dev.friendlyName = PciDatabase::displayName(hwid.vendor, hwid.device);
+        dev.classCode = classCode;
+        if (hwid.hasSubsystem) {
+            dev.subsystemVendorID = hexId(hwid.subsystemVendor);
+            dev.subsystemID = hexId(hwid.subsystemDevice);
+        }
+        promise.addResult(dev);
     }
+    promise.setProgressValue(int(total));
     SetupDiDestroyDeviceInfoList(devInfo);
+#elif defined(Q_OS_LINUX)
+    enumerateSysfs(sysfsRoot, promise);
+#else
+    Q_UNUSED(promise);
 #endif
-    return list;
+}
+
+static bool sameDevice(const PCIDevice &a, const PCIDevice &b) {
+    return a.vendorID == b.vendorID && a.deviceID == b.deviceID && a.classCode == b.classCode
+           && a.subsystemVendorID == b.subsystemVendorID && a.subsystemID == b.subsystemID
+           && a.driver == b.driver && a.numaNode == b.numaNode && a.friendlyName == b.friendlyName
+           && a.instanceID == b.instanceID;
+}
+
+void envirconfigPCI::compare(const PCIDevice &device, PciDelta &delta) {
+    auto it = snapshot.find(device.bdf);
+    if (it == snapshot.end()) {
+        snapshot.insert(device.bdf, device);
+        delta.added.append(device);
+    } else if (!sameDevice(*it, device)) {
+        *it = device;
+        delta.changed.append(device);
+    }
+}
+
+PciDelta envirconfigPCI::applySnapshot(const QList<PCIDevice> &devices) {
+    PciDelta delta;
+    QSet<QString> present;
+    present.reserve(devices.size());
+    for (const PCIDevice &device : devices) {
+        present.insert(device.bdf);
+        compare(device, delta);
+    }
+    for (auto it = snapshot.begin(); it != snapshot.end();) {
+        if (present.contains(it.key())) {
+            ++it;
+        } else {
+            delta.removed.append(it.key());
+            it = snapshot.erase(it);
+        }
+    }
+    snapshotTaken = true;
+    return delta;
+}
+
+PciDelta envirconfigPCI::refresh(const QStringList &bdfs) {
+    PciDelta delta;
+#ifdef Q_OS_LINUX
+    const QByteArray devicesPath = QFile::encodeName(sysfsRoot + "/bus/pci/devices");
+    int dirFd = open(devicesPath.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd < 0) return delta;
+    for (const QString &bdf : bdfs) {
+        if (bdf.contains('/')) continue;
+        PCIDevice device;
+        if (readSysfsDevice(dirFd, bdf.toLatin1().constData(), device)) {
+            compare(device, delta);
+        } else if (snapshot.remove(bdf)) {
+            delta.removed.append(bdf);
+        }
+    }
+    close(dirFd);
+#else
+    Q_UNUSED(bdfs);
+#endif
+    return delta;
+}
+
+bool envirconfigPCI::hasSnapshot() const {
+    return snapshotTaken;
 }
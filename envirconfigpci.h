@@ -1,20 +1,62 @@
 #ifndef ENVIRCONFIGPCI_H
 #define ENVIRCONFIGPCI_H
 
+#include <QHash>
 #include <QString>
+#include <QStringList>
 #include <QList>
+#include <QPromise>
 
 struct PCIDevice {
     QString vendorID;
     QString deviceID;
     QString instanceID;
+    QString bdf;                    // ключ при сравнении снимков: адрес на шине "0000:3b:00.0"
+                                    // в Linux, instance ID в Windows
     QString friendlyName;
+    QString vendorName;             // из встроенной таблицы PciDatabase
+    QString deviceName;
+    quint32 classCode = 0;          // базовый класс, подкласс и интерфейс: 0xCCSSPP
+    QString subsystemVendorID;
+    QString subsystemID;
+    QString driver;
+    int numaNode = -1;
+};
+
+// Отличия нового снимка от предыдущего
+struct PciDelta {
+    QList<PCIDevice> added;
+    QList<PCIDevice> changed;
+    QStringList removed;            // ключи (bdf) исчезнувших функций
+
+    bool isEmpty() const { return added.isEmpty() && changed.isEmpty() && removed.isEmpty(); }
 };
 
 class envirconfigPCI {
 public:
-    envirconfigPCI();
+    // sysfsRoot — корень sysfs для Linux (по умолчанию /sys); можно указать снятую копию дерева
+    explicit envirconfigPCI(const QString &sysfsRoot = QString());
+    // Синхронное перечисление; из GUI-потока лучше запускать enumerate через QtConcurrent
     QList<PCIDevice> getPCIDevices();
+    // Каждое найденное устройство сразу уходит в promise, ход перечисления — в
+    // setProgressValue. Отмена проверяется перед каждым устройством. Объект
+    // не меняется, поэтому вызывается из любого потока.
+    void enumerate(QPromise<PCIDevice> &promise) const;
+
+    // Последний снимок хранится здесь; методы ниже вызываются только из GUI-потока.
+    // Запоминает снимок и возвращает его отличия от предыдущего (по ключу bdf)
+    PciDelta applySnapshot(const QList<PCIDevice> &devices);
+    // Перечитывает отдельные функции после события hotplug. Нужен sysfs, поэтому
+    // работает только в Linux; в Windows без адресов нужен полный обход
+    PciDelta refresh(const QStringList &bdfs);
+    bool hasSnapshot() const;
+
+private:
+    void compare(const PCIDevice &device, PciDelta &delta);
+
+    QString sysfsRoot;
+    QHash<QString, PCIDevice> snapshot;
+    bool snapshotTaken = false;
 };
 
 #endif // ENVIRCONFIGPCI_H
@@ -0,0 +1,440 @@
+#include "framecache.h"
+#include "assetpack.h"
+#include <QDebug>
+#include <QMutexLocker>
+#include <QThread>
+#include <algorithm>
+#include <cstring>
+
+FrameCache::FrameCache(const QString &assetsPath) : assetsPath(assetsPath)
+{
+    // Один поток оставляем GUI, остальные растеризуют кадры заранее
+    workers.setMaxThreadCount(qMax(1, QThread::idealThreadCount() - 1));
+    counters.budgetBytes = DefaultByteBudget;
+}
+
+FrameCache::~FrameCache()
+{
+    workers.clear();
+    workers.waitForDone();
+}
+
+void FrameCache::setAssetPack(const AssetPack *pack)
+{
+    assetPack = pack;
+}
+
+FrameCache::Key FrameCache::makeKey(const QString &assetName, const QSize &size, qreal devicePixelRatio)
+{
+    return Key{assetName, size, qRound(devicePixelRatio * 100)};
+}
+
+QImage FrameCache::frame(const QString &assetName, const QSize &size, qreal devicePixelRatio)
+{
+    const Key key = makeKey(assetName, size, devicePixelRatio);
+    StoredFrame stored;
+    bool cached = false;
+    {
+        QMutexLocker locker(&mutex);
+        auto it = frames.find(key);
+        cached = it != frames.end();
+        if (cached) {
+            ++counters.hits;
+            touchLocked(key, it.value());
+            stored = it.value();
+        } else {
+            ++counters.misses;
+        }
+    }
+
+    if (!cached) {
+        // Растеризация идёт без блокировки, чтобы не держать мьютекс на время разбора SVG
+        QImage image = rasterize(assetName, size, devicePixelRatio);
+        QMutexLocker locker(&mutex);
+        stored = storeLocked(key, image);
+        if (!stored.keyFrame.isNull() && stored.materialized.isNull()) {
+            // Только что растеризованный кадр и есть собранная дельта
+            keepMaterializedLocked(key, stored, image);
+            return image;
+        }
+    }
+    if (stored.keyFrame.isNull()) {
+        return stored.pixels;
+    }
+    if (!stored.materialized.isNull()) {
+        return stored.materialized;
+    }
+    // Дельта собирается один раз, дальше кадр отдаётся без копирования
+    const QImage image = materialize(stored);
+    QMutexLocker locker(&mutex);
+    keepMaterializedLocked(key, stored, image);
+    return image;
+}
+
+bool FrameCache::isReady(const QString &assetName, const QSize &size, qreal devicePixelRatio) const
+{
+    QMutexLocker locker(&mutex);
+    return frames.contains(makeKey(assetName, size, devicePixelRatio));
+}
+
+void FrameCache::prefetch(const QStringList &assetNames, const QSize &size, qreal devicePixelRatio)
+{
+    // Задачи ставятся в порядке кадров, поэтому начало анимации готово первым
+    QMutexLocker locker(&mutex);
+    for (const QString &assetName : assetNames) {
+        const Key key = makeKey(assetName, size, devicePixelRatio);
+        if (frames.contains(key) || inFlight.contains(key)) continue;
+        inFlight.insert(key);
+        workers.start([this, key, devicePixelRatio]() {
+            QImage image = rasterize(key.assetName, key.size, devicePixelRatio);
+            QMutexLocker locker(&mutex);
+            ++counters.misses;
+            inFlight.remove(key);
+            storeLocked(key, image);
+        });
+    }
+}
+
+FrameCache::Stats FrameCache::stats() const
+{
+    QMutexLocker locker(&mutex);
+    return counters;
+}
+
+void FrameCache::clear()
+{
+    QMutexLocker locker(&mutex);
+    frames.clear();
+    recency.clear();
+    materializedRecency.clear();
+    bufferOwners.clear();
+    dependents.clear();
+    contentIndex.clear();
+    displayLists.clear();
+    counters.residentBytes = 0;
+    counters.entries = 0;
+    counters.sharedFrames = 0;
+    counters.deltaFrames = 0;
+    counters.materializedFrames = 0;
+}
+
+void FrameCache::setByteBudget(qint64 bytes)
+{
+    QMutexLocker locker(&mutex);
+    counters.budgetBytes = qMax<qint64>(0, bytes);
+    trimLocked(counters.budgetBytes);
+}
+
+void FrameCache::setPinned(const QStringList &assetNames, const QSize &size, qreal devicePixelRatio)
+{
+    QMutexLocker locker(&mutex);
+    pinned.clear();
+    for (const QString &assetName : assetNames) {
+        pinned.insert(makeKey(assetName, size, devicePixelRatio));
+    }
+    // Прежняя анимация больше не защищена, лишнее уходит сразу
+    trimLocked(counters.budgetBytes);
+}
+
+void FrameCache::trim(qint64 bytes)
+{
+    QMutexLocker locker(&mutex);
+    ++counters.trims;
+    trimLocked(qMax<qint64>(0, bytes));
+}
+
+FrameCache::StoredFrame FrameCache::storeLocked(const Key &key, const QImage &image)
+{
+    // Битые кадры тоже запоминаются (пустым изображением), чтобы не разбирать их повторно
+    auto it = frames.constFind(key);
+    if (it != frames.constEnd()) {
+        return it.value();
+    }
+
+    StoredFrame stored;
+    stored.pixels = image;
+    stored.lastUsed = ++useCounter;
+    if (!image.isNull()) {
+        const size_t contentHash = qHashMulti(qHashBits(image.constBits(), size_t(image.sizeInBytes())),
+                                              image.width(), image.height());
+        const auto candidates = std::as_const(contentIndex).equal_range(contentHash);
+        const auto same = std::find(candidates.first, candidates.second, image);
+        if (same != candidates.second) {
+            // Тот же кадр уже лежит в кэше — делим буфер, память не растёт
+            stored.pixels = *same;
+            linkDependentLocked(key, same->cacheKey());
+            ++counters.sharedFrames;
+        } else {
+            const QImage keyFrame = keyFrameForLocked(key);
+            QRect patch;
+            if (!keyFrame.isNull() && keyFrame.size() == image.size() && keyFrame.format() == image.format()) {
+                patch = differenceBounds(keyFrame, image);
+            }
+            if (!patch.isEmpty() && qint64(patch.width()) * patch.height()
+                                        <= qint64(image.width()) * image.height() / DeltaMaxAreaDivisor) {
+                stored.keyFrame = keyFrame;
+                stored.patchOffset = patch.topLeft();
+                stored.pixels = image.copy(patch);
+                stored.bytes = stored.pixels.sizeInBytes();
+                linkDependentLocked(key, keyFrame.cacheKey());
+                ++counters.deltaFrames;
+            } else {
+                contentIndex.insert(contentHash, image);
+                bufferOwners.insert(image.cacheKey(), key);
+                stored.bytes = image.sizeInBytes();
+                stored.contentHash = contentHash;
+                stored.owner = true;
+            }
+            counters.residentBytes += stored.bytes;
+        }
+    }
+    frames.insert(key, stored);
+    recency.insert(stored.lastUsed, key);
+    counters.entries = frames.size();
+    trimLocked(counters.budgetBytes);
+    return stored;
+}
+
+void FrameCache::keepMaterializedLocked(const Key &key, const StoredFrame &delta, const QImage &image)
+{
+    auto it = frames.find(key);
+    // Пока кадр собирался, его могли вытеснить или сохранить заново
+    if (it == frames.end() || !it->materialized.isNull() || it->pixels.cacheKey() != delta.pixels.cacheKey()) {
+        return;
+    }
+    it->materialized = image;
+    materializedRecency.insert(it->lastUsed, key);
+    counters.residentBytes += image.sizeInBytes();
+    ++counters.materializedFrames;
+    trimLocked(counters.budgetBytes);
+}
+
+void FrameCache::dropMaterializedLocked(StoredFrame &stored)
+{
+    if (stored.materialized.isNull()) {
+        return;
+    }
+    materializedRecency.remove(stored.lastUsed);
+    counters.residentBytes -= stored.materialized.sizeInBytes();
+    --counters.materializedFrames;
+    stored.materialized = QImage();
+}
+
+void FrameCache::removeContentLocked(const StoredFrame &owner)
+{
+    // При совпадении хэшей у разных кадров убирается только запись этого буфера
+    auto [it, end] = contentIndex.equal_range(owner.contentHash);
+    for (; it != end; ++it) {
+        if (it->cacheKey() == owner.pixels.cacheKey()) {
+            contentIndex.erase(it);
+            return;
+        }
+    }
+}
+
+QImage FrameCache::keyFrameForLocked(const Key &key) const
+{
+    // Опорным служит полный кадр предыдущего номера той же последовательности
+    QString prefix;
+    int number = 0;
+    if (!AssetPack::splitAssetName(key.assetName, prefix, number)) {
+        return QImage();
+    }
+    Key neighbour = key;
+    neighbour.assetName = prefix + QString::number(number - 1);
+    auto it = frames.constFind(neighbour);
+    if (it == frames.constEnd()) {
+        return QImage();
+    }
+    return it->keyFrame.isNull() ? it->pixels : it->keyFrame;
+}
+
+void FrameCache::touchLocked(const Key &key, StoredFrame &stored)
+{
+    recency.remove(stored.lastUsed);
+    const bool materialized = materializedRecency.remove(stored.lastUsed) > 0;
+    stored.lastUsed = ++useCounter;
+    recency.insert(stored.lastUsed, key);
+    if (materialized) {
+        materializedRecency.insert(stored.lastUsed, key);
+    }
+}
+
+void FrameCache::linkDependentLocked(const Key &key, qint64 buffer)
+{
+    auto owner = bufferOwners.constFind(buffer);
+    if (owner != bufferOwners.constEnd()) {
+        dependents[owner.value()].append(key);
+    }
+}
+
+bool FrameCache::evictableLocked(const Key &key) const
+{
+    // Владелец уходит вместе с зависимыми кадрами, поэтому закреплённый зависимый держит и его
+    if (pinned.contains(key)) {
+        return false;
+    }
+    const QList<Key> group = dependents.value(key);
+    return std::none_of(group.cbegin(), group.cend(),
+                        [this](const Key &dependent) { return pinned.contains(dependent); });
+}
+
+void FrameCache::evictLocked(const Key &key)
+{
+    auto it = frames.find(key);
+    if (it == frames.end()) {
+        return;
+    }
+    if (it->owner) {
+        for (const Key &dependent : dependents.take(key)) {
+            evictLocked(dependent);
+        }
+        it = frames.find(key);
+    }
+    StoredFrame stored = *it;
+    frames.erase(it);
+    recency.remove(stored.lastUsed);
+    dropMaterializedLocked(stored);
+    counters.residentBytes -= stored.bytes;
+    if (stored.owner) {
+        removeContentLocked(stored);
+        bufferOwners.remove(stored.pixels.cacheKey());
+    } else if (!stored.pixels.isNull()) {
+        const qint64 buffer = stored.keyFrame.isNull() ? stored.pixels.cacheKey() : stored.keyFrame.cacheKey();
+        auto group = dependents.find(bufferOwners.value(buffer));
+        if (group != dependents.end()) {
+            group->removeOne(key);
+        }
+        if (stored.keyFrame.isNull()) {
+            --counters.sharedFrames;
+        } else {
+            --counters.deltaFrames;
+        }
+    }
+    ++counters.evictions;
+}
+
+void FrameCache::trimLocked(qint64 bytes)
+{
+    // Собранные дельты восстанавливаются копированием без растеризации — они уходят первыми
+    for (auto it = materializedRecency.cbegin(); it != materializedRecency.cend()
+                                                 && counters.residentBytes > bytes;) {
+        const Key key = it.value();
+        ++it;
+        if (!pinned.contains(key)) {
+            dropMaterializedLocked(frames[key]);
+        }
+    }
+    // Дальше целые кадры от давно не показанных; пропущенные (закреплённые
+    // и их владельцы) остаются такими же, поэтому после вытеснения поиск
+    // продолжается с того же места, а не с начала
+    auto candidate = recency.cbegin();
+    while (counters.residentBytes > bytes && candidate != recency.cend()) {
+        const quint64 lastUsed = candidate.key();
+        const Key key = candidate.value();
+        if (!evictableLocked(key)) {
+            ++candidate;
+            continue;
+        }
+        evictLocked(key);
+        candidate = recency.lowerBound(lastUsed);
+    }
+    counters.entries = frames.size();
+}
+
+QRect FrameCache::differenceBounds(const QImage &a, const QImage &b)
+{
+    const int width = a.width();
+    const int height = a.height();
+    const size_t rowBytes = size_t(width) * sizeof(QRgb);
+    int top = 0;
+    while (top < height && std::memcmp(a.constScanLine(top), b.constScanLine(top), rowBytes) == 0) {
+        ++top;
+    }
+    if (top == height) {
+        return QRect();
+    }
+    int bottom = height - 1;
+    while (bottom > top && std::memcmp(a.constScanLine(bottom), b.constScanLine(bottom), rowBytes) == 0) {
+        --bottom;
+    }
+    int left = width;
+    int right = -1;
+    for (int y = top; y <= bottom; ++y) {
+        const QRgb *rowA = reinterpret_cast<const QRgb *>(a.constScanLine(y));
+        const QRgb *rowB = reinterpret_cast<const QRgb *>(b.constScanLine(y));
+        for (int x = 0; x < left; ++x) {
+            if (rowA[x] != rowB[x]) {
+                left = x;
+                break;
+            }
+        }
+        for (int x = width - 1; x > right; --x) {
+            if (rowA[x] != rowB[x]) {
+                right = x;
+                break;
+            }
+        }
+    }
+    return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+QImage FrameCache::materialize(const StoredFrame &stored)
+{
+    if (stored.keyFrame.isNull()) {
+        return stored.pixels;
+    }
+    QImage image = stored.keyFrame.copy();
+    image.setDevicePixelRatio(stored.keyFrame.devicePixelRatio());
+    const size_t rowBytes = size_t(stored.pixels.width()) * sizeof(QRgb);
+    for (int y = 0; y < stored.pixels.height(); ++y) {
+        uchar *target = image.scanLine(stored.patchOffset.y() + y) + stored.patchOffset.x() * sizeof(QRgb);
+        std::memcpy(target, stored.pixels.constScanLine(y), rowBytes);
+    }
+    return image;
+}
+
+QImage FrameCache::rasterize(const QString &assetName, const QSize &size, qreal devicePixelRatio) const
+{
+    // Готовый кадр из assets.pack дешевле разбора SVG
+    if (assetPack) {
+        QImage packed = assetPack->frame(assetName, size, devicePixelRatio);
+        if (!packed.isNull()) {
+            return packed;
+        }
+    }
+
+    const DisplayList list = displayListFor(assetName);
+    return list.rasterize(size, devicePixelRatio);
+}
+
+DisplayList FrameCache::displayListFor(const QString &assetName) const
+{
+    {
+        QMutexLocker locker(&mutex);
+        auto it = displayLists.constFind(assetName);
+        if (it != displayLists.constEnd()) {
+            return it.value();
+        }
+    }
+    // Список из пакета, иначе компилируем SVG сами; битый SVG тоже запоминается пустым списком
+    DisplayList list = assetPack ? assetPack->displayList(assetName) : DisplayList();
+    if (list.isNull()) {
+        list = DisplayList::compile(assetsPath + assetName + ".svg");
+    }
+    QMutexLocker locker(&mutex);
+    displayLists.insert(assetName, list);
+    return list;
+}
+
+QDebug operator<<(QDebug debug, const FrameCache::Stats &stats)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace() << "FrameCache(hits=" << stats.hits << ", misses=" << stats.misses
+                    << ", entries=" << stats.entries << ", shared=" << stats.sharedFrames
+                    << ", deltas=" << stats.deltaFrames << ", materialized=" << stats.materializedFrames
+                    << ", residentBytes=" << stats.residentBytes
+                    << ", budgetBytes=" << stats.budgetBytes << ", evictions=" << stats.evictions
+                    << ", trims=" << stats.trims << ')';
+    return debug;
+}
@@ -0,0 +1,134 @@
+#ifndef FRAMECACHE_H
+#define FRAMECACHE_H
+
+#include <QHash>
+#include <QHashFunctions>
+#include <QImage>
+#include <QMap>
+#include <QMutex>
+#include <QPoint>
+#include <QRect>
+#include <QSet>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+#include <QThreadPool>
+#include "displaylist.h"
+
+class QDebug;
+class AssetPack;
+
+// Кэш растеризованных SVG-кадров: каждый кадр рендерится один раз
+// для пары (размер, devicePixelRatio) и дальше отдаётся из памяти.
+// Одинаковые по содержимому кадры хранятся один раз, а кадры, почти
+// совпадающие с предыдущим кадром последовательности, — как заплатка
+// поверх него. SVG разбирается не больше одного раза на кадр: дальше
+// любые размеры строятся из его списка команд (DisplayList).
+// Объём кэша ограничен бюджетом в байтах: сверх него вытесняются давно
+// не показанные кадры, кроме закреплённых (текущей анимации).
+class FrameCache {
+public:
+    struct Stats {
+        quint64 hits = 0;
+        quint64 misses = 0;
+        qint64 residentBytes = 0;
+        int entries = 0;
+        int sharedFrames = 0;
+        int deltaFrames = 0;
+        int materializedFrames = 0;
+        qint64 budgetBytes = 0;
+        quint64 evictions = 0;
+        quint64 trims = 0;
+    };
+
+    // Все кадры основных анимаций в ARGB занимают около 50 МБ
+    static constexpr qint64 DefaultByteBudget = 32 * 1024 * 1024;
+
+    explicit FrameCache(const QString &assetsPath);
+    ~FrameCache();
+
+    void setAssetPack(const AssetPack *pack);
+
+    QImage frame(const QString &assetName, const QSize &size, qreal devicePixelRatio);
+    bool isReady(const QString &assetName, const QSize &size, qreal devicePixelRatio) const;
+    void prefetch(const QStringList &assetNames, const QSize &size, qreal devicePixelRatio);
+    Stats stats() const;
+    void clear();
+
+    void setByteBudget(qint64 bytes);
+    // Закреплённые кадры не вытесняются ни по бюджету, ни при нехватке памяти.
+    // Закрепляется ровно тот размер и DPR, в котором анимация играет сейчас
+    void setPinned(const QStringList &assetNames, const QSize &size, qreal devicePixelRatio);
+    // Вытесняет незакреплённые кадры, пока кэш не уложится в bytes
+    void trim(qint64 bytes);
+
+private:
+    // Дельта хранится, только если заплатка не больше четверти кадра
+    static constexpr int DeltaMaxAreaDivisor = 4;
+
+    struct Key {
+        QString assetName;
+        QSize size;
+        int dprPercent;
+        bool operator==(const Key &other) const {
+            return assetName == other.assetName && size == other.size && dprPercent == other.dprPercent;
+        }
+        friend size_t qHash(const Key &key, size_t seed = 0) {
+            return qHashMulti(seed, key.assetName, key.size.width(), key.size.height(), key.dprPercent);
+        }
+    };
+
+    // Полный кадр либо дельта: заплатка pixels в точке patchOffset поверх keyFrame.
+    // У дельты materialized — уже собранный полный кадр: его отдают при попадании,
+    // а при нехватке бюджета сбрасывают первым, заплатка при этом остаётся.
+    // owner — кадр, чей буфер лежит в contentIndex; bytes — сколько памяти записано на него
+    struct StoredFrame {
+        QImage pixels;
+        QImage keyFrame;
+        QImage materialized;
+        QPoint patchOffset;
+        qint64 bytes = 0;
+        size_t contentHash = 0;
+        bool owner = false;
+        quint64 lastUsed = 0;
+    };
+
+    static Key makeKey(const QString &assetName, const QSize &size, qreal devicePixelRatio);
+    static QRect differenceBounds(const QImage &a, const QImage &b);
+    static QImage materialize(const StoredFrame &stored);
+    QImage rasterize(const QString &assetName, const QSize &size, qreal devicePixelRatio) const;
+    DisplayList displayListFor(const QString &assetName) const;
+    StoredFrame storeLocked(const Key &key, const QImage &image);
+    void keepMaterializedLocked(const Key &key, const StoredFrame &delta, const QImage &image);
+    void dropMaterializedLocked(StoredFrame &stored);
+    void removeContentLocked(const StoredFrame &owner);
+    QImage keyFrameForLocked(const Key &key) const;
+    void touchLocked(const Key &key, StoredFrame &stored);
+    void linkDependentLocked(const Key &key, qint64 buffer);
+    bool evictableLocked(const Key &key) const;
+    void evictLocked(const Key &key);
+    void trimLocked(qint64 bytes);
+
+    QString assetsPath;
+    const AssetPack *assetPack = nullptr;
+    mutable QMutex mutex;
+    QHash<Key, StoredFrame> frames;
+    // Кадры по lastUsed: первым идёт самый давний, вытеснение не перебирает весь кэш
+    QMap<quint64, Key> recency;
+    QMap<quint64, Key> materializedRecency;
+    // Владелец буфера и кадры, которые делят его буфер или строятся поверх него
+    QHash<qint64, Key> bufferOwners;
+    QHash<Key, QList<Key>> dependents;
+    // Разные кадры с одинаковым хэшем лежат рядом, кадр ищется сравнением пикселей
+    QMultiHash<size_t, QImage> contentIndex;
+    mutable QHash<QString, DisplayList> displayLists;
+    QSet<Key> inFlight;
+    QSet<Key> pinned;
+    quint64 useCounter = 0;
+    QThreadPool workers;
+    Stats counters;
+};
+
+QDebug operator<<(QDebug debug, const FrameCache::Stats &stats);
+
+#endif // FRAMECACHE_H
@@ -0,0 +1,339 @@
+#include "idsdatabase.h"
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QtEndian>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const char IndexMagic[8] = {'K', 'R', 'O', 'S', 'H', 'I', 'D', 'X'};
+const quint32 IndexVersion = 1;
+
+// Все поля выровнены естественно, записываются в little-endian
+struct IndexHeader {
+    char magic[8];
+    quint32 version;
+    quint32 vendorCount;
+    quint32 deviceCount;
+    quint32 reserved;
+    qint64 sourceSize;
+    qint64 sourceModified;   // мс от эпохи, UTC
+};
+static_assert(sizeof(IndexHeader) == 40, "IndexHeader layout");
+
+int hexDigit(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Четыре шестнадцатеричные цифры и пробел или табуляция за ними
+bool parseId(const char *begin, const char *end, quint16 &id)
+{
+    if (end - begin < 5 || (begin[4] != ' ' && begin[4] != '\t')) return false;
+    quint32 value = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int digit = hexDigit(begin[i]);
+        if (digit < 0) return false;
+        value = value << 4 | quint32(digit);
+    }
+    id = quint16(value);
+    return true;
+}
+
+}
+
+// Ключ — VenId для производителей и VenId << 16 | DevId для устройств
+struct IdsDatabase::Record {
+    quint32 key;
+    quint32 offset;
+    quint32 length;
+};
+
+IdsDatabase::IdsDatabase() = default;
+
+IdsDatabase::~IdsDatabase()
+{
+    if (indexData) {
+        indexFile.unmap(const_cast<uchar *>(indexData));
+    }
+    if (text) {
+        textFile.unmap(const_cast<uchar *>(text));
+    }
+}
+
+bool IdsDatabase::open(const QString &idsPath)
+{
+    textFile.setFileName(idsPath);
+    if (!textFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    textSize = textFile.size();
+    textModified = QFileInfo(textFile).lastModified().toMSecsSinceEpoch();
+    // Файл остаётся открытым: QFile::close() снимает все отображения
+    text = textSize > 0 ? textFile.map(0, textSize) : nullptr;
+    if (!text) {
+        qDebug() << "Cannot map ids database:" << idsPath;
+        return false;
+    }
+
+    const QStringList candidates = indexPaths(idsPath);
+    for (const QString &indexPath : candidates) {
+        if (mapIndex(indexPath)) {
+            indexCached = true;
+            return true;
+        }
+    }
+
+    indexBuffer = buildIndex();
+    for (const QString &indexPath : candidates) {
+        QDir().mkpath(QFileInfo(indexPath).absolutePath());
+        QSaveFile out(indexPath);
+        if (out.open(QIODevice::WriteOnly) && out.write(indexBuffer) == indexBuffer.size() && out.commit()
+            && mapIndex(indexPath)) {
+            indexBuffer.clear();
+            return true;
+        }
+    }
+    qDebug() << "Cannot save ids index, keeping it in memory:" << idsPath;
+    return useIndex(reinterpret_cast<const uchar *>(indexBuffer.constData()), indexBuffer.size());
+}
+
+bool IdsDatabase::isOpen() const
+{
+    return vendors != nullptr;
+}
+
+QString IdsDatabase::path() const
+{
+    return textFile.fileName();
+}
+
+bool IdsDatabase::isIndexCached() const
+{
+    return indexCached;
+}
+
+int IdsDatabase::vendorCount() const
+{
+    return int(vendorTotal);
+}
+
+int IdsDatabase::deviceCount() const
+{
+    return int(deviceTotal);
+}
+
+QStringList IdsDatabase::indexPaths(const QString &idsPath)
+{
+    // Рядом с файлом, если каталог доступен на запись, иначе в кэше под хэшем пути
+    const QFileInfo info(idsPath);
+    const QByteArray pathHash = QCryptographicHash::hash(info.absoluteFilePath().toUtf8(), QCryptographicHash::Sha1)
+                                    .toHex().left(16);
+    QStringList paths{info.absoluteFilePath() + ".idx"};
+    const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (!cacheDir.isEmpty()) {
+        paths << cacheDir + "/ids/" + info.fileName() + '-' + QString::fromLatin1(pathHash) + ".idx";
+    }
+    return paths;
+}
+
+bool IdsDatabase::mapIndex(const QString &indexPath)
+{
+    if (indexData) {
+        indexFile.unmap(const_cast<uchar *>(indexData));
+        indexData = nullptr;
+    }
+    indexFile.close();
+    indexFile.setFileName(indexPath);
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    const qint64 size = indexFile.size();
+    indexData = size > 0 ? indexFile.map(0, size) : nullptr;
+    if (indexData && useIndex(indexData, size)) {
+        return true;
+    }
+    if (indexData) {
+        indexFile.unmap(const_cast<uchar *>(indexData));
+        indexData = nullptr;
+    }
+    indexFile.close();
+    return false;
+}
+
+bool IdsDatabase::useIndex(const uchar *index, qint64 size)
+{
+    if (size < qint64(sizeof(IndexHeader))) {
+        return false;
+    }
+    IndexHeader header;
+    std::memcpy(&header, index, sizeof(header));
+    if (std::memcmp(header.magic, IndexMagic, sizeof(IndexMagic)) != 0
+        || qFromLittleEndian(header.version) != IndexVersion
+        || qFromLittleEndian(header.sourceSize) != textSize
+        || qFromLittleEndian(header.sourceModified) != textModified) {
+        return false;
+    }
+    const quint32 vendorCount = qFromLittleEndian(header.vendorCount);
+    const quint32 deviceCount = qFromLittleEndian(header.deviceCount);
+    if (size != qint64(sizeof(IndexHeader)) + qint64(vendorCount + deviceCount) * qint64(sizeof(Record))) {
+        return false;
+    }
+    // Записи лежат сразу за заголовком: отображение выровнено по странице, заголовок — по 8 байт
+    const Record *records = reinterpret_cast<const Record *>(index + sizeof(IndexHeader));
+    for (quint32 i = 0; i < vendorCount + deviceCount; ++i) {
+        if (quint64(qFromLittleEndian(records[i].offset)) + qFromLittleEndian(records[i].length) > quint64(textSize)) {
+            return false;
+        }
+    }
+    vendors = records;
+    devices = records + vendorCount;
+    vendorTotal = vendorCount;
+    deviceTotal = deviceCount;
+    return true;
+}
+
+QByteArray IdsDatabase::buildIndex() const
+{
+    // Строки производителя начинаются с ID, устройства — с одной табуляции,
+    // подсистемы (две табуляции) пропускаются. Любая другая строка верхнего
+    // уровня (классы "C", разделы usb.ids вроде "AT" или "HID") закрывает производителя.
+    std::vector<Record> vendorRecords;
+    std::vector<Record> deviceRecords;
+    const char *const begin = reinterpret_cast<const char *>(text);
+    const char *const end = begin + textSize;
+    bool inVendor = false;
+    quint16 vendor = 0;
+    for (const char *line = begin; line < end;) {
+        const char *newline = static_cast<const char *>(std::memchr(line, '\n', size_t(end - line)));
+        const char *lineEnd = newline ? newline : end;
+        const char *next = newline ? newline + 1 : end;
+        while (lineEnd > line && (lineEnd[-1] == '\r' || lineEnd[-1] == ' ' || lineEnd[-1] == '\t')) {
+            --lineEnd;
+        }
+
+        const bool device = line < lineEnd && line[0] == '\t';
+        const char *idBegin = device ? line + 1 : line;
+        quint16 id = 0;
+        if (line == lineEnd || line[0] == '#' || (device && (!inVendor || idBegin[0] == '\t'))) {
+            // пустая строка, комментарий, подсистема или устройство вне производителя
+        } else if (parseId(idBegin, lineEnd, id)) {
+            const char *name = idBegin + 4;
+            while (name < lineEnd && (*name == ' ' || *name == '\t')) ++name;
+            const Record record{device ? quint32(vendor) << 16 | id : id, quint32(name - begin),
+                                quint32(lineEnd - name)};
+            if (device) {
+                deviceRecords.push_back(record);
+            } else {
+                vendorRecords.push_back(record);
+                vendor = id;
+                inVendor = true;
+            }
+        } else if (!device) {
+            inVendor = false;
+        }
+        line = next;
+    }
+
+    // При повторе ID остаётся первая запись, как у lspci
+    for (std::vector<Record> *records : {&vendorRecords, &deviceRecords}) {
+        std::stable_sort(records->begin(), records->end(),
+                         [](const Record &a, const Record &b) { return a.key < b.key; });
+        records->erase(std::unique(records->begin(), records->end(),
+                                   [](const Record &a, const Record &b) { return a.key == b.key; }),
+                       records->end());
+    }
+
+    IndexHeader header = {};
+    std::memcpy(header.magic, IndexMagic, sizeof(IndexMagic));
+    header.version = qToLittleEndian(IndexVersion);
+    header.vendorCount = qToLittleEndian(quint32(vendorRecords.size()));
+    header.deviceCount = qToLittleEndian(quint32(deviceRecords.size()));
+    header.sourceSize = qToLittleEndian(textSize);
+    header.sourceModified = qToLittleEndian(textModified);
+
+    QByteArray index;
+    index.reserve(qsizetype(sizeof(header) + (vendorRecords.size() + deviceRecords.size()) * sizeof(Record)));
+    index.append(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const std::vector<Record> *records : {&vendorRecords, &deviceRecords}) {
+        for (Record record : *records) {
+            record.key = qToLittleEndian(record.key);
+            record.offset = qToLittleEndian(record.offset);
+            record.length = qToLittleEndian(record.length);
+            index.append(reinterpret_cast<const char *>(&record), sizeof(record));
+        }
+    }
+    return index;
+}
+
+// Двоичный поиск без ветвлений, как в PciDatabase
+const IdsDatabase::Record *IdsDatabase::find(const Record *records, quint32 count, quint32 key)
+{
+    if (count == 0) return nullptr;
+    const Record *base = records;
+    quint32 length = count;
+    while (length > 1) {
+        const quint32 half = length / 2;
+        base += qFromLittleEndian(base[half].key) <= key ? half : 0;
+        length -= half;
+    }
+    return qFromLittleEndian(base->key) == key ? base : nullptr;
+}
+
+QString IdsDatabase::name(const Record *record) const
+{
+    if (!record) return QString();
+    return QString::fromUtf8(reinterpret_cast<const char *>(text) + qFromLittleEndian(record->offset),
+                             qFromLittleEndian(record->length));
+}
+
+QString IdsDatabase::vendorName(quint16 vendorId) const
+{
+    return name(find(vendors, vendorTotal, vendorId));
+}
+
+QString IdsDatabase::deviceName(quint16 vendorId, quint16 deviceId) const
+{
+    return name(find(devices, deviceTotal, quint32(vendorId) << 16 | deviceId));
+}
+
+IdsDatabase *IdsDatabase::openFirst(const QStringList &candidates)
+{
+    for (const QString &candidate : candidates) {
+        if (!QFileInfo::exists(candidate)) continue;
+        IdsDatabase *database = new IdsDatabase;
+        if (database->open(candidate)) {
+            qDebug() << "ids database:" << candidate << database->vendorCount() << "vendors,"
+                     << database->deviceCount() << "devices" << (database->isIndexCached() ? "(cached index)" : "");
+            return database;
+        }
+        delete database;
+    }
+    // Пустая база: поиск в ней ничего не находит, вызывающий берёт встроенные таблицы
+    return new IdsDatabase;
+}
+
+const IdsDatabase &IdsDatabase::pci()
+{
+    // Файл рядом с программой важнее системного: так его можно обновить без прав администратора
+    static const IdsDatabase *database = openFirst({
+        QCoreApplication::applicationDirPath() + "/pci.ids",
+#if defined(Q_OS_UNIX)
+        "/usr/share/hwdata/pci.ids",
+        "/usr/share/misc/pci.ids",
+        "/usr/share/pci.ids",
+        "/var/lib/pciutils/pci.ids",
+#endif
+    });
+    return *database;
+}
@@ -0,0 +1,63 @@
+#ifndef IDSDATABASE_H
+#define IDSDATABASE_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <QStringList>
+
+// Системная база pci.ids (формат pciutils; usb.ids устроен так же).
+// Текст отображается в память и в куче не копируется. При первом
+// открытии строится отсортированный индекс «ID -> смещение названия»,
+// который сохраняется рядом с файлом (или в кэше пользователя, если
+// каталог только для чтения) и при следующих запусках тоже отображается
+// в память. Индекс привязан к размеру и времени изменения исходного
+// файла. QString с названием собирается только в момент запроса.
+class IdsDatabase {
+public:
+    IdsDatabase();
+    ~IdsDatabase();
+
+    bool open(const QString &idsPath);
+    bool isOpen() const;
+    QString path() const;
+    // true, если индекс взят с диска, а не построен заново
+    bool isIndexCached() const;
+    int vendorCount() const;
+    int deviceCount() const;
+
+    // Пустая строка, если ID в базе нет
+    QString vendorName(quint16 vendorId) const;
+    QString deviceName(quint16 vendorId, quint16 deviceId) const;
+
+    // Первый найденный pci.ids из стандартных мест; открывается один раз за процесс
+    static const IdsDatabase &pci();
+
+private:
+    struct Record;
+
+    static IdsDatabase *openFirst(const QStringList &candidates);
+    static QStringList indexPaths(const QString &idsPath);
+    static const Record *find(const Record *records, quint32 count, quint32 key);
+    QByteArray buildIndex() const;
+    bool useIndex(const uchar *index, qint64 size);
+    bool mapIndex(const QString &indexPath);
+    QString name(const Record *record) const;
+
+    QFile textFile;
+    const uchar *text = nullptr;
+    qint64 textSize = 0;
+    qint64 textModified = 0;
+
+    QFile indexFile;
+    const uchar *indexData = nullptr;
+    QByteArray indexBuffer;   // индекс в памяти, если сохранить его не удалось
+    bool indexCached = false;
+
+    const Record *vendors = nullptr;
+    const Record *devices = nullptr;
+    quint32 vendorTotal = 0;
+    quint32 deviceTotal = 0;
+};
+
+#endif // IDSDATABASE_H
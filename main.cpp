@@ -1,23 +1,45 @@
 #include <QApplication>
-#include <QPixmap>
-#include <QTransform>
 #include <QIcon>
 #include <QDir>
+#include <QElapsedTimer>
 #include "mainwindow.h"
+#include "theme.h"
+#ifdef SYSTEMANALYSER_BENCHMARK
+#include "benchmarkstats.h"
+#include "pcibenchmark.h"
+#include "renderbenchmark.h"
+#include <QTextStream>
+#endif
 
 int main(int argc, char *argv[])
 {
-    QApplication a(argc, argv);
+    QElapsedTimer startupClock;
+    startupClock.start();
 
-    QString sourceFilePath = __FILE__;
-    QDir sourceDir(sourceFilePath);
+#ifdef SYSTEMANALYSER_BENCHMARK
+    // Замеры отрисовки и панели PCI: SystemAnalyser --benchmark <каталог assets> [число проходов]
+    if ((argc == 3 || argc == 4) && qstrcmp(argv[1], "--benchmark") == 0) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+        QApplication a(argc, argv);
+        QString assetsDir = QDir(QString::fromLocal8Bit(argv[2])).absolutePath() + "/";
+        int rounds = argc == 4 ? QByteArray(argv[3]).toInt() : 10;
+        QTextStream out(stdout);
+        BenchmarkStats::installAllocationHook();
+        RenderBenchmark render(assetsDir, out, rounds);
+        render.run();
+        PciBenchmark pci(out, rounds);
+        pci.run();
+        out << "peak RSS: " << BenchmarkStats::peakResidentBytes() / 1024 << " KiB" << Qt::endl;
+        return 0;
+    }
+#endif
 
-    QPixmap pixmap(sourceDir.absoluteFilePath("../assets/") + "/icon.svg");
-    QTransform transform;
-    QPixmap rotatedPixmap = pixmap.transformed(transform, Qt::SmoothTransformation);
+    QApplication a(argc, argv);
+    Theme::install();
 
     MainWindow w;
-    w.setWindowIcon(QIcon(rotatedPixmap));
+    w.setStartupClock(startupClock);
+    w.setWindowIcon(QIcon(":/assets/icon.svg"));
     w.show();
 
     return a.exec();
@@ -18,6 +18,12 @@
 #include <QTableWidget>
 #include <QHeaderView>
 #include <QFontMetrics>
+#include <QElapsedTimer>
+#include <QMap>
+#include <QRegularExpression>
+#include <QtConcurrent>
+#include "animationcatalog.h"
+#include "pcidb.h"
 #include <windows.h> // <-- Добавить
 #include <Dbt.h>
 // mainwindow.cpp
@@ -26,60 +32,84 @@ bool MainWindow::nativeEvent(const QByteArray &eventType, void *message, qintptr
     MSG* msg = static_cast<MSG*>(message);
     if (msg->message == WM_DEVICECHANGE) {
         UsbMonitor::getInstance()->handleDeviceChange(msg->message, msg->wParam);
+        // Без адреса устройства: какая функция PCI изменилась, покажет только обход
+        if (msg->wParam == DBT_DEVNODES_CHANGED && pciHotplug) {
+            pciHotplug->requestRescan();
+        }
     }
     return false;
 }
-QString getProjectAssetsPath() {
-    QString sourceFilePath = __FILE__;
-    QDir sourceDir(sourceFilePath);
-    return sourceDir.absoluteFilePath("../assets/") + "/";
+// Картинки вкомпилированы в бинарник (RESOURCES в app.pro): он не зависит от дерева исходников
+static const QString &assetsPath() {
+    static const QString path = QStringLiteral(":/assets/");
+    return path;
 }
-static const QString ASSETS_PATH = getProjectAssetsPath();
-BatteryWidget::BatteryWidget(QWidget *parent) : QLabel(parent), batteryLevel(0) {
+BatteryWidget::BatteryWidget(QWidget *parent) : QLabel(parent),
+    levelFont("Arial", 20, QFont::Bold), batteryLevel(0) {
     setFixedSize(350, 150);
-    renderer = new QSvgRenderer(this);
+    levelText.setTextFormat(Qt::PlainText);
+    levelText.setPerformanceHint(QStaticText::AggressiveCaching);
+    levelText.setText("0%");
+    levelText.prepare(QTransform(), levelFont);
 }
 void BatteryWidget::setBatteryLevel(int level) {
-    batteryLevel = qBound(0, level, 100);
+    int newLevel = qBound(0, level, 100);
+    if (newLevel == batteryLevel) return;
+    batteryLevel = newLevel;
+    // Раскладка глифов готовится один раз на каждое новое значение, а не на каждую перерисовку
+    levelText.setText(QString::number(batteryLevel) + "%");
+    levelText.prepare(QTransform(), levelFont);
     update();
 }
+void BatteryWidget::ensureAtlas() {
+    // Все десять состояний батареи растеризуются один раз в одну полосу
+    const qreal dpr = devicePixelRatioF();
+    if (!atlas.isNull() && qFuzzyCompare(atlas.devicePixelRatio(), dpr)) return;
+    atlas = QPixmap(QSize(width(), height() * AtlasStates) * dpr);
+    atlas.setDevicePixelRatio(dpr);
+    atlas.fill(Qt::transparent);
+    QPainter painter(&atlas);
+    painter.setRenderHint(QPainter::Antialiasing);
+    // SVG разбираются только при первой сборке, смена DPR лишь воспроизводит списки команд
+    if (stateLists.isEmpty()) {
+        for (int state = 1; state <= AtlasStates; ++state) {
+            stateLists.append(DisplayList::compile(assetsPath() + "battery" + QString::number(state) + ".svg"));
+        }
+    }
+    for (int state = 1; state <= AtlasStates; ++state) {
+        stateLists.at(state - 1).replay(&painter, QRectF(0, (state - 1) * height(), width(), height()));
+    }
+}
 void BatteryWidget::paintEvent(QPaintEvent *event) {
+    ensureAtlas();
     QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing);
     int imageIndex = (100 - batteryLevel) / 10 + 1;
     if (imageIndex < 1) imageIndex = 1;
-    if (imageIndex > 10) imageIndex = 10;
-    QString svgPath = ASSETS_PATH + "battery" + QString::number(imageIndex) + ".svg";
-    if (!QFile::exists(svgPath)) {
-        qDebug() << "Battery SVG file not found:" << svgPath;
-        return;
-    }
-    if (!renderer->load(svgPath)) {
-        qDebug() << "Failed to load battery SVG:" << svgPath;
-        return;
-    }
-    QRect targetRect(0, 0, width(), height());
-    renderer->render(&painter, targetRect);
+    if (imageIndex > AtlasStates) imageIndex = AtlasStates;
+    const qreal dpr = atlas.devicePixelRatio();
+    QRectF sourceRect(0, (imageIndex - 1) * height() * dpr, width() * dpr, height() * dpr);
+    painter.drawPixmap(QRectF(rect()), atlas, sourceRect);
     painter.setPen(Qt::black);
-    painter.setFont(QFont("Arial", 20, QFont::Bold));
-    QString levelText = QString::number(batteryLevel) + "%";
-    QRect textRect = rect().adjusted(10, 10, -10, -10);
-    painter.drawText(textRect, Qt::AlignCenter, levelText);
+    painter.setFont(levelFont);
+    QSizeF textSize = levelText.size();
+    painter.drawStaticText(QPointF((width() - textSize.width()) / 2.0, (height() - textSize.height()) / 2.0), levelText);
 }
-MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), currentFrame(0), isEatAnimationInfinite(false),
+MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), isEatAnimationInfinite(false),
     lab1Activated(false), currentAnimationType(None), isHiddenMode(false), isCameraOn(false), wasCameraOn(false) {
+    QElapsedTimer constructionTimer;
+    constructionTimer.start();
+    startupClock = constructionTimer;
     setFixedSize(1245, 720);
     QWidget *central = new QWidget(this);
     QVBoxLayout *layout = new QVBoxLayout(central);
     layout->setContentsMargins(0, 0, 0, 0);
     layout->setSpacing(0);
     isCameraOn = false;
-    animationLabel = new QLabel(this);
+    animationLabel = new SceneWidget(this);
     animationLabel->setFixedSize(1245, 720);
-    animationLabel->setAlignment(Qt::AlignCenter);
     layout->addWidget(animationLabel);
     setCentralWidget(central);
-    QString carrotPath = ASSETS_PATH + "carrot.svg";
+    QString carrotPath = assetsPath() + "carrot.svg";
     QSvgRenderer renderer(carrotPath);
     QPixmap carrotPixmap(64, 64);
     carrotPixmap.fill(Qt::transparent);
@@ -100,21 +130,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), currentFrame(0),
         QPushButton *btn = new QPushButton(labNames[i], animationLabel);
         btn->setFixedSize(160, 40);
         btn->move(startX + i * (160 + spacing), startY);
-        btn->setStyleSheet(R"(
-            QPushButton {
-                background-color: rgba(74, 144, 226, 220);
-                color: white;
-                border-radius: 8px;
-                font-size: 15px;
-                font-weight: bold;
-            }
-            QPushButton:hover {
-                background-color: rgba(53, 122, 189, 220);
-            }
-            QPushButton:pressed {
-                background-color: rgba(44, 90, 160, 240);
-            }
-        )");
+        Theme::applyButton(btn, 15);
         labButtons.append(btn);
         if (i == 0) lab1Button = btn;
         if (i == 1) lab2Button = btn;
@@ -125,37 +141,73 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), currentFrame(0),
     connect(lab2Button, &QPushButton::clicked, this, &MainWindow::showPCIInfo);
     connect(lab4Button, &QPushButton::clicked, this, &MainWindow::showWebcamPanel);
     connect(lab5Button, &QPushButton::clicked, this, &MainWindow::showUsbInfo);
+    frameCache = new FrameCache(assetsPath());
+    assetPack = new AssetPack();
+    if (assetPack->open(QCoreApplication::applicationDirPath() + "/assets.pack")) {
+        frameCache->setAssetPack(assetPack);
+    } else {
+        qDebug() << "Asset pack not found, frames will be rasterized from SVG";
+    }
+    // При нехватке памяти в системе оставляем только кадры текущей анимации
+    memoryPressure = new MemoryPressureMonitor(this);
+    connect(memoryPressure, &MemoryPressureMonitor::memoryPressure, this, [this]() {
+        frameCache->trim(0);
+        // Закреплены кадры под DPR на момент старта анимации; если окно с тех пор
+        // ушло на другой экран, её кадры вытеснены — растеризуем их заранее снова
+        if (timeline->isActive()) {
+            frameCache->prefetch(frameNames, spriteSize(currentAnimationType), devicePixelRatioF());
+        }
+        qDebug() << "Memory pressure, frame cache trimmed:" << frameCache->stats();
+    });
+    QImage backgroundImage(assetsPath() + "krosh_house.jpg");
+    if (backgroundImage.isNull()) {
+        qDebug() << "Background image not found:" << assetsPath() + "krosh_house.jpg";
+    }
+    animationLabel->setBackgroundImage(backgroundImage);
     drawBackground();
-    frameTimer = new QTimer(this);
-    connect(frameTimer, &QTimer::timeout, this, &MainWindow::updateFrame);
-    resetTimer = new QTimer(this);
+    scheduler = new TimerScheduler(this);
+    timeline = new AnimationTimeline(this);
+    // Пока окно не видно, анимация стоит и после показа продолжается с того же кадра
+    connect(scheduler, &TimerScheduler::cosmeticPausedChanged, timeline, &AnimationTimeline::setPaused);
+    connect(timeline, &AnimationTimeline::frameChanged, this, &MainWindow::updateFrame);
+    connect(timeline, &AnimationTimeline::finished, this, &MainWindow::onAnimationFinished);
+    // При отставании кадры пропускаются, чтобы длительность анимаций совпадала с таймерами singleShot
+    timeline->setFrameDropping(true);
+    connect(animationLabel, &SceneWidget::spritePresented, timeline, &AnimationTimeline::framePresented);
+    QShortcut *pacingShortcut = new QShortcut(QKeySequence(Qt::Key_F12), this);
+    connect(pacingShortcut, &QShortcut::activated, this, [this]() {
+        animationLabel->setOverlayVisible(!animationLabel->isOverlayVisible());
+        updatePacingOverlay();
+    });
+    timeline->setFrameGate([this](int frameIndex) {
+        // Кадры растеризует пул потоков; пока первые PrefetchLead кадров
+        // (или очередной кадр) не готовы, держим текущую картинку
+        const QSize kroshSize = spriteSize(currentAnimationType);
+        const qreal dpr = devicePixelRatioF();
+        const int lead = frameIndex == 0 ? qMin(PrefetchLead, frameNames.size()) : 1;
+        for (int i = frameIndex; i < frameIndex + lead; ++i) {
+            if (!frameCache->isReady(frameNames[i], kroshSize, dpr)) return false;
+        }
+        return true;
+    });
+    resetTimer = new ScheduledTimer(scheduler, TimerScheduler::Cosmetic, this);
     resetTimer->setSingleShot(true);
-    connect(resetTimer, &QTimer::timeout, this, [this]() { drawBackground(); });
-    blinkTimer = new QTimer(this);
-    connect(blinkTimer, &QTimer::timeout, this, &MainWindow::triggerBlinkAnimation);
+    connect(resetTimer, &ScheduledTimer::timeout, this, [this]() { drawBackground(); });
+    blinkTimer = new ScheduledTimer(scheduler, TimerScheduler::Cosmetic, this);
+    connect(blinkTimer, &ScheduledTimer::timeout, this, &MainWindow::triggerBlinkAnimation);
     blinkTimer->start(5000);
-    QTimer *welcomeTimer = new QTimer(this);
+    ScheduledTimer *welcomeTimer = new ScheduledTimer(scheduler, TimerScheduler::Cosmetic, this);
     welcomeTimer->setSingleShot(true);
-    connect(welcomeTimer, &QTimer::timeout, this, &MainWindow::startWelcomeAnimation);
+    connect(welcomeTimer, &ScheduledTimer::timeout, this, &MainWindow::startWelcomeAnimation);
     welcomeTimer->start(2000);
-    powerMonitor = new PowerMonitor(this);
-    pciMonitor = new envirconfigPCI();
-    webcam = new webcamera(this);
-    setupPowerInfoPanel();
-    setupPCIInfoPanel();
-    setupWebcamPanel();
-    setupUsbInfoPanel();
+    // Панели лабораторных и их мониторы создаются при первом открытии (ensure*Panel)
     UsbMonitor* monitor = UsbMonitor::getInstance();
     // 2. Получаем HWND
     HWND hWnd = (HWND)winId();
+    scheduler->watchWindow(this);
     // 3. Регистрируем уведомления
     // Ошибка: 'registerForDeviceNotifications'
     monitor->registerNotifications(hWnd);
-    lastKnownDevices = monitor->getUsbDevices();
-    // 5. Первоначальное заполнение таблицы
-    // Ошибка: 'no matching function for call to updateUsbTable()'
-    // Исправлено: Вызываем с параметром, который она ожидает.
-    updateUsbTable(monitor->getUsbDevices());
     connect(UsbMonitor::getInstance(), &UsbMonitor::devicesChanged,
             this, &MainWindow::onDevicesChanged);
     connect(UsbMonitor::getInstance(), &UsbMonitor::deviceAdded, this, [this]() {
@@ -167,24 +219,55 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), currentFrame(0),
     });
 
 
-    connect(pciTable->horizontalHeader(), &QHeaderView::sectionResized, this, [=](int logicalIndex, int newSize) {
-        if (logicalIndex == 3) {
-            QFontMetrics metrics(pciTable->font());
-            for (int row = 0; row < pciTable->rowCount(); ++row) {
-                QTableWidgetItem* item = pciTable->item(row, 3);
-                if (!item) continue;
-                QString fullText = item->data(Qt::UserRole).toString();
-                QString elided = metrics.elidedText(fullText, Qt::ElideRight, newSize - 10);
-                item->setText(elided);
-            }
-        }
+    // Снимки в режиме слежки делаются как раз при скрытом окне, поэтому задача обязательная
+    surveillanceTimer = new ScheduledTimer(scheduler, TimerScheduler::Essential, this);
+    connect(surveillanceTimer, &ScheduledTimer::timeout, this, [this]() {
+        QString dirPath = QDir::currentPath() + "/surveillance/";
+        QDir().mkpath(dirPath);
+        QString filePath = dirPath + QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss") + ".jpg";
+        webcam->capturePhoto(filePath);
+    });
+    trayIcon = new QSystemTrayIcon(this);
+    trayIcon->setIcon(QIcon(assetsPath() + "icon.svg"));
+    QMenu *trayMenu = new QMenu(this);
+    QAction *showAction = trayMenu->addAction("Показать");
+    connect(showAction, &QAction::triggered, this, &MainWindow::stopHiddenSurveillance);
+    QAction *quitAction = trayMenu->addAction("Выход");
+    connect(quitAction, &QAction::triggered, qApp, &QCoreApplication::quit);
+    trayIcon->setContextMenu(trayMenu);
+    startup.constructionMs = constructionTimer.elapsed();
+    connect(animationLabel, &SceneWidget::firstFramePainted, this, [this]() {
+        startup.firstFrameMs = startupClock.elapsed();
+        qDebug() << startup;
+        emit startupMeasured(startup);
     });
+}
+
+void MainWindow::setStartupClock(const QElapsedTimer &clock) {
+    startupClock = clock;
+}
+
+MainWindow::StartupStats MainWindow::startupStats() const {
+    return startup;
+}
+
+QDebug operator<<(QDebug debug, const MainWindow::StartupStats &stats) {
+    QDebugStateSaver saver(debug);
+    debug.nospace() << "Startup(constructionMs=" << stats.constructionMs
+                    << ", firstFrameMs=" << stats.firstFrameMs << ')';
+    return debug;
+}
+
+void MainWindow::ensurePowerInfoPanel() {
+    if (powerInfoPanel) return;
+    powerMonitor = new PowerMonitor(scheduler, this);
+    setupPowerInfoPanel();
     connect(powerMonitor, &PowerMonitor::powerSourceChanged, this, [this](const QString &type) {
         updatePowerInfo(type, powerMonitor->getBatteryType(), powerMonitor->getBatteryLevel(),
                         powerMonitor->isPowerSavingEnabled(), powerMonitor->getDischargeDuration(),
                         powerMonitor->getRemainingBatteryTime());
         if (lab1Activated) {
-            frameTimer->stop();
+            timeline->stop();
             resetTimer->stop();
             if (type == "Сеть") {
                 isEatAnimationInfinite = true;
@@ -222,112 +305,72 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), currentFrame(0),
     });
     connect(powerMonitor, &PowerMonitor::powerModeChanged, this, &MainWindow::updatePowerMode);
     powerMonitor->startMonitoring();
-    surveillanceTimer = new QTimer(this);
-    connect(surveillanceTimer, &QTimer::timeout, this, [this]() {
-        QString dirPath = QDir::currentPath() + "/surveillance/";
-        QDir().mkpath(dirPath);
-        QString filePath = dirPath + QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss") + ".jpg";
-        webcam->capturePhoto(filePath);
+}
+
+void MainWindow::ensurePCIInfoPanel() {
+    if (pciInfoPanel) return;
+    pciMonitor = new envirconfigPCI();
+    setupPCIInfoPanel();
+    pciWatcher = new QFutureWatcher<PCIDevice>(this);
+    connect(pciWatcher, &QFutureWatcher<PCIDevice>::resultsReadyAt, this, &MainWindow::appendPCIRows);
+    connect(pciWatcher, &QFutureWatcher<PCIDevice>::progressValueChanged, this, &MainWindow::updatePCIProgress);
+    connect(pciWatcher, &QFutureWatcher<PCIDevice>::finished, this, &MainWindow::finishPCIEnumeration);
+    // После первого обхода таблица обновляется по событиям hotplug, а не перестраивается
+    pciHotplug = new PciHotplugMonitor(this);
+    connect(pciHotplug, &PciHotplugMonitor::devicesChanged, this, [this](const QStringList &bdfs) {
+        // До первого снимка отличия не посчитать: обход идёт сейчас и мог уже пройти мимо этих функций
+        if (pciMonitor->hasSnapshot()) applyPCIDelta(pciMonitor->refresh(bdfs));
+        else pciRescanPending = true;
     });
-    trayIcon = new QSystemTrayIcon(this);
-    trayIcon->setIcon(QIcon(ASSETS_PATH + "icon.png"));
-    QMenu *trayMenu = new QMenu(this);
-    QAction *showAction = trayMenu->addAction("Показать");
-    connect(showAction, &QAction::triggered, this, &MainWindow::stopHiddenSurveillance);
-    QAction *quitAction = trayMenu->addAction("Выход");
-    connect(quitAction, &QAction::triggered, qApp, &QCoreApplication::quit);
-    trayIcon->setContextMenu(trayMenu);
+    connect(pciHotplug, &PciHotplugMonitor::rescanNeeded, this, [this]() {
+        // За скрытой панелью и во время первого обхода новый обход откладывается
+        if (pciMonitor->hasSnapshot() && pciInfoPanel->isVisible()) startPCIEnumeration();
+        else pciRescanPending = true;
+    });
+}
 
+void MainWindow::ensureWebcamPanel() {
+    if (webcamPanel) return;
+    webcam = new webcamera(this);
+    setupWebcamPanel();
+}
+
+void MainWindow::ensureUsbInfoPanel() {
+    if (usbInfoPanel) return;
+    setupUsbInfoPanel();
+    // Одно перечисление на открытие панели: и для таблицы, и для lastKnownDevices
+    const QList<UsbDevice> devices = UsbMonitor::getInstance()->getUsbDevices();
+    lastKnownDevices = devices;
+    updateUsbTable(devices);
+}
+MainWindow::~MainWindow() {
+    if (pciWatcher) {
+        pciWatcher->cancel();
+        pciWatcher->waitForFinished();
+    }
+    qDebug() << frameCache->stats();
+    qDebug() << scheduler->stats() << "animation wakeups:" << timeline->wakeups();
+    qDebug() << timeline->pacingStats();
+    delete frameCache;
+    delete assetPack;
 }
-MainWindow::~MainWindow() {}
 
 void MainWindow::setupUsbInfoPanel() {
-    usbInfoPanel = new QWidget(animationLabel);
+    usbInfoPanel = new ThemePanel(ThemePanel::UsbPanel, animationLabel);
     usbInfoPanel->setFixedSize(640, 600); // немного шире
     usbInfoPanel->move(570, 35); // сдвинули правее
-    usbInfoPanel->setStyleSheet(R"(
-        QWidget {
-            background: qlineargradient(x1:0, y1:0, x2:1, y2:1,
-                stop:0 rgba(255, 255, 255, 250),
-                stop:1 rgba(240, 245, 255, 230));
-            border-radius: 15px;
-        }
-    )");
     QVBoxLayout *panelLayout = new QVBoxLayout(usbInfoPanel);
     panelLayout->setContentsMargins(20, 20, 20, 20);
     panelLayout->setSpacing(15);
     QLabel *titleLabel = new QLabel("Подключенные USB устройства", usbInfoPanel);
     titleLabel->setFont(QFont("Arial", 20, QFont::Bold));
     titleLabel->setAlignment(Qt::AlignCenter);
-    titleLabel->setStyleSheet(R"(
-        background: transparent;
-        color: #2C5AA0;
-        padding: 8px;
-    )");
+    Theme::applyTitle(titleLabel, 8);
     usbTable = new QTableWidget(usbInfoPanel);
     usbTable->setRowCount(0);
     usbTable->setColumnCount(3);
     usbTable->setHorizontalHeaderLabels({"Тип устройства", "Название", "Диск"});
-    usbTable->setStyleSheet(R"(
-        QTableWidget {
-            background: rgba(255, 255, 255, 240);
-            font-family: 'Segoe UI', Arial;
-            font-size: 14px;
-            color: #333333;
-            border: 1px solid rgba(74, 144, 226, 100);
-            border-radius: 12px;
-            gridline-color: rgba(74, 144, 226, 40);
-            alternate-background-color: rgba(248, 250, 255, 200);
-        }
-        QHeaderView::section {
-            background: qlineargradient(x1:0, y1:0, x2:0, y2:1,
-                stop:0 rgba(74, 144, 226, 240),
-                stop:1 rgba(53, 122, 189, 220));
-            color: white;
-            font-weight: bold;
-            font-size: 15px;
-            padding: 12px 8px;
-            border: none;
-        }
-        QHeaderView::section:hover {
-            background: qlineargradient(x1:0, y1:0, x2:0, y2:1,
-                stop:0 rgba(53, 122, 189, 255),
-                stop:1 rgba(44, 90, 160, 240));
-        }
-        QTableWidget::item {
-            padding: 12px 8px;
-            border-bottom: 1px solid rgba(74, 144, 226, 30);
-            border-left: 1px solid rgba(74, 144, 226, 20);
-        }
-        QTableWidget::item:hover {
-            background: qlineargradient(x1:0, y1:0, x2:1, y2:0,
-                stop:0 rgba(74, 144, 226, 15),
-                stop:1 rgba(74, 144, 226, 5));
-            color: #2C5AA0;
-        }
-        QTableWidget::item:selected {
-            background: rgba(74, 144, 226, 100);
-            color: white;
-        }
-        QTableCornerButton::section {
-            background: rgba(74, 144, 226, 200);
-            border: none;
-            border-top-left-radius: 12px;
-        }
-        QScrollBar:vertical {
-            background: rgba(240, 245, 255, 200);
-            width: 12px;
-            border-radius: 6px;
-        }
-        QScrollBar::handle:vertical {
-            background: rgba(74, 144, 226, 150);
-            border-radius: 6px;
-            min-height: 20px;
-        }
-        QScrollBar::handle:vertical:hover {
-            background: rgba(74, 144, 226, 200);
-        }
-    )");
+    Theme::applyTable(usbTable, Theme::UsbTable);
     usbTable->horizontalHeader()->setStretchLastSection(true);
     usbTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch); // растягивает все колонки равномерно
     usbTable->verticalHeader()->setVisible(false);
@@ -339,24 +382,7 @@ void MainWindow::setupUsbInfoPanel() {
     usbTable->resizeColumnsToContents(); // дополнительно подгоняем ширину под содержимое перед растяжкой
     QPushButton *backButton = new QPushButton(" Назад", usbInfoPanel);
     backButton->setFixedSize(160, 40);
-    backButton->setStyleSheet(R"(
-            QPushButton {
-                background-color: rgba(74, 144, 226, 220);
-                color: white;
-                border-radius: 8px;
-                font-size: 16px;
-                font-weight: bold;
-            }
-            QPushButton:hover {
-                background-color: rgba(53, 122, 189, 220);
-            }
-            QPushButton:pressed {
-                background-color: rgba(44, 90, 160, 240);
-            }
-            QPushButton:disabled {
-                background-color: rgba(74, 144, 226, 100);
-            }
-    )");
+    Theme::applyButton(backButton, 16);
     QPushButton *safeRemoveBtn = new QPushButton("Безопасное извлечение", usbInfoPanel);
     QPushButton *denyRemoveBtn = new QPushButton("Выкл безопасного извлечения", usbInfoPanel);
     QList<QPushButton*> eventButtons = { safeRemoveBtn, denyRemoveBtn };
@@ -364,24 +390,7 @@ void MainWindow::setupUsbInfoPanel() {
         btn->setMinimumWidth(220);
         btn->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
         btn->setFixedHeight(50);
-        btn->setStyleSheet(R"(
-            QPushButton {
-                background-color: rgba(74, 144, 226, 220);
-                color: white;
-                border-radius: 8px;
-                font-size: 15px;
-                font-weight: bold;
-            }
-            QPushButton:hover {
-                background-color: rgba(53, 122, 189, 220);
-            }
-            QPushButton:pressed {
-                background-color: rgba(44, 90, 160, 240);
-            }
-            QPushButton:disabled {
-                background-color: rgba(74, 144, 226, 100);
-            }
-        )");
+        Theme::applyButton(btn, 15);
     }
     QHBoxLayout *eventsLayout = new QHBoxLayout();
     eventsLayout->setSpacing(15);
@@ -450,7 +459,8 @@ void MainWindow::setupUsbInfoPanel() {
 }
 
 void MainWindow::showUsbInfo() {
-    frameTimer->stop();
+    ensureUsbInfoPanel();
+    timeline->stop();
     resetTimer->stop();
     currentAnimationType = Funny;
     startFunnyAnimation();
@@ -467,6 +477,8 @@ void MainWindow::activateUsbPanel() {
 
 void MainWindow::onDevicesChanged()
 {
+    // Пока панель USB не открывали, таблицу обновлять некому — перечислит ensureUsbInfoPanel
+    if (!usbInfoPanel) return;
     QList<UsbDevice> devices = UsbMonitor::getInstance()->getUsbDevices();
     updateUsbTable(devices);
     lastKnownDevices = devices;
@@ -507,11 +519,23 @@ void MainWindow::updateUsbTable(const QList<UsbDevice>& devices)
 
 void MainWindow::startAnimation(const QString &prefix, int start, int end, int delay,
                                 bool infinite = false, bool reverse = false, AnimationType type = None,int count=1) {
+    isEatAnimationInfinite = infinite;
+    // Eat при питании от сети и Pointer крутятся, пока их не остановят
+    int repetitions = ((infinite && type == Eat) || type == Pointer) ? 0 : 1;
+    playAnimation(prefix, start, end, delay, reverse, type, count, repetitions);
+}
+void MainWindow::playAnimation(const QString &prefix, int start, int end, int delay, bool reverse,
+                               AnimationType type, int count, int repetitions) {
     loadFrames(prefix, start, end, count, reverse,false);
-    currentFrame = 0;
+    frameCache->setPinned(frameNames, spriteSize(type), devicePixelRatioF());
+    frameCache->prefetch(frameNames, spriteSize(type), devicePixelRatioF());
     currentAnimationType = type;
-    isEatAnimationInfinite = infinite;
-    frameTimer->start(delay);
+    AnimationSequence sequence;
+    sequence.frames = frameNames;
+    sequence.frameDelay = delay;
+    sequence.repetitions = repetitions;
+    sequence.holdLastMs = (type == Sad) ? SadHoldMs : 0; // Держим последний кадр Sad 2 секунды
+    timeline->start(sequence);
 }
 void MainWindow::updatePowerInfo(const QString &powerSourceType,
                                  const QString &batteryType,
@@ -528,10 +552,9 @@ void MainWindow::updatePowerInfo(const QString &powerSourceType,
     batteryWidget->setBatteryLevel(batteryLevel);
 }
 void MainWindow::setupPowerInfoPanel() {
-    powerInfoPanel = new QWidget(animationLabel);
+    powerInfoPanel = new ThemePanel(ThemePanel::PowerPanel, animationLabel);
     powerInfoPanel->setFixedSize(500, 640);
     powerInfoPanel->move(700, 30);
-    powerInfoPanel->setStyleSheet("background-color: rgba(255, 255, 255, 220); border-radius: 12px; border: 1px solid rgba(74, 144, 226, 100);");
     QVBoxLayout *panelLayout = new QVBoxLayout(powerInfoPanel);
     panelLayout->setContentsMargins(20, 20, 20, 20);
     panelLayout->setSpacing(20);
@@ -539,46 +562,29 @@ void MainWindow::setupPowerInfoPanel() {
     titleLabel = new QLabel("Энергопитание", powerInfoPanel);
     titleLabel->setFont(QFont("Arial", 20, QFont::Bold));
     titleLabel->setAlignment(Qt::AlignCenter);
-    titleLabel->setStyleSheet("background-color: transparent; color: #2C5AA0; border:none;");
+    Theme::applyTitle(titleLabel);
     batteryWidget = new BatteryWidget(powerInfoPanel);
-    batteryWidget->setStyleSheet("background-color: transparent; color:black; border:none;");
     powerSourceLabel = new QLabel("Тип энергопитания: Неизвестно", powerInfoPanel);
     powerSourceLabel->setFont(labelFont);
-    powerSourceLabel->setStyleSheet("background-color: transparent; color:black; border:none;");
+    Theme::applyText(powerSourceLabel);
     batteryTypeLabel = new QLabel("Тип батареи: Неизвестно", powerInfoPanel);
     batteryTypeLabel->setFont(labelFont);
-    batteryTypeLabel->setStyleSheet("background-color: transparent; color:black; border:none;");
+    Theme::applyText(batteryTypeLabel);
     powerModeStatusLabel = new QLabel("Режим работы: Неизвестно", powerInfoPanel);
     powerModeStatusLabel->setFont(labelFont);
-    powerModeStatusLabel->setStyleSheet("background-color: transparent; color:black; border:none;");
+    Theme::applyText(powerModeStatusLabel);
     dischargeDurationLabel = new QLabel("Время работы: 00:00:00", powerInfoPanel);
     dischargeDurationLabel->setFont(labelFont);
-    dischargeDurationLabel->setStyleSheet("background-color: transparent; color:black; border:none;");
+    Theme::applyText(dischargeDurationLabel);
     remainingBatteryTimeLabel = new QLabel("Оставшееся время: 00:00:00", powerInfoPanel);
     remainingBatteryTimeLabel->setFont(labelFont);
-    remainingBatteryTimeLabel->setStyleSheet("background-color: transparent;color:black; border:none;");
+    Theme::applyText(remainingBatteryTimeLabel);
     sleepButton = new QPushButton("Спящий режим", powerInfoPanel);
     hibernateButton = new QPushButton("Гибернация", powerInfoPanel);
     backButton = new QPushButton("Назад", powerInfoPanel);
-    QString buttonStyle = R"(
-        QPushButton {
-            background-color: rgba(74, 144, 226, 220);
-            color: white;
-            border-radius: 8px;
-            font-size: 16px;
-            font-weight: bold;
-            padding: 10px;
-        }
-        QPushButton:hover {
-            background-color: rgba(53, 122, 189, 220);
-        }
-        QPushButton:pressed {
-            background-color: rgba(44, 90, 160, 240);
-        }
-    )";
-    sleepButton->setStyleSheet(buttonStyle);
-    hibernateButton->setStyleSheet(buttonStyle);
-    backButton->setStyleSheet(buttonStyle);
+    Theme::applyButton(sleepButton, 16);
+    Theme::applyButton(hibernateButton, 16);
+    Theme::applyButton(backButton, 16);
     sleepButton->setFixedSize(150, 50);
     hibernateButton->setFixedSize(150, 50);
     backButton->setFixedSize(150, 50);
@@ -613,7 +619,7 @@ void MainWindow::activatePowerInfoPanel() {
     }
     powerInfoPanel->show();
     drawBackground();
-    frameTimer->stop();
+    timeline->stop();
     resetTimer->stop();
     if (powerMonitor->getPowerSourceType() == "Сеть") {
         isEatAnimationInfinite = true;
@@ -622,14 +628,15 @@ void MainWindow::activatePowerInfoPanel() {
 }
 
 void MainWindow::showPowerInfo() {
-    frameTimer->stop();
+    ensurePowerInfoPanel();
+    timeline->stop();
     resetTimer->stop();
     currentAnimationType = Boredom;
     startBoredomAnimation();
 }
 void MainWindow::hidePowerInfo() {
     lab1Activated = false;
-    frameTimer->stop();
+    timeline->stop();
     resetTimer->stop();
     powerInfoPanel->hide();
     for (QPushButton *btn : labButtons) {
@@ -644,67 +651,30 @@ void MainWindow::updatePowerMode(const QString &mode) {
 
 
 void MainWindow::setupPCIInfoPanel() {
-    pciInfoPanel = new QWidget(animationLabel);
+    pciInfoPanel = new ThemePanel(ThemePanel::PciPanel, animationLabel);
     pciInfoPanel->setFixedSize(770, 680);
     pciInfoPanel->move(450, 30);
-    pciInfoPanel->setStyleSheet(R"(
-        QWidget {
-            background-color: rgba(255, 255, 255, 230);
-            border-radius: 12px;
-            border: 1px solid rgba(74, 144, 226, 120);
-        }
-    )");
     QVBoxLayout *panelLayout = new QVBoxLayout(pciInfoPanel);
     panelLayout->setContentsMargins(25, 25, 25, 25);
     panelLayout->setSpacing(25);
     QLabel *titleLabel = new QLabel("Устройства PCI", pciInfoPanel);
     titleLabel->setFont(QFont("Arial", 22, QFont::Bold));
     titleLabel->setAlignment(Qt::AlignCenter);
-    titleLabel->setStyleSheet("background-color: transparent; border:none; color: #2C5AA0;");
-    pciTable = new QTableWidget(pciInfoPanel);
-    pciTable->setRowCount(0);
-    pciTable->setColumnCount(5);
-    pciTable->setHorizontalHeaderLabels({"№", "VendorID", "DeviceID", "Название", "Шина"});
-    pciTable->setStyleSheet(R"(
-        QTableWidget {
-            background-color: transparent;
-            font-family: Arial;
-            font-size: 16px;
-            color: #333333;
-            border: 1px solid rgba(74, 144, 226, 150);
-            border-radius: 8px;
-            gridline-color: rgba(74, 144, 226, 100);
-        }
-        QTableWidget::item {
-            padding: 12px;
-            background-color: rgba(255, 255, 255, 200);
-        }
-        QTableWidget::item:selected {
-            background-color: rgba(74, 144, 226, 160);
-            color: white;
-        }
-        QTableWidget::item:hover {
-            background-color: rgba(53, 122, 189, 120);
-        }
-        QHeaderView::section {
-            background-color: rgba(74, 144, 226, 200);
-            color: white;
-            font-weight: bold;
-            font-size: 20px;
-            padding: 10px;
-            border: none;
-        }
-        QHeaderView::section:hover {
-            background-color: rgba(53, 122, 189, 200);
-        }
-        QTableCornerButton::section {
-            background-color: rgba(74, 144, 226, 200);
-            border: none;
-        }
-        QTableWidget {
-            alternate-background-color: rgba(240, 248, 255, 120);
-        }
-    )");
+    Theme::applyTitle(titleLabel);
+    // Фильтр по базовому классу: строки сравниваются по числовому коду, а не по названию
+    pciClassFilter = new QComboBox(pciInfoPanel);
+    pciClassFilter->setFont(QFont("Arial", 12));
+    pciClassFilter->setMinimumWidth(260);
+    connect(pciClassFilter, &QComboBox::currentIndexChanged, this, &MainWindow::filterPCIByClass);
+    // Модель поверх снимка устройств, фильтр по классу — прокси-модель, а не скрытие строк
+    pciModel = new PciTableModel(this);
+    pciClassProxy = new QSortFilterProxyModel(this);
+    pciClassProxy->setSourceModel(pciModel);
+    pciClassProxy->setFilterRole(PciTableModel::BaseClassRole);
+    pciTable = new QTableView(pciInfoPanel);
+    pciTable->setModel(pciClassProxy);
+    pciTable->setItemDelegateForColumn(PciTableModel::NameColumn, new PciElideDelegate(MaxPciNameWidth, pciTable));
+    Theme::applyTable(pciTable, Theme::PciTable);
     pciTable->setAlternatingRowColors(true);
     pciTable->setColumnWidth(0, 50);
     pciTable->setColumnWidth(1, 100);
@@ -718,47 +688,49 @@ void MainWindow::setupPCIInfoPanel() {
     pciTable->horizontalHeader()->setStretchLastSection(false);
     pciTable->horizontalHeader()->setMinimumHeight(50);
     pciTable->verticalHeader()->setVisible(false);
+    // Высота строк одна на всю таблицу, иначе представление меряет каждую строку
+    pciTable->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    // Ширина по содержимому меряется по первым строкам, а не по всем
+    pciTable->horizontalHeader()->setResizeContentsPrecision(PciResizePrecision);
     pciTable->setSelectionMode(QAbstractItemView::ExtendedSelection);
     pciTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     pciTable->setFocusPolicy(Qt::NoFocus);
     pciTable->setMinimumHeight(550);
     pciTable->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    pciTable->setWordWrap(true);
+    pciTable->setWordWrap(false);
+    pciTable->setTextElideMode(Qt::ElideRight);
     pciTable->setFixedSize(720, 500);
     QShortcut *copyShortcut = new QShortcut(QKeySequence::Copy, pciTable);
     connect(copyShortcut, &QShortcut::activated, this, [this]() {
         QString copiedText;
-        QList<QTableWidgetItem*> selected = pciTable->selectedItems();
-        std::sort(selected.begin(), selected.end(), [](QTableWidgetItem* a, QTableWidgetItem* b){
-            return a->row() < b->row() || (a->row() == b->row() && a->column() < b->column());
+        QModelIndexList selected = pciTable->selectionModel()->selectedIndexes();
+        std::sort(selected.begin(), selected.end(), [](const QModelIndex &a, const QModelIndex &b){
+            return a.row() < b.row() || (a.row() == b.row() && a.column() < b.column());
         });
         int lastRow = -1;
-        for (QTableWidgetItem* item : selected) {
-            if (item->row() != lastRow && lastRow != -1) copiedText += "\n";
-            copiedText += item->data(Qt::UserRole).toString() + "\t";
-            lastRow = item->row();
+        for (const QModelIndex &index : selected) {
+            if (index.row() != lastRow && lastRow != -1) copiedText += "\n";
+            copiedText += index.data(PciTableModel::FullTextRole).toString() + "\t";
+            lastRow = index.row();
         }
         QGuiApplication::clipboard()->setText(copiedText);
     });
     QPushButton *backButton = new QPushButton("Назад", pciInfoPanel);
     backButton->setFixedSize(150, 50);
-    backButton->setStyleSheet(R"(
-        QPushButton {
-            background-color: rgba(74, 144, 226, 220);
-            color: white;
-            border-radius: 8px;
-            font-size: 16px;
-            font-weight: bold;
-            padding: 10px;
-        }
-        QPushButton:hover {
-            background-color: rgba(53, 122, 189, 220);
-        }
-        QPushButton:pressed {
-            background-color: rgba(44, 90, 160, 240);
-        }
-    )");
-    panelLayout->addWidget(titleLabel);
+    Theme::applyButton(backButton, 16);
+    // Под фильтром — ход перечисления, затем число устройств и время поиска
+    pciStatus = new QLabel(pciInfoPanel);
+    pciStatus->setFont(QFont("Arial", 10));
+    pciStatus->setAlignment(Qt::AlignCenter);
+    Theme::applyText(pciStatus, QColor(0x33, 0x33, 0x33));
+    QVBoxLayout *filterLayout = new QVBoxLayout();
+    filterLayout->setSpacing(2);
+    filterLayout->addWidget(pciClassFilter);
+    filterLayout->addWidget(pciStatus);
+    QHBoxLayout *titleLayout = new QHBoxLayout();
+    titleLayout->addWidget(titleLabel, 1);
+    titleLayout->addLayout(filterLayout);
+    panelLayout->addLayout(titleLayout);
     panelLayout->addWidget(pciTable);
     panelLayout->addStretch(1);
     panelLayout->addWidget(backButton, 0, Qt::AlignCenter);
@@ -768,54 +740,121 @@ void MainWindow::setupPCIInfoPanel() {
 
 void MainWindow::activatePCIInfoPanel() {
     lab1Activated = false;
-    powerInfoPanel->hide();
+    if (powerInfoPanel) powerInfoPanel->hide();
     for (QPushButton *btn : labButtons) {
         btn->hide();
     }
     pciInfoPanel->show();
     startPointerAnimation();
-    QList<PCIDevice> devices = pciMonitor->getPCIDevices();
-    pciTable->setRowCount(devices.size());
-    QFont tableFont("Arial", 14);
-    QFontMetrics fontMetrics(tableFont);
-    const int maxNameWidth = 290;
-    for (int i = 0; i < devices.size(); ++i) {
-        QTableWidgetItem *numberItem = new QTableWidgetItem(QString::number(i + 1));
-        numberItem->setTextAlignment(Qt::AlignCenter);
-        pciTable->setItem(i, 0, numberItem);
-        QTableWidgetItem *vendorItem = new QTableWidgetItem(devices[i].vendorID);
-        vendorItem->setTextAlignment(Qt::AlignCenter);
-        pciTable->setItem(i, 1, vendorItem);
-        QTableWidgetItem *deviceItem = new QTableWidgetItem(devices[i].deviceID);
-        deviceItem->setTextAlignment(Qt::AlignCenter);
-        pciTable->setItem(i, 2, deviceItem);
-        QString nameText = devices[i].friendlyName;
-        QString truncatedName = fontMetrics.elidedText(nameText, Qt::ElideRight, maxNameWidth);
-        QTableWidgetItem *nameItem = new QTableWidgetItem(truncatedName);
-        nameItem->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-        nameItem->setData(Qt::UserRole, nameText);
-        nameItem->setToolTip(nameText);
-        pciTable->setItem(i, 3, nameItem);
-        QString busText = devices[i].instanceID;
-        QTableWidgetItem *busItem = new QTableWidgetItem(busText);
-        busItem->setTextAlignment(Qt::AlignCenter);
-        busItem->setData(Qt::UserRole, busText);
-        busItem->setToolTip(busText);
-        pciTable->setItem(i, 4, busItem);
+    // Пока hotplug следит за шиной, снимок и таблица уже свежие: полный обход
+    // нужен только в первый раз и после события без адреса
+    if (!pciMonitor->hasSnapshot() || !pciHotplug->isWatching() || pciRescanPending) {
+        startPCIEnumeration();
     }
-    pciTable->resizeColumnsToContents();
-    pciTable->resizeRowsToContents();
     drawBackground();
 }
 
+void MainWindow::startPCIEnumeration() {
+    // На сервере с сотнями функций перечисление занимает сотни миллисекунд, поэтому
+    // оно идёт в пуле потоков, а таблица растёт по мере прихода результатов
+    // Когда снимок уже есть, строки не трогаются: в конце применяются только отличия
+    pciWatcher->cancel();
+    pciRescanPending = false;
+    pciStreaming = !pciMonitor->hasSnapshot();
+    if (pciStreaming) pciModel->clear();
+    pciStatus->setText("Поиск устройств…");
+    pciEnumerationClock.start();
+    const envirconfigPCI *monitor = pciMonitor;
+    pciWatcher->setFuture(QtConcurrent::run([monitor](QPromise<PCIDevice> &promise) {
+        monitor->enumerate(promise);
+    }));
+}
+
+void MainWindow::appendPCIRows(int begin, int end) {
+    if (!pciStreaming) return;
+    // Рабочий поток отдал устройства и больше их не трогает — дальше это копии GUI-потока
+    QList<PCIDevice> batch;
+    batch.reserve(end - begin);
+    for (int index = begin; index < end; ++index) {
+        batch.append(pciWatcher->resultAt(index));
+    }
+    pciModel->append(batch);
+    // Высота строки — по первой видимой строке; sizeHintForRow смотрит только её ячейки
+    const int rowHeight = pciTable->sizeHintForRow(0);
+    if (rowHeight > 0 && rowHeight != pciTable->verticalHeader()->defaultSectionSize()) {
+        pciTable->verticalHeader()->setDefaultSectionSize(rowHeight);
+    }
+}
+
+void MainWindow::updatePCIProgress(int value) {
+    pciStatus->setText(QString("Поиск устройств: %1 из %2").arg(value).arg(pciWatcher->progressMaximum()));
+}
+
+void MainWindow::finishPCIEnumeration() {
+    if (pciWatcher->isCanceled()) return;
+    pciEnumerationMs = pciEnumerationClock.elapsed();
+    const PciDelta delta = pciMonitor->applySnapshot(pciWatcher->future().results());
+    if (!pciStreaming) {
+        applyPCIDelta(delta);
+    }
+    const QList<PCIDevice> &devices = pciModel->devices();
+    qDebug() << "PCI enumeration:" << devices.size() << "devices in" << pciEnumerationMs << "ms";
+    pciStatus->setText(QString("Устройств: %1, поиск %2 мс").arg(devices.size()).arg(pciEnumerationMs));
+    if (pciStreaming) {
+        pciTable->resizeColumnsToContents();
+        updatePCIClassFilter(devices);
+    }
+    // Пока шёл обход, пришли события, которые в снимок могли не попасть
+    if (pciRescanPending && pciInfoPanel->isVisible()) {
+        startPCIEnumeration();
+    }
+}
+
+void MainWindow::applyPCIDelta(const PciDelta &delta) {
+    if (delta.isEmpty()) return;
+    qDebug() << "PCI changes:" << delta.added.size() << "added," << delta.removed.size() << "removed,"
+             << delta.changed.size() << "changed";
+    pciModel->apply(delta);
+    updatePCIClassFilter(pciModel->devices());
+}
+
+void MainWindow::updatePCIClassFilter(const QList<PCIDevice> &devices) {
+    // В списке только те базовые классы, что реально есть в системе, с числом устройств
+    QMap<int, int> counts;
+    for (const PCIDevice &dev : devices) {
+        ++counts[int(dev.classCode >> 16)];
+    }
+    const int previous = pciClassFilter->currentData().isValid() ? pciClassFilter->currentData().toInt() : -1;
+    pciClassFilter->blockSignals(true);
+    pciClassFilter->clear();
+    pciClassFilter->addItem(QString("Все классы (%1)").arg(devices.size()), -1);
+    for (auto it = counts.cbegin(); it != counts.cend(); ++it) {
+        const char *base = PciDatabase::classInfo(quint32(it.key()) << 16).base;
+        const QString name = base ? QString::fromUtf8(base) : QString("Класс %1").arg(it.key(), 2, 16, QChar('0'));
+        pciClassFilter->addItem(QString("%1 (%2)").arg(name).arg(it.value()), it.key());
+    }
+    pciClassFilter->setCurrentIndex(qMax(0, pciClassFilter->findData(previous)));
+    pciClassFilter->blockSignals(false);
+    filterPCIByClass();
+}
+
+void MainWindow::filterPCIByClass() {
+    const int baseClass = pciClassFilter->currentData().toInt();
+    pciClassProxy->setFilterRegularExpression(
+        baseClass >= 0 ? QRegularExpression(QRegularExpression::anchoredPattern(QString::number(baseClass)))
+                       : QRegularExpression());
+}
+
 void MainWindow::showPCIInfo() {
-    frameTimer->stop();
+    ensurePCIInfoPanel();
+    timeline->stop();
     resetTimer->stop();
     startBasketballAnimation();
 }
 void MainWindow::hidePCIInfo() {
     lab1Activated = false;
-    frameTimer->stop();
+    pciWatcher->cancel();
+    timeline->stop();
     resetTimer->stop();
     isPointerAnimationInfinite = false;
     pciInfoPanel->hide();
@@ -836,42 +875,32 @@ void MainWindow::setupWebcamPanel() {
         QCameraDevice defaultCamera = cameras.first();
         infoText = defaultCamera.description();
     }
-    webcamPanel = new QWidget(animationLabel);
+    webcamPanel = new ThemePanel(ThemePanel::WebcamPanel, animationLabel);
     webcamPanel->setFixedSize(800, 600);
     webcamPanel->move(400, 60);
-    webcamPanel->setStyleSheet(R"(
-        QWidget {
-            background-color: rgba(255, 255, 255, 240);
-            border-radius: 15px;
-            border: 2px solid rgba(74, 144, 226, 150);
-            padding: 5px;
-        }
-    )");
     QVBoxLayout *panelLayout = new QVBoxLayout(webcamPanel);
     panelLayout->setContentsMargins(20, 20, 20, 20);
     QLabel *titleLabel = new QLabel("Веб-камера", webcamPanel);
     titleLabel->setFont(QFont("Arial", 24, QFont::Bold));
     titleLabel->setAlignment(Qt::AlignCenter);
-    titleLabel->setStyleSheet(R"(
-        background-color: transparent;
-        color: #2C5AA0;
-        border: none;
-        padding: 5px;
-    )");
+    Theme::applyTitle(titleLabel, 5);
     cameraInfoLabel = new QLabel("Информация о камере: "+infoText);
     cameraInfoLabel->setAlignment(Qt::AlignCenter); // центрируем текст
     cameraInfoLabel->setWordWrap(false); // запрет переносов
     cameraInfoLabel->setTextFormat(Qt::PlainText); // обычный текст
     cameraInfoLabel->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
     cameraInfoLabel->setFont(QFont("Arial", 14));
-    cameraInfoLabel->setStyleSheet("background-color: transparent; border: none; color: #333333;");
+    Theme::applyText(cameraInfoLabel, QColor(0x33, 0x33, 0x33));
     previewWidget = new QVideoWidget(webcamPanel);
     previewWidget->setFixedSize(560, 345);
     previewWidget->setAspectRatioMode(Qt::KeepAspectRatioByExpanding);
 
     previewBlackOverlay = new QWidget(webcamPanel);
     previewBlackOverlay->setFixedSize(560, 345);
-    previewBlackOverlay->setStyleSheet("background-color: black; border-radius:0;");
+    QPalette overlayPalette = previewBlackOverlay->palette();
+    overlayPalette.setColor(QPalette::Window, Qt::black);
+    previewBlackOverlay->setPalette(overlayPalette);
+    previewBlackOverlay->setAutoFillBackground(true);
     previewBlackOverlay->hide();
 
 
@@ -883,32 +912,10 @@ void MainWindow::setupWebcamPanel() {
     startHiddenBtn = new QPushButton("Шпионить", webcamPanel);
     toggleCameraBtn = new QPushButton("Включить камеру", webcamPanel);
     backButton = new QPushButton("Назад", webcamPanel);
-    QString buttonStyle = R"(
-        QPushButton {
-            background-color: rgba(74, 144, 226, 220);
-            color: white;
-            border-radius: 8px;
-            font-size: 16px;
-            font-weight: bold;
-            padding: 10px;
-            min-width: 120px;
-        }
-        QPushButton:hover {
-            background-color: rgba(53, 122, 189, 220);
-        }
-        QPushButton:pressed {
-            background-color: rgba(44, 90, 160, 240);
-        }
-        QPushButton:disabled {
-            background-color: rgba(74, 144, 226, 100);
-        }
-    )";
-    capturePhotoBtn->setStyleSheet(buttonStyle);
-    startVideoBtn->setStyleSheet(buttonStyle);
-    stopVideoBtn->setStyleSheet(buttonStyle);
-    startHiddenBtn->setStyleSheet(buttonStyle);
-    toggleCameraBtn->setStyleSheet(buttonStyle);
-    backButton->setStyleSheet(buttonStyle);
+    for (QPushButton *btn : {capturePhotoBtn, startVideoBtn, stopVideoBtn, startHiddenBtn, toggleCameraBtn, backButton}) {
+        Theme::applyButton(btn, 16);
+        btn->setMinimumWidth(140);
+    }
     capturePhotoBtn->setEnabled(false);
     startVideoBtn->setEnabled(false);
     QHBoxLayout *buttonLayout = new QHBoxLayout();
@@ -976,7 +983,8 @@ void MainWindow::hideOverlay() {
 }
 
 void MainWindow::showWebcamPanel() {
-    frameTimer->stop();
+    ensureWebcamPanel();
+    timeline->stop();
     resetTimer->stop();
     currentAnimationType = Jumping;
     isEatAnimationInfinite = false;
@@ -1105,133 +1113,102 @@ void MainWindow::toggleCamera() {
 }
 
 void MainWindow::loadFrames(const QString &prefix, int start, int end,int countRepeat=1, bool reverse = false,bool reverse_only=false) {
-    framePaths.clear();
+    frameNames.clear();
     if(!reverse_only){
         for(int j=0;j<countRepeat;j++){
             for (int i = start; i <= end; ++i)
-                framePaths << ASSETS_PATH + QString("%1%2.svg").arg(prefix).arg(i);
+                frameNames << prefix + QString::number(i);
         }
     }
     if (reverse) {
         for (int i = end - 1; i > start; --i)
-            framePaths << ASSETS_PATH + QString("%1%2.svg").arg(prefix).arg(i);
+            frameNames << prefix + QString::number(i);
     }
 }
 
-void MainWindow::drawBackground() {
-    QPixmap pix(1245, 720);
-    pix.fill(Qt::transparent);
-    QPainter painter(&pix);
-
-    // Фон
-    QString bgPath = ASSETS_PATH + "krosh_house.jpg";
-    if (QFile::exists(bgPath)) {
-        QPixmap bg(bgPath);
-        painter.drawPixmap(pix.rect(), bg);
-    } else {
-        qDebug() << "Background image not found:" << bgPath;
-        pix.fill(Qt::lightGray);
-    }
-
-    // Определяем, какой кадр рисовать
-    // Определяем, какой кадр рисовать
-    QString framePath;
+QRect MainWindow::spriteRect(const QSize &kroshSize) const {
+    bool pciVisible = pciInfoPanel ? pciInfoPanel->isVisible() : false;
     bool webcamVisible = webcamPanel ? webcamPanel->isVisible() : false;
     bool usbVisible = usbInfoPanel ? usbInfoPanel->isVisible() : false;
-    bool pciVisible = pciInfoPanel ? pciInfoPanel->isVisible() : false;
-
-    if (webcamVisible) {
-        framePath = isCameraOn ? ASSETS_PATH + "Glasses6.svg" : ASSETS_PATH + "Frame1.svg";
-    } else {
-        framePath = ASSETS_PATH + "Frame1.svg";
-    }
+    const QSize sceneSize = animationLabel->size();
+    // Спрайт ставится в целые координаты, чтобы кадр копировался в сцену без пересэмплирования
+    int xPos = (pciVisible || webcamVisible) ? 30
+               : (lab1Activated || usbVisible ? 250 : (sceneSize.width() - kroshSize.width()) / 2);
+    int yPos = (sceneSize.height() - kroshSize.height()) / 2 + 150;
+    return QRect(QPoint(xPos, yPos), kroshSize);
+}
 
-    if (QFile::exists(framePath)) {
-        QSvgRenderer renderer(framePath);
-        if (renderer.isValid()) {
-            QSize kroshSize = (webcamVisible && isCameraOn) ? QSize(350, 386) : QSize(276, 386);
-            bool panelVisible = pciVisible || webcamVisible;
+void MainWindow::drawBackground() {
+    // Определяем, какой кадр рисовать
+    bool webcamVisible = webcamPanel ? webcamPanel->isVisible() : false;
+    QString frameName = (webcamVisible && isCameraOn) ? "Glasses6" : "Frame1";
+    QSize kroshSize = (webcamVisible && isCameraOn) ? AnimationCatalog::GlassesSpriteSize : AnimationCatalog::SpriteSize;
+    animationLabel->setSprite(frameCache->frame(frameName, kroshSize, devicePixelRatioF()), spriteRect(kroshSize));
+}
 
-            qreal xPos = panelVisible ? 30 : (lab1Activated || usbVisible ? 250 : (pix.width() - kroshSize.width()) / 2.0);
-            QRectF targetRect(xPos, (pix.height() - kroshSize.height()) / 2.0 + 150, kroshSize.width(), kroshSize.height());
-            renderer.render(&painter, targetRect);
+void MainWindow::onAnimationFinished() {
+    AnimationType finishedType = currentAnimationType;
+    frameCache->setPinned({}, QSize(), devicePixelRatioF());
+    if (finishedType == Funny) {
+        // Завершили Funny - активируем панель
+        activateUsbPanel();
+        currentAnimationType = None;
+    } else if (finishedType == Sad) {
+        drawBackground();
+        currentAnimationType = None;
+    } else if (finishedType == Glasses) {
+        isCameraOn = !isCameraOn;
+        drawBackground(); // Теперь будет Frame1 или Glasses6
+    } else if (finishedType == Boredom) {
+        currentAnimationType = None;
+        if (!lab1Activated) {
+            activatePowerInfoPanel();
         } else {
-            qDebug() << "Invalid SVG content in:" << framePath;
+            drawBackground();
         }
+    } else if (finishedType == Basketball) {
+        currentAnimationType = None;
+        drawBackground();
+        QTimer::singleShot(100, this, [this]() {
+            startPointerAnimation();
+            activatePCIInfoPanel();
+        });
     } else {
-        qDebug() << "Frame not found:" << framePath;
-    }
-    animationLabel->setPixmap(pix);
-}
-
-void MainWindow::updateFrame() {
-    if (currentFrame >= framePaths.size()) {
-        if ((isEatAnimationInfinite && currentAnimationType == Eat) || currentAnimationType == Pointer) {
-            currentFrame = 0;
-        } else if (currentAnimationType == Funny) {
-            // Завершили Funny - активируем панель
-            activateUsbPanel();
-            frameTimer->stop();
-            currentAnimationType = None;
-            return;
-        }
-        else {
-            frameTimer->stop();
-            if (currentAnimationType == Sad) {
-                // 🕒 Держим последний кадр 2 секунды
-                QTimer::singleShot(2000, this, [this]() {
-                    drawBackground();
-                    currentAnimationType = None;
-                });
-                return;
-            }
-
-
-            if (currentAnimationType == Glasses) {
-                isCameraOn = !isCameraOn;
-                drawBackground(); // Теперь будет Frame1 или Glasses6
-            } else if (currentAnimationType == Boredom || currentAnimationType == Basketball) {
-                drawBackground();
-            } else {
-                drawBackground();
-            }
-            return;
-        }
+        drawBackground();
     }
+}
 
-    QPixmap pix(1245, 720);
-    pix.fill(Qt::transparent);
-    QPainter painter(&pix);
-
-    QString bgPath = ASSETS_PATH + "krosh_house.jpg";
-    if (QFile::exists(bgPath)) {
-        QPixmap bg(bgPath);
-        painter.drawPixmap(pix.rect(), bg);
-    }
+void MainWindow::updateFrame(int frameIndex) {
+    const QSize kroshSize = spriteSize(currentAnimationType);
+    QImage sprite = frameCache->frame(frameNames[frameIndex], kroshSize, devicePixelRatioF());
+    animationLabel->setSprite(sprite, spriteRect(kroshSize));
+    updatePacingOverlay();
+}
 
-    QString currentPath = framePaths[currentFrame];
-    QSvgRenderer renderer(currentPath);
+void MainWindow::updatePacingOverlay() {
+    if (!animationLabel->isOverlayVisible()) return;
+    const AnimationTimeline::PacingStats pacing = timeline->pacingStats();
+    animationLabel->setOverlayText(QString("frame delay: %1 ms%2\n"
+                                           "presented: %3  late: %4  dropped: %5\n"
+                                           "latency: last %6 / mean %7 / max %8 ms")
+                                       .arg(timeline->sequence().frameDelay)
+                                       .arg(timeline->isFrameDropping() ? " (drop frames)" : "")
+                                       .arg(pacing.presented).arg(pacing.late).arg(pacing.dropped)
+                                       .arg(pacing.lastLatencyMs)
+                                       .arg(pacing.meanLatencyMs, 0, 'f', 1)
+                                       .arg(pacing.maxLatencyMs));
+}
 
+QSize MainWindow::spriteSize(AnimationType type) {
     // Размеры для разных анимаций
-    QSize kroshSize(276, 386);
-    if (currentAnimationType == Basketball || currentAnimationType == Jumping) {
-        kroshSize = QSize(400, 386);
-    } else if (currentAnimationType == Glasses) {
-        kroshSize = QSize(350, 386); // Glasses анимация тоже шире
+    if (type == Basketball || type == Jumping) {
+        return AnimationCatalog::WideSpriteSize;
+    } else if (type == Glasses) {
+        return AnimationCatalog::GlassesSpriteSize; // Glasses анимация тоже шире
+    } else if (type == Funny) {
+        return AnimationCatalog::FunnySpriteSize;
     }
-    else if (currentAnimationType == Funny) {
-        kroshSize = QSize(380, 416); // Glasses анимация тоже шире
-    }
-
-    bool panelVisible = pciInfoPanel ? pciInfoPanel->isVisible() : false;
-    bool webcamVisible = webcamPanel ? webcamPanel->isVisible() : false;
-    bool usbVisible = usbInfoPanel ? usbInfoPanel->isVisible() : false;
-    qreal xPos = (panelVisible || webcamVisible) ? 30 : (lab1Activated || usbVisible ? 250 : (pix.width() - kroshSize.width()) / 2.0);
-    QRectF targetRect(xPos, (pix.height() - kroshSize.height()) / 2.0 + 150, kroshSize.width(), kroshSize.height());
-    renderer.render(&painter, targetRect);
-
-    animationLabel->setPixmap(pix);
-    currentFrame++;
+    return AnimationCatalog::SpriteSize;
 }
 
 void MainWindow::startTrickAnimation() {
@@ -1257,70 +1234,25 @@ void MainWindow::startPointerAnimation() {
     startAnimation("Pointer",1,4,300,false,true,Pointer);
 }
 void MainWindow::startBoredomAnimation() {
-    startAnimation("Boring",1,4,130,false,true,Boredom,2);
-    const int frameDelay = 130;
-    const int totalFrames = framePaths.size();
-    const int repetitions = 3;
-    frameTimer->start(frameDelay);
-    for (int i = 1; i < repetitions; ++i) {
-        QTimer::singleShot(i * totalFrames * frameDelay, this, [this, frameDelay]() {
-            if (currentAnimationType == Boredom && !lab1Activated) {
-                currentFrame = 0;
-                frameTimer->start(frameDelay);
-            }
-        });
-    }
-    QTimer::singleShot(repetitions * totalFrames * frameDelay, this, [this]() {
-        if (currentAnimationType == Boredom) {
-            currentAnimationType = None;
-            if (!lab1Activated) {
-                activatePowerInfoPanel();
-            } else {
-                drawBackground();
-            }
-        }
-    });
+    isEatAnimationInfinite = false;
+    // Как и раньше, при открытой Лабе1 цикл не перезапускается: хватает одного прохода
+    playAnimation("Boring",1,4,130,true,Boredom,2,lab1Activated ? 1 : 3);
 }
 void MainWindow::startBasketballAnimation() {
-    startAnimation("Basketball",1,8,130,false,false,Basketball);
-    const int frameDelay = 130;
-    const int totalFrames = framePaths.size();
-    const int repetitions = 3;
-    frameTimer->start(frameDelay);
-    for (int i = 1; i < repetitions; ++i) {
-        QTimer::singleShot(i * totalFrames * frameDelay, this, [this, frameDelay]() {
-            if (currentAnimationType == Basketball) {
-                currentFrame = 0;
-                frameTimer->start(frameDelay);
-            }
-        });
-    }
-    QTimer::singleShot(repetitions * totalFrames * frameDelay, this, [this]() {
-        if (currentAnimationType == Basketball) {
-            currentAnimationType = None;
-            frameTimer->stop();
-            drawBackground();
-            QTimer::singleShot(100, this, [this]() {
-                startPointerAnimation();
-                activatePCIInfoPanel();
-            });
-        } else {
-            frameTimer->stop();
-            drawBackground();
-        }
-    });
+    isEatAnimationInfinite = false;
+    playAnimation("Basketball",1,8,130,false,Basketball,1,3);
 }
 void MainWindow::startBlinkAnimation() {
     AnimationType prevType = currentAnimationType;
     startAnimation("Blinking",1,3,100,false,true,Blink);
-    disconnect(resetTimer, &QTimer::timeout, this, nullptr);
-    connect(resetTimer, &QTimer::timeout, this, [this, prevType]() {
+    disconnect(resetTimer, &ScheduledTimer::timeout, this, nullptr);
+    connect(resetTimer, &ScheduledTimer::timeout, this, [this, prevType]() {
         restorePreviousAnimation(prevType);
     });
 }
 
 void MainWindow::startGlassesAnimation(bool cameraOn) {
-    frameTimer->stop();
+    timeline->stop();
     resetTimer->stop();
 
     // Если включаем камеру: от Glasses6 к Frame1 (reverse = true)
@@ -1331,7 +1263,7 @@ void MainWindow::startGlassesAnimation(bool cameraOn) {
 
 void MainWindow::restorePreviousAnimation(AnimationType prevType) {
     currentAnimationType = prevType;
-    frameTimer->stop();
+    timeline->stop();
     resetTimer->stop();
     switch (prevType) {
     case Eat:
@@ -1382,7 +1314,7 @@ void MainWindow::triggerBlinkAnimation() {
         return; // просто выходим
     }
 
-    frameTimer->stop();
+    timeline->stop();
     startBlinkAnimation();
 }
 
@@ -5,7 +5,9 @@
 #include <QTimer>
 #include <QPushButton>
 #include <QTableWidget>
+#include <QTableView>
 #include <QSvgRenderer>
+#include <QStaticText>
 #include <QComboBox>
 #include <QVideoWidget>
 #include <QSystemTrayIcon>
@@ -14,10 +16,23 @@
 #include <QFileDialog>
 #include <QDateTime>
 #include <QDir>
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QSortFilterProxyModel>
+#include "displaylist.h"
 #include "powermonitor.h"
 #include "envirconfigpci.h"
+#include "pcitablemodel.h"
 #include "webcamera.h"
 #include "usbmonitor.h"
+#include "framecache.h"
+#include "memorypressuremonitor.h"
+#include "pcihotplugmonitor.h"
+#include "animationtimeline.h"
+#include "scenewidget.h"
+#include "assetpack.h"
+#include "timerscheduler.h"
+#include "theme.h"
 
 class BatteryWidget : public QLabel {
     Q_OBJECT
@@ -27,7 +42,12 @@ public:
 protected:
     void paintEvent(QPaintEvent *event) override;
 private:
-    QSvgRenderer *renderer;
+    static constexpr int AtlasStates = 10;
+    void ensureAtlas();
+    QList<DisplayList> stateLists;
+    QPixmap atlas;
+    QStaticText levelText;
+    QFont levelFont;
     int batteryLevel;
 };
 
@@ -39,13 +59,28 @@ public:
     explicit MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
     enum AnimationType { None, Eat, Sad, Jumping, Welcome, Blink, Boredom, Basketball, Pointer, Glasses, Funny,Trick };
+    // Время запуска: конструктор и первый кадр от начала main();
+    // firstFrameMs — -1, пока первый кадр не отрисован
+    struct StartupStats {
+        qint64 constructionMs = 0;
+        qint64 firstFrameMs = -1;
+    };
+
+    // Часы от начала main(): по ним считается время до первого кадра
+    void setStartupClock(const QElapsedTimer &clock);
+    StartupStats startupStats() const;
+
+signals:
+    void startupMeasured(const MainWindow::StartupStats &stats);
 
 protected:
     bool nativeEvent(const QByteArray &eventType, void *message, qintptr *result) override;
 
 private slots:
     void onDevicesChanged();
-    void updateFrame();
+    void updateFrame(int frameIndex);
+    void updatePacingOverlay();
+    void onAnimationFinished();
     void startAnimation(const QString &prefix, int start, int end, int delay,
                         bool infinite, bool reverse, AnimationType type,int count);
     void startSadAnimation();
@@ -82,31 +117,53 @@ private:
     void showOverlay();
     void hideOverlay();
     void drawBackground();
+    QRect spriteRect(const QSize &kroshSize) const;
+    void playAnimation(const QString &prefix, int start, int end, int delay, bool reverse,
+                       AnimationType type, int count, int repetitions);
     void loadFrames(const QString &prefix, int start, int end,int countRepeat, bool reverse,bool reverse_only);
+    static QSize spriteSize(AnimationType type);
+    void ensurePowerInfoPanel();
+    void ensurePCIInfoPanel();
+    void ensureWebcamPanel();
+    void ensureUsbInfoPanel();
     void setupPowerInfoPanel();
     void setupPCIInfoPanel();
     void setupWebcamPanel();
     void updateCameraOverlay();
     void activatePowerInfoPanel();
     void activatePCIInfoPanel();
+    void startPCIEnumeration();
+    void appendPCIRows(int begin, int end);
+    void updatePCIProgress(int value);
+    void finishPCIEnumeration();
+    void applyPCIDelta(const PciDelta &delta);
+    void updatePCIClassFilter(const QList<PCIDevice> &devices);
+    void filterPCIByClass();
     void activateWebcamPanel();
     void startGlassesAnimation(bool reverse);
     void toggleCamera();
     void clearPreviewWidget();
     QWidget *previewBlackOverlay;
-    QLabel *animationLabel;
-    QTimer *frameTimer;
-    QTimer *resetTimer;
-    QTimer *blinkTimer;
+    SceneWidget *animationLabel;
+    TimerScheduler *scheduler;
+    AnimationTimeline *timeline;
+    ScheduledTimer *resetTimer;
+    ScheduledTimer *blinkTimer;
     QList<UsbDevice> lastKnownDevices;
-    QStringList framePaths;
-    int currentFrame;
+    static constexpr int PrefetchLead = 4;
+    static constexpr int SadHoldMs = 2000;
+    static constexpr int MaxPciNameWidth = 290;
+    static constexpr int PciResizePrecision = 200;
+    QStringList frameNames;
+    FrameCache *frameCache;
+    AssetPack *assetPack;
+    MemoryPressureMonitor *memoryPressure;
     bool isEatAnimationInfinite;
     bool isPointerAnimationInfinite;
     bool lab1Activated;
     AnimationType currentAnimationType;
-    PowerMonitor *powerMonitor;
-    QWidget *powerInfoPanel;
+    PowerMonitor *powerMonitor = nullptr;
+    QWidget *powerInfoPanel = nullptr;
     QLabel *titleLabel;
     BatteryWidget *batteryWidget;
     QLabel *powerSourceLabel;
@@ -122,9 +179,22 @@ private:
     QWidget *pciInfoPanel=nullptr;
     QWidget *usbInfoPanel=nullptr;
     QTableWidget *usbTable;
-    QTableWidget *pciTable;
-    envirconfigPCI *pciMonitor;
-    webcamera *webcam;
+    QTableView *pciTable;
+    PciTableModel *pciModel = nullptr;
+    QSortFilterProxyModel *pciClassProxy = nullptr;
+    QComboBox *pciClassFilter = nullptr;
+    envirconfigPCI *pciMonitor = nullptr;
+    // Перечисление PCI в пуле потоков; пришедшие результаты сразу уходят в pciModel
+    QFutureWatcher<PCIDevice> *pciWatcher = nullptr;
+    QLabel *pciStatus = nullptr;
+    // true — первый обход, строки добавляются по мере прихода; иначе в конце применяются отличия
+    bool pciStreaming = true;
+    PciHotplugMonitor *pciHotplug = nullptr;
+    // Событие без адреса пришло при скрытой панели: при открытии нужен полный обход
+    bool pciRescanPending = false;
+    QElapsedTimer pciEnumerationClock;
+    qint64 pciEnumerationMs = -1;
+    webcamera *webcam = nullptr;
     UsbMonitor *usbMonitor;
     QWidget *webcamPanel=nullptr;
     QString *infoText;
@@ -135,7 +205,7 @@ private:
     QPushButton *stopVideoBtn;
     QPushButton *startHiddenBtn;
     QPushButton *toggleCameraBtn;
-    QTimer *surveillanceTimer;
+    ScheduledTimer *surveillanceTimer;
     QSystemTrayIcon *trayIcon;
     bool isHiddenMode;
     bool isStorage  = false;
@@ -143,5 +213,9 @@ private:
     bool isCameraOn;
     bool isGlassesAnimationRunning = false;
     bool wasCameraOn;
+    QElapsedTimer startupClock;
+    StartupStats startup;
 };
+
+QDebug operator<<(QDebug debug, const MainWindow::StartupStats &stats);
 #endif // MAINWINDOW_H
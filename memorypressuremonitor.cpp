@@ -0,0 +1,162 @@
+#include "memorypressuremonitor.h"
+#include <QDebug>
+#include <QFile>
+#include <QTimer>
+#if defined(Q_OS_LINUX)
+#include <QFileSystemWatcher>
+#include <QSocketNotifier>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(Q_OS_WIN)
+#include <QWinEventNotifier>
+#include <windows.h>
+#endif
+
+namespace {
+
+#if defined(Q_OS_LINUX)
+// Сигнал, если задачи ждали память суммарно 150 мс за окно в 2 с
+// (окно кратно 2 с — иначе триггер недоступен без root)
+const char PressureTrigger[] = "some 150000 2000000";
+#endif
+
+}
+
+MemoryPressureMonitor::MemoryPressureMonitor(QObject *parent) : QObject(parent)
+{
+#if defined(Q_OS_LINUX)
+    const bool stall = watchPressureStall();
+    const bool cgroup = watchCgroupHigh();
+    if (!stall && !cgroup) {
+        qDebug() << "Memory pressure notifications are not available";
+    }
+#elif defined(Q_OS_WIN)
+    if (!watchLowMemory()) {
+        qDebug() << "Memory pressure notifications are not available";
+    }
+#endif
+}
+
+MemoryPressureMonitor::~MemoryPressureMonitor()
+{
+#if defined(Q_OS_LINUX)
+    delete pressureNotifier;
+    if (pressureFd >= 0) {
+        ::close(pressureFd);
+    }
+#elif defined(Q_OS_WIN)
+    delete lowMemoryNotifier;
+    if (lowMemoryHandle) {
+        CloseHandle(lowMemoryHandle);
+    }
+#endif
+}
+
+bool MemoryPressureMonitor::isWatching() const
+{
+#if defined(Q_OS_LINUX)
+    return pressureNotifier || cgroupWatcher;
+#elif defined(Q_OS_WIN)
+    return lowMemoryNotifier;
+#else
+    return false;
+#endif
+}
+
+quint64 MemoryPressureMonitor::events() const
+{
+    return eventCount;
+}
+
+void MemoryPressureMonitor::report()
+{
+    if (lastReport.isValid() && lastReport.elapsed() < CooldownMs) {
+        return;
+    }
+    lastReport.start();
+    ++eventCount;
+    emit memoryPressure();
+}
+
+#if defined(Q_OS_LINUX)
+bool MemoryPressureMonitor::watchPressureStall()
+{
+    pressureFd = ::open("/proc/pressure/memory", O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (pressureFd < 0) {
+        return false;
+    }
+    // Триггер живёт, пока открыт дескриптор; срабатывание приходит как POLLPRI
+    if (::write(pressureFd, PressureTrigger, sizeof(PressureTrigger)) < 0) {
+        ::close(pressureFd);
+        pressureFd = -1;
+        return false;
+    }
+    pressureNotifier = new QSocketNotifier(pressureFd, QSocketNotifier::Exception);
+    connect(pressureNotifier, &QSocketNotifier::activated, this, &MemoryPressureMonitor::report);
+    return true;
+}
+
+bool MemoryPressureMonitor::watchCgroupHigh()
+{
+    // В cgroup v2 строка /proc/self/cgroup одна: "0::/путь"
+    QFile cgroup("/proc/self/cgroup");
+    if (!cgroup.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QString path;
+    for (const QByteArray &line : cgroup.readAll().split('\n')) {
+        if (line.startsWith("0::")) {
+            path = QString::fromUtf8(line.mid(3));
+            break;
+        }
+    }
+    if (path.isEmpty()) {
+        return false;
+    }
+    cgroupEventsPath = "/sys/fs/cgroup" + path + "/memory.events";
+    highEvents = readHighEvents(cgroupEventsPath);
+    if (highEvents < 0) {
+        return false;
+    }
+    // Ядро помечает memory.events изменённым при каждом новом событии
+    cgroupWatcher = new QFileSystemWatcher({cgroupEventsPath}, this);
+    connect(cgroupWatcher, &QFileSystemWatcher::fileChanged, this, [this]() {
+        const qint64 current = readHighEvents(cgroupEventsPath);
+        if (current > highEvents) {
+            highEvents = current;
+            report();
+        }
+    });
+    return true;
+}
+
+qint64 MemoryPressureMonitor::readHighEvents(const QString &eventsPath)
+{
+    QFile events(eventsPath);
+    if (!events.open(QIODevice::ReadOnly)) {
+        return -1;
+    }
+    for (const QByteArray &line : events.readAll().split('\n')) {
+        if (line.startsWith("high ")) {
+            return line.mid(5).trimmed().toLongLong();
+        }
+    }
+    return -1;
+}
+#elif defined(Q_OS_WIN)
+bool MemoryPressureMonitor::watchLowMemory()
+{
+    lowMemoryHandle = CreateMemoryResourceNotification(LowMemoryResourceNotification);
+    if (!lowMemoryHandle) {
+        return false;
+    }
+    // Событие остаётся взведённым, пока памяти мало, поэтому на время паузы уведомление выключается
+    lowMemoryNotifier = new QWinEventNotifier(lowMemoryHandle);
+    connect(lowMemoryNotifier, &QWinEventNotifier::activated, this, [this]() {
+        lowMemoryNotifier->setEnabled(false);
+        report();
+        QTimer::singleShot(CooldownMs, this, [this]() { lowMemoryNotifier->setEnabled(true); });
+    });
+    return true;
+}
+#endif
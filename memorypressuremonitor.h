@@ -0,0 +1,54 @@
+#ifndef MEMORYPRESSUREMONITOR_H
+#define MEMORYPRESSUREMONITOR_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QString>
+
+class QFileSystemWatcher;
+class QSocketNotifier;
+class QWinEventNotifier;
+
+// Сообщает о нехватке памяти в системе, чтобы кэши успели её отдать.
+// Linux: триггер PSI (/proc/pressure/memory) и превышение memory.high
+// своей cgroup v2 (счётчик high в memory.events). Windows: системное
+// уведомление LowMemoryResourceNotification. Сигналы идут не чаще раза
+// в CooldownMs.
+class MemoryPressureMonitor : public QObject {
+    Q_OBJECT
+public:
+    explicit MemoryPressureMonitor(QObject *parent = nullptr);
+    ~MemoryPressureMonitor();
+
+    bool isWatching() const;
+    quint64 events() const;
+
+signals:
+    void memoryPressure();
+
+private:
+    static constexpr int CooldownMs = 5000;
+
+    void report();
+#if defined(Q_OS_LINUX)
+    bool watchPressureStall();
+    bool watchCgroupHigh();
+    static qint64 readHighEvents(const QString &eventsPath);
+
+    int pressureFd = -1;
+    QSocketNotifier *pressureNotifier = nullptr;
+    QFileSystemWatcher *cgroupWatcher = nullptr;
+    QString cgroupEventsPath;
+    qint64 highEvents = 0;
+#elif defined(Q_OS_WIN)
+    bool watchLowMemory();
+
+    void *lowMemoryHandle = nullptr;
+    QWinEventNotifier *lowMemoryNotifier = nullptr;
+#endif
+
+    QElapsedTimer lastReport;
+    quint64 eventCount = 0;
+};
+
+#endif // MEMORYPRESSUREMONITOR_H
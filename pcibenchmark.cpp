@@ -0,0 +1,281 @@
+#include "pcibenchmark.h"
+#include "envirconfigpci.h"
+#include "idsdatabase.h"
+#include "pcicodes.h"
+#include "pcidb.h"
+#include "pcihwid.h"
+#include "pcitablemodel.h"
+#include "tests/common/pciidsfixture.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFontMetrics>
+#include <QHeaderView>
+#include <QRandomGenerator>
+#include <QTableView>
+#include <QTableWidget>
+#include <cstring>
+#include <regex>
+#include <string>
+#include <vector>
+
+PciBenchmark::PciBenchmark(QTextStream &out, int rounds)
+    : out(out), rounds(qMax(2, rounds))
+{
+}
+
+void PciBenchmark::run()
+{
+    BenchmarkStats::report(out, "hardware IDs x10000 (regex)", measureHardwareIds(true));
+    BenchmarkStats::report(out, "hardware IDs x10000 (parser)", measureHardwareIds(false));
+    BenchmarkStats::report(out, "pci.ids open (build index)", measureIdsOpen(false));
+    BenchmarkStats::report(out, "pci.ids open (cached index)", measureIdsOpen(true));
+    BenchmarkStats::report(out, "pci.ids lookups x10000", measureIdsLookups());
+    BenchmarkStats::report(out, "PCI enumeration", measurePciEnumeration());
+    BenchmarkStats::report(out, "PCI table x10000 (items)", measurePciTable(false));
+    BenchmarkStats::report(out, "PCI table x10000 (model)", measurePciTable(true));
+}
+
+QString PciBenchmark::idsFile()
+{
+    // pci.ids из встроенных таблиц, один на все замеры
+    const QString path = scratch.filePath("pci.ids");
+    if (QFile::exists(path)) {
+        return path;
+    }
+    const QByteArray text = pciIdsFromBuiltinTables();
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly) || file.write(text) != text.size()) {
+        out << "cannot write " << path << Qt::endl;
+    }
+    return path;
+}
+
+QList<QByteArray> PciBenchmark::syntheticHardwareIds()
+{
+    // Как у SetupDiGetClassDevs со всеми классами: среди PCI попадаются USB, ACPI и корневые устройства
+    QList<QByteArray> devices;
+    QRandomGenerator random(18);
+    for (int i = 0; i < HardwareIdDevices; ++i) {
+        const quint32 vendor = random.bounded(0x10000);
+        const quint32 device = random.bounded(0x10000);
+        QByteArray ids;
+        switch (i % 4) {
+        case 0:
+        case 1:
+            ids += QString::asprintf("PCI\\VEN_%04X&DEV_%04X&SUBSYS_%08X&REV_%02X", vendor, device,
+                                     random.generate(), random.bounded(0x100)).toLatin1() + '\0';
+            ids += QString::asprintf("PCI\\VEN_%04X&DEV_%04X&SUBSYS_%08X", vendor, device, random.generate())
+                       .toLatin1() + '\0';
+            ids += QString::asprintf("PCI\\VEN_%04X&DEV_%04X", vendor, device).toLatin1() + '\0';
+            break;
+        case 2:
+            ids += QString::asprintf("USB\\VID_%04X&PID_%04X&REV_%04X", vendor, device, random.bounded(0x10000))
+                       .toLatin1() + '\0';
+            ids += QString::asprintf("USB\\VID_%04X&PID_%04X", vendor, device).toLatin1() + '\0';
+            break;
+        default:
+            ids += QByteArray("ACPI\\PNP0C0A") + '\0';
+            ids += QByteArray("*PNP0C0A") + '\0';
+            break;
+        }
+        ids += '\0';
+        devices.append(ids);
+    }
+    return devices;
+}
+
+BenchmarkSamples PciBenchmark::measureHardwareIds(bool regex)
+{
+    // Один проход — все устройства; прежний путь повторяет старый цикл getPCIDevices целиком
+    BenchmarkSamples samples;
+    const QList<QByteArray> devices = syntheticHardwareIds();
+    QElapsedTimer timer;
+    quint64 allocationsBefore = 0;
+    int found = 0;
+    for (int round = 0; round <= rounds; ++round) {
+        if (round == 1) {
+            allocationsBefore = BenchmarkStats::allocations();
+        }
+        timer.start();
+        for (const QByteArray &ids : devices) {
+            if (regex) {
+                std::vector<char> buffer(4096);
+                std::memcpy(buffer.data(), ids.constData(), size_t(ids.size()));
+                std::vector<std::string> hwids;
+                for (size_t i = 0; i < buffer.size() && buffer[i] != '\0';) {
+                    hwids.emplace_back(&buffer[i]);
+                    i += hwids.back().size() + 1;
+                }
+                std::regex pciRe(R"(PCI\\VEN_([0-9A-Fa-f]{4})&DEV_([0-9A-Fa-f]{4}))");
+                for (const std::string &id : hwids) {
+                    std::smatch match;
+                    if (std::regex_search(id, match, pciRe)) {
+                        ++found;
+                        break;
+                    }
+                }
+            } else {
+                PciHardwareId hwid;
+                if (findPciHardwareId(ids.constData(), size_t(ids.size()), hwid)) {
+                    ++found;
+                }
+            }
+        }
+        (round == 0 ? samples.cold : samples.warm) << timer.nsecsElapsed();
+    }
+    // В столбце выделений — на одно устройство
+    samples.warmAllocations = (BenchmarkStats::allocations() - allocationsBefore) / HardwareIdDevices;
+    Q_UNUSED(found);
+    return samples;
+}
+
+BenchmarkSamples PciBenchmark::measureIdsOpen(bool cachedIndex)
+{
+    BenchmarkSamples samples;
+    const QString path = idsFile();
+    if (cachedIndex) {
+        IdsDatabase warmup;
+        warmup.open(path);
+    }
+    QElapsedTimer timer;
+    quint64 allocationsBefore = 0;
+    for (int round = 0; round <= rounds; ++round) {
+        if (!cachedIndex) {
+            QFile::remove(path + ".idx");
+        }
+        if (round == 1) {
+            allocationsBefore = BenchmarkStats::allocations();
+        }
+        timer.start();
+        IdsDatabase database;
+        database.open(path);
+        (round == 0 ? samples.cold : samples.warm) << timer.nsecsElapsed();
+    }
+    samples.warmAllocations = (BenchmarkStats::allocations() - allocationsBefore) / rounds;
+    return samples;
+}
+
+BenchmarkSamples PciBenchmark::measureIdsLookups()
+{
+    // Половина ключей есть в базе, половина — случайные
+    BenchmarkSamples samples;
+    IdsDatabase database;
+    database.open(idsFile());
+    QList<quint32> keys;
+    QRandomGenerator random(22);
+    for (int i = 0; i < IdsLookups; ++i) {
+        keys << (i % 2 ? PciDeviceRecords[random.bounded(int(std::size(PciDeviceRecords)))].key : random.generate());
+    }
+    QElapsedTimer timer;
+    quint64 allocationsBefore = 0;
+    qsizetype found = 0;
+    for (int round = 0; round <= rounds; ++round) {
+        if (round == 1) {
+            allocationsBefore = BenchmarkStats::allocations();
+        }
+        timer.start();
+        for (quint32 key : std::as_const(keys)) {
+            found += database.deviceName(quint16(key >> 16), quint16(key)).size();
+        }
+        (round == 0 ? samples.cold : samples.warm) << timer.nsecsElapsed();
+    }
+    // В столбце выделений — на один поиск
+    samples.warmAllocations = (BenchmarkStats::allocations() - allocationsBefore) / (quint64(rounds) * IdsLookups);
+    Q_UNUSED(found);
+    return samples;
+}
+
+BenchmarkSamples PciBenchmark::measurePciEnumeration()
+{
+    // Тот же путь, что у панели PCI, только без пула потоков; первый проход — с холодным кэшем sysfs и pci.ids
+    BenchmarkSamples samples;
+    envirconfigPCI monitor;
+    QElapsedTimer timer;
+    quint64 allocationsBefore = 0;
+    qsizetype devices = 0;
+    for (int round = 0; round <= rounds; ++round) {
+        if (round == 1) {
+            allocationsBefore = BenchmarkStats::allocations();
+        }
+        timer.start();
+        devices = monitor.getPCIDevices().size();
+        (round == 0 ? samples.cold : samples.warm) << timer.nsecsElapsed();
+    }
+    // В столбце выделений — на одно устройство
+    samples.warmAllocations = (BenchmarkStats::allocations() - allocationsBefore) / (quint64(rounds) * qMax<qsizetype>(1, devices));
+    out << "PCI enumeration: " << devices << " devices" << Qt::endl;
+    return samples;
+}
+
+BenchmarkSamples PciBenchmark::measurePciTable(bool model)
+{
+    // cold — заполнение таблицы, warm — шаги перетаскивания границы столбца названий с перерисовкой
+    QList<PCIDevice> devices;
+    for (int i = 0; i < PciTableRows; ++i) {
+        // Хост с SR-IOV: тысячи виртуальных функций одного адаптера
+        PCIDevice dev;
+        dev.vendorID = "15B3";
+        dev.deviceID = "101E";
+        dev.classCode = 0x020000;
+        dev.friendlyName = "Mellanox Technologies ConnectX Family mlx5Gen Virtual Function #" + QString::number(i);
+        dev.instanceID = QString::asprintf("0000:%02x:%02x.%x", 0x3b + i / 2048, (i / 8) % 256, i % 8);
+        devices.append(dev);
+    }
+
+    BenchmarkSamples samples;
+    QElapsedTimer timer;
+    QTableView *view = model ? new QTableView : new QTableWidget;
+    view->setFixedSize(720, 500);
+    view->verticalHeader()->setVisible(false);
+    view->setWordWrap(false);
+    timer.start();
+    if (model) {
+        PciTableModel *tableModel = new PciTableModel(view);
+        view->setModel(tableModel);
+        view->setItemDelegateForColumn(PciTableModel::NameColumn, new PciElideDelegate(290, view));
+        view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        tableModel->append(devices);
+    } else {
+        // Прежний activatePCIInfoPanel: пять QTableWidgetItem на строку и обрезка каждого названия
+        QTableWidget *table = static_cast<QTableWidget *>(view);
+        table->setColumnCount(PciTableModel::ColumnCount);
+        table->setRowCount(int(devices.size()));
+        const QFontMetrics metrics(QFont("Arial", 14));
+        for (int i = 0; i < devices.size(); ++i) {
+            table->setItem(i, 0, new QTableWidgetItem(QString::number(i + 1)));
+            table->setItem(i, 1, new QTableWidgetItem(devices[i].vendorID));
+            table->setItem(i, 2, new QTableWidgetItem(devices[i].deviceID));
+            const QString name = metrics.elidedText(devices[i].friendlyName, Qt::ElideRight, 290);
+            QTableWidgetItem *nameItem = new QTableWidgetItem(name);
+            nameItem->setData(Qt::UserRole, devices[i].friendlyName);
+            table->setItem(i, 3, nameItem);
+            table->setItem(i, 4, new QTableWidgetItem(devices[i].instanceID));
+        }
+        QObject::connect(table->horizontalHeader(), &QHeaderView::sectionResized, table,
+                         [table](int logicalIndex, int newSize) {
+            if (logicalIndex != 3) return;
+            QFontMetrics metrics(table->font());
+            for (int row = 0; row < table->rowCount(); ++row) {
+                QTableWidgetItem *item = table->item(row, 3);
+                if (!item) continue;
+                item->setText(metrics.elidedText(item->data(Qt::UserRole).toString(), Qt::ElideRight, newSize - 10));
+            }
+        });
+    }
+    view->show();
+    view->viewport()->repaint();
+    samples.cold << timer.nsecsElapsed();
+
+    const quint64 allocationsBefore = BenchmarkStats::allocations();
+    for (int i = 0; i < ColumnDragSteps * rounds; ++i) {
+        // Граница ходит туда и обратно по пикселю, как при перетаскивании мышью
+        const int step = i % (2 * ColumnDragSteps);
+        timer.start();
+        view->setColumnWidth(3, 200 + (step < ColumnDragSteps ? step : 2 * ColumnDragSteps - step));
+        view->viewport()->repaint();
+        samples.warm << timer.nsecsElapsed();
+    }
+    samples.warmAllocations = (BenchmarkStats::allocations() - allocationsBefore) / (quint64(ColumnDragSteps) * rounds);
+    delete view;
+    return samples;
+}
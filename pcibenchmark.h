@@ -0,0 +1,42 @@
+#ifndef PCIBENCHMARK_H
+#define PCIBENCHMARK_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include "benchmarkstats.h"
+
+// Замеры панели PCI: разбор ID оборудования (прежний std::regex и
+// parsePciHardwareId на десяти тысячах синтетических устройств), открытие
+// pci.ids с построением индекса и с готовым индексом, поиск названий,
+// перечисление устройств той машины, где идёт замер, и таблица на десяти
+// тысячах строк — прежний QTableWidget против PciTableModel с делегатом.
+// Правильность разбора и поиска проверяют тесты в tests/.
+class PciBenchmark {
+public:
+    PciBenchmark(QTextStream &out, int rounds);
+
+    void run();
+
+private:
+    static constexpr int HardwareIdDevices = 10000;
+    static constexpr int IdsLookups = 10000;
+    static constexpr int PciTableRows = 10000;
+    static constexpr int ColumnDragSteps = 40;
+
+    BenchmarkSamples measureHardwareIds(bool regex);
+    BenchmarkSamples measureIdsOpen(bool cachedIndex);
+    BenchmarkSamples measureIdsLookups();
+    BenchmarkSamples measurePciEnumeration();
+    BenchmarkSamples measurePciTable(bool model);
+    QString idsFile();
+    static QList<QByteArray> syntheticHardwareIds();
+
+    QTextStream &out;
+    int rounds;
+    QTemporaryDir scratch;
+};
+
+#endif // PCIBENCHMARK_H
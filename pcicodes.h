@@ -0,0 +1,13830 @@
+// Generated by tools/pci_codes_gen.py from the legacy pci_codes.h, do not edit.
+// Names live in one UTF-8 string pool; records hold only IDs and pool offsets,
+// so the tables are relocation-free .rodata.
+#ifndef PCICODES_H
+#define PCICODES_H
+
+#include <QtGlobal>
+
+struct PciVendorRecord {
+    quint16 venId;
+    quint32 shortName;
+    quint32 fullName;
+};
+
+struct PciDeviceRecord {
+    quint32 key;        // VenId << 16 | DevId
+    quint32 chip;
+    quint32 chipDesc;
+};
+
+struct PciClassRecord {
+    quint8 baseClass;
+    quint8 subClass;
+    quint8 progIf;
+    quint32 baseDesc;
+    quint32 subDesc;
+    quint32 progDesc;
+};
+
+inline constexpr char PciStringPool[148513] = {
+    0,80,97,114,97,100,121,110,101,32,67,111,114,112,46,0,119,101,108,108,
+    0,109,97,115,116,101,114,0,72,97,117,112,112,97,117,103,101,49,0,72,
+    97,117,112,112,97,117,103,101,32,67,111,109,112,117,116,101,114,32,87,111,
+    114,107,115,32,73,110,99,46,0,65,108,97,110,0,78,99,105,112,104,101,
+    114,32,67,111,114,112,46,32,76,116,100,0,71,101,110,101,114,97,108,32,
+    68,121,110,97,109,105,99,115,0,83,75,32,45,32,69,108,101,99,116,114,
+    111,110,105,99,115,32,67,111,46,44,32,76,116,100,46,0,66,82,69,65,
+    0,66,82,69,65,32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,
+    110,99,46,0,67,111,109,112,97,113,0,67,111,109,112,97,113,32,67,111,
+    109,112,117,116,101,114,32,67,111,114,112,46,0,76,83,73,0,76,83,73,
+    32,76,111,103,105,99,32,53,51,67,56,49,48,32,68,101,118,105,99,101,
+    0,75,79,76,84,69,82,0,75,111,108,116,101,114,32,69,108,101,99,116,
+    114,111,110,105,99,32,45,32,71,101,114,109,97,110,121,0,65,84,73,0,
+    85,76,83,73,0,86,76,83,73,0,86,76,83,73,32,84,101,99,104,110,
+    111,108,111,103,121,0,82,101,112,108,121,0,82,101,112,108,121,32,71,114,
+    111,117,112,0,78,101,116,70,114,97,109,101,0,78,101,116,102,114,97,109,
+    101,32,83,121,115,116,101,109,115,32,73,110,99,46,0,69,112,115,111,110,
+    0,80,104,111,101,110,105,120,0,80,104,111,101,110,105,120,32,84,101,99,
+    104,110,111,108,111,103,105,101,115,32,76,116,100,46,0,78,83,67,0,78,
+    97,116,105,111,110,97,108,32,83,101,109,105,99,111,110,100,117,99,116,111,
+    114,115,0,84,115,101,110,103,0,84,115,101,110,103,32,76,97,98,115,0,
+    65,83,84,0,65,83,84,32,82,101,115,101,97,114,99,104,0,87,101,105,
+    116,101,107,0,86,76,111,103,105,99,0,86,105,100,101,111,32,76,111,103,
+    105,99,32,76,116,100,46,0,68,69,67,0,68,105,103,105,116,97,108,32,
+    69,113,117,105,112,109,101,110,116,32,67,111,114,112,111,114,97,116,105,111,
+    110,0,77,105,99,114,111,110,105,99,115,0,77,105,99,114,111,110,105,99,
+    115,32,67,111,109,112,117,116,101,114,115,32,73,110,99,46,0,67,105,114,
+    114,117,115,0,67,105,114,114,117,115,32,76,111,103,105,99,0,73,66,77,
+    0,73,110,116,101,114,110,97,116,105,111,110,97,108,32,66,117,115,105,110,
+    101,115,115,32,77,97,99,104,105,110,101,115,32,67,111,114,112,46,0,70,
+    117,106,105,116,115,117,32,73,67,76,0,70,117,106,105,116,115,117,32,73,
+    67,76,32,67,111,109,112,117,116,101,114,115,0,83,112,101,97,0,83,112,
+    101,97,32,83,111,102,116,119,97,114,101,32,65,71,0,85,110,105,115,121,
+    115,0,85,110,105,115,121,115,32,83,121,115,116,101,109,115,0,69,67,83,
+    0,69,108,105,116,101,103,114,111,117,112,32,67,111,109,112,117,116,101,114,
+    32,83,121,115,116,101,109,0,78,67,82,0,78,67,82,32,67,111,114,112,
+    111,114,97,116,105,111,110,0,86,105,116,101,115,115,101,0,86,105,116,101,
+    115,115,101,32,83,101,109,105,99,111,110,100,117,99,116,111,114,0,65,77,
+    73,0,65,109,101,114,105,99,97,110,32,77,101,103,97,116,114,101,110,100,
+    115,32,73,110,99,46,0,80,105,99,116,117,114,101,84,101,108,0,80,105,
+    99,116,117,114,101,84,101,108,32,67,111,114,112,46,0,72,105,116,97,99,
+    104,105,0,72,105,116,97,99,104,105,32,67,111,109,112,117,116,101,114,32,
+    69,108,101,99,116,114,111,110,105,99,115,0,79,75,73,0,79,107,105,32,
+    69,108,101,99,116,114,105,99,32,73,110,100,117,115,116,114,121,0,65,77,
+    68,0,65,100,118,97,110,99,101,100,32,77,105,99,114,111,32,68,101,118,
+    105,99,101,115,0,109,97,99,104,100,111,0,84,82,73,68,69,78,84,32,
+    77,73,67,82,79,0,65,99,101,114,0,65,99,101,114,32,73,110,99,111,
+    114,112,111,114,97,116,101,100,0,68,101,108,108,0,68,101,108,108,32,67,
+    111,109,112,117,116,101,114,32,67,111,114,112,111,114,97,116,105,111,110,0,
+    76,83,73,32,76,111,103,105,99,32,72,101,97,100,108,97,110,100,32,68,
+    105,118,105,115,105,111,110,0,77,97,116,114,111,120,0,77,97,116,114,111,
+    120,32,69,108,101,99,116,114,111,110,105,99,32,83,121,115,116,101,109,115,
+    32,76,116,100,46,0,67,38,97,109,112,59,84,0,65,115,105,108,105,97,
+    110,116,32,40,67,104,105,112,115,32,65,110,100,32,84,101,99,104,110,111,
+    108,111,103,105,101,115,41,0,87,121,115,101,0,87,121,115,101,32,84,101,
+    99,104,110,111,108,111,103,105,101,115,0,79,108,105,118,101,116,116,105,0,
+    79,108,105,118,101,116,116,105,32,65,100,118,97,110,99,101,100,32,84,101,
+    99,104,110,111,108,111,103,121,0,84,111,115,104,105,98,97,0,84,111,115,
+    104,105,98,97,32,65,109,101,114,105,99,97,0,84,77,67,0,84,77,67,
+    32,82,101,115,101,97,114,99,104,0,109,105,114,111,0,109,105,114,111,32,
+    67,111,109,112,117,116,101,114,32,80,114,111,100,117,99,116,115,32,65,71,
+    0,78,69,67,0,78,69,67,32,69,108,101,99,116,114,111,110,105,99,115,
+    0,66,117,114,110,100,121,0,66,117,114,110,100,121,32,67,111,114,112,111,
+    114,97,116,105,111,110,0,70,68,111,109,97,105,110,0,70,117,116,117,114,
+    101,32,68,111,109,97,105,110,0,72,105,116,97,99,104,105,32,77,105,99,
+    114,111,32,83,121,115,116,101,109,115,32,73,110,99,0,65,77,80,0,65,
+    77,80,32,73,110,99,111,114,112,111,114,97,116,101,100,0,83,105,83,0,
+    83,105,108,105,99,111,110,32,73,110,116,101,103,114,97,116,101,100,32,83,
+    121,115,116,101,109,115,0,83,101,105,107,111,0,83,101,105,107,111,32,69,
+    112,115,111,110,32,67,111,114,112,111,114,97,116,105,111,110,0,84,97,116,
+    117,110,103,0,84,97,116,117,110,103,32,67,111,114,112,46,32,79,102,32,
+    65,109,101,114,105,99,97,0,72,80,0,72,101,119,108,101,116,116,45,80,
+    97,99,107,97,114,100,32,67,111,109,112,97,110,121,0,83,111,108,108,105,
+    100,97,121,0,83,111,108,108,105,100,97,121,32,69,110,103,105,110,101,101,
+    114,105,110,103,0,76,111,103,105,99,32,77,111,100,46,0,76,111,103,105,
+    99,32,77,111,100,101,108,105,110,103,0,67,111,109,112,117,116,114,101,110,
+    100,0,65,115,117,115,116,101,107,0,65,115,117,115,116,101,107,32,67,111,
+    109,112,117,116,101,114,32,73,110,99,46,0,68,80,84,0,68,105,115,116,
+    114,105,98,117,116,101,100,32,80,114,111,99,101,115,115,105,110,103,32,84,
+    101,99,104,0,79,80,84,105,0,79,80,84,105,32,73,110,99,46,0,73,
+    80,67,0,73,80,67,32,67,111,114,112,111,114,97,116,105,111,110,32,76,
+    84,68,0,71,101,110,111,97,0,71,101,110,111,97,32,83,121,115,116,101,
+    109,115,32,67,111,114,112,46,0,69,76,83,65,0,69,76,83,65,32,71,
+    109,98,72,0,70,111,117,110,116,97,105,110,0,70,111,117,110,116,97,105,
+    110,32,84,101,99,104,110,111,108,111,103,121,0,83,84,77,0,83,84,77,
+    105,99,114,111,101,108,101,99,116,114,111,110,105,99,115,0,77,121,108,101,
+    120,32,47,32,66,117,115,108,111,103,105,99,0,84,73,0,84,101,120,97,
+    115,32,73,110,115,116,114,117,109,101,110,116,115,0,83,111,110,121,0,83,
+    111,110,121,32,67,111,114,112,111,114,97,116,105,111,110,0,79,97,107,0,
+    79,97,107,32,84,101,99,104,110,111,108,111,103,121,0,67,111,45,84,105,
+    109,101,0,67,111,45,84,105,109,101,32,67,111,109,112,117,116,101,114,32,
+    76,116,100,46,0,87,105,110,98,111,110,100,0,87,105,110,98,111,110,100,
+    32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,114,112,46,0,65,
+    110,105,103,109,97,0,65,110,105,103,109,97,32,67,111,114,112,46,0,89,
+    111,117,110,103,0,89,111,117,110,103,32,77,105,99,114,111,32,83,121,115,
+    116,101,109,115,0,72,105,116,97,99,104,105,32,76,116,100,0,83,77,83,
+    67,0,83,116,97,110,100,97,114,100,32,77,105,99,114,111,115,121,115,116,
+    101,109,115,32,67,111,114,112,46,0,73,67,76,0,77,111,116,111,114,111,
+    108,97,0,69,38,97,109,112,59,84,82,0,69,108,101,99,116,114,111,110,
+    105,99,115,32,38,97,109,112,59,32,84,101,108,101,99,111,109,109,117,110,
+    105,99,97,116,105,111,110,32,82,101,115,0,75,111,110,116,114,111,110,0,
+    75,111,110,116,114,111,110,32,67,97,110,97,100,97,0,80,114,111,109,105,
+    115,101,0,80,114,111,109,105,115,101,32,84,101,99,104,110,111,108,111,103,
+    121,0,70,111,120,99,111,110,110,0,70,111,120,99,111,110,110,32,73,110,
+    116,101,114,110,97,116,105,111,110,97,108,32,73,110,99,46,0,87,105,112,
+    114,111,0,87,105,112,114,111,32,73,110,102,111,116,101,99,104,32,76,105,
+    109,105,116,101,100,0,78,117,109,98,101,114,45,78,105,110,101,0,78,117,
+    109,98,101,114,32,78,105,110,101,32,86,105,115,117,97,108,32,84,101,99,
+    104,110,111,108,111,103,121,0,86,116,101,99,104,0,86,116,101,99,104,32,
+    69,110,103,105,110,101,101,114,105,110,103,32,67,97,110,97,100,97,32,76,
+    116,100,46,0,73,110,102,111,116,114,111,110,105,99,0,73,110,102,111,116,
+    114,111,110,105,99,32,65,109,101,114,105,99,97,32,73,110,99,46,0,85,
+    77,67,0,85,110,105,116,101,100,32,77,105,99,114,111,101,108,101,99,116,
+    114,111,110,105,99,115,0,56,120,56,0,56,120,56,32,73,110,99,46,0,
+    77,97,115,112,97,114,0,77,97,115,112,97,114,32,67,111,109,112,117,116,
+    101,114,32,67,111,114,112,46,0,79,79,65,0,79,99,101,97,110,32,79,
+    102,102,105,99,101,32,65,117,116,111,109,97,116,105,111,110,0,65,108,99,
+    97,116,101,108,0,65,108,99,97,116,101,108,32,67,105,116,0,84,77,0,
+    84,101,120,97,115,32,77,105,99,114,111,115,121,115,116,101,109,115,0,80,
+    105,99,111,112,111,119,101,114,0,80,105,99,111,112,111,119,101,114,32,84,
+    101,99,104,110,111,108,111,103,121,0,77,105,116,115,117,98,105,115,104,105,
+    0,77,105,116,115,117,98,105,115,104,105,32,69,108,101,99,116,114,111,110,
+    105,99,115,0,68,105,118,46,32,84,101,99,104,46,0,68,105,118,101,114,
+    115,105,102,105,101,100,32,84,101,99,104,110,111,108,111,103,121,0,65,116,
+    101,110,0,65,116,101,110,32,82,101,115,101,97,114,99,104,32,73,110,99,
+    46,0,65,112,112,108,101,0,65,112,112,108,101,32,67,111,109,112,117,116,
+    101,114,32,73,110,99,46,0,72,121,117,110,100,97,105,0,72,121,117,110,
+    100,97,105,32,69,108,101,99,116,114,111,110,105,99,115,32,65,109,101,114,
+    105,99,97,0,83,101,113,117,101,110,116,0,83,101,113,117,101,110,116,32,
+    67,111,109,112,117,116,101,114,32,83,121,115,116,101,109,115,0,68,70,73,
+    0,68,70,73,32,73,110,99,46,0,67,105,116,121,71,97,116,101,0,67,
+    105,116,121,32,71,97,116,101,32,68,101,118,101,108,111,112,109,101,110,116,
+    32,76,84,68,0,68,97,101,119,111,111,0,68,97,101,119,111,111,32,84,
+    101,108,101,99,111,109,32,76,116,100,46,0,77,105,116,97,99,0,71,73,
+    84,0,71,73,84,32,67,111,46,32,76,116,100,46,0,89,97,109,97,104,
+    97,0,89,97,109,97,104,97,32,67,111,114,112,111,114,97,116,105,111,110,
+    0,78,101,120,103,101,110,0,78,101,120,103,101,110,32,77,105,99,114,111,
+    115,121,115,116,101,109,115,0,65,73,82,0,65,100,118,97,110,99,101,100,
+    32,73,110,116,101,103,114,97,116,105,111,110,32,82,101,115,101,97,114,99,
+    104,0,81,76,111,103,105,99,0,81,76,111,103,105,99,32,67,111,114,112,
+    111,114,97,116,105,111,110,0,67,121,114,105,120,0,67,121,114,105,120,32,
+    67,111,114,112,111,114,97,116,105,111,110,0,73,45,66,117,115,0,78,101,
+    116,119,111,114,116,104,0,71,97,116,101,119,97,121,0,71,97,116,101,119,
+    97,121,32,50,48,48,48,0,71,111,108,100,115,116,97,114,0,71,111,108,
+    100,115,116,97,114,32,67,111,46,32,76,116,100,46,0,76,101,97,100,116,
+    101,107,0,76,101,97,100,116,101,107,32,82,101,115,101,97,114,99,104,0,
+    73,110,116,101,114,112,104,97,115,101,0,84,101,115,116,101,114,110,101,99,
+    0,68,84,67,0,68,97,116,97,32,84,101,99,104,110,111,108,111,103,121,
+    32,67,111,114,112,111,114,97,116,105,111,110,0,67,121,112,114,101,115,115,
+    0,67,121,112,114,101,115,115,32,83,101,109,105,99,111,110,100,117,99,116,
+    111,114,0,82,97,100,105,117,115,32,73,110,99,46,0,69,70,65,0,69,
+    70,65,32,67,111,114,112,111,114,97,116,105,111,110,32,79,102,32,65,109,
+    101,114,105,99,97,0,70,111,114,101,120,0,70,111,114,101,120,32,67,111,
+    109,112,117,116,101,114,32,67,111,114,112,111,114,97,116,105,111,110,0,80,
+    97,114,97,100,111,114,0,84,117,108,105,112,0,84,117,108,105,112,32,67,
+    111,109,112,117,116,101,114,115,32,73,110,116,39,108,32,66,86,0,74,46,
+    32,66,111,110,100,0,74,46,32,66,111,110,100,32,67,111,109,112,117,116,
+    101,114,32,83,121,115,116,101,109,115,0,67,97,99,104,101,0,67,97,99,
+    104,101,32,67,111,109,112,117,116,101,114,0,77,83,32,83,111,110,46,0,
+    77,105,99,114,111,99,111,109,112,117,116,101,114,32,83,121,115,116,101,109,
+    115,32,40,77,41,32,83,111,110,0,68,71,0,68,97,116,97,32,71,101,
+    110,101,114,97,108,32,67,111,114,112,111,114,97,116,105,111,110,0,66,105,
+    116,51,0,83,66,83,32,32,79,112,101,114,97,116,105,111,110,115,0,79,
+    97,107,108,101,105,103,104,0,79,97,107,108,101,105,103,104,32,83,121,115,
+    116,101,109,115,32,73,110,99,46,0,79,108,105,99,111,109,0,83,117,110,
+    0,83,117,110,32,77,105,99,114,111,115,121,115,116,101,109,115,0,83,121,
+    115,116,101,109,115,111,102,116,0,83,121,115,116,101,109,115,111,102,116,32,
+    67,111,114,112,111,114,97,116,105,111,110,0,69,110,99,111,114,101,0,69,
+    110,99,111,114,101,32,67,111,109,112,117,116,101,114,32,67,111,114,112,111,
+    114,97,116,105,111,110,0,73,110,116,101,114,103,114,97,112,104,0,73,110,
+    116,101,114,103,114,97,112,104,32,67,111,114,112,111,114,97,116,105,111,110,
+    0,68,105,97,109,111,110,100,0,68,105,97,109,111,110,100,32,67,111,109,
+    112,117,116,101,114,32,83,121,115,116,101,109,115,0,78,97,116,46,32,73,
+    110,115,116,46,0,78,97,116,105,111,110,97,108,32,73,110,115,116,114,117,
+    109,101,110,116,115,0,70,73,67,0,70,105,114,115,116,32,73,110,116,39,
+    108,32,67,111,109,112,117,116,101,114,115,0,83,105,108,105,99,111,110,32,
+    73,109,97,103,101,0,83,105,108,105,99,111,110,32,73,109,97,103,101,44,
+    32,73,110,99,46,0,65,108,97,99,114,111,110,0,65,112,112,105,97,110,
+    0,65,112,112,105,97,110,32,71,114,97,112,104,105,99,115,0,81,117,97,
+    110,116,117,109,0,81,117,97,110,116,117,109,32,68,101,115,105,103,110,115,
+    32,76,116,100,46,0,83,97,109,115,117,110,103,0,83,97,109,115,117,110,
+    103,32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,46,32,76,116,
+    100,46,0,80,97,99,107,97,114,100,45,66,101,108,108,0,80,97,99,107,
+    97,114,100,32,66,101,108,108,0,71,101,109,108,105,103,104,116,0,71,101,
+    109,108,105,103,104,116,32,67,111,109,112,117,116,101,114,32,76,116,100,46,
+    0,77,101,103,97,99,104,105,112,115,0,77,101,103,97,99,104,105,112,115,
+    32,67,111,114,112,111,114,97,116,105,111,110,0,90,105,100,97,0,90,105,
+    100,97,32,84,101,99,104,110,111,108,111,103,105,101,115,32,76,116,100,46,
+    0,66,114,111,111,107,116,114,101,101,0,66,114,111,111,107,116,114,101,101,
+    32,67,111,114,112,111,114,97,116,105,111,110,0,84,114,105,103,101,109,0,
+    84,114,105,103,101,109,32,67,111,109,112,117,116,101,114,32,73,110,99,46,
+    0,77,101,105,100,101,110,115,104,97,0,77,101,105,100,101,110,115,104,97,
+    32,67,111,114,112,111,114,97,116,105,111,110,0,74,117,107,111,0,74,117,
+    107,111,32,69,108,101,99,116,114,111,110,105,99,115,32,73,110,99,46,32,
+    76,116,100,46,0,81,117,97,110,116,117,109,32,67,111,114,112,111,114,97,
+    116,105,111,110,0,69,118,101,114,101,120,0,69,118,101,114,101,120,32,83,
+    121,115,116,101,109,115,32,73,110,99,46,0,71,108,111,98,101,0,71,108,
+    111,98,101,32,77,97,110,117,102,97,99,116,117,114,105,110,103,32,83,97,
+    108,101,115,0,82,97,99,97,108,0,82,97,99,97,108,32,73,110,116,101,
+    114,108,97,110,0,83,105,101,114,114,97,0,83,105,101,114,114,97,32,83,
+    101,109,105,99,111,110,100,117,99,116,111,114,0,83,71,0,83,105,108,105,
+    99,111,110,32,71,114,97,112,104,105,99,115,0,68,105,103,105,99,111,109,
+    0,72,111,110,101,121,119,101,108,108,0,72,111,110,101,121,119,101,108,108,
+    32,73,65,83,68,0,87,105,110,98,111,110,100,32,83,121,115,116,101,109,
+    115,32,76,97,98,115,0,67,111,114,110,101,114,115,116,111,110,101,0,67,
+    111,114,110,101,114,115,116,111,110,101,32,84,101,99,104,110,111,108,111,103,
+    121,0,77,67,83,0,77,105,99,114,111,32,67,111,109,112,117,116,101,114,
+    32,83,121,115,116,101,109,115,32,73,110,99,46,0,67,97,114,100,69,120,
+    112,101,114,116,0,67,97,114,100,69,120,112,101,114,116,32,84,101,99,104,
+    110,111,108,111,103,121,0,67,97,98,108,101,116,114,111,110,0,67,97,98,
+    108,101,116,114,111,110,32,83,121,115,116,101,109,115,32,73,110,99,46,0,
+    82,97,121,116,104,101,111,110,0,82,97,121,116,104,101,111,110,32,67,111,
+    109,112,97,110,121,0,68,97,116,97,98,111,111,107,0,68,97,116,97,98,
+    111,111,107,32,73,110,99,46,0,83,84,66,0,83,84,66,32,83,121,115,
+    116,101,109,115,0,80,76,88,0,80,76,88,32,84,101,99,104,110,111,108,
+    111,103,121,32,73,110,99,46,0,77,97,100,103,101,0,77,97,100,103,101,
+    32,78,101,116,119,111,114,107,115,0,51,67,111,109,0,51,67,111,109,32,
+    67,111,114,112,111,114,97,116,105,111,110,0,83,77,67,0,83,116,97,110,
+    100,97,114,100,32,77,105,99,114,111,115,121,115,116,101,109,115,32,67,111,
+    114,112,111,114,97,116,105,111,110,0,65,108,105,0,65,108,105,32,67,111,
+    114,112,111,114,97,116,105,111,110,0,77,105,116,115,117,98,105,115,104,105,
+    32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,114,112,46,0,68,
+    97,112,104,97,0,68,97,112,104,97,32,69,108,101,99,116,114,111,110,105,
+    99,115,32,67,111,114,112,111,114,97,116,105,111,110,0,65,76,82,0,65,
+    100,118,97,110,99,101,100,32,76,111,103,105,99,32,82,101,115,101,97,114,
+    99,104,32,73,110,99,46,0,83,117,114,101,99,111,109,0,83,117,114,101,
+    99,111,109,32,84,101,99,104,110,111,108,111,103,121,0,84,115,101,110,103,
+    108,97,98,115,32,73,110,116,101,114,110,97,116,105,111,110,97,108,32,67,
+    111,114,112,46,0,77,79,83,84,0,77,79,83,84,32,67,111,114,112,46,
+    0,66,111,99,97,0,66,111,99,97,32,82,101,115,101,97,114,99,104,32,
+    73,110,99,46,0,73,67,77,0,73,67,77,32,67,111,114,112,46,32,76,
+    116,100,46,0,65,117,115,112,101,120,0,65,117,115,112,101,120,32,83,121,
+    115,116,101,109,115,32,73,110,99,46,0,83,97,109,115,117,110,103,32,83,
+    101,109,105,99,111,110,100,117,99,116,111,114,115,0,119,105,109,0,65,119,
+    97,114,100,32,83,111,102,116,119,97,114,101,32,73,110,116,39,108,32,73,
+    110,99,46,0,88,101,114,111,120,0,88,101,114,111,120,32,67,111,114,112,
+    111,114,97,116,105,111,110,0,82,97,109,98,117,115,0,82,97,109,98,117,
+    115,32,73,110,99,46,0,78,101,111,109,97,103,105,99,0,78,101,111,109,
+    97,103,105,99,32,67,111,114,112,111,114,97,116,105,111,110,0,68,97,116,
+    97,101,120,112,101,114,116,0,68,97,116,97,101,120,112,101,114,116,32,67,
+    111,114,112,111,114,97,116,105,111,110,0,70,117,106,105,116,115,117,0,70,
+    117,106,105,116,115,117,32,115,105,101,109,101,110,115,0,79,109,114,111,110,
+    0,79,109,114,111,110,32,67,111,114,112,111,114,97,116,105,111,110,0,65,
+    100,118,97,110,83,121,115,0,65,100,118,97,110,99,101,100,32,83,121,115,
+    116,101,109,32,80,114,111,100,117,99,116,115,0,70,117,106,105,116,115,117,
+    32,76,116,100,46,0,70,117,116,117,114,101,43,0,70,117,116,117,114,101,
+    43,32,83,121,115,116,101,109,115,0,77,111,108,101,120,0,77,111,108,101,
+    120,32,73,110,99,111,114,112,111,114,97,116,101,100,0,74,97,98,105,108,
+    0,74,97,98,105,108,32,67,105,114,99,117,105,116,32,73,110,99,46,0,
+    72,117,97,108,111,110,0,72,117,97,108,111,110,32,77,105,99,114,111,101,
+    108,101,99,116,114,111,110,105,99,115,0,65,117,116,111,108,111,103,105,99,
+    0,65,117,116,111,108,111,103,105,99,32,73,110,99,46,0,67,101,116,105,
+    97,0,66,67,77,0,66,67,77,32,65,100,118,97,110,99,101,100,32,82,
+    101,115,101,97,114,99,104,0,65,80,76,0,65,100,118,97,110,99,101,100,
+    32,80,101,114,105,112,104,101,114,97,108,115,32,76,97,98,115,0,77,97,
+    99,114,111,110,105,120,0,77,97,99,114,111,110,105,120,32,73,110,116,101,
+    114,110,97,116,105,111,110,97,108,32,67,111,46,32,76,116,100,46,0,82,
+    111,104,109,0,82,111,104,109,32,82,101,115,101,97,114,99,104,0,67,69,
+    82,78,0,67,69,82,78,45,69,117,114,111,112,101,97,110,32,76,97,98,
+    46,32,102,111,114,32,80,97,114,116,105,99,108,101,32,80,104,121,115,105,
+    99,115,0,69,38,97,109,112,59,83,0,69,118,97,110,115,32,38,97,109,
+    112,59,32,83,117,116,104,101,114,108,97,110,100,0,78,86,73,68,73,65,
+    0,69,109,117,108,101,120,0,69,109,117,108,101,120,32,67,111,114,112,111,
+    114,97,116,105,111,110,0,84,101,107,114,97,109,0,84,101,107,114,97,109,
+    32,84,101,99,104,110,111,108,111,103,121,32,67,111,114,112,46,32,76,116,
+    100,46,0,65,112,116,105,120,0,65,112,116,105,120,32,67,111,114,112,111,
+    114,97,116,105,111,110,0,84,117,110,100,114,97,0,84,117,110,100,114,97,
+    32,83,101,109,105,99,111,110,100,117,99,116,111,114,32,67,111,114,112,46,
+    0,84,97,110,100,101,109,0,84,97,110,100,101,109,32,67,111,109,112,117,
+    116,101,114,115,0,77,73,67,0,77,105,99,114,111,32,73,110,100,117,115,
+    116,114,105,101,115,32,67,111,114,112,111,114,97,116,105,111,110,0,71,97,
+    105,110,98,101,114,121,0,71,97,105,110,98,101,114,121,32,67,111,109,112,
+    117,116,101,114,32,80,114,111,100,117,99,116,115,32,73,110,99,46,0,86,
+    97,100,101,109,0,65,77,67,67,0,65,112,112,108,105,101,100,32,77,105,
+    99,114,111,32,67,105,114,99,117,105,116,115,32,67,111,114,112,46,0,65,
+    108,112,115,0,65,108,112,115,32,69,108,101,99,116,114,111,110,105,99,32,
+    67,111,114,112,46,32,76,116,100,46,0,84,118,105,97,0,84,118,105,97,
+    44,32,73,110,99,46,0,65,114,116,105,115,116,0,65,114,116,105,115,116,
+    32,71,114,97,112,104,105,99,115,0,82,101,97,108,116,101,107,0,82,101,
+    97,108,116,101,107,32,83,101,109,105,99,111,110,100,117,99,116,111,114,0,
+    65,115,99,105,105,0,65,115,99,105,105,32,67,111,114,112,111,114,97,116,
+    105,111,110,0,88,105,108,105,110,120,0,88,105,108,105,110,120,32,67,111,
+    114,112,111,114,97,116,105,111,110,0,82,97,99,111,114,101,0,82,97,99,
+    111,114,101,32,67,111,109,112,117,116,101,114,32,80,114,111,100,117,99,116,
+    115,0,82,101,97,108,45,84,105,109,101,32,71,114,97,112,104,105,99,115,
+    32,38,97,109,112,59,32,86,105,100,101,111,0,67,117,114,116,105,115,115,
+    45,87,114,105,103,104,116,32,67,111,110,116,114,111,108,115,32,69,109,98,
+    101,100,100,101,100,32,67,111,109,112,117,116,105,110,103,0,84,121,97,110,
+    0,84,121,97,110,32,67,111,109,112,117,116,101,114,0,65,99,104,109,101,
+    0,65,99,104,109,101,32,67,111,109,112,117,116,101,114,32,73,110,99,46,
+    32,45,32,71,79,78,69,32,33,33,33,33,0,65,108,97,114,105,115,0,
+    65,108,97,114,105,115,32,73,110,99,46,0,83,45,77,111,115,0,83,45,
+    77,111,115,32,83,121,115,116,101,109,115,0,78,75,75,0,78,75,75,32,
+    67,111,114,112,111,114,97,116,105,111,110,0,67,69,83,0,67,114,101,97,
+    116,105,118,101,32,69,108,101,99,116,114,111,110,105,99,32,83,121,115,116,
+    101,109,115,32,83,65,0,77,97,116,115,117,115,104,105,116,97,0,77,97,
+    116,115,117,115,104,105,116,97,32,69,108,101,99,116,114,105,99,32,73,110,
+    100,117,115,116,114,105,97,108,32,67,111,114,112,46,0,65,108,116,111,115,
+    0,65,108,116,111,115,32,73,110,100,105,97,32,76,116,100,46,0,80,67,
+    45,68,105,114,101,99,116,0,80,67,32,68,105,114,101,99,116,0,84,114,
+    117,101,118,105,115,105,111,110,0,84,104,101,115,121,115,0,84,104,101,115,
+    121,115,32,77,105,99,114,111,101,108,101,99,116,114,111,110,105,99,39,115,
+    0,73,45,79,0,73,45,79,32,68,97,116,97,32,68,101,118,105,99,101,
+    32,73,110,99,46,0,83,111,121,111,0,83,111,121,111,32,84,101,99,104,
+    110,111,108,111,103,121,32,67,111,114,112,46,32,76,116,100,46,0,70,97,
+    115,116,0,70,97,115,116,32,69,108,101,99,116,114,111,110,105,99,32,71,
+    109,98,72,0,78,99,117,98,101,0,74,97,122,122,0,74,97,122,122,32,
+    77,117,108,116,105,109,101,100,105,97,0,73,110,105,116,105,111,0,73,110,
+    105,116,105,111,32,67,111,114,112,111,114,97,116,105,111,110,0,67,114,101,
+    97,116,105,118,101,32,76,97,98,115,0,67,114,101,97,116,105,118,101,32,
+    84,101,99,104,110,111,108,111,103,121,32,76,84,68,46,0,72,105,103,104,
+    112,111,105,110,116,0,84,114,105,111,110,101,115,32,84,101,99,104,110,111,
+    108,111,103,105,101,115,32,73,110,99,46,32,40,72,105,103,104,80,111,105,
+    110,116,41,0,82,97,115,116,101,114,111,112,115,0,83,105,103,109,97,0,
+    83,105,103,109,97,32,68,101,115,105,103,110,115,32,73,110,99,46,0,86,
+    73,65,0,86,73,65,32,84,101,99,104,110,111,108,111,103,121,0,83,116,
+    114,97,116,117,115,0,83,116,114,97,116,117,115,32,67,111,109,112,117,116,
+    101,114,0,80,114,111,116,101,111,110,0,80,114,111,116,101,111,110,32,73,
+    110,99,46,0,67,111,103,101,110,116,0,65,100,97,112,116,101,99,47,67,
+    111,103,101,110,116,32,68,97,116,97,32,84,101,99,104,110,111,108,111,103,
+    105,101,115,0,83,105,101,109,101,110,115,0,83,105,101,109,101,110,115,32,
+    78,105,120,100,111,114,102,32,65,71,0,67,104,114,111,109,97,116,105,99,
+    0,67,104,114,111,109,97,116,105,99,32,82,101,115,101,97,114,99,104,32,
+    73,110,99,0,77,105,110,105,45,77,97,120,0,77,105,110,105,45,77,97,
+    120,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,46,0,90,78,
+    89,88,0,90,78,89,88,32,67,111,114,112,111,114,97,116,105,111,110,0,
+    67,80,85,32,84,101,99,104,46,0,67,80,85,32,84,101,99,104,110,111,
+    108,111,103,121,0,82,111,115,115,0,82,111,115,115,32,84,101,99,104,110,
+    111,108,111,103,121,0,79,115,105,99,111,109,0,79,115,105,99,111,109,32,
+    84,101,99,104,110,111,108,111,103,105,101,115,32,73,110,99,46,0,65,99,
+    99,116,111,110,0,65,99,99,116,111,110,32,84,101,99,104,110,111,108,111,
+    103,121,32,67,111,114,112,111,114,97,116,105,111,110,0,65,116,109,101,108,
+    0,65,116,109,101,108,32,67,111,114,112,46,0,68,97,116,97,32,84,114,
+    97,110,115,108,97,116,105,111,110,0,68,97,116,97,32,84,114,97,110,115,
+    108,97,116,105,111,110,44,32,73,110,99,46,0,68,97,116,97,99,117,98,
+    101,0,68,97,116,97,99,117,98,101,32,73,110,99,46,0,66,101,114,103,
+    0,66,101,114,103,32,69,108,101,99,116,114,111,110,105,99,115,0,86,111,
+    114,116,101,120,0,73,67,80,32,118,111,114,116,101,120,32,67,111,109,112,
+    117,116,101,114,115,121,115,116,101,109,101,32,71,109,98,72,0,69,102,102,
+    46,32,78,101,116,46,0,69,102,102,105,99,101,110,116,32,78,101,116,119,
+    111,114,107,115,0,84,114,105,99,111,114,100,0,84,114,105,99,111,114,100,
+    32,83,121,115,116,101,109,115,32,73,110,99,46,0,73,68,84,0,73,110,
+    116,101,103,114,97,116,101,100,32,68,101,118,105,99,101,32,84,101,99,104,
+    110,111,108,111,103,121,32,73,110,99,46,0,80,68,73,0,80,114,101,99,
+    105,115,105,111,110,32,68,105,103,105,116,97,108,32,73,109,97,103,101,115,
+    0,69,77,67,0,69,77,67,32,67,111,114,112,46,0,90,105,108,111,103,
+    0,69,68,73,0,69,120,99,101,108,108,101,110,116,32,68,101,115,105,103,
+    110,32,73,110,99,46,0,76,101,117,116,114,111,110,0,76,101,117,116,114,
+    111,110,32,86,105,115,105,111,110,32,65,71,0,69,117,114,111,99,111,114,
+    101,0,69,117,114,111,99,111,114,101,47,86,105,103,114,97,0,70,79,82,
+    69,32,82,85,78,78,69,82,32,76,69,0,70,79,82,69,32,83,121,115,
+    116,101,109,115,0,70,105,114,109,119,111,114,107,115,0,72,101,114,109,101,
+    115,0,72,101,114,109,101,115,32,69,108,101,99,116,114,111,110,105,99,115,
+    32,67,111,46,32,76,116,100,46,0,90,101,110,105,116,104,0,90,101,110,
+    105,116,104,32,68,97,116,97,32,83,121,115,116,101,109,115,0,82,97,118,
+    105,99,97,100,0,73,110,102,111,109,101,100,105,97,0,67,111,109,112,117,
+    116,101,114,118,105,115,105,111,110,0,55,50,99,48,97,105,57,49,51,54,
+    50,57,0,80,104,105,108,105,112,115,32,83,101,109,105,99,111,110,100,117,
+    99,116,111,114,115,0,77,105,116,101,108,0,77,105,116,101,108,32,67,111,
+    114,112,46,0,69,73,67,0,69,105,99,111,110,32,78,101,116,119,111,114,
+    107,115,32,67,111,114,112,111,114,97,116,105,111,110,0,77,101,114,99,117,
+    114,121,32,67,111,109,112,117,116,101,114,32,83,121,115,116,101,109,115,32,
+    73,110,99,46,0,70,117,106,105,0,70,117,106,105,32,88,101,114,111,120,
+    32,67,111,32,76,116,100,0,77,111,109,101,110,116,117,109,0,77,111,109,
+    101,110,116,117,109,32,68,97,116,97,32,83,121,115,116,101,109,115,0,67,
+    105,115,99,111,0,67,105,115,99,111,32,83,121,115,116,101,109,115,32,73,
+    110,99,0,90,105,97,116,101,99,104,0,90,105,97,116,101,99,104,32,67,
+    111,114,112,111,114,97,116,105,111,110,0,68,121,110,46,32,80,105,99,116,
+    46,0,68,121,110,97,109,105,99,32,80,105,99,116,117,114,101,115,32,73,
+    110,99,0,70,87,66,0,70,87,66,32,32,73,110,99,0,78,67,68,0,
+    78,101,116,119,111,114,107,32,67,111,109,112,117,116,105,110,103,32,68,101,
+    118,105,99,101,115,0,67,121,99,108,111,110,101,0,67,121,99,108,111,110,
+    101,32,77,105,99,114,111,115,121,115,116,101,109,115,32,73,110,99,46,0,
+    76,101,97,100,105,110,103,32,69,100,103,101,0,76,101,97,100,105,110,103,
+    32,69,100,103,101,32,80,114,111,100,117,99,116,115,32,73,110,99,0,83,
+    97,110,121,111,0,83,97,110,121,111,32,69,108,101,99,116,114,105,99,32,
+    67,111,0,69,113,117,105,110,111,120,0,69,113,117,105,110,111,120,32,83,
+    121,115,116,101,109,115,0,73,110,116,101,114,118,111,105,99,101,0,73,110,
+    116,101,114,118,111,105,99,101,32,73,110,99,0,67,114,101,115,116,0,67,
+    114,101,115,116,32,77,105,99,114,111,115,121,115,116,101,109,32,73,110,99,
+    0,65,108,108,105,97,110,99,101,0,65,108,108,105,97,110,99,101,32,83,
+    101,109,105,99,111,110,100,117,99,116,111,114,0,78,101,116,112,111,119,101,
+    114,0,78,101,116,112,111,119,101,114,32,73,110,99,0,67,105,110,110,46,
+    32,77,105,108,46,0,67,105,110,99,105,110,110,97,116,105,32,77,105,108,
+    97,99,114,111,110,0,87,111,114,107,98,105,116,0,87,111,114,107,98,105,
+    116,32,67,111,114,112,0,70,111,114,99,101,0,70,111,114,99,101,32,67,
+    111,109,112,117,116,101,114,115,0,73,110,116,101,114,102,97,99,101,0,73,
+    110,116,101,114,102,97,99,101,32,67,111,114,112,0,77,97,114,118,101,108,
+    108,0,77,97,114,118,101,108,108,32,83,101,109,105,99,111,110,100,117,99,
+    116,111,114,32,71,101,114,109,97,110,121,32,71,109,98,72,0,87,105,110,
+    32,83,121,115,116,101,109,0,87,105,110,32,83,121,115,116,101,109,32,67,
+    111,114,112,111,114,97,116,105,111,110,0,86,77,73,67,0,67,97,110,111,
+    112,117,115,0,67,97,110,111,112,117,115,32,99,111,114,112,111,114,97,116,
+    105,111,110,0,65,110,110,97,98,111,111,107,115,0,73,67,32,67,111,114,
+    112,46,0,73,67,32,67,111,114,112,111,114,97,116,105,111,110,0,78,105,
+    107,111,110,0,78,105,107,111,110,32,83,121,115,116,101,109,115,32,73,110,
+    99,0,68,105,103,105,0,68,105,103,105,32,73,110,116,101,114,110,97,116,
+    105,111,110,97,108,0,84,104,105,110,107,105,110,103,32,77,97,99,104,105,
+    110,101,115,32,67,111,114,112,111,114,97,116,105,111,110,0,74,65,69,0,
+    74,65,69,32,69,108,101,99,116,114,111,110,105,99,115,32,73,110,99,46,
+    0,76,97,110,100,32,87,105,110,0,76,97,110,100,32,87,105,110,32,69,
+    108,101,99,116,114,111,110,105,99,32,67,111,114,112,0,77,101,108,99,111,
+    0,77,101,108,99,111,32,73,110,99,0,80,105,110,101,0,80,105,110,101,
+    32,84,101,99,104,110,111,108,111,103,121,32,76,116,100,0,80,101,114,105,
+    115,99,111,112,101,0,80,101,114,105,115,99,111,112,101,32,69,110,103,105,
+    110,101,101,114,105,110,103,0,65,118,115,121,115,0,65,118,115,121,115,32,
+    67,111,114,112,111,114,97,116,105,111,110,0,86,111,97,114,120,0,86,111,
+    97,114,120,32,82,38,97,109,112,59,68,32,73,110,99,0,77,117,116,101,
+    99,104,0,72,97,114,108,101,113,117,105,110,0,72,97,114,108,101,113,117,
+    105,110,32,76,116,100,0,80,97,114,97,108,108,97,120,0,80,97,114,97,
+    108,108,97,120,32,71,114,97,112,104,105,99,115,0,80,104,111,116,114,111,
+    110,0,80,104,111,116,114,111,110,32,76,116,100,46,0,88,105,114,99,111,
+    109,0,80,101,101,114,0,80,101,101,114,32,80,114,111,116,111,99,111,108,
+    115,32,73,110,99,0,77,97,120,116,111,114,114,0,77,97,120,116,111,114,
+    32,67,111,114,112,111,114,97,116,105,111,110,0,77,101,103,97,115,111,102,
+    116,0,77,101,103,97,115,111,102,116,32,73,110,99,0,80,70,85,0,80,
+    70,85,32,76,116,100,0,79,65,32,76,97,98,0,79,65,32,76,97,98,
+    111,114,97,116,111,114,121,32,67,111,32,76,116,100,0,82,101,110,100,105,
+    116,105,111,110,0,82,101,110,100,105,116,105,111,110,32,73,110,99,0,65,
+    80,84,0,65,100,118,97,110,99,101,100,32,80,101,114,105,112,104,101,114,
+    97,108,115,32,84,101,99,104,0,73,109,97,103,114,97,112,104,0,73,109,
+    97,103,114,97,112,104,32,67,111,114,112,111,114,97,116,105,111,110,0,66,
+    82,67,77,47,83,101,114,118,101,114,87,111,114,107,115,0,66,114,111,97,
+    100,99,111,109,32,47,32,83,101,114,118,101,114,87,111,114,107,115,0,77,
+    117,116,111,104,0,77,117,116,111,104,32,73,110,100,117,115,116,114,105,101,
+    115,32,73,110,99,0,84,104,105,110,101,0,84,104,105,110,101,32,69,108,
+    101,99,116,114,111,110,105,99,115,32,73,110,99,0,67,68,65,67,0,67,
+    101,110,116,114,101,32,102,47,68,101,118,46,32,111,102,32,65,100,118,46,
+    32,67,111,109,112,117,116,105,110,103,0,80,111,108,97,114,105,115,0,80,
+    111,108,97,114,105,115,32,67,111,109,109,117,110,105,99,97,116,105,111,110,
+    115,0,67,111,110,110,101,99,116,119,97,114,101,0,67,111,110,110,101,99,
+    116,119,97,114,101,32,73,110,99,0,73,110,116,32,82,101,115,46,0,73,
+    110,116,101,108,108,105,103,101,110,116,32,82,101,115,111,117,114,99,101,115,
+    0,69,70,73,0,69,108,101,99,116,114,111,110,105,99,115,32,102,111,114,
+    32,73,109,97,103,105,110,103,0,73,110,118,101,110,116,101,99,0,73,110,
+    118,101,110,116,101,99,32,67,111,114,112,111,114,97,116,105,111,110,0,65,
+    108,116,101,114,97,0,65,108,116,101,114,97,32,67,111,114,112,111,114,97,
+    116,105,111,110,0,65,100,111,98,101,0,65,100,111,98,101,32,83,121,115,
+    116,101,109,115,0,66,114,105,100,103,101,112,111,114,116,0,66,114,105,100,
+    103,101,112,111,114,116,32,77,97,99,104,105,110,101,115,0,77,105,116,114,
+    111,110,0,77,105,116,114,111,110,32,67,111,109,112,117,116,101,114,32,73,
+    110,99,46,0,83,66,69,0,83,105,108,105,99,111,110,32,69,110,103,46,
+    0,83,105,108,105,99,111,110,32,69,110,103,105,110,101,101,114,105,110,103,
+    0,65,108,102,97,0,65,108,102,97,32,73,110,99,0,84,111,115,104,105,
+    98,97,32,65,109,101,114,105,99,97,32,73,110,102,111,32,83,121,115,116,
+    101,109,115,0,65,45,84,114,101,110,100,0,65,45,84,114,101,110,100,32,
+    84,101,99,104,110,111,108,111,103,121,0,76,71,0,76,71,32,40,76,117,
+    99,107,121,32,71,111,108,100,115,116,97,114,41,32,69,108,101,99,116,114,
+    111,110,105,99,115,32,73,110,99,46,0,65,116,116,111,0,65,116,116,111,
+    32,84,101,99,104,110,111,108,111,103,121,0,66,38,97,109,112,59,68,0,
+    66,101,99,116,111,110,32,38,97,109,112,59,32,68,105,99,107,105,110,115,
+    111,110,0,84,47,82,0,84,47,82,32,83,121,115,116,101,109,115,0,73,
+    67,83,0,73,110,116,101,103,114,97,116,101,100,32,67,105,114,99,117,105,
+    116,32,83,121,115,116,101,109,115,0,82,105,99,111,104,0,82,105,99,111,
+    104,32,67,111,109,112,97,110,121,44,32,76,116,100,46,0,70,117,106,105,
+    107,117,114,97,0,70,117,106,105,107,117,114,97,32,76,116,100,0,70,111,
+    114,107,115,0,70,111,114,107,115,32,73,110,99,0,68,97,116,97,119,111,
+    114,108,100,0,68,45,76,105,110,107,0,68,45,76,105,110,107,32,83,121,
+    115,116,101,109,32,73,110,99,0,65,84,76,0,65,100,118,97,110,99,101,
+    100,32,84,101,99,104,110,111,108,111,103,121,32,76,97,98,111,114,97,116,
+    111,114,105,101,115,0,83,104,105,109,97,0,83,104,105,109,97,32,83,101,
+    105,107,105,32,77,97,110,117,102,97,99,116,117,114,105,110,103,32,76,116,
+    100,46,0,77,97,116,115,117,115,104,105,116,97,32,69,108,101,99,116,114,
+    111,110,105,99,115,0,72,105,108,101,118,101,108,0,72,105,108,101,118,101,
+    108,32,84,101,99,104,110,111,108,111,103,121,0,72,121,112,101,114,116,101,
+    99,0,72,121,112,101,114,116,101,99,32,80,116,121,32,76,116,100,0,67,
+    111,114,111,108,108,97,114,121,0,67,111,114,111,108,108,97,114,121,32,73,
+    110,99,0,66,105,116,70,108,111,119,0,66,105,116,70,108,111,119,32,73,
+    110,99,0,72,101,114,109,115,116,101,100,116,0,72,101,114,109,115,116,101,
+    100,116,32,65,71,0,71,114,101,101,110,0,71,114,101,101,110,32,76,111,
+    103,105,99,0,84,114,105,112,97,99,101,0,65,99,97,114,100,0,65,99,
+    97,114,100,32,84,101,99,104,110,111,108,111,103,121,32,67,111,114,112,46,
+    0,68,101,110,115,97,110,0,68,101,110,115,97,110,32,67,111,46,32,76,
+    116,100,0,84,111,117,99,97,110,0,84,111,117,99,97,110,32,84,101,99,
+    104,110,111,108,111,103,121,0,82,97,116,111,99,0,82,97,116,111,99,32,
+    83,121,115,116,101,109,32,73,110,99,0,72,121,116,101,99,0,72,121,116,
+    101,99,32,69,108,101,99,116,114,111,110,105,99,115,32,76,116,100,0,71,
+    97,103,101,0,71,97,103,101,32,65,112,112,108,105,101,100,32,84,101,99,
+    104,110,111,108,111,103,105,101,115,0,76,97,109,98,100,97,0,76,97,109,
+    98,100,97,32,83,121,115,116,101,109,115,32,73,110,99,0,65,116,116,97,
+    99,104,109,97,116,101,0,65,116,116,97,99,104,109,97,116,101,32,67,111,
+    114,112,46,0,77,105,110,100,32,83,104,97,114,101,0,77,105,110,100,47,
+    83,104,97,114,101,32,73,110,99,46,0,79,109,101,103,97,0,79,109,101,
+    103,97,32,77,105,99,114,111,32,73,110,99,46,0,73,84,73,0,73,110,
+    102,111,114,109,97,116,105,111,110,32,84,101,99,104,110,111,108,111,103,121,
+    32,73,110,115,116,46,0,66,117,103,0,66,117,103,32,83,97,112,112,111,
+    114,111,32,74,97,112,97,110,0,70,117,106,105,116,115,117,32,77,105,99,
+    114,111,101,108,101,99,116,114,111,110,105,99,115,32,76,116,100,46,0,66,
+    117,108,108,0,66,117,108,108,32,72,110,32,73,110,102,111,114,109,97,116,
+    105,111,110,32,83,121,115,116,101,109,115,0,72,97,109,97,109,97,116,115,
+    117,0,72,97,109,97,109,97,116,115,117,32,80,104,111,116,111,110,105,99,
+    115,32,75,46,75,46,0,83,105,101,114,114,97,32,82,101,115,101,97,114,
+    99,104,32,97,110,100,32,84,101,99,104,110,111,108,111,103,121,0,68,101,
+    117,114,101,116,122,98,97,99,104,101,114,0,68,101,117,114,101,116,122,98,
+    97,99,104,101,114,32,71,109,98,72,32,38,97,109,112,59,32,67,111,46,
+    32,69,110,103,46,32,75,71,0,66,97,114,99,111,0,77,105,99,114,111,
+    85,110,105,116,121,0,77,105,99,114,111,85,110,105,116,121,32,83,121,115,
+    116,101,109,115,32,69,110,103,105,110,101,101,114,105,110,103,32,73,110,99,
+    46,0,80,117,114,101,32,68,97,116,97,0,80,111,119,101,114,32,67,111,
+    109,112,46,0,80,111,119,101,114,32,67,111,109,112,117,116,105,110,103,32,
+    67,111,114,112,46,0,83,121,115,116,101,99,104,0,83,121,115,116,101,99,
+    104,32,67,111,114,112,46,0,73,110,110,111,83,121,115,0,73,110,110,111,
+    83,121,115,32,73,110,99,46,0,65,99,116,101,108,0,77,97,114,118,101,
+    108,108,32,83,101,109,105,99,111,110,100,117,99,116,111,114,0,67,97,110,
+    111,110,0,67,97,110,111,110,32,73,110,102,111,114,109,97,116,105,111,110,
+    32,83,121,115,116,101,109,115,0,76,105,116,101,45,79,110,0,76,105,116,
+    101,45,79,110,32,84,101,99,104,110,111,108,111,103,121,32,67,111,114,112,
+    46,0,83,99,105,116,101,120,0,83,99,105,116,101,120,32,67,111,114,112,
+    111,114,97,116,105,111,110,32,76,116,100,0,65,118,105,100,0,65,118,105,
+    100,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,46,0,81,117,
+    105,99,107,76,111,103,105,99,0,81,117,105,99,107,108,111,103,105,99,32,
+    67,111,114,112,0,65,112,114,105,99,111,116,0,65,112,114,105,99,111,116,
+    32,67,111,109,112,117,116,101,114,115,0,75,111,100,97,107,0,69,97,115,
+    116,109,97,110,32,75,111,100,97,107,0,66,97,114,114,0,66,97,114,114,
+    32,83,121,115,116,101,109,115,32,73,110,99,46,0,76,101,105,116,99,104,
+    0,76,101,105,116,99,104,32,84,101,99,104,110,111,108,111,103,121,32,73,
+    110,116,101,114,110,97,116,105,111,110,97,108,0,82,97,100,115,116,111,110,
+    101,0,82,97,100,115,116,111,110,101,32,84,101,99,104,110,111,108,111,103,
+    121,32,76,116,100,46,0,85,110,105,116,101,100,32,86,105,100,101,111,0,
+    85,110,105,116,101,100,32,86,105,100,101,111,32,67,111,114,112,0,88,112,
+    111,105,110,116,0,88,112,111,105,110,116,32,84,101,99,104,110,111,108,111,
+    103,105,101,115,32,73,110,99,0,80,97,116,104,108,105,103,104,116,0,80,
+    97,116,104,108,105,103,104,116,32,84,101,99,104,110,111,108,111,103,121,32,
+    73,110,99,46,0,86,105,100,101,111,116,114,111,110,0,86,105,100,101,111,
+    116,114,111,110,32,67,111,114,112,0,80,121,114,97,109,105,100,0,80,121,
+    114,97,109,105,100,32,84,101,99,104,110,111,108,111,103,121,0,78,101,116,
+    46,32,80,101,114,105,112,104,46,0,78,101,116,119,111,114,107,32,80,101,
+    114,105,112,104,101,114,97,108,115,32,73,110,99,0,80,105,110,110,97,99,
+    108,101,0,80,105,110,110,97,99,108,101,32,83,121,115,116,101,109,115,32,
+    73,110,99,46,0,73,77,73,0,73,110,116,101,114,110,97,116,105,111,110,
+    97,108,32,77,105,99,114,111,99,105,114,99,117,105,116,115,32,73,110,99,
+    0,65,115,116,114,111,100,101,115,105,103,110,0,65,115,116,114,111,100,101,
+    115,105,103,110,32,73,110,99,46,0,65,103,101,114,101,0,65,103,101,114,
+    101,32,83,121,115,116,101,109,115,0,83,97,110,100,0,83,97,110,100,32,
+    77,105,99,114,111,101,108,101,99,116,114,111,110,105,99,115,0,68,111,99,
+    46,32,84,101,99,104,46,0,68,111,99,117,109,101,110,116,32,84,101,99,
+    104,110,111,108,111,103,105,101,115,32,73,110,100,46,0,83,104,105,118,97,
+    0,83,104,105,118,97,32,67,111,114,112,111,114,97,116,105,110,0,68,97,
+    105,110,105,112,112,111,110,0,68,97,105,110,105,112,112,111,110,32,83,99,
+    114,101,101,110,32,77,102,103,46,32,67,111,0,68,46,67,46,77,46,0,
+    68,46,67,46,77,46,32,68,97,116,97,32,83,121,115,116,101,109,115,0,
+    68,111,108,112,104,105,110,0,68,111,108,112,104,105,110,32,73,110,116,101,
+    114,99,111,110,110,101,99,116,32,83,111,108,117,116,105,111,110,115,0,77,
+    65,71,77,65,0,76,83,73,32,83,121,115,46,0,76,83,73,32,83,121,
+    115,116,101,109,115,32,73,110,99,0,83,112,101,99,105,97,108,105,120,0,
+    83,112,101,99,105,97,108,105,120,32,73,110,116,101,114,110,97,116,105,111,
+    110,97,108,32,76,116,100,46,0,77,38,97,109,112,59,75,0,77,105,99,
+    104,101,108,115,32,38,97,109,112,59,32,75,108,101,98,101,114,104,111,102,
+    102,32,67,111,109,112,117,116,101,114,32,71,109,98,72,0,72,65,76,0,
+    72,65,76,32,67,111,109,112,117,116,101,114,32,83,121,115,116,101,109,115,
+    32,73,110,99,46,0,80,82,73,0,80,114,105,109,97,114,121,32,82,97,
+    116,101,32,73,110,99,0,80,69,67,0,80,105,111,110,101,101,114,32,69,
+    108,101,99,116,114,111,110,105,99,32,67,111,114,112,111,114,97,116,105,111,
+    110,0,66,65,69,0,66,65,69,32,83,89,83,84,69,77,83,32,45,32,
+    77,97,110,97,115,115,97,115,0,65,117,114,97,86,105,115,105,111,110,0,
+    65,117,114,97,86,105,115,105,111,110,32,67,111,114,112,111,114,97,116,105,
+    111,110,0,73,110,116,101,114,99,111,109,0,73,110,116,101,114,99,111,109,
+    32,73,110,99,46,0,84,114,97,110,99,101,108,108,0,84,114,97,110,99,
+    101,108,108,32,83,121,115,116,101,109,115,32,73,110,99,0,65,68,73,0,
+    65,110,97,108,111,103,32,68,101,118,105,99,101,115,44,32,73,110,99,46,
+    0,84,97,104,111,109,97,0,84,97,104,111,109,97,32,84,101,99,104,110,
+    111,108,111,103,121,0,84,101,107,101,108,101,99,0,84,101,107,101,108,101,
+    99,32,84,101,99,104,110,111,108,111,103,105,101,115,0,84,114,101,110,116,
+    111,110,0,84,114,101,110,116,111,110,32,84,101,114,109,105,110,97,108,115,
+    32,73,110,99,0,73,84,68,0,73,109,97,103,101,32,84,101,99,104,110,
+    111,108,111,103,105,101,115,32,68,101,118,101,108,111,112,109,101,110,116,0,
+    84,101,99,0,84,101,99,32,67,111,114,112,111,114,97,116,105,111,110,0,
+    78,111,118,101,108,108,0,83,101,103,97,0,83,101,103,97,32,69,110,116,
+    101,114,112,114,105,115,101,115,32,76,116,100,0,81,117,101,115,116,114,97,
+    0,81,117,101,115,116,114,97,32,67,111,114,112,0,67,114,111,115,102,105,
+    101,108,100,0,67,114,111,115,102,105,101,108,100,32,69,108,101,99,116,114,
+    111,110,105,99,115,32,76,116,100,0,90,111,114,97,110,0,90,111,114,97,
+    110,32,67,111,114,112,111,114,97,116,105,111,110,0,71,101,99,32,80,108,
+    101,115,115,101,121,0,71,101,99,32,80,108,101,115,115,101,121,32,83,101,
+    109,105,32,73,110,99,0,83,97,109,115,117,110,103,32,73,110,102,111,114,
+    109,97,116,105,111,110,32,83,121,115,116,101,109,115,32,65,109,101,114,105,
+    99,97,0,83,101,99,111,110,100,32,87,97,118,101,0,83,101,99,111,110,
+    100,32,87,97,118,101,32,73,110,99,0,73,73,88,0,73,73,88,32,67,
+    111,110,115,117,108,116,105,110,103,0,77,105,116,115,117,105,0,77,105,116,
+    115,117,105,45,90,111,115,101,110,32,83,121,115,116,101,109,32,82,101,115,
+    101,97,114,99,104,0,68,80,83,73,0,68,105,103,105,116,97,108,32,80,
+    114,111,99,101,115,115,105,110,103,32,83,121,115,116,101,109,115,32,73,110,
+    99,0,72,105,103,104,119,97,116,101,114,0,72,105,103,104,119,97,116,101,
+    114,32,68,101,115,105,103,110,115,32,76,116,100,0,69,108,115,97,103,0,
+    69,108,115,97,103,32,66,97,105,108,101,121,0,70,111,114,109,97,116,105,
+    111,110,0,70,111,114,109,97,116,105,111,110,44,32,73,110,99,0,67,111,
+    114,101,99,111,0,67,111,114,101,99,111,32,73,110,99,0,77,101,100,105,
+    97,109,97,116,105,99,115,0,68,111,109,101,0,68,111,109,101,32,73,109,
+    97,103,105,110,103,32,83,121,115,116,101,109,115,32,73,110,99,0,78,105,
+    99,111,108,101,116,0,78,105,99,111,108,101,116,32,84,101,99,104,110,111,
+    108,111,103,105,101,115,32,66,86,0,67,111,109,112,117,45,83,104,97,99,
+    107,0,67,111,109,112,117,45,83,104,97,99,107,32,71,109,98,72,0,80,
+    105,99,45,84,101,108,0,80,105,99,116,117,114,101,32,84,101,108,32,74,
+    97,112,97,110,32,75,75,0,75,101,105,116,104,108,101,121,0,75,101,105,
+    116,104,108,101,121,32,77,101,116,114,97,98,121,116,101,0,75,105,110,101,
+    116,105,99,0,75,105,110,101,116,105,99,32,83,121,115,116,101,109,115,32,
+    67,111,114,112,111,114,97,116,105,111,110,0,67,111,109,112,32,68,101,118,
+    0,67,111,109,112,117,116,105,110,103,32,68,101,118,105,99,101,115,32,73,
+    110,116,108,0,80,111,119,101,114,109,97,116,105,99,0,80,111,119,101,114,
+    109,97,116,105,99,32,68,97,116,97,32,83,121,115,116,101,109,115,32,76,
+    116,100,0,83,45,65,0,83,99,105,101,110,116,105,102,105,99,32,65,116,
+    108,97,110,116,97,0,80,77,67,45,83,105,101,114,114,97,0,80,77,67,
+    45,83,105,101,114,114,97,32,73,110,99,46,0,73,45,67,117,98,101,0,
+    73,45,67,117,98,101,32,73,110,99,0,75,97,115,97,110,0,75,97,115,
+    97,110,32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,32,76,116,
+    100,0,68,97,116,101,108,0,68,97,116,101,108,32,73,110,99,0,72,105,
+    103,104,32,83,116,114,101,101,116,0,72,105,103,104,32,83,116,114,101,101,
+    116,32,67,111,110,115,117,108,116,97,110,116,115,0,67,111,109,116,114,111,
+    108,0,67,111,109,116,114,111,108,32,67,111,114,112,0,83,99,105,111,110,
+    0,83,99,105,111,110,32,67,111,114,112,0,67,83,83,0,67,83,83,32,
+    67,111,114,112,0,86,105,115,116,97,0,86,105,115,116,97,32,67,111,110,
+    116,114,111,108,115,32,67,111,114,112,0,78,101,116,119,111,114,107,32,71,
+    101,110,0,78,101,116,119,111,114,107,32,71,101,110,101,114,97,108,32,67,
+    111,114,112,0,65,103,102,97,0,66,97,121,101,114,32,67,111,114,112,111,
+    114,97,116,105,111,110,32,65,103,102,97,32,68,105,118,0,76,97,116,116,
+    105,99,101,0,76,97,116,116,105,99,101,32,83,101,109,105,99,111,110,100,
+    117,99,116,111,114,32,67,111,114,112,0,65,114,114,97,121,0,65,114,114,
+    97,121,32,67,111,114,112,0,65,109,100,97,104,108,0,65,109,100,97,104,
+    108,32,67,111,114,112,0,80,97,114,115,121,116,101,99,0,80,97,114,115,
+    121,116,101,99,32,71,109,98,72,0,83,99,105,32,83,121,115,0,83,99,
+    105,32,83,121,115,116,101,109,115,32,73,110,99,0,83,121,110,97,112,116,
+    101,108,0,65,100,97,112,116,105,118,101,0,65,100,97,112,116,105,118,101,
+    32,83,111,108,117,116,105,111,110,115,0,67,111,109,112,32,76,97,98,115,
+    0,67,111,109,112,114,101,115,115,105,111,110,32,76,97,98,115,32,73,110,
+    99,46,0,67,121,99,108,97,100,101,115,0,67,121,99,108,97,100,101,115,
+    32,67,111,114,112,111,114,97,116,105,111,110,0,69,115,115,101,110,116,105,
+    97,108,0,69,115,115,101,110,116,105,97,108,32,67,111,109,109,117,110,105,
+    99,97,116,105,111,110,115,0,72,121,112,101,114,112,97,114,97,108,108,101,
+    108,0,72,121,112,101,114,112,97,114,97,108,108,101,108,32,84,101,99,104,
+    110,111,108,111,103,105,101,115,0,66,114,97,105,110,116,101,99,104,0,66,
+    114,97,105,110,116,101,99,104,32,73,110,99,0,65,73,83,73,0,65,112,
+    112,108,105,101,100,32,73,110,116,101,108,108,105,103,101,110,116,32,83,121,
+    115,116,101,109,115,32,73,110,99,0,80,101,114,102,32,84,101,99,104,0,
+    80,101,114,102,111,114,109,97,110,99,101,32,84,101,99,104,110,111,108,111,
+    103,105,101,115,32,73,110,99,0,73,110,116,101,114,119,97,114,101,0,73,
+    110,116,101,114,119,97,114,101,32,67,111,32,76,116,100,0,80,117,114,117,
+    112,32,69,115,107,111,102,111,116,0,80,117,114,117,112,45,69,115,107,111,
+    102,111,116,32,65,47,83,0,79,50,77,105,99,114,111,0,79,50,77,105,
+    99,114,111,32,73,110,99,0,72,121,98,114,105,99,111,110,0,72,121,98,
+    114,105,99,111,110,32,67,111,114,112,0,70,105,114,115,116,32,86,105,114,
+    116,117,97,108,0,70,105,114,115,116,32,86,105,114,116,117,97,108,32,67,
+    111,114,112,0,51,100,102,120,0,51,100,102,120,32,73,110,116,101,114,97,
+    99,116,105,118,101,32,73,110,99,0,65,84,77,0,65,100,118,97,110,99,
+    101,100,32,84,101,108,101,99,111,109,109,117,110,105,99,97,116,105,111,110,
+    115,32,77,111,100,117,108,101,115,0,78,105,112,112,111,110,32,84,101,120,
+    97,0,78,105,112,112,111,110,32,84,101,120,97,32,67,111,32,76,116,100,
+    0,76,105,112,112,101,114,116,0,76,105,112,112,101,114,116,32,65,117,116,
+    111,109,97,116,105,111,110,115,116,101,99,104,110,105,107,32,71,109,98,72,
+    0,67,83,80,73,0,65,114,99,117,115,0,65,114,99,117,115,32,84,101,
+    99,104,110,111,108,111,103,121,32,73,110,99,0,65,114,105,101,108,0,65,
+    114,105,101,108,32,67,111,114,112,111,114,97,116,105,111,110,0,67,111,110,
+    116,101,99,0,67,111,110,116,101,99,32,77,105,99,114,111,101,108,101,99,
+    116,114,111,110,105,99,115,32,69,117,114,111,112,101,32,66,86,0,65,110,
+    99,111,114,0,65,110,99,111,114,32,67,111,109,109,117,110,105,99,97,116,
+    105,111,110,115,32,73,110,99,0,69,109,101,114,115,111,110,32,78,101,116,
+    119,111,114,107,32,80,111,119,101,114,0,69,109,101,114,115,111,110,32,78,
+    101,116,119,111,114,107,32,80,111,119,101,114,44,32,69,109,98,101,100,100,
+    101,100,32,67,111,109,112,117,116,105,110,103,0,73,110,116,46,32,73,109,
+    103,46,0,73,110,116,101,114,97,99,116,105,118,101,32,73,109,97,103,101,
+    115,0,80,111,119,101,114,32,73,79,0,80,111,119,101,114,32,73,47,79,
+    32,73,110,99,46,0,84,101,99,104,45,83,111,117,114,99,101,0,78,111,
+    114,115,107,0,78,111,114,115,107,32,69,108,101,107,116,114,111,32,79,112,
+    116,105,107,107,32,65,47,83,0,68,97,116,97,32,75,105,110,0,68,97,
+    116,97,32,75,105,110,101,115,105,115,32,73,110,99,46,0,73,110,116,46,
+    32,84,101,108,101,99,111,109,0,73,110,116,101,103,114,97,116,101,100,32,
+    84,101,108,101,99,111,109,0,76,71,32,73,110,100,46,0,76,71,32,73,
+    110,100,117,115,116,114,105,97,108,32,83,121,115,116,101,109,115,32,67,111,
+    46,32,76,116,100,46,0,115,99,105,45,119,111,114,120,0,115,99,105,45,
+    119,111,114,120,32,71,109,98,72,0,65,122,116,101,99,104,0,65,122,116,
+    101,99,104,32,83,121,115,116,101,109,32,76,116,100,0,88,121,114,97,116,
+    101,120,0,65,110,100,114,101,119,0,65,110,100,114,101,119,32,67,111,114,
+    112,46,0,70,105,115,104,99,97,109,112,0,70,105,115,104,99,97,109,112,
+    32,69,110,103,105,110,101,101,114,105,110,103,0,87,77,73,0,87,111,111,
+    100,119,97,114,100,32,77,99,67,111,97,99,104,32,73,110,99,46,0,66,
+    117,115,45,84,101,99,104,0,66,117,115,45,84,101,99,104,32,73,110,99,
+    46,0,84,101,99,104,110,105,99,97,108,0,84,101,99,104,110,105,99,97,
+    108,32,67,111,114,112,0,83,105,103,109,97,32,68,101,115,105,103,110,115,
+    0,83,105,103,109,97,32,68,101,115,105,103,110,115,44,32,73,110,99,0,
+    65,108,116,97,32,84,101,99,104,0,65,108,116,97,32,84,101,99,104,110,
+    111,108,111,103,121,32,67,111,114,112,46,0,65,100,116,114,97,110,0,51,
+    68,79,0,84,104,101,32,51,68,79,32,67,111,109,112,97,110,121,0,86,
+    105,115,105,99,111,109,0,86,105,115,105,99,111,109,32,76,97,98,111,114,
+    97,116,111,114,105,101,115,32,73,110,99,46,0,83,101,101,113,0,83,101,
+    101,113,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,46,0,67,
+    101,110,116,117,114,121,32,83,121,115,0,67,101,110,116,117,114,121,32,83,
+    121,115,116,101,109,115,32,73,110,99,46,0,69,68,84,0,69,110,103,105,
+    110,101,101,114,105,110,103,32,68,101,115,105,103,110,32,84,101,97,109,32,
+    73,110,99,46,0,67,45,67,117,98,101,0,67,45,67,117,98,101,32,77,
+    105,99,114,111,115,121,115,116,101,109,115,0,77,97,114,97,116,104,111,110,
+    0,77,97,114,97,116,104,111,110,32,84,101,99,104,110,111,108,111,103,105,
+    101,115,32,67,111,114,112,46,0,68,83,67,0,68,83,67,32,67,111,109,
+    109,117,110,105,99,97,116,105,111,110,115,0,74,78,73,0,74,78,73,32,
+    67,111,114,112,111,114,97,116,105,111,110,0,68,101,108,112,104,97,120,0,
+    65,86,77,0,65,86,77,32,65,85,68,73,79,86,73,83,85,69,76,76,
+    69,83,32,77,75,84,71,32,38,97,109,112,59,32,67,111,109,112,117,116,
+    101,114,32,71,109,98,72,0,65,80,68,0,65,80,68,32,83,46,65,46,
+    0,68,105,112,105,120,0,68,105,112,105,120,32,84,101,99,104,110,111,108,
+    111,103,105,101,115,32,73,110,99,0,88,121,108,111,110,0,88,121,108,111,
+    110,32,82,101,115,101,97,114,99,104,32,73,110,99,46,0,67,101,110,116,
+    114,97,108,32,68,97,116,97,0,67,101,110,116,114,97,108,32,68,97,116,
+    97,32,67,111,114,112,46,0,65,69,71,0,65,69,71,32,69,108,101,99,
+    116,114,111,99,111,109,32,71,109,98,72,0,83,111,108,105,116,114,111,110,
+    0,83,111,108,105,116,114,111,110,32,84,101,99,104,110,111,108,111,103,105,
+    101,115,32,73,110,99,46,0,83,116,97,108,108,105,111,110,0,83,116,97,
+    108,108,105,111,110,32,84,101,99,104,110,111,108,111,103,105,101,115,0,67,
+    121,108,105,110,107,0,73,110,102,111,114,116,114,101,110,100,0,73,110,102,
+    111,114,116,114,101,110,100,32,84,101,99,104,110,111,108,111,103,121,32,73,
+    110,99,0,72,105,116,97,99,104,105,32,77,105,99,114,111,99,111,109,112,
+    117,116,101,114,32,83,121,115,116,101,109,32,76,116,100,46,0,86,76,83,
+    73,32,83,111,108,46,0,86,76,83,73,32,83,111,108,117,116,105,111,110,
+    32,79,89,0,71,117,122,105,107,0,71,117,122,105,107,32,84,101,99,104,
+    110,105,99,97,108,32,69,110,116,101,114,112,114,105,115,101,115,0,76,105,
+    110,101,97,114,32,83,121,115,116,101,109,115,0,76,105,110,101,97,114,32,
+    83,121,115,116,101,109,115,32,76,116,100,46,0,79,112,116,105,98,97,115,
+    101,0,79,112,116,105,98,97,115,101,32,76,116,100,46,0,80,101,114,99,
+    101,112,116,105,118,101,0,80,101,114,99,101,112,116,105,118,101,32,83,111,
+    108,117,116,105,111,110,115,32,73,110,99,46,0,86,101,114,116,101,120,0,
+    86,101,114,116,101,120,32,78,101,116,119,111,114,107,115,32,73,110,99,46,
+    0,71,105,108,98,97,114,99,111,0,71,105,108,98,97,114,99,111,32,73,
+    110,99,46,0,65,108,108,105,101,100,32,84,115,121,110,0,65,108,108,105,
+    101,100,32,84,101,108,101,115,121,110,32,73,110,116,101,114,110,97,116,105,
+    111,110,97,108,0,65,66,66,32,80,119,114,0,65,66,66,32,80,111,119,
+    101,114,32,83,121,115,116,101,109,115,0,65,115,105,120,0,65,115,105,120,
+    32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,114,112,46,0,65,
+    117,114,111,114,97,0,65,117,114,111,114,97,32,84,101,99,104,110,111,108,
+    111,103,105,101,115,32,73,110,99,46,0,69,83,83,0,69,83,83,32,84,
+    101,99,104,110,111,108,111,103,121,0,83,112,101,99,118,105,100,101,111,0,
+    83,112,101,99,105,97,108,118,105,100,101,111,32,69,110,103,105,110,101,101,
+    114,105,110,103,32,83,82,76,0,67,111,110,99,117,114,114,101,110,116,0,
+    67,111,110,99,117,114,114,101,110,116,32,84,101,99,104,110,111,108,111,103,
+    105,101,115,32,73,110,99,46,0,73,110,116,101,114,115,105,108,0,73,110,
+    116,101,114,115,105,108,32,67,111,114,112,111,114,97,116,105,111,110,0,77,
+    97,116,115,117,115,104,105,116,97,45,75,111,116,111,98,117,107,105,32,69,
+    108,101,99,116,114,111,110,105,99,115,32,73,110,100,117,0,69,83,32,67,
+    111,109,112,46,0,69,83,32,67,111,109,112,117,116,101,114,32,67,111,46,
+    32,76,116,100,46,0,83,111,110,105,99,32,83,111,108,46,0,83,111,110,
+    105,99,32,83,111,108,117,116,105,111,110,115,0,65,118,97,108,32,78,97,
+    103,46,0,65,118,97,108,32,78,97,103,97,115,97,107,105,32,67,111,114,
+    112,46,0,67,97,115,105,111,0,67,97,115,105,111,32,67,111,109,112,117,
+    116,101,114,32,67,111,46,32,76,116,100,46,0,77,105,99,114,111,100,121,
+    110,101,0,77,105,99,114,111,100,121,110,101,32,67,111,114,112,46,0,83,
+    65,32,84,101,108,101,99,111,109,0,83,46,65,46,32,84,101,108,101,99,
+    111,109,109,117,110,105,99,97,116,105,111,110,115,0,84,101,107,116,114,111,
+    110,105,120,0,83,71,83,32,84,104,111,109,115,111,110,0,84,104,111,109,
+    115,111,110,45,67,83,70,47,84,84,77,0,76,101,120,109,97,114,107,0,
+    76,101,120,109,97,114,107,32,73,110,116,101,114,110,97,116,105,111,110,97,
+    108,32,73,110,99,46,0,65,100,97,120,0,65,100,97,120,32,73,110,99,
+    46,0,78,111,114,116,101,108,0,78,111,114,116,101,108,32,78,101,116,119,
+    111,114,107,115,32,67,111,114,112,46,0,83,112,108,97,115,104,0,83,112,
+    108,97,115,104,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,46,
+    0,83,117,109,105,116,111,109,111,0,83,117,109,105,116,111,109,111,32,77,
+    101,116,97,108,32,73,110,100,117,115,116,114,105,101,115,32,76,116,100,46,
+    0,83,105,108,32,77,111,116,105,111,110,0,83,105,108,105,99,111,110,32,
+    77,111,116,105,111,110,0,79,108,121,109,112,117,115,0,79,108,121,109,112,
+    117,115,32,79,112,116,105,99,97,108,32,67,111,46,32,76,116,100,46,0,
+    71,87,32,73,110,115,116,114,46,0,71,87,32,73,110,115,116,114,117,109,
+    101,110,116,115,0,84,101,108,101,109,97,116,105,99,115,0,84,101,108,101,
+    109,97,116,105,99,115,32,73,110,116,101,114,110,97,116,105,111,110,97,108,
+    0,72,117,103,104,101,115,0,72,117,103,104,101,115,32,78,101,116,119,111,
+    114,107,32,83,121,115,116,101,109,115,0,69,110,115,111,110,105,113,0,78,
+    101,116,65,112,112,0,78,101,116,119,111,114,107,32,65,112,112,108,105,97,
+    110,99,101,0,83,119,32,78,101,116,32,84,101,99,104,0,83,119,105,116,
+    99,104,101,100,32,78,101,116,119,111,114,107,32,84,101,99,104,110,111,108,
+    111,103,105,101,115,32,73,110,99,46,0,67,111,109,115,116,114,101,97,109,
+    0,84,114,97,110,115,116,101,99,104,0,84,114,97,110,115,116,101,99,104,
+    32,80,97,114,97,108,108,101,108,32,83,121,115,116,101,109,115,0,84,114,
+    97,110,115,109,101,116,97,0,84,114,97,110,115,109,101,116,97,32,67,111,
+    114,112,46,0,80,105,120,101,114,97,0,80,105,120,101,114,97,32,67,111,
+    114,112,0,67,114,111,115,115,112,111,105,110,116,0,67,114,111,115,115,112,
+    111,105,110,116,32,83,111,108,117,116,105,111,110,115,32,73,110,99,46,0,
+    86,101,108,97,0,86,101,108,97,32,82,101,115,101,97,114,99,104,32,76,
+    80,0,87,105,110,110,111,119,0,87,105,110,110,111,118,32,76,46,80,46,
+    0,70,117,106,105,102,105,108,109,0,80,104,111,116,111,115,99,114,105,112,
+    116,0,80,104,111,116,111,115,99,114,105,112,116,32,71,114,111,117,112,32,
+    76,116,100,46,0,89,111,107,111,103,97,119,97,0,89,111,107,111,103,97,
+    119,97,32,69,108,101,99,116,114,111,110,105,99,32,67,111,114,112,46,0,
+    68,97,118,105,99,111,109,0,68,97,118,105,99,111,109,32,83,101,109,105,
+    99,111,110,100,117,99,116,111,114,32,73,110,99,46,0,73,84,69,120,112,
+    114,101,115,115,99,100,115,102,100,100,115,0,99,104,97,110,100,114,101,115,
+    104,46,106,46,109,101,104,116,97,0,80,108,97,116,32,84,101,99,104,0,
+    80,108,97,116,102,111,114,109,32,84,101,99,104,110,111,108,111,103,105,101,
+    115,32,73,110,99,46,0,77,65,90,101,84,0,77,65,90,101,84,32,71,
+    109,98,72,0,76,117,120,83,111,110,111,114,0,76,117,120,83,111,110,111,
+    114,32,73,110,99,46,0,84,105,109,101,115,116,101,112,0,84,105,109,101,
+    115,116,101,112,32,67,111,114,112,46,0,65,86,67,32,84,101,99,104,0,
+    65,86,67,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,46,0,
+    65,115,97,110,116,101,0,65,115,97,110,116,101,32,84,101,99,104,110,111,
+    108,111,103,105,101,115,32,73,110,99,46,0,84,114,97,110,115,119,105,116,
+    99,104,0,84,114,97,110,115,119,105,116,99,104,32,67,111,114,112,46,0,
+    82,101,116,105,120,0,82,101,116,105,120,32,67,111,114,112,46,0,71,50,
+    32,78,101,116,0,71,50,32,78,101,116,119,111,114,107,115,32,73,110,99,
+    46,0,84,97,116,101,110,111,0,84,97,116,101,110,111,32,68,101,110,110,
+    111,117,32,73,110,99,46,0,83,111,114,100,0,83,111,114,100,32,67,111,
+    109,112,117,116,101,114,32,67,111,114,112,46,0,78,67,83,32,67,111,109,
+    112,0,78,67,83,32,67,111,109,112,117,116,101,114,32,73,116,97,108,105,
+    97,0,84,114,105,116,101,99,104,0,84,114,105,116,101,99,104,32,77,105,
+    99,114,111,101,108,101,99,116,114,111,110,105,99,115,32,73,110,116,108,32,
+    80,84,69,0,77,32,82,101,97,108,105,116,121,0,77,101,100,105,97,32,
+    82,101,97,108,105,116,121,32,84,101,99,104,110,111,108,111,103,121,0,82,
+    104,101,116,111,114,101,120,0,82,104,101,116,111,114,101,120,32,73,110,99,
+    46,0,73,109,97,103,101,110,97,116,105,111,110,0,73,109,97,103,101,110,
+    97,116,105,111,110,32,67,111,114,112,46,0,75,111,102,97,120,0,75,111,
+    102,97,120,32,73,109,97,103,101,32,80,114,111,100,117,99,116,115,0,83,
+    104,117,116,116,108,101,32,67,111,109,112,117,116,101,114,0,83,112,101,108,
+    108,99,97,115,116,101,114,0,83,112,101,108,108,99,97,115,116,101,114,32,
+    84,101,108,101,99,111,109,109,117,110,105,99,97,116,105,111,110,115,32,73,
+    110,99,46,0,75,110,111,119,32,84,101,99,104,0,75,110,111,119,108,101,
+    100,103,101,32,84,101,99,104,110,111,108,111,103,121,32,76,97,98,111,114,
+    97,116,111,114,105,101,115,0,86,77,69,84,82,79,0,86,77,69,84,82,
+    79,32,73,110,99,46,0,73,109,103,32,65,99,99,101,115,115,0,73,109,
+    97,103,101,32,65,99,99,101,115,115,0,67,111,109,112,67,111,114,101,0,
+    67,111,109,112,67,111,114,101,32,77,117,108,116,105,109,101,100,105,97,32,
+    73,110,99,46,0,86,105,99,116,111,114,32,74,112,110,0,86,105,99,116,
+    111,114,32,67,111,46,32,111,102,32,74,97,112,97,110,32,76,116,100,46,
+    0,79,69,67,32,77,101,100,0,79,69,67,32,77,101,100,105,99,97,108,
+    32,83,121,115,116,101,109,115,32,73,110,99,46,0,65,45,66,0,65,108,
+    108,101,110,32,66,114,97,100,108,101,121,32,67,111,46,0,83,105,109,112,
+    97,99,116,0,83,105,109,112,97,99,116,32,73,110,99,0,78,101,119,71,
+    101,110,0,78,101,119,71,101,110,32,83,121,115,116,101,109,115,32,67,111,
+    114,112,46,0,76,117,99,101,110,116,0,76,117,99,101,110,116,32,84,101,
+    99,104,110,111,108,111,103,105,101,115,32,65,77,82,0,78,84,84,32,69,
+    108,101,99,116,0,78,84,84,32,69,108,101,99,116,114,111,110,105,99,115,
+    32,84,101,99,104,110,111,108,111,103,121,32,67,111,46,0,86,105,115,105,
+    111,110,32,68,121,110,0,86,105,115,105,111,110,32,68,121,110,97,109,105,
+    99,115,32,76,116,100,46,0,83,99,97,108,97,98,108,101,0,83,99,97,
+    108,97,98,108,101,32,78,101,116,119,111,114,107,115,32,73,110,99,46,0,
+    65,77,79,0,65,77,79,32,71,109,98,72,0,78,101,119,115,32,68,97,
+    116,97,99,111,109,0,88,105,111,116,101,99,104,0,88,105,111,116,101,99,
+    104,32,67,111,114,112,46,0,83,68,76,0,83,68,76,32,67,111,109,109,
+    117,110,105,99,97,116,105,111,110,115,32,73,110,99,46,0,89,117,97,110,
+    32,89,117,97,110,0,89,117,97,110,32,89,117,97,110,32,69,110,116,101,
+    114,112,114,105,115,101,32,67,111,46,32,76,116,100,46,0,77,101,97,115,
+    117,114,101,88,0,77,101,97,115,117,114,101,88,32,67,111,114,112,46,0,
+    77,117,108,116,105,100,97,116,97,0,77,117,108,116,105,100,97,116,97,32,
+    71,109,98,72,0,65,108,116,101,111,110,0,65,108,116,101,111,110,32,78,
+    101,116,119,111,114,107,115,32,73,110,99,46,0,84,68,75,32,85,83,65,
+    0,84,68,75,32,85,83,65,32,67,111,114,112,46,0,74,111,114,103,101,
+    32,83,99,105,0,74,111,114,103,101,32,83,99,105,101,110,116,105,102,105,
+    99,32,67,111,114,112,46,0,71,97,109,109,97,76,105,110,107,0,71,101,
+    110,32,83,105,103,110,97,108,0,71,101,110,101,114,97,108,32,83,105,103,
+    110,97,108,32,78,101,116,119,111,114,107,115,0,73,110,116,101,114,45,70,
+    97,99,101,0,73,110,116,101,114,45,70,97,99,101,32,67,111,46,32,76,
+    116,100,46,0,70,117,116,117,114,101,32,84,101,108,0,70,117,116,117,114,
+    101,32,84,101,108,32,73,110,99,46,0,71,114,97,110,105,116,101,0,71,
+    114,97,110,105,116,101,32,83,121,115,116,101,109,115,32,73,110,99,46,0,
+    65,99,117,109,101,110,0,75,111,114,103,0,66,105,116,116,119,97,114,101,
+    0,66,105,116,116,119,97,114,101,44,32,73,110,99,0,78,105,112,112,111,
+    110,32,85,110,105,0,78,105,112,112,111,110,32,85,110,105,115,111,102,116,
+    32,67,111,114,112,46,0,65,114,114,97,121,32,77,105,99,114,111,0,65,
+    114,114,97,121,32,77,105,99,114,111,115,121,115,116,101,109,115,0,67,111,
+    109,112,117,116,101,114,109,0,67,111,109,112,117,116,101,114,109,32,67,111,
+    114,112,46,0,70,117,106,105,102,105,108,109,32,77,105,99,114,111,100,101,
+    118,105,99,101,115,0,73,110,102,105,109,101,100,0,71,77,77,32,82,101,
+    115,0,71,77,77,32,82,101,115,101,97,114,99,104,32,67,111,114,112,46,
+    0,77,101,110,116,101,99,0,77,101,110,116,101,99,32,76,116,100,46,0,
+    72,111,108,116,101,107,0,72,111,108,116,101,107,32,77,105,99,114,111,101,
+    108,101,99,116,114,111,110,105,99,115,32,73,110,99,46,0,67,111,110,110,
+    101,99,116,32,84,101,99,104,0,67,111,110,110,101,99,116,32,84,101,99,
+    104,32,73,110,99,46,0,80,105,99,116,117,114,69,108,0,80,105,99,116,
+    117,114,101,32,69,108,101,109,101,110,116,115,32,73,110,99,46,0,77,105,
+    116,97,110,105,0,77,105,116,97,110,105,32,67,111,114,112,46,0,68,105,
+    97,108,111,103,105,99,0,68,105,97,108,111,103,105,99,32,67,111,114,112,
+    46,0,71,32,70,111,114,99,101,0,71,32,70,111,114,99,101,32,67,111,
+    46,32,76,116,100,46,0,71,105,103,105,32,79,112,115,0,71,105,103,105,
+    32,79,112,101,114,97,116,105,111,110,115,0,73,67,69,0,73,110,116,101,
+    103,114,97,116,101,100,32,67,111,109,112,117,116,105,110,103,32,69,110,103,
+    105,110,101,115,44,32,73,110,99,46,0,65,110,116,101,120,0,65,110,116,
+    101,120,32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,114,112,46,
+    0,80,108,117,116,111,0,80,108,117,116,111,32,84,101,99,104,110,111,108,
+    111,103,105,101,115,32,73,110,116,101,114,110,97,116,105,111,110,97,108,0,
+    65,105,109,115,32,76,97,98,0,78,101,116,115,112,101,101,100,0,78,101,
+    116,115,112,101,101,100,32,73,110,99,46,0,80,114,111,112,104,101,116,0,
+    80,114,111,112,104,101,116,32,83,121,115,116,101,109,115,32,73,110,99,46,
+    0,71,68,69,32,83,121,115,0,71,68,69,32,83,121,115,116,101,109,115,
+    32,73,110,99,46,0,80,115,105,84,101,99,104,0,86,105,110,103,109,101,
+    100,0,86,105,110,103,109,101,100,32,83,111,117,110,100,32,65,47,83,0,
+    85,108,116,105,99,111,109,0,85,108,116,105,99,111,109,44,32,73,110,99,
+    46,0,69,113,117,97,116,111,114,0,69,113,117,97,116,111,114,32,84,101,
+    99,104,110,111,108,111,103,105,101,115,0,65,110,97,108,111,103,105,99,0,
+    65,110,97,108,111,103,105,99,32,67,111,114,112,46,0,66,105,111,116,114,
+    111,110,105,99,0,66,105,111,116,114,111,110,105,99,32,83,82,76,0,80,
+    101,114,105,99,111,109,0,80,101,114,105,99,111,109,32,83,101,109,105,99,
+    111,110,100,117,99,116,111,114,0,65,99,117,108,97,98,0,65,99,117,108,
+    97,98,32,80,108,99,46,0,84,114,117,101,84,105,109,101,0,65,110,110,
+    97,112,111,108,105,115,0,65,110,110,97,112,111,108,105,115,32,77,105,99,
+    114,111,32,83,121,115,116,101,109,115,32,73,110,99,46,0,83,121,109,105,
+    99,114,111,110,0,83,121,109,105,99,114,111,110,32,67,111,109,112,117,116,
+    101,114,32,67,111,109,109,117,110,105,99,97,116,105,111,110,32,76,116,100,
+    46,0,77,71,73,0,77,97,110,97,103,101,109,101,110,116,32,71,114,97,
+    112,104,105,99,115,32,73,110,99,46,0,82,97,105,110,98,111,119,0,82,
+    97,105,110,98,111,119,32,84,101,99,104,110,111,108,111,103,105,101,115,0,
+    83,66,83,32,84,101,99,104,0,83,66,83,32,84,101,99,104,110,111,108,
+    111,103,105,101,115,32,73,110,99,46,0,67,104,97,115,101,0,67,104,97,
+    115,101,32,82,101,115,101,97,114,99,104,32,80,76,67,0,78,105,110,116,
+    101,110,100,111,0,78,105,110,116,101,110,100,111,32,67,111,46,32,76,116,
+    100,46,0,68,97,116,117,109,0,68,97,116,117,109,32,73,110,99,46,32,
+    66,97,110,99,111,109,109,45,84,105,109,105,110,103,32,68,105,118,105,115,
+    105,111,110,0,73,109,97,116,105,111,110,0,73,109,97,116,105,111,110,32,
+    67,111,114,112,46,32,45,32,77,101,100,105,99,97,108,32,73,109,97,103,
+    105,110,103,32,83,121,115,116,0,66,114,111,111,107,116,114,111,117,116,0,
+    66,114,111,111,107,116,114,111,117,116,32,84,101,99,104,110,111,108,111,103,
+    121,32,73,110,99,46,0,67,105,114,101,108,0,67,105,114,101,108,32,83,
+    121,115,116,101,109,115,0,83,101,98,114,105,110,103,0,83,101,98,114,105,
+    110,103,32,83,121,115,116,101,109,115,32,73,110,99,0,67,82,73,83,67,
+    0,67,82,73,83,67,32,67,111,114,112,46,0,71,69,32,83,112,97,99,
+    101,110,101,116,0,65,117,114,101,97,108,0,65,117,114,101,97,108,32,83,
+    101,109,105,99,111,110,100,117,99,116,111,114,0,51,65,32,73,110,116,108,
+    0,51,65,32,73,110,116,101,114,110,97,116,105,111,110,97,108,32,73,110,
+    99,46,0,79,112,116,105,118,105,115,105,111,110,0,79,112,116,105,118,105,
+    115,105,111,110,32,73,110,99,46,0,79,114,97,110,103,101,32,77,105,99,
+    114,111,0,79,114,97,110,103,101,32,77,105,99,114,111,44,32,73,110,99,
+    46,0,86,105,101,110,110,97,0,86,105,101,110,110,97,32,83,121,115,116,
+    101,109,115,0,80,101,110,116,101,107,0,83,111,114,101,110,115,111,110,0,
+    83,111,114,101,110,115,111,110,32,86,105,115,105,111,110,32,73,110,99,46,
+    0,71,97,109,109,97,103,114,97,112,104,120,0,71,97,109,109,97,103,114,
+    97,112,104,120,32,73,110,99,46,0,77,101,103,97,116,101,108,0,67,111,
+    103,110,101,120,0,69,108,101,99,116,114,111,110,105,99,45,68,101,115,105,
+    103,110,0,69,108,101,99,116,114,111,110,105,99,45,68,101,115,105,103,110,
+    32,71,109,98,72,0,70,70,84,0,70,111,117,114,70,111,108,100,32,84,
+    101,99,104,110,111,108,111,103,105,101,115,0,83,83,80,0,83,112,101,99,
+    116,114,117,109,32,83,105,103,110,97,108,32,80,114,111,99,101,115,115,105,
+    110,103,0,67,69,67,0,67,97,112,105,116,97,108,32,69,113,117,105,112,
+    109,101,110,116,32,67,111,114,112,0,101,115,100,0,101,115,100,32,69,108,
+    101,99,116,114,111,110,105,99,32,83,121,115,116,101,109,32,68,101,115,105,
+    103,110,32,71,109,98,72,0,73,73,0,73,110,110,111,118,97,116,105,118,
+    101,32,73,110,116,101,103,114,97,116,105,111,110,0,74,117,110,105,112,101,
+    114,32,78,101,116,119,111,114,107,115,32,73,110,99,46,0,67,111,109,112,
+    117,116,101,114,66,111,97,114,100,115,0,74,97,116,111,0,74,97,116,111,
+    32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,110,99,46,0,77,
+    105,116,115,117,98,105,115,104,105,32,69,108,101,99,116,114,105,99,32,77,
+    105,99,114,111,99,111,109,112,117,116,101,114,0,67,111,108,111,114,103,114,
+    97,112,104,105,99,0,67,111,108,111,114,103,114,97,112,104,105,99,32,67,
+    111,109,109,117,110,105,99,97,116,105,111,110,115,32,67,111,114,112,0,65,
+    100,118,97,110,101,116,32,73,110,99,46,0,71,101,115,112,97,99,0,82,
+    86,83,73,0,82,111,98,111,116,105,99,32,86,105,115,105,111,110,32,83,
+    121,115,116,101,109,115,32,73,110,99,111,114,112,111,114,97,116,101,100,0,
+    89,97,115,107,97,119,97,32,69,108,101,99,116,114,105,99,32,67,111,46,
+    0,84,101,114,97,100,121,110,101,32,73,110,99,46,0,65,68,77,116,101,
+    107,0,65,68,77,116,101,107,32,73,110,99,0,80,97,99,107,101,116,32,
+    69,110,103,105,110,101,115,0,80,97,99,107,101,116,32,69,110,103,105,110,
+    101,115,44,32,73,110,99,46,0,70,111,114,116,101,32,77,101,100,105,97,
+    50,0,70,111,114,116,101,32,77,101,100,105,97,0,83,73,73,71,0,83,
+    97,108,105,120,32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,110,
+    99,0,83,101,97,99,104,97,110,103,101,32,73,110,116,101,114,110,97,116,
+    105,111,110,97,108,0,67,73,70,69,76,76,73,0,67,73,70,69,76,76,
+    73,32,83,89,83,84,69,77,83,32,67,79,82,80,79,82,65,84,73,79,
+    78,0,82,97,100,105,83,121,115,0,82,97,100,105,83,121,115,32,67,111,
+    114,112,111,114,97,116,105,111,110,0,77,105,99,114,111,32,77,101,109,111,
+    114,121,0,77,105,99,114,111,32,77,101,109,111,114,121,44,32,76,76,67,
+    0,86,105,100,101,111,109,97,105,108,0,86,105,100,101,111,109,97,105,108,
+    32,73,110,99,46,0,80,114,105,115,97,32,78,101,116,119,111,114,107,115,
+    0,83,67,77,32,77,105,99,114,111,115,121,115,116,101,109,115,0,80,114,
+    111,109,97,120,32,83,121,115,116,101,109,115,32,73,110,99,0,77,105,99,
+    114,111,110,0,77,105,99,114,111,110,32,84,101,99,104,110,111,108,111,103,
+    121,44,32,73,110,99,46,0,83,112,101,99,116,114,97,99,111,109,0,83,
+    112,101,99,116,114,97,99,111,109,32,67,111,114,112,111,114,97,116,105,111,
+    110,0,68,84,67,32,84,101,99,104,110,111,108,111,103,121,32,67,111,114,
+    112,46,0,65,82,75,32,82,101,115,101,97,114,99,104,32,67,111,114,112,
+    46,0,67,104,111,114,105,32,74,111,104,111,32,83,121,115,116,101,109,32,
+    67,111,46,32,76,116,100,0,80,67,84,69,76,0,80,67,84,69,76,32,
+    73,110,99,46,0,66,114,97,105,110,32,66,111,120,101,115,32,76,105,109,
+    105,116,101,100,0,71,105,103,97,110,101,116,32,73,110,99,46,0,81,117,
+    97,116,101,99,104,32,73,110,99,0,65,66,66,32,78,101,116,119,111,114,
+    107,32,80,97,114,116,110,0,65,66,66,32,78,101,116,119,111,114,107,32,
+    80,97,114,116,110,101,114,32,65,66,0,83,101,97,108,101,118,101,108,0,
+    83,101,97,108,101,118,101,108,32,83,121,115,116,101,109,115,32,73,110,99,
+    46,0,73,45,68,97,116,97,32,73,110,116,101,114,110,97,116,105,111,110,
+    97,108,32,65,45,83,0,77,101,105,110,98,101,114,103,32,70,117,110,107,
+    117,104,114,101,110,0,77,101,105,110,98,101,114,103,32,70,117,110,107,117,
+    104,114,101,110,32,71,109,98,72,32,38,97,109,112,59,32,67,111,46,32,
+    75,71,0,83,111,108,105,116,111,110,32,83,121,115,116,101,109,115,32,75,
+    46,75,46,0,80,104,111,101,110,105,120,32,84,101,99,104,110,111,108,111,
+    103,105,101,115,32,76,116,100,0,72,121,112,101,114,99,111,112,101,0,72,
+    121,112,101,114,99,111,112,101,32,67,111,114,112,46,0,84,101,105,106,105,
+    110,0,84,101,105,106,105,110,32,83,101,105,107,105,32,67,111,46,32,76,
+    116,100,46,0,72,105,116,97,99,104,105,32,90,111,115,101,110,32,67,111,
+    114,112,111,114,97,116,105,111,110,0,83,107,121,119,97,114,101,32,67,111,
+    114,112,111,114,97,116,105,111,110,0,68,105,103,105,103,114,97,109,0,75,
+    97,119,97,115,97,107,105,32,83,116,101,101,108,32,67,111,114,112,111,114,
+    97,116,105,111,110,0,65,100,116,101,107,32,83,121,115,116,101,109,32,83,
+    99,105,101,110,99,101,32,67,111,32,76,116,100,0,66,111,101,105,110,103,
+    32,45,32,83,117,110,110,121,118,97,108,101,0,77,79,84,85,0,77,97,
+    114,107,32,79,102,32,84,104,101,32,85,110,105,99,111,114,110,32,73,110,
+    99,0,80,80,84,32,86,105,115,105,111,110,0,73,119,97,116,115,117,32,
+    69,108,101,99,116,114,105,99,32,67,111,32,76,116,100,0,68,121,110,97,
+    99,104,105,112,32,67,111,114,112,111,114,97,116,105,111,110,0,80,84,83,
+    67,0,80,97,116,114,105,111,116,32,83,99,105,101,110,116,105,102,105,99,
+    32,67,111,114,112,46,0,83,65,78,82,73,84,90,0,83,97,110,114,105,
+    116,122,32,65,117,116,111,109,97,116,105,111,110,32,67,111,32,76,84,67,
+    0,66,114,97,105,110,115,32,67,111,46,32,76,116,100,0,77,97,114,105,
+    97,110,0,77,97,114,105,97,110,32,45,32,69,108,101,99,116,114,111,110,
+    105,99,32,38,97,109,112,59,32,83,111,102,116,119,97,114,101,0,83,116,
+    101,108,108,97,114,32,83,101,109,105,99,111,110,100,117,99,116,111,114,32,
+    73,110,99,0,78,101,116,103,101,97,114,0,68,105,103,105,116,97,108,32,
+    83,105,103,110,97,108,32,80,114,111,99,101,115,115,105,110,103,0,72,105,
+    116,97,99,104,105,32,73,110,102,111,114,109,97,116,105,111,110,32,84,101,
+    99,104,110,111,108,111,103,121,32,67,111,32,76,116,100,0,65,112,112,108,
+    105,99,111,109,0,65,112,112,108,105,99,111,109,32,73,110,116,101,114,110,
+    97,116,105,111,110,97,108,0,84,111,107,105,109,101,99,32,73,110,99,0,
+    66,97,115,108,101,114,32,71,77,66,72,0,80,97,116,97,112,115,99,111,
+    32,68,101,115,105,103,110,115,32,73,110,99,0,67,68,73,0,67,111,110,
+    99,101,112,116,32,68,101,118,101,108,111,112,109,101,110,116,32,73,110,99,
+    46,0,77,111,120,97,32,84,101,99,104,110,111,108,111,103,105,101,115,32,
+    67,111,32,76,116,100,0,76,101,118,101,108,32,79,110,101,0,76,101,118,
+    101,108,32,79,110,101,32,67,111,109,109,117,110,105,99,97,116,105,111,110,
+    115,0,65,109,98,105,99,111,109,32,73,110,99,0,67,105,112,104,101,114,
+    32,83,121,115,116,101,109,115,32,73,110,99,0,67,111,108,111,103,110,101,
+    0,67,111,108,111,103,110,101,32,67,104,105,112,32,68,101,115,105,103,110,
+    115,32,71,109,98,72,0,67,108,97,114,105,111,110,32,67,111,46,32,76,
+    116,100,0,65,108,97,99,114,105,116,101,99,104,32,73,110,99,0,88,115,
+    116,114,101,97,109,115,32,80,76,67,47,32,69,80,76,32,76,105,109,105,
+    116,101,100,0,69,99,104,111,115,116,97,114,32,68,97,116,97,32,78,101,
+    116,119,111,114,107,115,0,67,114,121,115,116,97,108,32,71,114,111,117,112,
+    32,73,110,99,0,75,97,119,97,115,97,107,105,32,72,101,97,118,121,32,
+    73,110,100,117,115,116,114,105,101,115,32,76,116,100,0,72,73,45,70,78,
+    0,72,73,45,70,78,32,73,110,99,46,0,82,97,115,99,111,109,32,73,
+    110,99,0,97,109,99,51,51,48,0,88,82,0,69,120,97,114,32,67,111,
+    114,112,46,0,83,105,101,109,101,110,115,32,77,101,100,105,99,97,108,32,
+    83,111,108,117,116,105,111,110,115,0,78,111,114,116,101,108,32,78,101,116,
+    119,111,114,107,115,32,45,32,66,87,65,32,68,105,118,105,115,105,111,110,
+    0,84,46,83,113,119,97,114,101,0,84,97,109,117,114,97,32,67,111,114,
+    112,111,114,97,116,105,111,110,0,87,101,108,108,98,101,97,110,32,67,111,
+    32,73,110,99,0,65,82,77,32,76,116,100,0,112,99,105,92,118,101,110,
+    95,49,51,98,54,0,68,76,111,71,32,71,77,66,72,0,78,111,107,105,
+    97,32,84,101,108,101,99,111,109,109,117,110,105,99,97,116,105,111,110,115,
+    32,79,89,0,83,72,65,82,80,0,83,104,97,114,112,32,67,111,114,112,
+    111,114,97,116,105,111,110,0,83,104,97,114,101,119,97,118,101,32,73,110,
+    99,0,77,105,99,114,111,103,97,116,101,0,77,105,99,114,111,103,97,116,
+    101,32,67,111,114,112,46,0,51,119,97,114,101,0,51,119,97,114,101,32,
+    73,110,99,46,0,84,101,99,104,110,111,116,114,101,110,100,32,83,121,115,
+    116,101,109,116,101,99,104,110,105,107,32,71,77,66,72,0,74,97,110,122,
+    32,67,111,109,112,117,116,101,114,32,65,71,0,66,108,117,101,32,67,104,
+    105,112,32,84,101,99,104,110,111,108,111,103,121,32,76,116,100,0,77,101,
+    116,104,101,117,115,32,67,111,114,112,111,114,97,116,105,111,110,0,83,116,
+    117,100,105,111,32,65,117,100,105,111,32,38,97,109,112,59,32,86,105,100,
+    101,111,32,76,116,100,0,66,50,67,50,32,73,110,99,0,65,98,111,67,
+    111,109,0,65,98,111,67,111,109,32,83,121,115,116,101,109,115,44,32,73,
+    110,99,0,71,114,97,112,104,105,99,115,32,77,105,99,114,111,115,121,115,
+    116,101,109,115,32,73,110,99,0,75,46,73,46,32,84,101,99,104,110,111,
+    108,111,103,121,32,67,111,32,76,116,100,0,84,111,115,104,105,98,97,32,
+    69,110,103,105,110,101,101,114,105,110,103,32,67,111,114,112,111,114,97,116,
+    105,111,110,0,80,104,111,98,111,115,32,67,111,114,112,111,114,97,116,105,
+    111,110,0,65,112,101,120,32,73,110,99,0,78,101,116,98,111,111,115,116,
+    32,67,111,114,112,111,114,97,116,105,111,110,0,65,66,66,32,82,111,98,
+    111,116,105,99,115,32,80,114,111,100,117,99,116,115,32,65,66,0,69,45,
+    84,101,99,104,0,69,45,84,101,99,104,32,73,110,99,46,0,71,86,67,
+    0,71,86,67,32,67,111,114,112,111,114,97,116,105,111,110,0,78,101,115,
+    116,32,73,110,99,0,67,97,108,99,117,108,101,120,32,73,110,99,0,84,
+    101,108,101,115,111,102,116,32,68,101,115,105,103,110,32,76,116,100,0,73,
+    110,116,114,97,115,101,114,118,101,114,32,84,101,99,104,110,111,108,111,103,
+    121,32,73,110,99,0,68,97,108,108,97,115,32,83,101,109,105,99,111,110,
+    100,117,99,116,111,114,0,73,67,32,80,108,117,115,32,67,111,114,112,111,
+    114,97,116,105,111,110,0,79,67,69,32,45,32,73,110,100,117,115,116,114,
+    105,101,115,32,83,46,65,46,0,84,114,111,105,107,97,32,78,101,116,119,
+    111,114,107,115,32,73,110,99,0,67,45,77,101,100,105,97,0,67,45,77,
+    101,100,105,97,32,69,108,101,99,116,114,111,110,105,99,115,32,73,110,99,
+    46,0,78,84,84,32,65,100,118,97,110,99,101,100,32,84,101,99,104,110,
+    111,108,111,103,121,32,67,111,114,112,46,0,80,101,110,116,108,97,110,100,
+    0,80,101,110,116,108,97,110,100,32,83,121,115,116,101,109,115,32,76,116,
+    100,46,0,65,121,100,105,110,32,67,111,114,112,0,77,105,99,114,111,32,
+    83,99,105,101,110,99,101,32,73,110,99,0,65,100,118,97,110,116,101,99,
+    104,0,65,100,118,97,110,116,101,99,104,32,67,111,46,44,32,76,116,100,
+    46,0,83,105,108,105,99,111,110,32,83,112,105,99,101,32,73,110,99,46,
+    0,65,114,116,88,0,65,114,116,88,32,73,110,99,0,77,101,105,108,104,
+    97,117,115,32,69,108,101,99,116,114,111,110,105,99,0,77,101,105,108,104,
+    97,117,115,32,69,108,101,99,116,114,111,110,105,99,32,71,109,98,72,32,
+    71,101,114,109,97,110,121,0,70,117,110,100,97,109,101,110,116,97,108,32,
+    83,111,102,116,119,97,114,101,32,73,110,99,0,79,99,0,79,99,101,32,
+    80,114,105,110,116,32,76,111,103,105,99,115,32,84,101,99,104,110,111,108,
+    111,103,105,101,115,32,83,46,65,46,0,76,65,86,65,0,76,97,118,97,
+    32,67,111,109,112,117,116,101,114,32,77,70,71,32,73,110,99,46,0,65,
+    108,111,107,97,32,67,111,46,32,76,116,100,0,83,85,78,73,88,0,83,
+    85,78,73,88,32,67,111,46,44,32,76,116,100,46,0,68,83,80,32,82,
+    101,115,101,97,114,99,104,32,73,110,99,0,82,97,109,105,120,32,73,110,
+    99,0,77,97,116,115,117,115,104,105,116,97,32,69,108,101,99,116,114,105,
+    99,32,87,111,114,107,115,32,76,116,100,0,83,97,108,105,101,110,116,32,
+    83,121,115,116,101,109,115,32,67,111,114,112,0,73,67,32,69,110,115,101,
+    109,98,108,101,0,73,67,32,69,110,115,101,109,98,108,101,44,32,73,110,
+    99,46,0,65,100,100,111,110,105,99,115,0,79,120,102,111,114,100,0,79,
+    120,102,111,114,100,32,83,101,109,105,99,111,110,100,117,99,116,111,114,32,
+    76,116,100,0,75,121,117,115,104,117,32,69,108,101,99,116,114,111,110,105,
+    99,115,32,83,121,115,116,101,109,115,32,73,110,99,0,69,120,99,101,108,
+    32,83,119,105,116,99,104,105,110,103,32,67,111,114,112,0,90,111,111,109,
+    32,84,101,108,101,112,104,111,110,105,99,115,32,73,110,99,0,70,97,110,
+    117,99,32,67,111,46,32,76,116,100,0,86,105,115,105,111,110,116,101,99,
+    104,32,76,116,100,0,80,115,105,111,110,32,68,97,99,111,109,32,80,76,
+    67,0,65,83,73,67,32,68,101,115,105,103,110,101,114,115,32,73,110,99,
+    0,69,100,101,99,32,67,111,32,76,116,100,0,85,110,101,120,32,84,101,
+    99,104,110,111,108,111,103,121,32,67,111,114,112,46,0,75,105,110,103,109,
+    97,120,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,0,82,97,
+    100,105,111,108,97,110,0,77,105,110,116,111,110,32,79,112,116,105,99,32,
+    73,110,100,117,115,116,114,121,32,67,111,32,76,116,100,0,80,105,120,115,
+    116,114,101,97,109,32,73,110,99,0,73,84,84,32,65,101,114,111,115,112,
+    97,99,101,47,67,111,109,109,117,110,105,99,97,116,105,111,110,115,32,68,
+    105,118,105,115,105,111,110,0,69,108,116,101,99,32,69,108,101,107,116,114,
+    111,110,105,107,32,65,71,0,82,84,68,0,82,84,68,32,69,109,98,101,
+    100,100,101,100,32,84,101,99,104,110,111,108,111,103,105,101,115,44,32,73,
+    110,99,46,0,67,73,83,32,84,101,99,104,110,111,108,111,103,121,32,73,
+    110,99,0,78,105,115,115,105,110,32,73,110,99,32,67,111,0,65,116,109,
+    101,108,45,68,114,101,97,109,0,76,105,103,104,116,119,101,108,108,32,67,
+    111,32,76,116,100,32,45,32,90,97,120,32,68,105,118,105,115,105,111,110,
+    0,65,103,105,101,32,83,65,46,0,85,110,105,98,114,97,105,110,0,85,
+    110,105,98,114,97,105,110,32,83,46,65,46,0,76,111,103,105,99,97,108,
+    32,67,111,32,76,116,100,0,71,114,97,112,104,105,110,32,67,111,46,32,
+    76,116,100,0,65,105,109,32,71,77,66,72,0,65,108,101,115,105,115,0,
+    65,108,101,115,105,115,32,83,116,117,100,105,111,0,65,68,76,73,78,75,
+    0,65,68,76,73,78,75,32,84,101,99,104,110,111,108,111,103,121,32,73,
+    110,99,0,76,111,114,111,110,105,120,0,76,111,114,111,110,105,120,32,73,
+    110,102,111,114,109,97,116,105,111,110,32,83,121,115,116,101,109,115,44,32,
+    73,110,99,46,0,115,97,110,121,111,0,79,99,116,97,118,101,32,67,111,
+    109,109,117,110,105,99,97,116,105,111,110,115,32,73,110,100,46,0,83,80,
+    51,68,32,67,104,105,112,32,68,101,115,105,103,110,32,71,77,66,72,0,
+    77,121,99,111,109,32,73,110,99,0,71,105,103,97,45,66,121,116,101,0,
+    71,105,103,97,45,66,121,116,101,32,84,101,99,104,110,111,108,111,103,105,
+    101,115,0,67,114,121,112,116,101,107,0,66,97,108,100,111,114,0,66,97,
+    108,100,111,114,32,69,108,101,99,116,114,105,99,32,67,111,109,112,97,110,
+    121,0,68,121,110,97,114,99,32,73,110,99,0,77,83,73,0,77,105,99,
+    114,111,45,83,116,97,114,32,73,110,116,101,114,110,97,116,105,111,110,97,
+    108,32,67,111,32,76,116,100,0,70,97,115,116,32,67,111,114,112,111,114,
+    97,116,105,111,110,0,73,110,116,101,114,97,99,116,105,118,101,32,67,105,
+    114,99,117,105,116,115,32,38,97,109,112,59,32,83,121,115,116,101,109,115,
+    32,76,116,100,0,65,109,98,105,116,32,77,105,99,114,111,115,121,115,116,
+    101,109,115,32,67,111,114,112,46,0,67,108,101,118,101,108,97,110,100,32,
+    77,111,116,105,111,110,32,67,111,110,116,114,111,108,115,0,82,117,98,121,
+    32,84,101,99,104,32,67,111,114,112,46,0,84,97,99,104,121,111,110,32,
+    73,110,99,46,0,87,77,83,32,71,97,109,105,110,103,0,73,110,116,101,
+    103,114,97,116,101,100,32,84,101,108,101,99,111,109,32,69,120,112,114,101,
+    115,115,32,73,110,99,0,90,97,112,101,120,32,84,101,99,104,110,111,108,
+    111,103,105,101,115,32,73,110,99,0,68,111,117,103,32,67,97,114,115,111,
+    110,32,38,97,109,112,59,32,65,115,115,111,99,105,97,116,101,115,0,78,
+    101,116,32,73,110,115,105,103,104,116,0,68,105,97,116,114,101,110,100,32,
+    67,111,114,112,111,114,97,116,105,111,110,0,65,98,105,116,32,67,111,109,
+    112,117,116,101,114,32,67,111,114,112,46,0,78,105,104,111,110,32,85,110,
+    105,115,121,115,32,76,116,100,46,0,73,115,121,116,101,99,32,45,32,73,
+    110,116,101,103,114,105,101,114,116,101,32,83,121,115,116,101,109,116,101,99,
+    104,110,105,107,32,71,109,98,104,0,76,97,98,119,97,121,32,67,111,112,
+    111,114,97,116,105,111,110,0,69,114,109,97,32,45,32,69,108,101,99,116,
+    114,111,110,105,99,32,71,77,66,72,0,75,89,69,32,83,121,115,116,101,
+    109,115,32,67,111,114,112,111,114,97,116,105,111,110,0,79,112,116,111,32,
+    50,50,0,73,110,110,111,109,101,100,105,97,108,111,103,105,99,32,73,110,
+    99,46,0,67,80,32,40,80,111,119,101,114,67,111,108,111,114,41,0,67,
+    46,80,46,32,84,101,99,104,110,111,108,111,103,121,32,67,111,46,32,76,
+    116,100,0,68,105,103,105,99,111,109,32,83,121,115,116,101,109,115,32,73,
+    110,99,46,0,79,83,73,32,80,108,117,115,32,67,111,114,112,111,114,97,
+    116,105,111,110,0,80,108,97,110,116,32,69,113,117,105,112,109,101,110,116,
+    32,73,110,99,46,0,84,67,32,76,97,98,115,32,80,116,121,32,76,116,
+    100,46,0,77,97,107,101,114,32,67,111,109,109,117,110,105,99,97,116,105,
+    111,110,115,0,84,111,107,97,105,32,67,111,109,109,117,110,105,99,97,116,
+    105,111,110,115,32,73,110,100,117,115,116,114,121,32,67,111,46,32,76,116,
+    100,0,74,111,121,116,101,99,104,32,67,111,109,112,117,116,101,114,32,67,
+    111,46,32,76,116,100,46,0,83,77,65,0,83,77,65,32,84,101,99,104,
+    110,111,108,111,103,105,101,32,65,71,0,84,101,119,115,0,84,101,119,115,
+    32,84,101,99,104,110,111,108,111,103,105,101,115,0,77,105,99,114,111,45,
+    84,101,99,104,110,111,108,111,103,121,32,67,111,32,76,116,100,0,65,110,
+    100,111,114,32,84,101,99,104,0,65,110,100,111,114,32,84,101,99,104,110,
+    111,108,111,103,121,32,76,116,100,0,83,101,105,107,111,32,73,110,115,116,
+    114,117,109,101,110,116,115,32,73,110,99,0,77,97,112,108,101,116,114,101,
+    101,32,78,101,116,119,111,114,107,115,32,73,110,99,46,0,76,101,99,116,
+    114,111,110,32,67,111,32,76,116,100,0,83,111,102,116,105,110,103,32,71,
+    77,66,72,0,77,105,108,108,101,110,110,105,117,109,32,69,110,103,105,110,
+    101,101,114,105,110,103,32,73,110,99,0,71,86,67,47,66,67,77,32,65,
+    100,118,97,110,99,101,100,32,82,101,115,101,97,114,99,104,0,72,105,118,
+    101,114,116,101,99,32,73,110,99,46,0,77,101,110,116,111,114,32,71,114,
+    97,112,104,105,99,115,32,67,111,114,112,46,0,78,101,120,116,99,111,109,
+    32,75,46,75,46,0,88,112,101,101,100,0,88,112,101,101,100,32,73,110,
+    99,46,0,80,104,105,108,105,112,115,32,66,117,115,105,110,101,115,115,32,
+    69,108,101,99,116,114,111,110,105,99,115,32,66,46,86,46,0,67,114,101,
+    97,109,119,97,114,101,0,67,114,101,97,109,119,97,114,101,32,71,109,98,
+    72,0,81,117,97,110,116,117,109,32,68,97,116,97,32,67,111,114,112,46,
+    0,80,114,111,120,105,109,0,80,114,111,120,105,109,32,73,110,99,46,0,
+    65,105,114,111,110,101,116,0,65,105,114,111,110,101,116,32,87,105,114,101,
+    108,101,115,115,32,67,111,109,109,117,110,105,99,97,116,105,111,110,0,73,
+    110,116,101,114,110,105,120,32,73,110,99,46,0,83,101,109,116,101,99,104,
+    32,67,111,114,112,111,114,97,116,105,111,110,0,76,51,32,67,111,109,109,
+    117,110,105,99,97,116,105,111,110,115,0,67,111,109,112,97,108,0,67,111,
+    109,112,97,108,32,69,108,101,99,116,114,111,110,105,99,115,44,32,73,110,
+    99,46,0,77,121,114,105,99,111,109,32,73,110,99,46,0,68,84,75,32,
+    67,111,109,112,117,116,101,114,0,73,119,97,115,97,107,105,32,73,110,102,
+    111,114,109,97,116,105,111,110,32,83,121,115,116,101,109,115,32,67,111,32,
+    76,116,100,0,65,66,66,32,65,117,116,111,109,97,116,105,111,110,32,80,
+    114,111,100,117,99,116,115,32,65,66,0,68,97,116,97,32,82,97,99,101,
+    32,73,110,99,0,77,111,100,116,101,99,104,0,77,111,100,117,108,97,114,
+    32,84,101,99,104,110,111,108,111,103,121,32,76,116,100,46,0,84,117,114,
+    98,111,99,111,109,109,0,84,117,114,98,111,99,111,109,109,32,84,101,99,
+    104,32,73,110,99,0,79,100,105,110,32,84,101,108,101,115,121,115,116,101,
+    109,115,32,73,110,99,0,66,105,108,108,105,111,110,116,111,110,32,83,121,
+    115,116,101,109,115,32,73,110,99,46,47,67,97,100,109,117,115,32,77,105,
+    99,114,111,32,73,110,99,0,85,110,105,118,101,114,115,97,108,32,83,99,
+    105,101,110,116,105,102,105,99,32,73,110,100,46,0,84,101,107,109,105,99,
+    114,111,0,84,69,75,32,77,105,99,114,111,115,121,115,116,101,109,115,32,
+    73,110,99,46,0,80,65,78,65,67,79,77,0,80,97,110,97,99,111,109,
+    32,84,101,99,104,110,111,108,111,103,121,32,67,111,114,112,111,114,97,116,
+    105,111,110,0,78,105,116,115,117,107,111,32,67,111,114,112,111,114,97,116,
+    105,111,110,0,65,99,99,117,115,121,115,32,73,110,99,0,72,105,114,97,
+    107,97,119,97,32,72,101,119,116,101,99,104,32,67,111,114,112,0,72,111,
+    112,102,32,69,108,101,107,116,114,111,110,105,107,32,71,77,66,72,0,65,
+    108,112,104,97,32,80,114,111,99,101,115,115,111,114,32,73,110,99,0,65,
+    118,108,97,98,0,65,118,108,97,98,32,84,101,99,104,110,111,108,111,103,
+    121,32,73,110,99,46,0,65,109,112,108,105,99,111,110,0,65,109,112,108,
+    105,99,111,110,32,76,105,118,101,108,105,110,101,32,76,105,109,105,116,101,
+    100,0,73,109,111,100,108,32,73,110,99,46,0,65,112,112,108,105,101,100,
+    32,73,110,116,101,103,114,97,116,105,111,110,32,67,111,114,112,111,114,97,
+    116,105,111,110,0,65,109,116,101,108,99,111,0,66,114,111,97,100,99,111,
+    109,0,66,114,111,97,100,99,111,109,32,67,111,114,112,111,114,97,116,105,
+    111,110,0,80,108,97,110,101,120,0,80,108,97,110,101,120,32,67,111,109,
+    109,117,110,105,99,97,116,105,111,110,115,44,32,73,110,99,46,0,65,99,
+    113,105,114,105,115,0,68,97,116,97,107,105,110,101,116,105,99,115,32,76,
+    116,100,0,67,97,114,114,121,32,67,111,109,112,117,116,101,114,32,69,110,
+    103,46,32,67,111,32,76,116,100,0,67,111,110,101,120,97,110,116,0,67,
+    111,110,101,120,97,110,116,32,83,121,115,116,101,109,115,44,32,73,110,99,
+    46,0,77,111,98,105,108,105,116,121,0,77,111,98,105,108,105,116,121,32,
+    69,108,101,99,116,114,111,110,105,99,115,44,32,73,110,99,46,0,84,111,
+    107,121,111,32,69,108,101,99,116,114,111,110,105,99,32,73,110,100,117,115,
+    116,114,121,32,67,111,46,32,76,116,100,46,0,83,111,112,97,99,32,76,
+    116,100,0,67,111,121,111,116,101,32,84,101,99,104,110,111,108,111,103,105,
+    101,115,32,76,76,67,0,87,111,108,102,32,84,101,99,104,110,111,108,111,
+    103,121,32,73,110,99,0,65,117,100,105,111,99,111,100,101,115,32,73,110,
+    99,0,65,71,32,67,111,109,109,117,110,105,99,97,116,105,111,110,115,0,
+    84,114,97,110,115,97,115,32,77,97,114,105,110,101,32,40,85,75,41,32,
+    76,116,100,0,81,117,97,100,114,105,99,115,32,76,116,100,0,83,105,108,
+    101,120,0,83,105,108,101,120,32,84,101,99,104,110,111,108,111,103,121,32,
+    73,110,99,46,0,65,114,99,104,116,101,107,32,84,101,108,101,99,111,109,
+    32,67,111,114,112,46,0,84,119,105,110,104,101,97,100,32,73,110,116,101,
+    114,110,97,116,105,111,110,97,108,32,67,111,114,112,46,0,66,97,110,107,
+    115,111,102,116,32,67,97,110,97,100,97,32,76,116,100,0,77,105,116,115,
+    117,98,105,115,104,105,32,69,108,101,99,116,114,105,99,32,76,111,103,105,
+    115,116,105,99,115,32,83,117,112,112,111,114,116,32,67,111,0,75,97,119,
+    97,115,97,107,105,32,76,83,73,32,85,83,65,32,73,110,99,0,75,97,
+    105,115,101,114,32,69,108,101,99,116,114,111,110,105,99,115,0,67,104,97,
+    109,101,108,101,111,110,32,83,121,115,116,101,109,115,32,73,110,99,0,72,
+    116,101,99,0,72,116,101,99,32,76,116,100,46,0,70,105,114,115,116,32,
+    73,110,116,101,114,110,97,116,105,111,110,97,108,32,67,111,109,112,117,116,
+    101,114,32,73,110,99,0,89,97,109,97,115,104,105,116,97,32,83,121,115,
+    116,101,109,115,32,67,111,114,112,0,75,121,111,112,97,108,32,67,111,32,
+    76,116,100,0,87,97,114,112,115,112,112,101,100,32,73,110,99,0,67,45,
+    80,111,114,116,32,67,111,114,112,111,114,97,116,105,111,110,0,73,110,116,
+    101,99,32,71,77,66,72,0,66,101,104,97,118,105,111,114,32,84,101,99,
+    104,32,67,111,109,112,117,116,101,114,32,67,111,114,112,0,67,101,110,116,
+    105,108,108,105,117,109,32,84,101,99,104,110,111,108,111,103,121,32,67,111,
+    114,112,0,82,111,115,101,110,0,82,111,115,117,110,32,84,101,99,104,110,
+    111,108,111,103,105,101,115,32,73,110,99,0,82,97,121,99,104,101,109,0,
+    84,70,76,32,76,65,78,32,73,110,99,0,73,67,83,32,65,100,118,101,
+    110,116,0,77,121,115,111,110,32,84,101,99,104,110,111,108,111,103,121,32,
+    73,110,99,0,69,99,104,111,116,101,107,32,67,111,114,112,111,114,97,116,
+    105,111,110,0,75,111,110,116,114,111,110,32,77,111,100,117,108,97,114,32,
+    67,111,109,112,117,116,101,114,115,32,71,109,98,72,32,40,80,69,80,32,
+    77,111,100,117,108,97,114,32,67,111,109,112,117,116,101,114,115,32,71,77,
+    66,72,41,0,84,101,108,101,102,111,110,32,65,107,116,105,101,98,111,108,
+    97,103,101,116,32,76,77,32,69,114,105,99,115,115,111,110,0,71,108,111,
+    98,101,116,101,107,0,71,108,111,98,101,116,101,107,32,73,110,99,46,0,
+    119,101,115,97,109,0,67,111,109,98,111,120,32,76,116,100,0,68,105,103,
+    105,116,97,108,32,65,117,100,105,111,32,76,97,98,115,32,73,110,99,0,
+    70,117,106,105,116,115,117,32,67,111,109,112,117,116,101,114,32,80,114,111,
+    100,117,99,116,115,32,79,102,32,65,109,101,114,105,99,97,0,77,97,116,
+    114,105,120,32,67,111,114,112,46,0,84,111,112,105,99,32,83,101,109,105,
+    99,111,110,100,117,99,116,111,114,32,67,111,114,112,0,67,104,97,112,108,
+    101,116,32,83,121,115,116,101,109,32,73,110,99,0,66,101,108,108,32,67,
+    111,114,112,111,114,97,116,105,111,110,0,77,97,105,110,112,105,110,101,0,
+    77,97,105,110,112,105,110,101,32,76,105,109,105,116,101,100,0,77,117,115,
+    105,99,32,83,101,109,105,99,111,110,100,117,99,116,111,114,115,0,109,97,
+    121,101,114,0,69,78,69,32,84,101,99,104,110,111,108,111,103,121,32,73,
+    110,99,0,73,109,112,97,99,116,32,84,101,99,104,110,111,108,111,103,105,
+    101,115,0,73,83,83,32,73,110,99,0,83,111,108,101,99,116,114,111,110,
+    0,65,99,107,115,121,115,0,65,109,101,114,105,99,97,110,32,77,105,99,
+    114,111,115,121,115,116,101,109,115,32,73,110,99,0,81,117,105,99,107,116,
+    117,114,110,32,68,101,115,105,103,110,32,83,121,115,116,101,109,115,0,70,
+    108,121,116,101,99,104,32,84,101,99,104,110,111,108,111,103,121,32,67,111,
+    32,76,116,100,0,77,97,99,114,97,105,103,111,114,32,83,121,115,116,101,
+    109,115,32,76,76,67,0,81,117,97,110,116,97,32,67,111,109,112,117,116,
+    101,114,32,73,110,99,0,77,101,108,101,99,32,73,110,99,0,80,104,105,
+    108,105,112,115,32,45,32,67,114,121,112,116,111,0,69,99,104,101,108,111,
+    110,32,67,111,114,112,111,114,97,116,105,111,110,0,66,97,108,116,105,109,
+    111,114,101,0,82,111,97,100,32,67,111,114,112,111,114,97,116,105,111,110,
+    0,69,118,101,114,103,114,101,101,110,32,84,101,99,104,110,111,108,111,103,
+    105,101,115,32,73,110,99,0,68,97,116,97,108,101,120,32,67,111,109,109,
+    117,110,99,97,116,105,111,110,115,0,65,114,97,108,105,111,110,0,65,114,
+    97,108,105,111,110,32,73,110,99,46,0,65,116,101,108,105,101,114,32,73,
+    110,102,111,114,109,97,116,105,113,117,101,115,32,101,116,32,69,108,101,99,
+    116,114,111,110,105,113,117,101,32,69,116,0,79,78,79,32,83,111,107,107,
+    105,0,99,97,109,105,0,84,101,114,114,97,116,101,99,32,69,108,101,99,
+    116,114,111,110,105,99,32,71,77,66,72,0,65,110,116,97,108,32,69,108,
+    101,99,116,114,111,110,105,99,0,70,105,108,97,110,101,116,32,67,111,114,
+    112,111,114,97,116,105,111,110,0,84,101,99,104,119,101,108,108,0,84,101,
+    99,104,119,101,108,108,32,73,110,99,0,77,73,80,83,0,77,73,80,83,
+    32,84,101,99,104,110,111,108,111,103,105,101,115,44,32,73,110,99,0,80,
+    114,111,118,105,100,101,111,32,77,117,108,116,105,109,101,100,105,97,32,67,
+    111,32,76,116,100,0,84,101,108,111,99,105,116,121,32,73,110,99,46,0,
+    86,105,118,105,100,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,
+    0,83,105,108,105,99,111,110,32,76,97,98,111,114,97,116,111,114,105,101,
+    115,0,68,67,77,0,68,67,77,32,84,101,99,104,110,111,108,111,103,105,
+    101,115,32,76,116,100,46,0,86,105,115,105,111,110,116,101,107,0,86,105,
+    115,105,111,110,84,101,107,0,73,79,73,32,84,101,99,104,110,111,108,111,
+    103,121,32,67,111,114,112,46,0,77,105,116,117,116,111,121,111,32,67,111,
+    114,112,111,114,97,116,105,111,110,0,74,101,116,32,80,114,111,112,117,108,
+    115,105,111,110,32,76,97,98,111,114,97,116,111,114,121,0,73,83,83,0,
+    73,110,116,101,114,99,111,110,110,101,99,116,32,83,121,115,116,101,109,115,
+    32,83,111,108,117,116,105,111,110,115,0,77,97,120,32,84,101,99,104,110,
+    111,108,111,103,105,101,115,32,73,110,99,46,0,67,111,109,112,117,116,101,
+    120,32,67,111,32,76,116,100,0,86,105,115,117,97,108,32,84,101,99,104,
+    110,111,108,111,103,121,32,73,110,99,46,0,80,65,78,32,73,110,116,101,
+    114,110,97,116,105,111,110,97,108,32,73,110,100,117,115,116,114,105,97,108,
+    32,67,111,114,112,0,83,101,114,118,111,116,101,115,116,32,76,116,100,0,
+    83,116,114,97,116,97,98,101,97,109,32,84,101,99,104,110,111,108,111,103,
+    121,0,79,112,101,110,32,78,101,116,119,111,114,107,32,67,111,32,76,116,
+    100,0,83,109,97,114,116,32,69,108,101,99,116,114,111,110,105,99,32,68,
+    101,118,101,108,111,112,109,101,110,116,32,71,77,66,72,0,67,104,105,99,
+    111,110,121,32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,32,76,
+    116,100,0,80,77,67,0,80,114,111,108,105,110,107,32,77,105,99,114,111,
+    115,121,115,116,101,109,115,32,67,111,114,112,46,0,71,101,115,121,116,101,
+    99,0,71,101,115,121,116,101,99,32,71,109,98,72,0,80,76,68,32,65,
+    112,112,108,105,99,97,116,105,111,110,115,0,77,101,100,105,97,115,116,97,
+    114,32,67,111,46,32,76,116,100,0,67,108,101,118,111,47,75,97,112,111,
+    107,32,67,111,109,112,117,116,101,114,0,83,73,32,76,111,103,105,99,32,
+    76,116,100,0,73,110,110,111,109,101,100,105,97,32,73,110,99,0,80,114,
+    111,116,97,99,32,73,110,116,101,114,110,97,116,105,111,110,97,108,32,67,
+    111,114,112,0,115,0,77,65,67,32,83,121,115,116,101,109,32,67,111,32,
+    76,116,100,0,75,82,0,75,85,75,65,32,82,111,98,111,116,101,114,32,
+    71,109,98,72,0,80,101,114,108,101,32,83,121,115,116,101,109,115,32,76,
+    105,109,105,116,101,100,0,84,101,114,97,121,111,110,32,67,111,109,109,117,
+    110,105,99,97,116,105,111,110,115,32,83,121,115,116,101,109,115,0,86,105,
+    101,119,103,114,97,112,104,105,99,115,32,73,110,99,0,83,121,109,98,111,
+    108,32,84,101,99,104,110,111,108,111,103,105,101,115,44,32,73,110,99,46,
+    0,65,45,84,114,101,110,100,32,84,101,99,104,110,111,108,111,103,121,32,
+    67,111,32,76,116,100,0,89,97,109,97,107,97,116,115,117,32,69,108,101,
+    99,116,114,111,110,105,99,115,32,73,110,100,117,115,116,114,121,32,67,111,
+    32,76,116,100,0,120,121,122,0,66,105,111,115,116,97,114,32,77,105,99,
+    114,111,116,101,99,104,32,73,110,116,108,32,67,111,114,112,0,65,114,100,
+    101,110,116,32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,110,99,
+    0,74,117,110,103,115,111,102,116,0,68,68,75,32,69,108,101,99,116,114,
+    111,110,105,99,115,32,73,110,99,0,65,108,101,107,115,83,80,98,0,80,
+    97,108,105,116,32,77,105,99,114,111,115,121,115,116,101,109,115,32,73,110,
+    99,0,65,118,116,101,99,0,65,118,116,101,99,32,83,121,115,116,101,109,
+    115,32,73,110,99,0,83,50,105,111,32,73,110,99,0,86,105,100,97,99,
+    32,69,108,101,99,116,114,111,110,105,99,115,32,71,77,66,72,0,65,108,
+    112,104,97,45,84,111,112,32,67,111,114,112,0,65,108,102,97,32,73,110,
+    99,46,0,77,45,83,121,115,116,101,109,115,32,70,108,97,115,104,32,68,
+    105,115,107,32,80,105,111,110,101,101,114,115,32,76,116,100,0,76,101,99,
+    114,111,121,32,67,111,114,112,111,114,97,116,105,111,110,0,67,111,110,116,
+    101,109,112,111,114,97,114,121,32,67,111,110,116,114,111,108,115,0,79,116,
+    105,115,32,69,108,101,118,97,116,111,114,32,67,111,109,112,97,110,121,0,
+    76,97,116,116,105,99,101,32,45,32,86,97,110,116,105,115,0,70,97,105,
+    114,99,104,105,108,100,32,83,101,109,105,99,111,110,100,117,99,116,111,114,
+    0,86,111,108,116,97,105,114,101,32,65,100,118,97,110,99,101,100,32,68,
+    97,116,97,32,83,101,99,117,114,105,116,121,32,76,116,100,0,86,105,101,
+    119,99,97,115,116,32,67,111,109,0,72,105,116,116,0,68,117,97,108,32,
+    84,101,99,104,110,111,108,111,103,121,32,67,111,114,112,111,114,97,116,105,
+    111,110,0,74,97,112,97,110,32,69,108,101,99,114,111,110,105,99,115,32,
+    73,110,100,46,32,73,110,99,0,83,116,97,114,32,77,117,108,116,105,109,
+    101,100,105,97,32,67,111,114,112,46,0,69,117,114,111,115,111,102,116,0,
+    69,117,114,111,115,111,102,116,32,40,85,75,41,0,71,101,109,102,108,101,
+    120,32,78,101,116,119,111,114,107,115,0,84,114,97,110,115,105,116,105,111,
+    110,32,78,101,116,119,111,114,107,115,0,80,88,32,73,110,115,116,114,117,
+    109,101,110,116,115,32,84,101,99,104,110,111,108,111,103,121,32,76,116,100,
+    0,80,114,105,109,101,120,32,65,101,114,111,115,112,97,99,101,32,67,111,
+    46,0,83,69,72,32,67,111,109,112,117,116,101,114,116,101,99,104,110,105,
+    107,32,71,77,66,72,0,67,121,116,101,99,32,67,111,114,112,111,114,97,
+    116,105,111,110,0,73,110,101,116,32,84,101,99,104,110,111,108,111,103,105,
+    101,115,32,73,110,99,0,85,110,105,119,105,108,108,32,67,111,109,112,117,
+    116,101,114,32,67,111,114,112,46,0,77,97,114,99,111,110,105,32,67,111,
+    109,109,101,114,99,101,32,83,121,115,116,101,109,115,32,83,82,76,0,76,
+    97,110,99,97,115,116,32,73,110,99,0,75,111,110,105,99,97,32,67,111,
+    114,112,111,114,97,116,105,111,110,0,83,111,108,105,100,117,109,0,83,111,
+    108,105,100,117,109,32,83,121,115,116,101,109,115,32,67,111,114,112,0,65,
+    116,108,97,110,116,101,107,32,77,105,99,114,111,115,121,115,116,101,109,115,
+    32,80,116,121,32,76,116,100,0,68,105,103,97,108,111,103,32,83,121,115,
+    116,101,109,115,32,73,110,99,0,65,108,108,105,101,100,32,68,97,116,97,
+    32,84,101,99,104,110,111,108,111,103,105,101,115,0,72,105,116,97,99,104,
+    105,32,83,101,109,105,99,111,110,100,117,99,116,111,114,32,38,97,109,112,
+    59,32,68,101,118,105,99,101,115,32,83,97,108,101,115,32,67,111,0,80,
+    111,105,110,116,32,77,117,108,116,105,109,101,100,105,97,32,83,121,115,116,
+    101,109,115,0,76,97,114,97,32,84,101,99,104,110,111,108,111,103,121,32,
+    73,110,99,0,68,105,116,101,99,116,32,67,111,111,112,0,51,112,97,114,
+    100,97,116,97,32,73,110,99,46,0,65,82,78,0,83,121,98,97,0,83,
+    121,98,97,32,84,101,99,104,32,76,116,100,46,0,66,111,112,115,32,73,
+    110,99,0,78,101,116,103,97,109,101,32,76,116,100,0,68,105,118,97,32,
+    83,121,115,116,101,109,115,32,67,111,114,112,46,0,70,111,108,115,111,109,
+    32,82,101,115,101,97,114,99,104,32,73,110,99,0,77,101,109,101,99,32,
+    68,101,115,105,103,110,32,83,101,114,118,105,99,101,115,0,71,114,97,110,
+    105,116,101,32,77,105,99,114,111,115,121,115,116,101,109,115,0,68,101,108,
+    116,97,32,69,108,101,99,116,114,111,110,105,99,115,32,73,110,99,0,71,
+    101,110,101,114,97,108,32,73,110,115,116,114,117,109,101,110,116,0,70,97,
+    114,97,100,97,121,32,84,101,99,104,110,111,108,111,103,121,32,67,111,114,
+    112,0,83,116,114,97,116,117,115,32,67,111,109,112,117,116,101,114,32,83,
+    121,115,116,101,109,115,0,78,105,110,103,98,111,32,72,97,114,114,105,115,
+    111,110,32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,32,76,116,
+    100,0,65,45,77,97,120,32,84,101,99,104,110,111,108,111,103,121,32,67,
+    111,32,76,116,100,0,71,97,108,101,97,32,78,101,116,119,111,114,107,32,
+    83,101,99,117,114,105,116,121,0,67,111,109,112,117,109,97,115,116,101,114,
+    32,83,82,76,0,71,101,111,99,97,115,116,32,78,101,116,119,111,114,107,
+    32,83,121,115,116,101,109,115,32,73,110,99,0,67,97,116,97,108,121,115,
+    116,32,69,110,116,101,114,112,114,105,115,101,115,32,73,110,99,0,73,116,
+    97,108,116,101,108,0,88,45,78,101,116,32,79,89,0,84,111,121,111,116,
+    97,32,77,65,67,83,32,73,110,99,0,83,117,110,108,105,103,104,116,32,
+    85,108,116,114,97,115,111,117,110,100,32,84,101,99,104,110,111,108,111,103,
+    105,101,115,32,76,116,100,0,83,83,69,32,84,101,108,101,99,111,109,32,
+    73,110,99,0,83,104,97,110,103,104,97,105,32,67,111,109,109,117,110,105,
+    99,97,116,105,111,110,115,32,84,101,99,104,110,111,108,111,103,105,101,115,
+    32,67,101,110,0,77,111,114,101,116,111,110,32,66,97,121,0,66,108,117,
+    101,115,116,101,101,108,32,78,101,116,119,111,114,107,115,32,73,110,99,0,
+    78,111,114,116,104,32,65,116,108,97,110,116,105,99,32,73,110,115,116,114,
+    117,109,101,110,116,115,0,86,77,119,97,114,101,0,86,77,119,97,114,101,
+    32,73,110,99,46,0,65,109,101,114,115,104,97,109,32,80,104,97,114,109,
+    97,99,105,97,32,66,105,111,116,101,99,104,0,90,111,108,116,114,105,120,
+    32,73,110,116,101,114,110,97,116,105,111,110,97,108,32,76,105,109,105,116,
+    101,100,0,83,111,117,114,99,101,32,84,101,99,104,110,111,108,111,103,121,
+    32,73,110,99,0,77,111,115,97,105,100,32,84,101,99,104,110,111,108,111,
+    103,105,101,115,32,73,110,99,46,0,77,101,108,108,97,110,111,120,32,84,
+    101,99,104,110,111,108,111,103,121,0,67,67,73,47,84,114,105,97,100,0,
+    67,105,109,101,116,114,105,99,115,32,73,110,99,0,84,101,120,97,115,32,
+    77,101,109,111,114,121,32,83,121,115,116,101,109,115,32,73,110,99,0,83,
+    97,110,100,105,115,107,32,67,111,114,112,46,0,65,100,100,105,45,68,97,
+    116,97,32,71,77,66,72,0,77,97,101,115,116,114,111,32,68,105,103,105,
+    116,97,108,32,67,111,109,109,117,110,105,99,97,116,105,111,110,115,0,73,
+    109,112,97,99,99,116,32,84,101,99,104,110,111,108,111,103,121,32,67,111,
+    114,112,0,80,111,114,116,119,101,108,108,32,73,110,99,0,65,103,105,108,
+    101,110,116,0,65,103,105,108,101,110,116,32,84,101,99,104,110,111,108,111,
+    103,105,101,115,0,83,111,108,97,32,69,108,101,99,116,114,111,110,105,99,
+    115,0,72,105,103,104,32,84,101,99,104,32,67,111,109,112,117,116,101,114,
+    32,67,111,114,112,32,40,72,84,67,41,0,66,86,77,0,66,86,77,32,
+    76,105,109,105,116,101,100,0,81,117,97,110,116,101,108,0,78,101,119,101,
+    114,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,0,84,97,105,
+    119,97,110,32,77,121,99,111,109,112,32,67,111,32,76,116,100,0,69,86,
+    83,88,32,73,110,99,0,80,114,111,99,111,109,112,32,73,110,102,111,114,
+    109,97,116,105,99,115,32,76,116,100,0,84,101,99,104,110,105,99,97,108,
+    32,85,110,105,118,101,114,115,105,116,121,32,79,102,32,66,117,100,97,112,
+    101,115,116,0,84,97,116,101,121,97,109,97,32,83,121,115,116,101,109,32,
+    76,97,98,111,114,97,116,111,114,121,32,67,111,32,76,116,100,0,80,101,
+    110,116,97,32,77,101,100,105,97,32,67,111,46,32,76,116,100,0,83,101,
+    114,111,109,101,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,0,
+    66,105,116,98,111,121,115,32,79,89,0,65,71,32,69,108,101,99,116,114,
+    111,110,105,99,115,32,76,116,100,0,72,111,116,114,97,105,108,32,73,110,
+    99,46,0,68,114,101,97,109,116,101,99,104,32,67,111,32,76,116,100,0,
+    71,101,110,114,97,100,32,73,110,99,46,0,72,105,108,115,99,104,101,114,
+    32,71,77,66,72,0,73,110,102,105,110,101,111,110,0,73,110,102,105,110,
+    101,111,110,32,84,101,99,104,110,111,108,111,103,105,101,115,32,65,71,0,
+    70,73,67,32,40,70,105,114,115,116,32,73,110,116,101,114,110,97,116,105,
+    111,110,97,108,32,67,111,109,112,117,116,101,114,32,73,110,99,41,0,78,
+    68,83,32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,115,114,97,
+    101,108,32,76,116,100,0,73,119,105,108,108,32,67,111,114,112,111,114,97,
+    116,105,111,110,0,84,97,116,117,110,103,32,67,111,46,0,69,110,116,114,
+    105,100,105,97,32,67,111,114,112,111,114,97,116,105,111,110,0,82,111,99,
+    107,119,101,108,108,45,67,111,108,108,105,110,115,32,73,110,99,0,67,121,
+    98,101,114,110,101,116,105,99,115,32,84,101,99,104,110,111,108,111,103,121,
+    32,67,111,32,76,116,100,0,83,117,112,101,114,32,77,105,99,114,111,32,
+    67,111,109,112,117,116,101,114,32,73,110,99,0,67,121,98,101,114,102,105,
+    114,109,32,73,110,99,46,0,65,112,112,108,105,101,100,32,67,111,109,112,
+    117,116,105,110,103,32,83,121,115,116,101,109,115,32,73,110,99,46,0,76,
+    105,116,114,111,110,105,99,0,76,105,116,114,111,110,105,99,32,73,110,99,
+    46,0,83,105,103,109,97,116,101,108,32,73,110,99,46,0,77,97,108,108,
+    101,97,98,108,101,32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,
+    110,99,0,67,97,99,104,101,102,108,111,119,32,73,110,99,0,86,84,71,
+    0,86,111,105,99,101,32,84,101,99,104,110,111,108,111,103,105,101,115,32,
+    71,114,111,117,112,0,81,117,105,99,107,110,101,116,32,84,101,99,104,110,
+    111,108,111,103,105,101,115,32,73,110,99,0,78,101,116,119,111,114,116,104,
+    32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,110,99,0,86,83,
+    78,32,83,121,115,116,101,109,101,110,32,66,86,0,86,97,108,108,101,121,
+    32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,110,99,0,65,103,
+    101,114,101,32,73,110,99,46,0,71,69,84,32,69,110,103,105,110,101,101,
+    114,105,110,103,32,67,111,114,112,46,0,78,97,116,105,111,110,97,108,32,
+    68,97,116,97,99,111,109,109,32,67,111,114,112,46,0,80,97,99,105,102,
+    105,99,32,68,105,103,105,116,97,108,32,67,111,114,112,46,0,84,111,107,
+    121,111,32,68,101,110,115,104,105,32,83,101,107,101,105,32,75,46,75,46,
+    0,68,114,115,101,97,114,99,104,32,71,77,66,72,0,66,101,99,107,104,
+    111,102,102,32,71,77,66,72,0,77,97,99,114,111,108,105,110,107,32,73,
+    110,99,0,73,78,32,87,105,110,32,68,101,118,101,108,111,112,109,101,110,
+    116,32,73,110,99,46,0,73,110,116,101,108,108,105,103,101,110,116,32,80,
+    97,114,97,100,105,103,109,32,73,110,99,0,66,45,84,114,101,101,32,83,
+    121,115,116,101,109,115,32,73,110,99,0,84,105,109,101,115,32,78,32,83,
+    121,115,116,101,109,115,32,73,110,99,0,68,105,97,103,110,111,115,116,105,
+    99,32,73,110,115,116,114,117,109,101,110,116,115,32,73,110,99,0,68,105,
+    103,105,116,109,101,100,105,97,32,67,111,114,112,46,0,86,97,108,117,101,
+    115,111,102,116,0,80,111,119,101,114,32,77,105,99,114,111,32,82,101,115,
+    101,97,114,99,104,0,69,120,116,114,101,109,101,32,80,97,99,107,101,116,
+    32,68,101,118,105,99,101,32,73,110,99,0,66,97,110,99,116,101,99,0,
+    75,111,103,97,32,69,108,101,99,116,114,111,110,105,99,115,32,67,111,0,
+    90,101,110,105,116,104,32,69,108,101,99,116,114,111,110,105,99,115,32,67,
+    111,114,112,111,114,97,116,105,111,110,0,65,120,122,97,109,0,65,120,122,
+    97,109,32,67,111,114,112,111,114,97,116,105,111,110,0,90,105,108,111,103,
+    32,73,110,99,46,0,84,101,99,104,115,97,110,32,69,108,101,99,116,114,
+    111,110,105,99,115,32,67,111,32,76,116,100,0,78,45,67,117,98,101,100,
+    46,78,101,116,0,75,105,110,112,111,32,69,108,101,99,116,114,111,110,105,
+    99,115,32,73,110,99,0,70,97,115,116,112,111,105,110,116,32,84,101,99,
+    104,110,111,108,111,103,105,101,115,32,73,110,99,46,0,78,111,114,116,104,
+    114,111,112,32,71,114,117,109,109,97,110,32,45,32,67,97,110,97,100,97,
+    32,76,116,100,0,84,101,110,116,97,32,84,101,99,104,110,111,108,111,103,
+    121,0,80,114,111,115,121,115,45,84,69,67,32,73,110,99,46,0,78,111,
+    107,105,97,32,87,105,114,101,108,101,115,115,32,66,117,115,105,110,101,115,
+    115,32,67,111,109,109,117,110,105,99,97,116,105,111,110,115,0,67,101,110,
+    116,114,97,108,32,83,121,115,116,101,109,32,82,101,115,101,97,114,99,104,
+    32,67,111,32,76,116,100,0,80,97,105,114,103,97,105,110,32,84,101,99,
+    104,110,111,108,111,103,105,101,115,0,69,117,114,111,112,111,112,32,65,71,
+    0,76,97,118,97,32,83,101,109,105,99,111,110,100,117,99,116,111,114,32,
+    77,97,110,117,102,97,99,116,117,114,105,110,103,32,73,110,99,46,0,65,
+    117,116,111,109,97,116,101,100,32,87,97,103,101,114,105,110,103,32,73,110,
+    116,101,114,110,97,116,105,111,110,97,108,0,83,99,105,101,109,101,116,114,
+    105,99,32,73,110,115,116,114,117,109,101,110,116,115,32,73,110,99,0,75,
+    111,108,108,109,111,114,103,101,110,32,83,101,114,118,111,116,114,111,110,105,
+    120,0,79,110,107,121,111,32,67,111,114,112,46,0,79,114,101,103,111,110,
+    32,77,105,99,114,111,32,83,121,115,116,101,109,115,32,73,110,99,46,0,
+    65,97,101,111,110,32,69,108,101,99,116,114,111,110,105,99,115,32,73,110,
+    99,0,67,77,76,32,69,109,101,114,103,101,110,99,121,32,83,101,114,118,
+    105,99,101,115,0,73,84,69,67,32,67,111,32,76,116,100,0,84,111,116,
+    116,111,114,105,32,83,97,110,121,111,32,69,108,101,99,116,114,105,99,32,
+    67,111,32,76,116,100,0,66,101,108,32,70,117,115,101,32,73,110,99,46,
+    0,84,101,108,101,115,121,110,101,114,103,121,32,82,101,115,101,97,114,99,
+    104,32,73,110,99,46,0,83,121,115,116,101,109,32,67,114,97,102,116,32,
+    73,110,99,46,0,74,97,99,101,32,84,101,99,104,32,73,110,99,46,0,
+    69,113,117,117,115,32,67,111,109,112,117,116,101,114,32,83,121,115,116,101,
+    109,115,32,73,110,99,0,73,111,116,101,99,104,32,73,110,99,46,0,82,
+    97,112,105,100,115,116,114,101,97,109,32,73,110,99,0,69,115,101,99,32,
+    83,65,0,70,97,114,83,105,116,101,0,70,97,114,83,105,116,101,32,67,
+    111,109,109,117,110,105,99,97,116,105,111,110,115,32,76,105,109,105,116,101,
+    100,0,77,111,98,105,108,105,97,110,32,73,115,114,97,101,108,32,76,116,
+    100,0,66,101,114,107,115,104,105,114,101,32,80,114,111,100,117,99,116,115,
+    0,71,97,116,101,99,0,75,121,111,101,105,32,83,97,110,103,121,111,32,
+    67,111,32,76,116,100,0,65,114,105,109,97,0,65,114,105,109,97,32,67,
+    111,109,112,117,116,101,114,32,67,111,114,112,111,114,97,116,105,111,110,0,
+    83,105,103,109,97,99,111,109,32,67,111,32,76,116,100,0,76,121,110,120,
+    32,83,116,117,100,105,111,32,84,101,99,104,110,111,108,111,103,121,32,73,
+    110,99,0,78,72,67,0,78,111,107,105,97,32,72,111,109,101,32,67,111,
+    109,109,117,110,105,99,97,116,105,111,110,115,0,75,82,70,32,84,101,99,
+    104,32,76,116,100,0,67,69,32,73,110,102,111,115,121,115,32,71,77,66,
+    72,0,87,97,114,112,32,78,105,110,101,32,69,110,103,105,110,101,101,114,
+    105,110,103,0,84,68,75,32,83,101,109,105,99,111,110,100,117,99,116,111,
+    114,32,67,111,114,112,46,0,66,67,111,109,32,69,108,101,99,116,114,111,
+    110,105,99,115,32,73,110,99,0,75,111,110,103,115,98,101,114,103,32,83,
+    112,97,99,101,116,101,99,32,97,46,115,46,0,83,101,106,105,110,32,67,
+    111,109,112,117,116,101,114,108,97,110,100,32,67,111,32,76,116,100,0,83,
+    104,97,110,103,104,97,105,32,66,101,108,108,32,67,111,109,112,97,110,121,
+    32,76,105,109,105,116,101,100,0,67,38,97,109,112,59,72,32,84,101,99,
+    104,110,111,108,111,103,105,101,115,32,73,110,99,0,82,101,112,114,111,115,
+    111,102,116,32,67,111,32,76,116,100,0,77,97,114,103,105,32,83,121,115,
+    116,101,109,115,32,73,110,99,0,82,111,104,100,101,32,38,97,109,112,59,
+    32,83,99,104,119,97,114,122,32,71,77,66,72,32,38,97,109,112,59,32,
+    67,111,32,75,71,0,83,107,121,32,67,111,109,112,117,116,101,114,115,32,
+    73,110,99,0,78,69,67,32,67,111,109,112,117,116,101,114,32,73,110,116,
+    101,114,110,97,116,105,111,110,97,108,0,86,101,114,105,115,121,115,32,73,
+    110,99,0,65,100,97,99,32,67,111,114,112,111,114,97,116,105,111,110,0,
+    86,105,115,105,111,110,103,108,111,98,97,108,32,78,101,116,119,111,114,107,
+    32,67,111,114,112,46,0,68,101,99,114,111,115,0,74,101,97,110,32,67,
+    111,109,112,97,110,121,32,76,116,100,0,78,83,73,0,32,69,117,109,105,
+    116,99,111,109,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,0,
+    69,117,109,105,116,99,111,109,32,84,101,99,104,110,111,108,111,103,121,32,
+    73,110,99,0,65,105,114,32,80,114,105,109,101,32,73,110,99,0,71,108,
+    111,116,114,101,120,32,67,111,32,76,116,100,0,105,110,116,101,108,0,72,
+    101,105,100,101,108,98,101,114,103,32,68,105,103,105,116,97,108,32,76,76,
+    67,0,51,100,112,111,119,101,114,0,82,101,110,105,115,104,97,119,32,80,
+    76,67,0,73,110,116,101,108,108,105,119,111,114,120,120,32,73,110,99,0,
+    77,75,78,101,116,32,67,111,114,112,111,114,97,116,105,111,110,0,66,105,
+    116,108,97,110,100,0,72,97,106,105,109,101,32,73,110,100,117,115,116,114,
+    105,101,115,32,76,116,100,0,87,101,115,116,101,114,110,32,65,118,105,111,
+    110,105,99,115,32,76,116,100,0,81,117,105,99,107,45,83,101,114,118,46,
+    32,67,111,109,112,117,116,101,114,32,67,111,46,32,76,116,100,0,78,105,
+    112,112,111,110,32,83,121,115,116,101,109,119,97,114,101,32,67,111,32,76,
+    116,100,0,72,101,114,116,122,32,83,121,115,116,101,109,116,101,99,104,110,
+    105,107,32,71,77,66,72,0,77,101,108,116,68,111,119,110,32,83,121,115,
+    116,101,109,115,32,76,76,67,0,74,117,112,105,116,101,114,32,83,121,115,
+    116,101,109,115,0,65,105,119,97,32,67,111,46,32,76,116,100,0,68,101,
+    112,97,114,116,109,101,110,116,32,79,102,32,68,101,102,101,110,115,101,0,
+    73,115,104,111,110,105,32,78,101,116,119,111,114,107,115,0,77,105,99,114,
+    101,108,32,73,110,99,46,0,68,97,116,97,86,111,105,99,101,0,68,97,
+    116,97,118,111,105,99,101,32,40,80,116,121,41,32,76,116,100,46,0,65,
+    100,109,111,114,101,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,
+    46,0,67,104,97,112,97,114,114,97,108,32,78,101,116,119,111,114,107,32,
+    83,116,111,114,97,103,101,0,83,112,101,99,116,114,117,109,32,68,105,103,
+    105,116,97,108,32,73,110,99,46,0,78,97,116,117,114,101,116,101,99,104,
+    0,78,97,116,117,114,101,32,87,111,114,108,100,119,105,100,101,32,84,101,
+    99,104,110,111,108,111,103,121,32,67,111,114,112,0,83,111,110,105,99,119,
+    97,108,108,32,73,110,99,0,68,97,122,122,108,101,32,77,117,108,116,105,
+    109,101,100,105,97,32,73,110,99,46,0,73,110,115,121,100,101,32,83,111,
+    102,116,119,97,114,101,32,67,111,114,112,0,66,114,111,99,97,100,101,32,
+    67,111,109,109,117,110,105,99,97,116,105,111,110,115,32,83,121,115,116,101,
+    109,115,0,77,101,100,32,65,115,115,111,99,105,97,116,101,115,32,73,110,
+    99,46,0,83,104,105,98,97,32,68,101,110,115,104,105,32,83,121,115,116,
+    101,109,115,32,73,110,99,46,0,69,112,105,120,32,73,110,99,46,0,82,
+    101,97,108,45,84,105,109,101,32,68,105,103,105,116,97,108,32,73,110,99,
+    46,0,75,111,110,100,111,32,75,97,103,97,107,117,0,72,115,105,110,103,
+    32,84,101,99,104,46,32,69,110,116,101,114,112,114,105,115,101,32,67,111,
+    46,32,76,116,100,46,0,72,121,117,110,106,117,32,67,111,109,112,117,116,
+    101,114,32,67,111,46,32,76,116,100,46,0,67,111,109,97,114,116,0,67,
+    111,109,97,114,116,115,121,115,116,101,109,32,75,111,114,101,97,0,78,101,
+    116,119,111,114,107,32,83,101,99,117,114,105,116,121,32,84,101,99,104,110,
+    111,108,111,103,105,101,115,32,73,110,99,46,32,40,78,101,116,0,87,111,
+    114,108,100,115,112,97,99,101,32,67,111,114,112,46,0,73,110,116,32,76,
+    97,98,115,0,69,108,109,101,99,32,73,110,99,46,32,76,116,100,46,0,
+    70,97,115,116,102,97,109,101,32,84,101,99,104,110,111,108,111,103,121,32,
+    67,111,46,32,76,116,100,46,0,69,100,97,120,32,73,110,99,46,0,78,
+    111,114,112,97,107,32,67,111,114,112,111,114,97,116,105,111,110,0,67,111,
+    83,121,115,116,101,109,115,32,73,110,99,46,0,65,99,116,105,111,110,116,
+    101,99,0,65,99,116,105,111,110,116,101,99,32,69,108,101,99,116,114,111,
+    110,105,99,115,32,73,110,99,46,0,75,111,109,97,116,115,117,32,76,116,
+    100,46,0,83,117,112,101,114,110,101,116,32,73,110,99,46,0,83,104,97,
+    100,101,32,76,116,100,46,0,83,105,98,121,116,101,32,73,110,99,46,0,
+    83,99,104,110,101,105,100,101,114,32,65,117,116,111,109,97,116,105,111,110,
+    32,73,110,99,46,0,84,101,108,101,118,111,120,32,83,111,102,116,119,97,
+    114,101,32,73,110,99,46,0,82,101,97,114,100,101,110,32,83,116,101,101,
+    108,0,65,116,97,110,32,84,101,99,104,110,111,108,111,103,121,32,73,110,
+    99,46,0,85,110,105,116,101,99,32,67,111,46,32,76,116,100,46,0,112,
+    99,116,101,108,0,83,113,117,97,114,101,32,87,97,118,101,32,84,101,99,
+    104,110,111,108,111,103,121,0,69,109,97,99,104,105,110,101,115,32,73,110,
+    99,46,0,66,101,114,110,101,99,107,101,114,32,43,32,82,97,105,110,101,
+    114,0,73,78,72,32,83,101,109,105,99,111,110,100,117,99,116,111,114,0,
+    84,111,107,121,111,32,69,108,101,99,116,114,111,110,32,68,101,118,105,99,
+    101,32,76,116,100,46,0,105,98,97,0,73,110,103,101,110,105,101,117,114,
+    98,117,101,114,111,32,65,110,104,97,117,115,32,71,109,98,72,0,68,117,
+    110,116,105,0,68,117,110,116,105,32,67,111,114,112,46,0,72,101,114,99,
+    117,108,101,115,0,80,73,78,69,0,80,73,78,69,32,84,101,99,104,110,
+    111,108,111,103,121,44,32,76,116,100,46,0,67,97,115,116,108,101,78,101,
+    116,0,67,97,115,116,108,101,78,101,116,32,84,101,99,104,110,111,108,111,
+    103,121,32,73,110,99,46,0,85,83,65,0,85,116,105,109,97,99,111,32,
+    83,97,102,101,119,97,114,101,32,65,71,0,67,105,114,99,117,116,32,65,
+    115,115,101,109,98,108,121,32,67,111,114,112,46,0,65,116,104,101,114,111,
+    115,0,65,116,104,101,114,111,115,32,67,111,109,109,117,110,105,99,97,116,
+    105,111,110,115,32,73,110,99,46,0,78,77,73,0,78,77,73,32,69,108,
+    101,99,116,114,111,110,105,99,115,32,76,116,100,46,0,72,121,117,110,100,
+    97,105,32,77,117,108,116,105,67,65,86,0,72,121,117,110,100,97,105,32,
+    77,117,108,116,105,67,65,86,32,67,111,109,112,117,116,101,114,32,67,111,
+    46,32,76,116,100,46,0,113,115,98,0,75,68,83,32,73,110,110,111,116,
+    101,99,104,32,67,111,114,112,46,0,78,101,116,67,111,110,116,105,110,117,
+    117,109,0,78,101,116,67,111,110,116,105,110,117,117,109,44,32,73,110,99,
+    46,0,70,69,82,77,65,0,69,80,111,88,0,69,80,111,88,32,67,111,
+    109,112,117,116,101,114,32,67,111,46,44,32,76,116,100,46,0,83,70,78,
+    84,0,83,97,102,101,78,101,116,32,73,110,99,46,0,67,78,70,32,77,
+    111,98,105,108,101,32,83,111,108,117,116,105,111,110,115,0,83,111,110,110,
+    101,116,32,84,101,99,104,110,111,108,111,103,105,101,115,0,83,111,110,110,
+    101,116,32,84,101,99,104,110,111,108,111,103,105,101,115,44,32,73,110,99,
+    46,0,67,101,110,97,116,101,107,0,67,101,110,97,116,101,107,32,73,110,
+    99,46,0,77,105,110,111,108,116,97,0,77,105,110,111,108,116,97,32,67,
+    111,46,32,76,116,100,46,0,73,110,97,114,105,0,73,110,97,114,105,32,
+    73,110,99,46,0,83,121,115,116,101,109,97,120,0,51,77,84,83,0,84,
+    104,105,114,100,32,77,105,108,108,101,110,105,117,109,32,84,101,115,116,32,
+    83,111,108,117,116,105,111,110,115,44,32,73,110,99,46,0,73,110,116,101,
+    108,108,111,110,32,67,111,114,112,111,114,97,116,105,111,110,0,85,83,82,
+    0,85,46,83,46,32,82,111,98,111,116,105,99,115,0,84,76,65,32,73,
+    110,99,46,0,65,100,105,99,116,105,0,65,100,105,99,116,105,32,67,111,
+    114,112,46,0,74,101,116,119,97,121,0,74,101,116,119,97,121,32,73,110,
+    102,111,114,109,97,116,105,111,110,32,67,111,46,44,32,76,116,100,0,86,
+    105,100,101,111,84,101,108,101,46,99,111,109,0,86,105,100,101,111,84,101,
+    108,101,46,99,111,109,32,73,110,99,46,0,65,110,116,97,114,97,0,65,
+    110,116,97,114,97,32,76,76,67,0,73,110,116,101,114,97,99,116,105,118,
+    101,32,67,111,109,112,117,116,101,114,32,80,114,111,100,117,99,116,115,32,
+    73,110,99,46,0,73,77,67,0,73,110,116,101,114,110,101,116,32,77,97,
+    99,104,105,110,101,115,32,67,111,114,112,46,0,68,101,115,97,110,97,0,
+    68,101,115,97,110,97,32,83,121,115,116,101,109,115,0,67,108,101,97,114,
+    119,97,116,101,114,0,67,108,101,97,114,119,97,116,101,114,32,78,101,116,
+    119,111,114,107,115,0,68,105,103,105,116,97,108,32,70,105,114,115,116,0,
+    80,66,67,0,80,97,99,105,102,105,99,32,66,114,111,97,100,98,97,110,
+    100,32,67,111,109,109,117,110,105,99,97,116,105,111,110,115,0,67,111,103,
+    101,110,99,121,0,67,111,103,101,110,99,121,32,83,101,109,105,99,111,110,
+    100,117,99,116,111,114,32,73,110,99,46,0,72,97,114,114,105,115,0,72,
+    97,114,114,105,115,32,67,111,114,112,46,0,90,97,114,108,105,110,107,0,
+    90,97,114,108,105,110,107,32,83,101,109,105,99,111,110,100,117,99,116,111,
+    114,0,65,108,112,105,110,101,0,65,108,112,105,110,101,32,69,108,101,99,
+    116,114,111,110,105,99,115,32,73,110,99,46,0,78,101,116,79,99,116,97,
+    118,101,0,78,101,116,79,99,116,97,118,101,32,73,110,99,46,0,89,111,
+    116,116,97,89,111,116,116,97,0,89,111,116,116,97,89,111,116,116,97,32,
+    73,110,99,46,0,83,77,73,0,83,101,110,115,111,77,111,116,111,114,105,
+    99,32,73,110,115,116,114,117,109,101,110,116,115,32,71,109,98,72,0,83,
+    97,110,32,86,97,108,108,101,121,0,83,97,110,32,86,97,108,108,101,121,
+    32,83,121,115,116,101,109,115,44,32,73,110,99,46,0,67,121,98,101,114,
+    100,121,110,101,0,67,121,98,101,114,100,121,110,101,32,73,110,99,46,0,
+    80,101,108,97,103,111,0,80,101,108,97,103,111,32,78,117,116,119,111,114,
+    107,115,0,78,101,116,83,99,114,101,101,110,0,77,121,78,97,109,101,32,
+    84,101,99,104,110,111,108,111,103,105,101,115,44,32,73,110,99,46,0,78,
+    73,67,69,0,78,73,67,69,32,83,121,115,116,101,109,115,32,73,110,99,
+    46,0,84,79,80,67,79,78,0,84,79,80,67,79,78,32,67,111,114,112,
+    46,0,70,117,106,105,116,115,117,45,83,105,101,109,101,110,115,0,70,117,
+    106,105,116,115,117,45,83,105,101,109,101,110,115,32,67,111,109,112,117,116,
+    101,114,115,32,71,109,98,72,0,76,105,110,107,83,121,115,0,65,108,116,
+    105,109,97,0,65,108,116,105,109,97,32,67,111,109,109,117,110,105,99,97,
+    116,105,111,110,115,32,73,110,99,46,0,80,101,112,112,101,114,99,111,110,
+    0,80,101,112,112,101,114,99,111,110,32,65,71,0,80,67,32,80,97,114,
+    116,110,101,114,32,40,83,97,112,112,104,105,114,101,41,0,80,67,32,80,
+    97,114,116,110,101,114,32,76,105,109,105,116,101,100,0,65,77,87,32,69,
+    117,114,111,112,101,32,71,109,98,72,0,71,108,111,98,97,108,32,66,114,
+    97,110,100,115,32,77,97,110,117,102,97,99,116,117,114,101,32,76,116,100,
+    46,0,84,101,114,97,82,101,99,111,110,0,84,101,114,97,82,101,99,111,
+    110,44,32,73,110,99,46,0,65,108,99,104,101,109,121,0,65,108,99,104,
+    101,109,121,32,83,101,109,105,99,111,110,100,117,99,116,111,114,32,73,110,
+    99,46,0,71,68,67,0,71,101,110,101,114,97,108,32,68,121,110,97,109,
+    105,99,115,32,67,97,110,97,100,97,0,69,110,110,121,97,104,0,69,110,
+    110,121,97,104,32,84,101,99,104,110,111,108,111,103,105,101,115,32,67,111,
+    114,112,0,85,110,105,116,101,99,104,0,85,110,105,116,101,99,104,32,69,
+    108,101,99,116,114,111,110,105,99,115,32,67,111,46,44,32,76,116,100,0,
+    83,116,97,114,116,32,78,101,116,119,111,114,107,0,83,116,97,114,116,32,
+    78,101,116,119,111,114,107,32,84,101,99,104,110,111,108,111,103,121,32,67,
+    111,46,44,32,76,116,100,46,0,108,101,110,111,118,111,0,76,101,103,101,
+    110,100,32,76,116,100,46,32,40,66,101,105,106,105,110,103,41,0,80,104,
+    105,108,108,105,112,115,32,67,111,109,112,111,110,101,110,116,115,0,72,105,
+    103,104,116,101,99,104,0,72,105,103,104,116,101,99,104,32,73,110,102,111,
+    114,109,97,116,105,111,110,32,83,121,115,116,101,109,115,44,32,76,116,100,
+    46,0,80,104,105,108,105,112,115,0,87,105,115,116,114,111,110,0,87,105,
+    115,116,114,111,110,32,67,111,114,112,46,0,77,111,118,105,116,97,0,78,
+    101,116,67,104,105,112,0,78,101,116,101,114,105,111,110,0,78,101,116,101,
+    114,105,111,110,32,73,110,99,46,0,68,72,32,101,108,101,99,116,114,111,
+    110,105,99,115,32,71,109,98,72,0,67,111,110,110,101,99,116,51,68,0,
+    67,111,110,110,101,99,116,32,67,111,109,112,111,110,101,110,116,115,44,32,
+    76,116,100,46,0,65,109,98,105,101,110,116,0,65,109,98,105,101,110,116,
+    32,84,101,99,104,110,111,108,111,103,105,101,115,32,73,110,99,46,0,82,
+    97,108,105,110,107,32,84,101,99,104,110,111,108,111,103,121,0,82,97,108,
+    105,110,107,32,84,101,99,104,110,111,108,111,103,121,44,32,67,111,114,112,
+    0,100,101,118,111,108,111,0,100,101,118,111,108,111,32,65,71,0,73,110,
+    102,105,110,105,67,111,110,0,73,110,102,105,110,105,67,111,110,32,83,121,
+    115,116,101,109,115,44,32,73,110,99,46,0,65,118,111,99,101,110,116,0,
+    80,114,105,109,97,103,114,97,112,104,105,99,115,0,80,114,105,109,97,103,
+    114,97,112,104,105,99,115,32,76,116,100,46,0,72,117,109,117,115,111,102,
+    116,0,72,117,109,117,115,111,102,116,32,83,46,82,46,79,0,69,108,97,
+    110,0,69,108,97,110,32,68,105,103,105,116,97,108,32,83,121,115,116,101,
+    109,115,32,76,116,100,0,86,97,114,105,115,121,115,32,76,105,109,105,116,
+    101,100,0,77,105,108,108,111,103,105,99,0,77,105,108,108,111,103,105,99,
+    32,76,116,100,46,0,69,103,101,110,101,114,97,44,32,73,110,99,46,0,
+    73,110,102,111,45,84,101,107,32,67,111,114,112,46,0,65,82,86,79,79,
+    0,65,82,86,79,79,32,69,110,103,105,110,101,101,114,105,110,103,32,66,
+    86,0,88,71,73,0,88,71,73,32,84,101,99,104,110,111,108,111,103,121,
+    32,73,110,99,0,83,112,99,0,83,112,101,99,116,114,117,109,32,83,121,
+    115,116,101,109,101,110,116,119,105,99,107,108,117,110,103,32,77,105,99,114,
+    111,101,108,101,99,116,114,111,110,105,99,32,71,109,98,72,0,78,97,112,
+    97,116,101,99,104,0,78,97,112,97,116,101,99,104,32,65,47,83,0,67,
+    111,109,109,116,101,99,104,0,67,111,109,109,116,101,99,104,44,32,73,110,
+    99,46,0,82,101,115,105,108,105,101,110,99,101,32,67,111,114,112,111,114,
+    97,116,105,111,110,0,87,73,83,32,67,111,109,112,117,116,101,114,115,0,
+    87,73,83,32,84,101,99,104,110,111,108,111,103,121,44,32,73,110,99,46,
+    0,83,101,97,119,97,121,32,78,101,116,119,111,114,107,115,0,65,71,69,
+    73,65,32,84,101,99,104,110,111,108,111,103,105,101,115,44,32,73,110,99,
+    46,0,68,65,81,68,65,84,65,0,68,65,81,68,65,84,65,32,71,109,
+    98,72,0,75,97,115,116,101,110,32,67,104,97,115,101,0,75,97,115,116,
+    101,110,32,67,104,97,115,101,32,65,112,112,108,105,101,100,32,82,101,115,
+    101,97,114,99,104,0,86,101,99,116,111,114,0,86,101,99,116,111,114,32,
+    73,110,102,111,114,109,97,116,105,107,32,71,109,98,72,0,76,105,110,117,
+    120,32,78,101,116,119,111,114,120,0,73,109,97,103,105,110,97,110,116,0,
+    74,97,116,111,110,32,67,111,114,112,0,74,97,116,111,110,32,67,111,114,
+    112,111,114,97,116,105,111,110,32,85,83,65,0,77,105,114,97,110,100,97,
+    0,77,105,114,97,110,100,97,32,84,101,99,104,110,111,108,111,103,105,101,
+    115,32,76,116,100,46,0,84,101,109,112,111,114,97,108,32,82,101,115,101,
+    97,114,99,104,32,76,116,100,0,75,105,110,103,115,116,111,110,0,75,105,
+    110,103,115,116,111,110,32,84,101,99,104,110,111,108,111,103,121,32,67,111,
+    46,0,67,104,97,105,110,84,101,99,104,0,67,104,97,105,110,84,101,99,
+    104,32,67,111,109,112,117,116,101,114,32,67,111,46,32,76,116,100,46,0,
+    90,101,110,105,99,32,73,110,99,0,72,105,110,116,0,72,105,110,116,32,
+    67,111,114,112,46,0,81,117,97,110,116,117,109,32,68,101,115,105,103,110,
+    115,32,40,72,46,75,46,41,32,73,110,99,46,0,65,82,67,79,77,0,
+    65,82,67,79,77,32,67,111,110,116,114,111,108,32,83,121,115,116,101,109,
+    115,32,76,116,100,46,0,52,108,105,110,107,115,0,51,68,76,97,98,115,
+    0,51,68,108,97,98,115,44,32,73,110,99,46,32,76,116,100,0,65,118,
+    97,110,99,101,0,65,118,97,110,99,101,32,76,111,103,105,99,32,73,110,
+    99,46,0,65,108,112,104,97,32,68,97,116,97,0,65,108,97,100,100,105,
+    110,32,75,110,111,119,108,101,100,103,101,32,83,121,115,116,101,109,115,0,
+    85,77,65,88,32,67,111,109,112,0,85,77,65,88,32,67,111,109,112,117,
+    116,101,114,32,67,111,114,112,46,0,72,101,114,99,117,108,101,115,32,67,
+    111,109,112,117,116,101,114,32,84,101,99,104,110,111,108,111,103,121,0,71,
+    114,111,119,116,104,32,78,101,116,119,111,114,107,115,0,73,110,116,101,103,
+    114,97,108,0,73,110,116,101,103,114,97,108,32,84,101,99,104,110,111,108,
+    111,103,105,101,115,0,65,120,105,108,0,65,120,105,108,32,67,111,109,112,
+    117,116,101,114,32,73,110,99,46,0,76,117,110,103,32,72,119,97,0,76,
+    117,110,103,32,72,119,97,32,69,108,101,99,116,114,111,110,105,99,115,0,
+    83,66,83,0,83,66,83,45,79,82,32,73,110,100,117,115,116,114,105,97,
+    108,32,67,111,109,112,117,116,101,114,115,0,83,101,97,110,105,120,32,84,
+    101,99,104,110,111,108,111,103,121,32,73,110,99,0,77,101,100,105,97,113,
+    0,77,101,100,105,97,113,32,73,110,99,46,0,77,105,99,114,111,116,101,
+    99,104,110,105,99,97,32,67,111,32,76,116,100,0,73,76,67,0,73,76,
+    67,32,68,97,116,97,32,68,101,118,105,99,101,32,67,111,114,112,46,0,
+    84,66,83,47,86,111,121,101,116,114,97,0,84,66,83,47,86,111,121,101,
+    116,114,97,32,84,101,99,104,110,111,108,111,103,105,101,115,0,83,32,83,
+    32,84,101,99,104,110,111,108,111,103,105,101,115,0,81,117,97,108,99,111,
+    109,109,0,81,117,97,108,99,111,109,109,32,73,110,99,46,0,83,51,32,
+    56,54,99,55,54,53,0,83,51,32,71,114,97,112,104,105,99,115,32,67,
+    111,46,44,32,76,116,100,0,84,101,114,97,108,111,103,105,99,32,73,110,
+    99,0,71,101,110,114,111,99,111,0,71,101,110,114,111,99,111,32,73,110,
+    99,46,0,76,111,103,105,116,101,99,32,67,111,114,112,46,0,68,101,99,
+    105,115,105,111,110,0,68,101,99,105,115,105,111,110,32,67,111,109,112,117,
+    116,101,114,32,73,110,116,101,114,110,97,116,105,111,110,97,108,32,67,111,
+    46,0,79,46,78,46,0,79,46,78,46,32,69,108,101,99,116,114,105,99,
+    32,67,111,46,32,76,116,100,46,0,73,110,116,101,108,0,84,45,83,113,
+    117,97,114,101,0,84,45,83,113,117,97,114,101,32,68,101,115,105,103,110,
+    32,73,110,99,46,0,83,105,108,32,77,97,103,105,99,0,83,105,108,105,
+    99,111,110,32,77,97,103,105,99,0,67,111,109,112,117,116,111,110,101,0,
+    67,111,109,112,117,116,111,110,101,32,67,111,114,112,111,114,97,116,105,111,
+    110,0,65,100,97,112,116,101,99,0,65,100,97,112,116,101,99,32,73,110,
+    99,0,71,105,103,97,112,105,120,101,108,32,67,111,114,112,0,79,109,110,
+    105,32,77,101,100,105,97,32,84,101,99,104,110,111,108,111,103,121,32,73,
+    110,99,46,0,83,116,97,114,71,101,110,0,83,116,97,114,71,101,110,44,
+    32,73,110,99,46,0,65,111,112,101,110,0,65,111,112,101,110,32,73,110,
+    99,46,0,85,110,105,115,121,115,32,67,111,114,112,111,114,97,116,105,111,
+    110,0,78,69,67,32,67,111,114,112,46,0,72,101,119,108,101,116,116,32,
+    80,97,99,107,97,114,100,0,51,99,111,109,32,67,111,114,112,111,114,97,
+    116,105,111,110,0,83,99,105,116,101,120,32,68,105,103,105,116,97,108,32,
+    86,105,100,101,111,0,68,105,103,105,116,97,108,32,82,101,99,101,105,118,
+    101,114,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,0,83,104,
+    105,118,97,32,69,117,114,111,112,101,32,76,116,100,46,0,66,114,111,119,
+    110,32,38,97,109,112,59,32,83,104,97,114,112,101,32,77,102,103,46,32,
+    67,111,46,0,77,105,110,100,115,116,114,101,97,109,32,67,111,109,112,117,
+    116,105,110,103,0,84,83,73,0,84,83,73,32,84,101,108,115,121,115,0,
+    77,105,99,114,111,110,47,67,114,117,99,105,97,108,0,77,105,99,114,111,
+    110,47,67,114,117,99,105,97,108,32,84,101,99,104,110,111,108,111,103,121,
+    0,77,111,116,32,69,110,103,114,103,0,77,111,116,105,111,110,32,69,110,
+    103,105,110,101,101,114,105,110,103,32,73,110,99,46,0,72,117,100,115,111,
+    110,32,83,111,102,116,32,67,111,32,76,116,100,0,86,97,114,105,97,110,
+    0,86,97,114,105,97,110,32,65,117,115,116,114,97,108,105,97,32,80,116,
+    121,46,32,76,116,100,46,0,67,104,114,121,115,97,108,105,115,45,73,84,
+    83,0,67,97,116,97,112,117,108,116,32,67,111,109,109,117,110,105,99,97,
+    116,105,111,110,115,0,80,114,111,99,101,115,115,105,110,103,0,68,97,119,
+    105,99,111,110,116,114,111,108,0,73,110,100,105,103,105,116,97,0,73,110,
+    100,105,103,105,116,97,32,67,111,114,112,111,114,97,116,105,111,110,0,77,
+    105,100,100,108,101,32,68,105,103,105,116,97,108,44,32,73,110,99,0,84,
+    105,103,101,114,32,74,101,116,0,84,105,103,101,114,32,74,101,116,32,78,
+    101,116,119,111,114,107,32,73,110,99,0,69,75,70,32,69,108,101,107,116,
+    114,111,110,105,107,32,71,77,66,72,0,69,97,103,108,101,32,84,101,99,
+    104,110,111,108,111,103,121,0,65,97,115,104,105,109,97,0,65,97,115,104,
+    105,109,97,32,84,101,99,104,110,111,108,111,103,121,32,66,46,86,46,0,
+    69,110,100,97,99,101,0,69,110,100,97,99,101,32,77,101,97,115,117,114,
+    101,109,101,110,116,32,83,121,115,116,101,109,115,32,76,116,100,46,0,69,
+    99,104,111,0,69,99,104,111,32,68,105,103,105,116,97,108,32,65,117,100,
+    105,111,32,67,111,114,112,111,114,97,116,105,111,110,0,65,82,75,32,76,
+    111,103,105,99,0,65,82,75,32,76,111,103,105,99,44,32,73,110,99,0,
+    70,53,32,78,101,116,119,111,114,107,115,32,73,110,99,46,0,73,110,116,
+    101,114,97,103,111,110,0,73,110,116,101,114,97,103,111,110,32,65,83,0,
+    109,120,57,56,55,49,53,47,50,53,0,105,55,52,48,32,80,67,73,0,
+    80,67,73,32,116,111,32,69,73,83,65,32,66,114,105,100,103,101,0,73,
+    83,65,32,66,114,105,100,103,101,0,67,80,81,66,49,65,57,0,83,116,
+    111,114,97,103,101,87,111,114,107,115,32,76,105,98,114,97,114,121,32,65,
+    100,97,112,116,101,114,32,40,72,86,68,41,0,54,56,54,80,55,0,78,
+    67,55,49,51,50,0,71,105,103,97,98,105,116,32,85,112,103,114,97,100,
+    101,32,77,111,100,117,108,101,0,78,67,54,49,51,54,0,71,105,103,97,
+    98,105,116,32,83,101,114,118,101,114,32,65,100,97,112,116,101,114,0,65,
+    100,97,112,116,101,99,32,65,73,67,45,55,56,57,57,71,0,54,52,66,
+    105,116,44,54,54,77,72,122,44,68,117,97,108,32,67,104,97,110,110,101,
+    108,32,87,105,100,101,85,108,116,114,97,51,32,83,67,83,73,0,78,101,
+    116,101,108,105,103,101,110,116,32,52,47,49,54,32,84,82,0,80,67,73,
+    32,85,84,80,47,83,84,80,32,67,111,110,116,114,111,108,108,101,114,0,
+    84,114,105,102,108,101,120,32,77,111,100,101,108,32,49,48,48,48,0,80,
+    101,110,116,105,117,109,32,66,114,105,100,103,101,0,84,114,105,102,108,101,
+    120,32,77,111,100,101,108,32,50,48,48,48,0,81,86,105,115,105,111,110,
+    32,49,50,56,48,47,112,32,118,48,0,71,85,73,32,65,99,99,101,108,
+    101,114,97,116,111,114,0,81,86,105,115,105,111,110,32,49,50,56,48,47,
+    112,32,118,49,0,81,86,105,115,105,111,110,32,49,50,56,48,47,112,32,
+    118,50,0,84,114,105,102,108,101,120,32,77,111,100,101,108,32,52,48,48,
+    48,0,77,111,100,101,108,32,54,48,49,48,0,72,111,116,80,108,117,103,
+    32,80,67,73,32,66,114,105,100,103,101,0,85,83,66,32,67,111,110,116,
+    114,111,108,108,101,114,0,79,114,105,103,105,110,97,108,32,67,111,109,112,
+    97,113,32,102,105,98,114,101,32,67,104,97,110,110,101,108,32,72,66,65,
+    0,65,100,118,97,110,99,101,100,32,83,121,115,116,101,109,32,77,97,110,
+    97,103,101,109,101,110,116,32,67,111,110,116,114,111,108,108,101,114,0,84,
+    114,105,102,108,101,120,32,80,67,73,32,116,111,32,73,83,65,32,80,110,
+    80,32,66,114,105,100,103,101,0,80,67,73,32,72,111,116,112,108,117,103,
+    32,67,111,110,116,114,111,108,108,101,114,0,90,70,77,105,99,114,111,0,
+    85,83,66,32,79,112,101,110,32,72,111,115,116,32,67,111,110,116,114,111,
+    108,108,101,114,0,72,80,70,67,45,53,49,54,54,65,0,84,97,99,104,
+    121,111,110,32,84,76,32,54,52,45,98,105,116,47,54,54,45,77,104,122,
+    32,70,67,32,72,66,65,0,83,109,97,114,116,45,50,32,65,114,114,97,
+    121,32,67,111,110,116,114,111,108,108,101,114,0,77,73,83,45,76,0,80,
+    67,73,32,116,111,32,73,83,65,32,66,114,105,100,103,101,0,77,80,67,
+    0,67,80,85,32,116,111,32,80,67,73,32,66,114,105,100,103,101,0,77,
+    73,83,45,69,0,80,67,73,32,116,111,32,73,83,65,32,80,110,80,32,
+    66,114,105,100,103,101,0,83,121,115,116,101,109,32,77,97,110,97,103,101,
+    109,101,110,116,32,67,111,110,116,114,111,108,108,101,114,0,78,101,116,101,
+    108,108,105,103,101,110,116,32,49,48,47,49,48,48,32,84,88,32,80,67,
+    73,32,85,84,80,32,84,76,65,78,32,50,46,51,0,84,114,105,102,108,
+    101,120,0,68,117,97,108,32,69,73,68,69,32,67,111,110,116,114,111,108,
+    108,101,114,0,78,101,116,101,108,108,105,103,101,110,116,32,49,48,32,84,
+    32,80,67,73,32,85,84,80,32,84,76,65,78,32,50,46,51,0,73,110,
+    116,101,103,114,97,116,101,100,32,78,101,116,70,108,101,120,32,51,47,80,
+    32,84,76,65,78,32,50,46,51,0,68,117,97,108,32,80,111,114,116,32,
+    78,101,116,101,108,108,105,103,101,110,116,32,49,48,47,49,48,48,32,84,
+    88,32,80,67,73,32,84,76,65,78,0,73,110,116,101,103,114,97,116,101,
+    100,32,78,101,116,101,108,108,105,103,101,110,116,32,49,48,47,49,48,48,
+    32,84,88,32,80,67,73,0,67,69,84,85,83,45,76,0,68,82,65,67,
+    79,0,80,67,73,32,66,114,105,100,103,101,0,78,111,114,116,104,83,116,
+    97,114,0,68,117,97,108,32,80,111,114,116,32,78,101,116,101,108,108,105,
+    103,101,110,116,32,49,48,47,49,48,48,32,84,88,0,78,101,116,101,108,
+    108,105,103,101,110,116,32,49,48,32,84,47,50,0,85,84,80,47,67,111,
+    97,120,32,80,67,73,0,78,67,51,49,50,48,0,70,97,115,116,32,69,
+    116,104,101,114,110,101,116,32,78,73,67,0,78,67,51,49,50,50,0,78,
+    67,49,49,50,48,0,69,116,104,101,114,110,101,116,32,78,73,67,0,78,
+    101,116,101,108,108,105,103,101,110,116,32,87,83,32,49,53,48,48,0,49,
+    48,47,49,48,48,84,88,32,69,109,98,101,100,100,101,100,32,85,84,80,
+    47,67,111,97,120,32,67,111,110,116,114,111,108,108,101,114,0,54,57,57,
+    50,48,57,45,48,48,51,0,49,48,47,49,48,48,84,88,32,87,79,76,
+    32,85,84,80,32,67,111,110,116,114,111,108,108,101,114,0,67,73,83,83,
+    0,83,77,65,82,84,50,32,65,114,114,97,121,32,67,111,110,116,114,111,
+    108,108,101,114,0,78,67,51,49,54,49,0,70,97,115,116,32,69,116,104,
+    101,114,110,101,116,32,69,109,98,101,100,100,101,100,32,67,111,110,116,114,
+    111,108,108,101,114,32,119,47,32,87,79,76,0,78,67,51,49,54,48,0,
+    78,67,51,49,50,49,32,114,101,118,46,32,65,32,38,97,109,112,59,32,
+    66,0,78,67,51,49,51,49,0,78,67,51,49,51,50,0,78,67,54,49,
+    51,50,0,71,105,103,97,98,105,116,32,77,111,100,117,108,101,0,78,67,
+    54,49,51,51,0,78,67,51,49,51,51,0,70,97,115,116,32,69,116,104,
+    101,114,110,101,116,32,77,111,100,117,108,101,0,78,67,54,49,51,52,0,
+    71,105,103,97,98,105,116,32,78,73,67,0,78,67,51,49,54,51,0,78,
+    67,51,49,54,50,0,78,67,51,49,50,51,0,78,67,51,49,51,52,0,
+    78,67,51,49,51,53,0,70,97,115,116,32,69,116,104,101,114,110,101,116,
+    32,85,112,103,114,97,100,101,32,77,111,100,117,108,101,0,67,73,83,83,
+    66,0,48,50,51,48,0,67,111,110,101,120,97,110,116,32,83,111,102,116,
+    75,53,54,32,77,111,100,101,109,0,78,67,55,49,51,49,0,105,76,111,
+    0,73,110,116,101,103,114,97,116,101,100,32,76,105,103,104,116,115,32,79,
+    117,116,32,80,114,111,99,101,115,115,111,114,0,70,67,65,50,49,48,49,
+    0,72,80,32,83,116,111,114,97,103,101,87,111,114,107,115,32,50,32,71,
+    98,44,32,54,52,45,66,105,116,47,54,54,45,77,72,122,32,80,67,73,
+    45,116,111,45,70,105,98,114,101,32,67,104,97,110,110,101,108,32,72,111,
+    115,116,32,66,117,115,32,65,100,97,112,116,101,114,32,102,111,114,32,87,
+    105,110,100,111,119,115,32,50,48,48,48,44,32,87,105,110,100,111,119,115,
+    0,84,104,117,110,100,101,114,76,65,78,32,49,46,48,32,78,101,116,70,
+    108,101,120,45,51,47,80,0,84,104,117,110,100,101,114,76,65,78,32,50,
+    46,51,32,78,101,116,70,108,101,120,45,51,47,80,32,119,105,116,104,32,
+    66,78,67,0,76,80,55,48,48,48,32,67,111,109,112,97,113,47,69,109,
+    117,108,101,120,32,70,105,98,114,101,32,67,104,97,110,110,101,108,32,72,
+    66,65,0,76,80,56,48,48,48,32,67,111,109,112,97,113,47,69,109,117,
+    108,101,120,32,70,105,98,114,101,32,67,104,97,110,110,101,108,32,72,66,
+    65,0,76,83,73,53,51,67,56,49,48,0,80,67,73,45,83,67,83,73,
+    32,73,47,79,32,80,114,111,99,101,115,115,111,114,0,53,51,67,56,50,
+    48,0,70,97,115,116,45,119,105,100,101,32,83,67,83,73,0,76,83,73,
+    53,51,67,49,48,49,48,45,51,51,0,80,67,73,32,116,111,32,83,67,
+    83,73,32,73,47,79,32,80,114,111,99,101,115,115,111,114,0,53,51,67,
+    56,49,53,0,83,67,83,73,32,114,97,105,100,32,99,111,110,116,114,111,
+    108,108,101,114,115,0,53,51,67,56,49,48,65,80,0,70,97,115,116,32,
+    83,67,83,73,0,76,83,73,53,51,67,56,54,48,47,56,54,48,69,0,
+    80,67,73,32,116,111,32,85,108,116,114,97,32,83,67,83,73,32,73,47,
+    79,32,80,114,111,99,101,115,115,111,114,0,76,83,73,53,51,67,49,53,
+    49,48,0,80,67,73,32,68,117,97,108,32,67,104,97,110,110,101,108,32,
+    87,105,100,101,32,85,108,116,114,97,50,32,83,67,83,73,32,67,116,114,
+    108,114,0,76,83,73,53,51,67,56,57,54,47,56,57,55,0,76,83,73,
+    53,51,67,56,57,53,0,80,67,73,32,116,111,32,85,108,116,114,97,50,
+    32,83,67,83,73,32,73,47,79,32,80,114,111,99,101,115,115,111,114,0,
+    53,51,67,56,56,53,0,85,108,116,114,97,32,87,105,100,101,32,83,67,
+    83,73,44,32,69,116,104,101,114,110,101,116,0,53,51,67,56,55,53,47,
+    56,55,53,69,47,56,55,54,47,56,55,54,69,0,73,50,79,45,82,101,
+    97,100,121,32,80,67,73,32,82,65,73,68,32,85,108,116,114,97,50,32,
+    83,67,83,73,32,67,116,114,108,114,0,76,83,73,53,51,67,56,57,53,
+    65,0,80,67,73,32,116,111,32,85,108,116,114,97,50,32,83,67,83,73,
+    32,67,111,110,116,114,111,108,108,101,114,0,76,83,73,53,51,67,56,55,
+    53,65,0,80,67,73,32,116,111,32,85,108,116,114,97,32,83,67,83,73,
+    32,67,111,110,116,114,111,108,108,101,114,0,80,67,73,32,116,111,32,68,
+    117,97,108,32,67,104,97,110,110,101,108,32,85,108,116,114,97,51,32,83,
+    67,83,73,32,67,116,114,108,114,0,76,83,73,53,51,67,49,48,48,48,
+    47,49,48,48,48,82,47,49,48,49,48,82,47,49,48,49,48,45,54,54,
+    0,80,67,73,32,116,111,32,85,108,116,114,97,49,54,48,32,83,67,83,
+    73,32,67,111,110,116,114,111,108,108,101,114,0,76,83,73,53,51,67,49,
+    48,50,48,47,49,48,51,48,0,80,67,73,45,88,32,116,111,32,85,108,
+    116,114,97,51,50,48,32,83,67,83,73,32,67,111,110,116,114,111,108,108,
+    101,114,0,76,83,73,53,51,67,49,48,51,48,90,67,0,80,67,73,45,
+    88,32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,76,83,
+    73,53,51,67,49,48,51,53,0,76,83,73,83,65,83,49,48,54,52,0,
+    80,67,73,45,88,32,70,117,115,105,111,110,45,77,80,84,32,83,65,83,
+    0,76,83,73,83,65,83,49,48,54,56,0,76,83,73,83,65,83,49,48,
+    54,52,69,84,0,80,67,73,45,69,120,112,114,101,115,115,32,70,117,115,
+    105,111,110,45,77,80,84,32,83,65,83,0,76,83,73,83,65,83,49,48,
+    54,56,69,0,76,83,73,83,65,83,49,48,54,54,0,76,83,73,83,65,
+    83,49,48,55,56,0,53,51,67,56,49,48,0,76,83,73,32,53,51,67,
+    56,120,120,32,83,67,83,73,32,104,111,115,116,32,97,100,97,112,116,101,
+    114,32,99,104,105,112,0,76,83,73,70,67,57,48,57,0,70,105,98,114,
+    101,32,67,104,97,110,110,101,108,32,73,47,79,32,80,114,111,99,101,115,
+    115,111,114,0,76,83,73,70,67,57,50,57,0,68,105,97,108,32,67,104,
+    97,110,110,101,108,32,70,105,98,114,101,32,67,104,97,110,110,101,108,32,
+    73,47,79,32,80,114,111,99,101,115,115,111,114,0,68,117,97,108,32,67,
+    104,97,110,110,101,108,32,70,105,98,114,101,32,67,104,97,110,110,101,108,
+    32,73,47,79,32,80,114,111,99,101,115,115,111,114,0,76,83,73,70,67,
+    57,49,57,0,76,83,73,70,67,57,50,57,88,0,70,105,98,114,101,32,
+    67,104,97,110,110,101,108,32,65,100,97,112,116,101,114,0,76,83,73,70,
+    67,57,49,57,88,0,76,83,73,70,67,57,50,48,0,76,83,73,70,67,
+    57,52,57,88,0,76,83,73,70,67,57,51,57,88,0,76,83,73,70,67,
+    57,52,57,69,83,0,49,48,47,49,48,48,32,77,66,105,116,32,69,116,
+    104,101,114,110,101,116,0,89,101,108,108,111,119,102,105,110,32,71,45,78,
+    73,67,0,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,
+    67,111,110,116,114,111,108,108,101,114,0,54,49,67,49,48,50,0,54,51,
+    67,56,49,53,0,70,97,115,116,32,83,67,83,73,32,67,111,110,116,114,
+    111,108,108,101,114,0,53,51,67,56,57,53,0,83,121,109,98,105,111,115,
+    32,85,108,116,114,97,50,32,83,67,83,73,32,99,111,110,116,114,111,108,
+    108,101,114,0,76,83,73,32,53,51,67,49,48,50,48,48,48,0,83,105,
+    110,103,108,101,32,99,104,97,110,110,101,108,32,83,67,83,73,32,99,111,
+    110,116,114,111,108,108,101,114,0,105,115,112,76,83,73,49,48,51,50,69,
+    0,80,67,73,32,49,54,49,54,44,32,49,54,32,84,84,76,45,73,78,
+    44,32,49,54,32,84,84,76,45,79,85,84,0,79,80,84,79,45,80,67,
+    73,44,32,49,54,32,73,78,32,47,32,49,54,32,79,85,84,32,50,52,
+    32,86,68,67,0,80,67,73,45,65,68,44,32,80,67,73,45,65,68,68,
+    65,32,97,110,97,108,111,103,32,73,47,79,45,99,97,114,100,0,80,67,
+    73,45,79,112,116,111,82,101,108,44,32,80,67,73,45,82,101,108,97,105,
+    115,32,49,54,32,82,101,108,97,105,115,32,38,97,109,112,59,32,79,112,
+    116,111,0,84,105,109,101,114,44,32,80,117,108,115,101,32,38,97,109,112,
+    59,32,67,111,117,110,116,101,114,45,99,97,114,100,32,49,54,46,46,51,
+    50,32,98,105,116,0,80,67,73,45,68,65,67,52,49,54,44,32,52,32,
+    99,104,97,110,110,101,108,32,68,47,65,49,54,98,105,116,32,112,114,101,
+    99,105,115,105,111,110,0,80,67,73,45,77,70,66,32,104,105,103,104,45,
+    115,112,101,101,100,32,97,110,97,108,111,103,32,73,47,79,0,80,82,79,
+    84,79,45,51,32,80,67,73,44,32,100,105,103,105,116,97,108,32,73,47,
+    79,32,119,105,116,104,32,99,104,105,112,115,101,108,101,99,116,0,85,110,
+    105,118,101,114,115,97,108,32,100,105,103,105,116,97,108,32,73,47,79,32,
+    80,67,73,45,73,110,116,101,114,102,97,99,101,0,97,116,105,32,49,57,
+    48,48,0,77,50,52,32,49,80,0,82,97,100,101,111,110,32,77,111,98,
+    105,108,105,116,121,32,88,54,48,48,0,77,50,52,32,49,84,0,70,105,
+    114,101,71,76,0,82,86,51,56,48,0,82,97,100,101,111,110,32,88,54,
+    48,48,0,70,105,114,101,71,76,32,86,51,50,48,48,0,65,51,0,82,
+    97,100,101,111,110,32,73,71,80,32,51,50,48,0,82,83,50,48,48,0,
+    82,97,100,101,111,110,32,73,71,80,32,51,52,48,0,82,51,48,48,0,
+    82,97,100,101,111,110,32,57,53,48,48,32,83,101,114,105,101,115,0,82,
+    97,100,101,111,110,32,57,50,48,48,32,40,77,43,88,41,0,82,97,100,
+    101,111,110,32,57,55,48,48,0,65,84,73,32,70,105,114,101,32,71,76,
+    32,90,49,32,32,86,105,100,101,111,32,65,99,99,101,108,101,114,97,116,
+    111,114,0,82,51,53,48,0,82,97,100,101,111,110,32,57,56,48,48,32,
+    83,69,0,114,118,51,53,48,0,82,97,100,101,111,110,32,57,54,48,48,
+    32,112,114,111,0,82,86,51,53,48,0,82,97,100,101,111,110,32,57,54,
+    48,48,0,82,86,51,54,48,0,82,97,100,101,111,110,32,57,54,48,48,
+    32,88,84,0,82,97,100,101,111,110,32,57,53,53,48,0,50,48,48,69,
+    49,55,97,102,0,77,97,99,104,32,51,50,0,82,97,100,101,111,110,32,
+    57,53,48,48,32,83,101,114,105,101,115,44,32,115,101,99,111,110,100,97,
+    114,121,0,82,51,48,48,32,40,49,50,56,98,105,116,32,109,101,109,32,
+    98,117,115,41,0,65,84,73,32,70,105,114,101,32,71,76,32,90,49,32,
+    52,80,32,83,69,67,79,78,68,65,82,89,32,86,105,100,101,111,0,82,
+    97,100,101,111,110,32,57,56,48,48,32,83,69,32,45,32,83,101,99,111,
+    110,100,97,114,121,0,82,97,100,101,111,110,32,57,54,48,48,32,45,32,
+    83,101,99,111,110,100,97,114,121,0,82,97,100,101,111,110,32,57,54,48,
+    48,32,83,101,99,111,110,100,97,114,121,0,82,97,100,101,111,110,32,57,
+    54,48,48,32,88,84,32,45,32,83,101,99,111,110,100,97,114,121,0,82,
+    97,100,101,111,110,32,57,53,53,48,32,45,32,83,101,99,111,110,100,97,
+    114,121,0,82,50,48,48,65,73,87,0,65,108,108,45,73,110,45,87,111,
+    110,100,101,114,32,56,53,48,48,68,86,0,76,117,99,101,110,116,32,79,
+    72,67,73,32,73,69,69,69,49,51,57,52,32,72,111,115,116,32,67,111,
+    110,116,114,111,108,108,101,114,0,114,115,50,48,48,0,82,97,100,101,111,
+    110,32,73,71,80,32,51,50,48,77,0,82,83,50,48,48,77,0,77,111,
+    98,105,108,105,116,121,32,77,54,32,40,85,50,41,0,65,68,49,57,56,
+    49,0,65,67,39,57,55,32,65,117,100,105,111,32,67,111,110,116,114,111,
+    108,108,101,114,0,73,88,80,32,49,53,48,0,72,85,66,32,66,114,105,
+    100,103,101,0,69,72,67,73,32,85,83,66,32,67,111,110,116,114,111,108,
+    108,101,114,0,79,72,67,73,32,85,83,66,32,67,111,110,116,114,111,108,
+    108,101,114,32,35,49,0,79,72,67,73,32,85,83,66,32,67,111,110,116,
+    114,111,108,108,101,114,32,35,50,0,65,84,65,32,67,111,110,116,114,111,
+    108,108,101,114,0,76,80,67,32,67,111,110,116,114,111,108,108,101,114,0,
+    97,55,53,45,115,50,50,54,0,65,103,101,114,101,32,83,121,115,116,101,
+    109,115,32,65,67,39,57,55,32,77,111,100,101,109,32,100,101,118,105,99,
+    101,0,83,77,66,117,115,32,67,111,110,116,114,111,108,108,101,114,0,50,
+    49,53,114,50,113,122,117,97,50,49,0,98,99,103,56,97,0,50,49,54,
+    108,48,115,97,115,50,53,0,77,97,99,104,54,52,32,67,88,0,73,88,
+    80,95,65,85,68,73,79,95,52,48,48,0,73,88,80,32,65,67,39,57,
+    55,32,65,117,100,105,111,32,67,111,110,116,114,111,108,108,101,114,0,120,
+    50,48,48,0,65,84,73,32,83,77,66,117,115,0,63,0,82,97,100,101,
+    111,32,83,66,52,48,48,32,61,32,82,83,52,56,48,32,83,111,117,116,
+    104,98,114,105,100,103,101,47,73,68,69,32,67,111,110,116,114,111,108,108,
+    101,114,0,65,67,57,55,0,65,67,57,55,32,77,111,100,101,109,0,79,
+    69,77,32,73,110,116,101,108,32,67,111,114,112,111,114,97,116,105,111,110,
+    38,97,109,112,59,0,77,105,99,114,111,115,111,102,116,32,85,65,65,32,
+    66,117,115,32,68,114,105,118,101,114,32,102,111,114,32,72,105,103,104,32,
+    68,101,102,105,110,105,116,105,111,110,32,65,117,100,105,111,0,77,97,99,
+    104,54,52,32,69,84,0,77,97,99,104,54,52,32,86,84,0,49,49,51,
+    45,45,51,52,48,48,52,45,49,48,52,0,40,71,84,45,67,50,85,50,
+    41,0,65,84,73,32,32,82,97,103,101,32,80,114,111,32,32,65,71,80,
+    32,50,88,32,56,109,98,0,82,97,103,101,32,51,68,32,80,114,111,32,
+    65,71,80,32,50,120,0,82,97,103,101,32,51,68,32,80,114,111,0,71,
+    84,45,67,50,85,50,0,65,84,73,32,51,68,32,82,65,71,69,32,80,
+    82,79,32,65,71,80,32,50,88,32,40,71,84,45,67,50,85,50,41,0,
+    65,84,73,32,65,76,76,32,73,78,32,87,79,78,68,69,82,32,80,82,
+    79,32,40,56,77,66,41,0,82,97,103,101,32,88,67,32,80,67,73,45,
+    54,54,0,107,55,32,115,111,109,43,0,82,97,103,101,32,88,76,32,65,
+    71,80,32,50,120,0,83,76,65,84,0,82,97,103,101,32,88,67,32,65,
+    71,80,32,50,120,0,82,97,103,101,32,88,76,32,80,67,73,45,54,54,
+    0,73,32,78,101,101,100,32,68,114,105,118,101,114,32,102,111,114,32,116,
+    104,101,32,67,104,105,112,0,65,84,73,32,51,68,32,82,97,103,101,32,
+    80,114,111,32,50,49,53,71,80,0,82,97,103,101,32,51,68,32,80,114,
+    111,32,80,67,73,0,65,84,73,32,40,71,84,45,67,50,85,50,41,0,
+    82,97,103,101,32,88,76,32,80,67,73,0,82,97,103,101,32,88,67,32,
+    80,67,73,0,77,97,99,104,32,54,52,32,86,84,0,82,97,103,101,32,
+    51,68,32,73,73,32,71,114,97,112,104,105,99,115,32,65,99,99,101,108,
+    101,114,97,116,111,114,0,82,97,103,101,32,51,68,32,73,73,43,112,99,
+    105,0,51,100,32,114,97,103,101,32,50,32,43,32,100,118,100,0,82,97,
+    103,101,32,51,68,32,73,73,67,32,65,71,80,0,71,114,97,112,104,105,
+    99,115,32,65,99,99,101,108,101,114,97,116,111,114,0,51,68,32,49,49,
+    67,32,65,71,80,0,50,49,48,56,56,56,71,88,0,77,97,99,104,32,
+    54,52,32,71,84,0,109,51,100,32,97,103,112,32,99,97,114,100,32,111,
+    110,32,97,103,112,32,115,108,111,116,0,50,49,53,114,50,113,117,97,49,
+    50,0,82,97,103,101,32,73,73,67,32,65,71,80,0,82,86,50,53,48,
+    0,82,97,100,101,111,110,32,57,48,48,48,47,57,48,48,48,32,80,114,
+    111,0,82,97,100,101,111,110,32,57,48,48,48,0,82,97,100,101,111,110,
+    32,57,48,48,48,47,57,48,48,48,32,80,114,111,32,45,32,83,101,99,
+    111,110,100,97,114,121,0,82,97,100,101,111,110,32,57,48,48,48,32,45,
+    32,83,101,99,111,110,100,97,114,121,0,82,52,50,51,0,82,97,100,101,
+    111,110,32,88,56,48,48,32,103,116,0,82,52,50,48,0,82,65,68,69,
+    79,78,32,88,56,48,48,32,88,84,0,82,65,68,69,79,78,32,88,56,
+    48,48,32,88,84,32,83,101,99,111,110,100,97,114,121,0,66,49,48,69,
+    48,69,49,49,0,82,97,103,101,32,51,68,32,76,84,32,80,114,111,32,
+    65,71,80,32,49,51,51,32,77,72,122,0,82,97,103,101,32,51,68,32,
+    76,84,32,80,114,111,32,65,71,80,0,82,97,103,101,32,77,111,98,105,
+    108,105,116,121,32,77,51,32,65,71,80,0,77,111,98,105,108,105,116,121,
+    32,77,51,32,65,71,80,0,48,120,52,99,52,54,0,97,116,105,32,114,
+    97,103,101,32,112,114,111,0,82,97,103,101,32,51,68,32,76,84,45,71,
+    0,49,50,51,0,82,97,103,101,32,51,68,32,76,84,32,80,114,111,0,
+    48,49,53,52,49,48,49,52,0,82,97,103,101,32,80,47,77,32,77,111,
+    98,105,108,105,116,121,32,65,71,80,32,50,120,0,50,49,54,108,111,32,
+    115,97,115,97,50,53,0,82,97,103,101,32,77,111,98,105,108,105,116,121,
+    32,108,0,49,49,51,0,82,97,103,101,32,51,68,32,76,84,32,80,114,
+    111,32,80,67,73,0,49,50,52,49,50,52,51,0,82,97,103,101,32,80,
+    47,77,32,77,111,98,105,108,105,116,121,32,97,103,112,0,50,49,54,76,
+    48,83,65,83,65,50,53,0,82,97,103,101,32,76,32,77,111,98,105,108,
+    105,116,121,32,80,67,73,0,77,97,99,104,32,54,52,32,76,84,0,102,
+    100,100,115,0,82,97,100,101,111,110,32,77,111,98,105,108,105,116,121,32,
+    77,55,32,76,87,0,70,105,114,101,71,76,32,77,111,98,105,108,105,116,
+    121,0,77,111,98,105,108,105,116,121,32,54,0,82,97,100,101,111,110,32,
+    77,111,98,105,108,105,116,121,32,77,54,32,83,101,114,105,101,115,0,82,
+    97,100,101,111,110,32,77,111,98,105,108,105,116,121,32,77,54,32,76,90,
+    0,82,97,100,101,111,110,32,77,111,98,105,108,105,116,121,32,77,57,45,
+    71,76,0,65,84,73,32,77,79,66,73,76,73,84,89,32,82,65,68,69,
+    79,78,32,57,48,48,48,32,40,77,105,99,114,111,115,111,102,116,32,67,
+    111,114,112,111,114,97,116,105,111,110,32,45,0,82,97,100,101,111,110,32,
+    77,111,98,105,108,105,116,121,32,77,57,0,82,97,103,101,32,77,111,98,
+    105,108,105,116,121,32,49,50,56,32,65,71,80,32,52,120,0,82,97,103,
+    101,32,77,111,98,105,108,105,116,121,32,49,50,56,32,65,71,80,0,65,
+    84,73,32,84,104,101,97,116,101,114,32,53,53,48,32,80,114,111,0,82,
+    97,100,101,111,110,32,57,55,48,48,47,57,53,48,48,32,83,101,114,105,
+    101,115,0,82,97,100,101,111,110,32,57,53,48,48,32,80,114,111,0,82,
+    97,100,101,111,110,32,57,54,48,48,84,88,0,65,84,73,32,70,105,114,
+    101,32,71,76,32,88,49,47,90,49,32,86,105,100,101,111,32,65,99,99,
+    101,108,101,114,97,116,111,114,0,82,51,54,48,0,82,97,100,101,111,110,
+    32,57,56,48,48,32,80,114,111,0,82,97,100,101,111,110,32,57,56,48,
+    48,0,82,97,100,101,111,110,32,57,56,48,48,32,88,84,0,70,71,76,
+    57,56,48,48,88,84,0,65,84,73,32,70,73,82,69,71,76,32,88,50,
+    45,50,53,54,84,0,82,86,51,54,48,77,49,48,0,82,97,100,101,111,
+    110,32,77,111,98,105,108,105,116,121,32,57,54,48,48,32,80,114,111,0,
+    82,86,51,53,48,45,87,83,0,82,97,100,101,111,110,32,77,111,98,105,
+    108,105,116,121,32,77,49,48,32,78,84,0,82,97,100,101,111,110,32,57,
+    55,48,48,32,80,114,111,0,82,97,100,101,111,110,32,57,55,48,48,47,
+    57,53,48,48,32,83,101,114,105,101,115,32,45,32,83,101,99,111,110,100,
+    97,114,121,0,82,97,100,101,111,110,32,57,54,48,48,84,88,32,45,32,
+    83,101,99,111,110,100,97,114,121,0,70,105,114,101,32,71,76,32,88,49,
+    47,90,49,32,65,71,80,32,91,80,114,111,93,32,83,101,99,111,110,100,
+    97,114,121,32,86,105,100,101,111,0,82,97,100,101,111,110,32,57,56,48,
+    48,32,80,114,111,32,45,32,83,101,99,111,110,100,97,114,121,0,82,97,
+    100,101,111,110,32,57,56,48,48,32,45,32,83,101,99,111,110,100,97,114,
+    121,0,82,97,100,101,111,110,32,57,56,48,48,32,88,84,32,45,32,83,
+    101,99,111,110,100,97,114,121,0,65,84,73,32,70,73,82,69,71,76,32,
+    88,50,45,50,53,54,84,32,83,101,99,111,110,100,97,114,121,0,103,116,
+    0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,65,32,80,67,73,
+    0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,66,32,65,71,80,
+    32,50,120,0,49,50,51,49,51,50,52,52,52,53,0,82,97,103,101,32,
+    49,50,56,32,80,114,111,32,80,67,32,65,71,80,32,52,120,0,114,118,
+    49,48,48,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,68,32,
+    80,67,73,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,69,32,
+    65,71,80,32,50,120,0,53,48,52,54,0,82,97,103,101,32,49,50,56,
+    32,80,114,111,32,80,70,32,65,71,80,32,52,120,0,50,49,53,82,51,
+    66,85,65,50,50,0,32,51,100,32,82,97,103,101,32,112,114,111,32,97,
+    103,112,32,50,120,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,
+    72,32,65,71,80,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,
+    72,32,65,71,80,32,50,120,0,98,107,50,46,48,46,50,46,118,114,48,
+    48,49,46,48,48,49,46,48,48,50,46,48,48,50,46,48,48,52,46,48,
+    50,53,46,112,114,116,51,46,116,121,46,116,0,82,97,103,101,32,49,50,
+    56,32,80,114,111,32,80,73,32,65,71,80,32,52,120,0,82,97,103,101,
+    32,49,50,56,32,80,114,111,32,80,74,32,80,67,73,0,82,97,103,101,
+    32,49,50,56,32,80,114,111,32,80,74,32,80,67,73,32,40,84,77,68,
+    83,41,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,75,32,65,
+    71,80,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,75,32,65,
+    71,80,32,50,120,32,40,84,77,68,83,41,0,82,97,103,101,32,49,50,
+    56,32,80,114,111,32,80,76,32,65,71,80,0,52,120,32,40,84,77,68,
+    83,41,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,77,32,80,
+    67,73,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,78,32,65,
+    71,80,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,78,32,65,
+    71,80,32,50,120,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,
+    79,32,65,71,80,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,
+    79,32,65,71,80,32,52,120,0,82,97,103,101,32,49,50,56,32,80,114,
+    111,32,80,80,32,80,67,73,0,82,97,103,101,32,49,50,56,32,80,114,
+    111,32,80,80,32,80,67,73,32,40,84,77,68,83,41,0,82,97,103,101,
+    32,49,50,56,32,80,114,111,32,80,81,32,65,71,80,0,82,97,103,101,
+    32,49,50,56,32,80,114,111,32,80,81,32,65,71,80,32,50,120,32,40,
+    84,77,68,83,41,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,
+    82,32,65,71,80,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,
+    82,32,65,71,80,32,52,120,32,40,84,77,68,83,41,0,82,97,103,101,
+    32,49,50,56,32,80,114,111,32,80,83,32,80,67,73,0,82,97,103,101,
+    32,49,50,56,32,80,114,111,32,80,84,32,65,71,80,0,82,97,103,101,
+    32,49,50,56,32,80,114,111,32,80,84,32,65,71,80,32,50,120,0,114,
+    97,103,101,32,49,50,56,32,112,114,111,32,97,103,112,32,52,120,32,116,
+    109,100,115,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,86,32,
+    80,67,73,0,82,97,103,101,32,49,50,56,32,80,114,111,32,80,86,32,
+    80,67,73,32,40,84,77,68,83,41,0,82,97,103,101,32,49,50,56,32,
+    80,114,111,32,80,87,32,65,71,80,0,82,97,103,101,32,49,50,56,32,
+    80,114,111,32,80,87,32,65,71,80,32,50,120,32,40,84,77,68,83,41,
+    0,82,97,103,101,32,49,50,56,32,80,114,111,0,80,88,32,65,71,80,
+    32,52,120,32,40,84,77,68,83,41,0,82,97,100,101,111,110,32,55,50,
+    48,48,32,81,68,32,83,68,82,47,68,68,82,0,82,97,100,101,111,110,
+    32,81,69,0,82,97,100,101,111,110,32,81,70,0,82,97,100,101,111,110,
+    32,81,71,0,82,50,48,48,0,82,97,100,101,111,110,32,82,50,48,48,
+    32,81,72,0,82,97,100,101,111,110,32,82,50,48,48,32,81,73,0,82,
+    97,100,101,111,110,32,82,50,48,48,32,81,74,0,82,97,100,101,111,110,
+    32,82,50,48,48,32,81,75,0,82,97,100,101,111,110,32,56,53,48,48,
+    32,47,32,56,53,48,48,76,69,0,82,101,100,101,111,110,32,57,49,48,
+    48,32,83,101,114,105,101,115,0,82,97,100,101,111,110,32,82,50,48,48,
+    32,81,77,0,82,97,100,101,111,110,32,82,50,48,48,32,81,78,0,82,
+    86,50,48,48,0,82,97,100,101,111,110,32,55,53,48,48,0,114,97,100,
+    101,111,110,32,57,55,48,48,32,111,114,32,57,50,48,48,0,82,97,100,
+    101,111,110,32,55,53,48,48,32,81,88,0,82,86,49,48,48,0,82,97,
+    100,101,111,110,32,55,48,48,48,32,47,32,82,97,100,101,111,110,32,86,
+    69,0,82,97,100,101,111,110,32,86,69,32,81,90,0,82,97,100,101,111,
+    110,32,69,83,49,48,48,48,0,82,97,100,101,111,110,32,82,50,48,48,
+    32,81,104,0,82,97,100,101,111,110,32,82,50,48,48,32,81,105,0,82,
+    97,100,101,111,110,32,82,50,48,48,32,81,106,0,82,97,100,101,111,110,
+    32,82,50,48,48,32,81,107,0,82,101,100,101,111,110,32,57,49,48,48,
+    32,83,101,114,105,101,115,32,45,32,83,101,99,111,110,100,97,114,121,0,
+    50,49,53,82,52,54,65,83,65,50,50,0,82,97,103,101,32,49,50,56,
+    32,71,76,32,80,67,73,0,82,97,103,101,32,49,50,56,32,80,82,79,
+    0,82,97,103,101,32,51,50,77,66,0,82,97,103,101,32,49,50,56,32,
+    82,71,0,103,48,49,48,56,48,45,49,48,56,0,82,97,103,101,32,49,
+    50,56,32,86,82,32,82,75,32,80,67,73,0,82,97,103,101,32,49,50,
+    56,32,86,82,32,82,76,32,65,71,80,32,50,120,0,82,97,103,101,32,
+    49,50,56,32,52,120,32,83,69,32,80,67,73,0,82,97,103,101,32,49,
+    50,56,32,83,70,32,52,120,32,65,71,80,32,50,120,0,82,97,103,101,
+    32,49,50,56,32,83,71,32,52,120,32,65,71,80,32,52,120,0,82,97,
+    103,101,32,49,50,56,32,52,120,32,83,72,0,82,97,103,101,32,49,50,
+    56,32,83,75,32,80,67,73,0,82,97,103,101,32,49,50,56,32,52,120,
+    32,83,75,32,80,67,73,0,82,97,103,101,32,49,50,56,32,83,76,32,
+    65,71,80,32,50,120,0,82,97,103,101,32,49,50,56,32,52,120,32,83,
+    76,32,65,71,80,32,50,120,0,82,97,103,101,32,49,50,56,32,83,77,
+    32,65,71,80,32,52,120,0,82,97,103,101,32,49,50,56,32,52,120,32,
+    83,77,32,65,71,80,32,52,120,0,82,97,103,101,32,49,50,56,32,52,
+    120,0,77,97,99,104,32,54,52,32,83,84,0,82,97,103,101,32,49,50,
+    56,32,80,82,79,32,85,76,84,82,65,0,86,105,100,101,111,32,67,111,
+    110,116,114,111,108,108,101,114,32,40,86,71,65,32,67,111,109,112,97,116,
+    105,98,108,101,41,0,82,97,103,101,32,49,50,56,32,80,114,111,32,84,
+    76,0,82,97,103,101,32,49,50,56,32,80,114,111,32,84,82,0,82,97,
+    103,101,32,49,50,56,32,80,114,111,32,85,108,116,114,97,32,84,85,0,
+    82,86,51,55,48,0,82,97,100,101,111,110,32,88,51,48,48,32,77,111,
+    98,105,108,105,116,121,32,40,77,50,50,41,0,82,52,51,48,0,82,97,
+    100,101,111,110,32,88,56,48,48,32,88,76,0,82,52,50,51,71,76,45,
+    83,69,0,65,84,73,32,70,73,82,69,71,76,32,86,53,49,48,48,32,
+    80,67,73,45,69,88,32,80,114,105,109,97,114,121,0,82,97,100,101,111,
+    110,32,88,56,48,48,32,88,76,32,45,32,83,101,99,111,110,100,97,114,
+    121,0,65,84,73,32,70,73,82,69,71,76,32,86,53,49,48,48,32,80,
+    67,73,45,69,88,32,83,101,99,111,110,100,97,114,121,0,82,52,49,48,
+    0,77,111,98,105,108,105,116,121,32,88,55,48,48,0,50,49,53,86,84,
+    50,67,65,52,50,0,77,97,99,104,32,54,52,32,86,84,32,86,73,68,
+    69,79,32,88,80,82,69,83,83,73,79,78,0,77,97,99,104,32,54,52,
+    32,86,84,51,0,77,97,99,104,32,54,52,32,86,84,52,32,80,67,73,
+    0,82,83,51,48,48,0,72,111,115,116,32,66,114,105,100,103,101,0,82,
+    97,100,101,111,110,32,57,49,48,48,32,73,71,80,0,77,111,98,105,108,
+    116,105,121,32,82,97,100,101,111,110,32,57,49,48,48,32,73,71,80,32,
+    65,71,80,0,65,71,80,32,66,114,105,100,103,101,0,82,86,50,56,48,
+    0,82,97,100,101,111,110,32,57,50,48,48,32,80,114,111,32,45,32,83,
+    101,99,111,110,100,97,114,121,0,65,84,73,32,82,97,100,101,111,110,32,
+    57,50,48,48,32,45,32,83,101,99,111,110,100,97,114,121,0,110,97,0,
+    65,84,73,32,82,97,100,101,111,110,32,88,112,114,101,115,115,32,50,48,
+    48,32,83,101,114,105,101,115,32,45,32,82,83,52,56,48,0,63,63,63,
+    0,77,111,98,105,108,105,116,121,32,82,97,100,101,111,110,32,88,80,82,
+    69,83,83,32,50,48,48,0,82,97,100,101,111,110,32,57,50,48,48,32,
+    80,114,111,0,65,84,73,32,82,65,68,69,79,78,32,57,50,48,48,32,
+    115,101,32,97,103,112,0,82,97,100,101,111,110,32,57,50,48,48,0,82,
+    97,100,101,111,110,32,57,50,48,48,32,83,69,32,83,101,114,105,101,115,
+    0,78,118,105,100,105,97,0,70,105,114,101,77,86,32,50,50,48,48,0,
+    82,67,52,49,48,0,78,111,114,116,104,98,114,105,100,103,101,58,32,82,
+    97,100,101,111,110,32,88,112,114,101,115,115,32,50,48,48,0,88,50,48,
+    48,77,0,83,85,66,83,89,83,95,49,49,56,50,49,48,52,51,38,97,
+    109,112,59,82,69,86,95,48,48,92,52,38,97,109,112,59,49,67,70,50,
+    70,66,66,52,38,97,109,112,59,48,38,97,109,112,59,50,56,48,56,0,
+    82,97,100,101,111,110,32,88,80,114,101,115,115,32,50,48,48,32,40,82,
+    67,52,49,48,41,0,82,97,100,101,111,110,32,88,112,114,101,115,115,32,
+    50,48,48,32,40,82,67,52,49,48,41,32,86,71,65,32,99,97,114,100,
+    0,82,97,100,101,111,110,32,88,51,48,48,0,65,84,73,32,84,101,99,
+    104,110,111,108,111,103,105,101,115,32,73,110,99,32,82,86,51,55,48,32,
+    53,66,54,48,32,91,82,97,100,101,111,110,32,88,51,48,48,32,40,80,
+    67,73,69,41,93,0,82,65,68,69,79,78,32,88,54,48,48,32,83,101,
+    114,105,101,115,32,50,54,53,77,66,0,82,86,51,55,48,71,76,0,117,
+    110,107,110,111,119,110,0,82,65,68,69,79,78,32,88,51,48,48,0,98,
+    107,45,97,116,105,32,118,101,114,48,48,56,46,48,49,54,109,46,48,56,
+    53,46,48,48,54,0,77,111,98,105,108,105,116,121,32,82,97,100,101,111,
+    110,32,57,50,48,48,0,82,86,50,56,48,32,40,77,57,43,41,0,82,
+    97,100,101,111,110,32,57,50,48,48,32,83,69,32,83,101,114,105,101,115,
+    32,45,32,83,101,99,111,110,100,97,114,121,0,65,84,73,32,70,105,114,
+    101,77,86,32,50,50,48,48,32,80,67,73,32,83,101,99,111,110,100,97,
+    114,121,0,77,111,98,105,108,105,116,121,32,82,97,100,101,111,110,32,88,
+    56,48,48,0,80,67,73,45,69,32,71,114,97,112,104,105,99,115,32,97,
+    100,97,112,116,101,114,32,102,114,111,109,32,67,108,101,118,111,32,68,57,
+    48,48,84,32,110,111,116,101,98,111,111,107,0,82,97,100,101,111,110,32,
+    88,84,56,53,48,0,114,52,56,48,0,120,56,48,48,103,116,111,32,50,
+    53,54,32,112,99,105,45,101,0,65,51,47,85,49,0,80,67,73,32,116,
+    111,32,65,71,80,32,66,114,105,100,103,101,0,82,53,50,48,0,82,97,
+    100,101,111,110,32,88,49,56,48,48,32,83,101,114,105,101,115,0,78,47,
+    65,0,82,97,100,101,111,110,32,88,49,51,48,48,32,80,114,111,32,111,
+    114,32,88,49,53,53,48,0,120,49,52,48,48,0,80,67,73,92,86,69,
+    78,95,49,48,48,50,38,97,109,112,59,68,69,86,95,55,49,52,53,38,
+    97,109,112,59,83,85,66,83,89,83,95,50,48,48,51,49,48,50,56,38,
+    97,109,112,59,82,69,86,95,48,48,92,52,38,97,109,112,59,49,67,57,
+    69,67,48,56,53,38,97,109,112,59,48,38,97,109,112,59,48,48,48,56,
+    0,82,97,100,101,111,110,32,88,49,51,48,48,32,88,71,69,0,50,49,
+    54,67,90,74,65,75,65,49,50,70,65,71,0,65,84,73,32,77,111,98,
+    105,108,105,116,121,32,82,97,100,101,111,110,32,88,49,51,48,48,44,32,
+    77,53,50,45,54,52,0,82,86,53,48,53,0,82,97,100,101,111,110,32,
+    88,49,51,48,48,47,88,49,53,53,48,32,83,101,114,105,101,115,0,77,
+    111,98,105,108,105,116,121,32,82,97,100,101,111,110,32,88,49,52,53,48,
+    0,82,97,100,101,111,110,32,49,51,48,48,0,97,116,105,32,103,114,97,
+    112,104,105,99,115,0,82,97,100,101,111,110,32,49,51,48,48,32,83,101,
+    99,111,110,100,97,114,121,0,65,84,73,32,88,49,54,48,48,32,80,114,
+    111,32,80,67,73,45,69,0,82,86,53,51,48,63,0,82,97,100,101,111,
+    110,32,88,49,54,48,48,32,77,111,98,105,108,105,116,121,0,49,56,48,
+    54,51,54,57,49,49,55,50,49,0,82,53,56,48,76,69,0,82,97,100,
+    101,111,110,32,88,49,57,53,48,32,80,114,111,0,82,97,100,101,111,110,
+    32,88,49,57,53,48,32,80,114,111,32,83,101,114,105,101,115,32,65,71,
+    80,32,40,48,120,55,50,56,48,41,0,82,97,100,101,111,110,32,88,49,
+    57,53,48,32,80,114,111,32,83,101,99,111,110,100,97,114,121,0,82,97,
+    100,101,111,110,32,88,49,57,53,48,32,80,114,111,32,83,101,114,105,101,
+    115,32,65,71,80,32,40,48,120,55,50,65,48,41,0,82,83,51,53,48,
+    0,82,97,100,101,111,110,32,57,49,48,48,32,80,114,111,0,82,83,54,
+    57,48,0,65,84,73,32,77,111,98,105,108,105,116,121,32,82,97,100,101,
+    111,110,32,120,49,50,53,48,0,45,0,65,84,73,32,88,80,114,101,115,
+    115,32,49,50,53,48,77,0,82,54,48,48,0,65,84,73,32,82,97,100,
+    101,111,110,32,72,68,32,50,57,48,48,32,88,84,0,82,86,54,49,48,
+    0,65,84,73,32,82,97,100,101,111,110,32,72,68,32,50,52,48,48,32,
+    80,82,79,0,65,84,73,32,82,97,100,101,111,110,32,72,68,32,50,52,
+    48,48,32,80,82,79,32,65,71,80,0,82,86,54,51,48,0,65,84,73,
+    32,82,97,100,101,111,110,32,72,68,32,50,54,48,48,32,88,84,0,65,
+    84,73,32,82,97,100,101,111,110,32,72,68,32,50,54,48,48,32,80,82,
+    79,0,65,84,73,32,71,84,67,32,40,71,84,45,67,50,85,50,41,0,
+    65,84,73,32,51,68,32,82,97,103,101,32,80,114,111,32,65,71,80,32,
+    50,88,0,83,50,75,32,67,80,85,32,116,111,32,80,67,73,32,66,114,
+    105,100,103,101,0,83,108,111,116,49,32,67,80,85,32,116,111,32,80,67,
+    73,32,66,114,105,100,103,101,0,48,120,48,50,48,49,0,56,50,67,53,
+    57,49,47,50,45,70,67,49,0,67,80,85,32,66,114,105,100,103,101,0,
+    56,50,67,53,57,51,0,56,50,67,53,57,52,0,87,105,108,100,99,97,
+    116,32,83,121,115,116,101,109,32,67,111,110,116,114,111,108,108,101,114,0,
+    56,50,67,53,57,54,47,53,57,55,0,87,105,108,100,99,97,116,32,73,
+    83,65,32,66,114,105,100,103,101,0,56,50,67,53,57,55,45,65,70,67,
+    50,0,56,50,67,53,52,49,0,56,50,67,53,52,51,0,100,116,100,102,
+    116,100,102,122,0,67,80,85,32,116,111,32,80,67,73,32,66,114,105,100,
+    103,101,32,102,111,114,32,110,111,116,101,98,111,111,107,0,56,50,67,53,
+    51,50,0,80,101,114,105,112,104,101,114,97,108,32,67,111,110,116,114,111,
+    108,108,101,114,0,56,50,67,53,51,52,0,80,67,73,32,116,111,32,80,
+    67,73,32,66,114,105,100,103,101,0,56,50,67,53,51,56,0,56,50,67,
+    53,51,53,0,56,50,67,49,52,55,0,73,114,68,65,32,67,111,110,116,
+    114,111,108,108,101,114,0,56,50,67,57,55,53,0,82,73,83,67,32,71,
+    85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,56,50,67,57,50,
+    53,0,83,65,65,55,55,56,53,0,84,104,117,110,100,101,114,66,105,114,
+    100,32,80,67,73,32,65,117,100,105,111,32,65,99,99,101,108,101,114,97,
+    116,111,114,0,84,104,117,110,100,101,114,66,105,114,100,32,106,111,121,115,
+    116,105,99,107,32,112,111,114,116,0,84,104,117,110,100,101,114,66,105,114,
+    100,32,49,54,54,53,48,32,85,65,82,84,0,75,84,88,48,50,48,56,
+    88,0,80,104,105,108,105,112,115,32,83,101,105,115,109,105,99,32,69,100,
+    103,101,32,55,48,53,0,49,0,80,104,105,108,105,112,115,32,80,83,67,
+    55,48,53,32,71,97,109,101,80,111,114,116,32,69,110,117,109,101,114,97,
+    116,111,114,0,86,65,83,57,54,48,49,49,0,71,111,108,100,101,110,32,
+    71,97,116,101,32,73,73,0,68,80,56,51,56,49,48,0,49,48,47,49,
+    48,48,32,69,116,104,101,114,110,101,116,32,77,65,67,0,80,67,56,55,
+    52,49,53,0,80,67,73,45,73,68,69,32,68,77,65,32,77,97,115,116,
+    101,114,32,77,111,100,101,32,73,110,116,101,114,102,97,99,101,32,67,116,
+    114,108,114,0,80,67,56,55,53,54,48,0,76,101,103,97,99,121,32,73,
+    47,79,32,67,111,110,116,114,111,108,108,101,114,0,67,83,52,50,49,48,
+    0,73,69,69,69,32,49,51,57,52,32,79,72,67,73,32,67,111,110,116,
+    114,111,108,108,101,114,0,80,67,73,32,83,121,115,116,101,109,32,73,47,
+    79,0,76,77,52,53,54,48,0,65,100,118,97,110,99,101,100,32,80,67,
+    73,32,65,117,100,105,111,32,65,99,99,101,108,101,114,97,116,111,114,0,
+    68,80,56,51,56,49,53,47,49,54,0,77,97,99,80,104,121,116,101,114,
+    32,49,48,47,49,48,48,32,77,98,47,115,32,69,116,104,101,114,110,101,
+    116,32,77,65,67,32,38,97,109,112,59,32,80,72,89,0,80,67,56,50,
+    52,52,48,0,68,80,56,51,56,50,48,47,49,0,49,48,47,49,48,48,
+    47,49,48,48,48,32,77,98,47,115,32,80,67,73,32,69,116,104,101,114,
+    110,101,116,32,78,73,67,0,67,83,53,53,51,53,0,71,101,111,100,101,
+    76,105,110,107,32,80,67,73,32,83,111,117,116,104,32,66,114,105,100,103,
+    101,0,53,53,51,53,0,71,101,111,100,101,32,73,68,69,32,67,111,110,
+    116,114,111,108,108,101,114,0,67,97,115,116,108,101,32,40,67,83,53,53,
+    51,53,41,0,71,69,79,68,69,32,45,32,71,88,51,32,65,117,100,105,
+    111,0,71,101,111,100,101,0,71,101,111,100,101,32,86,71,65,32,67,111,
+    109,112,97,116,105,98,108,101,32,68,101,118,105,99,101,0,83,67,120,50,
+    48,48,0,76,80,67,32,66,114,105,100,103,101,32,97,110,100,32,71,80,
+    73,79,0,83,77,73,32,83,116,97,116,117,115,32,97,110,100,32,65,67,
+    80,73,0,83,67,49,49,48,48,47,83,67,120,50,48,48,0,73,68,69,
+    32,67,111,110,116,114,111,108,108,101,114,0,88,112,114,101,115,115,65,85,
+    68,73,79,0,86,105,100,101,111,32,80,114,111,99,101,115,115,111,114,0,
+    88,45,66,117,115,32,69,120,112,97,110,115,105,111,110,32,73,110,116,101,
+    114,102,97,99,101,0,83,67,49,49,48,48,0,77,50,55,54,52,65,70,
+    73,0,80,67,73,45,73,68,69,32,73,110,116,101,114,102,97,99,101,0,
+    69,84,52,48,48,48,87,51,50,80,45,65,0,69,84,52,48,48,48,87,
+    51,50,80,45,66,0,69,84,52,48,48,48,87,51,50,80,45,67,0,69,
+    84,52,48,48,48,87,51,50,80,45,68,0,69,84,54,48,48,48,0,71,
+    114,97,112,104,105,99,115,47,77,117,108,116,105,109,101,100,105,97,32,69,
+    110,103,105,110,101,0,69,84,54,51,48,48,0,83,84,80,67,32,67,108,
+    105,101,110,116,0,83,111,117,116,104,32,66,114,105,100,103,101,0,80,57,
+    48,48,48,0,87,101,105,116,101,107,80,111,119,101,114,32,71,85,73,32,
+    65,99,99,101,108,101,114,97,116,111,114,0,80,57,49,48,48,0,68,67,
+    50,49,48,53,48,0,80,67,73,45,80,67,73,32,66,114,105,100,103,101,
+    0,68,67,50,49,48,52,48,0,84,117,108,105,112,32,69,116,104,101,114,
+    110,101,116,32,65,100,97,112,116,101,114,0,68,67,50,49,48,51,48,0,
+    80,67,73,32,71,114,97,112,104,105,99,115,32,65,99,99,101,108,101,114,
+    97,116,111,114,0,90,101,112,104,121,114,0,78,86,45,82,65,77,0,75,
+    90,80,83,65,0,83,67,83,73,32,116,111,32,83,67,83,73,32,65,100,
+    97,112,116,101,114,0,68,67,50,49,49,52,48,0,70,97,115,116,32,69,
+    116,104,101,114,110,101,116,32,67,116,114,108,114,0,68,67,50,49,50,51,
+    48,0,86,105,100,101,111,32,67,111,100,101,99,0,49,48,49,49,0,84,
+    71,65,50,0,84,71,65,50,32,80,68,88,71,66,0,68,69,70,80,65,
+    0,70,68,68,73,0,68,67,50,49,48,52,49,0,84,117,108,105,112,32,
+    80,108,117,115,32,69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,
+    114,0,68,71,76,80,66,0,68,67,50,49,49,52,50,47,51,0,80,67,
+    73,47,67,97,114,100,66,117,115,32,49,48,47,49,48,48,32,77,98,105,
+    116,32,69,116,104,101,114,110,101,116,32,67,116,108,114,0,50,49,48,53,
+    50,91,45,65,66,93,0,68,67,50,49,49,53,48,45,65,65,0,68,67,
+    50,49,49,53,48,0,68,67,50,49,49,53,49,47,50,0,50,49,49,53,
+    51,0,50,49,49,53,52,0,77,111,100,101,109,53,54,0,67,97,114,100,
+    66,117,115,0,68,67,50,49,53,53,51,0,50,49,53,53,52,0,80,67,
+    73,45,116,111,45,80,67,73,32,66,114,105,100,103,101,0,50,49,50,56,
+    53,0,67,111,114,101,32,76,111,103,105,99,32,102,111,114,32,83,65,45,
+    49,49,48,32,77,105,99,114,111,112,114,111,99,101,115,115,111,114,0,51,
+    88,45,75,80,67,79,78,45,65,65,0,70,97,117,108,116,32,77,103,114,
+    32,40,51,46,51,118,47,53,118,32,85,110,105,118,101,114,115,97,108,32,
+    80,67,73,41,0,70,87,56,50,51,55,49,69,66,0,112,99,105,0,67,
+    76,45,71,68,55,53,53,53,0,70,108,97,116,32,80,97,110,101,108,32,
+    71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,67,76,45,71,
+    68,55,53,53,54,0,54,52,45,98,105,116,32,65,99,99,101,108,101,114,
+    97,116,101,100,32,76,67,68,47,67,82,84,32,67,111,110,116,114,111,108,
+    108,101,114,0,67,76,45,71,68,53,52,52,48,0,67,76,45,71,68,53,
+    52,51,50,0,65,108,112,105,110,101,32,71,85,73,32,65,99,99,101,108,
+    101,114,97,116,111,114,0,67,76,45,71,68,53,52,51,52,0,67,76,45,
+    71,68,53,52,50,54,0,86,105,100,101,111,32,99,97,114,100,32,40,105,
+    32,103,117,101,115,115,63,41,0,67,76,45,71,68,53,52,52,54,0,54,
+    52,45,98,105,116,32,86,105,115,117,97,108,77,101,100,105,97,32,65,99,
+    99,101,108,101,114,97,116,111,114,0,67,76,45,71,68,53,52,56,48,0,
+    54,52,45,98,105,116,32,83,71,82,65,77,32,71,85,73,32,97,99,99,
+    101,108,101,114,97,116,111,114,0,67,76,45,71,68,53,52,54,50,0,76,
+    97,103,117,110,97,32,86,105,115,117,97,108,77,101,100,105,97,32,103,114,
+    97,112,104,105,99,115,32,97,99,99,101,108,101,114,97,116,111,114,0,67,
+    76,45,71,68,53,52,53,53,0,76,97,103,117,110,97,32,51,68,32,86,
+    105,115,117,97,108,77,101,100,105,97,32,71,114,97,112,104,105,99,115,32,
+    65,99,99,101,108,0,67,76,45,71,68,53,52,54,52,0,76,97,103,117,
+    110,97,32,66,68,0,67,76,45,71,68,53,52,54,53,0,67,76,45,71,
+    68,53,52,51,54,85,0,99,115,52,54,51,48,99,109,0,97,99,99,101,
+    108,101,114,97,116,111,114,32,100,111,32,97,117,100,105,111,32,100,111,32,
+    112,99,105,32,100,101,32,115,111,117,110,100,32,102,117,115,105,111,110,0,
+    67,76,45,80,68,54,55,50,57,0,80,67,73,45,116,111,45,80,67,32,
+    67,97,114,100,32,104,111,115,116,32,97,100,97,112,116,101,114,0,67,76,
+    45,80,68,54,56,51,50,0,80,67,77,67,73,65,47,67,97,114,100,66,
+    117,115,32,67,111,110,116,114,111,108,108,101,114,0,67,76,45,80,68,54,
+    56,51,52,0,67,76,45,80,68,54,56,51,51,0,80,67,73,45,116,111,
+    45,67,97,114,100,66,117,115,32,72,111,115,116,32,65,100,97,112,116,101,
+    114,0,67,76,45,71,68,55,53,52,50,0,78,111,114,100,105,99,32,71,
+    85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,67,76,45,71,68,
+    55,53,52,51,0,86,105,107,105,110,103,32,71,85,73,32,65,99,99,101,
+    108,101,114,97,116,111,114,0,67,76,45,71,68,55,53,52,49,0,78,111,
+    114,100,105,99,45,108,105,116,101,32,86,71,65,32,67,110,116,114,108,114,
+    0,49,48,56,53,0,65,109,98,105,101,110,116,32,67,76,77,32,68,97,
+    116,97,32,70,97,120,32,86,111,105,99,101,0,67,76,45,67,68,52,52,
+    48,48,0,67,111,109,109,117,110,105,99,97,116,105,111,110,115,32,67,111,
+    110,116,114,111,108,108,101,114,0,67,83,52,54,49,48,0,67,114,121,115,
+    116,97,108,67,108,101,97,114,32,83,111,117,110,100,70,117,115,105,111,110,
+    32,80,67,73,32,65,117,100,105,111,32,65,99,99,101,108,101,114,97,116,
+    111,114,0,67,83,52,54,49,52,47,50,50,47,50,52,47,0,86,111,121,
+    101,116,114,97,32,84,117,114,116,108,101,32,66,101,97,99,104,32,83,97,
+    110,116,97,32,67,114,117,122,0,67,83,52,54,52,0,67,114,121,115,116,
+    97,108,67,108,101,97,114,32,83,111,117,110,100,70,117,115,105,111,110,32,
+    80,67,73,32,65,117,100,105,111,32,65,99,99,101,108,0,67,83,52,50,
+    56,48,47,52,50,57,55,120,0,67,114,121,115,116,97,108,32,65,67,39,
+    57,55,32,80,67,73,32,65,117,100,105,111,32,73,110,116,101,114,102,97,
+    99,101,0,99,105,114,114,117,115,32,108,111,103,105,99,32,99,114,121,115,
+    116,97,108,32,67,83,32,52,54,49,52,0,83,111,117,110,100,70,117,115,
+    105,111,110,32,80,67,73,32,65,117,100,105,111,32,65,99,99,101,108,101,
+    114,97,116,111,114,0,77,67,65,32,66,114,105,100,103,101,0,65,108,116,
+    97,32,76,105,116,101,0,65,108,116,97,32,77,80,0,70,105,114,101,32,
+    67,111,114,97,108,0,73,83,65,32,66,114,105,100,103,101,32,119,47,80,
+    110,80,0,65,117,116,111,32,76,65,78,83,116,114,101,97,109,101,114,0,
+    84,82,32,65,117,116,111,32,76,65,78,83,116,114,101,97,109,101,114,0,
+    71,88,84,45,49,53,48,80,0,71,114,97,112,104,105,99,115,32,65,100,
+    97,112,116,101,114,0,56,50,71,50,54,55,53,0,115,99,115,105,45,50,
+    32,102,97,115,116,32,112,99,105,32,97,100,97,112,116,101,114,0,56,50,
+    51,53,49,47,50,0,80,121,116,104,111,110,0,83,101,114,118,101,82,65,
+    73,68,32,73,47,73,73,47,51,120,47,52,72,0,67,111,112,112,101,114,
+    116,105,109,101,32,82,65,73,68,32,83,67,83,73,32,65,100,97,112,116,
+    101,114,0,77,105,97,109,105,47,80,67,73,0,51,50,45,98,105,116,32,
+    76,111,99,97,108,66,117,115,32,66,114,105,100,103,101,0,73,66,77,50,
+    55,45,56,50,54,54,48,0,80,111,119,101,114,80,67,32,116,111,32,80,
+    67,73,32,66,114,105,100,103,101,32,97,110,100,32,77,101,109,111,114,121,
+    32,67,116,114,108,114,0,56,53,72,57,53,51,51,0,73,66,77,32,84,
+    111,107,101,110,32,82,105,110,103,32,80,67,73,0,83,83,65,32,65,100,
+    97,112,116,101,114,0,77,80,73,67,0,73,110,116,101,114,114,117,112,116,
+    32,67,111,110,116,114,111,108,108,101,114,0,87,97,114,104,101,97,100,32,
+    83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,73,66,77,32,
+    51,55,56,48,73,68,83,80,0,77,80,69,71,45,50,32,68,101,99,111,
+    100,101,114,0,65,84,77,32,67,111,110,116,114,111,108,108,101,114,0,56,
+    53,104,57,53,51,51,0,50,53,32,77,66,105,116,32,65,84,77,32,99,
+    111,110,116,114,111,108,108,101,114,0,56,53,103,49,56,57,55,0,77,80,
+    69,71,32,80,67,73,32,66,114,105,100,103,101,0,105,56,50,53,53,55,
+    66,0,49,48,47,49,48,48,32,80,67,73,32,69,116,104,101,114,110,101,
+    116,32,65,100,97,112,116,101,114,0,48,53,74,51,53,48,54,0,84,67,
+    80,47,73,80,32,110,101,116,119,111,114,107,105,110,103,32,100,101,118,105,
+    99,101,0,51,55,56,48,73,68,83,80,0,71,88,84,45,51,48,48,48,
+    80,0,50,48,72,50,57,57,57,0,80,67,73,32,68,111,99,107,105,110,
+    103,32,66,114,105,100,103,101,0,67,104,117,107,97,114,32,99,104,105,112,
+    115,101,116,32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,
+    80,111,119,101,114,78,80,32,78,80,114,50,46,55,0,65,84,77,32,115,
+    117,112,112,111,114,116,32,100,101,118,105,99,101,0,65,84,77,32,49,53,
+    53,77,98,112,115,32,77,77,32,67,111,110,116,114,111,108,108,101,114,0,
+    71,88,84,50,48,48,48,0,50,53,54,45,98,105,116,32,71,114,97,112,
+    104,105,99,115,32,82,97,115,116,101,114,105,122,101,114,0,65,84,77,32,
+    54,50,50,77,98,112,115,32,67,111,110,116,114,111,108,108,101,114,0,48,
+    50,108,105,53,51,55,0,65,100,97,112,116,101,114,32,50,32,84,111,107,
+    101,110,32,82,105,110,103,32,67,97,114,100,0,67,80,67,55,48,48,0,
+    77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,97,110,
+    100,32,80,67,73,32,66,114,105,100,103,101,0,67,80,67,55,49,48,0,
+    80,67,73,45,54,52,32,66,114,105,100,103,101,0,80,67,73,45,51,50,
+    32,66,114,105,100,103,101,0,82,101,109,111,116,101,32,83,117,112,101,114,
+    118,105,115,111,114,43,83,101,114,105,97,108,32,80,111,114,116,43,77,111,
+    117,115,101,47,75,101,121,98,0,82,97,105,100,32,99,111,110,116,114,111,
+    108,108,101,114,0,89,111,116,116,97,0,86,105,100,101,111,32,67,111,109,
+    112,111,115,105,116,111,114,32,73,110,112,117,116,0,86,105,100,101,111,32,
+    67,111,109,112,111,115,105,116,111,114,32,79,117,116,112,117,116,0,52,48,
+    53,71,80,0,80,76,66,32,116,111,32,80,67,73,32,66,114,105,100,103,
+    101,0,82,67,49,48,48,48,0,82,97,115,116,101,114,105,122,101,114,47,
+    73,66,77,32,71,84,49,48,48,48,32,71,101,111,109,101,116,114,0,120,
+    0,56,50,56,48,49,0,77,111,100,101,109,58,32,73,110,116,101,108,32,
+    67,111,114,112,111,114,97,116,105,111,110,32,56,50,52,52,48,77,88,32,
+    65,67,39,57,55,32,77,111,100,101,109,32,67,111,110,116,114,111,108,108,
+    101,114,32,40,112,114,111,103,45,105,102,32,48,48,32,91,71,101,110,101,
+    114,105,99,93,41,0,73,66,77,32,49,51,51,0,80,67,73,45,88,32,
+    66,114,105,100,103,101,32,82,49,46,49,0,83,101,114,118,101,82,65,73,
+    68,32,52,47,53,0,77,111,114,112,104,101,117,115,32,83,67,83,73,32,
+    82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,0,52,52,48,71,
+    80,0,80,76,66,32,116,111,32,80,67,73,45,88,32,66,114,105,100,103,
+    101,0,52,52,48,71,88,0,69,109,98,101,100,100,101,100,32,80,111,119,
+    101,114,80,67,32,67,80,85,0,49,49,50,0,83,67,83,73,32,83,116,
+    111,114,97,103,101,32,67,111,110,116,114,111,108,108,101,114,0,78,69,67,
+    83,67,69,32,49,49,53,48,56,48,56,50,0,73,66,77,32,83,117,114,
+    101,80,79,83,32,82,105,115,101,114,32,67,97,114,100,32,70,117,110,99,
+    116,105,111,110,32,48,0,73,66,77,32,83,117,114,101,80,79,83,32,82,
+    105,115,101,114,32,67,97,114,100,32,70,117,110,99,116,105,111,110,32,49,
+    32,40,85,65,82,84,115,41,0,80,67,73,45,88,32,72,111,115,116,32,
+    66,114,105,100,103,101,0,77,80,73,67,32,50,0,118,55,45,109,112,101,
+    103,32,109,111,100,117,108,0,83,80,69,65,32,51,68,32,65,99,99,101,
+    108,101,114,97,116,111,114,0,115,105,115,45,54,52,56,68,0,86,73,65,
+    32,99,104,105,112,115,101,116,0,56,49,53,54,0,49,48,48,86,71,47,
+    65,110,121,76,65,78,32,65,100,97,112,116,101,114,0,65,108,116,101,114,
+    97,32,70,76,69,88,0,63,63,63,32,82,97,105,100,32,67,111,110,116,
+    114,111,108,108,101,114,32,63,63,63,0,77,101,103,97,82,65,73,68,32,
+    52,50,56,0,85,108,116,114,97,32,87,105,100,101,32,83,67,83,73,32,
+    82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,50,0,69,73,68,
+    69,32,67,111,110,116,114,111,108,108,101,114,0,73,68,69,32,97,110,100,
+    32,83,67,83,73,32,67,110,116,114,108,114,0,73,57,54,48,0,83,67,
+    83,73,32,67,111,110,116,114,111,108,108,101,114,0,77,117,108,116,105,109,
+    101,100,105,97,32,99,97,114,100,0,77,101,103,97,82,65,73,68,32,52,
+    51,52,0,85,108,116,114,97,32,71,84,32,82,65,73,68,32,67,111,110,
+    116,114,111,108,108,101,114,0,77,101,103,97,82,65,67,0,52,117,0,85,
+    115,101,100,32,116,111,32,98,108,111,119,32,117,112,32,116,104,101,32,109,
+    111,116,104,101,114,98,111,97,114,100,46,32,32,72,105,103,104,108,121,32,
+    101,120,112,108,111,115,105,118,101,46,32,32,85,115,101,32,97,116,32,117,
+    114,32,111,119,110,32,114,105,115,107,0,65,116,104,108,111,110,32,54,52,
+    32,47,32,79,112,116,101,114,111,110,0,72,121,112,101,114,84,114,97,110,
+    115,112,111,114,116,32,84,101,99,104,110,111,108,111,103,121,32,67,111,110,
+    102,105,103,117,114,97,116,105,111,110,0,65,100,100,114,101,115,115,32,77,
+    97,112,0,68,82,65,77,32,67,111,110,116,114,111,108,108,101,114,0,77,
+    105,115,99,101,108,108,97,110,101,111,117,115,32,67,111,110,116,114,111,108,
+    0,65,109,55,57,67,57,55,48,47,49,47,50,47,51,47,53,47,54,0,
+    80,67,110,101,116,32,76,65,78,67,69,32,80,67,73,32,69,116,104,101,
+    114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,0,65,109,55,57,
+    67,57,55,56,0,80,67,110,101,116,45,72,111,109,101,32,78,101,116,119,
+    111,114,107,105,110,103,32,67,116,114,108,114,32,40,49,47,49,48,32,77,
+    98,112,115,41,0,65,109,49,55,55,50,0,87,105,114,101,108,101,115,115,
+    32,76,65,78,32,99,104,105,112,115,101,116,0,65,109,53,51,67,57,55,
+    52,0,65,109,55,57,67,57,55,52,0,69,116,104,101,114,110,101,116,32,
+    67,111,110,116,114,111,108,108,101,114,0,85,110,107,110,111,119,110,0,71,
+    101,111,100,101,76,88,32,103,114,97,112,104,105,99,115,32,97,100,97,112,
+    116,101,114,0,71,88,51,0,71,101,111,100,101,32,71,88,51,32,65,69,
+    83,32,67,114,121,112,116,111,32,68,114,105,118,101,114,0,67,83,53,53,
+    51,54,0,67,83,53,53,51,54,32,65,117,100,105,111,32,67,111,110,116,
+    114,111,108,108,101,114,0,67,83,53,53,51,54,32,79,72,67,73,32,85,
+    83,66,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,67,
+    83,53,53,51,54,32,69,72,67,73,32,85,83,66,32,72,111,115,116,32,
+    67,111,110,116,114,111,108,108,101,114,0,78,117,109,98,101,114,58,32,67,
+    83,53,53,51,54,0,67,83,53,53,51,54,32,85,83,66,32,68,101,118,
+    105,99,101,32,67,111,110,116,114,111,108,108,101,114,0,67,83,53,53,51,
+    54,32,85,83,66,32,79,84,71,32,67,111,110,116,114,111,108,108,101,114,
+    0,67,83,53,53,51,54,32,73,68,69,32,67,111,110,116,114,111,108,108,
+    101,114,0,83,67,53,50,48,0,69,76,65,78,32,77,105,99,114,111,99,
+    111,110,116,114,111,108,108,101,114,32,80,67,73,32,72,111,115,116,32,66,
+    114,105,100,103,101,0,82,86,52,49,48,0,82,97,100,101,111,110,32,88,
+    55,48,48,32,80,114,111,0,65,77,68,45,55,53,49,0,80,114,111,99,
+    101,115,115,111,114,45,116,111,45,80,67,73,32,66,114,105,100,103,101,32,
+    47,32,77,101,109,111,114,121,32,67,116,114,108,114,0,65,71,80,32,97,
+    110,100,32,80,67,73,45,116,111,45,80,67,73,32,66,114,105,100,103,101,
+    32,40,49,120,47,50,120,32,65,71,80,41,0,65,77,68,45,73,71,82,
+    52,0,65,71,80,32,72,111,115,116,32,116,111,32,80,67,73,32,66,114,
+    105,100,103,101,0,65,71,80,32,80,67,73,32,116,111,32,80,67,73,32,
+    66,114,105,100,103,101,0,65,77,68,45,55,54,50,0,67,80,85,32,116,
+    111,32,80,67,73,32,66,114,105,100,103,101,32,40,83,77,80,32,99,104,
+    105,112,115,101,116,41,0,67,80,85,32,116,111,32,80,67,73,32,66,114,
+    105,100,103,101,32,40,65,71,80,32,52,120,41,0,65,77,68,45,55,54,
+    49,0,78,111,114,116,104,32,66,114,105,100,103,101,0,67,80,85,32,116,
+    111,32,65,71,80,32,66,114,105,100,103,101,32,32,40,65,71,80,32,52,
+    120,41,0,65,77,68,45,55,53,53,0,66,117,115,32,77,97,115,116,101,
+    114,32,73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,80,111,119,
+    101,114,32,77,97,110,97,103,101,109,101,110,116,32,67,111,110,116,114,111,
+    108,108,101,114,0,80,67,73,32,116,111,32,85,83,66,32,79,112,101,110,
+    32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,65,77,68,
+    45,55,53,54,0,80,67,73,45,73,83,65,32,66,114,105,100,103,101,0,
+    80,111,119,101,114,32,77,97,110,97,103,101,109,101,110,116,0,65,77,68,
+    45,55,54,54,0,80,67,73,32,116,111,32,73,83,65,47,76,80,67,32,
+    66,114,105,100,103,101,0,69,110,104,97,110,99,101,100,32,73,68,69,32,
+    67,111,110,116,114,111,108,108,101,114,0,85,83,66,32,79,112,101,110,72,
+    67,73,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,65,
+    77,68,45,55,54,56,0,76,80,67,32,66,114,105,100,103,101,0,83,121,
+    115,116,101,109,32,77,97,110,97,103,101,109,101,110,116,0,65,67,57,55,
+    32,65,117,100,105,111,0,65,77,68,45,56,49,51,49,0,80,67,73,45,
+    88,32,66,114,105,100,103,101,0,80,67,73,45,88,32,73,79,65,80,73,
+    67,0,65,77,68,45,56,49,53,49,0,83,121,115,116,101,109,32,67,111,
+    110,116,114,111,108,108,101,114,0,65,77,68,45,56,49,51,50,0,65,77,
+    68,45,56,49,49,49,0,85,83,66,32,50,46,48,32,67,111,110,116,114,
+    111,108,108,101,114,0,85,83,66,32,69,110,104,97,110,99,101,100,32,72,
+    111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,85,108,116,114,97,
+    65,84,65,47,49,51,51,32,67,111,110,116,114,111,108,108,101,114,0,83,
+    77,66,117,115,32,50,46,48,32,67,111,110,116,114,111,108,108,101,114,0,
+    99,45,109,101,100,105,97,32,99,109,105,56,55,51,56,0,32,65,117,100,
+    105,111,32,67,111,110,116,114,111,108,108,101,114,0,65,67,39,57,55,32,
+    77,111,100,101,109,0,65,67,80,73,32,67,111,110,116,114,111,108,108,101,
+    114,0,56,50,67,49,57,52,0,67,97,114,100,66,117,115,32,67,111,110,
+    116,114,111,108,108,101,114,0,52,68,87,65,86,69,45,68,88,0,97,100,
+    118,97,110,99,101,100,32,80,67,73,32,68,105,114,101,99,116,83,111,117,
+    110,100,32,97,99,99,101,108,101,114,97,116,111,114,0,52,68,32,87,65,
+    86,69,32,68,88,32,83,79,85,78,68,32,65,67,67,69,76,69,82,65,
+    84,79,82,0,80,67,73,32,65,117,100,105,111,0,67,121,98,101,114,45,
+    88,80,52,0,86,105,100,101,111,32,65,99,99,101,108,101,114,97,116,111,
+    114,0,86,111,108,97,114,105,32,86,51,0,86,105,100,101,111,32,97,100,
+    97,112,116,101,114,0,67,121,98,101,114,66,108,97,100,101,32,105,55,0,
+    115,97,117,115,103,97,117,111,115,0,53,49,51,51,49,48,55,49,0,99,
+    111,109,112,97,113,32,49,48,48,0,67,121,98,101,114,0,67,121,98,101,
+    114,66,108,97,100,101,32,105,49,32,65,71,80,32,40,53,49,41,0,84,
+    114,105,100,101,110,116,32,86,105,100,101,111,32,65,99,99,101,108,101,114,
+    97,116,111,114,32,67,121,98,101,114,66,108,97,100,101,32,105,49,0,119,
+    105,110,100,111,119,115,32,57,56,0,67,121,98,101,114,66,108,97,100,101,
+    45,105,49,0,116,114,105,100,101,110,116,0,67,121,98,101,114,66,108,97,
+    100,101,32,88,80,0,122,99,122,120,122,99,122,120,0,84,71,85,73,57,
+    51,50,48,0,51,50,45,98,105,116,32,71,85,73,32,65,99,99,101,108,
+    101,114,97,116,111,114,0,84,71,85,73,57,51,53,48,0,70,108,97,116,
+    32,112,97,110,101,108,32,67,110,116,114,108,114,0,67,121,98,101,114,57,
+    51,56,50,0,67,121,98,101,114,57,51,56,51,0,67,121,98,101,114,57,
+    51,56,53,0,67,121,98,101,114,57,51,56,54,0,67,121,98,101,114,57,
+    51,56,56,0,67,121,98,101,114,57,51,57,55,0,86,105,100,101,111,32,
+    65,99,99,101,108,101,114,97,116,111,114,32,51,68,0,67,121,98,101,114,
+    57,51,57,55,68,86,68,0,84,71,85,73,57,52,50,48,0,68,71,105,
+    32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,84,71,85,
+    73,57,52,51,48,0,84,71,85,73,57,54,56,50,0,68,71,105,32,71,
+    85,73,32,65,99,99,108,101,114,97,116,111,114,0,84,71,85,73,57,52,
+    54,48,0,84,71,85,73,57,52,55,48,0,67,121,98,101,114,57,53,50,
+    48,0,67,121,98,101,114,57,53,50,53,0,67,121,98,101,114,57,53,52,
+    48,0,86,105,100,101,111,32,65,99,99,108,101,114,97,116,111,114,0,84,
+    71,85,73,57,54,54,48,88,71,105,0,84,71,85,73,57,54,56,48,0,
+    84,114,105,100,101,110,116,32,65,32,67,65,66,48,49,0,84,71,85,73,
+    57,54,56,51,0,80,114,111,86,73,68,73,65,32,57,54,56,53,0,50,
+    77,66,32,86,71,65,0,51,68,73,109,97,103,101,32,57,55,53,48,32,
+    80,67,73,47,65,71,80,0,116,114,105,100,101,110,116,32,100,103,105,0,
+    84,71,85,73,57,55,53,51,0,87,97,118,101,32,86,105,100,101,111,32,
+    65,99,99,101,108,101,114,97,116,111,114,0,84,71,85,73,57,55,53,63,
+    0,73,109,97,103,101,32,71,85,73,32,65,99,99,101,108,101,114,97,116,
+    111,114,0,84,71,85,73,57,55,56,51,0,84,71,85,73,57,55,56,53,
+    0,51,68,32,73,109,97,103,101,32,57,56,53,48,32,65,71,80,0,52,
+    109,98,0,66,108,97,100,101,32,51,68,32,57,56,56,48,0,103,103,103,
+    103,103,103,0,48,48,48,49,49,49,55,56,0,67,121,98,101,114,66,108,
+    97,100,101,32,88,80,109,0,65,67,57,55,32,73,68,58,83,73,76,32,
+    82,69,86,58,48,120,50,55,44,32,48,56,0,65,103,101,114,101,32,83,
+    121,115,116,101,109,115,32,115,111,102,116,32,109,111,100,101,109,32,99,104,
+    105,112,0,77,49,52,51,53,0,67,80,85,32,116,111,32,80,67,73,32,
+    38,97,109,112,59,32,80,67,73,32,116,111,32,73,83,65,32,66,114,105,
+    100,103,101,0,77,49,52,52,53,0,86,76,32,66,114,105,100,103,101,32,
+    38,97,109,112,59,32,69,73,68,69,0,77,49,52,52,57,0,77,49,52,
+    53,49,0,80,101,110,116,105,117,109,32,67,104,105,112,115,101,116,0,77,
+    49,52,54,49,0,80,53,52,67,32,67,104,105,112,115,101,116,0,77,49,
+    52,56,57,0,77,49,53,49,49,0,77,49,53,49,50,0,77,49,53,49,
+    51,0,77,49,53,50,49,0,77,49,53,50,51,0,77,49,53,51,49,0,
+    77,49,53,51,51,0,73,83,65,32,83,111,117,116,104,32,66,114,105,100,
+    103,101,0,77,49,53,51,53,0,80,67,73,32,83,111,117,116,104,32,66,
+    114,105,100,103,101,0,77,49,53,52,49,0,65,71,80,32,80,67,73,32,
+    78,111,114,116,104,32,66,114,105,100,103,101,32,65,108,97,100,100,105,110,
+    32,86,47,86,43,0,77,49,53,52,50,0,65,71,80,43,80,67,73,32,
+    78,111,114,116,104,32,66,114,105,100,103,101,0,77,49,53,52,51,67,0,
+    80,67,105,32,83,111,117,116,104,32,66,114,105,100,103,101,32,65,108,97,
+    100,100,105,110,32,73,86,43,47,86,0,77,49,53,54,49,0,78,111,114,
+    116,104,98,114,105,100,103,101,0,77,49,54,50,49,0,80,67,73,32,78,
+    111,114,116,104,32,66,114,105,100,103,101,32,65,108,97,100,100,105,110,32,
+    80,114,111,32,73,73,0,77,49,54,51,49,0,80,67,73,32,78,111,114,
+    116,104,32,66,114,105,100,103,101,32,65,108,97,100,100,105,110,32,80,114,
+    111,32,73,73,73,0,77,49,54,52,49,0,80,67,73,32,78,111,114,116,
+    104,32,66,114,105,100,103,101,32,65,108,97,100,100,105,110,32,80,114,111,
+    32,73,86,0,77,51,49,52,49,0,77,51,49,52,51,0,77,51,49,52,
+    53,0,77,51,49,52,55,0,77,51,49,52,57,0,77,51,49,53,49,0,
+    77,51,51,48,55,0,77,80,69,71,45,49,32,68,101,99,111,100,101,114,
+    0,77,51,51,48,57,0,77,80,69,71,32,68,101,99,111,100,101,114,0,
+    77,52,56,48,51,0,77,53,50,49,55,0,73,47,79,32,67,111,110,116,
+    114,111,108,108,101,114,0,77,53,50,49,57,0,77,53,50,50,53,0,77,
+    53,50,50,57,0,49,48,50,53,0,77,53,50,51,55,0,80,67,73,32,
+    85,83,66,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,
+    80,67,77,67,73,65,32,66,114,105,100,103,101,0,71,101,110,101,114,97,
+    108,32,80,117,114,112,111,115,101,32,67,111,110,116,114,111,108,108,101,114,
+    0,70,108,111,112,112,121,32,68,105,115,107,32,67,111,110,116,114,111,108,
+    108,101,114,0,77,53,52,53,49,0,80,67,73,32,65,67,45,76,105,110,
+    107,32,67,111,110,116,114,111,108,108,101,114,32,65,117,100,105,111,32,68,
+    101,118,105,99,101,0,77,53,52,53,51,0,77,53,52,53,51,32,65,67,
+    45,76,105,110,107,32,67,111,110,116,114,111,108,108,101,114,32,77,111,100,
+    101,109,32,68,101,118,105,99,101,0,77,55,49,48,49,0,80,67,73,32,
+    80,77,85,32,80,111,119,101,114,32,77,97,110,97,103,101,109,101,110,116,
+    32,67,111,110,116,114,111,108,108,101,114,0,80,111,119,101,114,69,100,103,
+    101,32,50,32,47,83,105,0,69,120,112,97,110,100,97,98,108,101,32,82,
+    65,73,68,32,67,111,110,116,114,111,108,108,101,114,32,40,80,69,82,67,
+    41,32,40,83,67,83,73,41,0,80,111,119,101,114,69,100,103,101,32,51,
+    47,68,105,0,69,120,112,97,110,100,97,98,108,101,32,82,65,73,68,32,
+    67,111,110,116,114,111,108,108,101,114,0,80,111,119,101,114,69,100,103,101,
+    32,51,47,83,105,0,82,101,109,111,116,101,32,65,115,115,105,115,116,97,
+    110,116,32,67,97,114,100,0,82,65,67,32,86,105,114,116,117,97,108,32,
+    85,65,82,84,32,80,111,114,116,0,69,109,98,101,100,100,101,100,32,83,
+    121,115,116,101,109,115,32,77,97,110,97,103,101,109,101,110,116,32,68,101,
+    118,105,99,101,32,52,0,48,48,48,69,0,80,69,82,67,32,52,47,68,
+    73,32,82,97,105,100,32,67,111,110,116,114,111,108,108,101,114,0,80,69,
+    82,67,32,52,101,47,83,105,32,97,110,100,32,80,69,82,67,32,52,101,
+    47,68,105,0,80,69,82,67,32,53,47,105,32,82,65,73,68,32,67,111,
+    110,116,114,111,108,108,101,114,0,73,110,116,101,103,114,97,116,101,100,32,
+    82,65,73,68,32,99,111,110,116,114,111,108,108,101,114,0,68,69,76,76,
+    32,80,69,82,67,32,51,50,48,47,68,67,0,65,100,97,112,116,101,99,
+    32,50,50,48,48,83,32,83,67,83,73,32,82,65,73,68,32,99,111,110,
+    116,114,111,108,108,101,114,0,70,65,56,50,53,51,55,69,80,0,65,32,
+    73,110,116,101,108,32,53,51,55,32,101,112,103,32,118,46,57,50,32,109,
+    111,100,101,109,32,114,101,112,97,99,107,97,103,101,100,32,98,121,32,100,
+    101,108,108,0,72,89,68,82,65,0,80,53,32,67,104,105,112,115,101,116,
+    0,65,83,80,69,78,0,105,52,56,54,32,67,104,105,112,115,101,116,0,
+    77,71,65,45,73,0,73,109,112,114,101,115,115,105,111,110,63,0,77,71,
+    65,45,50,49,54,52,87,0,109,97,116,114,111,120,0,77,71,65,45,80,
+    88,50,48,56,53,0,65,116,108,97,115,32,71,85,73,32,65,99,99,101,
+    108,101,114,97,116,111,114,0,77,71,65,45,50,48,54,52,87,0,83,116,
+    114,111,114,109,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,
+    0,109,103,97,45,49,49,54,52,115,103,45,97,0,72,117,114,114,105,99,
+    97,110,101,47,67,121,99,108,111,110,101,32,54,52,45,98,105,116,32,103,
+    114,97,112,104,105,99,115,32,99,104,105,112,0,77,71,65,45,49,49,54,
+    52,83,71,0,67,104,105,110,111,111,107,0,77,71,65,45,50,48,48,66,
+    0,77,105,115,116,114,97,108,0,77,97,116,114,111,120,32,108,110,99,32,
+    77,71,65,45,71,50,48,48,66,0,69,99,108,105,112,115,101,47,67,97,
+    108,97,111,0,77,71,65,45,71,50,48,48,69,0,77,97,116,114,111,120,
+    32,71,50,48,48,101,32,40,83,101,114,118,101,114,69,110,103,105,110,101,
+    115,41,0,77,71,65,32,71,52,53,48,32,68,117,97,108,32,72,101,97,
+    100,0,67,104,105,112,32,111,102,32,71,52,53,48,32,103,114,97,112,104,
+    105,99,115,32,99,97,114,100,0,80,97,114,104,101,108,105,97,32,65,71,
+    80,0,80,97,114,104,101,108,105,97,0,80,97,114,104,101,108,105,97,32,
+    49,50,56,77,66,47,50,53,54,77,66,47,80,67,73,47,72,82,50,53,
+    54,0,65,116,104,101,110,97,32,71,85,73,32,97,99,99,101,108,101,114,
+    97,116,111,114,0,77,71,65,45,71,49,48,48,0,84,119,105,115,116,101,
+    114,0,84,119,105,115,116,101,114,32,65,71,80,0,70,117,115,105,111,110,
+    32,71,52,53,48,32,65,71,80,0,70,117,115,105,111,110,32,80,108,117,
+    115,32,71,56,48,48,32,65,71,80,0,71,85,73,43,51,68,32,65,99,
+    99,101,108,101,114,97,116,111,114,0,77,71,65,45,71,53,53,48,0,65,
+    71,80,32,67,104,105,112,115,101,116,0,80,97,114,104,101,108,105,97,45,
+    76,88,0,80,97,114,104,101,108,105,97,32,67,104,105,112,115,101,116,32,
+    65,71,80,0,77,101,116,101,111,114,32,50,32,83,84,68,47,77,67,47,
+    68,105,103,0,86,105,100,101,111,32,67,97,112,116,117,114,101,32,67,97,
+    114,100,0,83,104,97,114,107,0,49,48,47,49,48,48,32,77,117,108,116,
+    105,112,111,114,116,32,83,119,105,116,99,104,32,78,73,67,0,82,84,46,
+    120,49,48,0,77,117,108,116,105,109,101,100,105,97,32,68,101,118,105,99,
+    101,0,82,84,32,50,48,48,48,0,77,117,108,116,105,109,101,100,105,97,
+    32,100,101,118,105,99,101,0,54,52,51,49,48,0,87,105,110,103,105,110,
+    101,32,68,71,88,32,45,32,68,82,65,77,32,71,114,97,112,104,105,99,
+    115,32,65,99,99,101,108,101,114,97,116,111,114,0,54,57,48,48,48,0,
+    65,71,80,47,80,67,73,32,70,108,97,116,32,80,97,110,101,108,47,67,
+    82,84,32,86,71,65,32,65,99,99,101,108,101,114,97,116,111,114,0,54,
+    53,53,52,53,0,70,108,97,116,32,112,97,110,101,108,47,99,114,116,32,
+    86,71,65,32,67,110,116,114,108,114,0,54,53,53,52,48,0,70,108,97,
+    116,32,80,97,110,101,108,47,67,82,84,32,86,71,65,32,67,111,110,116,
+    114,111,108,108,101,114,0,54,53,53,52,56,0,54,53,53,53,48,0,76,
+    67,68,47,67,82,84,32,99,111,110,116,114,111,108,108,101,114,0,54,53,
+    53,53,52,0,70,108,97,116,32,80,97,110,101,108,47,76,67,68,32,67,
+    82,84,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,54,
+    53,53,53,53,0,86,71,65,32,71,85,73,32,65,99,99,101,108,101,114,
+    97,116,111,114,0,54,56,53,53,52,0,71,85,73,32,67,111,110,116,114,
+    111,108,108,101,114,0,103,114,97,112,104,105,99,32,100,114,105,118,101,114,
+    0,54,56,53,53,53,0,54,53,53,54,48,0,80,67,73,32,70,108,97,
+    116,32,80,97,110,101,108,47,67,82,84,32,86,71,65,32,65,99,99,101,
+    108,101,114,97,116,111,114,0,54,57,48,51,48,0,51,51,50,56,0,65,
+    117,100,105,111,0,114,52,120,48,48,0,84,88,51,57,50,55,0,67,80,
+    85,32,66,114,105,100,103,101,63,0,77,101,116,101,111,114,32,49,53,53,
+    0,65,84,77,32,80,67,73,32,65,100,97,112,116,101,114,0,84,67,51,
+    53,56,49,53,67,70,0,80,67,73,32,49,48,47,49,48,48,32,77,98,
+    105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,
+    101,114,0,84,88,52,57,51,56,0,73,110,116,101,103,114,97,116,101,100,
+    32,49,48,47,49,48,48,32,77,98,105,116,32,69,116,104,101,114,110,101,
+    116,32,67,111,110,116,114,111,108,108,101,114,0,84,67,56,54,67,48,48,
+    49,70,71,0,71,79,75,85,45,83,32,66,117,115,32,77,97,115,116,101,
+    114,32,73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,71,79,75,
+    85,45,83,32,85,83,66,32,72,111,115,116,32,67,111,110,116,114,111,108,
+    108,101,114,0,71,79,75,85,45,83,32,85,83,66,32,68,101,118,105,99,
+    101,32,67,111,110,116,114,111,108,108,101,114,0,71,79,75,85,45,83,32,
+    73,50,67,32,66,117,115,47,83,73,79,47,71,80,73,79,32,67,111,110,
+    116,114,111,108,108,101,114,0,84,88,52,57,50,55,0,77,73,80,83,32,
+    80,114,111,99,101,115,115,111,114,0,84,88,52,57,50,53,0,77,73,80,
+    83,32,82,73,83,67,32,80,67,73,32,67,111,110,116,114,111,108,108,101,
+    114,32,40,80,67,73,67,41,0,84,88,52,57,51,55,0,77,105,114,111,
+    86,73,68,69,79,32,68,67,50,48,0,73,47,79,32,38,97,109,112,59,
+    32,74,80,69,71,0,50,73,86,68,67,45,80,67,88,49,32,49,50,53,
+    48,52,48,48,32,48,51,51,56,57,51,57,51,50,0,118,105,100,101,111,
+    32,105,110,32,97,110,100,32,111,117,116,32,119,105,116,104,32,109,111,116,
+    105,111,110,32,106,112,101,103,32,99,111,109,112,114,101,115,115,105,111,110,
+    32,97,110,100,32,100,101,99,111,0,77,101,100,105,97,32,51,68,0,77,
+    105,114,111,86,73,68,69,79,32,68,67,49,48,47,68,67,51,48,0,68,
+    67,51,48,68,45,54,48,49,54,48,49,45,52,46,48,0,117,112,68,57,
+    56,52,48,57,0,80,67,73,32,116,111,32,52,56,54,32,108,105,107,101,
+    32,98,117,115,32,66,114,105,100,103,101,0,80,67,73,32,116,111,32,86,
+    76,57,56,32,66,114,105,100,103,101,0,82,52,48,48,48,0,80,67,73,
+    32,98,117,115,32,66,114,105,100,103,101,0,80,67,73,32,116,111,32,52,
+    56,54,32,108,105,107,101,32,112,101,114,105,112,104,101,114,97,108,32,98,
+    117,115,32,66,114,105,100,103,101,0,80,67,73,32,116,111,32,117,120,45,
+    98,117,115,32,66,114,105,100,103,101,0,71,85,73,32,65,99,99,101,108,
+    101,114,97,116,111,114,32,40,118,103,97,32,101,113,117,105,118,97,108,101,
+    110,116,41,0,103,114,97,112,104,105,99,32,67,110,116,114,108,114,32,102,
+    111,114,32,57,56,0,78,105,108,101,32,73,73,0,117,80,68,57,56,52,
+    48,53,0,78,69,65,83,67,79,84,45,83,50,48,32,65,84,77,32,73,
+    110,116,101,103,114,97,116,101,100,32,83,65,82,32,67,116,114,108,114,0,
+    86,114,99,52,51,55,51,0,78,105,108,101,32,73,0,80,111,118,101,114,
+    86,82,32,80,67,88,49,0,51,68,32,65,99,99,101,108,101,114,97,116,
+    111,114,0,80,111,118,101,114,86,82,0,78,69,67,32,68,55,50,56,55,
+    52,71,67,0,49,51,57,52,32,72,111,115,116,32,67,111,110,116,114,111,
+    108,108,101,114,0,117,100,112,57,50,49,48,0,68,117,97,108,32,79,72,
+    67,73,32,99,111,110,116,114,111,108,108,101,114,115,32,112,108,117,115,32,
+    83,105,110,103,108,101,32,69,72,67,73,32,99,111,110,116,114,111,108,108,
+    101,114,0,117,80,68,57,56,52,48,57,0,78,69,65,83,67,79,84,45,
+    83,52,48,67,32,65,84,77,32,76,105,103,104,116,32,83,65,82,32,67,
+    111,110,116,114,111,108,108,101,114,0,117,80,68,54,54,51,54,57,0,78,
+    65,80,67,67,65,82,68,32,67,97,114,100,66,117,115,32,67,111,110,116,
+    114,111,108,108,101,114,0,80,111,118,101,114,86,82,32,80,67,88,50,0,
+    86,114,99,53,48,55,52,0,78,105,108,101,32,52,0,117,80,68,55,50,
+    56,54,50,0,70,105,114,101,119,97,114,100,101,110,32,73,69,69,69,49,
+    51,57,52,32,79,72,67,73,32,72,111,115,116,32,67,111,110,116,114,111,
+    108,108,101,114,0,80,111,119,101,114,86,82,32,78,101,111,110,32,50,53,
+    48,0,80,111,119,101,114,86,82,32,115,101,114,105,101,115,32,73,73,32,
+    103,114,97,112,104,105,99,115,32,112,114,111,99,101,115,115,111,114,0,53,
+    54,107,32,86,111,105,99,101,32,77,111,100,101,109,0,86,114,99,53,52,
+    55,54,0,86,82,52,49,50,50,0,54,52,45,98,105,116,32,67,80,85,
+    32,119,105,116,104,32,78,111,114,116,104,98,114,105,100,103,101,0,117,80,
+    68,55,50,56,55,48,0,73,69,69,69,49,51,57,52,32,49,45,67,104,
+    105,112,32,79,72,67,73,32,72,111,115,116,32,67,111,110,116,114,111,108,
+    108,101,114,0,117,80,68,55,50,56,55,49,47,50,0,117,80,68,55,50,
+    48,49,48,48,65,0,85,83,66,32,50,46,48,32,72,111,115,116,32,67,
+    111,110,116,114,111,108,108,101,114,0,117,80,68,55,50,56,55,52,0,73,
+    69,69,69,49,51,57,52,32,79,72,67,73,32,49,46,49,32,50,45,112,
+    111,114,116,32,80,72,89,45,76,105,110,107,32,67,116,114,108,114,0,68,
+    55,50,56,55,52,71,67,0,73,69,69,69,49,51,57,52,43,79,72,67,
+    73,43,49,46,49,43,51,45,112,111,114,116,43,80,72,89,45,76,105,110,
+    107,43,67,116,114,108,114,0,49,51,57,52,32,67,65,82,68,0,110,47,
+    97,0,84,77,67,45,49,56,67,51,48,0,83,105,83,55,51,48,0,86,
+    105,114,116,117,97,108,32,80,67,73,45,116,111,45,80,67,73,32,98,114,
+    105,100,103,101,32,40,65,71,80,41,0,54,50,48,50,0,86,105,114,116,
+    117,97,108,32,80,67,73,32,116,111,32,80,67,73,32,66,114,105,100,103,
+    101,32,40,65,71,80,41,0,83,105,83,55,54,48,0,80,101,110,116,105,
+    117,109,32,99,104,105,112,115,101,116,0,83,105,83,32,56,53,67,53,48,
+    49,0,80,67,73,47,73,83,65,32,67,97,99,104,101,32,77,101,109,111,
+    114,121,32,67,111,110,116,114,111,108,108,101,114,32,40,80,67,77,67,41,
+    0,83,105,83,32,56,53,67,53,48,51,0,80,67,73,32,83,121,115,116,
+    101,109,32,73,47,79,32,40,80,83,73,79,41,0,53,53,57,53,0,115,
+    105,115,0,83,105,83,57,54,49,47,57,54,50,0,83,105,83,57,53,48,
+    0,118,103,97,0,83,105,83,49,56,48,0,73,68,69,32,85,68,77,65,
+    32,67,111,110,116,114,111,108,108,101,114,0,83,73,83,49,57,49,0,83,
+    105,83,53,53,57,55,47,57,56,0,79,110,98,111,97,114,100,32,71,114,
+    97,112,104,105,99,115,32,67,111,110,116,114,111,108,108,101,114,0,83,105,
+    83,32,54,50,49,53,0,80,67,73,0,83,105,83,32,54,50,48,53,0,
+    80,67,73,32,71,114,97,112,104,105,99,115,32,38,97,109,112,59,32,86,
+    105,100,101,111,32,65,99,99,101,108,101,114,97,116,111,114,0,83,105,83,
+    51,49,53,0,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,43,
+    51,68,0,83,105,83,51,48,53,0,50,68,47,51,68,47,86,105,100,101,
+    111,47,68,86,68,32,65,99,99,101,108,101,114,97,116,111,114,0,83,105,
+    83,32,51,49,53,0,50,68,47,51,68,32,65,99,99,101,108,101,114,97,
+    116,111,114,0,83,105,83,51,51,48,0,88,97,98,114,101,32,50,68,47,
+    51,68,32,65,99,99,101,108,101,114,97,116,111,114,0,56,53,67,53,48,
+    49,0,56,53,67,52,57,54,0,83,105,83,53,51,48,0,72,111,115,116,
+    45,116,111,45,80,67,73,32,98,114,105,100,103,101,0,83,105,83,53,52,
+    48,0,72,111,115,116,45,116,111,45,80,67,73,32,66,114,105,100,103,101,
+    0,83,105,83,53,53,48,47,49,47,50,0,83,105,83,53,57,54,0,80,
+    101,110,116,105,117,109,32,80,67,73,32,99,104,105,112,115,101,116,32,119,
+    105,116,104,32,73,68,69,0,83,105,83,53,53,49,51,0,69,73,68,69,
+    32,67,111,110,116,114,111,108,108,101,114,32,40,115,116,101,112,32,67,41,
+    0,83,105,83,56,51,67,54,48,49,0,80,67,73,32,69,73,68,69,32,
+    67,111,110,116,114,111,108,108,101,114,0,83,105,83,54,50,48,0,83,105,
+    83,54,51,48,0,83,105,83,32,54,51,53,0,83,105,83,32,54,52,48,
+    0,83,105,83,32,54,52,53,0,83,105,83,54,52,53,68,88,0,83,105,
+    83,54,52,56,77,88,0,115,105,115,54,52,57,0,83,105,83,57,54,49,
+    0,83,105,83,54,53,49,0,83,105,83,54,53,53,0,83,105,83,32,82,
+    54,53,56,0,83,105,83,32,82,54,53,57,0,83,105,83,54,54,49,70,
+    88,0,83,105,83,32,55,51,48,0,83,105,83,32,55,51,53,0,83,105,
+    83,32,55,52,48,0,83,105,83,55,52,49,0,83,105,83,55,52,53,0,
+    83,105,83,55,52,54,0,83,105,83,55,52,56,0,83,105,83,77,54,53,
+    48,63,0,83,105,83,55,53,53,70,88,0,65,116,104,108,111,110,32,54,
+    52,32,67,80,85,32,116,111,32,80,67,73,32,66,114,105,100,103,101,0,
+    83,105,83,57,48,48,0,115,105,115,32,57,48,48,32,97,110,100,32,105,
+    110,116,101,103,114,97,116,101,100,32,108,97,110,0,68,101,118,105,99,101,
+    32,73,68,32,61,32,48,57,48,48,32,83,105,83,57,48,48,0,83,105,
+    83,57,48,48,32,49,48,47,49,48,48,32,69,116,104,101,114,110,101,116,
+    32,65,100,97,112,116,101,114,0,83,105,83,57,54,50,0,83,105,83,57,
+    54,51,0,83,105,83,57,54,52,0,115,105,115,57,53,48,0,112,99,105,
+    92,118,101,110,95,49,48,51,57,38,97,109,112,59,115,117,98,115,121,115,
+    95,50,48,48,98,49,54,51,38,97,109,112,59,114,101,118,95,97,48,92,
+    51,38,97,109,112,59,54,49,97,97,97,48,49,92,48,38,97,109,112,59,
+    49,55,0,83,105,83,53,53,57,55,0,83,105,83,53,53,57,55,32,83,
+    86,71,65,0,83,105,83,56,51,67,54,48,50,0,83,105,83,53,49,48,
+    55,0,72,111,116,32,68,111,99,107,105,110,103,32,67,111,110,116,114,111,
+    108,108,101,114,0,65,71,80,0,83,105,83,53,51,48,47,49,47,50,0,
+    83,105,83,53,52,48,49,0,52,56,54,32,80,67,73,32,67,104,105,112,
+    115,101,116,0,83,105,83,53,53,49,49,47,53,53,49,50,0,80,67,73,
+    47,73,83,65,32,83,121,115,116,101,109,32,77,101,109,111,114,121,32,67,
+    111,110,116,114,111,108,108,101,114,0,80,67,73,32,73,68,69,32,67,111,
+    110,116,114,111,108,108,101,114,0,83,105,83,53,53,49,55,0,83,105,83,
+    53,53,49,56,0,85,68,77,65,32,73,68,69,32,67,111,110,116,114,111,
+    108,108,101,114,0,83,105,83,53,53,55,49,0,77,101,109,111,114,121,47,
+    80,67,73,32,98,114,105,100,103,101,0,83,105,83,32,53,53,56,49,0,
+    112,53,32,99,104,105,112,115,101,116,0,83,105,83,53,53,56,50,0,54,
+    51,50,54,0,80,67,73,32,65,71,80,0,83,105,83,53,53,57,54,0,
+    80,67,73,44,32,77,101,109,111,114,121,32,38,97,109,112,59,32,86,71,
+    65,32,67,111,110,116,114,111,108,108,101,114,0,72,111,115,116,32,116,111,
+    32,80,67,73,32,98,114,105,100,103,101,0,83,105,83,54,48,48,0,83,
+    105,83,54,50,48,52,0,118,105,100,101,111,32,100,101,99,111,100,101,114,
+    47,109,112,101,103,32,105,110,116,101,114,102,97,99,101,0,83,105,83,54,
+    50,48,54,0,80,67,73,32,86,71,65,32,67,111,110,116,114,111,108,108,
+    101,114,0,83,105,83,32,57,53,48,32,109,50,50,56,52,100,120,115,0,
+    83,105,83,54,50,51,54,0,71,114,97,112,104,105,99,115,0,83,105,83,
+    54,51,48,47,55,51,48,0,83,105,83,53,51,48,47,54,50,48,0,73,
+    110,116,101,103,114,97,116,101,100,32,51,68,32,32,83,86,71,65,32,67,
+    111,110,116,114,111,108,108,101,114,0,83,105,83,54,53,48,0,71,85,73,
+    32,50,68,47,51,68,32,65,99,99,101,108,101,114,97,116,111,114,0,49,
+    48,51,57,0,65,71,80,47,80,67,73,32,71,114,97,112,104,105,99,115,
+    32,38,97,109,112,59,32,86,105,100,101,111,32,65,99,99,101,108,101,114,
+    97,116,111,114,0,83,105,83,54,54,49,70,88,47,77,54,54,49,70,88,
+    47,55,54,48,47,55,52,49,47,77,55,54,48,47,77,55,52,49,0,83,
+    105,83,55,48,48,49,0,85,83,66,32,72,111,115,116,32,67,111,110,116,
+    114,111,108,108,101,114,0,83,105,83,55,48,48,50,0,85,83,66,32,50,
+    46,48,32,69,110,104,97,110,99,101,100,32,72,111,115,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,83,105,83,53,53,49,47,50,0,77,101,109,
+    111,114,121,32,83,116,105,99,107,32,67,111,110,116,114,111,108,108,101,114,
+    0,79,72,67,73,32,67,111,109,112,108,105,97,110,116,32,70,105,114,101,
+    87,105,114,101,32,67,111,110,116,114,111,108,108,101,114,0,102,105,83,55,
+    48,49,50,0,80,67,73,32,65,117,100,105,111,32,65,99,99,101,108,101,
+    114,97,116,111,114,0,83,105,83,55,48,49,51,0,83,109,97,114,116,32,
+    76,105,110,107,32,53,54,75,32,86,111,105,99,101,32,77,111,100,101,109,
+    0,83,105,83,53,53,48,0,83,111,102,116,119,97,114,101,32,65,117,100,
+    105,111,0,83,105,83,55,48,49,54,0,49,48,47,49,48,48,32,69,116,
+    104,101,114,110,101,116,32,65,100,97,112,116,101,114,0,83,105,83,55,48,
+    49,56,0,80,67,73,32,65,117,100,105,111,32,102,111,114,32,57,56,0,
+    72,97,114,100,119,97,114,101,32,65,117,100,105,111,0,115,105,115,54,50,
+    49,53,0,112,99,105,32,118,103,97,32,99,97,114,100,32,102,111,114,32,
+    119,105,110,120,112,0,65,52,57,55,55,65,0,86,105,115,105,97,108,105,
+    122,101,32,69,71,0,68,111,110,110,101,114,32,71,70,88,0,48,48,49,
+    0,104,112,86,105,115,117,97,108,105,122,101,70,88,0,72,101,119,108,101,
+    116,116,45,80,97,99,107,97,114,100,32,86,105,115,117,97,108,105,122,101,
+    70,88,32,83,101,114,105,101,115,32,86,105,100,101,111,0,84,97,99,104,
+    121,111,110,32,84,76,32,70,105,98,114,101,32,67,104,97,110,110,101,108,
+    32,65,100,97,112,116,101,114,0,72,80,70,67,45,53,50,48,48,66,0,
+    84,97,99,104,121,111,110,32,88,76,50,32,70,105,98,114,101,32,67,104,
+    97,110,110,101,108,32,65,100,97,112,116,101,114,0,84,97,99,104,32,84,
+    83,0,84,97,99,104,121,111,110,32,84,83,32,70,105,98,114,101,32,67,
+    104,97,110,110,101,108,32,72,111,115,116,32,65,100,97,112,116,101,114,0,
+    74,50,53,56,53,65,0,68,101,115,107,68,105,114,101,99,116,32,49,48,
+    47,49,48,48,86,71,32,76,65,78,32,65,100,97,112,116,101,114,0,74,
+    50,53,56,53,66,50,50,50,0,68,101,115,107,68,105,114,101,99,116,32,
+    49,48,47,49,48,48,32,78,73,67,0,74,50,57,55,51,65,0,68,101,
+    115,107,68,105,114,101,99,116,32,49,48,66,97,115,101,84,32,78,73,67,
+    0,74,50,53,56,53,66,0,68,101,115,107,68,105,114,101,99,116,32,49,
+    48,47,49,48,48,86,71,32,78,73,67,0,74,50,57,55,48,65,0,68,
+    101,115,107,68,105,114,101,99,116,32,49,48,66,97,115,101,84,47,50,32,
+    78,73,67,0,83,65,83,0,68,73,86,65,49,0,68,73,86,65,50,0,
+    83,80,50,0,74,51,50,52,50,65,0,69,76,45,49,48,32,69,116,104,
+    101,114,110,101,116,32,65,100,97,112,116,101,114,0,55,57,67,57,55,48,
+    0,80,67,110,101,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,
+    114,111,108,108,101,114,0,78,101,116,83,101,114,118,101,114,32,83,109,97,
+    114,116,32,73,82,81,32,82,111,117,116,101,114,0,84,111,112,84,111,111,
+    108,115,0,72,80,32,67,111,109,109,117,110,105,99,97,116,105,111,110,115,
+    32,80,111,114,116,0,56,50,53,53,55,66,0,49,48,47,49,48,48,32,
+    78,73,67,0,78,101,116,83,101,114,118,101,114,32,80,67,73,32,72,111,
+    116,45,80,108,117,103,32,67,111,110,116,114,111,108,108,101,114,0,78,101,
+    116,83,101,114,118,101,114,32,83,77,73,67,32,67,111,110,116,114,111,108,
+    108,101,114,0,78,101,116,83,101,114,118,101,114,32,76,101,103,97,99,121,
+    32,67,79,77,32,80,111,114,116,32,68,101,99,111,100,101,114,0,78,101,
+    116,83,101,114,118,101,114,32,80,67,73,32,67,79,77,32,80,111,114,116,
+    32,68,101,99,111,100,101,114,0,122,120,49,0,83,121,115,116,101,109,32,
+    66,117,115,32,65,100,97,112,116,101,114,0,76,111,99,97,108,32,66,117,
+    115,32,65,100,97,112,116,101,114,0,66,114,111,97,100,99,111,109,32,66,
+    67,77,52,51,48,54,0,66,114,111,97,100,99,111,109,32,87,105,114,101,
+    108,101,115,115,32,109,105,110,105,80,67,73,32,105,110,32,97,32,72,80,
+    32,108,97,112,116,111,112,0,69,50,57,49,48,65,0,80,67,73,32,66,
+    117,115,32,69,120,101,114,99,105,115,101,114,0,70,97,115,116,32,72,111,
+    115,116,32,73,110,116,101,114,102,97,99,101,0,69,50,57,50,52,65,0,
+    80,67,73,32,72,111,115,116,32,73,110,116,101,114,102,97,99,101,32,65,
+    100,97,112,116,101,114,0,69,50,57,50,53,65,0,51,50,32,98,105,116,
+    32,80,67,73,32,66,117,115,32,69,120,101,114,99,105,115,101,114,32,97,
+    110,100,32,65,110,97,108,121,122,101,114,0,69,50,57,50,54,65,0,54,
+    52,32,98,105,116,32,80,67,73,32,66,117,115,32,69,120,101,114,99,105,
+    115,101,114,32,97,110,100,32,65,110,97,108,121,122,101,114,0,69,50,57,
+    50,55,65,0,54,52,32,66,105,116,44,32,54,54,47,53,48,77,72,122,
+    32,80,67,73,32,65,110,97,108,121,122,101,114,32,38,97,109,112,59,32,
+    69,120,101,114,99,105,115,101,114,0,69,50,57,52,48,65,0,54,52,32,
+    98,105,116,44,32,54,54,47,53,48,77,72,122,32,67,111,109,112,97,99,
+    116,80,67,73,32,65,110,97,108,121,122,101,114,38,97,109,112,59,69,120,
+    101,114,99,105,115,101,114,0,80,54,48,48,0,80,54,48,48,32,83,109,
+    97,114,116,65,114,114,97,121,32,82,97,105,100,32,67,111,110,116,114,111,
+    108,108,101,114,0,83,109,97,114,116,32,65,114,114,97,121,32,80,52,48,
+    48,32,67,111,110,116,114,111,108,108,101,114,0,54,54,48,48,0,67,111,
+    108,111,103,110,101,32,67,104,105,112,0,68,111,109,105,110,111,0,82,65,
+    73,68,32,69,110,103,105,110,101,0,50,49,50,52,65,47,57,88,0,83,
+    109,97,114,116,67,97,99,104,101,32,73,73,73,47,82,65,73,68,32,83,
+    67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,73,50,79,32,83,
+    109,97,114,116,82,65,73,68,32,86,32,67,111,110,116,114,111,108,108,101,
+    114,0,82,97,112,116,111,114,0,83,109,97,114,116,82,65,73,68,32,67,
+    111,110,116,114,111,108,108,101,114,0,56,50,67,55,53,48,0,80,67,73,
+    32,85,83,66,32,67,111,110,116,114,111,108,108,101,114,0,56,50,67,50,
+    54,52,0,56,50,67,49,55,56,0,112,99,105,32,117,115,98,32,99,97,
+    114,100,32,50,45,32,112,111,114,116,0,56,50,67,53,53,54,0,86,105,
+    112,101,114,0,56,50,67,53,53,55,0,67,80,85,32,66,114,105,100,103,
+    101,32,40,86,105,112,101,114,41,0,56,50,67,53,53,56,0,86,101,110,
+    100,101,116,116,97,32,99,104,105,112,115,101,116,58,32,104,111,115,116,32,
+    98,114,105,100,103,101,0,86,101,110,100,101,116,116,97,32,99,104,105,112,
+    115,101,116,58,32,73,83,65,32,98,114,105,100,103,101,0,56,50,67,53,
+    55,57,0,80,101,110,116,105,117,109,32,116,111,32,80,67,73,32,66,114,
+    105,100,103,101,0,56,50,67,54,50,49,0,80,67,73,32,73,68,69,32,
+    67,111,110,116,114,111,108,108,101,114,32,40,80,73,67,41,0,56,50,67,
+    55,48,48,0,56,50,67,55,48,48,32,70,105,114,101,83,116,97,114,32,
+    80,67,73,32,116,111,32,73,83,65,32,66,114,105,100,103,101,0,56,50,
+    67,55,48,49,0,70,105,114,101,83,116,97,114,32,109,111,98,105,108,101,
+    32,99,104,105,112,115,101,116,58,32,104,111,115,116,32,98,114,105,100,103,
+    101,0,56,50,67,56,49,52,0,70,105,114,101,66,114,105,100,103,101,32,
+    73,73,32,68,111,99,107,105,110,103,32,83,116,97,116,105,111,110,32,67,
+    111,110,116,114,111,108,108,101,114,0,56,50,67,56,50,50,0,67,80,85,
+    32,116,111,32,80,67,73,32,38,97,109,112,59,32,80,67,73,32,116,111,
+    32,73,83,65,32,80,110,80,32,98,114,105,100,103,101,0,56,50,67,56,
+    50,52,0,70,105,114,101,70,111,120,32,51,50,45,66,105,116,32,80,67,
+    32,67,97,114,100,32,67,111,110,116,114,111,108,108,101,114,0,56,50,67,
+    56,50,53,32,102,117,110,99,116,105,111,110,32,48,0,80,67,73,45,116,
+    111,45,73,83,65,32,66,114,105,100,103,101,0,56,50,67,56,51,50,0,
+    67,80,85,45,116,111,45,80,67,73,32,97,110,100,32,80,67,73,45,116,
+    111,45,73,83,65,32,66,114,105,100,103,101,0,56,50,67,56,54,49,0,
+    70,105,114,101,76,105,110,107,32,80,67,73,45,116,111,45,32,53,32,120,
+    32,85,83,66,32,66,114,105,100,103,101,40,32,117,115,98,49,46,49,32,
+    41,0,56,50,67,56,56,49,0,70,105,114,101,76,105,110,107,32,49,51,
+    57,52,32,79,72,67,73,32,76,105,110,107,32,67,111,110,116,114,111,108,
+    108,101,114,0,56,50,67,56,57,53,0,56,50,67,57,51,53,0,77,97,
+    99,104,79,110,101,32,105,110,116,101,103,114,97,116,101,100,32,80,67,73,
+    32,97,117,100,105,111,32,112,114,111,99,101,115,115,111,114,0,56,50,67,
+    56,50,53,0,80,67,73,32,98,117,115,32,109,97,115,116,101,114,32,73,
+    68,69,32,99,111,110,116,114,111,108,108,101,114,0,85,108,116,114,97,32,
+    68,77,65,32,73,68,69,32,99,111,110,116,114,111,108,108,101,114,0,48,
+    120,48,99,57,50,0,69,76,83,65,32,71,76,65,68,73,65,67,32,53,
+    50,56,0,69,108,115,97,32,71,108,97,100,105,97,99,32,77,88,0,78,
+    86,105,100,105,97,32,71,101,102,111,114,99,101,32,50,32,77,88,0,69,
+    108,115,97,32,71,108,97,100,105,97,99,32,55,50,49,0,78,86,105,100,
+    105,97,32,71,101,70,111,114,99,101,51,32,84,105,32,50,48,48,0,81,
+    117,105,99,107,32,83,116,101,112,32,49,48,48,48,0,73,83,68,78,32,
+    67,111,110,116,114,111,108,108,101,114,0,81,117,105,99,107,83,116,101,112,
+    32,51,48,48,48,0,69,76,83,65,32,71,76,111,114,105,97,32,88,76,
+    0,83,84,71,32,50,48,48,48,88,0,100,105,97,109,111,110,100,0,83,
+    84,71,32,49,55,54,52,88,0,83,84,71,52,48,48,48,0,80,111,119,
+    101,114,86,82,32,75,89,82,79,32,115,101,114,105,101,115,32,51,32,103,
+    114,97,112,104,105,99,115,32,112,114,111,99,101,115,115,111,114,0,83,84,
+    80,67,32,67,111,110,115,109,114,47,73,110,100,115,116,114,108,0,78,111,
+    114,116,104,47,83,111,117,116,104,32,66,114,105,100,103,101,115,0,83,84,
+    80,67,32,65,116,108,97,115,47,69,108,105,116,101,0,83,84,80,67,32,
+    65,116,108,97,115,0,83,84,80,67,32,67,111,110,115,109,114,45,83,47,
+    69,108,105,116,101,0,83,84,80,67,32,67,111,110,115,117,109,101,114,45,
+    73,73,0,83,84,55,48,49,51,55,0,65,68,83,76,0,83,84,71,32,
+    49,55,52,54,88,0,83,84,69,49,48,47,49,48,48,65,0,80,67,73,
+    32,49,48,47,49,48,48,32,69,116,104,101,114,110,101,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,77,80,69,71,45,73,73,32,86,105,100,101,
+    111,32,68,101,99,111,100,101,114,0,66,84,57,53,56,32,83,67,83,73,
+    32,72,111,115,116,32,65,100,97,112,116,111,114,0,70,108,97,115,104,112,
+    111,105,110,116,32,76,84,0,52,54,49,48,44,52,53,49,53,44,52,54,
+    49,48,102,109,0,100,101,118,105,99,101,0,84,78,69,84,69,49,48,48,
+    65,47,49,49,48,65,47,50,49,49,0,84,104,117,110,100,101,114,76,65,
+    78,32,49,48,48,32,77,98,105,116,32,76,65,78,32,67,111,110,116,114,
+    111,108,108,101,114,0,84,73,51,56,48,80,67,73,0,80,67,73,32,105,
+    110,116,101,114,102,97,99,101,32,102,111,114,32,84,73,51,56,48,32,99,
+    111,109,112,114,101,115,115,111,114,115,0,84,73,32,80,67,73,32,69,97,
+    103,108,101,32,105,47,102,32,65,83,0,84,86,80,52,48,49,48,0,80,
+    101,114,109,101,100,105,97,0,84,86,80,52,48,50,48,0,65,71,80,32,
+    80,101,114,109,101,100,105,97,32,50,0,84,83,66,49,50,76,86,50,49,
+    0,76,89,78,88,32,73,69,69,69,49,51,57,52,32,70,105,114,101,87,
+    105,114,101,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,
+    84,83,66,49,50,76,86,50,50,0,79,72,67,73,45,76,121,110,120,32,
+    80,67,73,32,73,69,69,69,32,49,51,57,52,32,72,111,115,116,32,67,
+    111,110,116,114,111,108,108,101,114,0,84,83,66,49,50,76,86,50,54,0,
+    79,72,67,73,45,76,121,110,120,32,73,69,69,69,32,49,51,57,52,32,
+    72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,80,67,73,52,
+    52,53,48,0,79,72,67,73,45,76,121,110,120,32,73,69,69,69,32,49,
+    51,57,52,32,67,111,110,116,114,111,108,108,101,114,0,80,67,73,52,52,
+    49,48,0,84,83,66,49,50,76,86,50,51,0,84,83,66,52,51,65,65,
+    50,50,120,120,120,0,49,51,57,52,97,45,50,48,48,48,32,79,72,67,
+    73,32,80,72,89,47,76,105,110,107,32,76,97,121,101,114,32,67,116,114,
+    108,114,32,120,120,120,0,84,83,66,52,51,65,66,50,49,47,65,0,73,
+    69,69,69,49,51,57,52,97,45,50,48,48,48,32,79,72,67,73,32,80,
+    72,89,47,76,105,110,107,45,76,97,121,101,114,32,67,116,114,108,114,0,
+    84,83,66,52,51,65,66,50,51,0,73,69,69,69,32,49,51,57,52,97,
+    45,50,48,48,48,32,79,72,67,73,32,80,72,89,47,76,105,110,107,32,
+    76,97,121,101,114,32,67,116,114,108,0,84,83,66,56,50,65,65,50,0,
+    49,51,57,52,98,32,79,72,67,73,45,76,121,110,120,32,73,69,69,69,
+    32,49,51,57,52,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,
+    114,0,84,83,66,52,51,65,66,50,49,0,49,51,57,52,97,45,50,48,
+    48,48,32,79,72,67,73,32,80,72,89,47,76,105,110,107,32,76,97,121,
+    101,114,32,67,116,114,108,114,0,80,67,73,52,52,53,49,0,48,52,48,
+    56,48,51,45,50,49,53,56,0,79,72,67,73,32,67,111,109,112,108,105,
+    97,110,116,32,73,69,69,69,45,49,51,57,52,32,70,105,114,101,87,105,
+    114,101,32,67,111,110,116,114,111,108,108,101,114,0,80,67,73,55,52,50,
+    48,0,49,51,57,52,97,45,50,48,48,48,32,79,72,67,73,32,84,119,
+    111,45,80,111,114,116,32,80,72,89,47,76,105,110,107,45,76,97,121,101,
+    114,32,67,111,110,116,114,111,108,108,101,114,0,80,67,73,120,120,50,49,
+    0,73,110,116,101,103,114,97,100,101,100,32,70,108,97,115,104,77,101,100,
+    105,97,32,67,111,110,116,114,111,108,108,101,114,0,49,48,57,56,49,55,
+    51,52,0,83,68,65,32,83,116,97,110,100,97,114,100,32,67,111,109,112,
+    108,105,97,110,116,32,83,68,32,72,111,115,116,32,67,111,110,116,114,111,
+    108,108,101,114,0,80,67,73,32,71,101,109,67,111,114,101,32,98,97,115,
+    101,100,32,83,109,97,114,116,67,97,114,100,32,99,111,110,116,114,111,108,
+    108,101,114,0,102,102,49,48,49,49,55,57,0,71,101,109,67,111,114,101,
+    32,98,97,115,101,100,32,83,109,97,114,116,67,97,114,100,32,99,111,110,
+    116,114,111,108,108,101,114,0,79,72,67,73,32,67,111,109,112,108,105,97,
+    110,116,32,73,69,69,69,32,49,51,57,52,32,72,111,115,116,32,99,111,
+    110,116,114,111,108,108,101,114,0,80,67,73,120,120,49,50,0,73,110,116,
+    101,103,114,97,116,101,100,32,70,108,97,115,104,32,77,101,100,105,97,32,
+    67,111,110,116,114,111,108,108,101,114,0,84,101,120,97,115,32,73,110,115,
+    116,114,117,109,101,110,116,115,32,80,67,73,32,71,101,109,67,111,114,101,
+    32,98,97,115,101,100,32,83,109,97,114,116,67,97,114,100,32,99,111,110,
+    116,114,111,108,108,101,114,0,48,48,54,68,49,48,51,67,0,84,73,32,
+    85,108,116,114,97,77,101,100,105,97,32,70,105,114,109,119,97,114,101,32,
+    76,111,97,100,101,114,32,68,101,118,105,99,101,0,52,54,49,48,44,32,
+    52,53,49,53,44,32,52,54,49,48,70,77,0,84,73,32,85,108,116,114,
+    97,77,101,100,105,97,32,70,105,114,109,119,97,114,101,32,76,111,97,100,
+    101,114,32,68,101,118,105,99,101,32,116,101,115,116,0,80,67,73,45,50,
+    52,50,50,0,56,48,50,46,49,49,98,43,32,50,50,77,98,112,115,32,
+    87,105,114,101,108,101,115,115,32,65,100,97,112,116,101,114,0,84,77,88,
+    51,50,48,67,54,52,49,50,0,70,105,120,101,100,32,80,111,105,110,116,
+    32,68,105,103,105,116,97,108,32,83,105,103,110,97,108,32,80,114,111,99,
+    101,115,115,111,114,0,84,78,69,84,87,49,49,51,48,40,65,67,88,49,
+    49,49,41,0,56,48,50,46,49,49,98,47,103,32,87,105,114,101,108,101,
+    115,115,32,67,97,114,100,98,117,115,47,80,67,73,32,65,100,97,112,116,
+    101,114,0,84,68,67,49,53,55,48,0,54,52,45,98,105,116,32,80,67,
+    73,32,65,84,77,32,83,65,82,0,84,68,67,49,53,54,49,0,51,50,
+    45,98,105,116,32,80,67,73,32,65,84,77,32,83,65,82,0,84,78,69,
+    84,65,49,53,55,53,0,72,121,112,101,114,83,65,82,32,80,108,117,115,
+    32,119,47,80,67,73,32,104,111,115,116,32,38,97,109,112,59,32,85,84,
+    79,80,73,65,32,105,47,102,0,84,77,83,51,50,48,67,54,50,48,53,
+    0,80,67,73,50,48,53,48,66,80,68,86,0,80,67,73,49,48,53,48,
+    0,80,67,32,67,97,114,100,32,67,111,110,116,114,111,108,108,101,114,0,
+    80,67,73,49,48,51,48,47,49,48,53,51,0,80,67,73,49,49,51,48,
+    0,80,67,32,99,97,114,100,32,67,97,114,100,66,117,115,32,67,111,110,
+    116,114,111,108,108,101,114,0,80,67,73,49,48,52,99,0,80,67,73,92,
+    86,69,78,95,49,48,52,67,38,97,109,112,59,68,69,86,95,56,48,51,
+    56,38,97,109,112,59,83,85,66,83,89,83,95,48,49,56,50,49,48,50,
+    56,38,97,109,112,59,82,69,86,95,48,48,92,52,38,97,109,112,59,50,
+    70,65,50,51,53,51,53,38,97,109,112,59,48,38,97,109,112,59,48,68,
+    70,48,0,80,67,73,45,49,49,51,49,0,80,67,73,49,50,53,48,0,
+    80,67,32,67,97,114,100,32,67,97,114,100,66,117,115,32,67,111,110,116,
+    114,111,108,108,101,114,0,80,67,73,49,50,50,48,0,80,67,73,49,50,
+    54,48,0,80,67,73,49,50,50,49,0,80,67,73,49,50,49,48,0,80,
+    67,73,49,52,53,48,0,80,67,73,49,50,49,49,0,80,67,73,32,84,
+    111,32,80,67,77,67,73,65,32,32,98,114,105,100,103,101,0,80,67,73,
+    49,50,53,49,66,0,80,67,73,50,48,51,48,0,80,67,73,50,48,51,
+    49,0,80,67,73,50,48,51,50,0,80,67,73,50,50,53,48,0,80,67,
+    73,50,48,53,48,47,50,48,53,48,73,0,80,67,73,52,53,53,48,0,
+    80,67,73,52,53,49,48,83,68,70,83,68,70,83,68,0,80,67,32,67,
+    97,114,100,32,67,111,110,116,114,111,108,108,101,114,32,83,68,70,83,68,
+    65,70,83,65,68,70,83,68,65,70,83,68,65,70,0,80,67,73,52,53,
+    50,48,0,80,67,67,97,114,100,32,67,97,114,100,66,117,115,32,67,111,
+    110,116,114,111,108,108,101,114,0,55,53,49,48,47,52,53,49,48,0,67,
+    97,114,100,98,117,115,0,80,67,73,49,52,49,48,0,80,67,32,99,97,
+    114,100,32,99,97,114,100,66,117,115,32,67,111,110,116,114,111,108,108,101,
+    114,0,80,67,73,45,49,52,50,48,0,84,101,120,97,115,32,73,110,115,
+    116,114,117,109,101,110,116,115,32,49,52,50,48,0,80,67,73,49,52,53,
+    49,0,80,67,73,49,52,50,49,0,80,67,32,99,97,114,100,32,67,97,
+    114,100,66,117,115,32,67,111,110,116,114,111,108,108,101,114,32,45,32,53,
+    45,105,110,45,49,32,77,101,100,105,97,32,67,97,114,100,32,82,101,97,
+    100,101,114,0,80,67,73,45,49,53,49,48,0,80,67,67,97,114,100,32,
+    67,97,114,100,66,117,115,32,67,111,110,116,114,111,108,108,101,114,32,119,
+    47,85,108,116,114,97,77,101,100,105,97,0,80,67,73,49,53,50,48,0,
+    80,67,73,49,53,49,48,0,80,67,73,49,53,51,48,0,80,67,73,49,
+    53,49,53,0,80,67,73,49,54,50,48,0,80,67,73,49,54,49,48,0,
+    55,52,50,48,0,70,108,97,115,104,77,101,100,105,97,0,116,115,98,49,
+    50,108,118,50,54,0,70,105,114,101,87,105,114,101,32,72,111,115,116,32,
+    67,111,110,116,114,111,108,108,101,114,0,49,50,67,48,49,65,0,67,88,
+    68,49,57,52,55,0,105,46,76,73,78,75,32,70,105,114,101,87,105,114,
+    101,32,80,67,73,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,
+    114,0,67,88,68,51,50,50,50,0,79,72,67,73,32,105,46,76,73,78,
+    75,32,40,73,69,69,69,32,49,51,57,52,41,32,80,67,73,32,72,111,
+    115,116,32,67,116,114,108,114,0,48,120,49,50,55,97,0,82,111,99,107,
+    119,101,108,108,32,72,67,70,32,53,54,75,32,77,111,100,101,109,0,81,
+    99,32,112,97,115,115,0,79,84,73,45,54,52,48,49,55,0,79,84,73,
+    49,48,55,0,83,112,105,116,102,105,114,101,32,86,71,65,32,65,99,99,
+    101,108,101,114,97,116,111,114,0,86,105,100,101,111,32,65,100,97,112,116,
+    101,114,0,79,84,73,45,54,52,50,49,55,0,79,84,73,45,54,52,51,
+    49,55,0,79,84,73,45,54,49,48,0,84,57,55,51,50,0,105,97,116,
+    99,97,56,50,54,50,0,77,117,108,116,105,32,73,47,79,0,48,48,52,
+    48,48,53,45,51,52,99,56,99,56,0,69,116,104,101,114,110,101,116,32,
+    67,111,110,116,114,111,108,108,101,114,32,40,78,69,50,48,48,48,32,99,
+    111,109,112,97,116,105,98,108,101,41,0,87,56,51,55,54,57,70,0,80,
+    67,73,47,73,68,69,32,99,111,110,116,114,111,108,108,101,114,0,87,56,
+    57,67,51,51,0,87,105,110,98,111,110,100,32,87,56,57,67,51,51,32,
+    109,80,67,73,32,56,48,50,46,49,49,32,87,105,114,101,108,101,115,115,
+    32,76,65,78,32,65,100,97,112,116,101,114,0,87,56,50,67,49,48,53,
+    0,69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,114,0,87,56,
+    51,54,50,56,70,47,54,50,57,68,0,80,67,73,32,116,111,32,73,83,
+    65,32,66,114,105,100,103,101,32,83,101,116,0,87,56,57,67,56,52,48,
+    70,0,49,48,48,47,49,48,77,98,112,115,32,69,116,104,101,114,110,101,
+    116,32,67,111,110,116,114,111,108,108,101,114,0,119,56,57,99,57,52,48,
+    102,0,119,105,110,98,111,110,100,32,112,99,105,32,101,116,104,101,114,110,
+    101,116,0,87,57,57,50,48,48,70,0,86,105,100,101,111,32,99,97,112,
+    116,117,114,101,32,99,97,114,100,0,87,56,57,67,57,52,48,70,0,69,
+    76,65,78,67,45,80,67,73,32,84,119,105,115,116,101,100,45,112,97,105,
+    114,32,69,116,104,101,114,45,76,65,78,32,67,116,114,108,114,0,87,54,
+    54,57,50,47,57,50,65,47,57,50,67,70,0,80,67,73,32,66,117,115,
+    73,83,68,78,32,83,47,84,45,67,111,110,116,114,111,108,108,101,114,0,
+    87,57,57,50,48,48,65,70,0,77,80,69,71,49,32,99,97,112,116,117,
+    114,101,32,99,97,114,100,0,87,57,57,50,50,80,70,0,77,80,69,71,
+    45,49,47,50,32,68,101,99,111,100,101,114,0,87,57,57,54,48,67,70,
+    0,87,57,57,54,49,67,70,0,72,46,50,54,51,47,72,46,50,54,49,
+    32,86,105,100,101,111,32,67,111,100,101,99,0,87,57,57,55,48,67,70,
+    0,86,71,65,32,99,111,110,116,114,111,108,108,101,114,0,87,57,57,55,
+    49,67,70,0,80,67,73,32,98,117,115,32,67,110,116,114,108,114,0,83,
+    72,55,55,53,49,0,83,117,112,101,114,72,32,40,83,72,41,32,51,50,
+    45,66,105,116,32,82,73,83,67,32,77,67,85,47,77,80,85,32,83,101,
+    114,105,101,115,0,69,70,65,82,32,52,56,54,32,104,111,115,116,32,66,
+    114,105,100,103,101,0,80,101,110,116,105,117,109,47,112,53,52,99,32,104,
+    111,115,116,32,66,114,105,100,103,101,0,73,32,100,111,110,-62,-76,116,32,
+    107,110,111,119,32,112,101,110,116,105,117,109,32,49,51,51,32,105,110,116,
+    101,108,32,32,32,101,118,101,114,101,120,32,115,101,116,112,110,111,116,32,
+    109,120,0,83,76,67,57,48,69,54,54,0,85,108,116,114,97,32,65,84,
+    65,47,54,54,32,73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,
+    86,105,99,116,111,114,121,54,54,32,80,67,73,32,116,111,32,73,83,65,
+    32,66,114,105,100,103,101,0,86,105,99,116,111,114,121,54,54,32,85,68,
+    77,65,32,69,73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,86,
+    105,99,116,111,114,121,54,54,32,85,83,66,32,72,111,115,116,32,67,111,
+    110,116,114,111,108,108,101,114,0,86,105,99,116,111,114,121,54,54,32,80,
+    111,119,101,114,32,77,97,110,97,103,101,109,101,110,116,32,67,111,110,116,
+    114,111,108,108,101,114,0,77,80,67,49,48,53,0,80,67,73,32,66,114,
+    105,100,103,101,32,47,32,77,101,109,111,114,121,32,67,111,110,116,114,111,
+    108,108,101,114,32,40,80,67,73,66,47,77,67,41,0,77,80,67,49,48,
+    54,0,80,67,73,32,66,114,105,100,103,101,47,77,101,109,111,114,121,32,
+    67,111,110,116,114,111,108,108,101,114,32,40,80,67,73,66,47,77,67,41,
+    0,77,80,67,56,50,52,48,0,73,110,116,101,103,114,97,116,101,100,32,
+    80,114,111,99,101,115,115,111,114,0,77,80,67,49,48,55,0,80,67,73,
+    32,66,114,105,100,103,101,47,77,101,109,111,114,121,32,67,111,110,116,114,
+    111,108,108,101,114,32,102,111,114,32,80,80,67,0,77,80,67,56,50,52,
+    53,0,77,67,49,52,53,53,55,53,0,72,67,70,45,80,67,73,0,75,
+    84,73,56,50,57,99,0,49,48,48,86,71,32,69,116,104,101,114,110,101,
+    116,32,67,111,110,116,114,111,108,108,101,114,0,68,83,80,53,54,51,48,
+    49,0,50,52,45,98,105,116,32,68,105,103,105,116,97,108,32,83,105,103,
+    110,97,108,32,80,114,111,99,101,115,115,111,114,0,68,83,80,53,54,51,
+    48,53,0,50,52,45,66,105,116,32,68,105,103,105,116,97,108,32,83,105,
+    103,110,97,108,32,80,114,111,99,101,115,115,111,114,0,77,80,67,56,50,
+    54,53,65,47,54,54,0,80,111,119,101,114,81,85,73,67,67,32,73,73,
+    32,80,67,73,32,66,114,105,100,103,101,0,83,77,53,54,0,77,111,116,
+    111,114,111,108,97,83,77,53,54,77,111,100,101,109,0,53,54,73,86,77,
+    82,47,80,104,111,101,110,105,120,32,53,54,73,83,77,0,77,111,100,101,
+    109,0,82,97,118,101,110,0,80,111,119,101,114,80,67,32,67,104,105,112,
+    115,101,116,0,70,97,108,99,111,110,0,109,101,109,111,114,121,32,99,111,
+    110,116,114,111,108,32,99,104,105,112,115,101,116,0,72,97,119,107,0,67,
+    80,88,56,50,49,54,0,67,80,88,56,50,49,54,84,0,72,111,116,83,
+    119,97,112,32,67,111,110,116,114,111,108,108,101,114,0,87,68,77,32,77,
+    79,84,56,56,56,56,0,83,77,32,53,54,32,80,67,73,32,83,112,101,
+    97,107,101,114,112,104,111,110,101,47,68,97,116,97,44,70,97,120,32,32,
+    77,111,100,101,109,0,80,67,73,32,77,111,100,101,109,0,53,50,45,54,
+    49,49,54,45,50,65,0,80,67,73,32,70,97,120,32,86,111,105,99,101,
+    32,77,111,100,101,109,0,77,80,67,53,50,48,48,0,51,50,45,66,105,
+    116,32,69,109,98,101,100,100,101,100,32,80,111,119,101,114,80,67,32,80,
+    114,111,99,101,115,115,111,114,0,77,80,67,49,57,48,0,83,101,99,117,
+    114,105,116,121,32,67,111,45,80,114,111,99,101,115,115,111,114,0,80,68,
+    67,50,48,50,54,53,82,0,80,114,111,109,105,115,101,32,85,108,116,114,
+    97,49,48,48,32,40,116,109,41,32,73,68,69,32,67,111,110,116,114,111,
+    108,108,101,114,32,40,80,68,67,50,48,50,54,53,41,0,80,68,67,50,
+    48,50,54,51,0,70,97,115,116,84,114,97,107,54,54,32,76,105,116,101,
+    32,69,73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,80,68,67,
+    50,48,50,55,53,0,70,97,115,116,84,114,97,99,107,32,84,88,32,69,
+    73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,80,68,67,50,48,
+    51,49,56,63,0,70,97,115,116,84,114,97,107,32,83,65,84,65,49,53,
+    48,32,84,88,52,32,67,111,110,116,114,111,108,108,101,114,0,80,68,67,
+    50,48,51,49,57,63,0,80,68,67,50,48,51,55,49,63,0,70,97,115,
+    116,84,114,97,107,32,83,65,84,65,49,53,48,32,84,88,50,112,108,117,
+    115,32,67,111,110,116,114,111,108,108,101,114,0,80,68,67,50,48,51,55,
+    56,0,70,97,115,116,84,114,97,107,32,51,55,56,47,83,65,84,65,32,
+    51,55,56,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,0,
+    80,68,67,50,48,51,55,53,63,0,80,68,67,50,48,51,55,54,0,70,
+    97,115,116,84,114,97,107,32,51,55,54,32,67,111,110,116,114,111,108,108,
+    101,114,0,80,68,67,50,48,55,55,49,0,70,97,115,116,84,114,97,107,
+    32,84,88,50,51,48,48,32,83,65,84,65,51,48,48,32,67,111,110,116,
+    114,111,108,108,101,114,0,48,120,51,53,55,49,0,70,97,115,116,116,114,
+    97,99,107,32,84,88,50,50,48,48,0,80,68,67,50,48,53,55,57,0,
+    83,65,84,65,73,73,32,49,53,48,32,73,68,69,32,67,111,110,116,114,
+    111,108,108,101,114,0,80,68,67,52,48,55,49,56,45,71,80,0,83,65,
+    84,65,32,51,48,48,32,84,88,52,32,67,111,110,116,114,111,108,108,101,
+    114,0,80,68,67,50,48,53,49,56,0,80,68,67,50,48,55,55,53,0,
+    83,65,84,65,73,73,32,51,48,48,32,84,88,50,112,108,117,115,32,73,
+    68,69,32,67,111,110,116,114,111,108,108,101,114,0,80,68,67,50,48,50,
+    54,55,0,85,108,116,114,97,49,48,48,32,69,73,68,69,32,67,111,110,
+    116,114,111,108,108,101,114,0,80,68,67,50,48,50,52,54,0,70,97,115,
+    116,84,114,97,107,32,85,108,116,114,97,32,65,84,65,32,82,65,73,68,
+    32,99,111,110,116,114,111,108,108,101,114,0,80,68,67,50,48,50,54,50,
+    0,85,108,116,114,97,54,54,32,69,73,68,69,32,67,111,110,116,114,111,
+    108,108,101,114,0,80,68,67,50,48,50,54,56,0,80,68,67,50,48,50,
+    54,57,0,85,108,116,114,97,49,51,51,32,69,73,68,69,32,67,111,110,
+    116,114,111,108,108,101,114,0,80,68,67,50,48,50,55,54,0,77,66,85,
+    108,116,114,97,49,51,51,32,69,73,68,69,32,67,111,110,116,114,111,108,
+    108,101,114,0,68,67,53,51,48,48,0,80,68,67,50,48,50,54,56,82,
+    0,70,97,115,116,84,114,97,107,49,48,48,32,84,88,50,47,84,88,52,
+    47,76,80,32,69,73,68,69,32,99,111,110,116,114,111,108,108,101,114,0,
+    80,68,67,50,48,50,55,49,0,70,97,115,116,84,114,97,107,32,84,88,
+    50,48,48,48,32,69,73,68,69,32,99,111,110,116,114,111,108,108,101,114,
+    0,80,68,67,32,50,48,54,50,49,40,63,41,0,70,97,115,116,84,114,
+    97,107,32,83,88,52,48,48,48,0,80,68,67,32,50,48,54,50,50,32,
+    40,63,41,0,70,97,115,116,84,114,97,107,32,83,49,53,48,83,88,52,
+    0,70,97,115,116,84,114,97,107,32,84,88,52,48,48,48,32,67,111,110,
+    116,114,111,108,108,101,114,0,80,68,67,32,50,48,50,55,55,0,83,66,
+    70,97,115,116,84,114,97,107,32,49,51,51,32,76,105,116,101,0,73,109,
+    97,103,105,110,101,32,49,50,56,0,73,49,50,56,115,50,0,73,109,97,
+    103,105,110,101,32,49,50,56,32,83,101,114,105,101,115,32,50,0,84,50,
+    82,0,82,101,118,111,108,117,116,105,111,110,32,51,68,0,82,101,118,111,
+    108,117,116,105,111,110,32,73,86,0,85,77,56,50,67,56,56,49,0,52,
+    56,54,32,67,104,105,112,115,101,116,0,85,77,56,50,67,56,56,54,0,
+    85,77,56,54,55,51,70,0,85,77,56,56,56,49,0,72,66,52,32,52,
+    56,54,32,80,67,73,32,67,104,105,112,115,101,116,0,85,77,56,56,56,
+    54,70,0,85,77,56,50,67,56,57,49,0,80,101,110,116,105,117,109,32,
+    67,80,85,32,116,111,32,80,67,73,32,98,114,105,100,103,101,0,85,77,
+    56,56,54,65,0,73,68,69,32,67,110,116,114,108,114,32,40,100,117,97,
+    108,32,102,117,110,99,116,105,111,110,41,0,85,77,56,56,56,54,66,70,
+    0,69,73,68,69,32,77,97,115,116,101,114,47,68,77,65,0,85,77,56,
+    55,49,48,0,86,71,65,32,67,110,116,114,108,114,0,67,80,85,47,80,
+    67,73,32,66,114,105,100,103,101,0,80,67,73,47,73,83,65,32,66,114,
+    105,100,103,101,0,80,101,110,116,105,117,109,32,67,80,85,47,80,67,73,
+    32,66,114,105,100,103,101,0,80,101,110,116,105,117,109,32,67,80,85,47,
+    73,83,65,32,66,114,105,100,103,101,0,85,77,56,56,56,54,65,0,73,
+    83,65,32,66,114,105,100,103,101,32,119,105,116,104,32,69,73,68,69,0,
+    85,77,56,56,56,49,70,0,85,77,56,56,56,54,0,73,83,65,32,66,
+    114,105,100,103,101,32,40,119,47,111,32,73,68,69,32,115,117,112,112,111,
+    114,116,41,0,85,77,56,56,57,49,0,53,56,54,32,67,104,105,112,115,
+    101,116,0,85,77,57,48,49,55,70,0,69,116,104,101,114,110,101,116,0,
+    85,77,57,48,49,56,0,85,77,57,48,50,54,0,70,97,115,116,32,69,
+    116,104,101,114,110,101,116,0,85,77,56,56,56,54,78,0,73,83,65,32,
+    66,114,105,100,103,101,32,119,47,69,73,68,69,0,80,67,73,32,47,32,
+    73,83,65,32,66,114,105,100,103,101,0,85,77,56,56,57,49,78,0,117,
+    109,56,56,57,49,110,0,65,71,88,48,49,51,47,48,49,54,0,73,73,
+    84,51,49,48,52,0,82,101,97,108,116,101,107,32,56,49,51,57,67,32,
+    78,101,116,119,111,114,107,32,67,97,114,100,0,80,84,56,48,67,56,50,
+    54,0,86,76,32,66,114,105,100,103,101,0,80,84,56,54,67,53,50,49,
+    0,86,101,115,117,118,105,117,115,32,86,49,45,76,83,32,83,121,115,116,
+    101,109,32,67,111,110,116,114,111,108,108,101,114,0,80,84,56,54,67,53,
+    50,51,0,86,101,115,117,118,105,117,115,32,86,51,45,76,83,32,73,83,
+    65,32,66,114,105,100,103,101,0,80,84,56,48,67,53,50,52,0,78,105,
+    108,101,32,80,67,73,32,116,111,32,80,67,73,32,66,114,105,100,103,101,
+    0,80,84,56,48,67,53,50,53,0,78,105,108,101,45,73,73,32,80,67,
+    73,32,116,111,32,80,67,73,32,66,114,105,100,103,101,0,80,67,56,55,
+    53,53,48,0,86,71,53,48,48,0,86,111,108,117,109,101,80,114,111,32,
+    86,111,108,117,109,101,32,82,101,110,100,101,114,105,110,103,32,65,99,99,
+    101,108,101,114,97,116,111,114,0,66,97,110,100,105,116,0,80,111,119,101,
+    114,80,67,32,72,111,115,116,45,80,67,73,32,66,114,105,100,103,101,0,
+    71,114,97,110,100,32,67,101,110,116,114,97,108,0,67,111,110,116,114,111,
+    108,32,86,105,100,101,111,0,80,108,97,110,66,0,86,105,100,101,111,45,
+    105,110,0,79,72,97,114,101,0,72,121,100,114,97,0,77,97,99,32,73,
+    47,79,32,67,111,110,116,114,111,108,108,101,114,0,72,101,97,116,104,114,
+    111,119,0,80,97,100,100,105,110,103,116,111,110,0,85,110,105,78,111,114,
+    116,104,0,70,105,114,101,87,105,114,101,32,67,111,110,116,114,111,108,108,
+    101,114,0,72,111,115,116,45,80,67,73,32,98,114,105,100,103,101,0,65,
+    71,80,32,105,110,116,101,114,102,97,99,101,0,80,97,110,103,101,97,0,
+    85,83,66,32,73,110,116,101,114,102,97,99,101,0,85,110,105,78,111,114,
+    116,104,32,49,46,53,0,73,110,116,101,114,110,97,108,32,80,67,73,0,
+    85,110,105,78,111,114,116,104,47,80,97,110,103,101,97,0,73,110,116,114,
+    101,112,105,100,0,73,110,116,101,103,114,97,116,101,100,32,65,84,65,32,
+    67,111,110,116,114,111,108,108,101,114,0,83,104,97,115,116,97,0,77,97,
+    99,32,73,47,79,32,99,111,110,116,114,111,108,101,114,0,73,68,69,32,
+    99,111,110,116,114,111,108,101,114,0,83,117,110,103,101,109,32,101,116,104,
+    101,114,110,101,116,32,99,111,110,116,114,111,108,101,114,0,70,105,114,101,
+    119,105,114,101,32,99,111,110,116,114,111,108,101,114,0,85,51,76,0,68,
+    117,97,108,32,80,101,110,116,105,117,109,32,73,83,65,47,80,67,73,32,
+    77,111,116,104,101,114,98,111,97,114,100,0,80,53,52,67,32,84,114,56,
+    0,80,111,119,101,114,80,67,32,73,83,65,47,80,67,73,32,77,111,116,
+    104,101,114,98,111,97,114,100,0,68,117,97,108,32,87,105,110,100,111,119,
+    32,71,114,97,112,104,105,99,115,32,65,99,99,101,108,101,114,97,116,111,
+    114,0,104,116,48,49,57,97,0,80,67,73,32,76,65,78,32,67,111,110,
+    116,114,111,108,108,101,114,0,49,48,48,45,66,97,115,101,84,32,76,65,
+    78,32,67,111,110,116,114,111,108,108,101,114,0,56,56,69,56,48,53,51,
+    0,89,117,107,111,110,32,80,67,73,45,69,32,71,105,103,97,98,105,116,
+    32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,
+    32,40,99,111,112,112,101,114,41,0,51,68,32,103,114,97,112,104,105,99,
+    115,32,67,110,116,114,108,114,0,89,71,86,54,49,53,0,82,80,65,51,
+    32,51,68,45,71,114,97,112,104,105,99,115,32,67,111,110,116,114,111,108,
+    108,101,114,0,48,48,48,49,49,49,55,57,0,89,77,70,55,53,52,66,
+    0,80,67,73,32,65,117,100,105,111,32,67,111,110,116,114,111,108,108,101,
+    114,0,68,83,49,0,68,83,49,32,65,117,100,105,111,0,89,77,70,55,
+    52,48,0,68,83,45,49,76,32,80,67,73,32,65,117,100,105,111,32,67,
+    111,110,116,114,111,108,108,101,114,0,89,77,70,55,52,48,67,0,68,83,
+    45,49,76,32,80,67,73,32,97,117,100,105,111,32,99,111,110,116,114,111,
+    108,108,101,114,0,89,77,70,55,50,52,70,0,89,97,109,97,104,97,32,
+    79,110,98,111,97,114,100,32,83,111,117,110,100,32,83,121,115,116,101,109,
+    0,89,77,70,55,52,52,66,45,86,0,68,83,45,49,32,80,67,73,32,
+    97,117,100,105,111,32,99,111,110,116,114,111,108,108,101,114,0,68,83,45,
+    49,69,32,80,67,73,32,65,117,100,105,111,32,67,111,110,116,114,111,108,
+    108,101,114,0,55,52,52,0,68,83,45,49,32,65,117,100,105,111,0,83,
+    87,49,48,48,48,88,71,0,83,111,117,110,100,32,115,121,115,116,101,109,
+    0,68,83,50,52,49,54,0,68,105,103,105,116,97,108,32,77,105,120,105,
+    110,103,32,67,97,114,100,0,56,50,67,53,48,48,47,49,0,78,120,53,
+    56,54,32,67,104,105,112,115,101,116,0,73,83,80,49,48,49,54,48,0,
+    83,105,110,103,108,101,32,67,104,97,110,110,101,108,32,85,108,116,114,97,
+    51,32,83,67,83,73,32,80,114,111,99,101,115,115,111,114,0,73,83,80,
+    49,48,52,48,66,47,49,48,50,48,65,0,70,97,115,116,45,119,105,100,
+    101,32,83,67,83,73,32,45,32,83,112,97,114,99,32,80,67,73,0,73,
+    83,80,49,48,50,50,65,0,73,83,80,49,48,56,48,0,83,67,83,73,
+    32,72,111,115,116,32,65,100,97,112,116,101,114,0,73,83,80,49,50,49,
+    54,48,0,68,117,97,108,32,67,104,97,110,110,101,108,32,85,108,116,114,
+    97,51,32,83,67,83,73,32,80,114,111,99,101,115,115,111,114,0,73,83,
+    80,49,50,52,48,0,73,83,80,49,50,56,48,0,73,83,80,50,48,50,
+    48,65,0,70,97,115,116,33,83,67,83,73,32,66,97,115,105,99,32,65,
+    100,97,112,116,101,114,0,73,83,80,50,49,48,48,0,54,52,45,98,105,
+    116,32,70,105,98,114,101,32,67,104,97,110,110,101,108,32,65,100,97,112,
+    116,101,114,0,73,83,80,50,50,48,48,0,80,67,73,32,70,105,98,114,
+    101,32,67,104,97,110,110,101,108,32,65,100,97,112,116,101,114,0,73,83,
+    80,32,50,51,48,48,0,54,52,45,98,105,116,32,80,67,73,32,70,67,
+    45,65,76,32,65,100,97,112,116,101,114,0,73,83,80,32,50,51,49,50,
+    0,73,83,80,50,52,50,50,0,81,76,111,103,105,99,32,80,67,73,32,
+    116,111,32,70,105,98,114,101,32,67,104,97,110,110,101,108,32,72,111,115,
+    116,32,65,100,97,112,116,101,114,32,102,111,114,32,81,76,65,50,52,54,
+    48,0,73,83,80,50,52,51,50,0,68,117,97,108,32,67,104,97,110,110,
+    101,108,32,52,71,32,80,67,73,101,32,70,105,98,114,101,32,67,104,97,
+    110,110,101,108,32,65,100,97,112,116,101,114,0,69,80,50,52,50,50,0,
+    52,45,71,98,112,115,32,70,105,98,114,101,32,67,104,97,110,110,101,108,
+    32,116,111,32,80,67,73,45,88,32,50,46,48,32,50,54,54,77,72,122,
+    32,99,111,110,116,114,111,108,108,101,114,32,102,111,114,32,69,109,98,101,
+    100,100,101,100,32,65,112,112,108,105,99,97,116,105,111,110,115,0,69,80,
+    50,52,51,50,0,52,45,71,98,112,115,32,70,105,98,114,101,32,67,104,
+    97,110,110,101,108,32,116,111,32,80,67,73,101,32,99,111,110,116,114,111,
+    108,108,101,114,32,102,111,114,32,69,109,98,101,100,100,101,100,32,65,112,
+    112,108,105,99,97,116,105,111,110,115,0,67,120,53,53,50,48,0,77,101,
+    100,105,97,71,88,109,32,77,77,88,0,67,121,114,105,120,32,73,110,116,
+    101,103,114,97,116,101,100,32,67,80,85,0,67,120,53,53,51,48,0,73,
+    83,65,32,98,114,105,100,103,101,0,83,77,73,32,115,116,97,116,117,115,
+    32,97,110,100,32,65,67,80,73,32,116,105,109,101,114,0,86,105,100,101,
+    111,32,67,111,110,116,114,111,108,108,101,114,0,69,120,112,97,110,115,105,
+    111,110,32,66,117,115,0,80,56,54,67,56,53,48,0,71,114,97,112,104,
+    105,99,32,71,76,85,45,76,111,103,105,99,0,70,76,73,80,80,69,82,
+    0,70,82,69,68,32,76,111,99,97,108,32,66,117,115,32,73,47,70,32,
+    116,111,32,80,67,73,32,80,101,114,105,112,104,101,114,97,108,0,49,48,
+    48,32,118,103,32,97,110,121,108,97,110,32,67,110,116,114,108,114,0,53,
+    53,50,54,0,70,105,98,114,101,32,67,104,97,110,110,101,108,32,72,111,
+    115,116,32,65,100,97,112,116,101,114,0,120,53,50,54,0,52,53,55,53,
+    47,53,53,50,53,47,53,53,55,53,47,54,53,55,53,0,40,105,41,99,
+    104,105,112,83,65,82,43,32,49,53,53,32,77,66,105,116,32,65,84,77,
+    32,99,111,110,116,114,111,108,108,101,114,0,53,53,51,53,45,52,80,45,
+    66,82,73,45,83,84,0,53,53,51,53,45,52,80,45,66,82,73,45,85,
+    0,53,53,51,53,45,49,80,45,83,82,0,53,53,51,53,45,49,80,45,
+    83,82,45,83,84,0,53,53,51,53,45,49,80,45,83,82,45,85,0,53,
+    53,51,53,45,49,80,45,80,82,73,0,53,53,51,53,45,50,80,45,80,
+    82,73,0,53,53,51,54,45,52,80,45,66,82,73,45,85,0,53,53,51,
+    54,45,50,80,45,80,82,73,0,65,100,97,112,116,101,114,0,54,53,51,
+    53,0,67,111,109,112,97,99,116,80,67,73,32,84,49,47,69,49,47,74,
+    49,67,111,109,109,117,110,105,99,97,116,105,111,110,115,32,67,116,114,108,
+    114,0,52,53,51,56,0,80,77,67,32,84,49,47,69,49,47,74,49,32,
+    67,111,109,109,117,110,105,99,97,116,105,111,110,115,32,67,111,110,116,114,
+    111,108,108,101,114,0,52,53,51,50,45,48,48,50,47,48,48,53,0,80,
+    77,67,32,65,84,77,32,79,118,101,114,32,79,67,45,51,47,83,84,77,
+    45,49,32,67,111,109,109,32,67,111,110,116,114,111,108,108,101,114,0,52,
+    53,51,50,45,48,48,49,47,48,48,52,0,52,53,51,50,45,48,48,48,
+    47,48,48,51,0,52,53,51,49,83,45,48,48,48,47,48,48,49,0,80,
+    77,67,32,65,84,77,32,79,118,101,114,32,84,51,47,69,51,32,67,111,
+    109,109,117,110,105,99,97,116,105,111,110,115,32,67,116,114,108,114,0,52,
+    53,51,57,0,80,77,67,32,81,117,97,100,32,84,49,47,69,49,47,74,
+    49,32,67,111,109,109,117,110,105,99,97,116,105,111,110,115,32,67,116,114,
+    108,114,0,83,76,56,50,67,49,48,53,0,69,73,68,69,32,67,116,114,
+    108,114,0,69,73,68,69,32,66,117,115,32,77,97,115,116,101,114,32,67,
+    111,110,116,114,111,108,108,101,114,0,56,50,67,53,57,54,47,57,0,67,
+    121,112,114,101,115,115,32,67,89,55,99,54,56,48,48,49,0,56,50,67,
+    54,57,51,0,50,51,51,48,0,82,97,100,105,117,115,32,80,67,73,32,
+    116,111,32,78,117,66,85,83,32,66,114,105,100,103,101,0,70,82,55,49,
+    48,0,80,67,73,32,69,110,104,97,110,99,101,100,32,73,68,69,32,65,
+    100,97,112,116,101,114,0,85,115,98,68,103,110,0,68,97,116,97,108,97,
+    115,116,101,114,32,73,110,116,101,114,102,97,99,101,32,102,111,114,32,79,
+    66,68,32,97,117,116,111,109,111,116,105,118,101,0,77,111,100,101,108,32,
+    54,49,55,0,80,67,73,45,86,77,69,32,66,117,115,32,65,100,97,112,
+    116,101,114,0,77,111,100,101,108,32,54,49,56,0,86,77,69,32,66,114,
+    105,100,103,101,0,100,97,116,97,66,76,73,90,90,65,82,68,0,77,111,
+    100,101,108,32,50,49,48,54,0,79,67,45,51,49,51,54,47,51,55,0,
+    84,111,107,101,110,45,82,105,110,103,32,49,54,47,52,32,80,67,73,32,
+    65,100,97,112,116,101,114,0,79,67,45,51,49,51,57,102,0,70,97,115,
+    116,108,111,97,100,32,49,54,47,52,32,80,67,73,47,73,73,73,32,84,
+    111,107,101,110,32,82,105,110,103,32,65,100,97,112,116,101,114,0,79,67,
+    45,51,49,51,57,47,52,48,0,82,97,112,105,100,70,105,114,101,32,84,
+    111,107,101,110,32,82,105,110,103,32,49,54,47,52,32,65,100,97,112,116,
+    101,114,0,79,67,45,51,50,53,48,0,71,111,67,97,114,100,32,84,111,
+    107,101,110,32,82,105,110,103,32,49,54,47,52,32,65,100,97,112,116,101,
+    114,0,79,67,45,51,53,51,48,0,82,97,112,105,100,70,105,114,101,32,
+    84,111,107,101,110,32,82,105,110,103,32,49,48,48,32,65,100,97,112,116,
+    101,114,0,79,67,45,51,49,52,49,0,79,67,45,51,53,52,48,0,82,
+    97,112,105,100,70,105,114,101,32,72,83,84,82,32,49,48,48,47,49,54,
+    47,52,32,65,100,97,112,116,101,114,0,79,67,45,51,49,53,48,0,82,
+    97,112,105,100,70,105,114,101,32,84,111,107,101,110,45,82,105,110,103,32,
+    49,54,47,52,32,80,67,73,32,65,100,97,112,116,101,114,0,79,67,45,
+    50,56,48,53,0,79,67,45,50,51,50,53,0,69,116,104,101,114,110,101,
+    116,32,80,67,73,47,73,73,32,49,48,47,49,48,48,32,67,111,110,116,
+    114,111,108,108,101,114,0,79,67,45,50,49,56,51,47,56,53,0,80,67,
+    73,47,73,73,32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,
+    108,108,101,114,0,79,67,45,50,51,50,54,0,79,67,45,50,51,50,55,
+    47,53,48,0,49,48,47,49,48,48,32,69,116,104,101,114,110,101,116,32,
+    67,111,110,116,114,111,108,108,101,114,0,79,67,45,54,49,53,49,47,53,
+    50,0,49,53,53,32,77,98,105,116,32,65,84,77,32,65,100,97,112,116,
+    101,114,0,65,84,77,32,65,100,97,112,116,101,114,0,83,80,65,82,67,
+    32,69,66,85,83,0,80,67,73,79,0,80,67,73,32,73,110,112,117,116,
+    47,79,117,116,112,117,116,32,67,111,110,116,114,111,108,108,101,114,0,72,
+    97,112,112,121,32,77,101,97,108,32,69,116,104,101,114,110,101,116,0,82,
+    73,79,32,69,66,85,83,0,82,73,79,32,71,69,77,0,82,73,79,32,
+    49,51,57,52,0,82,73,79,32,85,83,66,0,71,69,77,0,83,117,110,
+    32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,97,
+    114,100,0,83,77,69,50,52,49,49,0,85,108,116,114,97,83,80,65,82,
+    67,45,73,73,105,32,65,100,118,97,110,99,101,100,32,80,67,73,32,66,
+    114,105,100,103,101,0,83,117,110,80,67,73,0,67,111,45,112,114,111,99,
+    101,115,115,111,114,0,83,117,110,80,67,105,0,80,67,73,32,99,97,114,
+    100,32,119,105,116,104,32,73,110,116,101,108,32,111,114,32,65,77,68,32,
+    112,114,111,99,101,115,115,111,114,0,83,84,80,50,50,50,51,66,71,65,
+    0,85,80,65,32,116,111,32,80,67,73,32,73,110,116,101,114,102,97,99,
+    101,32,40,85,80,65,41,0,83,99,104,105,122,111,0,80,67,73,32,66,
+    117,115,32,77,111,100,117,108,101,0,85,108,116,114,97,83,80,65,82,67,
+    32,73,73,105,0,83,97,98,114,101,0,85,108,116,114,97,83,80,65,82,
+    67,32,73,73,101,0,72,117,109,109,105,110,103,98,105,114,100,0,67,69,
+    32,40,67,97,115,115,105,110,105,32,69,116,104,101,114,110,101,116,41,0,
+    49,48,47,49,48,48,47,49,48,48,48,32,69,116,104,101,114,110,101,116,
+    32,97,100,97,112,116,101,114,0,51,68,32,71,114,97,112,104,105,99,115,
+    32,80,114,111,99,101,115,115,111,114,0,51,68,32,103,114,97,112,104,105,
+    99,115,32,112,114,111,99,101,115,115,111,114,32,119,47,116,101,120,116,117,
+    114,105,110,103,0,51,68,32,103,114,97,112,104,105,99,115,32,102,114,97,
+    109,101,32,98,117,102,102,101,114,0,80,114,111,112,114,105,101,116,97,114,
+    121,32,98,117,115,32,66,114,105,100,103,101,0,80,111,119,101,114,115,116,
+    111,114,109,32,52,68,53,48,84,0,77,111,116,105,111,110,32,74,80,69,
+    71,32,67,111,100,101,99,0,83,112,101,101,100,83,116,97,114,32,80,114,
+    111,32,83,69,0,83,112,101,101,100,83,116,97,114,32,54,52,0,86,105,
+    112,101,114,32,86,53,53,48,0,83,117,112,114,97,32,50,50,54,48,0,
+    87,105,110,77,111,100,101,109,0,83,117,112,114,97,69,120,112,114,101,115,
+    115,32,53,54,105,32,80,114,111,0,83,85,80,50,55,54,49,0,83,117,
+    112,114,97,69,120,112,114,101,115,115,32,53,54,105,32,80,114,111,32,86,
+    67,67,0,82,54,55,57,51,45,49,50,0,82,83,53,54,45,112,99,105,
+    0,86,105,112,101,114,32,86,51,51,48,0,77,97,120,105,109,117,109,0,
+    68,86,68,0,83,116,101,97,108,116,104,32,83,69,0,83,116,101,97,108,
+    116,104,32,54,52,47,83,69,0,83,116,101,97,108,116,104,32,86,105,100,
+    101,111,0,83,116,101,97,108,116,104,32,54,52,32,86,105,100,101,111,0,
+    83,116,101,97,108,116,104,32,54,52,0,83,117,112,114,97,32,69,120,112,
+    114,101,115,115,32,53,54,105,32,80,114,111,32,67,87,32,35,50,0,77,
+    111,110,115,116,101,114,32,83,111,117,110,100,0,68,105,97,109,97,110,100,
+    32,84,101,99,104,110,111,108,111,103,121,32,68,84,48,51,57,56,0,80,
+    67,73,45,68,73,79,45,57,54,0,100,97,116,97,32,97,100,113,117,105,
+    115,105,116,105,111,110,32,105,110,112,117,116,32,97,110,100,32,111,117,116,
+    112,117,116,0,80,67,73,45,49,50,48,48,0,77,117,108,116,105,102,117,
+    110,99,116,105,111,110,32,100,97,116,97,32,97,99,113,117,105,115,105,116,
+    105,111,110,32,98,111,97,114,100,0,80,67,73,45,77,73,79,45,49,54,
+    88,69,45,53,48,0,50,52,77,73,79,32,32,54,45,48,51,45,50,0,
+    80,67,73,45,68,73,79,45,51,50,72,83,0,72,105,103,104,32,83,112,
+    101,101,100,32,68,105,103,105,116,97,108,32,73,47,79,32,66,111,97,114,
+    100,0,80,67,73,45,77,73,79,45,49,54,88,69,45,49,48,0,80,67,
+    73,45,77,73,79,45,49,54,69,45,49,0,80,67,73,45,77,73,79,45,
+    49,54,69,45,52,0,80,67,73,45,54,48,51,50,69,0,77,117,108,116,
+    105,102,117,110,99,116,105,111,110,32,68,97,116,97,32,65,99,113,117,105,
+    115,105,116,105,111,110,32,67,97,114,100,0,80,67,73,45,54,53,51,52,
+    0,72,105,103,104,32,83,112,101,101,100,32,68,73,79,0,80,67,73,45,
+    54,54,48,50,0,68,97,116,97,32,65,99,113,117,105,115,105,116,105,111,
+    110,32,68,101,118,105,99,101,0,80,67,73,45,54,48,51,49,69,0,80,
+    67,73,45,54,48,51,51,69,0,80,67,73,45,54,48,55,49,69,0,32,
+    78,73,32,80,67,73,45,54,48,55,49,69,32,77,117,108,116,105,102,117,
+    110,99,116,105,111,110,32,73,47,79,32,38,97,109,112,59,32,78,73,45,
+    68,65,81,0,80,67,73,45,54,53,48,51,0,78,73,32,54,48,49,52,
+    0,73,47,79,32,84,101,114,109,105,110,97,108,32,78,73,45,68,65,81,
+    32,40,76,101,103,97,99,121,41,32,97,110,100,32,78,73,45,68,65,81,
+    109,120,0,80,67,73,45,54,48,50,51,69,0,80,67,73,45,54,48,50,
+    52,69,0,80,67,73,45,54,48,50,53,69,0,80,67,73,45,54,48,51,
+    53,69,0,80,67,73,45,54,50,50,49,0,49,54,45,66,105,116,44,32,
+    50,53,48,32,107,83,47,115,44,32,49,54,32,65,110,97,108,111,103,32,
+    73,110,112,117,116,115,0,73,77,65,81,45,80,67,73,45,49,52,48,56,
+    0,73,77,65,81,45,80,88,73,45,49,52,48,56,0,73,77,65,81,45,
+    80,67,73,45,49,52,50,52,0,73,77,65,81,45,80,67,73,45,49,52,
+    49,51,0,73,77,65,81,45,80,67,73,45,49,52,48,55,0,73,77,65,
+    81,45,80,88,73,45,49,52,48,55,0,73,77,65,81,45,80,67,73,45,
+    49,52,49,49,0,73,77,65,81,45,80,67,73,45,49,52,50,50,0,73,
+    77,65,81,45,80,88,73,45,49,52,50,50,0,73,77,65,81,45,80,88,
+    73,45,49,52,49,49,0,80,67,73,45,71,80,73,66,0,71,80,73,66,
+    32,67,111,110,116,114,111,108,108,101,114,32,73,110,116,101,114,102,97,99,
+    101,32,66,111,97,114,100,0,80,67,73,45,50,51,50,47,50,0,50,45,
+    112,111,114,116,32,82,83,45,50,51,50,32,83,101,114,105,97,108,32,73,
+    110,116,101,114,102,97,99,101,32,66,111,97,114,100,0,80,67,73,48,54,
+    52,48,65,47,66,0,80,67,73,48,54,52,48,0,80,67,73,32,69,73,
+    68,69,32,65,100,97,112,116,101,114,32,119,105,116,104,32,82,65,73,68,
+    32,49,0,80,67,73,48,54,52,50,0,73,68,69,32,67,110,116,114,108,
+    114,32,119,47,82,65,73,68,32,49,0,80,67,73,48,54,52,51,0,80,
+    67,73,32,69,73,68,69,32,99,111,110,116,114,111,108,108,101,114,0,80,
+    67,73,48,54,52,54,0,98,117,115,32,109,97,115,116,101,114,32,73,68,
+    69,0,80,67,73,48,54,52,55,0,57,55,51,56,0,80,67,73,45,54,
+    52,56,0,66,117,115,32,77,97,115,116,101,114,32,85,108,116,114,97,32,
+    68,77,65,32,80,67,73,45,73,68,69,47,65,84,65,32,67,104,105,112,
+    0,80,67,73,45,54,52,57,0,85,108,116,114,97,32,65,84,65,47,49,
+    48,48,32,80,67,73,32,116,111,32,73,68,69,47,65,84,65,32,67,111,
+    110,116,114,111,108,108,101,114,0,80,66,67,48,54,53,48,65,0,70,97,
+    115,116,32,83,67,83,73,45,73,73,32,67,116,114,108,114,0,85,83,66,
+    48,54,55,48,0,80,67,73,45,85,83,66,0,85,83,66,48,54,55,51,
+    0,80,67,73,45,85,83,66,32,65,83,73,67,0,83,105,73,32,48,54,
+    56,48,0,85,108,116,114,97,65,84,65,47,49,51,51,32,69,73,68,69,
+    32,67,111,110,116,114,111,108,108,101,114,0,83,73,51,49,50,52,0,83,
+    65,84,65,76,105,110,107,32,52,45,80,111,114,116,32,80,67,73,45,88,
+    32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,83,105,73,
+    32,51,49,49,50,0,83,65,84,65,76,105,110,107,47,83,65,84,65,82,
+    97,105,100,32,67,111,110,116,114,111,108,108,101,114,0,83,105,108,32,51,
+    49,49,52,0,83,105,73,32,51,49,50,52,0,80,67,73,45,88,32,116,
+    111,32,83,101,114,105,97,108,32,65,84,65,32,67,111,110,116,114,111,108,
+    108,101,114,0,83,105,73,32,51,49,51,50,0,80,67,73,32,69,120,112,
+    114,101,115,115,32,40,49,120,41,32,116,111,32,50,32,80,111,114,116,32,
+    83,65,84,65,51,48,48,0,83,105,108,32,51,53,49,50,0,51,53,51,
+    49,0,83,105,73,32,51,53,51,49,32,83,65,84,65,32,67,111,110,116,
+    114,111,108,108,101,114,0,48,120,51,48,53,57,0,48,120,52,55,50,48,
+    52,48,48,53,38,97,109,112,59,82,69,0,69,73,68,69,32,67,111,110,
+    116,114,111,108,108,101,114,32,40,115,105,110,103,108,101,32,70,73,70,79,
+    41,0,81,68,56,53,48,48,0,81,68,56,53,56,48,0,66,84,56,52,
+    56,65,75,80,70,0,66,116,56,52,56,65,75,80,70,32,66,114,111,111,
+    107,116,114,101,101,32,77,101,100,105,97,115,116,114,101,97,109,32,67,111,
+    110,116,114,111,108,108,101,114,32,114,101,118,46,49,50,0,66,32,116,56,
+    55,56,32,107,104,102,0,116,99,32,99,97,114,100,0,66,116,56,55,56,
+    0,86,105,100,101,111,32,67,97,112,116,117,114,101,0,116,104,38,97,109,
+    112,59,35,51,48,53,59,107,0,106,102,103,106,0,56,55,56,65,0,83,
+    86,82,45,50,48,48,48,32,86,49,46,48,50,0,66,116,56,55,56,107,
+    104,102,0,66,116,56,56,48,0,86,105,100,101,111,32,67,97,112,116,117,
+    114,101,32,40,49,48,32,98,105,116,32,72,105,103,104,32,113,117,97,108,
+    116,105,121,32,99,97,112,41,0,55,54,49,48,49,52,52,68,38,97,109,
+    112,59,82,69,86,95,48,50,92,52,38,97,109,112,59,49,70,55,68,66,
+    67,57,70,38,97,109,112,59,48,38,97,109,112,59,48,57,70,48,0,84,
+    86,32,86,105,100,101,111,32,67,97,112,116,117,114,101,0,66,116,56,55,
+    57,107,104,102,0,86,105,100,101,111,32,67,97,112,116,117,114,101,32,40,
+    65,117,100,105,111,32,83,101,99,116,105,111,110,41,0,66,84,56,52,56,
+    97,107,112,102,0,98,117,115,0,66,116,86,32,50,49,49,53,32,77,101,
+    114,97,32,76,117,110,0,66,116,86,32,77,101,100,105,97,115,116,114,101,
+    97,109,32,67,111,110,116,114,111,108,108,101,114,32,57,120,0,66,116,86,
+    32,50,49,50,53,0,66,116,86,32,77,101,100,105,97,115,116,114,101,97,
+    109,32,67,111,110,116,114,111,108,108,101,114,0,66,116,86,32,50,49,54,
+    52,0,68,105,115,112,108,97,121,32,65,100,97,112,116,101,114,0,66,116,
+    86,32,50,49,54,53,0,77,101,100,105,97,83,116,114,101,97,109,32,67,
+    111,110,116,114,111,108,108,101,114,0,66,116,86,32,56,50,51,48,0,65,
+    84,77,32,83,101,103,109,101,110,116,47,82,101,97,115,115,101,109,98,108,
+    121,32,67,111,110,116,114,111,108,108,101,114,32,40,83,82,67,41,0,66,
+    116,56,52,55,49,47,55,50,0,51,50,47,54,52,45,99,104,97,110,110,
+    101,108,32,72,68,76,67,32,67,111,110,116,114,111,108,108,101,114,115,0,
+    66,116,56,52,55,52,0,49,50,56,45,99,104,97,110,110,101,108,32,72,
+    68,76,67,32,67,111,110,116,114,111,108,108,101,114,0,54,52,45,98,105,
+    116,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,79,50,
+    32,77,65,67,69,0,82,65,68,32,65,117,100,105,111,0,72,80,67,69,
+    88,0,82,80,67,69,88,0,68,105,86,79,32,86,73,80,0,71,105,103,
+    97,98,105,116,32,69,116,104,101,114,110,101,116,0,86,105,100,101,111,32,
+    73,47,79,0,71,82,73,80,0,83,71,72,32,80,83,72,65,67,32,71,
+    83,78,0,77,97,103,105,99,32,67,97,114,112,101,116,0,76,105,116,104,
+    105,117,109,0,68,117,97,108,32,74,80,69,71,32,49,0,68,117,97,108,
+    32,74,80,69,71,32,50,0,68,117,97,108,32,74,80,69,71,32,51,0,
+    68,117,97,108,32,74,80,69,71,32,52,0,68,117,97,108,32,74,80,69,
+    71,32,53,0,67,101,115,105,117,109,0,70,105,98,114,101,32,67,104,97,
+    110,110,101,108,0,65,83,68,69,0,79,50,32,49,51,57,52,0,71,45,
+    110,101,116,32,78,84,0,85,83,66,92,86,73,68,95,49,48,65,66,38,
+    97,109,112,59,80,73,68,95,49,48,48,53,92,53,38,97,109,112,59,51,
+    55,56,51,69,52,57,57,38,97,109,112,59,49,38,97,109,112,59,49,0,
+    85,83,66,32,66,108,117,101,116,111,111,116,104,0,115,108,56,50,99,49,
+    48,51,0,80,67,73,45,105,100,101,32,109,111,100,101,32,52,46,53,32,
+    67,110,116,114,108,114,0,87,56,51,55,56,57,70,0,83,111,110,97,116,
+    97,32,98,117,115,32,109,97,115,116,101,114,32,80,67,73,45,73,68,69,
+    32,99,111,110,116,114,111,108,108,101,114,0,87,56,51,67,53,53,51,70,
+    0,80,67,73,47,73,83,65,32,98,114,105,100,103,101,0,73,79,80,32,
+    52,56,48,0,73,110,116,101,103,114,97,116,101,100,32,80,111,119,101,114,
+    80,67,32,73,47,79,32,80,114,111,99,101,115,115,111,114,0,80,67,73,
+    32,57,48,56,48,82,68,75,45,57,54,48,0,80,67,73,32,82,101,102,
+    101,114,101,110,99,101,32,68,101,115,105,103,110,32,75,105,116,32,102,111,
+    114,32,80,67,73,32,57,48,56,48,0,71,97,122,101,108,32,82,54,56,
+    53,0,73,83,68,78,32,99,97,114,100,0,71,97,122,101,108,32,82,54,
+    57,55,0,100,117,97,108,32,99,104,97,110,110,101,108,32,73,83,68,78,
+    32,99,97,114,100,0,80,67,73,32,57,48,53,48,0,86,105,115,105,111,
+    110,32,83,121,115,116,101,109,115,32,86,83,99,111,109,32,80,67,73,45,
+    50,49,48,0,86,105,115,105,111,110,32,83,121,115,116,101,109,115,32,86,
+    83,99,111,109,32,80,67,73,45,50,48,48,0,86,105,115,105,111,110,32,
+    83,121,115,116,101,109,115,32,86,83,99,111,109,32,80,67,73,45,48,49,
+    48,83,0,86,105,115,105,111,110,32,83,121,115,116,101,109,115,32,86,83,
+    99,111,109,32,80,67,73,45,48,50,48,83,0,71,97,122,101,108,32,82,
+    55,53,51,0,84,104,97,108,101,115,32,80,67,83,77,32,83,101,99,117,
+    114,105,116,121,32,67,97,114,100,0,112,108,120,57,48,51,48,0,103,112,
+    115,99,97,114,100,0,80,67,73,32,82,68,75,57,48,53,52,45,76,73,
+    84,69,0,80,67,73,32,82,101,102,101,114,101,110,99,101,32,68,101,115,
+    105,103,110,32,75,105,116,32,102,111,114,32,80,76,88,32,80,67,73,32,
+    57,48,53,52,0,80,67,73,54,53,50,48,0,80,67,73,45,88,32,116,
+    111,32,80,67,73,45,88,32,66,114,105,100,103,101,0,80,69,88,32,56,
+    49,49,49,0,80,67,73,32,69,120,112,114,101,115,115,45,116,111,45,80,
+    67,73,32,66,114,105,100,103,101,0,80,69,88,32,56,53,49,54,0,86,
+    101,114,115,97,116,105,108,101,32,80,67,73,32,69,120,112,114,101,115,115,
+    32,83,119,105,116,99,104,0,80,69,88,32,56,53,51,50,0,80,67,73,
+    32,57,48,51,48,0,80,67,73,32,83,77,65,82,84,97,114,103,101,116,
+    32,73,47,79,32,65,99,99,101,108,101,114,97,116,111,114,0,80,67,73,
+    57,48,51,54,0,73,110,116,101,114,102,97,99,101,32,99,104,105,112,32,
+    45,32,118,97,108,117,101,32,49,107,0,84,97,114,103,101,116,32,80,67,
+    73,32,73,110,116,101,114,102,97,99,101,32,67,104,105,112,32,45,32,118,
+    97,108,117,101,32,49,107,0,80,67,73,32,57,48,53,50,0,80,67,73,
+    32,57,48,53,50,32,84,97,114,103,101,116,32,80,76,88,32,80,67,73,
+    32,73,110,116,101,114,102,97,99,101,32,67,104,105,112,0,80,67,73,32,
+    57,48,53,52,0,80,67,73,32,73,47,79,32,65,99,99,101,108,101,114,
+    97,116,111,114,0,80,67,73,57,48,54,48,0,80,67,73,32,66,117,115,
+    32,77,97,115,116,101,114,32,73,110,116,101,114,102,97,99,101,32,67,104,
+    105,112,0,80,67,73,32,57,48,54,48,83,68,0,80,67,73,32,57,48,
+    54,48,69,83,0,80,67,73,32,57,48,56,48,0,72,105,103,104,32,112,
+    101,114,102,111,114,109,97,110,99,101,32,80,67,73,32,116,111,32,76,111,
+    99,97,108,32,66,117,115,32,99,104,105,112,0,83,109,97,114,116,32,49,
+    54,47,52,0,82,105,110,103,110,111,100,101,32,40,80,67,73,49,98,41,
+    0,82,105,110,103,110,111,100,101,32,40,80,67,73,66,77,50,47,67,97,
+    114,100,66,117,115,41,0,82,105,110,103,110,111,100,101,0,83,109,97,114,
+    116,32,49,54,47,52,32,82,105,110,103,110,111,100,101,32,77,107,49,32,
+    40,80,67,73,66,77,49,41,0,49,54,47,52,32,67,97,114,100,66,117,
+    115,32,65,100,97,112,116,101,114,32,40,69,114,105,99,32,50,41,0,80,
+    114,101,115,116,111,32,80,67,73,0,83,109,97,114,116,32,49,48,48,47,
+    49,54,47,52,32,80,67,105,45,72,83,32,82,105,110,103,110,111,100,101,
+    0,83,109,97,114,116,32,49,48,48,47,49,54,47,52,32,80,67,73,32,
+    82,105,110,103,110,111,100,101,0,49,54,47,52,32,67,97,114,100,66,117,
+    115,32,32,65,100,97,112,116,101,114,32,77,107,50,0,72,111,114,105,122,
+    111,110,0,65,84,77,32,97,100,97,112,116,101,114,0,65,109,98,97,115,
+    115,97,100,111,114,0,51,67,57,56,53,0,49,48,48,48,66,97,115,101,
+    83,88,32,71,105,103,97,98,105,116,32,69,116,104,101,114,108,105,110,107,
+    0,51,67,57,48,53,67,88,45,84,88,78,77,0,51,67,79,77,32,51,
+    67,57,48,53,67,88,45,84,88,78,77,32,119,105,116,104,32,52,48,45,
+    48,54,54,52,45,48,48,51,32,65,83,73,67,0,49,52,101,52,58,49,
+    54,52,53,0,66,114,111,97,100,99,111,109,32,67,111,114,112,111,114,97,
+    116,105,111,110,32,78,101,116,88,116,114,101,109,101,32,66,67,77,53,55,
+    48,49,32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,0,
+    51,67,53,53,54,0,86,46,57,48,32,77,105,110,105,45,80,67,73,32,
+    77,111,100,101,109,0,51,67,57,52,48,0,71,105,103,97,98,105,116,32,
+    69,116,104,101,114,110,101,116,32,80,67,73,32,67,79,68,69,67,0,51,
+    67,82,87,69,55,55,55,65,0,65,105,114,67,111,110,110,101,99,116,32,
+    87,105,114,101,108,101,115,115,32,76,65,78,32,80,67,73,32,67,97,114,
+    100,0,51,67,51,51,57,0,84,111,107,101,110,32,76,105,110,107,32,86,
+    101,108,111,99,105,116,121,0,51,67,51,53,57,0,84,111,107,101,110,76,
+    105,110,107,32,86,101,108,111,99,105,116,121,32,88,76,32,65,100,97,112,
+    116,101,114,0,51,67,52,53,48,0,51,67,53,53,53,0,76,97,112,116,
+    111,112,32,72,117,114,114,105,99,97,110,101,0,51,67,53,55,53,0,77,
+    101,103,97,104,101,114,116,122,32,49,48,47,49,48,48,32,76,65,78,32,
+    67,97,114,100,66,117,115,32,80,67,32,67,97,114,100,0,51,67,53,55,
+    53,66,0,51,67,67,70,69,53,55,53,67,84,0,67,121,99,108,111,110,
+    101,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,97,114,100,
+    66,117,115,32,80,67,32,67,97,114,100,0,51,67,53,57,48,0,69,116,
+    104,101,114,110,101,116,32,73,73,73,32,66,117,115,32,70,97,115,116,32,
+    80,67,73,0,51,67,53,57,50,0,80,67,73,47,69,73,83,65,32,49,
+    48,77,98,112,115,32,68,101,109,111,110,47,86,111,114,116,101,120,0,51,
+    67,53,57,53,0,70,97,115,116,32,69,116,104,101,114,76,105,110,107,32,
+    80,67,73,32,84,88,0,70,97,115,116,32,69,116,104,101,114,76,105,110,
+    107,32,80,67,73,32,84,52,0,70,97,115,116,32,69,116,104,101,114,76,
+    105,110,107,32,80,67,73,32,77,73,73,0,51,67,53,57,55,0,80,67,
+    73,47,69,73,83,65,32,70,97,115,116,32,68,101,109,111,110,47,86,111,
+    114,116,101,120,0,77,101,103,97,104,101,114,116,122,32,49,48,47,49,48,
+    48,32,76,65,78,32,67,97,114,100,66,117,115,0,49,48,47,49,48,48,
+    32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,77,105,110,105,80,
+    67,73,32,65,100,97,112,116,101,114,0,51,67,78,51,65,67,49,53,53,
+    54,66,0,77,105,110,105,80,67,73,32,49,48,47,49,48,48,32,69,116,
+    104,101,114,110,101,116,43,77,111,100,101,109,53,54,107,32,40,115,101,101,
+    32,100,101,118,105,100,58,49,48,48,55,41,0,51,67,67,70,69,54,53,
+    54,0,67,121,99,108,111,110,101,32,67,97,114,100,66,117,115,32,80,67,
+    32,67,97,114,100,0,70,69,77,54,53,54,0,49,48,47,49,48,48,32,
+    76,65,78,43,53,54,75,32,77,111,100,101,109,32,67,97,114,100,66,117,
+    115,32,80,67,32,67,97,114,100,0,51,67,67,70,69,77,54,53,54,0,
+    70,69,77,54,53,54,66,0,51,67,67,70,69,77,54,53,54,67,0,71,
+    108,111,98,97,108,32,49,48,47,49,48,48,32,70,97,115,116,32,69,116,
+    104,101,114,110,101,116,43,53,54,75,32,77,111,100,101,109,0,51,67,83,
+    79,72,79,49,48,48,66,45,84,88,0,72,117,114,114,105,99,97,110,101,
+    0,65,105,114,67,111,110,110,101,99,116,32,87,105,114,101,108,101,115,115,
+    32,80,67,73,0,84,111,107,101,110,32,82,105,110,103,0,51,67,57,48,
+    48,45,84,80,79,0,70,97,115,116,32,69,116,104,101,114,108,105,110,107,
+    32,80,67,73,32,84,80,79,32,78,73,67,0,51,67,57,48,48,45,67,
+    79,77,66,79,0,70,97,115,116,32,69,116,104,101,114,108,105,110,107,32,
+    88,76,32,80,67,73,32,67,111,109,98,111,32,78,73,67,0,69,116,104,
+    101,114,76,105,110,107,32,88,76,32,84,80,79,32,49,48,77,98,0,51,
+    67,57,48,48,66,45,67,79,77,66,79,0,70,97,115,116,32,69,116,104,
+    101,114,108,105,110,107,32,49,48,77,98,112,115,32,67,111,109,98,111,32,
+    78,73,67,0,51,67,57,48,48,66,45,84,80,67,0,69,116,104,101,114,
+    76,105,110,107,32,88,76,32,84,80,67,0,51,67,57,48,48,66,45,70,
+    76,0,69,116,104,101,114,76,105,110,107,32,80,67,73,32,70,105,98,101,
+    114,32,78,73,67,0,51,67,57,48,53,66,32,45,32,67,111,109,98,111,
+    0,70,97,115,116,32,69,116,104,101,114,108,105,110,107,32,88,76,32,80,
+    67,73,32,49,48,47,49,48,48,0,51,67,57,48,53,45,84,52,0,70,
+    97,115,116,32,69,116,104,101,114,108,105,110,107,32,88,76,32,49,48,47,
+    49,48,48,0,51,67,57,48,53,45,84,88,0,70,97,115,116,32,69,116,
+    104,101,114,108,105,110,107,32,49,48,47,49,48,48,32,80,67,73,32,84,
+    88,32,78,73,67,0,51,67,57,48,53,66,45,84,52,0,70,97,115,116,
+    32,69,116,104,101,114,76,105,110,107,32,88,76,32,49,48,47,49,48,48,
+    0,51,67,57,48,53,66,45,67,79,77,66,79,0,68,101,108,117,120,101,
+    32,69,116,104,101,114,76,105,110,107,32,49,48,47,49,48,48,32,80,67,
+    73,32,67,111,109,98,111,32,78,73,67,0,51,67,57,48,53,66,45,70,
+    88,0,70,97,115,116,32,69,116,104,101,114,76,105,110,107,32,49,48,48,
+    32,70,105,98,101,114,32,78,73,67,0,51,67,57,48,53,32,67,88,45,
+    84,88,45,77,0,70,97,115,116,32,69,116,104,101,114,76,105,110,107,32,
+    102,111,114,32,80,67,32,77,97,110,97,103,101,109,101,110,116,32,78,73,
+    67,0,51,67,57,50,48,66,45,69,77,66,0,73,110,116,101,103,114,97,
+    116,101,100,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,111,
+    110,116,114,111,108,108,101,114,0,51,67,57,50,48,66,45,69,77,66,32,
+    51,67,111,109,32,43,32,82,101,97,108,116,101,107,32,56,50,48,49,76,
+    0,51,67,57,50,48,66,45,69,77,66,45,87,78,77,0,51,99,115,111,
+    104,111,49,48,48,98,45,116,120,0,51,67,111,109,83,79,72,79,49,48,
+    48,66,45,84,88,0,51,67,57,56,48,45,84,88,0,70,97,115,116,32,
+    69,116,104,101,114,76,105,110,107,32,88,76,32,83,101,114,118,101,114,32,
+    65,100,97,112,116,101,114,50,0,80,121,116,104,111,110,45,84,32,49,48,
+    47,49,48,48,98,97,115,101,84,88,32,78,73,67,0,51,67,82,57,57,
+    48,45,84,88,45,57,53,0,69,116,104,101,114,76,105,110,107,32,49,48,
+    47,49,48,48,32,80,67,73,32,119,105,116,104,32,51,88,80,32,80,114,
+    111,99,101,115,115,111,114,0,51,67,82,57,57,48,45,84,88,45,57,55,
+    0,51,67,57,57,48,66,45,70,88,0,49,48,48,70,88,32,80,67,73,
+    32,83,101,114,118,101,114,32,78,73,67,32,119,47,51,88,80,0,51,67,
+    82,57,57,48,83,86,82,57,53,0,69,116,104,101,114,76,105,110,107,32,
+    49,48,47,49,48,48,32,83,101,114,118,101,114,32,80,67,73,32,119,105,
+    116,104,32,51,88,80,0,51,67,82,57,57,48,83,86,82,57,55,0,51,
+    67,57,48,48,66,45,84,80,79,0,69,116,104,101,114,76,105,110,107,32,
+    88,76,32,80,67,73,0,76,65,78,56,51,67,49,55,48,81,70,47,49,
+    55,49,0,69,80,73,67,47,88,70,32,49,48,47,49,48,48,32,77,98,
+    112,115,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,116,114,
+    108,114,0,76,65,78,56,51,67,49,55,53,0,69,80,73,67,47,67,32,
+    69,116,104,101,114,110,101,116,32,67,97,114,100,66,117,115,32,73,110,116,
+    101,103,114,97,116,101,100,32,67,116,114,108,114,0,51,55,67,54,54,53,
+    0,70,68,67,0,51,55,67,57,50,50,0,56,51,67,49,55,48,81,70,
+    0,70,97,115,116,32,101,116,104,101,114,110,101,116,32,99,111,110,116,114,
+    111,108,108,101,114,0,83,77,67,51,52,67,57,48,0,67,77,73,56,51,
+    51,56,47,67,51,68,88,0,80,67,73,32,65,117,100,105,111,32,68,101,
+    118,105,99,101,32,40,79,69,77,41,0,67,77,73,56,55,51,56,47,67,
+    51,68,88,0,67,45,77,101,100,105,97,32,65,117,100,105,111,32,68,101,
+    118,105,99,101,32,40,79,69,77,41,0,77,117,108,116,105,45,73,79,32,
+    67,97,114,100,0,65,76,73,32,77,53,50,55,51,32,65,49,0,48,53,
+    51,57,32,84,83,48,53,32,67,75,66,52,50,51,50,49,48,48,48,66,
+    0,67,80,85,32,116,111,32,80,67,73,32,38,97,109,112,59,32,80,67,
+    73,32,116,111,32,73,83,65,32,66,114,105,100,103,101,32,119,47,69,73,
+    68,69,0,80,101,110,116,105,117,109,32,67,80,85,32,116,111,32,80,67,
+    73,32,66,114,105,100,103,101,0,65,108,97,100,100,105,110,32,50,32,72,
+    111,115,116,32,66,114,105,100,103,101,0,65,108,97,100,100,105,110,32,50,
+    32,83,111,117,116,104,32,66,114,105,100,103,101,0,66,105,111,115,0,77,
+    49,53,51,53,43,0,77,49,53,51,53,120,0,65,108,97,100,100,105,110,
+    32,86,32,65,71,80,115,101,116,32,72,111,115,116,32,66,114,105,100,103,
+    101,0,77,49,53,52,51,32,97,49,0,65,108,97,100,100,105,110,32,86,
+    32,99,104,105,112,115,101,116,32,83,111,117,116,104,32,66,114,105,100,103,
+    101,0,77,49,53,54,51,0,83,111,117,116,104,32,66,114,105,100,103,101,
+    32,119,105,116,104,32,72,121,112,101,114,116,114,97,110,115,112,111,114,116,
+    32,83,117,112,112,111,114,116,0,77,49,54,51,50,0,77,49,54,52,52,
+    0,65,71,80,32,83,121,115,116,101,109,32,67,111,110,116,114,111,108,108,
+    101,114,0,77,49,54,52,54,0,77,49,54,52,55,0,77,49,54,53,49,
+    0,77,49,54,54,49,0,77,49,54,54,55,0,77,49,54,55,49,0,83,
+    117,112,101,114,32,80,52,32,78,111,117,116,104,32,66,114,105,100,103,101,
+    0,77,49,54,55,50,0,77,49,54,56,49,0,80,52,32,78,111,117,116,
+    104,32,66,114,105,100,103,101,32,119,105,116,104,32,72,121,112,101,114,84,
+    114,97,110,115,112,111,114,116,0,77,49,54,56,55,0,75,56,32,78,111,
+    114,116,104,32,66,114,105,100,103,101,32,119,105,116,104,32,72,121,112,101,
+    114,84,114,97,110,115,112,111,114,116,0,50,51,49,50,56,48,57,49,0,
+    49,51,49,51,49,50,0,77,83,52,56,48,51,0,109,53,50,49,55,104,
+    0,73,47,79,32,40,63,41,0,77,53,52,53,55,0,65,67,45,76,105,
+    110,107,32,77,111,100,101,109,32,73,110,116,101,114,102,97,99,101,32,67,
+    111,110,116,114,111,108,108,101,114,0,77,53,50,56,51,0,65,84,65,47,
+    82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,0,77,53,50,50,
+    57,32,83,111,117,116,104,98,114,105,100,103,101,0,77,53,50,55,51,0,
+    69,72,67,73,32,85,83,66,32,50,46,48,0,77,53,50,55,51,32,65,
+    49,32,102,111,114,32,119,105,110,100,111,119,115,32,119,105,110,32,57,56,
+    0,79,112,101,110,72,67,73,32,49,46,49,32,85,83,66,32,116,111,32,
+    32,50,46,48,0,53,50,55,50,49,48,66,57,0,85,83,66,32,69,72,
+    67,73,50,46,48,32,67,111,110,116,114,111,108,108,101,114,0,77,53,50,
+    52,57,0,72,121,112,101,114,84,114,97,110,115,112,111,114,116,32,116,111,
+    32,80,67,73,32,66,114,105,100,103,101,0,77,53,50,53,49,0,73,69,
+    69,69,32,80,49,51,57,52,32,79,112,101,110,72,67,73,32,49,46,48,
+    32,67,111,110,116,114,111,108,108,101,114,0,77,53,50,53,51,0,77,53,
+    50,54,49,0,77,53,50,56,49,0,65,76,73,32,77,53,50,56,49,32,
+    32,83,65,84,65,47,82,65,73,68,32,67,111,110,116,114,111,108,108,101,
+    114,0,53,50,56,55,49,56,52,57,0,65,76,73,32,83,65,84,65,32,
+    99,111,110,116,114,111,108,108,101,114,0,65,103,101,114,101,32,83,121,115,
+    116,101,109,115,32,65,67,57,55,32,77,111,100,101,109,0,65,108,105,32,
+    65,117,100,105,111,32,65,99,99,101,108,101,114,97,116,111,114,0,77,49,
+    53,54,51,77,32,83,111,117,116,104,98,114,105,100,103,101,0,77,49,53,
+    54,51,77,0,65,67,57,55,32,77,111,100,101,109,32,99,111,110,116,114,
+    111,108,108,101,114,0,77,68,86,57,50,88,80,32,78,101,116,111,68,114,
+    97,103,111,110,0,80,67,73,32,83,111,102,116,32,77,111,100,101,109,32,
+    86,57,50,32,78,101,116,111,68,114,97,103,111,110,0,63,63,0,77,101,
+    109,111,114,121,32,83,116,105,99,107,32,72,111,115,116,0,77,77,67,47,
+    83,68,32,99,111,110,116,114,111,108,108,101,114,0,109,100,118,57,50,120,
+    112,0,120,104,99,116,104,55,48,48,48,48,48,98,0,32,77,89,83,79,
+    78,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,32,83,85,82,
+    69,67,79,77,32,69,80,45,51,50,48,88,45,83,32,49,48,48,47,49,
+    48,77,32,69,116,0,69,116,104,101,114,110,101,116,32,80,67,73,32,65,
+    100,97,112,116,101,114,0,78,69,51,52,0,69,116,104,101,114,110,101,116,
+    32,65,100,97,112,116,101,114,32,40,78,69,50,48,48,48,32,80,67,73,
+    32,99,108,111,110,101,41,0,48,48,53,53,0,73,68,69,32,67,110,116,
+    114,108,114,0,71,101,110,101,114,97,108,32,80,117,114,112,111,115,101,32,
+    67,110,116,114,108,114,0,48,48,48,48,48,48,48,48,0,66,117,115,32,
+    67,110,116,114,108,114,0,70,67,68,32,67,110,116,114,108,114,0,115,117,
+    114,101,99,111,109,32,69,80,45,51,50,48,88,45,82,32,97,100,97,112,
+    116,101,114,32,119,105,116,104,32,114,101,97,108,116,101,107,32,56,49,51,
+    57,99,32,99,104,105,112,0,114,101,97,108,116,101,107,32,56,49,51,57,
+    99,0,71,114,97,112,104,105,99,115,32,67,110,116,114,108,114,0,78,77,
+    50,48,57,51,0,77,97,103,105,99,71,114,97,112,104,32,49,50,56,90,
+    86,32,86,105,100,101,111,32,67,111,110,116,114,111,108,108,101,114,0,78,
+    77,50,49,54,48,0,77,97,103,105,99,71,114,97,112,104,32,49,50,56,
+    88,68,0,78,77,50,50,48,48,0,77,97,103,105,99,77,101,100,105,97,
+    32,50,53,54,65,86,0,78,77,50,51,54,48,0,77,97,103,105,99,77,
+    101,100,105,97,32,50,53,54,90,88,47,50,53,54,77,54,68,0,78,77,
+    50,51,56,48,0,77,97,103,105,99,77,101,100,105,97,32,50,53,54,88,
+    76,43,0,78,77,50,50,51,48,0,77,97,103,105,99,77,101,100,105,97,
+    32,50,53,54,65,86,43,0,78,77,50,48,57,55,0,71,114,97,112,104,
+    105,99,32,67,111,110,116,114,111,108,108,101,114,32,78,101,111,77,97,103,
+    105,99,32,77,97,103,105,99,71,114,97,112,104,49,50,56,90,86,43,0,
+    77,97,103,105,99,77,101,100,105,97,32,50,53,54,65,86,32,65,117,100,
+    105,111,32,68,101,118,105,99,101,0,77,97,103,105,99,77,101,100,105,97,
+    32,50,53,54,90,88,32,65,117,100,105,111,32,68,101,118,105,99,101,0,
+    77,97,103,105,99,77,101,100,105,97,32,50,53,54,88,76,43,32,65,117,
+    100,105,111,32,68,101,118,105,99,101,0,65,83,67,49,49,48,48,0,80,
+    67,73,32,83,67,83,73,32,72,111,115,116,32,65,100,97,112,116,101,114,
+    0,65,83,67,49,50,48,48,0,70,97,115,116,32,83,67,83,73,45,73,
+    73,0,65,83,67,45,51,53,53,48,98,0,70,57,49,52,67,53,51,54,
+    0,80,67,73,32,85,108,116,114,97,32,87,105,100,101,32,83,67,83,73,
+    32,72,111,115,116,32,65,100,97,112,116,101,114,0,65,83,67,51,56,67,
+    48,56,48,48,47,49,54,48,48,0,80,67,73,32,85,108,116,114,97,32,
+    56,48,47,49,54,48,32,83,67,83,73,32,67,111,110,116,114,111,108,108,
+    101,114,115,0,65,83,67,51,48,67,48,52,48,48,0,73,69,69,69,45,
+    49,51,57,52,32,79,72,67,73,32,80,67,73,32,67,111,110,116,114,111,
+    108,108,101,114,0,70,77,86,45,49,48,51,0,83,101,114,105,97,108,32,
+    80,97,114,97,108,108,101,108,32,67,97,114,100,0,77,66,56,54,54,48,
+    53,0,80,67,73,32,83,67,83,73,32,72,111,115,116,32,65,100,97,112,
+    116,101,114,32,40,70,97,115,116,32,87,105,100,101,32,83,67,83,73,45,
+    50,41,0,77,66,56,54,54,48,54,0,70,97,115,116,32,87,105,100,101,
+    32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,77,66,56,
+    54,57,55,52,0,49,48,47,49,48,48,32,70,97,115,116,32,69,116,104,
+    101,114,110,101,116,32,65,100,97,112,116,101,114,0,73,69,69,69,49,51,
+    57,52,32,79,112,101,110,72,67,73,32,67,111,110,116,114,111,108,108,101,
+    114,0,79,72,67,73,32,70,105,114,101,87,105,114,101,32,67,111,110,116,
+    114,111,108,108,101,114,0,77,80,69,71,50,32,82,45,69,110,103,105,110,
+    101,32,40,77,80,69,71,50,32,72,97,114,100,119,97,114,101,32,69,110,
+    99,111,100,101,114,41,0,77,66,56,54,50,57,53,0,67,111,114,97,108,
+    45,80,32,71,114,97,112,104,105,99,115,32,67,104,105,112,0,77,66,56,
+    54,50,57,54,0,67,111,114,97,108,45,80,65,32,71,114,97,112,104,105,
+    99,115,32,67,104,105,112,0,48,120,48,49,48,48,0,67,56,55,56,57,
+    57,68,0,77,88,56,54,49,48,49,80,0,115,100,97,115,0,77,88,57,
+    56,55,49,51,0,70,97,115,116,32,69,116,104,101,114,110,101,116,32,65,
+    100,97,112,116,101,114,0,77,88,57,56,55,49,53,47,50,53,0,83,105,
+    110,103,108,101,32,67,104,105,112,32,70,97,115,116,32,69,116,104,101,114,
+    110,101,116,32,78,73,67,32,67,111,110,116,114,111,108,108,101,114,0,77,
+    88,57,56,55,50,51,47,55,50,55,0,80,67,73,47,67,97,114,100,66,
+    117,115,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,77,88,57,56,55,120,53,0,77,88,56,54,
+    50,53,48,0,120,105,97,110,107,97,115,113,117,100,111,110,103,0,77,88,
+    56,54,50,53,49,0,57,54,49,57,69,0,108,99,56,50,99,49,49,53,
+    0,83,84,65,82,47,82,68,50,52,0,80,67,73,45,83,67,73,32,32,
+    80,77,67,32,32,109,101,122,122,97,110,105,110,101,0,65,84,84,32,50,
+    67,49,53,45,51,32,40,70,80,71,65,41,0,83,67,73,32,98,114,105,
+    100,103,101,32,32,111,110,32,80,67,73,32,53,32,86,111,108,116,32,99,
+    97,114,100,0,69,80,50,48,83,55,56,48,0,65,76,84,69,82,65,32,
+    83,84,82,65,84,73,88,0,54,56,48,45,49,49,49,48,45,49,53,48,
+    47,52,48,48,0,83,105,109,112,108,101,32,80,77,67,47,80,67,73,32,
+    116,111,32,83,45,76,73,78,75,32,105,110,116,101,114,102,97,99,101,0,
+    54,56,48,45,49,49,49,48,45,50,48,48,47,52,53,48,0,83,105,109,
+    112,108,101,32,83,45,76,73,78,75,32,116,111,32,80,77,67,47,80,67,
+    73,32,105,110,116,101,114,102,97,99,101,0,83,51,50,80,67,73,54,52,
+    0,51,50,45,98,105,116,32,83,45,76,73,78,75,32,116,111,32,54,52,
+    45,98,105,116,32,80,67,73,32,105,110,116,101,114,102,97,99,101,0,72,
+    73,80,80,73,32,100,101,115,116,105,110,97,116,105,111,110,0,72,73,80,
+    80,73,32,115,111,117,114,99,101,0,69,80,50,48,75,69,32,40,65,80,
+    69,88,45,70,80,71,65,41,0,65,76,73,67,69,32,68,68,76,32,116,
+    111,32,32,80,67,73,32,105,110,116,101,114,102,97,99,101,32,40,82,79,
+    82,67,41,0,83,76,54,53,49,32,55,48,53,55,32,67,50,48,48,0,
+    65,99,113,117,105,115,105,116,105,111,110,32,99,97,114,100,32,102,111,114,
+    32,116,104,101,32,83,80,83,32,79,114,98,105,116,32,83,121,115,116,101,
+    109,32,40,77,65,67,73,41,0,88,67,52,86,70,88,49,48,48,0,67,
+    65,76,73,67,69,32,79,68,82,0,80,76,88,32,80,67,73,57,54,53,
+    53,54,0,54,52,32,66,105,116,47,54,54,77,72,122,32,80,67,73,32,
+    116,111,32,76,111,99,97,108,32,66,117,115,32,66,114,105,100,103,101,0,
+    84,84,67,32,115,114,32,32,32,102,105,114,115,116,32,84,84,67,32,99,
+    104,105,112,32,114,101,99,101,105,118,101,114,32,80,77,67,0,51,68,32,
+    103,114,97,112,104,105,99,115,32,112,114,111,99,101,115,115,111,114,0,76,
+    117,99,101,110,116,32,48,120,48,48,100,97,0,83,111,117,110,100,77,65,
+    88,32,73,110,116,101,103,114,97,116,101,100,32,68,105,103,105,116,97,108,
+    32,65,117,100,105,111,0,78,86,49,0,69,100,103,101,32,51,68,0,78,
+    86,50,0,77,117,116,97,114,97,32,86,48,56,0,78,86,51,0,82,105,
+    118,97,32,49,50,56,0,82,105,118,97,32,49,50,56,90,88,0,78,86,
+    52,0,82,105,118,97,32,84,78,84,0,78,86,53,0,84,78,84,50,32,
+    47,32,84,78,84,50,32,80,114,111,0,84,78,84,50,32,85,108,116,114,
+    97,0,84,78,84,50,0,82,105,118,97,32,84,78,84,50,0,56,46,48,
+    0,86,97,110,116,97,47,86,97,110,116,97,32,76,84,0,84,78,84,50,
+    32,77,111,100,101,108,32,54,52,32,47,32,84,78,84,50,32,77,111,100,
+    101,108,32,54,52,32,80,114,111,0,78,86,54,0,86,65,78,84,65,0,
+    78,86,52,48,46,48,0,71,101,70,111,114,99,101,32,54,56,48,48,32,
+    85,108,116,114,97,0,78,86,52,48,46,49,0,71,101,70,111,114,99,101,
+    32,54,56,48,48,0,78,86,52,48,46,50,0,71,101,102,111,114,99,101,
+    32,54,56,48,48,76,69,0,78,86,52,48,46,51,0,110,102,111,114,99,
+    101,51,32,50,53,48,0,78,86,52,48,46,53,0,71,101,70,111,114,99,
+    101,32,54,56,48,48,32,71,84,0,78,86,52,48,71,76,0,81,117,97,
+    100,114,111,32,70,88,32,52,48,48,48,0,78,86,105,100,105,97,32,110,
+    70,111,114,99,101,32,52,32,83,76,73,0,110,70,111,114,99,101,52,32,
+    85,108,116,114,97,0,78,86,105,100,105,97,32,78,101,116,119,111,114,107,
+    32,66,117,115,32,69,110,117,109,101,114,97,116,111,114,0,82,101,97,108,
+    116,101,107,32,65,76,67,56,53,48,0,82,101,97,108,116,101,107,32,65,
+    67,39,57,55,32,65,117,100,105,111,0,110,70,111,114,99,101,32,77,67,
+    80,50,0,110,70,111,114,99,101,32,77,67,80,45,84,0,69,116,104,101,
+    114,110,101,116,32,65,100,97,112,116,101,114,32,67,104,105,112,32,49,48,
+    47,49,48,48,47,72,68,47,70,68,45,65,117,116,111,115,101,110,115,101,
+    0,79,112,101,110,72,67,73,32,85,83,66,32,67,111,110,116,114,111,108,
+    108,101,114,0,69,72,67,73,32,85,83,66,32,50,46,48,32,67,111,110,
+    116,114,111,108,108,101,114,0,110,86,105,100,105,97,32,77,67,80,50,84,
+    0,110,86,105,100,105,97,32,77,67,80,50,84,32,105,110,32,77,83,73,
+    32,77,69,71,65,32,49,56,48,0,65,117,100,105,111,32,67,111,100,101,
+    99,32,73,110,116,101,114,102,97,99,101,0,110,70,111,114,99,101,32,77,
+    67,80,45,84,63,0,65,117,100,105,111,32,80,114,111,99,101,115,115,105,
+    110,103,32,85,110,105,116,32,40,68,111,108,98,121,32,68,105,103,105,116,
+    97,108,41,0,110,70,111,114,99,101,0,79,72,67,73,32,67,111,109,112,
+    108,105,97,110,116,32,73,69,69,69,32,49,51,57,52,32,67,111,110,116,
+    114,111,108,108,101,114,0,82,76,84,56,50,48,49,66,76,0,83,105,110,
+    103,108,101,45,80,111,114,116,32,49,48,47,49,48,48,77,32,70,97,115,
+    116,32,69,116,104,101,114,110,101,116,32,80,72,89,99,101,105,118,101,114,
+    0,78,86,52,55,32,40,50,48,120,49,44,55,118,112,41,0,71,101,70,
+    111,114,99,101,32,55,56,48,48,71,84,0,71,55,48,46,49,0,81,117,
+    97,100,114,111,32,70,88,32,51,53,48,77,0,78,86,73,68,73,65,32,
+    71,80,85,32,81,117,97,100,114,111,32,70,88,32,52,53,48,48,0,65,
+    108,97,100,100,105,110,32,84,78,84,50,0,78,86,52,49,46,48,0,78,
+    86,52,49,71,83,0,78,86,52,49,46,49,0,78,86,73,68,73,65,32,
+    71,101,70,111,114,99,101,32,54,56,48,48,0,78,86,52,49,46,50,0,
+    78,86,52,49,0,71,101,70,111,114,99,101,32,70,88,32,54,56,48,48,
+    32,71,111,0,71,101,70,111,114,99,101,32,70,88,32,54,56,48,48,32,
+    85,108,116,114,97,32,71,111,0,81,117,97,100,114,111,32,70,88,32,49,
+    52,48,48,32,71,111,0,78,86,52,49,71,76,0,81,117,97,100,114,111,
+    32,70,88,32,51,52,53,48,47,52,48,48,48,32,83,68,73,0,78,86,
+    73,68,73,65,32,81,117,97,100,114,111,32,70,88,49,52,48,48,0,110,
+    70,111,114,99,101,32,51,0,110,70,111,114,99,101,32,51,63,0,110,70,
+    111,114,99,101,32,77,67,112,50,0,110,70,111,114,99,101,32,77,67,80,
+    51,63,0,68,117,97,108,32,67,104,97,110,110,101,108,32,80,67,73,32,
+    73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,78,101,116,119,111,
+    114,107,105,110,103,32,67,111,110,116,114,111,108,108,101,114,0,79,112,101,
+    110,72,67,68,32,85,83,66,32,72,111,115,116,32,67,111,110,116,114,111,
+    108,108,101,114,0,69,110,104,97,110,99,101,100,32,80,67,73,32,116,111,
+    32,85,83,66,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,
+    0,65,103,101,114,101,32,83,121,115,116,101,109,32,80,67,73,32,83,111,
+    102,116,32,77,111,100,101,109,0,77,97,114,118,101,108,108,32,56,56,69,
+    49,49,49,49,0,78,101,116,119,111,114,107,32,97,100,97,112,116,101,114,
+    0,110,70,111,114,99,101,51,32,50,53,48,0,76,80,67,32,73,110,116,
+    101,114,102,97,99,101,32,66,114,105,100,103,101,0,72,111,115,116,47,80,
+    67,73,32,66,114,105,100,103,101,0,110,70,111,114,99,101,50,0,83,101,
+    114,105,97,108,32,65,84,65,32,67,111,110,116,114,111,108,108,101,114,0,
+    80,67,73,32,83,121,115,116,101,109,32,77,97,110,97,103,101,109,101,110,
+    116,0,80,97,114,97,108,108,101,108,32,65,84,65,32,67,111,110,116,114,
+    111,108,108,101,114,0,79,112,101,110,72,67,68,32,85,83,66,32,67,111,
+    110,116,114,111,108,108,101,114,0,69,110,104,97,110,99,101,100,32,80,67,
+    73,32,116,111,32,85,83,66,32,67,111,110,116,114,111,108,108,101,114,0,
+    78,86,66,82,48,50,0,78,86,52,51,43,66,82,48,50,0,71,101,70,
+    111,114,99,101,32,54,54,48,48,32,71,84,32,65,71,80,0,78,86,52,
+    51,0,71,101,70,111,114,99,101,32,54,54,48,48,0,71,101,102,111,114,
+    99,101,32,54,56,48,48,71,83,0,78,86,73,68,73,65,32,81,117,97,
+    100,114,111,32,70,88,32,51,52,48,48,47,52,52,48,48,0,71,101,70,
+    111,114,99,101,32,54,56,48,48,32,71,84,79,0,78,86,66,82,48,50,
+    46,50,0,71,101,70,111,114,99,101,32,80,67,88,32,53,55,53,48,0,
+    78,86,66,82,48,50,46,51,0,71,101,70,111,114,99,101,32,80,67,88,
+    32,53,57,48,48,0,78,86,66,82,48,50,46,52,0,71,101,70,111,114,
+    99,101,32,80,67,88,32,53,51,48,48,0,78,86,66,82,48,50,71,76,
+    0,81,117,97,100,114,111,32,78,86,83,32,50,56,48,32,80,67,73,45,
+    69,0,81,117,97,100,114,111,32,70,88,32,49,51,48,48,0,78,86,66,
+    82,48,50,46,55,0,71,101,70,111,114,99,101,32,80,67,88,32,52,51,
+    48,48,0,78,86,49,48,0,71,101,70,111,114,99,101,32,50,53,54,0,
+    71,101,70,111,114,99,101,32,50,53,54,32,68,68,82,0,71,101,70,111,
+    114,99,101,32,50,53,54,32,85,108,116,114,97,0,78,86,49,48,71,76,
+    0,81,117,97,100,114,111,32,40,71,101,70,111,114,99,101,32,50,53,54,
+    32,71,76,41,0,78,86,49,49,0,71,101,70,111,114,99,101,50,32,77,
+    88,32,47,32,77,88,32,52,48,48,0,78,86,49,49,68,68,82,0,71,
+    101,70,111,114,99,101,50,32,77,88,32,49,48,48,47,50,48,48,-61,-125,
+    -30,-128,-102,-61,-126,32,32,40,68,68,82,41,0,78,118,105,100,105,97,32,
+    71,101,70,111,114,99,101,50,32,71,111,47,77,88,32,85,108,116,114,97,
+    32,86,105,100,101,111,32,65,100,97,112,116,101,114,0,78,86,49,49,71,
+    76,0,81,117,97,100,114,111,50,32,77,88,82,32,47,32,69,88,32,47,
+    32,71,111,0,78,86,73,68,73,65,32,71,101,70,111,114,99,101,32,54,
+    54,48,48,0,78,86,73,68,73,65,32,71,101,70,111,114,99,101,32,54,
+    54,49,48,32,88,76,0,78,86,73,68,73,65,32,81,117,97,100,114,111,
+    32,70,88,32,53,52,48,0,78,86,73,68,73,65,32,71,101,70,111,114,
+    99,101,32,54,50,48,48,0,78,86,49,53,0,71,101,70,111,114,99,101,
+    50,32,71,84,83,32,47,32,80,114,111,0,78,86,49,53,32,68,68,82,
+    0,71,101,70,111,114,99,101,50,32,84,105,0,78,86,49,53,66,82,0,
+    71,101,70,111,114,99,101,50,32,85,108,116,114,97,32,40,66,108,97,100,
+    101,82,117,110,110,101,114,41,0,78,86,49,53,71,76,0,81,117,97,100,
+    114,111,50,32,80,114,111,0,78,86,52,52,0,71,101,70,111,114,99,101,
+    32,54,50,48,48,32,84,117,114,98,111,67,97,99,104,101,0,78,86,52,
+    52,63,0,71,101,70,111,114,99,101,32,54,50,48,48,83,69,32,84,117,
+    114,98,111,67,97,99,104,101,0,71,101,70,111,114,99,101,32,70,88,32,
+    54,50,48,48,32,71,111,0,78,86,83,50,56,53,0,81,117,97,100,114,
+    111,32,78,86,83,32,50,56,53,0,78,86,105,100,105,97,32,71,101,70,
+    111,114,99,101,32,55,49,48,48,32,71,83,0,86,71,65,0,78,86,49,
+    55,46,50,0,71,101,70,111,114,99,101,52,32,77,88,32,52,54,48,0,
+    71,101,70,111,114,99,101,52,32,77,88,32,52,52,48,0,78,86,49,55,
+    46,51,0,71,101,70,111,114,99,101,52,32,77,88,32,52,50,48,0,78,
+    86,49,55,46,52,0,71,101,70,111,114,99,101,52,32,77,88,32,52,52,
+    48,45,83,69,0,78,86,49,55,77,0,71,101,70,111,114,99,101,52,32,
+    52,52,48,32,71,111,32,54,52,77,66,0,71,101,70,111,114,99,101,52,
+    32,52,50,48,32,71,111,0,71,101,70,111,114,99,101,52,32,52,50,48,
+    32,71,111,32,51,50,77,0,71,101,70,111,114,99,101,52,32,52,54,48,
+    32,71,111,0,78,86,49,55,71,76,46,49,0,81,117,97,100,114,111,52,
+    32,53,48,48,47,53,53,48,32,88,71,76,0,71,101,70,111,114,99,101,
+    52,32,52,52,48,32,71,111,32,54,52,77,0,78,86,49,55,71,76,46,
+    50,0,81,117,97,100,114,111,52,32,50,48,48,47,52,48,48,32,78,86,
+    83,0,78,86,49,55,71,76,46,51,0,81,117,97,100,114,111,52,32,53,
+    53,48,32,88,71,76,0,81,117,97,100,114,111,52,32,53,48,48,32,71,
+    111,71,76,0,78,86,49,56,66,0,78,86,73,68,73,65,32,71,101,70,
+    111,114,99,101,32,77,88,52,52,48,32,119,105,116,104,32,65,71,80,56,
+    88,0,78,86,49,56,46,50,0,71,101,70,111,114,99,101,52,32,77,88,
+    32,52,52,48,32,119,105,116,104,32,65,71,80,32,56,88,0,78,86,49,
+    56,46,52,0,71,101,70,111,114,99,101,52,32,77,88,32,52,50,48,32,
+    119,105,116,104,32,65,71,80,32,56,88,0,78,86,49,56,46,54,0,71,
+    101,70,111,114,99,101,52,32,77,88,32,52,48,48,48,0,78,86,49,56,
+    77,0,71,101,70,111,114,99,101,52,32,52,52,56,32,71,111,0,110,118,
+    49,56,109,0,71,101,102,111,114,99,101,52,32,52,56,56,32,71,111,0,
+    81,117,97,100,114,111,32,78,86,83,0,81,117,97,100,114,111,32,78,86,
+    83,32,119,105,116,104,32,65,71,80,56,88,0,71,56,48,0,71,101,102,
+    111,114,99,101,32,56,56,48,48,71,84,88,32,55,54,56,77,66,0,78,
+    86,73,68,73,65,32,71,101,70,111,114,99,101,32,56,56,48,48,32,71,
+    84,83,0,78,118,105,100,105,97,32,81,117,97,100,114,111,32,70,88,32,
+    53,54,48,48,0,78,118,105,100,105,97,32,81,117,97,100,114,111,32,70,
+    88,52,54,48,48,0,78,86,67,114,117,115,104,49,49,0,71,101,70,111,
+    114,99,101,50,32,73,110,116,101,103,114,97,116,101,100,32,71,114,97,112,
+    104,105,99,115,0,65,71,80,32,67,111,110,116,114,111,108,108,101,114,0,
+    110,70,111,114,99,101,32,50,50,48,0,77,101,109,111,114,121,32,67,111,
+    110,116,114,111,108,108,101,114,32,40,83,68,82,41,0,110,70,111,114,99,
+    101,32,52,50,48,0,110,70,111,114,99,101,32,50,50,48,47,50,51,48,
+    0,77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,40,
+    68,68,82,41,0,110,70,111,114,99,101,32,52,49,53,47,52,50,48,47,
+    52,51,48,0,110,70,111,114,99,101,32,50,120,48,47,52,49,53,47,52,
+    120,48,0,77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,
+    0,110,70,111,114,99,101,32,77,67,80,0,72,85,66,32,73,110,116,101,
+    114,102,97,99,101,0,79,72,67,73,32,85,83,66,32,67,111,110,116,114,
+    111,108,108,101,114,0,78,101,116,119,111,114,107,105,110,103,32,65,100,97,
+    112,116,101,114,0,110,86,73,68,73,65,32,81,117,97,100,114,111,32,78,
+    86,83,32,49,49,48,77,0,110,118,105,100,105,97,32,109,111,98,105,108,
+    101,32,103,114,97,112,104,105,99,115,0,78,86,73,68,73,65,32,81,117,
+    97,100,114,111,32,70,88,32,51,53,48,77,0,55,53,48,48,76,69,0,
+    77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,48,0,
+    77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,49,0,
+    77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,50,0,
+    77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,51,0,
+    77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,52,0,
+    77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,53,0,
+    78,86,50,48,0,71,101,70,111,114,99,101,51,0,71,101,70,111,114,99,
+    101,51,32,84,105,32,50,48,48,0,78,86,50,48,66,82,0,71,101,70,
+    111,114,99,101,51,32,84,105,32,53,48,48,0,78,86,50,48,68,67,67,
+    0,81,117,97,100,114,111,32,68,67,67,0,78,86,83,32,50,49,48,83,
+    0,110,86,105,100,105,97,32,71,70,111,114,99,101,32,54,49,53,48,44,
+    32,98,117,105,108,100,32,105,110,32,68,69,76,76,32,79,112,116,105,112,
+    108,101,120,32,55,52,48,32,40,65,77,68,32,80,114,111,99,101,115,115,
+    111,114,41,0,78,86,83,50,49,48,83,0,71,70,54,49,53,48,0,78,
+    86,50,53,0,71,101,70,111,114,99,101,52,32,84,105,32,52,54,48,48,
+    0,78,86,50,53,46,50,0,71,102,111,114,99,101,52,32,84,105,32,52,
+    52,48,48,0,78,86,73,68,73,65,32,67,111,114,112,111,114,97,116,105,
+    111,110,0,71,101,102,111,114,99,101,52,32,84,73,32,52,50,48,48,32,
+    49,50,56,32,77,111,0,78,86,50,53,71,76,46,49,0,81,117,97,100,
+    114,111,52,32,57,48,48,32,88,71,76,0,78,86,50,53,71,76,46,50,
+    0,81,117,97,100,114,111,52,32,55,53,48,32,88,71,76,0,78,86,50,
+    53,71,76,46,52,0,81,117,97,100,114,111,52,32,55,48,48,32,88,71,
+    76,0,78,86,73,68,73,65,32,83,77,66,32,66,117,115,32,67,111,110,
+    116,114,111,108,108,101,114,0,78,86,73,68,73,65,32,110,70,111,114,99,
+    101,32,80,67,73,32,83,121,115,116,101,109,32,77,97,110,97,103,101,109,
+    101,110,116,0,52,51,48,0,78,86,73,68,73,65,32,110,70,111,114,99,
+    101,32,78,101,116,119,111,114,107,105,110,103,32,67,111,110,116,114,111,108,
+    108,101,114,0,54,49,53,48,0,110,86,105,100,105,97,32,71,101,70,111,
+    114,99,101,0,78,86,50,56,46,49,0,71,101,70,111,114,99,101,52,32,
+    84,105,32,52,56,48,48,0,78,86,50,56,46,50,0,71,101,70,111,114,
+    99,101,52,32,84,105,32,52,50,48,48,32,119,105,116,104,32,65,71,80,
+    32,56,88,0,78,86,50,56,46,51,0,71,101,70,111,114,99,101,52,32,
+    84,105,32,52,56,48,48,32,83,69,0,71,101,70,111,114,99,101,52,32,
+    52,50,48,48,32,71,111,0,78,86,50,56,71,76,46,49,0,81,117,97,
+    100,114,111,52,32,57,56,48,32,88,71,76,0,78,86,50,56,71,76,46,
+    50,0,81,117,97,100,114,111,52,32,55,56,48,32,88,71,76,0,78,86,
+    50,56,71,76,0,81,117,97,100,114,111,52,32,55,48,48,32,71,111,71,
+    76,0,48,120,48,52,48,49,0,66,76,73,83,83,32,71,101,70,111,114,
+    99,101,32,55,57,48,48,32,71,84,32,98,105,111,115,0,71,55,49,0,
+    78,118,105,100,105,97,32,81,117,97,100,114,111,32,70,88,32,53,53,48,
+    48,0,81,117,97,100,114,111,32,70,88,32,51,53,48,48,0,78,86,50,
+    65,0,71,101,70,111,114,99,101,51,32,73,110,116,101,103,114,97,116,101,
+    100,32,71,80,85,0,71,101,70,111,114,99,101,32,55,54,48,48,32,71,
+    84,0,78,86,51,48,46,49,0,71,101,70,111,114,99,101,32,70,88,0,
+    78,86,51,48,46,50,0,71,101,70,111,114,99,101,32,70,88,32,53,56,
+    48,48,32,85,108,116,114,97,0,78,86,51,48,46,51,0,71,101,70,111,
+    114,99,101,32,70,88,32,53,56,48,48,0,78,86,51,48,71,76,46,49,
+    0,81,117,97,100,114,111,32,70,88,32,50,48,48,48,0,78,86,51,48,
+    71,76,46,50,0,81,117,97,100,114,111,32,70,88,32,49,48,48,48,0,
+    78,86,51,48,71,76,0,73,67,69,32,70,88,32,50,48,48,48,0,78,
+    86,51,49,46,49,0,71,101,70,111,114,99,101,32,70,88,32,53,54,48,
+    48,32,85,108,116,114,97,0,78,86,51,49,46,50,0,71,101,70,111,114,
+    99,101,32,70,88,32,53,54,48,48,0,78,86,51,49,63,0,78,86,51,
+    49,0,71,101,70,111,114,99,101,32,70,88,32,53,54,48,48,88,84,0,
+    78,86,51,49,71,76,46,49,0,78,86,51,49,71,76,46,50,0,78,86,
+    51,49,71,76,0,78,86,73,68,73,65,32,78,86,51,49,71,76,0,78,
+    86,51,49,66,0,78,86,73,68,73,65,32,71,101,70,111,114,99,101,32,
+    70,88,32,71,111,53,54,48,48,0,78,86,51,49,67,0,78,86,73,68,
+    73,65,32,81,117,97,100,114,111,32,70,88,32,71,111,55,48,48,0,78,
+    86,51,52,46,50,0,71,101,70,111,114,99,101,32,70,88,32,53,50,48,
+    48,32,85,108,116,114,97,0,78,86,51,52,46,51,0,71,101,70,111,114,
+    99,101,32,70,88,32,53,50,48,48,0,78,86,51,52,46,52,0,71,101,
+    70,111,114,99,101,32,70,88,32,53,50,48,48,76,69,0,110,86,105,100,
+    105,97,32,71,101,70,111,114,99,101,32,70,88,32,71,111,32,53,50,48,
+    48,44,32,54,52,77,66,0,110,118,51,54,109,0,71,101,70,111,114,99,
+    101,32,70,88,32,71,111,32,53,55,48,48,0,78,86,51,52,46,54,0,
+    71,101,70,111,114,99,101,32,70,88,32,53,53,48,48,0,78,86,51,52,
+    46,55,0,71,101,70,111,114,99,101,32,70,88,32,53,49,48,48,0,78,
+    86,51,52,71,76,0,78,118,105,100,105,97,32,78,86,51,52,71,76,0,
+    71,55,51,0,71,101,102,111,114,99,101,32,55,54,48,48,71,83,0,78,
+    86,51,52,71,76,46,51,0,81,117,97,100,114,111,32,78,86,83,32,50,
+    56,48,0,78,86,51,52,71,76,46,52,0,81,117,97,100,114,111,32,70,
+    88,32,53,48,48,0,78,86,73,68,73,65,32,78,86,51,52,71,76,0,
+    78,86,51,52,77,0,71,101,70,111,114,99,101,32,70,88,32,71,111,53,
+    49,48,48,0,71,101,70,111,114,99,101,32,70,88,32,53,57,48,48,32,
+    85,108,116,114,97,0,71,101,70,111,114,99,101,32,70,88,32,53,57,48,
+    48,0,71,101,70,111,114,99,101,32,70,88,32,53,57,48,48,88,84,0,
+    78,86,51,56,0,71,101,70,111,114,99,101,32,70,88,32,53,57,53,48,
+    32,85,108,116,114,97,0,78,86,51,53,46,52,0,71,101,70,111,114,99,
+    101,32,70,88,32,53,57,48,48,90,84,0,78,86,51,53,71,76,0,81,
+    117,97,100,114,111,32,70,88,32,51,48,48,48,0,78,86,51,54,46,49,
+    0,71,101,70,111,114,99,101,32,70,88,32,53,55,48,48,32,85,108,116,
+    114,97,0,78,86,51,54,46,50,0,78,86,51,54,46,51,0,71,101,70,
+    111,114,99,101,32,70,88,32,53,55,48,48,76,69,0,78,86,51,54,46,
+    52,0,71,101,70,111,114,99,101,32,70,88,32,53,55,48,48,86,69,0,
+    78,86,51,54,46,53,0,78,86,51,54,77,0,71,101,70,111,114,99,101,
+    32,70,88,32,71,111,53,54,48,48,0,110,118,51,54,71,76,0,81,117,
+    97,100,114,111,32,70,88,32,49,49,48,48,0,78,86,51,54,71,76,63,
+    0,65,68,73,32,49,57,56,56,66,0,56,32,67,104,97,110,110,101,108,
+    32,72,105,103,104,32,68,101,102,105,110,105,116,105,111,110,32,65,117,100,
+    105,111,0,51,49,98,55,98,102,98,57,0,110,70,111,114,99,101,32,52,
+    51,48,0,80,67,73,32,115,116,97,110,100,97,114,100,32,73,83,65,32,
+    98,114,105,100,103,101,0,77,67,80,54,49,0,72,105,103,104,32,68,101,
+    102,105,110,105,116,105,111,110,32,65,117,100,105,111,0,78,86,73,68,73,
+    65,32,71,101,70,111,114,99,101,32,56,54,48,48,77,32,71,84,0,71,
+    56,54,0,71,101,70,111,114,99,101,32,56,53,48,48,32,71,84,0,71,
+    101,102,111,114,99,101,32,56,54,48,48,0,110,86,105,100,105,97,32,81,
+    117,97,100,114,111,32,70,88,32,53,55,48,77,0,56,52,48,48,32,63,
+    63,0,78,86,73,68,73,65,32,81,117,97,100,114,111,32,78,86,83,32,
+    49,51,53,77,0,76,105,103,104,116,32,80,117,108,115,101,0,76,80,54,
+    48,48,48,0,80,76,49,48,53,48,69,120,0,69,109,117,108,101,120,32,
+    49,48,53,48,69,88,32,70,67,32,72,66,65,32,45,32,50,71,66,32,
+    80,67,73,45,69,88,80,82,69,83,83,0,76,80,55,48,48,48,0,76,
+    80,56,48,48,48,0,63,63,63,63,0,76,105,103,104,116,32,80,117,108,
+    115,101,32,76,80,57,48,48,50,32,50,71,98,0,76,80,57,56,48,50,
+    32,47,32,68,67,0,76,80,57,56,48,50,32,38,97,109,112,59,32,76,
+    80,57,56,48,50,68,67,32,72,66,65,32,97,100,97,112,116,101,114,0,
+    76,80,49,48,48,48,48,0,76,50,65,50,56,54,48,32,72,69,76,73,
+    79,83,32,118,49,46,49,49,0,69,109,117,108,101,120,32,76,80,49,49,
+    48,48,50,0,76,80,101,49,49,48,48,50,45,77,52,0,68,117,97,108,
+    32,67,104,97,110,110,101,108,32,52,71,98,47,115,0,84,82,77,45,83,
+    49,48,52,48,0,68,67,45,54,57,48,99,0,68,67,45,50,57,48,0,
+    67,65,57,49,67,48,52,50,47,49,52,50,0,85,110,105,118,101,114,115,
+    101,47,73,73,32,86,77,69,98,117,115,32,66,114,105,100,103,101,0,84,
+    117,110,100,114,97,32,84,115,105,49,52,56,0,80,67,73,47,88,45,116,
+    111,45,86,77,69,32,66,114,105,100,103,101,0,84,115,105,51,50,48,0,
+    68,117,97,108,45,77,111,100,101,32,80,67,73,45,116,111,45,80,67,73,
+    32,66,117,115,32,66,114,105,100,103,101,0,84,115,105,56,53,48,0,80,
+    111,119,101,114,32,80,67,32,68,117,97,108,32,80,67,73,32,72,111,115,
+    116,32,66,114,105,100,103,101,0,80,111,119,101,114,32,80,67,32,83,105,
+    110,103,108,101,32,80,67,73,32,72,111,115,116,32,66,114,105,100,103,101,
+    0,67,65,57,49,67,56,54,48,0,81,83,112,97,110,32,77,111,116,111,
+    114,111,108,97,32,80,114,111,99,101,115,115,111,114,32,66,114,105,100,103,
+    101,0,67,65,57,49,76,56,54,50,65,0,81,83,112,97,110,32,73,73,
+    32,80,67,73,45,116,111,45,77,111,116,111,114,111,108,97,32,67,80,85,
+    32,66,114,105,100,103,101,0,67,65,57,49,76,56,50,48,48,47,56,50,
+    54,48,0,80,111,119,101,114,83,112,97,110,32,73,73,32,80,111,119,101,
+    114,80,67,45,116,111,45,80,67,73,32,66,117,115,32,83,119,105,116,99,
+    104,0,81,45,77,111,116,105,111,110,32,112,99,105,32,50,54,52,0,86,
+    105,100,101,111,32,67,97,112,116,117,114,101,47,69,100,105,116,32,98,111,
+    97,114,100,0,83,53,57,50,48,81,0,97,109,99,99,32,80,67,73,32,
+    77,97,116,99,104,77,97,107,101,114,0,83,53,57,50,48,113,0,66,66,
+    75,45,80,67,73,32,108,105,103,104,116,0,84,114,97,110,115,112,117,116,
+    101,114,32,76,105,110,107,32,73,110,116,101,114,102,97,99,101,0,76,65,
+    78,97,105,52,46,120,0,77,121,114,105,110,101,116,32,76,65,78,97,105,
+    32,105,110,116,101,114,102,97,99,101,32,99,104,105,112,0,83,53,57,51,
+    51,0,80,97,114,97,115,116,97,116,105,111,110,0,80,67,73,52,52,0,
+    70,83,0,75,105,110,103,115,98,101,114,103,32,83,112,97,99,101,116,101,
+    99,32,70,111,114,109,97,116,32,83,121,110,99,104,114,111,110,105,122,101,
+    114,0,83,79,66,0,75,105,110,103,115,98,101,114,103,32,83,112,97,99,
+    101,116,101,99,32,83,101,114,105,97,108,32,79,117,116,112,117,116,32,66,
+    111,97,114,100,0,84,114,97,113,117,97,105,114,32,72,69,80,67,51,0,
+    68,97,116,97,32,70,105,114,101,32,66,97,115,105,99,32,52,77,66,32,
+    80,67,73,0,65,99,116,105,118,101,32,73,83,68,78,32,67,111,110,116,
+    114,111,108,108,101,114,0,80,67,73,45,57,49,49,50,0,68,97,116,97,
+    32,65,99,113,117,105,115,105,116,105,111,110,32,67,97,114,100,32,40,65,
+    68,76,73,78,75,41,0,80,67,73,45,55,50,48,48,0,52,48,77,66,
+    47,115,32,51,50,45,99,104,97,110,110,101,108,115,32,68,105,103,105,116,
+    97,108,32,73,47,79,32,99,97,114,100,32,40,65,68,76,73,78,75,41,
+    0,80,67,73,45,57,49,49,56,0,80,67,73,45,68,83,108,105,110,107,
+    0,80,67,73,45,73,69,69,69,49,51,53,53,45,68,83,45,68,69,32,
+    105,110,116,101,114,102,97,99,101,0,77,97,116,99,104,109,97,107,101,114,
+    32,80,67,73,32,67,104,105,112,115,101,116,32,68,101,118,101,108,111,112,
+    109,101,110,116,32,84,111,111,108,0,73,71,65,45,49,54,56,48,0,115,
+    118,103,97,0,73,71,65,45,49,54,56,50,0,118,105,100,101,111,0,73,
+    71,65,45,49,54,56,51,0,67,121,98,101,114,80,114,111,32,50,48,49,
+    48,0,84,86,32,111,117,116,112,117,116,32,114,97,109,32,50,77,66,32,
+    32,67,121,98,101,114,112,114,111,50,48,49,48,0,67,121,98,101,114,80,
+    114,111,32,50,48,120,120,47,50,48,48,48,65,0,118,98,99,118,98,99,
+    118,98,99,118,98,0,67,121,98,101,114,80,114,111,32,53,48,48,48,0,
+    67,121,98,101,114,80,114,111,32,53,48,53,48,0,51,71,65,0,54,52,
+    32,98,105,116,32,103,114,97,112,104,105,99,115,32,112,114,111,99,101,115,
+    115,111,114,0,84,119,105,115,116,51,0,70,114,97,109,101,32,71,114,97,
+    98,98,101,114,0,114,116,108,56,49,51,57,66,0,101,116,104,101,114,110,
+    101,116,32,49,48,47,49,48,48,0,82,84,76,50,54,48,0,68,114,105,
+    118,101,114,32,77,83,32,85,65,65,32,102,111,114,32,72,68,32,65,117,
+    100,105,111,0,65,76,67,56,56,50,0,82,101,97,108,116,101,107,32,72,
+    105,103,104,32,68,101,102,105,110,105,116,105,111,110,32,65,117,100,105,111,
+    0,97,108,56,56,48,0,82,69,65,76,84,69,75,32,65,76,67,56,56,
+    48,0,97,108,99,56,56,51,0,65,76,67,56,56,53,0,55,46,49,43,
+    50,32,67,104,97,110,110,101,108,32,72,105,103,104,45,80,101,114,102,111,
+    114,109,97,110,99,101,32,72,68,65,32,67,111,100,101,99,32,119,105,116,
+    104,32,67,111,110,116,101,110,116,32,80,114,111,116,101,99,116,105,111,110,
+    0,114,101,97,108,116,101,107,32,104,105,103,104,32,100,101,102,105,110,105,
+    116,105,111,110,32,97,117,100,105,111,0,112,97,118,105,108,108,105,111,110,
+    32,97,54,48,51,48,110,0,82,84,76,56,48,50,57,65,83,0,78,73,
+    67,0,82,84,76,56,48,50,57,40,97,115,41,112,99,105,32,101,116,104,
+    101,114,110,101,116,32,110,105,99,0,119,105,110,100,111,116,32,88,80,115,
+    101,0,56,49,48,49,76,0,49,48,47,49,48,48,32,69,116,104,101,114,
+    110,101,116,0,49,48,0,51,50,66,73,84,32,67,97,114,100,32,66,117,
+    115,32,49,48,47,49,48,48,32,40,49,48,69,67,45,56,49,49,57,41,
+    0,82,84,76,56,49,50,57,0,49,48,47,49,48,48,32,70,97,115,116,
+    32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,
+    0,76,70,69,56,49,51,57,65,84,88,0,82,84,56,49,51,57,66,47,
+    67,0,67,97,114,100,66,117,115,32,70,97,115,116,32,69,116,104,101,114,
+    110,101,116,32,65,100,97,112,116,101,114,0,82,84,76,45,56,49,51,57,
+    47,56,49,51,57,67,47,56,49,51,57,67,43,0,49,48,47,49,48,48,
+    32,77,98,112,115,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,
+    78,73,67,0,80,67,73,32,71,105,103,97,98,105,116,32,69,116,104,101,
+    114,110,101,116,0,82,84,76,56,49,49,49,66,0,71,105,103,97,98,105,
+    116,32,69,116,104,101,114,110,101,116,32,76,79,77,0,82,84,76,56,49,
+    49,48,83,66,0,83,105,110,103,108,101,45,67,104,105,112,32,71,105,103,
+    97,98,105,116,32,76,79,77,32,69,116,104,101,114,110,101,116,32,67,111,
+    110,116,114,111,108,108,101,114,0,82,84,76,56,49,56,48,0,82,101,97,
+    108,116,101,107,32,82,84,76,56,49,56,48,32,87,105,114,101,108,101,115,
+    115,32,76,65,78,32,40,77,105,110,105,45,41,80,67,73,32,78,73,67,
+    0,86,55,51,49,48,0,86,71,65,32,86,105,100,101,111,32,79,118,101,
+    114,108,97,121,32,65,100,97,112,116,101,114,0,83,112,97,114,116,97,110,
+    32,88,67,50,83,53,48,69,0,56,51,52,51,49,55,54,0,80,67,73,
+    32,116,111,32,72,46,49,48,48,32,97,117,100,105,111,32,105,110,116,101,
+    114,102,97,99,101,0,82,77,69,32,68,105,103,105,57,54,0,82,77,69,
+    32,68,105,103,105,57,54,47,56,0,82,77,69,32,68,105,103,105,32,57,
+    54,47,56,32,80,114,111,0,82,77,69,32,68,105,103,105,57,54,47,56,
+    32,80,97,100,0,68,105,103,105,57,54,53,50,0,72,97,109,109,101,114,
+    102,97,108,108,0,48,0,83,101,97,109,111,110,116,32,83,67,49,48,48,
+    0,83,101,99,117,114,105,116,121,32,65,100,97,112,116,101,114,0,68,117,
+    114,97,110,103,111,32,80,77,67,0,86,105,114,116,101,120,45,73,73,32,
+    66,114,105,100,103,101,44,32,88,67,50,86,49,48,48,48,45,52,70,71,
+    52,53,54,67,0,83,97,110,116,111,115,0,77,56,49,53,120,0,84,111,
+    107,101,110,32,82,105,110,103,32,65,100,97,112,116,101,114,0,86,67,76,
+    45,80,0,71,114,97,112,104,105,99,115,32,98,111,97,114,100,0,86,67,
+    76,45,77,0,103,114,97,112,104,105,99,115,32,98,111,97,114,100,0,73,
+    68,69,47,83,67,83,73,0,77,117,108,116,105,109,101,100,105,97,0,82,
+    83,45,53,54,32,115,112,45,112,99,105,0,67,111,110,101,120,97,110,116,
+    32,82,83,45,53,54,32,80,67,73,32,77,111,100,101,109,0,114,101,118,
+    49,46,49,0,80,67,73,32,116,111,32,83,53,85,49,51,120,48,54,66,
+    48,66,32,66,114,105,100,103,101,32,65,100,97,112,116,101,114,0,78,68,
+    82,52,48,48,48,0,78,82,52,54,48,48,32,66,114,105,100,103,101,0,
+    67,77,73,56,55,51,56,47,67,51,68,88,32,77,117,108,116,105,109,101,
+    100,105,97,32,65,117,100,105,111,32,67,111,110,116,114,111,108,108,101,114,
+    0,66,84,56,52,56,75,80,70,0,84,97,114,103,97,32,49,48,48,48,
+    0,86,105,100,101,111,32,67,97,112,116,117,114,101,32,38,97,109,112,59,
+    32,69,100,105,116,105,110,103,32,99,97,114,100,0,84,72,54,50,53,53,
+    0,52,48,50,48,48,49,49,66,0,86,84,54,51,48,54,76,0,73,69,
+    69,69,49,51,57,52,32,70,105,114,101,119,105,114,101,32,51,32,80,111,
+    114,116,32,80,67,73,32,67,97,114,100,0,73,78,73,45,57,50,48,0,
+    85,108,116,114,97,32,83,67,83,73,32,65,100,97,112,116,101,114,0,73,
+    78,73,45,65,49,48,48,85,50,87,0,79,114,99,104,105,100,32,85,108,
+    116,114,97,45,50,32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,
+    114,0,73,78,73,45,57,48,49,48,47,57,48,49,48,87,0,73,78,73,
+    67,45,57,52,48,0,73,78,73,67,45,57,51,53,0,73,78,73,67,45,
+    57,53,48,0,73,78,73,67,45,57,53,48,80,0,85,108,116,114,97,119,
+    105,100,101,32,83,67,83,73,32,99,111,110,116,114,111,108,108,101,114,0,
+    70,97,115,116,32,87,105,100,101,32,83,67,83,73,0,116,52,55,56,48,
+    48,49,48,48,48,52,53,52,49,0,83,111,117,110,100,32,66,108,97,115,
+    116,101,114,32,76,105,118,101,33,32,40,65,108,115,111,32,76,105,118,101,
+    33,32,53,46,49,41,32,45,32,79,69,77,32,102,114,111,109,32,68,69,
+    76,76,32,45,32,67,84,52,55,56,48,0,69,77,85,56,48,48,56,0,
+    65,87,69,54,52,68,32,79,69,77,32,40,67,84,52,54,48,48,41,0,
+    67,114,101,97,116,105,118,101,32,83,66,32,65,117,100,105,103,121,32,50,
+    32,90,83,32,40,87,68,77,41,0,65,117,100,105,103,121,32,65,117,100,
+    105,111,32,80,114,111,99,101,115,115,111,114,0,83,66,48,52,54,48,0,
+    83,111,117,110,100,66,108,97,115,116,101,114,32,88,45,70,73,32,88,116,
+    114,101,109,101,77,117,115,105,99,0,101,109,117,49,48,107,49,120,0,83,
+    111,117,110,100,98,108,97,115,116,101,114,32,76,105,118,101,33,32,53,46,
+    49,0,67,54,83,66,48,52,49,48,53,49,53,48,49,55,54,53,54,65,
+    0,65,117,100,105,103,121,32,83,69,0,99,97,48,49,48,56,0,115,111,
+    117,110,100,32,98,108,97,115,116,101,114,32,65,117,100,105,103,121,32,50,
+    0,67,84,54,55,54,48,0,51,68,32,66,108,97,115,116,101,114,32,66,
+    97,110,115,104,101,101,32,80,67,73,32,67,84,54,55,54,48,0,51,68,
+    32,66,108,97,115,116,101,114,32,82,73,86,65,32,84,78,84,50,0,51,
+    68,32,66,108,97,115,116,101,114,32,65,110,110,105,104,105,108,97,116,111,
+    114,32,50,0,69,83,49,51,55,49,45,51,0,69,83,49,51,55,49,44,
+    32,69,83,49,51,55,51,32,65,117,100,105,111,80,67,73,0,101,115,50,
+    56,57,56,0,101,115,53,54,116,45,112,49,0,69,77,85,49,48,75,49,
+    0,65,117,100,105,103,121,32,73,69,69,69,49,51,57,52,97,32,70,105,
+    114,101,119,105,114,101,32,67,111,110,116,114,111,108,108,101,114,0,69,77,
+    85,49,48,48,48,48,0,71,97,109,101,32,80,111,114,116,0,69,77,85,
+    49,48,75,50,0,67,114,101,97,116,105,118,101,32,76,97,98,115,32,83,
+    66,32,65,117,100,105,103,121,32,77,73,68,73,47,71,97,109,101,32,112,
+    111,114,116,0,63,63,63,63,63,63,63,0,71,97,109,101,32,112,111,114,
+    116,32,102,111,114,32,83,66,32,76,105,118,101,33,32,83,101,114,105,101,
+    115,0,65,117,100,105,103,121,32,76,83,32,83,101,114,105,101,115,32,71,
+    97,109,101,32,80,111,114,116,0,69,77,85,49,79,75,49,45,78,71,70,
+    0,69,110,118,105,114,111,110,109,101,110,116,97,108,32,65,117,100,105,111,
+    32,40,83,66,32,32,76,105,118,101,41,0,69,86,49,57,51,56,0,83,
+    111,117,110,100,0,72,80,84,45,51,55,48,0,73,68,69,45,67,111,110,
+    116,114,111,108,108,101,114,0,72,80,84,45,51,55,50,0,72,80,84,45,
+    51,55,52,0,69,77,56,52,48,48,0,69,77,56,52,55,53,0,77,80,
+    69,71,45,52,32,68,101,99,111,100,101,114,0,86,84,54,51,48,53,0,
+    86,73,65,32,70,105,114,101,32,49,51,57,52,46,65,32,79,72,67,73,
+    32,76,105,110,107,32,76,97,121,101,114,32,67,116,114,108,114,0,75,56,
+    77,52,48,48,32,99,104,105,112,115,101,116,0,67,80,85,32,116,111,32,
+    80,67,73,0,75,56,84,56,57,48,0,75,84,56,56,48,0,75,56,84,
+    56,56,48,80,114,111,0,86,84,56,51,54,51,65,47,56,51,54,53,0,
+    86,84,56,51,54,51,47,55,49,0,86,84,56,53,48,49,0,56,50,67,
+    53,48,53,0,86,76,66,32,116,111,32,80,67,73,32,66,114,105,100,103,
+    101,0,56,50,67,53,55,48,32,77,86,0,86,84,56,50,67,53,56,54,
+    65,47,66,47,86,84,56,50,67,54,56,54,47,65,47,66,47,86,84,56,
+    50,51,120,47,65,47,67,0,56,50,67,53,55,54,0,80,53,52,32,67,
+    116,114,108,114,0,86,84,56,50,67,53,56,53,86,80,47,86,80,88,0,
+    72,111,115,116,32,66,117,115,45,80,67,73,32,66,114,105,100,103,101,0,
+    86,84,56,50,67,53,56,54,86,80,0,86,84,56,50,51,55,65,0,86,
+    73,65,32,86,84,56,50,51,55,65,32,83,65,84,65,32,82,65,73,68,
+    32,67,111,110,116,114,111,108,108,101,114,0,86,84,56,50,67,53,57,53,
+    0,65,112,111,108,108,111,32,86,80,50,32,80,67,73,32,78,111,114,116,
+    104,32,66,114,105,100,103,101,0,86,84,56,50,67,53,57,54,0,80,67,
+    73,32,73,83,65,32,66,114,105,100,103,101,0,86,84,56,50,67,53,57,
+    55,0,72,111,115,116,32,66,114,105,100,103,101,32,40,65,112,111,108,108,
+    111,32,86,80,51,41,0,86,84,56,50,67,53,57,56,0,86,73,65,56,
+    54,48,49,0,86,84,56,50,99,54,56,54,0,80,77,49,51,51,32,83,
+    121,115,116,101,109,32,67,111,110,116,114,111,108,0,86,84,56,50,67,54,
+    56,48,0,65,112,111,108,108,111,32,80,54,0,86,84,56,50,67,54,56,
+    54,47,54,56,54,65,47,54,56,54,66,0,80,67,73,45,116,111,45,73,
+    83,65,32,98,114,105,100,103,101,0,86,73,65,32,86,84,32,75,78,49,
+    51,51,0,77,97,105,110,98,111,97,114,100,0,86,84,56,50,67,54,57,
+    51,0,86,84,56,54,67,57,50,54,0,65,109,97,122,111,110,32,80,67,
+    73,32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,
+    114,0,56,50,67,53,55,48,77,86,0,48,54,48,48,48,48,0,73,83,
+    65,32,66,114,105,100,103,101,32,119,47,73,68,69,0,86,84,56,50,67,
+    52,49,54,0,86,84,56,50,67,53,57,53,47,57,55,0,48,120,49,55,
+    48,56,0,86,69,78,95,49,49,48,54,38,97,109,112,59,68,69,86,95,
+    49,55,48,56,0,86,84,54,49,48,53,77,0,86,73,65,32,82,104,105,
+    110,101,32,73,73,73,32,86,84,54,49,48,53,77,32,70,97,115,116,32,
+    69,116,104,101,114,110,101,116,32,99,111,110,116,114,111,108,108,101,114,0,
+    86,84,56,51,67,53,55,50,44,32,86,84,54,50,48,50,0,86,73,65,
+    32,82,101,118,32,53,32,111,114,32,108,97,116,101,114,32,85,83,66,32,
+    85,110,105,118,101,114,115,97,108,32,72,111,115,116,32,67,111,110,116,114,
+    111,108,108,101,114,0,32,56,50,67,53,57,55,0,117,115,98,0,86,84,
+    56,54,67,49,48,48,65,0,82,104,105,110,101,32,49,48,47,49,48,48,
+    32,69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,114,0,86,84,
+    56,51,55,53,0,86,73,65,32,70,105,114,101,32,73,73,32,49,51,57,
+    52,97,32,79,72,67,73,32,76,105,110,107,32,76,97,121,101,114,32,67,
+    116,114,108,114,49,0,86,84,56,50,67,53,57,54,47,53,57,54,65,47,
+    53,57,54,0,80,111,119,101,114,32,77,97,110,97,103,101,109,101,110,116,
+    32,97,110,100,32,83,77,66,117,115,32,67,111,110,116,114,111,108,108,101,
+    114,0,82,104,105,110,101,32,73,73,73,32,77,97,110,97,103,101,109,101,
+    110,116,32,65,100,97,112,116,101,114,0,86,84,56,50,67,54,56,54,65,
+    0,65,67,80,73,32,80,111,119,101,114,32,77,97,110,97,103,101,109,101,
+    110,116,32,67,111,110,116,114,111,108,108,101,114,0,86,84,56,50,51,55,
+    0,65,67,57,55,32,65,117,100,105,111,32,67,111,100,101,99,32,40,65,
+    108,108,32,86,73,65,32,67,104,105,112,115,101,116,115,41,0,65,67,57,
+    55,32,69,110,104,97,110,99,101,100,32,65,117,100,105,111,32,67,111,110,
+    116,114,111,108,108,101,114,32,45,32,116,104,101,32,56,50,53,49,32,99,
+    111,110,116,114,111,108,108,101,114,32,105,115,32,100,105,102,102,101,114,101,
+    110,116,0,86,84,54,49,48,50,0,82,104,105,110,101,32,73,73,32,80,
+    67,73,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,111,110,
+    116,114,111,108,108,101,114,124,124,85,115,101,100,32,98,121,32,71,69,82,
+    73,67,79,77,32,105,110,32,108,97,112,116,111,112,32,87,101,98,101,110,
+    103,105,110,101,32,65,100,118,97,110,99,101,100,0,86,84,56,50,67,54,
+    56,54,0,69,67,83,32,72,83,80,53,54,32,86,73,65,32,65,67,57,
+    55,32,77,111,100,101,109,32,114,105,115,101,114,0,86,84,56,50,51,51,
+    0,80,111,119,101,114,0,86,84,56,54,51,51,0,86,84,56,51,54,54,
+    47,54,54,65,47,54,55,0,86,84,56,54,53,51,0,86,84,56,51,54,
+    50,0,86,84,56,54,49,53,0,86,84,54,50,48,50,0,86,84,54,49,
+    48,53,77,47,76,79,77,0,82,104,105,110,101,32,73,73,73,32,80,67,
+    73,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,
+    114,111,108,108,101,114,0,86,84,56,50,51,51,47,65,32,65,67,57,55,
+    39,32,69,110,104,97,110,99,101,32,65,117,100,105,111,32,67,111,110,116,
+    114,111,108,108,101,114,0,86,105,97,32,85,110,105,99,104,114,111,109,101,
+    32,83,51,32,86,71,65,32,45,32,112,97,114,116,32,111,102,32,97,32,
+    86,73,65,32,78,111,114,116,104,98,114,105,100,103,101,0,86,84,56,51,
+    54,49,0,67,80,85,45,116,111,45,80,67,73,32,66,114,105,100,103,101,
+    0,51,49,49,56,49,49,48,54,0,86,105,97,32,66,117,105,108,116,45,
+    73,110,32,86,71,65,0,86,84,54,49,50,48,47,86,84,54,49,50,49,
+    47,86,84,54,49,50,50,0,39,86,101,108,111,99,105,116,121,39,32,71,
+    105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,
+    114,111,108,108,101,114,115,0,86,84,56,54,50,51,0,67,97,115,116,108,
+    101,82,111,99,107,32,65,71,80,32,56,88,32,67,111,110,116,114,111,108,
+    108,101,114,0,118,116,56,55,53,51,0,86,84,51,49,51,51,0,86,84,
+    56,55,53,49,0,86,84,56,50,51,55,32,32,86,84,54,52,49,48,0,
+    83,65,84,65,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,
+    0,86,84,56,51,55,50,0,86,84,54,52,49,48,0,86,73,65,32,86,
+    84,54,52,49,48,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,
+    114,0,86,84,56,51,55,52,0,80,52,88,52,48,48,32,72,111,115,116,
+    32,67,111,110,116,114,111,108,108,101,114,47,65,71,80,32,66,114,105,100,
+    103,101,0,86,84,56,50,51,53,0,75,56,72,84,66,45,56,50,51,55,
+    0,86,84,56,51,55,55,0,49,51,57,52,32,105,50,99,0,80,84,56,
+    57,48,0,75,56,78,56,57,48,67,69,32,68,105,115,112,108,97,121,32,
+    68,114,105,118,101,114,0,73,110,116,101,103,114,97,116,101,100,32,71,114,
+    97,112,104,105,99,115,0,86,84,54,52,50,49,0,86,73,65,32,86,84,
+    54,52,50,49,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,
+    0,80,84,56,56,48,0,86,73,65,32,86,84,56,50,53,49,47,56,50,
+    51,55,65,32,72,105,103,104,32,68,101,102,105,110,105,116,105,111,110,32,
+    65,117,100,105,111,32,67,111,110,116,114,111,108,108,101,114,32,45,32,72,
+    68,65,32,67,111,100,101,99,32,82,101,97,108,116,101,107,32,65,76,67,
+    54,54,48,0,56,49,67,69,49,48,52,51,0,80,52,77,56,48,48,80,
+    82,79,38,97,109,112,59,56,50,51,55,82,0,86,73,65,47,83,51,71,
+    32,85,110,105,67,104,114,111,109,101,32,80,114,111,32,73,71,80,0,86,
+    84,56,50,53,49,0,86,73,65,32,86,84,56,50,53,49,32,65,72,67,
+    73,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,0,65,84,
+    65,47,65,84,65,80,73,32,72,111,115,116,32,67,111,110,116,114,111,108,
+    108,101,114,0,86,73,65,32,86,84,56,54,67,49,48,48,65,0,82,104,
+    105,110,101,32,73,73,32,80,67,73,32,70,97,115,116,32,83,65,84,65,
+    32,97,110,100,32,101,116,104,101,114,110,101,116,32,99,111,110,116,114,111,
+    108,108,101,114,0,75,56,77,52,48,48,0,75,77,52,48,48,0,86,73,
+    65,32,84,101,99,104,110,111,108,111,103,105,101,115,44,32,73,110,99,46,
+    32,86,84,56,51,55,56,32,91,83,51,32,85,110,105,67,104,114,111,109,
+    101,93,32,71,114,97,112,104,105,99,115,32,65,100,97,112,116,101,114,0,
+    80,77,56,56,48,0,80,84,56,57,48,63,0,86,84,56,50,51,49,0,
+    86,84,56,51,54,51,65,47,54,53,0,80,67,73,45,116,111,45,80,67,
+    73,32,66,114,105,100,103,101,32,40,65,71,80,41,0,86,84,56,50,67,
+    54,48,49,0,67,80,85,32,116,111,32,65,71,80,32,66,114,105,100,103,
+    101,0,86,84,56,54,48,53,0,80,67,73,45,116,111,45,80,67,73,32,
+    66,114,105,100,103,101,40,65,71,80,41,0,86,84,56,50,67,54,57,49,
+    47,54,57,51,65,47,54,57,52,88,0,73,47,79,32,65,80,73,67,0,
+    86,84,56,54,48,49,0,50,68,47,51,68,32,71,114,97,112,104,105,99,
+    115,32,65,99,99,101,108,101,114,97,116,111,114,0,86,84,56,51,54,54,
+    47,65,0,86,84,56,51,54,51,47,54,53,0,67,80,85,32,116,111,32,
+    65,71,80,32,67,111,110,116,114,111,108,108,101,114,0,118,116,54,56,54,
+    98,0,86,84,56,55,53,49,32,65,112,111,108,108,111,0,80,67,73,45,
+    116,111,45,80,67,73,32,66,114,105,100,103,101,32,40,65,71,80,32,50,
+    46,48,47,51,46,48,41,0,53,52,54,53,52,54,0,80,67,73,32,72,
+    111,115,116,32,66,114,105,100,103,101,0,112,49,54,57,48,112,108,117,115,
+    45,65,65,0,112,49,54,57,48,112,108,117,115,45,65,66,0,50,45,80,
+    111,114,116,32,84,111,107,101,110,32,82,105,110,103,32,65,100,97,112,116,
+    101,114,0,80,49,54,57,48,80,108,117,115,0,69,77,49,49,48,84,88,
+    0,69,88,49,49,48,84,88,32,80,67,73,32,70,97,115,116,32,69,116,
+    104,101,114,110,101,116,32,65,100,97,112,116,101,114,0,80,69,66,32,50,
+    48,51,50,49,0,77,117,108,116,105,99,104,97,110,110,101,108,32,78,101,
+    116,119,111,114,107,32,73,110,116,101,114,102,97,99,101,32,67,111,110,116,
+    114,111,108,108,101,114,32,102,111,114,32,72,68,76,67,0,80,69,66,32,
+    50,48,53,51,52,0,68,77,65,32,115,117,112,112,111,114,116,101,100,32,
+    115,101,114,105,97,108,32,99,111,109,109,117,110,105,99,97,116,105,111,110,
+    32,99,111,110,116,114,111,108,108,101,114,32,119,105,116,104,32,52,32,99,
+    104,97,110,110,101,108,115,0,48,49,0,80,82,79,70,73,66,85,83,32,
+    67,111,109,109,117,110,105,99,97,116,105,111,110,32,80,114,111,99,101,115,
+    115,111,114,32,67,80,53,54,49,49,32,65,50,0,77,112,97,99,116,0,
+    77,101,100,105,97,32,80,114,111,99,101,115,115,111,114,0,71,77,57,48,
+    67,55,49,49,48,86,88,0,77,80,65,67,84,32,68,86,68,32,100,101,
+    99,111,100,101,114,46,0,50,50,48,48,0,70,68,68,73,32,97,100,97,
+    112,116,101,114,0,50,51,48,48,0,70,97,115,116,32,69,116,104,101,114,
+    110,101,116,32,97,100,97,112,116,101,114,0,50,51,52,48,0,52,32,80,
+    111,114,116,32,49,48,47,49,48,48,32,85,84,80,32,70,97,115,116,32,
+    69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,114,0,50,52,48,
+    48,0,109,112,120,32,101,110,53,48,51,56,97,49,0,48,53,51,55,57,
+    81,49,32,48,50,51,70,0,69,78,53,50,53,49,66,69,0,97,99,99,
+    116,111,110,32,32,69,78,53,50,53,49,66,69,0,69,78,45,50,50,52,
+    50,0,69,78,45,49,54,54,48,0,69,78,45,49,50,48,55,68,0,83,
+    77,67,32,101,110,53,50,53,49,98,101,0,48,50,53,48,116,97,98,103,
+    118,50,55,48,54,53,46,49,0,69,116,104,101,114,110,101,116,32,67,111,
+    110,116,114,111,108,108,101,114,47,32,100,114,105,118,101,114,115,0,65,84,
+    55,54,67,53,48,54,0,56,48,50,46,49,49,98,32,87,105,114,101,108,
+    101,115,115,32,78,101,116,119,111,114,107,32,65,100,97,112,116,111,114,0,
+    65,84,57,55,83,67,51,50,48,50,0,84,80,77,32,45,32,84,114,117,
+    115,116,101,100,32,80,108,97,116,102,111,114,109,32,77,111,100,117,108,101,
+    0,68,84,51,48,48,49,0,68,84,51,48,48,50,0,68,84,51,48,48,
+    51,0,68,84,51,48,48,52,0,68,116,51,48,48,53,0,68,84,51,48,
+    48,49,45,80,71,76,0,68,84,51,48,48,51,45,80,71,76,0,109,97,
+    120,45,108,99,32,83,86,71,65,32,99,97,114,100,0,77,97,120,80,67,
+    73,32,105,109,97,103,101,32,112,114,111,99,101,115,115,105,110,103,32,98,
+    111,97,114,100,0,71,68,84,54,48,48,48,47,54,48,50,48,47,54,48,
+    53,48,0,80,67,73,32,83,67,83,73,32,82,65,73,68,32,67,111,110,
+    116,114,111,108,108,101,114,0,71,68,84,54,48,48,48,47,54,48,49,48,
+    0,80,67,73,32,49,45,99,104,97,110,110,101,108,32,83,67,83,73,32,
+    82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,0,71,68,84,54,
+    49,49,48,47,54,53,49,48,0,71,68,84,54,49,50,48,47,54,53,50,
+    48,0,80,67,73,32,50,45,99,104,97,110,110,101,108,32,83,67,83,73,
+    32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,0,71,68,84,
+    54,53,51,48,0,80,67,73,32,51,45,99,104,97,110,110,101,108,32,83,
+    67,83,73,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,0,
+    71,68,84,54,53,53,48,0,80,67,73,32,53,45,99,104,97,110,110,101,
+    108,32,83,67,83,73,32,82,65,73,68,32,67,111,110,116,114,111,108,108,
+    101,114,0,71,68,84,54,49,49,55,47,54,53,49,55,0,87,105,100,101,
+    32,85,108,116,114,97,32,83,67,83,73,32,67,111,110,116,114,111,108,108,
+    101,114,0,71,68,84,54,49,50,55,47,54,53,50,55,0,71,68,84,54,
+    53,51,55,0,71,68,84,54,53,53,55,47,54,53,53,55,45,69,67,67,
+    0,71,68,84,54,49,49,53,47,54,53,49,53,0,85,108,116,114,97,32,
+    83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,71,68,84,54,
+    49,50,53,47,54,53,50,53,0,87,105,100,101,32,83,67,83,73,32,67,
+    111,110,116,114,111,108,108,101,114,0,71,68,84,54,53,51,53,0,71,68,
+    84,54,53,53,53,47,54,53,53,53,45,69,67,67,0,71,68,84,54,49,
+    49,55,82,80,47,54,53,49,55,82,80,0,50,32,67,104,97,110,110,101,
+    108,32,87,105,100,101,32,85,108,116,114,97,32,83,67,83,73,0,71,68,
+    84,54,49,50,55,82,80,47,54,53,50,55,82,80,0,87,105,100,101,32,
+    85,108,116,114,97,32,83,67,83,73,32,72,66,65,0,71,68,84,54,53,
+    51,55,82,80,0,71,68,84,54,53,53,55,82,80,0,71,68,84,54,49,
+    49,49,82,80,47,54,53,49,49,82,80,0,85,108,116,114,97,32,83,67,
+    83,73,32,72,66,65,0,71,68,84,54,49,50,49,82,80,47,54,53,50,
+    49,82,80,0,71,68,84,54,49,49,55,82,68,47,54,53,49,55,82,68,
+    0,71,68,84,54,49,50,55,82,68,47,54,53,50,55,82,68,0,71,68,
+    84,54,53,51,55,82,68,0,71,68,84,54,53,53,55,82,68,0,71,68,
+    84,54,49,49,49,82,68,47,54,53,49,49,82,68,0,71,68,84,54,120,
+    49,56,82,68,0,87,105,100,101,32,85,108,116,114,97,50,32,83,67,83,
+    73,32,72,66,65,0,71,68,84,54,120,50,56,82,68,0,71,68,84,54,
+    53,51,56,82,68,47,54,54,51,56,82,68,0,71,68,84,54,53,53,56,
+    82,68,47,54,54,53,56,82,68,0,71,68,84,54,49,49,55,82,80,50,
+    47,54,53,49,55,82,80,50,0,71,68,84,54,49,50,55,82,80,50,47,
+    54,53,50,55,82,80,50,0,71,68,84,54,53,51,55,82,80,50,0,71,
+    68,84,54,53,53,55,82,80,50,0,71,68,84,54,49,49,49,82,80,50,
+    47,54,53,49,49,82,80,50,0,71,68,84,32,54,120,49,51,82,83,0,
+    71,68,84,32,54,120,50,51,82,83,0,68,105,115,107,32,65,114,114,97,
+    121,32,67,111,110,116,114,111,108,108,101,114,0,71,68,84,32,54,120,49,
+    56,82,83,0,71,68,84,32,54,120,50,56,82,83,0,71,68,84,32,54,
+    120,51,56,82,83,0,71,68,84,32,54,120,53,56,82,83,0,71,68,84,
+    32,54,120,51,51,82,83,0,71,68,84,32,54,120,52,51,82,83,0,71,
+    68,84,32,54,120,53,51,82,83,0,71,68,84,32,54,120,54,51,82,83,
+    0,71,68,84,32,55,120,49,51,82,78,0,71,68,84,32,55,120,50,51,
+    82,78,0,71,68,84,55,120,49,56,82,78,0,54,52,45,98,105,116,32,
+    80,67,73,32,87,105,100,101,32,85,110,116,114,97,50,32,83,67,83,73,
+    32,72,66,65,0,71,68,84,55,120,50,56,82,78,0,54,52,45,98,105,
+    116,32,80,67,73,32,87,105,100,101,32,85,108,116,114,97,50,32,83,67,
+    83,73,32,72,66,65,0,71,68,84,55,53,51,56,82,78,47,55,54,51,
+    56,82,78,0,71,68,84,55,53,53,56,82,78,47,55,54,53,56,82,78,
+    0,71,68,84,32,55,120,51,51,82,78,0,71,68,84,32,55,120,52,51,
+    82,78,0,71,68,84,32,55,120,53,51,82,78,0,71,68,84,32,55,120,
+    54,51,82,78,0,71,68,84,32,52,120,49,51,82,90,0,71,68,84,32,
+    52,120,50,51,82,90,0,71,68,84,32,56,120,49,51,82,90,0,71,68,
+    84,32,56,120,50,51,82,90,0,71,68,84,32,56,120,51,51,82,90,0,
+    71,68,84,32,56,120,52,51,82,90,0,71,68,84,32,56,120,53,51,82,
+    90,0,71,68,84,32,56,120,54,51,82,90,0,71,68,84,54,53,49,57,
+    82,68,47,54,54,49,57,82,68,0,70,105,98,114,101,32,67,104,97,110,
+    110,101,108,32,72,66,65,0,71,68,84,54,53,50,57,82,68,47,54,54,
+    50,57,82,68,0,71,68,84,55,53,49,57,82,78,47,55,54,49,57,82,
+    78,0,54,52,45,98,105,116,32,80,67,73,32,70,105,98,114,101,32,67,
+    104,97,110,110,101,108,32,72,66,65,0,71,68,84,55,53,50,57,82,78,
+    47,55,54,50,57,82,78,0,71,68,84,32,82,120,0,49,53,53,80,45,
+    77,70,49,0,49,54,54,80,45,77,70,49,0,69,78,73,45,50,53,80,
+    0,80,111,119,101,114,98,117,115,32,66,114,105,100,103,101,0,73,68,84,
+    55,55,50,48,49,47,50,49,49,0,78,73,67,83,116,65,82,32,65,84,
+    77,32,65,100,97,112,116,101,114,0,73,68,84,55,55,50,50,50,47,50,
+    53,50,0,77,73,67,82,79,32,65,66,82,32,83,65,82,32,80,67,73,
+    32,65,84,77,32,67,111,110,116,114,111,108,108,101,114,0,73,68,84,55,
+    55,86,50,53,50,0,80,114,101,99,105,115,105,111,110,32,77,88,0,86,
+    105,100,101,111,32,101,110,103,105,110,101,32,105,110,116,101,114,102,97,99,
+    101,0,70,114,97,109,101,32,67,97,112,116,117,114,101,32,66,117,115,32,
+    73,110,116,101,114,102,97,99,101,0,70,105,114,101,82,117,110,110,101,114,
+    32,80,67,65,45,50,48,48,0,80,67,65,45,50,48,48,80,67,0,80,
+    67,65,45,50,48,48,69,0,70,111,114,101,82,117,110,110,101,114,32,72,
+    69,0,69,73,68,69,47,104,100,100,32,97,110,100,32,73,68,69,47,99,
+    100,45,114,111,109,32,67,116,114,108,114,0,48,120,48,49,48,0,85,83,
+    66,32,65,117,100,105,111,32,83,111,117,110,100,32,67,97,114,100,0,55,
+    49,51,48,0,48,49,51,56,52,69,52,50,56,0,80,84,68,51,48,48,
+    48,0,86,80,78,32,73,80,83,69,67,32,99,111,112,114,111,99,101,115,
+    115,111,114,0,80,84,68,51,50,49,48,0,83,83,76,32,65,99,99,101,
+    108,101,114,97,116,111,114,0,73,83,80,49,53,54,49,0,84,68,65,50,
+    55,56,48,65,81,0,84,86,32,100,101,102,108,101,99,116,105,111,110,32,
+    99,111,110,116,114,111,108,108,101,114,0,85,67,66,49,53,48,48,0,77,
+    117,108,116,105,109,101,100,105,97,32,65,117,100,105,111,32,68,101,118,105,
+    99,101,0,84,114,105,77,101,100,105,97,32,84,77,49,48,48,48,47,49,
+    49,48,48,0,77,117,108,116,105,109,101,100,105,97,32,112,114,111,99,101,
+    115,115,111,114,0,84,114,105,77,101,100,105,97,32,84,77,45,49,51,48,
+    48,69,72,0,83,65,65,55,49,51,53,72,76,0,80,104,105,108,105,112,
+    115,32,83,65,65,55,49,51,48,72,76,32,77,117,108,116,105,109,101,100,
+    105,97,32,67,97,112,116,117,114,101,32,68,101,118,105,99,101,0,80,104,
+    105,108,105,112,115,32,83,65,65,55,49,51,52,104,108,0,69,78,76,84,
+    86,32,84,86,47,82,97,100,105,111,32,84,117,110,101,114,0,83,65,65,
+    55,49,51,48,72,76,0,72,121,98,114,105,100,32,67,97,112,116,117,114,
+    101,32,68,101,118,105,99,101,0,100,49,52,53,97,104,0,100,100,100,100,
+    102,0,115,97,97,55,49,52,54,0,84,84,45,80,114,101,109,105,117,109,
+    32,83,45,50,51,48,48,0,83,65,65,57,55,51,48,0,69,116,104,101,
+    114,110,101,116,32,99,111,110,116,114,111,108,108,101,114,0,69,105,99,111,
+    110,67,97,114,100,32,67,57,49,0,69,105,99,111,110,67,97,114,100,32,
+    83,57,48,0,69,105,99,111,110,67,97,114,100,32,83,57,52,0,69,105,
+    99,111,110,67,97,114,100,32,80,57,50,0,68,73,86,65,32,80,114,111,
+    32,50,46,48,32,83,47,84,0,68,73,86,65,32,50,46,48,32,83,47,
+    84,0,68,73,86,65,32,80,114,111,32,50,46,48,32,85,0,68,73,86,
+    65,32,50,46,48,32,85,0,68,73,86,65,32,50,46,48,49,32,83,47,
+    84,0,69,105,99,111,110,32,73,83,68,78,32,99,97,114,100,32,117,115,
+    105,110,103,32,83,105,101,109,101,110,115,32,73,80,65,67,32,99,104,105,
+    112,0,68,73,86,65,32,73,83,68,78,32,50,46,48,50,32,80,67,73,
+    0,69,105,99,111,110,32,73,83,68,78,32,99,97,114,100,32,117,115,105,
+    110,103,32,73,110,102,105,110,101,111,110,32,99,104,105,112,0,77,97,101,
+    115,116,114,97,0,68,73,86,65,32,83,101,114,118,101,114,32,66,82,73,
+    45,50,77,0,77,97,101,115,116,114,97,81,0,68,73,86,65,32,83,101,
+    114,118,101,114,32,66,82,73,45,56,77,0,77,97,101,115,116,114,97,81,
+    45,85,0,68,73,86,65,32,83,101,114,118,101,114,32,52,66,82,73,47,
+    80,67,73,0,77,97,101,115,116,114,97,80,0,68,73,86,65,32,83,101,
+    114,118,101,114,32,80,82,73,45,51,48,77,0,68,105,118,97,32,83,101,
+    114,118,101,114,32,80,82,73,45,51,48,77,32,80,67,73,32,118,46,50,
+    0,68,73,86,65,32,83,101,114,118,101,114,32,66,82,73,45,50,77,47,
+    45,50,70,0,82,97,99,101,119,97,121,32,66,114,105,100,103,101,0,68,
+    80,82,66,0,68,117,97,108,32,80,67,73,32,116,111,32,82,97,112,105,
+    100,73,79,32,66,114,105,100,103,101,0,80,114,105,110,116,101,114,32,67,
+    110,116,114,108,114,0,56,57,48,53,0,83,84,68,32,51,50,32,66,114,
+    105,100,103,101,0,105,57,54,48,32,66,114,105,100,103,101,0,105,57,54,
+    48,32,66,114,105,100,103,101,32,47,32,69,118,97,108,117,97,116,105,111,
+    110,32,80,108,97,116,102,111,114,109,0,80,67,73,57,49,49,0,105,57,
+    54,48,74,120,32,73,47,79,32,67,111,110,116,114,111,108,108,101,114,0,
+    80,67,73,57,49,50,0,105,57,54,48,67,120,32,73,47,79,32,67,111,
+    110,116,114,111,108,108,101,114,0,80,67,73,57,49,51,0,105,57,54,48,
+    72,120,32,73,47,79,32,67,111,110,116,114,111,108,108,101,114,0,80,67,
+    73,57,49,52,0,73,47,79,32,67,111,110,116,114,111,108,108,101,114,32,
+    119,105,116,104,32,115,101,99,111,110,100,97,114,121,32,80,67,73,32,98,
+    117,115,0,83,83,84,45,54,52,80,0,83,83,84,45,49,50,56,80,0,
+    69,73,68,69,47,65,84,65,80,73,32,115,117,112,101,114,32,97,100,97,
+    112,116,101,114,0,80,114,111,77,111,116,105,111,110,32,51,50,49,48,0,
+    86,71,65,47,65,86,73,32,80,108,97,121,98,97,99,107,32,65,99,99,
+    101,108,101,114,97,116,111,114,0,54,52,49,48,32,54,52,50,50,0,80,
+    114,111,77,111,116,105,111,110,45,54,52,50,50,0,80,114,111,86,105,100,
+    101,111,32,54,52,50,52,0,80,114,111,77,111,116,105,111,110,32,65,84,
+    50,52,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,80,
+    114,111,77,111,116,105,111,110,32,65,84,50,53,0,48,55,53,50,32,50,
+    48,48,48,53,0,65,84,50,53,0,80,114,111,77,111,116,105,111,110,45,
+    65,84,51,68,0,49,51,57,75,55,54,66,32,57,56,48,56,0,78,111,
+    115,101,114,118,111,32,67,110,116,114,108,114,0,67,97,114,100,66,117,115,
+    32,65,84,65,80,73,32,72,111,115,116,32,65,100,97,112,116,101,114,0,
+    78,80,65,84,65,51,50,0,67,97,114,100,66,117,115,32,67,111,109,112,
+    97,99,116,70,108,97,115,104,32,65,100,97,112,116,101,114,0,78,80,65,
+    84,65,45,51,50,0,49,51,49,100,113,0,83,75,45,78,69,84,0,83,
+    121,115,75,111,110,110,101,99,116,32,71,101,110,101,115,105,115,0,83,75,
+    45,78,69,84,32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,
+    116,32,65,100,97,112,116,101,114,0,77,97,114,118,101,108,108,32,89,117,
+    107,111,110,0,83,121,115,75,111,110,110,101,99,116,32,71,105,103,97,98,
+    105,116,32,69,116,104,101,114,110,101,116,32,83,75,45,57,56,120,120,32,
+    86,101,114,115,105,111,110,32,50,46,48,0,77,97,114,118,101,108,108,32,
+    89,117,107,111,110,32,73,73,32,80,67,73,45,88,0,80,67,73,45,88,
+    32,49,48,47,49,48,48,47,49,48,48,48,66,97,115,101,45,84,32,83,
+    101,114,118,101,114,0,77,97,114,118,101,108,108,32,89,117,107,111,110,32,
+    69,67,0,80,67,73,32,69,120,112,114,101,115,115,32,49,48,47,49,48,
+    48,47,49,48,48,48,66,97,115,101,45,84,32,68,101,115,107,116,111,112,
+    0,86,77,73,80,67,73,45,53,53,54,53,0,85,108,116,114,97,104,105,
+    103,104,45,83,112,101,101,100,32,70,105,98,101,114,45,79,112,116,105,99,
+    115,32,82,101,102,108,101,99,116,105,118,101,32,77,101,109,111,114,121,32,
+    119,47,32,73,110,116,101,114,114,117,112,116,115,0,86,77,73,80,67,73,
+    45,53,53,55,57,0,82,101,102,108,101,99,116,105,118,101,32,77,101,109,
+    111,114,121,32,67,97,114,100,0,86,77,73,67,80,67,73,53,53,56,56,
+    0,86,77,73,67,80,67,73,53,53,56,56,32,82,101,102,108,101,99,116,
+    105,118,101,32,77,101,109,111,114,121,32,67,97,114,100,0,84,105,109,101,
+    114,47,83,82,65,77,32,70,80,71,65,0,86,77,73,86,77,69,45,55,
+    53,56,55,0,48,120,49,48,48,50,49,49,52,68,0,80,67,84,101,108,
+    32,72,83,80,53,54,32,80,67,73,32,77,111,100,101,109,0,65,99,99,
+    101,108,101,80,111,114,116,32,69,80,67,0,82,105,103,104,116,83,119,105,
+    116,99,104,32,83,69,45,54,0,65,99,99,101,108,101,80,111,114,116,32,
+    88,101,109,0,65,99,99,101,108,101,80,111,114,116,32,88,114,0,65,99,
+    99,101,108,101,80,111,114,116,32,67,47,88,0,68,97,116,97,70,105,114,
+    101,32,80,67,73,32,49,32,83,47,84,0,68,105,103,105,32,68,97,116,
+    97,32,70,105,114,101,32,80,67,73,32,49,32,83,47,84,0,65,99,99,
+    101,108,101,80,111,114,116,32,88,114,47,74,0,65,99,99,101,108,101,80,
+    111,114,116,32,69,80,67,47,74,0,68,97,116,97,70,105,114,101,80,82,
+    73,109,101,32,84,49,0,83,121,110,99,80,111,114,116,0,88,46,50,53,
+    47,70,82,32,50,45,112,111,114,116,0,65,99,99,101,108,101,80,111,114,
+    116,56,114,32,69,73,65,45,50,51,50,0,65,99,99,101,108,101,80,111,
+    114,116,56,114,32,69,73,65,45,52,50,50,0,65,99,99,101,108,101,80,
+    111,114,116,32,69,80,67,47,88,0,68,97,116,97,70,105,114,101,32,80,
+    67,73,32,49,32,85,0,68,97,116,97,70,105,114,101,80,82,73,109,101,
+    32,69,49,0,65,99,99,101,108,101,80,111,114,116,32,67,47,88,32,40,
+    73,66,77,41,0,68,97,116,97,70,105,114,101,32,82,65,83,0,84,49,
+    47,69,49,47,80,82,73,0,67,108,121,100,101,78,111,110,67,115,117,54,
+    48,51,52,0,67,108,121,100,101,78,111,110,67,115,117,54,48,51,50,0,
+    67,108,121,100,101,78,111,110,67,115,117,52,0,67,108,121,100,101,78,111,
+    110,67,115,117,50,0,65,99,99,101,108,101,80,111,114,116,32,82,65,83,
+    0,68,97,116,97,70,105,114,101,32,82,65,83,32,66,52,32,83,84,47,
+    85,0,65,99,99,101,108,101,80,111,114,116,32,52,114,32,57,50,48,0,
+    65,99,99,101,108,101,80,111,114,116,32,56,114,32,57,50,48,0,68,105,
+    103,105,67,108,97,115,115,105,99,32,80,67,73,0,65,99,99,101,108,101,
+    80,111,114,116,32,50,114,32,57,50,48,0,68,97,116,97,70,105,114,101,
+    32,68,83,80,0,84,49,47,69,49,47,80,82,73,44,32,67,111,109,112,
+    97,99,116,32,80,67,73,0,65,99,99,101,108,101,80,111,114,116,32,88,
+    112,0,65,99,99,101,108,101,80,111,114,116,32,50,112,32,80,67,73,0,
+    68,97,116,97,70,105,114,101,32,77,105,99,114,111,32,86,0,65,118,97,
+    110,115,116,97,114,0,52,56,54,32,67,80,85,47,80,67,73,32,66,114,
+    105,100,103,101,0,50,56,51,56,0,84,111,107,101,110,101,116,47,118,103,
+    32,49,48,48,49,47,49,48,109,32,97,110,121,108,97,110,0,76,97,110,
+    102,108,101,101,116,47,84,114,117,101,118,97,108,117,101,0,77,86,49,48,
+    48,48,0,77,86,45,49,53,48,48,0,82,66,69,77,53,54,71,45,49,
+    48,48,0,67,97,114,100,98,117,115,32,69,116,104,101,114,110,101,116,32,
+    49,48,47,49,48,48,43,77,111,100,101,109,32,53,54,0,67,97,114,100,
+    66,117,115,32,69,116,104,101,114,110,101,116,32,49,48,47,49,48,48,0,
+    77,80,67,73,32,51,65,53,54,71,83,80,45,49,48,48,32,80,65,0,
+    77,105,110,105,45,80,67,73,32,86,46,57,48,32,53,54,107,32,77,111,
+    100,101,109,0,87,105,110,109,111,100,101,109,32,98,117,105,108,116,32,105,
+    110,116,111,32,78,69,67,32,86,101,114,115,97,32,86,88,105,0,88,105,
+    114,99,111,109,32,77,80,67,73,51,66,45,53,54,71,32,40,76,117,99,
+    101,110,116,32,83,67,79,82,80,73,79,41,32,83,111,102,116,0,50,51,
+    51,51,51,51,51,51,51,51,51,51,51,0,88,105,114,99,111,109,32,77,
+    80,67,73,32,77,111,100,101,109,32,53,54,0,77,80,67,73,0,77,111,
+    100,101,109,32,53,54,107,0,67,97,114,100,66,117,115,32,53,54,107,32,
+    77,111,100,101,109,0,67,97,114,100,66,117,115,32,69,104,116,101,114,110,
+    101,116,32,43,32,53,54,107,32,77,111,100,101,109,0,86,101,114,105,116,
+    101,32,49,48,48,48,0,51,68,32,66,108,97,115,116,101,114,0,86,101,
+    114,105,116,101,32,50,120,48,48,0,77,111,116,105,111,110,32,74,80,69,
+    71,32,114,101,99,47,112,108,97,121,32,119,47,97,117,100,105,111,0,78,
+    66,54,53,51,54,32,40,67,78,66,50,48,45,76,69,41,0,80,67,73,
+    32,116,111,32,80,67,73,32,66,114,105,100,103,101,44,32,98,117,115,47,
+    100,101,118,47,102,117,110,99,32,48,47,48,47,49,0,78,66,54,53,51,
+    54,32,40,67,78,66,50,48,45,72,69,41,0,72,111,115,116,32,66,114,
+    105,100,103,101,44,32,102,117,110,99,116,105,111,110,32,50,32,97,110,100,
+    32,102,117,110,99,116,105,111,110,32,51,0,78,66,54,54,51,53,32,40,
+    67,78,66,50,48,45,76,69,47,72,69,41,0,72,111,115,116,98,114,105,
+    100,103,101,32,38,97,109,112,59,32,77,67,72,44,32,98,117,115,47,100,
+    101,118,47,102,117,110,99,32,48,47,48,47,48,0,67,73,79,66,51,48,
+    0,67,77,73,67,45,72,69,0,67,77,73,67,45,76,69,0,67,78,66,
+    50,48,45,72,69,0,72,111,115,116,98,114,105,100,103,101,32,97,110,100,
+    32,77,67,72,0,67,77,73,67,45,71,67,0,67,77,73,67,45,83,76,
+    0,67,73,79,66,45,88,50,0,66,67,77,53,55,49,53,0,66,114,111,
+    97,100,99,111,109,32,100,117,97,108,32,103,105,103,97,98,105,116,44,32,
+    112,99,105,32,98,114,105,100,103,101,0,67,73,79,66,45,69,0,73,47,
+    79,32,66,114,105,100,103,101,32,119,105,116,104,32,71,105,103,97,98,105,
+    116,32,69,116,104,101,114,110,101,116,32,83,101,114,118,101,114,87,111,114,
+    107,115,32,71,114,97,110,100,32,67,104,97,109,112,105,111,110,0,79,83,
+    66,52,0,67,83,66,53,0,67,83,66,54,0,73,68,69,32,105,110,116,
+    101,114,102,97,99,101,0,79,83,66,54,0,80,67,73,32,69,73,68,69,
+    32,67,111,110,116,114,111,108,108,101,114,32,40,84,101,114,116,105,97,114,
+    121,41,0,79,112,101,110,72,67,73,32,67,111,109,112,108,105,97,110,116,
+    32,85,83,66,32,67,111,110,116,114,111,108,108,101,114,0,79,72,67,73,
+    32,67,111,109,112,108,105,97,110,116,32,85,83,66,32,67,111,110,116,114,
+    111,108,108,101,114,0,48,120,48,50,50,51,0,85,83,66,32,99,111,110,
+    116,114,111,108,108,101,114,0,80,67,73,32,116,111,32,73,83,65,32,98,
+    114,105,100,103,101,0,66,67,52,56,53,50,0,56,45,67,104,97,110,110,
+    101,108,32,82,65,73,68,67,111,114,101,-30,-124,-94,32,83,65,84,65,32,
+    82,65,73,68,32,72,111,115,116,32,66,117,115,32,65,100,97,112,116,101,
+    114,0,81,76,53,48,51,50,0,51,50,32,67,104,97,110,110,101,108,32,
+    68,105,103,105,116,97,108,32,73,110,112,117,116,32,67,97,114,100,32,73,
+    110,116,101,114,102,97,99,101,0,49,54,32,67,104,97,110,110,101,108,32,
+    68,105,103,105,116,97,108,32,79,117,116,112,117,116,44,32,49,54,32,67,
+    104,97,110,110,101,108,32,68,105,103,105,116,97,108,32,73,110,112,117,116,
+    32,73,110,116,101,114,102,97,99,101,0,51,50,32,67,104,97,110,110,101,
+    108,32,65,110,97,108,111,103,32,73,110,112,117,116,32,73,110,116,101,114,
+    102,97,99,101,0,49,54,32,67,104,97,110,110,101,108,32,65,110,97,108,
+    111,103,32,79,117,116,112,117,116,32,47,32,65,110,97,108,111,103,32,73,
+    110,112,117,116,32,73,110,116,101,114,102,97,99,101,0,81,76,53,50,51,
+    50,0,56,32,67,104,97,110,110,101,108,32,84,105,109,101,114,32,67,111,
+    117,110,116,101,114,32,73,110,116,101,114,102,97,99,101,0,80,67,73,32,
+    116,111,32,84,105,103,101,114,83,72,65,82,67,32,70,80,71,65,32,73,
+    110,116,101,114,102,97,99,101,0,81,108,53,48,51,50,45,51,51,65,80,
+    81,50,48,56,67,0,80,67,73,32,116,111,32,67,45,68,65,67,32,82,
+    84,85,32,98,117,115,32,105,110,116,101,114,102,97,99,101,32,70,80,71,
+    65,0,66,117,115,47,84,97,103,32,67,104,97,110,110,101,108,0,69,115,
+    99,111,110,32,67,104,97,110,110,101,108,0,86,120,53,48,48,0,80,114,
+    105,110,116,101,114,32,65,83,73,67,0,69,80,70,54,48,49,54,65,84,
+    67,49,52,52,45,50,0,83,32,67,67,65,53,48,48,48,50,52,51,65,
+    0,77,117,108,116,105,45,115,101,114,105,97,108,32,99,97,114,100,0,52,
+    50,48,48,48,49,51,51,0,67,111,110,101,120,97,110,116,32,77,117,108,
+    116,105,99,104,97,110,110,101,108,32,83,121,110,99,104,114,111,110,111,117,
+    115,32,67,111,109,109,117,110,105,99,97,116,105,111,110,115,32,67,111,110,
+    116,114,111,108,108,101,114,32,40,77,85,83,89,67,67,41,0,116,111,115,
+    104,105,98,97,32,97,109,101,114,105,99,97,32,105,110,102,111,32,115,121,
+    115,116,101,109,115,0,69,120,116,101,110,100,101,100,32,80,67,73,32,73,
+    68,69,32,67,111,110,116,114,111,108,108,101,114,0,69,120,116,101,110,100,
+    101,100,32,80,67,73,32,73,68,69,32,67,111,110,116,114,111,108,108,101,
+    114,32,84,121,112,101,45,66,0,84,101,99,114,97,0,86,105,100,101,111,
+    32,67,97,112,116,117,114,101,32,100,101,118,105,99,101,0,84,111,115,104,
+    105,98,97,32,67,80,85,32,116,111,32,80,67,73,32,98,114,105,100,103,
+    101,0,80,67,73,32,116,111,32,73,83,65,32,66,114,105,100,103,101,32,
+    102,111,114,32,78,111,116,101,98,111,111,107,115,0,84,111,80,73,67,57,
+    53,0,80,67,73,32,116,111,32,67,97,114,100,66,117,115,32,66,114,105,
+    100,103,101,32,102,111,114,32,78,111,116,101,98,111,111,107,115,0,80,67,
+    73,32,116,111,32,80,67,73,32,66,114,105,100,103,101,32,102,111,114,32,
+    78,111,116,101,98,111,111,107,115,0,84,111,80,73,67,57,53,66,0,84,
+    111,115,104,105,98,97,32,84,111,80,73,67,57,53,32,67,97,114,100,66,
+    117,115,32,67,111,110,116,114,111,108,108,101,114,0,84,111,80,73,67,57,
+    55,0,84,111,80,73,67,49,48,48,0,80,67,73,32,116,111,32,67,97,
+    114,100,66,117,115,32,66,114,105,100,103,101,32,119,105,116,104,32,90,86,
+    32,115,117,112,112,111,114,116,0,67,80,85,32,116,111,32,80,67,73,32,
+    97,110,100,32,80,67,73,32,116,111,32,73,83,65,32,66,114,105,100,103,
+    101,0,118,116,56,50,99,54,57,51,0,80,67,73,32,67,111,109,109,117,
+    110,105,99,97,116,105,111,110,32,68,101,118,105,99,101,0,48,120,48,56,
+    48,52,0,84,111,115,104,105,98,97,32,83,109,97,114,116,32,77,101,100,
+    105,97,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,80,
+    67,73,92,86,69,78,95,49,49,56,48,38,97,109,112,59,68,69,86,95,
+    48,53,57,50,38,97,109,112,59,83,85,66,83,89,83,95,56,50,56,68,
+    49,48,51,51,38,97,109,112,59,82,69,86,95,48,54,92,52,38,97,109,
+    112,59,53,65,57,0,83,68,32,67,97,114,100,32,67,111,110,116,114,111,
+    108,108,101,114,0,48,120,48,68,48,49,0,70,73,82,32,80,111,114,116,
+    32,84,121,112,101,45,79,0,48,120,49,49,55,57,0,112,99,105,32,99,
+    111,109,109,117,110,105,99,97,116,105,111,110,32,100,101,118,105,99,101,0,
+    88,82,49,55,67,49,53,56,47,49,53,52,47,49,53,50,0,77,117,108,
+    116,105,45,99,104,97,110,110,101,108,32,80,67,73,32,85,65,82,84,0,
+    71,67,69,45,56,51,50,48,66,0,67,68,45,82,47,82,87,32,68,114,
+    105,118,101,0,80,114,105,110,116,101,114,32,72,111,115,116,0,82,76,53,
+    99,52,55,53,0,67,97,114,100,98,117,115,32,67,111,110,116,114,111,108,
+    108,101,114,0,82,105,99,111,104,32,82,47,82,76,47,53,67,52,55,54,
+    40,73,73,41,0,70,105,114,101,119,105,114,101,0,49,51,56,55,49,48,
+    52,51,0,82,105,99,111,104,32,77,101,109,111,114,121,32,83,116,105,99,
+    107,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,82,53,
+    67,56,51,50,44,32,82,53,67,56,52,51,0,73,69,69,69,32,49,51,
+    57,52,32,40,52,32,112,105,110,32,102,105,114,101,119,105,114,101,41,32,
+    99,104,105,112,41,0,82,105,99,111,104,32,77,77,67,32,72,111,115,116,
+    32,67,111,110,116,114,111,108,108,101,114,0,82,105,99,111,104,32,120,68,
+    45,80,105,99,116,117,114,101,32,67,97,114,100,32,72,111,115,116,32,67,
+    111,110,116,114,111,108,108,101,114,0,73,69,69,69,32,49,51,57,52,32,
+    67,111,110,116,114,111,108,108,101,114,0,102,114,101,97,108,116,101,107,0,
+    68,70,69,45,53,53,48,84,88,47,53,56,48,84,88,47,68,70,69,45,
+    53,53,48,70,88,0,68,76,32,49,48,48,51,56,67,32,111,114,32,49,
+    48,48,51,56,68,32,40,82,101,109,97,114,107,32,111,102,32,82,101,97,
+    108,116,101,107,32,82,84,76,45,56,49,51,57,41,0,68,70,69,45,53,
+    51,48,84,88,0,68,70,69,45,54,57,48,84,88,68,0,67,97,114,100,
+    66,117,115,32,80,67,32,67,97,114,100,0,68,82,80,45,51,50,84,88,
+    68,0,49,52,48,48,49,49,56,54,0,68,45,76,105,110,107,32,68,70,
+    69,45,53,48,48,84,120,32,80,67,73,32,102,97,115,116,32,69,116,104,
+    101,114,110,101,116,32,97,100,97,112,116,101,114,32,82,101,118,46,65,0,
+    68,70,69,32,53,51,48,84,88,43,32,114,101,118,32,69,49,0,68,45,
+    76,105,110,107,32,65,105,114,32,87,105,114,101,108,101,115,115,32,78,101,
+    116,119,111,114,107,32,40,68,87,76,45,71,53,49,48,41,0,73,69,69,
+    69,32,56,48,50,46,49,49,103,32,80,67,73,32,99,97,114,100,0,48,
+    120,51,98,48,48,49,49,56,54,0,68,45,76,73,78,75,32,68,87,76,
+    45,54,53,48,43,0,68,76,50,48,48,48,0,71,105,103,97,98,105,116,
+    32,69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,114,0,68,70,
+    69,45,54,53,48,84,88,0,68,32,76,105,110,107,32,70,97,115,116,32,
+    69,116,104,101,114,110,101,116,32,80,67,77,67,73,65,32,67,97,114,100,
+    0,100,108,103,49,48,48,50,56,0,85,115,101,100,32,111,110,32,68,71,
+    69,45,53,50,56,84,32,71,105,103,97,98,105,116,32,97,100,97,112,116,
+    111,114,0,68,71,69,45,53,51,48,84,0,86,76,47,80,67,73,32,66,
+    114,105,100,103,101,0,80,67,73,66,0,67,45,98,117,115,32,73,73,32,
+    116,111,32,80,67,73,32,98,117,115,32,104,111,115,116,32,98,114,105,100,
+    103,101,32,99,104,105,112,0,77,65,67,45,57,52,67,50,48,49,66,51,
+    0,67,111,114,111,108,108,97,114,121,47,73,110,116,101,108,32,77,101,109,
+    111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,67,104,105,112,0,
+    82,97,112,116,111,114,45,80,67,73,32,102,114,97,109,101,103,114,97,98,
+    98,101,114,0,77,111,100,101,108,32,49,50,0,82,111,97,100,32,82,117,
+    110,110,101,114,32,70,114,97,109,101,32,71,114,97,98,98,101,114,0,77,
+    111,100,101,108,32,49,52,0,77,111,100,101,108,32,50,52,0,77,111,100,
+    101,108,32,52,52,0,84,67,45,50,53,53,48,0,83,105,110,103,108,101,
+    32,67,104,105,112,32,85,108,116,114,97,32,40,87,105,100,101,41,32,83,
+    67,83,73,32,80,114,111,99,101,115,115,111,114,0,69,73,68,69,0,84,
+    80,45,57,49,48,47,57,50,48,47,57,52,48,0,80,67,73,32,85,108,
+    116,114,97,32,40,87,105,100,101,41,32,83,67,83,73,32,65,100,97,112,
+    116,101,114,0,73,68,69,32,67,116,114,108,114,0,65,84,80,56,53,48,
+    85,70,0,85,108,116,114,97,68,77,65,51,51,32,69,73,68,69,32,67,
+    111,110,116,114,111,108,108,101,114,32,40,65,69,67,54,50,49,48,85,70,
+    41,0,83,67,83,73,45,50,32,99,97,99,104,101,32,67,110,116,114,108,
+    114,0,65,84,80,56,52,48,48,0,85,108,116,114,97,68,77,65,51,51,
+    32,69,73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,65,84,80,
+    56,54,48,65,0,85,108,116,114,97,68,77,65,54,54,32,69,68,73,69,
+    32,67,111,110,116,114,111,108,108,101,114,32,40,65,69,67,54,50,54,48,
+    41,0,65,84,80,56,54,48,82,0,85,108,116,114,97,68,77,65,54,54,
+    32,69,73,68,69,32,67,111,110,116,114,111,108,108,101,114,32,40,65,69,
+    67,54,50,54,48,41,0,65,84,80,56,54,53,0,50,67,72,32,80,67,
+    73,32,85,108,116,114,97,68,77,65,49,51,51,32,73,68,69,32,67,111,
+    110,116,114,111,108,108,101,114,0,65,84,80,56,54,50,48,0,50,83,49,
+    80,32,80,67,73,45,88,32,83,65,84,65,40,51,71,41,47,85,68,77,
+    65,32,67,111,109,98,111,32,67,111,110,116,114,111,108,108,101,114,0,65,
+    84,80,56,54,48,48,0,83,67,83,73,45,50,32,82,65,73,68,32,40,
+    99,97,99,104,101,63,41,32,65,100,97,112,116,101,114,32,40,65,69,67,
+    54,56,50,48,85,41,0,65,84,80,56,53,48,83,0,83,67,83,73,45,
+    50,32,72,111,115,116,32,65,100,97,112,116,101,114,32,40,65,69,67,54,
+    55,49,48,76,47,70,41,0,65,84,80,56,55,48,0,85,108,116,114,97,
+    32,87,105,100,101,32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,
+    114,0,65,69,67,54,55,49,120,0,65,69,67,45,54,55,49,54,48,0,
+    80,67,73,32,85,108,116,114,97,49,54,48,32,76,86,68,47,83,69,32,
+    83,67,83,73,32,65,100,97,112,116,101,114,0,67,111,109,112,117,83,99,
+    111,112,101,32,56,50,71,0,56,45,98,105,116,32,50,71,83,47,115,32,
+    65,110,97,108,111,103,32,73,110,112,117,116,32,67,97,114,100,0,73,82,
+    77,65,32,51,50,55,48,32,80,67,73,32,65,100,97,112,116,101,114,0,
+    65,100,118,97,110,99,101,100,32,73,83,67,65,32,80,67,73,32,65,100,
+    97,112,116,101,114,0,83,68,76,67,32,80,67,73,32,65,100,97,112,116,
+    101,114,0,56,50,67,48,57,50,71,0,80,67,73,32,80,67,77,67,73,
+    65,32,98,114,105,100,103,101,0,77,66,56,54,54,57,55,0,70,105,114,
+    101,83,116,114,101,97,109,32,49,53,53,32,65,84,77,32,97,100,97,112,
+    116,101,114,0,77,66,56,54,54,57,53,0,70,105,114,101,83,116,114,101,
+    97,109,32,53,48,32,65,84,77,32,97,100,97,112,116,101,114,0,78,84,
+    88,45,56,48,50,51,45,80,67,73,32,50,77,66,32,76,111,110,103,32,
+    67,97,114,100,0,78,84,88,45,56,48,50,51,45,80,67,73,32,56,77,
+    66,32,76,111,110,103,32,67,97,114,100,0,78,84,88,45,56,48,50,51,
+    45,80,67,73,32,50,77,66,32,83,104,111,114,116,32,67,97,114,100,0,
+    78,84,88,45,56,48,50,51,45,80,67,73,32,56,77,66,32,83,104,111,
+    114,116,32,67,97,114,100,0,65,77,67,67,32,83,53,57,51,51,81,0,
+    112,99,105,32,109,97,116,99,104,109,97,107,101,114,32,57,54,50,50,113,
+    97,99,0,71,84,45,54,52,48,49,48,47,65,0,83,121,115,116,101,109,
+    32,67,116,114,108,114,32,102,111,114,32,82,52,120,120,120,47,53,48,48,
+    48,32,70,97,109,105,108,121,32,67,80,85,115,0,56,56,69,56,48,53,
+    53,32,80,67,73,45,69,0,71,105,103,97,98,105,116,32,69,116,104,101,
+    114,110,101,116,32,67,111,110,116,114,111,108,101,114,0,87,56,51,48,48,
+    0,56,48,50,46,49,49,32,65,100,97,112,116,101,114,0,56,56,87,56,
+    51,49,48,0,84,104,101,32,76,105,98,101,114,116,97,115,-30,-124,-94,32,
+    87,76,65,78,32,56,48,50,49,49,98,103,0,56,51,51,53,0,77,97,
+    114,118,101,108,108,32,76,105,98,101,114,116,97,115,32,56,48,50,46,49,
+    49,98,47,103,32,87,105,114,101,108,101,115,115,32,40,56,51,51,53,41,
+    0,56,56,69,56,48,53,53,0,80,67,73,32,69,32,103,105,103,97,98,
+    105,116,0,56,56,69,56,48,51,54,0,89,117,107,111,110,32,80,67,73,
+    45,69,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,56,69,56,48,51,57,0,56,56,69,56,48,
+    53,50,0,89,117,107,111,110,32,80,67,73,45,69,32,65,83,70,32,71,
+    105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,
+    114,111,108,108,101,114,0,77,97,114,118,101,108,108,32,89,117,107,111,110,
+    32,45,69,67,32,56,56,69,56,48,51,54,32,80,67,73,32,69,120,112,
+    114,101,115,115,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,
+    111,110,116,114,111,108,108,101,114,0,77,97,114,118,101,108,108,32,89,117,
+    107,111,110,32,56,56,69,56,48,53,51,32,80,67,73,45,69,32,71,105,
+    103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,
+    111,108,108,101,114,0,89,117,107,111,110,32,80,67,73,45,69,32,71,105,
+    103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,
+    111,108,108,101,114,0,56,56,69,56,48,53,54,0,71,84,45,54,52,49,
+    49,53,0,71,84,45,54,52,49,50,48,0,83,121,115,116,101,109,32,67,
+    111,110,116,114,111,108,108,101,114,32,102,111,114,32,82,53,48,48,48,32,
+    38,97,109,112,59,32,82,55,48,48,48,32,40,54,52,45,98,105,116,32,
+    80,67,73,41,0,71,84,45,52,56,48,48,49,0,56,32,112,111,114,116,
+    32,115,119,105,116,99,104,101,100,32,101,116,104,101,114,110,101,116,32,99,
+    116,114,108,114,0,69,86,45,52,56,51,48,48,0,69,118,97,108,117,97,
+    116,105,111,110,32,98,111,97,114,100,32,102,111,114,32,116,104,101,32,71,
+    84,45,52,56,51,48,48,0,70,53,68,53,48,48,53,0,66,101,108,107,
+    105,110,32,68,101,115,107,116,111,112,32,71,105,103,97,98,105,116,32,80,
+    67,73,32,99,97,114,100,0,56,56,83,88,53,48,52,48,0,52,45,112,
+    111,114,116,32,83,65,84,65,32,73,32,80,67,73,45,88,32,67,111,110,
+    116,114,111,108,108,101,114,0,56,56,83,88,53,48,52,0,82,111,99,107,
+    101,116,82,65,73,68,32,49,56,50,120,0,83,65,84,65,32,67,111,110,
+    116,114,111,108,108,101,114,0,77,86,56,56,83,88,54,48,52,49,0,77,
+    97,114,118,101,108,108,32,84,101,99,104,110,111,108,111,103,121,32,71,114,
+    111,117,112,32,76,116,100,46,32,77,86,56,56,83,88,54,48,52,49,32,
+    52,45,112,111,114,116,32,83,65,84,65,32,73,73,32,80,67,73,45,88,
+    32,67,111,110,116,114,111,108,108,101,114,32,40,114,101,118,32,48,51,41,
+    0,65,100,100,45,111,110,32,73,67,32,116,111,32,112,114,111,118,105,100,
+    101,32,52,120,32,83,65,84,65,32,80,111,114,116,115,44,32,97,116,116,
+    97,99,104,101,100,32,116,111,32,73,67,72,55,32,40,83,116,104,66,114,
+    105,100,103,101,63,41,32,118,105,97,32,80,67,73,45,69,120,112,114,101,
+    115,115,46,0,71,84,45,54,52,49,51,48,47,49,51,49,0,83,121,115,
+    116,101,109,32,67,111,110,116,114,111,108,108,101,114,32,102,111,114,32,80,
+    111,119,101,114,80,67,32,80,114,111,99,101,115,115,111,114,115,0,77,86,
+    54,52,52,54,120,0,83,121,115,116,101,109,32,67,111,110,116,114,111,108,
+    108,101,114,32,102,111,114,32,80,111,119,101,114,80,67,32,80,114,111,99,
+    101,115,115,111,114,115,44,32,82,101,118,105,115,105,111,110,32,66,0,71,
+    84,45,57,54,49,48,48,65,0,65,100,118,97,110,99,101,100,32,67,111,
+    109,109,117,110,105,99,97,116,105,111,110,32,67,111,110,116,114,111,108,108,
+    101,114,0,71,84,45,54,52,48,49,48,0,80,114,105,109,97,114,121,32,
+    73,109,97,103,101,32,80,105,114,97,110,104,97,32,73,109,97,103,101,32,
+    71,101,110,101,114,97,116,111,114,0,71,84,54,52,49,50,48,0,80,114,
+    105,109,97,114,121,32,73,109,97,103,101,32,66,97,114,114,97,99,117,100,
+    97,32,73,109,97,103,101,32,71,101,110,101,114,97,116,111,114,0,71,84,
+    45,54,52,49,50,48,65,0,80,114,105,109,97,114,121,32,73,109,97,103,
+    101,32,67,114,117,110,99,104,101,114,32,71,101,111,109,101,116,114,121,32,
+    65,99,99,101,108,101,114,97,116,111,114,0,76,67,56,50,67,49,54,56,
+    63,0,75,78,69,49,49,48,84,88,0,75,105,110,103,115,116,111,110,32,
+    69,116,104,101,82,120,32,75,78,69,49,49,48,84,88,32,80,67,73,32,
+    70,97,115,116,32,69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,
+    114,0,76,67,56,50,67,49,49,53,0,80,78,73,67,32,73,73,32,80,
+    67,73,32,77,65,67,47,80,72,89,0,66,114,105,100,103,101,32,67,111,
+    110,116,114,111,108,108,101,114,0,57,55,48,52,0,67,105,110,101,109,97,
+    0,86,57,54,48,80,66,67,47,80,83,67,0,105,57,54,48,32,76,111,
+    99,97,108,32,66,117,115,32,116,111,32,80,67,73,32,66,114,105,100,103,
+    101,0,86,57,54,49,80,66,67,47,80,83,67,0,105,57,54,48,74,120,
+    32,76,111,99,97,108,32,66,117,115,32,116,111,32,80,67,73,32,66,114,
+    105,100,103,101,0,86,57,54,50,80,66,67,47,80,83,67,0,105,57,54,
+    48,67,120,47,72,120,32,76,111,99,97,108,32,66,117,115,32,116,111,32,
+    80,67,73,32,66,114,105,100,103,101,0,86,50,57,50,80,66,67,47,80,
+    83,67,0,65,109,50,57,75,32,76,111,99,97,108,32,66,117,115,32,116,
+    111,32,80,67,73,32,66,114,105,100,103,101,0,86,51,54,51,69,80,67,
+    0,105,57,54,48,83,120,32,76,111,99,97,108,32,66,117,115,32,116,111,
+    32,80,67,73,32,66,114,105,100,103,101,0,86,51,50,48,85,83,67,0,
+    80,67,73,32,83,121,115,116,101,109,32,67,116,114,108,114,32,102,111,114,
+    32,51,50,45,98,105,116,32,77,73,80,83,32,67,80,85,0,80,67,73,
+    32,83,121,115,116,101,109,32,67,116,114,108,114,32,102,111,114,32,83,117,
+    112,101,114,45,72,32,83,72,51,32,67,80,85,0,80,67,73,32,83,121,
+    115,116,101,109,32,67,116,114,108,114,32,102,111,114,32,83,117,112,101,114,
+    45,72,32,83,72,52,32,67,80,85,0,86,51,55,48,80,68,67,0,72,
+    105,103,104,32,80,101,114,102,111,114,109,97,110,99,101,32,80,67,73,32,
+    83,68,82,65,77,32,67,111,110,116,114,111,108,108,101,114,0,86,50,57,
+    50,80,66,67,0,65,109,50,57,48,51,48,47,52,48,32,66,114,105,100,
+    103,101,0,86,51,52,48,72,80,67,0,80,67,73,32,83,121,115,116,101,
+    109,32,67,116,114,108,114,32,102,111,114,32,54,52,45,98,105,116,32,77,
+    73,80,83,32,67,80,85,0,86,57,54,120,80,66,67,0,105,57,54,48,
+    32,66,114,105,100,103,101,115,32,102,111,114,32,105,57,54,48,32,80,114,
+    111,99,101,115,115,111,114,115,0,86,57,54,68,80,67,0,105,57,54,48,
+    32,68,117,97,108,32,80,67,73,32,66,114,105,100,103,101,0,80,77,67,
+    47,80,77,88,49,53,53,51,0,49,53,53,51,32,66,117,115,32,73,110,
+    116,101,114,102,97,99,101,32,67,97,114,100,0,80,77,67,70,49,0,70,
+    76,65,83,72,32,109,101,109,111,114,121,32,67,97,114,100,0,80,77,67,
+    77,77,65,0,77,117,108,116,105,32,77,101,100,105,97,32,65,100,97,112,
+    116,101,114,0,80,77,67,86,71,79,0,86,105,100,101,111,32,71,114,97,
+    112,104,105,99,115,32,79,118,101,114,108,97,121,0,80,77,67,80,67,73,
+    83,0,80,80,122,101,114,111,32,83,108,97,118,101,32,73,110,116,101,114,
+    102,97,99,101,32,67,97,114,100,0,80,77,67,80,67,73,77,0,80,80,
+    122,101,114,111,32,77,97,115,116,101,114,32,73,110,116,101,114,102,97,99,
+    101,32,67,97,114,100,0,80,77,67,81,49,0,83,101,114,105,97,108,47,
+    49,53,53,51,32,73,110,116,101,114,102,97,99,101,32,67,97,114,100,0,
+    69,80,77,67,81,50,0,73,110,116,101,108,108,105,103,101,110,116,32,83,
+    101,114,105,97,108,47,69,116,104,101,114,110,101,116,32,67,97,114,100,0,
+    80,77,67,80,73,79,49,0,80,97,114,97,108,108,101,108,32,73,47,79,
+    32,77,111,100,117,108,101,0,80,77,67,70,65,49,67,0,80,77,67,72,
+    72,49,0,72,105,103,104,32,83,112,101,101,100,32,68,83,80,32,71,97,
+    116,101,119,97,121,32,77,111,100,117,108,101,0,80,77,67,77,65,50,0,
+    77,101,109,111,114,121,32,65,100,97,112,116,111,114,32,77,111,100,117,108,
+    101,0,70,76,65,83,72,32,109,101,109,111,114,121,32,67,97,114,100,32,
+    40,86,50,41,0,80,77,67,49,53,53,51,69,88,0,80,77,67,49,53,
+    53,51,69,0,80,77,67,70,65,50,67,0,68,117,97,108,32,70,105,98,
+    114,101,32,67,104,97,110,110,101,108,32,65,100,97,112,116,101,114,0,81,
+    117,97,100,32,80,101,101,114,77,97,115,116,101,114,0,83,83,65,32,67,
+    116,114,108,114,0,78,80,73,32,78,117,67,97,114,100,0,80,67,73,32,
+    70,68,68,73,0,54,54,48,56,48,54,45,50,46,48,0,114,111,98,50,
+    100,0,53,49,48,49,49,56,49,48,0,112,105,110,110,97,99,108,101,44,
+    32,98,101,110,100,105,110,111,32,86,49,46,48,65,59,32,48,80,67,48,
+    80,54,0,77,66,56,55,74,51,53,54,48,0,76,84,32,87,105,110,109,
+    111,100,101,109,32,53,54,107,0,68,97,116,97,43,70,97,120,43,86,111,
+    105,99,101,43,68,83,86,68,0,52,51,57,48,49,52,51,0,109,111,100,
+    101,109,0,49,54,52,56,84,48,48,0,76,84,32,87,105,110,77,111,100,
+    101,109,32,53,54,75,32,68,97,116,97,43,70,97,120,0,76,84,32,87,
+    105,110,109,111,100,101,109,0,49,54,52,54,84,48,48,0,56,52,53,71,
+    0,119,105,110,100,111,119,115,109,101,0,83,86,50,80,50,0,48,52,52,
+    57,49,52,52,70,0,57,77,53,54,80,77,76,45,71,0,108,117,99,101,
+    110,116,32,49,54,52,54,84,48,48,0,76,84,32,87,105,110,77,111,100,
+    101,109,32,53,54,107,32,68,97,116,97,43,70,97,120,32,111,114,32,65,
+    103,101,114,101,32,70,45,49,49,53,54,73,86,47,65,51,0,57,48,48,
+    57,52,45,49,0,76,84,32,86,46,57,48,43,68,83,76,32,87,105,108,
+    100,70,105,114,101,32,77,111,100,101,109,0,49,52,53,54,86,81,72,49,
+    57,82,45,49,40,73,78,84,41,0,76,84,32,87,105,110,109,111,100,101,
+    109,32,53,54,75,0,76,84,32,87,105,110,77,111,100,101,109,32,53,54,
+    107,32,68,97,116,97,43,70,97,120,43,86,111,105,99,101,43,68,83,86,
+    68,0,49,53,49,51,49,52,52,0,49,54,52,56,67,0,77,97,114,115,
+    32,51,32,77,101,114,99,117,114,121,32,118,46,57,50,32,118,46,52,52,
+    0,76,84,32,87,105,110,77,111,100,101,109,0,109,97,114,115,50,0,86,
+    57,48,32,87,105,108,100,102,105,114,101,32,77,111,100,101,109,0,49,54,
+    57,48,0,53,54,75,46,86,57,48,47,65,68,83,76,32,87,105,108,100,
+    119,105,114,101,32,77,111,100,101,109,0,84,104,105,115,32,105,115,32,78,
+    79,84,32,97,32,82,105,112,116,105,100,101,33,32,40,97,115,32,112,114,
+    101,118,105,111,117,115,108,121,32,115,116,97,116,101,100,41,0,76,117,99,
+    101,110,116,32,87,105,108,100,119,105,114,101,32,118,46,57,48,32,43,32,
+    68,83,76,32,109,111,100,101,109,0,86,101,110,117,115,32,87,105,110,109,
+    111,100,101,109,0,53,54,107,46,86,57,48,47,65,68,83,76,32,87,105,
+    108,100,102,105,114,101,32,77,111,100,101,109,0,83,86,57,80,0,115,118,
+    112,57,50,45,116,48,48,0,53,54,107,32,86,46,57,50,109,111,100,101,
+    109,0,83,86,57,50,80,45,84,48,48,0,65,103,101,114,101,32,80,67,
+    73,32,83,111,102,116,32,77,111,100,101,109,46,32,83,86,57,50,80,76,
+    0,115,118,57,50,112,50,0,53,54,107,32,86,46,57,50,32,77,111,100,
+    101,109,0,83,86,57,50,80,80,0,65,103,101,114,101,32,80,67,73,32,
+    83,111,102,116,32,77,111,100,101,109,32,102,111,114,32,108,105,110,117,120,
+    32,100,101,98,105,97,110,0,80,114,101,115,112,97,0,65,103,101,114,101,
+    32,83,121,115,116,101,109,115,32,72,68,65,32,77,111,100,101,109,0,48,
+    120,49,49,99,49,51,48,50,54,0,79,82,51,84,80,49,50,0,70,80,
+    83,67,32,70,80,71,65,32,119,105,116,104,32,51,50,47,54,52,98,105,
+    116,44,32,51,51,47,54,54,77,72,122,32,99,111,114,101,0,85,83,83,
+    45,51,49,50,77,67,0,50,45,112,111,114,116,32,80,67,73,45,116,111,
+    45,85,83,66,32,79,112,101,110,72,67,73,32,72,111,115,116,32,67,116,
+    114,108,114,0,85,83,83,45,51,52,52,0,81,117,97,100,114,97,66,117,
+    115,32,52,45,112,111,114,116,32,85,83,66,32,79,112,101,110,72,67,73,
+    32,72,111,115,116,32,67,116,114,108,114,0,117,115,115,51,52,52,0,85,
+    83,66,32,65,100,118,97,110,99,101,100,32,72,111,115,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,70,87,51,50,50,0,49,51,57,52,65,32,
+    80,67,73,32,80,72,89,47,76,105,110,107,32,79,112,101,110,32,72,111,
+    115,116,32,67,116,114,108,114,32,73,47,70,0,87,97,118,101,76,65,78,
+    0,80,67,73,32,87,105,114,101,108,101,115,115,32,76,65,78,32,65,100,
+    97,112,116,101,114,0,72,101,114,109,101,115,50,63,0,77,105,110,105,45,
+    80,67,73,32,87,97,118,101,76,65,78,32,97,47,98,47,103,0,69,84,
+    45,49,51,49,120,0,80,67,73,45,69,32,69,116,104,101,114,110,101,116,
+    32,67,111,110,116,114,111,108,108,101,114,0,86,77,45,49,50,48,48,32,
+    79,112,116,111,32,85,110,105,116,32,67,111,110,116,114,111,108,108,101,114,
+    0,80,83,66,32,51,50,0,51,50,32,98,105,116,32,44,32,51,51,32,
+    77,104,122,32,80,67,73,45,83,67,73,32,66,114,105,100,103,101,0,80,
+    83,66,54,52,0,54,52,32,98,105,116,32,44,32,51,51,32,77,104,122,
+    32,80,67,73,45,83,67,73,32,66,114,105,100,103,101,0,80,83,66,54,
+    54,0,54,52,32,98,105,116,32,44,32,54,54,32,77,104,122,32,80,67,
+    73,45,83,67,73,32,66,114,105,100,103,101,46,32,40,68,51,51,120,41,
+    0,49,54,45,108,105,110,101,32,115,101,114,105,97,108,32,112,111,114,116,
+    32,119,47,68,77,65,0,52,45,108,105,110,101,32,115,101,114,105,97,108,
+    32,112,111,114,116,32,119,47,68,77,65,0,80,67,73,45,57,48,53,48,
+    45,49,49,48,48,48,56,51,45,49,49,0,112,111,114,116,32,115,109,97,
+    108,108,32,73,67,0,83,85,80,73,45,49,0,88,73,79,47,83,73,79,
+    32,72,111,115,116,0,84,50,50,53,0,66,114,105,100,103,101,32,82,73,
+    79,32,72,111,115,116,0,49,48,48,49,0,70,70,48,48,49,48,50,66,
+    0,86,120,80,53,50,52,0,80,67,73,32,86,105,100,101,111,32,80,114,
+    111,99,101,115,115,111,114,0,114,101,118,95,48,51,0,116,117,110,101,114,
+    32,99,97,114,100,0,65,68,83,80,45,50,49,53,51,53,0,66,108,97,
+    99,107,102,105,110,32,68,83,80,32,80,67,73,32,66,117,115,32,73,110,
+    116,101,114,102,97,99,101,0,54,50,52,49,50,45,53,49,0,85,51,53,
+    53,52,53,46,50,45,48,46,54,0,65,68,49,56,56,52,72,68,0,83,
+    111,117,110,100,77,65,88,32,73,110,116,101,103,114,97,116,101,100,32,68,
+    105,103,105,116,97,108,32,72,68,32,65,117,100,105,111,0,65,68,49,57,
+    56,48,0,83,111,117,110,100,32,67,104,105,112,0,65,68,49,57,56,49,
+    72,68,0,65,68,49,57,56,51,72,68,0,65,68,49,57,56,54,65,0,
+    65,68,83,80,45,50,49,57,50,0,68,83,80,32,77,105,99,114,111,99,
+    111,109,112,117,116,101,114,32,40,102,117,110,99,116,105,111,110,32,35,48,
+    41,0,68,83,80,32,77,105,99,114,111,99,111,109,112,117,116,101,114,32,
+    40,102,117,110,99,116,105,111,110,32,35,49,41,0,68,83,80,32,77,105,
+    99,114,111,99,111,109,112,117,116,101,114,32,40,102,117,110,99,116,105,111,
+    110,32,35,50,41,0,65,68,83,80,45,50,49,52,49,0,83,97,102,101,
+    78,101,116,32,67,114,121,112,116,111,32,65,99,99,101,108,101,114,97,116,
+    111,114,32,99,104,105,112,0,49,48,49,49,53,0,86,101,114,115,97,116,
+    101,99,32,80,97,114,97,108,108,101,108,32,73,110,116,101,114,102,97,99,
+    101,32,40,86,80,73,41,32,43,32,67,101,110,116,114,111,110,105,99,115,
+    0,49,48,49,49,56,0,68,82,49,49,45,87,32,101,109,117,108,97,116,
+    111,114,0,49,48,49,49,55,0,68,114,101,97,109,99,97,115,116,32,66,
+    114,111,97,100,98,97,110,100,32,65,100,97,112,116,101,114,0,90,82,51,
+    54,48,53,55,80,81,67,0,90,79,82,65,78,32,80,67,73,32,66,114,
+    105,100,103,101,32,40,105,110,116,101,114,102,97,99,101,32,102,111,114,32,
+    116,114,97,110,115,102,101,114,114,105,110,103,32,118,105,100,101,111,32,97,
+    99,114,111,115,115,32,116,104,101,32,80,67,73,32,98,117,115,41,0,90,
+    82,51,54,49,50,48,80,81,67,0,77,80,69,71,32,86,105,100,101,111,
+    66,86,80,83,88,73,32,67,97,112,116,117,114,101,32,67,97,114,100,0,
+    70,65,83,84,108,105,110,101,32,85,84,80,32,81,117,97,116,116,114,111,
+    0,70,65,83,84,108,105,110,101,32,70,79,0,70,65,83,84,108,105,110,
+    101,32,85,84,80,0,70,65,83,84,108,105,110,101,45,73,73,32,85,84,
+    80,0,70,65,83,84,108,105,110,101,45,73,73,32,70,79,0,71,73,71,
+    65,108,105,110,101,0,50,57,49,53,0,82,101,97,100,121,76,105,110,107,
+    32,69,78,69,84,49,48,48,45,86,71,52,0,70,114,101,101,100,111,109,
+    76,105,110,101,32,49,48,48,0,56,51,50,65,69,50,56,48,51,48,54,
+    56,48,0,82,101,97,100,121,76,105,110,107,32,82,76,50,48,48,48,0,
+    84,88,65,57,56,56,50,0,82,101,97,100,121,76,105,110,107,32,32,82,
+    76,49,48,48,65,84,88,47,80,67,73,32,70,97,115,116,32,69,116,104,
+    101,114,110,101,116,32,65,100,97,112,116,101,114,0,84,88,65,57,56,56,
+    51,0,82,101,97,100,121,76,105,110,107,32,49,48,48,84,88,32,40,87,
+    105,110,98,111,110,100,32,87,56,57,67,56,52,48,41,0,84,88,65,57,
+    56,56,49,63,0,82,101,97,100,121,76,105,110,107,32,82,76,49,48,48,
+    84,88,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,65,100,97,
+    112,116,101,114,0,80,77,55,51,54,52,0,70,82,69,69,68,77,45,51,
+    50,32,70,114,97,109,101,32,69,110,103,105,110,101,32,38,97,109,112,59,
+    32,68,97,116,97,108,105,110,107,32,77,103,114,0,70,82,69,69,68,77,
+    45,56,32,70,114,97,109,101,32,69,110,103,105,110,101,32,38,97,109,112,
+    59,32,68,97,116,97,108,105,110,107,32,77,97,110,97,103,101,114,0,80,
+    77,55,51,54,55,0,70,82,69,69,68,77,45,51,50,80,51,50,32,70,
+    114,97,109,101,32,69,110,103,105,110,101,32,38,97,109,112,59,32,68,97,
+    116,97,108,105,110,107,32,77,103,114,0,80,77,55,51,55,53,0,76,65,
+    83,65,82,45,49,53,53,32,65,84,77,32,83,65,82,0,80,77,55,51,
+    56,48,0,70,82,69,69,68,77,45,51,50,80,54,55,50,32,70,114,109,
+    32,69,110,103,105,110,101,32,38,97,109,112,59,32,68,97,116,97,108,105,
+    110,107,32,77,103,114,0,80,77,55,51,56,50,0,70,82,69,69,68,77,
+    45,51,50,80,50,53,54,32,70,114,109,32,69,110,103,105,110,101,32,38,
+    97,109,112,59,32,68,97,116,97,108,105,110,107,32,77,103,114,0,80,77,
+    55,51,56,52,0,70,82,69,69,68,77,45,56,52,80,54,55,50,32,70,
+    114,109,32,69,110,103,105,110,101,32,38,97,109,112,59,32,68,97,116,97,
+    108,105,110,107,32,77,103,114,0,80,77,56,48,48,48,32,83,80,67,0,
+    54,71,32,83,65,83,47,83,65,84,65,32,67,111,110,116,114,111,108,108,
+    101,114,0,80,77,56,48,49,48,32,83,82,67,0,54,71,32,83,65,83,
+    47,83,65,84,65,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,
+    114,0,82,111,99,107,101,116,80,111,114,116,0,52,45,112,111,114,116,32,
+    85,65,82,84,32,49,54,57,53,52,0,78,65,73,65,84,77,80,67,73,
+    0,80,67,73,32,65,84,77,32,65,100,97,112,116,101,114,0,72,83,45,
+    76,105,110,107,32,68,101,118,105,99,101,0,80,76,88,32,80,67,73,32,
+    66,82,73,68,71,69,0,67,121,99,108,111,109,45,89,0,77,117,108,116,
+    105,112,111,114,116,32,83,101,114,105,97,108,32,67,97,114,100,0,67,121,
+    99,108,111,109,45,52,89,0,67,121,99,108,111,109,45,56,89,0,67,121,
+    99,108,111,109,45,90,0,73,110,116,101,108,108,105,103,101,110,116,32,77,
+    117,108,116,105,112,111,114,116,32,83,101,114,105,97,108,0,73,110,116,101,
+    108,108,105,103,101,110,116,32,83,101,114,105,97,108,32,67,97,114,100,0,
+    80,67,51,48,48,32,82,88,32,50,0,80,67,51,48,48,32,82,88,32,
+    49,0,80,67,51,48,48,32,84,69,32,50,0,80,67,51,48,48,32,84,
+    69,32,49,0,82,111,97,100,114,117,110,110,101,114,0,48,120,48,48,102,
+    55,49,50,49,55,0,49,51,57,52,32,79,112,101,110,32,72,111,115,116,
+    32,67,111,110,116,114,111,108,108,101,114,32,73,110,116,101,114,102,97,99,
+    101,0,79,90,54,55,50,57,0,80,67,73,32,116,111,32,80,67,77,67,
+    73,65,32,66,114,105,100,103,101,0,79,90,54,55,51,48,0,79,90,54,
+    56,51,50,47,51,0,79,90,54,56,51,54,47,54,56,54,48,0,79,90,
+    54,56,49,50,0,79,90,54,57,50,50,0,79,90,54,57,51,51,0,79,
+    90,54,57,49,50,0,79,90,55,49,49,77,120,0,77,101,109,111,114,121,
+    67,97,114,100,66,117,115,32,65,99,99,101,108,101,114,97,116,111,114,0,
+    48,90,55,49,49,69,67,49,0,83,109,97,114,116,67,97,114,100,66,117,
+    115,32,67,111,110,116,111,108,108,101,114,0,79,90,55,49,49,77,49,0,
+    85,110,107,110,111,119,110,32,100,101,118,105,99,101,0,79,50,77,105,99,
+    114,111,32,73,110,116,101,103,114,97,116,101,100,32,77,77,67,47,83,68,
+    32,99,111,110,116,114,111,108,108,101,114,0,79,90,55,49,49,77,51,0,
+    73,110,116,101,103,114,97,116,101,100,32,77,77,67,47,83,68,47,77,83,
+    47,120,68,47,83,77,32,67,111,110,116,114,111,108,108,101,114,0,79,90,
+    55,49,49,77,80,49,47,77,83,49,0,77,101,109,111,114,121,67,97,114,
+    100,66,117,115,32,67,111,110,116,114,111,108,108,101,114,32,54,45,105,110,
+    45,49,0,86,111,111,100,111,111,0,86,111,111,100,111,111,32,51,68,32,
+    65,99,99,101,108,101,114,97,116,105,111,110,32,67,104,105,112,0,86,111,
+    111,100,111,111,50,0,86,111,111,100,111,111,32,50,32,51,68,32,65,99,
+    99,101,108,101,114,97,116,111,114,0,86,111,111,100,111,111,32,66,97,110,
+    115,104,101,101,0,86,111,111,100,111,111,51,0,65,108,108,32,86,111,111,
+    100,111,111,51,32,99,104,105,112,115,44,32,51,48,48,48,0,86,111,111,
+    100,111,111,52,0,86,111,111,100,111,111,53,0,82,97,109,112,97,103,101,
+    0,82,101,118,46,65,32,65,71,80,120,52,44,32,48,46,50,53,-62,-75,
+    44,32,50,48,48,47,50,120,50,48,48,32,99,111,114,101,47,82,65,77,
+    0,86,111,111,100,111,111,32,51,47,51,48,48,48,0,65,118,101,110,103,
+    101,114,0,57,54,50,50,113,97,99,0,65,77,67,67,32,53,57,51,51,
+    32,84,77,83,51,50,48,67,56,48,32,68,83,80,47,73,109,97,103,105,
+    110,103,32,66,111,97,114,100,0,75,97,116,97,110,97,81,112,0,82,101,
+    97,108,45,84,105,109,101,32,80,114,111,99,101,115,115,105,110,103,32,66,
+    108,97,100,101,32,105,110,32,97,32,115,116,97,110,100,97,114,100,32,115,
+    105,110,103,108,101,45,115,108,111,116,32,65,100,118,97,110,99,101,100,84,
+    67,65,-62,-82,32,102,111,114,109,102,97,99,116,111,114,0,75,111,115,97,
+    105,80,77,0,73,110,116,101,108,-62,-82,32,80,101,110,116,105,117,109,45,
+    77,-62,-82,32,98,97,115,101,100,32,65,77,67,32,77,111,100,117,108,101,
+    0,75,97,116,97,110,97,51,55,53,50,0,65,100,118,97,110,99,101,100,
+    32,84,114,105,45,80,114,111,99,101,115,115,111,114,32,66,108,97,100,101,
+    0,75,97,116,97,110,97,51,55,53,48,0,75,97,116,97,110,97,55,53,
+    50,105,0,82,101,97,108,45,116,105,109,101,32,80,114,111,99,101,115,115,
+    105,110,103,32,66,108,97,100,101,0,75,97,116,97,110,97,55,53,48,105,
+    0,67,67,49,48,48,48,100,109,0,80,114,111,99,101,115,115,111,114,32,
+    80,77,67,32,67,97,114,114,105,101,114,32,67,97,114,100,0,80,109,51,
+    71,118,0,85,112,32,116,111,32,56,32,69,49,47,84,49,47,74,49,32,
+    105,110,116,101,114,102,97,99,101,115,32,102,111,114,32,80,77,67,45,99,
+    111,109,112,97,116,105,98,108,101,32,98,97,115,101,98,111,97,114,100,115,
+    0,80,109,51,71,69,49,84,49,0,84,104,105,114,100,32,71,101,110,101,
+    114,97,116,105,111,110,32,69,49,32,97,110,100,32,84,49,47,74,49,32,
+    105,110,116,101,114,102,97,99,101,115,32,102,111,114,32,80,77,67,45,99,
+    111,109,112,97,116,105,98,108,101,32,98,97,115,101,98,111,97,114,100,115,
+    0,83,112,105,100,101,114,119,97,114,101,83,71,0,83,73,71,84,82,65,
+    78,32,83,105,103,110,97,108,108,105,110,103,32,71,97,116,101,119,97,121,
+    32,66,108,97,100,101,0,83,112,105,100,101,114,119,97,114,101,83,83,55,
+    0,54,52,32,83,83,55,32,115,105,103,110,97,108,105,110,103,32,99,104,
+    97,110,110,101,108,115,32,111,110,32,97,32,115,105,110,103,108,101,32,98,
+    108,97,100,101,0,83,112,105,100,101,114,83,83,55,0,80,111,114,116,97,
+    98,108,101,44,32,83,84,82,69,65,77,83,45,66,97,115,101,100,32,73,
+    109,112,108,101,109,101,110,116,97,116,105,111,110,32,111,102,32,116,104,101,
+    32,73,84,85,32,83,83,55,32,80,114,111,116,111,99,111,108,32,83,116,
+    97,99,107,0,83,112,105,100,101,114,32,70,82,65,77,69,32,82,69,76,
+    65,89,0,83,84,82,69,65,77,83,45,66,97,115,101,100,32,70,114,97,
+    109,101,32,82,101,108,97,121,32,73,109,112,108,101,109,101,110,116,97,116,
+    105,111,110,0,83,112,105,100,101,114,32,83,84,82,69,65,77,83,0,73,
+    109,112,108,101,109,101,110,116,97,116,105,111,110,32,111,102,32,116,104,101,
+    32,85,78,73,88,32,83,84,82,69,65,77,83,32,69,110,118,105,114,111,
+    110,109,101,110,116,0,83,112,105,100,101,114,32,68,83,70,0,84,114,97,
+    110,115,112,97,114,101,110,116,32,83,84,82,69,65,77,83,32,73,110,116,
+    101,114,102,97,99,101,32,102,111,114,32,72,105,103,104,32,83,112,101,101,
+    100,32,76,65,78,32,111,114,32,83,104,97,114,101,100,32,77,101,109,111,
+    114,121,32,83,121,115,116,101,109,115,0,77,101,109,111,114,121,32,99,111,
+    110,116,114,111,108,108,101,114,0,67,76,53,54,48,63,0,80,108,117,109,
+    32,65,117,100,105,111,44,32,86,105,100,101,111,32,97,110,100,32,86,84,
+    82,32,67,111,110,116,114,111,108,108,101,114,0,73,67,72,50,0,65,115,
+    117,115,0,77,82,50,56,48,48,87,0,65,77,82,32,53,54,75,32,109,
+    111,100,101,109,0,80,67,73,49,54,56,47,51,51,50,56,0,82,101,97,
+    108,77,97,103,105,99,54,52,47,71,88,0,83,68,54,52,50,53,0,82,
+    101,97,108,77,97,103,105,99,47,50,68,0,82,69,65,76,109,97,103,105,
+    99,54,52,47,71,88,0,71,85,73,0,114,101,97,108,109,97,103,105,99,
+    54,52,47,103,120,0,115,100,54,52,50,53,0,80,67,73,45,68,86,0,
+    80,67,73,45,68,86,32,68,105,103,105,116,97,108,32,86,105,100,101,111,
+    32,73,110,116,101,114,102,97,99,101,0,99,108,32,52,56,48,0,77,80,
+    69,71,0,49,50,46,48,51,0,68,86,68,32,100,101,118,105,99,101,0,
+    49,55,54,0,105,56,52,53,69,0,99,80,69,71,32,67,32,51,46,48,
+    32,68,86,68,47,77,80,69,71,50,32,68,101,99,111,100,101,114,0,107,
+    101,121,98,111,97,114,100,0,74,78,73,67,45,49,52,54,48,0,50,45,
+    71,98,47,115,32,70,105,98,114,101,32,67,104,97,110,110,101,108,45,80,
+    67,73,32,54,52,45,98,105,116,32,54,54,32,77,72,122,0,74,78,73,
+    67,45,49,53,54,48,0,68,117,97,108,32,67,104,97,110,110,101,108,32,
+    50,32,71,98,47,115,32,70,105,98,114,101,32,67,104,97,110,110,101,108,
+    45,80,67,73,45,88,0,74,78,73,32,80,67,73,32,54,52,45,98,105,
+    116,32,70,105,98,114,101,99,104,97,110,110,101,108,0,74,78,73,32,80,
+    67,73,32,54,52,45,98,105,116,32,70,105,98,114,101,99,104,97,110,110,
+    101,108,32,40,110,101,101,100,115,32,99,108,111,110,101,41,0,66,49,0,
+    73,83,68,78,32,99,111,110,116,114,111,108,108,101,114,0,67,52,0,65,
+    49,0,70,114,105,116,122,33,80,67,73,32,50,46,48,32,73,83,68,78,
+    32,67,111,110,116,114,111,108,108,101,114,0,67,50,0,84,49,0,69,49,
+    51,32,51,50,65,53,75,89,87,32,47,32,50,67,65,75,82,67,84,0,
+    68,83,80,32,84,78,69,84,68,53,49,48,48,71,72,75,32,47,32,84,
+    78,69,84,68,53,48,49,53,0,69,97,115,121,67,111,110,110,101,99,116,
+    32,56,47,51,50,0,69,97,115,121,67,111,110,110,101,99,116,32,56,47,
+    54,52,0,69,97,115,121,73,79,32,80,67,73,0,73,70,84,45,50,48,
+    48,48,0,80,67,73,32,82,65,73,68,32,67,111,110,116,114,111,108,108,
+    101,114,0,77,80,69,71,32,70,111,114,103,101,0,77,80,69,71,32,70,
+    117,115,105,111,110,0,86,105,100,101,111,80,108,101,120,45,112,99,105,0,
+    86,105,100,101,111,80,108,101,120,32,112,99,105,32,98,112,99,49,56,50,
+    53,32,114,101,118,32,97,0,86,105,100,101,111,80,108,101,120,32,112,108,
+    117,115,0,86,105,100,101,111,80,108,101,120,32,66,80,67,32,49,56,53,
+    49,32,65,0,86,105,100,101,111,81,117,101,115,116,0,80,67,73,45,50,
+    50,52,48,105,0,69,73,68,69,32,65,100,97,112,116,101,114,0,80,67,
+    73,45,50,50,50,48,105,0,68,97,108,101,32,69,73,68,69,32,65,100,
+    97,112,116,101,114,0,80,67,73,45,50,48,48,48,0,73,110,116,101,108,
+    108,105,67,97,99,104,101,32,83,67,83,73,32,65,100,97,112,116,101,114,
+    0,82,101,97,108,116,101,107,32,56,49,51,57,98,0,65,84,45,50,53,
+    54,48,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,65,100,97,
+    112,116,101,114,32,40,105,56,50,53,53,55,66,41,0,82,101,97,108,116,
+    101,107,32,56,49,54,57,83,0,65,88,56,56,55,55,50,0,85,83,66,
+    50,46,48,32,116,111,32,49,48,47,49,48,48,77,32,70,97,115,116,32,
+    69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,0,
+    65,88,56,56,49,52,48,65,0,65,83,73,88,32,65,88,56,56,49,52,
+    48,32,66,97,115,101,100,32,80,67,73,32,70,97,115,116,32,69,116,104,
+    101,114,110,101,116,32,65,100,97,112,116,101,114,0,65,88,56,56,49,55,
+    50,0,85,83,66,50,32,116,111,32,70,97,115,116,32,69,116,104,101,114,
+    110,101,116,32,65,100,97,112,116,101,114,0,69,83,83,51,51,54,72,0,
+    80,67,73,32,70,97,120,32,77,111,100,101,109,32,40,101,97,114,108,121,
+    32,109,111,100,101,108,41,0,69,83,83,32,83,111,108,111,45,49,32,83,
+    111,117,110,100,99,97,114,100,0,69,83,50,56,51,57,0,77,97,101,115,
+    116,114,111,45,50,32,80,67,73,32,97,117,100,105,111,32,97,99,99,101,
+    108,101,114,97,116,111,114,0,69,83,55,50,50,50,50,0,83,111,108,111,
+    45,49,32,80,67,73,32,65,117,100,105,111,68,114,105,118,101,32,102,97,
+    109,105,108,121,0,69,83,49,57,55,56,0,69,83,83,32,77,97,101,115,
+    116,114,111,45,50,69,32,80,67,73,32,65,117,100,105,111,100,114,105,118,
+    101,0,69,83,49,57,56,56,0,69,83,83,32,65,108,108,101,103,114,111,
+    32,80,67,73,32,65,117,100,105,111,32,40,87,68,77,41,0,69,83,49,
+    57,56,57,0,77,97,101,115,116,114,111,45,51,32,40,65,108,101,103,114,
+    111,41,32,110,111,116,101,98,111,111,107,39,115,32,97,117,100,105,111,100,
+    114,105,118,101,0,69,83,50,56,57,56,83,0,77,97,101,115,116,114,111,
+    32,51,105,0,69,83,49,57,51,56,47,52,49,47,52,54,32,115,111,108,
+    111,32,97,117,100,105,111,0,77,97,101,115,116,114,111,45,51,46,67,79,
+    77,77,32,80,67,73,32,86,111,105,99,101,43,97,117,100,105,111,0,69,
+    83,51,51,54,72,0,80,67,73,32,70,97,120,32,77,111,100,101,109,32,
+    40,108,97,116,101,114,32,109,111,100,101,108,41,0,69,83,50,56,50,56,
+    83,0,84,101,108,101,68,114,105,118,101,0,69,83,53,54,72,45,80,73,
+    0,68,97,116,97,32,70,97,120,32,77,111,100,101,109,0,83,117,112,101,
+    114,108,105,110,107,32,77,111,100,101,109,47,86,46,57,50,32,99,104,105,
+    112,115,101,116,32,53,54,75,0,50,56,57,56,0,84,101,108,68,114,105,
+    118,101,32,69,83,53,54,84,45,80,73,32,102,97,109,105,108,121,32,86,
+    46,57,48,32,80,67,73,32,109,111,100,101,109,0,80,82,73,83,77,32,
+    51,0,76,65,78,45,69,120,112,114,101,115,115,32,73,69,69,69,32,56,
+    48,50,46,49,49,98,32,80,67,73,32,65,100,97,112,116,101,114,0,73,
+    83,76,51,56,55,52,65,0,80,82,73,83,77,73,73,46,53,32,73,69,
+    69,56,48,50,46,49,49,66,32,87,105,114,101,108,101,115,115,32,76,65,
+    78,0,73,83,76,51,56,57,48,0,80,82,73,83,77,32,71,84,32,56,
+    48,50,46,49,49,103,32,53,52,77,98,112,115,32,87,105,114,101,108,101,
+    115,115,32,67,111,110,116,114,111,108,108,101,114,0,72,77,80,56,49,51,
+    48,0,78,84,83,67,47,80,65,76,32,86,105,100,101,111,32,68,101,99,
+    111,100,101,114,0,72,77,80,56,49,51,49,0,78,69,49,48,47,49,48,
+    48,32,65,100,97,112,116,101,114,32,40,105,56,50,53,53,55,66,41,0,
+    78,69,50,48,48,48,80,108,117,115,32,40,82,84,56,48,50,57,41,32,
+    69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,114,0,78,73,67,
+    67,89,32,80,67,73,32,99,97,114,100,0,83,97,116,101,108,108,105,116,
+    101,32,114,101,99,101,105,118,101,114,32,98,111,97,114,100,32,47,32,77,
+    80,69,71,50,32,100,101,99,111,100,101,114,0,80,67,82,50,49,48,49,
+    0,116,101,108,115,97,116,116,117,114,98,111,0,84,101,107,116,114,111,110,
+    105,120,32,73,79,32,80,114,111,99,101,115,115,111,114,32,47,32,84,101,
+    107,116,114,111,110,105,120,32,80,67,73,32,65,99,113,117,105,115,105,116,
+    105,111,110,32,73,110,116,101,114,102,97,99,101,32,82,101,118,32,50,48,
+    52,0,101,45,109,111,98,105,108,105,116,121,32,56,48,50,46,49,49,98,
+    32,87,105,114,101,108,101,115,115,32,76,65,78,32,80,67,73,32,67,97,
+    114,100,0,83,77,55,49,48,0,76,121,110,120,69,77,0,83,77,55,49,
+    50,0,76,121,110,120,69,77,43,0,83,77,55,50,48,32,47,32,83,77,
+    55,50,50,0,76,121,110,120,51,68,77,0,83,77,56,49,48,0,76,121,
+    110,120,69,0,83,77,56,49,49,0,83,77,56,50,48,0,76,121,110,120,
+    51,68,0,83,77,57,49,48,0,83,73,76,73,67,79,78,32,77,79,84,
+    73,79,78,0,68,105,114,101,99,80,67,0,116,57,112,49,55,97,102,45,
+    48,49,0,53,56,56,48,120,0,109,117,108,116,105,109,101,100,105,97,32,
+    97,117,100,105,111,32,100,101,118,105,99,101,0,69,83,32,49,51,55,51,
+    0,65,117,100,105,111,80,67,73,0,69,83,49,51,55,51,0,83,111,117,
+    110,100,32,66,108,97,115,116,101,114,32,65,117,100,105,111,40,80,67,73,
+    41,0,65,117,100,105,111,80,99,105,0,84,80,69,51,47,84,77,51,0,
+    80,111,119,101,114,80,67,32,78,111,100,101,0,84,77,56,48,48,48,0,
+    69,102,102,105,99,101,111,110,32,86,105,114,116,117,97,108,32,78,111,114,
+    116,104,98,114,105,100,103,101,0,84,77,84,77,56,48,48,48,0,69,102,
+    102,105,99,101,111,110,32,65,71,80,32,66,114,105,100,103,101,0,86,105,
+    114,116,117,97,108,32,78,111,114,116,104,98,114,105,100,103,101,0,76,111,
+    110,103,82,117,110,0,83,68,82,65,77,32,67,111,110,116,114,111,108,108,
+    101,114,0,66,73,79,83,32,115,99,114,97,116,99,104,112,97,100,0,68,
+    77,57,48,48,57,0,68,77,57,49,48,50,47,65,47,65,70,0,49,48,
+    47,49,48,48,32,77,98,112,115,32,70,97,115,116,32,69,116,104,101,114,
+    110,101,116,32,67,111,110,116,114,111,108,108,101,114,0,73,84,56,49,53,
+    50,70,47,71,0,65,117,100,105,111,32,68,105,103,105,116,97,108,32,67,
+    111,110,116,114,111,108,108,101,114,0,73,84,56,51,51,48,71,0,65,100,
+    118,97,110,99,101,100,32,82,73,83,67,45,116,111,45,80,67,73,32,67,
+    111,109,112,97,110,105,111,110,32,67,104,105,112,0,73,84,56,49,55,50,
+    71,0,85,108,116,114,97,32,82,73,83,67,32,40,77,73,80,83,44,32,
+    83,72,52,41,32,67,111,109,112,97,110,105,111,110,32,67,104,105,112,0,
+    73,84,56,50,49,49,70,0,65,84,65,32,49,51,51,32,73,68,69,32,
+    67,111,110,116,114,111,108,108,101,114,0,73,84,56,50,49,50,70,0,65,
+    84,65,32,49,51,51,32,73,68,69,32,82,65,73,68,32,67,111,110,116,
+    114,111,108,108,101,114,0,73,84,56,56,55,49,47,55,50,0,80,67,73,
+    45,73,83,65,32,73,47,79,32,99,104,105,112,32,119,105,116,104,32,83,
+    77,66,32,38,97,109,112,59,32,80,97,114,97,108,108,101,108,32,80,111,
+    114,116,0,73,84,56,56,55,53,70,0,80,67,73,32,80,97,114,97,108,
+    108,101,108,32,80,111,114,116,0,73,84,56,56,56,56,70,0,80,67,73,
+    32,116,111,32,73,83,65,32,66,114,105,100,103,101,32,119,105,116,104,32,
+    83,77,66,0,73,84,56,56,56,57,70,0,115,111,117,110,100,0,80,67,
+    73,32,73,47,79,32,67,65,82,68,0,69,83,49,56,52,57,0,77,97,
+    101,115,116,114,111,45,49,32,65,117,100,105,111,68,114,105,118,101,0,76,
+    83,50,50,48,68,0,68,86,68,32,68,101,99,111,100,101,114,0,76,83,
+    50,50,48,67,0,76,83,50,52,50,0,77,80,69,71,47,68,86,68,32,
+    118,105,100,101,111,32,100,101,99,111,100,101,114,0,69,116,104,101,114,110,
+    101,116,32,49,48,47,49,48,48,0,65,115,97,110,116,101,70,65,83,84,
+    32,49,48,47,49,48,48,32,80,67,73,32,69,116,104,101,114,110,101,116,
+    32,65,100,97,112,116,101,114,0,80,66,84,45,52,49,53,0,80,67,73,
+    32,54,54,77,72,122,32,65,110,97,108,121,122,101,114,32,97,110,100,32,
+    51,51,77,72,122,32,69,120,101,114,99,105,115,101,114,0,80,66,84,45,
+    53,49,53,0,80,67,73,32,54,54,77,72,122,32,65,110,97,108,121,122,
+    101,114,32,97,110,100,32,69,120,101,114,99,105,115,101,114,0,80,66,84,
+    45,54,49,53,0,80,67,73,32,54,54,77,72,122,32,97,110,100,32,80,
+    67,73,45,88,32,49,48,48,77,72,122,32,66,117,115,32,65,110,97,108,
+    121,122,101,114,32,97,110,100,32,69,120,101,114,99,105,115,101,114,0,86,
+    97,110,103,117,97,114,100,32,80,67,73,47,80,77,67,47,99,80,67,73,
+    0,80,67,73,32,54,54,77,72,122,32,97,110,100,32,80,67,73,45,88,
+    32,49,51,51,77,72,122,32,66,117,115,32,65,110,97,108,121,122,101,114,
+    32,97,110,100,32,69,120,101,114,99,105,115,101,114,0,68,80,73,79,0,
+    68,105,103,105,116,97,108,32,80,97,114,97,108,108,101,108,32,73,110,112,
+    117,116,32,79,117,116,112,117,116,32,68,101,118,105,99,101,32,51,50,98,
+    105,116,44,32,51,51,77,72,122,32,80,67,73,32,98,117,115,0,68,80,
+    73,79,50,0,68,105,103,105,116,97,108,32,80,97,114,97,108,108,101,108,
+    32,73,110,112,117,116,32,79,117,116,112,117,116,32,68,101,118,105,99,101,
+    32,54,52,98,105,116,44,32,51,51,77,72,122,32,80,67,73,32,98,117,
+    115,0,68,80,73,79,50,45,54,54,0,68,105,103,105,116,97,108,32,80,
+    97,114,97,108,108,101,108,32,73,110,112,117,116,32,79,117,116,112,117,116,
+    32,68,101,118,105,99,101,32,54,52,98,105,116,44,32,54,54,77,72,122,
+    32,80,67,73,32,98,117,115,0,86,46,57,50,32,76,117,99,101,110,116,
+    32,77,111,100,101,109,0,87,97,110,52,48,53,0,87,65,78,105,99,32,
+    52,48,48,32,115,101,114,105,101,115,32,88,46,50,49,32,99,111,110,116,
+    114,111,108,108,101,114,0,78,65,73,32,72,83,83,73,32,83,110,105,102,
+    102,101,114,32,80,67,73,32,65,100,97,112,116,101,114,0,74,82,83,45,
+    51,68,83,49,48,48,0,51,67,57,56,54,0,65,67,69,110,105,99,32,
+    49,48,48,48,32,66,65,83,69,45,83,88,32,69,116,104,101,114,110,101,
+    116,32,97,100,97,112,116,101,114,0,51,67,57,56,54,45,84,0,67,111,
+    112,112,101,114,32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,
+    116,32,65,100,97,112,116,101,114,0,51,67,80,50,57,55,55,0,85,83,
+    32,82,111,98,111,116,105,99,115,32,53,54,75,32,70,97,120,32,80,67,
+    73,32,97,107,97,32,77,111,100,101,108,32,48,55,50,54,44,32,86,46,
+    57,48,32,53,54,75,32,73,110,116,101,114,110,97,108,32,70,97,120,109,
+    111,100,101,109,0,53,54,49,48,0,53,54,49,48,32,53,54,75,32,70,
+    97,120,77,111,100,101,109,32,87,105,110,77,111,100,101,109,0,65,68,49,
+    56,48,55,74,83,0,85,83,32,82,111,98,111,116,105,99,115,32,53,54,
+    75,32,68,65,84,65,32,70,65,88,32,87,73,78,77,79,68,69,77,0,
+    85,83,82,53,54,49,48,66,0,85,83,82,53,54,49,48,66,32,40,48,
+    48,48,53,54,49,48,45,48,50,41,32,53,54,75,32,80,101,114,102,111,
+    114,109,97,110,99,101,32,80,114,111,32,77,111,100,101,109,32,40,80,67,
+    73,32,73,110,116,101,114,110,97,108,41,0,72,97,109,109,101,114,104,101,
+    97,100,45,76,105,116,101,45,80,67,73,0,68,83,80,32,80,114,111,116,
+    111,116,121,112,105,110,103,32,38,97,109,112,59,32,68,101,118,101,108,111,
+    112,109,101,110,116,32,67,97,114,100,0,83,121,110,99,52,104,115,47,67,
+    67,80,47,80,67,73,47,77,80,0,67,111,109,109,117,110,105,99,97,116,
+    105,111,110,115,32,80,114,111,99,101,115,115,111,114,0,72,84,56,48,50,
+    51,50,0,76,65,78,32,65,100,97,112,116,101,114,32,40,78,69,50,48,
+    48,48,45,99,111,109,112,97,116,105,98,108,101,41,0,72,84,56,48,50,
+    50,57,0,69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,114,32,
+    40,78,69,50,48,48,48,45,99,111,109,112,97,116,105,98,108,101,41,0,
+    66,108,117,101,32,72,101,97,116,45,56,32,82,83,50,51,50,0,66,108,
+    117,101,72,101,97,116,32,56,32,80,111,114,116,32,82,83,50,51,50,32,
+    83,101,114,105,97,108,32,66,111,97,114,100,0,73,83,69,0,80,69,73,
+    32,73,109,97,103,105,110,103,32,83,117,98,115,121,115,116,101,109,32,69,
+    110,103,105,110,101,0,80,67,73,86,83,84,0,80,67,73,32,84,104,114,
+    101,115,104,111,108,100,105,110,103,32,69,110,103,105,110,101,0,86,105,100,
+    101,111,32,83,105,109,117,108,97,116,111,114,47,83,101,110,100,101,114,0,
+    84,72,82,50,0,77,117,108,116,105,45,115,99,97,108,101,32,84,104,114,
+    101,115,104,111,108,100,101,114,0,107,115,115,106,115,106,106,0,68,49,50,
+    48,74,67,84,45,76,83,32,67,97,114,100,0,66,82,73,47,50,32,84,
+    121,112,101,32,67,97,114,100,32,40,86,111,105,99,101,32,68,114,105,118,
+    101,114,41,0,68,47,50,52,48,74,67,84,45,84,49,32,67,97,114,100,
+    0,68,47,51,48,48,74,67,84,45,69,49,32,67,97,114,100,0,77,83,
+    73,32,80,67,73,32,67,97,114,100,0,66,82,73,47,49,54,48,45,80,
+    67,73,32,67,97,114,100,0,66,82,73,47,49,50,48,45,80,67,73,32,
+    67,97,114,100,0,66,82,73,47,56,48,45,80,67,73,32,67,97,114,100,
+    0,68,47,52,49,74,67,84,32,67,97,114,100,0,68,47,52,56,48,74,
+    67,84,45,50,84,49,32,67,97,114,100,0,68,47,54,48,48,74,67,84,
+    45,50,69,49,32,40,55,53,32,79,104,109,41,32,67,97,114,100,0,68,
+    47,54,48,48,74,67,84,45,50,69,49,0,68,105,97,108,111,103,105,99,
+    32,50,69,49,32,45,32,74,67,84,32,115,101,114,105,101,115,0,68,47,
+    51,50,48,74,67,84,32,40,82,101,115,111,117,114,99,101,32,79,110,108,
+    121,41,32,67,97,114,100,0,68,47,49,54,48,74,67,84,32,40,82,101,
+    115,111,117,114,99,101,32,79,110,108,121,41,32,67,97,114,100,0,83,116,
+    117,100,105,111,67,97,114,100,0,66,88,45,49,50,0,83,67,45,50,48,
+    48,48,0,76,88,45,52,52,0,83,67,45,50,50,0,66,88,45,52,52,
+    0,76,88,45,50,52,77,0,50,48,45,98,105,116,32,50,45,105,110,44,
+    32,52,45,111,117,116,32,97,117,100,105,111,32,99,97,114,100,32,119,47,
+    77,80,69,71,45,50,0,76,88,45,50,50,77,0,66,88,45,56,0,66,
+    88,45,49,50,101,0,69,80,49,83,0,83,83,55,32,84,101,108,101,99,
+    111,109,109,117,110,105,99,97,116,105,111,110,115,32,73,110,116,101,114,102,
+    97,99,101,32,65,100,97,112,116,101,114,0,77,65,80,45,67,65,0,66,
+    114,111,97,100,98,97,110,100,32,83,105,103,110,97,108,32,80,114,111,99,
+    101,115,115,111,114,0,77,65,80,45,49,48,48,48,0,68,105,103,105,116,
+    97,108,32,83,105,103,110,97,108,32,80,114,111,99,101,115,115,111,114,0,
+    80,73,55,67,55,51,48,48,0,51,32,80,111,114,116,32,80,67,73,32,
+    116,111,32,80,67,73,32,98,114,105,100,103,101,0,80,73,55,67,56,49,
+    53,48,0,50,45,80,111,114,116,32,80,67,73,32,116,111,32,80,67,73,
+    32,66,114,105,100,103,101,0,80,73,55,67,56,49,53,50,0,50,45,80,
+    111,114,116,32,80,67,73,45,84,111,45,80,67,73,32,66,114,105,100,103,
+    101,0,80,73,55,67,57,88,49,51,48,0,70,111,120,70,105,114,101,32,
+    73,73,0,67,114,121,112,116,111,115,119,105,102,116,32,50,48,48,0,73,
+    110,102,105,110,101,111,110,32,80,69,66,32,50,48,53,51,52,0,80,67,
+    73,32,67,111,110,116,114,111,108,108,101,114,0,83,84,49,54,67,54,53,
+    52,0,81,117,97,100,32,85,65,82,84,0,84,82,49,48,48,48,32,80,
+    82,73,0,80,82,73,32,67,111,110,116,114,111,108,108,101,114,0,84,82,
+    49,48,48,48,32,66,82,73,0,66,82,73,32,67,111,110,116,114,111,108,
+    108,101,114,0,65,85,56,56,50,48,0,86,111,114,116,101,120,32,49,32,
+    68,105,103,105,116,97,108,32,65,117,100,105,111,32,80,114,111,99,101,115,
+    115,111,114,0,65,85,56,56,51,48,65,50,0,86,111,114,116,101,120,32,
+    50,32,65,117,100,105,111,32,80,114,111,99,101,115,115,111,114,0,51,49,
+    50,69,66,38,97,109,112,59,82,69,86,50,0,65,117,114,101,97,108,32,
+    83,111,117,110,100,99,97,114,100,0,48,120,120,120,120,0,50,49,53,82,
+    65,65,71,67,71,65,49,49,70,0,71,114,97,112,105,99,115,32,82,97,
+    100,101,111,110,32,88,56,53,48,0,86,105,100,101,111,77,97,107,101,114,
+    0,115,51,32,116,114,105,111,0,80,67,73,45,52,56,56,32,71,80,73,
+    66,0,73,69,69,69,32,52,56,56,0,48,50,51,57,0,99,77,54,55,
+    32,67,111,109,112,97,99,116,80,67,73,32,68,83,80,32,67,97,114,100,
+    0,77,52,52,47,99,77,52,52,32,68,83,80,32,98,111,97,114,100,0,
+    81,117,97,116,116,114,111,54,120,32,68,83,80,32,98,111,97,114,100,0,
+    67,104,105,99,111,47,67,104,105,99,111,80,108,117,115,32,68,97,116,97,
+    32,65,99,113,117,105,115,105,116,105,111,110,32,66,111,97,114,100,0,67,
+    111,100,101,32,72,97,109,109,101,114,32,74,116,97,103,32,68,101,98,117,
+    103,103,101,114,32,98,111,97,114,100,0,77,97,116,97,100,111,114,32,68,
+    83,80,32,98,111,97,114,100,0,81,117,105,120,111,116,101,32,68,83,80,
+    32,98,111,97,114,100,0,81,117,97,100,105,97,32,67,54,52,120,32,68,
+    83,80,0,81,117,97,100,105,97,32,68,83,80,32,66,97,115,101,98,111,
+    97,114,100,0,80,67,73,45,68,65,83,49,54,48,50,47,49,54,0,80,
+    67,73,45,68,73,79,52,56,72,0,80,67,73,45,80,68,73,83,79,56,
+    0,80,67,73,45,80,68,73,83,79,49,54,0,80,67,73,45,68,65,83,
+    49,50,48,48,0,80,67,73,45,68,65,83,49,54,48,50,47,49,50,0,
+    80,67,73,45,68,73,79,50,52,72,0,80,67,73,45,68,73,79,50,52,
+    72,47,67,84,82,51,0,80,67,73,45,68,73,79,50,52,72,47,67,84,
+    82,49,54,0,80,67,73,45,68,73,79,57,54,72,0,80,67,73,45,67,
+    84,82,48,53,0,80,67,73,45,68,65,83,49,50,48,48,47,74,82,0,
+    80,67,73,45,68,65,83,49,48,48,49,0,80,67,73,45,68,65,83,49,
+    48,48,50,0,80,67,73,45,68,65,83,49,54,48,50,74,82,47,49,54,
+    0,80,67,73,45,68,65,83,54,52,48,50,47,49,54,0,80,67,73,45,
+    68,65,83,54,52,48,50,47,49,50,0,80,67,73,45,68,65,83,49,54,
+    47,77,49,0,80,67,73,45,68,68,65,48,50,47,49,50,0,80,67,73,
+    45,68,68,65,48,52,47,49,50,0,80,67,73,45,68,68,65,48,56,47,
+    49,50,0,80,67,73,45,68,68,65,48,50,47,49,54,0,80,67,73,45,
+    68,68,65,48,52,47,49,54,0,80,67,73,45,68,68,65,48,56,47,49,
+    54,0,80,67,73,45,68,65,67,48,52,47,49,50,45,72,83,0,80,67,
+    73,45,68,65,67,48,52,47,49,54,45,72,83,0,80,67,73,45,68,73,
+    79,50,52,0,50,52,32,66,105,116,32,68,105,103,105,116,97,108,32,73,
+    110,112,117,116,47,79,117,116,112,117,116,32,66,111,97,114,100,0,80,67,
+    73,45,68,65,83,48,56,0,80,67,73,45,73,78,84,51,50,0,80,67,
+    73,45,68,85,65,76,45,65,67,53,0,80,67,73,45,68,65,83,45,84,
+    67,0,80,67,73,45,68,65,83,54,52,47,77,49,47,49,54,0,80,67,
+    73,45,68,65,83,54,52,47,77,50,47,49,54,0,80,67,73,45,68,65,
+    83,54,52,47,77,51,47,49,54,0,80,67,73,45,68,65,83,49,48,48,
+    48,0,80,67,73,45,81,85,65,68,48,52,0,80,67,73,45,67,84,82,
+    49,48,0,49,48,32,99,104,97,110,110,101,108,115,44,32,49,54,32,98,
+    105,116,32,99,111,117,110,116,101,114,47,116,105,109,101,114,32,119,105,116,
+    104,32,51,50,45,66,105,116,115,32,111,102,32,68,105,103,105,116,97,108,
+    32,73,47,79,0,78,101,116,67,101,108,101,114,97,116,111,114,32,65,100,
+    97,112,116,101,114,0,57,48,54,48,0,67,111,109,112,97,99,116,80,67,
+    73,32,73,110,116,101,114,102,97,99,101,0,70,80,71,65,32,80,67,73,
+    32,66,114,105,100,103,101,0,110,109,48,52,48,51,65,48,51,52,54,49,
+    72,49,50,49,83,49,50,50,80,0,65,68,77,116,101,99,107,32,65,78,
+    57,56,54,0,65,78,57,56,49,0,70,97,115,116,78,73,67,32,49,48,
+    47,49,48,48,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,65,
+    100,97,112,116,101,114,0,97,110,57,56,51,98,0,65,78,57,56,53,0,
+    67,97,114,100,66,117,115,32,49,48,47,49,48,48,32,70,97,115,116,32,
+    69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,0,
+    48,49,54,0,72,83,80,53,54,32,77,105,99,114,111,77,111,100,101,109,
+    0,65,68,77,53,49,50,48,0,65,68,77,116,101,107,32,65,68,77,53,
+    49,50,48,32,83,79,67,32,40,114,101,118,58,32,48,41,0,80,67,84,
+    32,55,56,57,84,45,65,0,65,68,77,56,50,49,49,0,56,48,50,46,
+    49,49,98,32,87,105,114,101,108,101,115,115,32,80,67,73,32,67,97,114,
+    100,0,65,68,77,57,53,49,49,0,80,67,73,32,49,48,47,49,48,48,
+    32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,65,100,97,112,116,
+    101,114,0,65,68,77,57,53,49,51,0,71,45,78,73,67,32,73,73,0,
+    49,48,48,48,66,84,32,78,101,116,119,111,114,107,32,73,110,116,101,114,
+    102,97,99,101,32,67,97,114,100,0,70,77,48,56,48,49,0,80,67,73,
+    32,67,97,114,100,32,77,101,100,105,97,70,111,114,116,101,32,109,97,100,
+    101,32,105,110,32,115,105,110,103,97,112,111,114,101,0,70,77,56,48,49,
+    45,97,115,0,88,119,97,118,101,32,80,67,73,32,74,111,121,115,116,105,
+    99,107,0,70,77,56,48,49,0,80,67,73,32,74,111,121,115,116,105,99,
+    107,0,70,77,48,56,48,49,45,97,115,0,88,119,97,118,101,32,80,67,
+    73,32,97,117,100,105,111,32,99,111,110,116,114,111,108,108,101,114,0,70,
+    77,56,48,49,45,65,85,0,70,111,114,116,101,77,101,100,105,97,32,80,
+    67,73,32,65,117,100,105,111,32,67,97,114,100,0,67,121,98,101,114,83,
+    101,114,105,97,108,32,49,54,56,53,48,0,68,117,101,116,32,49,83,40,
+    49,54,54,53,48,41,43,49,80,0,68,117,101,116,32,49,83,40,49,54,
+    56,53,48,41,43,49,80,0,83,73,73,71,32,99,121,98,101,114,56,48,
+    48,48,0,67,111,109,109,117,110,105,99,97,116,105,111,110,32,99,111,110,
+    116,114,111,108,108,101,114,0,84,114,105,111,32,49,83,40,49,54,56,53,
+    48,41,43,50,80,0,83,105,105,103,32,73,110,99,32,67,121,98,101,114,
+    83,101,114,105,97,108,32,40,52,45,112,111,114,116,41,32,49,54,53,53,
+    48,0,67,121,98,101,114,83,101,114,105,97,108,32,49,54,54,53,48,0,
+    84,114,105,111,32,50,83,40,49,54,53,53,48,41,43,49,80,0,84,114,
+    105,111,32,50,83,40,49,54,54,53,48,41,43,49,80,0,84,114,105,111,
+    32,50,83,40,49,54,56,53,48,41,43,49,80,0,114,101,118,32,49,46,
+    53,0,99,80,69,71,-30,-124,-94,32,67,32,51,46,48,32,68,86,68,47,
+    77,80,69,71,50,32,100,101,99,111,100,101,114,0,77,77,45,53,52,49,
+    48,68,0,80,67,73,32,51,50,98,105,116,32,66,117,108,107,32,77,101,
+    109,111,114,121,32,119,47,68,77,65,0,77,77,45,53,52,49,53,67,78,
+    0,80,67,73,32,66,97,116,116,101,114,121,32,66,97,99,107,101,100,32,
+    83,68,82,65,77,32,65,100,97,112,116,101,114,0,77,77,45,53,52,50,
+    53,67,78,0,80,67,73,32,77,101,109,111,114,121,32,77,111,100,117,108,
+    101,32,119,105,116,104,32,66,97,116,116,101,114,121,32,66,97,99,107,117,
+    112,0,77,77,45,54,49,52,48,68,0,77,101,109,111,114,121,32,77,111,
+    100,117,108,101,0,83,83,84,45,53,49,51,54,45,80,70,66,45,80,67,
+    73,0,73,110,100,117,115,116,114,105,97,108,32,73,47,79,32,67,97,114,
+    100,0,67,111,112,112,101,114,72,101,97,100,32,67,111,112,112,101,114,84,
+    97,105,108,32,83,67,49,32,65,77,67,32,65,67,57,55,0,77,84,56,
+    76,76,78,50,49,80,65,68,70,0,50,49,80,65,68,0,77,84,55,76,
+    76,78,50,50,78,67,78,69,0,67,111,112,112,101,114,72,101,97,100,32,
+    67,111,112,112,101,114,84,97,105,108,32,83,67,49,32,73,68,69,32,67,
+    111,110,116,114,111,108,108,101,114,0,67,111,112,112,101,114,72,101,97,100,
+    32,67,111,112,112,101,114,84,97,105,108,32,83,67,49,32,85,83,66,32,
+    67,111,110,116,114,111,108,108,101,114,0,70,48,49,32,50,65,83,86,49,
+    55,49,56,52,46,49,0,68,111,109,101,120,32,68,77,88,32,51,49,57,
+    49,32,80,67,73,32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,
+    114,0,68,111,109,101,120,32,68,77,88,51,49,57,50,85,47,51,49,57,
+    52,85,80,32,83,67,83,73,32,65,100,97,112,116,101,114,0,68,84,67,
+    53,48,67,49,56,0,115,99,115,105,0,102,97,56,50,53,51,55,101,112,
+    0,105,110,116,101,114,0,72,83,80,54,56,56,84,0,56,50,53,51,55,
+    0,86,46,57,50,32,77,68,67,32,77,111,100,101,109,0,80,67,84,32,
+    55,56,57,84,0,72,83,80,32,77,105,99,114,111,77,111,100,101,109,32,
+    53,54,0,83,57,49,49,32,75,48,49,55,0,70,84,49,51,0,80,67,
+    84,55,56,57,84,0,112,99,116,55,56,57,116,45,99,0,57,55,56,54,
+    48,57,54,51,0,72,83,80,32,77,105,99,114,111,77,111,100,101,109,32,
+    53,54,47,80,67,84,55,56,57,84,0,80,67,84,32,50,56,56,45,49,
+    65,0,112,99,116,51,56,56,112,45,97,0,112,99,116,101,108,32,53,54,
+    107,32,109,111,100,101,109,0,80,76,88,57,48,53,48,0,80,76,88,32,
+    80,67,73,32,66,117,115,32,76,111,103,105,99,0,53,49,48,49,0,82,
+    111,117,116,101,32,53,54,0,80,67,73,45,65,67,66,0,82,83,45,50,
+    51,50,32,115,121,110,99,104,114,111,110,111,117,115,32,99,97,114,100,0,
+    83,105,110,103,108,101,32,80,111,114,116,32,82,83,45,50,51,50,47,52,
+    50,50,47,52,56,53,47,53,50,48,0,68,117,97,108,32,80,111,114,116,
+    32,82,83,45,50,51,50,47,52,50,50,47,52,56,53,32,73,110,116,101,
+    114,102,97,99,101,0,68,117,97,108,32,80,111,114,116,32,82,83,45,50,
+    51,50,32,73,110,116,101,114,102,97,99,101,0,70,111,117,114,32,80,111,
+    114,116,32,82,83,45,50,51,50,32,73,110,116,101,114,102,97,99,101,0,
+    70,111,117,114,32,80,111,114,116,32,82,83,45,52,50,50,47,52,56,53,
+    32,73,110,116,101,114,102,97,99,101,0,69,105,103,104,116,32,80,111,114,
+    116,32,82,83,45,50,51,50,32,73,110,116,101,114,102,97,99,101,0,56,
+    48,48,49,0,68,105,103,105,116,97,108,32,73,47,79,32,65,100,97,112,
+    116,101,114,0,80,67,73,51,50,0,68,67,70,55,55,32,82,97,100,105,
+    111,32,67,108,111,99,107,0,80,67,73,53,48,57,0,80,67,73,53,49,
+    48,0,80,67,73,53,49,49,0,80,69,88,53,49,49,0,68,67,70,55,
+    55,32,82,101,99,101,105,118,101,114,0,71,80,83,49,54,55,80,67,73,
+    0,71,80,83,32,82,101,99,101,105,118,101,114,0,71,80,83,49,54,56,
+    80,67,73,0,71,80,83,49,54,57,80,67,73,0,71,80,83,49,55,48,
+    80,67,73,0,71,80,83,49,55,48,80,69,88,0,84,67,82,53,49,48,
+    80,67,73,0,73,82,73,71,32,84,105,109,101,99,111,100,101,32,82,101,
+    97,100,101,114,0,84,67,82,49,54,55,80,67,73,0,84,67,82,53,49,
+    49,80,67,73,0,84,67,82,53,49,49,80,69,88,0,73,82,73,71,32,
+    84,105,109,101,99,111,100,101,32,82,101,99,101,105,118,101,114,0,72,89,
+    83,68,78,0,80,76,88,32,84,69,67,72,78,79,76,79,71,89,32,10,
+    32,80,67,73,57,48,53,50,32,10,32,48,52,51,53,32,10,32,66,88,
+    57,52,57,55,46,49,32,77,65,76,65,0,83,69,75,39,68,32,80,114,
+    111,100,105,102,32,57,54,32,80,114,111,32,45,32,112,114,111,102,101,115,
+    115,105,111,110,97,108,32,97,117,100,105,111,32,99,97,114,100,0,80,114,
+    111,100,105,102,32,80,108,117,115,32,115,111,117,110,100,32,99,97,114,100,
+    0,77,97,114,99,32,56,32,77,105,100,105,0,56,45,105,110,44,32,56,
+    45,111,117,116,32,115,111,117,110,100,32,99,97,114,100,0,77,65,51,48,
+    49,0,56,48,50,46,49,49,98,32,87,105,114,101,108,101,115,115,32,65,
+    100,97,112,116,101,114,0,71,65,54,50,48,0,71,65,54,50,50,0,71,
+    65,54,51,48,0,71,65,51,49,49,0,70,65,51,49,49,0,83,67,82,
+    65,77,78,101,116,32,71,84,50,48,48,0,80,67,73,49,53,48,48,80,
+    70,66,0,73,110,116,101,108,108,105,103,101,110,116,32,102,105,101,108,100,
+    98,117,115,32,65,100,97,112,116,101,114,0,80,67,73,45,67,65,78,73,
+    79,0,80,67,73,45,67,65,78,73,79,32,97,100,97,112,116,101,114,0,
+    67,49,48,52,72,47,80,67,73,0,83,109,97,114,116,105,111,0,67,80,
+    45,49,51,50,0,73,110,100,117,115,116,105,111,0,67,49,54,56,72,47,
+    80,67,73,0,67,80,45,49,54,56,85,0,67,80,45,49,54,56,85,32,
+    83,109,97,114,116,32,83,101,114,105,97,108,32,66,111,97,114,100,0,67,
+    80,45,50,48,52,74,0,73,110,116,101,108,108,105,111,0,67,50,49,56,
+    0,73,110,116,101,108,108,105,111,32,84,117,114,98,111,32,80,67,73,0,
+    45,45,45,0,67,51,50,48,0,48,120,48,48,48,48,0,100,118,114,32,
+    99,97,112,116,117,114,101,32,99,97,114,100,0,76,88,84,49,48,48,49,
+    0,72,70,67,45,56,83,32,49,54,66,56,68,56,83,48,0,73,83,68,
+    78,32,72,68,76,67,32,70,73,70,79,32,67,111,110,116,114,111,108,108,
+    101,114,0,72,70,67,45,80,67,73,32,65,32,73,83,68,78,32,50,66,
+    68,83,48,0,72,70,67,45,52,83,32,73,83,68,78,32,56,66,52,68,
+    52,83,48,0,66,48,48,48,0,72,67,70,45,80,67,73,32,99,97,114,
+    100,0,66,48,48,54,0,66,48,48,55,0,66,48,48,56,0,66,48,48,
+    57,0,66,48,48,65,0,66,48,48,66,0,66,48,48,67,0,66,49,48,
+    48,0,83,69,83,50,48,48,48,0,65,108,97,99,114,105,116,101,99,104,
+    32,105,83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,55,55,
+    53,49,0,83,101,99,117,114,105,116,121,32,80,114,111,99,101,115,115,111,
+    114,0,54,53,48,48,0,80,117,98,108,105,99,32,75,101,121,32,80,114,
+    111,99,101,115,115,111,114,0,55,56,49,49,0,55,57,53,49,0,55,56,
+    49,52,47,55,56,53,49,47,55,56,53,52,0,56,48,54,53,0,56,49,
+    54,53,0,56,49,53,52,0,55,57,53,54,0,67,114,121,112,116,111,103,
+    114,97,112,104,105,99,32,80,114,111,99,101,115,115,111,114,0,55,57,53,
+    52,47,55,57,53,53,0,78,101,116,119,111,114,107,32,67,111,110,116,114,
+    111,108,108,101,114,0,66,83,82,86,50,45,51,48,49,65,0,88,82,49,
+    55,67,49,53,50,0,68,117,97,108,32,85,65,82,84,0,88,82,49,55,
+    67,49,53,52,0,70,111,117,114,32,67,104,97,110,110,101,108,32,80,67,
+    73,32,66,117,115,32,85,65,82,84,0,88,82,49,55,67,49,53,56,0,
+    69,105,103,104,116,32,67,104,97,110,110,101,108,32,80,67,73,32,66,117,
+    115,32,85,65,82,84,32,40,53,86,41,0,48,120,49,51,98,54,0,115,
+    103,117,105,117,0,83,121,110,99,76,105,110,107,32,65,100,97,112,116,101,
+    114,0,115,105,110,103,108,101,32,112,111,114,116,32,109,117,108,116,105,112,
+    114,111,116,111,99,111,108,32,115,101,114,105,97,108,32,97,100,97,112,116,
+    101,114,0,83,121,110,99,76,105,110,107,32,83,67,67,0,108,111,119,32,
+    115,112,101,101,100,32,115,105,110,103,108,101,32,112,111,114,116,32,109,117,
+    108,116,105,112,114,111,116,111,99,111,108,32,115,101,114,105,97,108,32,97,
+    100,97,112,116,101,114,0,83,121,110,99,76,105,110,107,32,52,32,80,111,
+    114,116,32,65,100,97,112,116,101,114,0,52,32,112,111,114,116,32,109,117,
+    108,116,105,112,114,111,116,111,99,111,108,32,115,101,114,105,97,108,32,97,
+    100,97,112,116,101,114,0,83,121,110,99,76,105,110,107,32,71,84,32,65,
+    100,97,112,116,101,114,0,83,121,110,99,76,105,110,107,32,71,84,52,32,
+    65,100,97,112,116,101,114,0,83,121,110,99,76,105,110,107,32,65,67,32,
+    65,100,97,112,116,101,114,0,111,110,101,32,112,111,114,116,32,97,115,121,
+    110,99,104,114,111,110,111,117,115,32,115,101,114,105,97,108,32,97,100,97,
+    112,116,101,114,0,83,121,110,99,76,105,110,107,32,71,84,50,32,65,100,
+    97,112,116,101,114,0,50,32,112,111,114,116,32,109,117,108,116,105,112,114,
+    111,116,111,99,111,108,32,115,101,114,105,97,108,32,97,100,97,112,116,101,
+    114,0,83,121,110,99,76,105,110,107,32,83,101,114,105,97,108,32,65,100,
+    97,112,116,101,114,32,118,101,114,115,105,111,110,32,50,0,57,53,52,56,
+    113,97,100,0,65,84,65,45,82,65,73,68,32,67,111,110,116,114,111,108,
+    108,101,114,0,55,48,48,48,47,56,48,48,48,32,115,101,114,105,101,115,
+    0,65,84,65,45,49,51,51,32,83,116,111,114,97,103,101,32,67,111,110,
+    116,114,111,108,108,101,114,0,57,48,48,48,32,115,101,114,105,101,115,0,
+    83,65,84,65,47,80,65,84,65,32,83,116,111,114,97,103,101,32,67,111,
+    110,116,114,111,108,108,101,114,0,57,53,53,48,83,88,47,57,53,57,48,
+    83,69,32,83,101,114,105,101,115,0,83,65,84,65,50,32,82,97,105,100,
+    32,67,111,110,116,114,111,108,108,101,114,0,57,54,53,48,83,69,32,83,
+    101,114,105,101,115,0,80,67,73,45,69,120,112,114,101,115,115,32,83,65,
+    84,65,50,32,82,97,105,100,32,67,111,110,116,114,111,108,108,101,114,0,
+    77,117,108,116,105,45,70,117,110,99,116,105,111,110,32,65,110,97,108,111,
+    103,117,101,47,68,105,103,105,116,97,108,32,73,79,32,99,97,114,100,0,
+    46,0,80,97,114,97,108,108,101,108,32,73,47,79,32,67,97,114,100,0,
+    68,105,103,105,116,97,108,32,73,47,79,32,67,97,114,100,0,87,97,116,
+    99,104,100,111,103,32,67,97,114,100,0,84,50,50,56,53,48,50,0,66,
+    50,67,50,32,83,107,121,50,80,67,32,67,111,114,101,32,67,104,105,112,
+    32,115,107,121,32,115,116,97,114,32,50,32,38,108,116,59,116,101,99,104,
+    110,105,115,97,116,38,103,116,59,0,70,69,50,48,48,48,86,88,0,67,
+    97,114,100,66,117,115,32,47,65,116,101,108,99,111,32,70,105,98,114,101,
+    108,105,110,101,32,69,116,104,101,114,110,101,116,32,65,100,112,116,114,0,
+    83,77,67,56,48,51,53,84,88,0,69,90,32,67,97,114,100,-30,-124,-94,
+    32,49,48,47,49,48,48,32,70,97,115,116,32,69,116,104,101,114,110,101,
+    116,32,67,97,114,100,66,117,115,32,65,100,97,112,116,101,114,0,97,99,
+    57,55,0,110,111,116,101,0,80,67,73,53,54,82,86,80,0,68,83,51,
+    49,51,49,0,66,111,83,83,32,66,105,116,32,83,121,110,99,104,114,111,
+    110,111,117,115,32,72,68,76,67,32,67,111,110,116,114,111,108,108,101,114,
+    0,68,83,51,49,51,52,0,67,104,97,116,101,97,117,32,67,104,97,110,
+    110,101,108,105,122,101,100,32,84,49,47,69,49,47,72,68,76,67,32,67,
+    111,110,116,114,111,108,108,101,114,0,70,70,75,32,56,53,48,56,0,69,
+    110,99,111,114,101,32,69,78,76,56,51,50,45,84,88,45,73,67,78,84,
+    32,70,97,115,116,32,32,69,116,104,101,114,110,101,116,32,80,67,73,32,
+    65,100,97,112,116,101,114,0,83,84,50,48,49,0,70,97,115,116,32,69,
+    104,116,101,114,110,101,116,32,65,100,97,112,116,101,114,0,78,88,49,48,
+    48,49,0,78,101,116,119,111,114,107,32,65,100,97,112,116,101,114,0,78,
+    88,49,49,48,49,0,45,80,67,73,92,86,69,78,95,49,51,70,48,38,
+    97,109,112,59,68,69,86,95,49,48,50,51,38,97,109,112,59,83,85,66,
+    83,89,83,95,56,49,56,48,49,48,52,51,38,97,109,112,59,82,69,86,
+    95,52,49,92,52,38,97,109,112,59,66,67,0,83,84,50,48,49,32,70,
+    97,115,116,32,69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,114,
+    0,67,77,73,56,51,51,56,47,80,67,73,32,67,51,68,88,0,67,77,
+    73,56,51,51,56,45,48,51,49,0,80,67,73,32,65,117,100,105,111,32,
+    68,101,118,105,99,101,0,67,77,73,56,55,51,56,47,80,67,73,32,67,
+    51,68,88,0,67,45,77,101,100,105,97,32,65,117,100,105,111,32,67,111,
+    110,116,114,111,108,108,101,114,0,67,77,73,45,56,51,55,56,66,47,80,
+    67,73,45,54,67,72,0,80,67,73,32,65,117,100,105,111,32,67,104,105,
+    112,0,112,99,110,101,116,32,104,116,50,48,48,49,32,57,57,51,50,0,
+    115,101,114,108,105,111,0,48,120,52,48,48,53,0,112,99,105,32,97,117,
+    100,105,111,32,100,114,105,118,101,114,0,80,67,73,45,49,55,49,48,0,
+    52,45,65,120,105,115,32,83,116,101,112,112,105,110,103,47,83,101,114,118,
+    111,32,77,111,116,111,114,32,67,97,114,100,0,80,67,73,45,49,54,56,
+    48,85,45,65,0,50,45,112,111,114,116,32,67,65,78,32,85,110,105,118,
+    101,114,115,97,108,80,67,73,32,67,111,109,109,117,110,105,99,97,116,105,
+    111,110,32,67,97,114,100,32,119,105,116,104,32,73,115,111,108,97,116,105,
+    111,110,0,80,67,73,45,49,55,49,51,0,51,50,45,99,104,97,110,110,
+    101,108,32,73,115,111,108,97,116,101,100,32,65,110,97,108,111,103,32,73,
+    110,112,117,116,32,67,97,114,100,0,80,67,73,45,49,55,50,52,0,49,
+    52,45,98,105,116,44,32,51,50,45,99,104,97,110,110,101,108,32,73,115,
+    111,108,97,116,101,100,32,65,110,97,108,111,103,32,79,117,116,112,117,116,
+    32,67,97,114,100,0,109,53,56,51,109,108,114,0,57,52,51,50,32,84,
+    88,0,104,100,32,50,54,48,48,120,116,0,77,69,45,50,48,48,48,47,
+    50,54,48,48,0,77,117,108,116,105,102,117,110,99,116,105,111,110,32,68,
+    97,116,97,32,65,113,117,105,115,116,105,111,110,32,99,97,114,100,0,77,
+    69,45,52,54,49,48,0,77,117,108,116,105,45,73,79,32,98,111,97,114,
+    100,32,40,49,54,120,32,49,54,98,105,116,32,65,68,67,44,32,51,50,
+    120,32,84,84,76,32,73,47,79,41,0,77,69,45,52,54,53,48,0,48,
+    52,51,57,0,76,97,118,97,32,68,117,97,108,32,83,101,114,105,97,108,
+    32,53,53,48,32,80,67,73,0,76,97,118,97,32,81,117,97,116,116,114,
+    111,32,80,67,73,32,65,47,66,0,76,97,118,97,32,81,117,97,116,116,
+    114,111,32,80,67,73,32,67,47,68,0,76,97,118,97,32,68,83,101,114,
+    105,97,108,32,80,67,73,32,80,111,114,116,32,65,0,76,97,118,97,32,
+    68,83,101,114,105,97,108,32,80,67,73,32,80,111,114,116,32,66,0,76,
+    97,118,97,32,81,117,97,116,116,114,111,32,53,53,48,32,80,67,73,32,
+    65,47,66,0,76,97,118,97,32,81,117,97,116,116,114,111,32,53,53,48,
+    32,80,67,73,32,67,47,68,0,76,97,118,97,32,79,99,116,111,112,117,
+    115,32,80,67,73,32,80,111,114,116,115,32,49,45,52,0,76,97,118,97,
+    32,79,99,116,111,112,117,115,32,80,67,73,32,80,111,114,116,115,32,53,
+    45,56,0,57,57,50,51,0,76,97,118,97,80,111,114,116,32,68,117,97,
+    108,45,54,53,48,32,80,67,73,0,76,97,118,97,80,111,114,116,32,81,
+    117,97,100,45,54,53,48,32,80,67,73,32,65,47,66,0,76,97,118,97,
+    80,111,114,116,32,81,117,97,100,45,54,53,48,32,80,67,73,32,67,47,
+    68,0,76,97,118,97,32,56,50,53,53,32,80,73,79,32,80,67,73,0,
+    76,97,118,97,32,83,105,110,103,108,101,32,83,101,114,105,97,108,32,53,
+    53,48,32,80,67,73,0,76,97,118,97,32,83,80,32,83,101,114,105,97,
+    108,32,53,53,48,32,80,67,73,0,76,97,118,97,32,83,80,32,66,73,
+    68,73,82,32,80,97,114,97,108,108,101,108,32,80,67,73,0,76,97,118,
+    97,32,82,83,52,50,50,32,83,83,45,80,67,73,0,52,45,48,32,57,
+    50,53,51,0,76,97,118,97,80,111,114,116,32,54,53,48,32,80,67,73,
+    0,76,97,118,97,80,111,114,116,32,80,67,73,0,67,79,77,32,80,111,
+    114,116,32,65,99,99,101,108,101,114,97,116,111,114,0,76,97,118,97,32,
+    80,97,114,97,108,108,101,108,0,76,97,118,97,32,68,117,97,108,32,80,
+    97,114,97,108,108,101,108,32,112,111,114,116,32,65,0,76,97,118,97,32,
+    68,117,97,108,32,80,97,114,97,108,108,101,108,32,112,111,114,116,32,66,
+    0,66,79,67,65,32,82,101,115,101,97,114,99,104,32,73,79,80,80,65,
+    82,0,52,48,51,55,49,52,48,57,0,80,67,73,32,47,32,73,83,65,
+    32,65,115,121,110,99,104,114,111,110,111,117,115,32,85,65,82,84,32,83,
+    105,103,110,97,108,32,67,104,105,112,115,32,83,111,108,117,116,105,111,110,
+    0,80,67,73,32,47,32,73,83,65,32,73,69,69,69,49,50,56,52,32,
+    69,67,80,47,69,80,80,47,83,80,80,47,66,80,80,32,83,105,103,110,
+    97,108,32,67,104,105,112,115,32,83,111,0,80,67,73,32,112,97,114,97,
+    108,108,101,108,32,112,111,114,116,0,73,67,69,49,55,49,50,0,69,110,
+    118,121,50,52,32,80,67,73,32,77,117,108,116,105,45,67,104,97,110,110,
+    101,108,32,73,47,79,32,67,116,114,108,114,0,86,84,49,55,50,48,47,
+    50,52,0,69,110,118,121,50,52,80,84,47,72,84,32,80,67,73,32,77,
+    117,108,116,105,45,67,104,97,110,110,101,108,32,65,117,100,105,111,32,67,
+    111,110,116,114,111,108,108,101,114,0,79,88,57,49,54,50,0,80,67,73,
+    32,73,110,116,101,114,102,97,99,101,32,116,111,32,108,111,99,97,108,32,
+    98,117,115,0,80,97,114,97,108,108,101,108,32,80,111,114,116,0,79,88,
+    49,54,80,67,73,57,53,52,0,81,117,97,100,32,85,65,82,84,32,40,
+    100,105,115,97,98,108,101,100,41,0,79,88,109,49,54,80,67,73,57,53,
+    50,0,68,117,97,108,32,80,67,73,32,85,65,82,84,83,0,79,88,67,
+    66,57,53,48,0,73,110,116,101,103,114,97,116,101,100,32,72,105,103,104,
+    32,80,101,114,102,111,114,109,97,110,99,101,32,85,65,82,84,0,80,67,
+    73,32,73,110,116,101,114,102,97,99,101,32,40,100,105,115,97,98,108,101,
+    100,41,0,79,88,57,49,54,48,0,80,67,73,32,73,110,116,101,114,102,
+    97,99,101,32,116,111,32,56,45,98,105,116,32,108,111,99,97,108,32,98,
+    117,115,0,80,67,73,32,73,110,116,101,114,102,97,99,101,32,116,111,32,
+    51,50,45,98,105,116,32,98,117,115,0,79,88,49,54,80,67,73,57,53,
+    50,0,73,110,116,101,103,114,97,116,101,100,32,80,97,114,97,108,108,101,
+    108,32,80,111,114,116,0,75,70,73,82,0,77,80,69,71,32,100,101,99,
+    111,100,101,114,0,68,69,76,69,84,69,0,83,80,77,54,48,50,48,0,
+    80,67,73,45,49,48,52,32,100,115,112,77,111,100,117,108,101,0,83,80,
+    77,54,48,51,48,0,80,67,47,49,48,52,45,80,108,117,115,32,100,115,
+    112,77,111,100,117,108,101,0,83,80,77,49,56,54,52,50,48,0,83,80,
+    77,49,55,54,52,51,48,0,68,77,55,53,50,48,0,80,67,47,49,48,
+    52,45,80,108,117,115,32,100,97,116,97,77,111,100,117,108,101,0,83,68,
+    77,55,53,52,48,0,80,67,47,49,48,52,45,80,108,117,115,32,100,97,
+    116,97,77,111,100,117,108,101,32,119,105,116,104,32,83,109,97,114,116,67,
+    97,108,0,65,68,65,84,47,69,68,73,84,0,65,117,100,105,111,32,69,
+    100,105,116,105,110,103,0,80,67,73,45,57,48,53,50,0,80,76,88,32,
+    80,67,73,57,48,53,50,0,80,67,73,45,55,50,53,48,0,80,67,73,
+    45,55,50,57,54,32,40,80,76,88,32,80,67,73,45,57,48,53,50,41,
+    0,57,54,45,99,104,32,100,105,103,105,116,97,108,32,73,47,79,32,99,
+    97,114,100,0,80,67,73,45,55,52,51,50,0,80,67,73,45,55,52,51,
+    51,0,54,52,45,99,104,32,100,105,103,105,116,97,108,32,73,110,112,117,
+    116,32,99,97,114,100,0,80,67,73,45,55,52,51,52,0,80,67,73,45,
+    55,56,52,49,0,83,74,65,32,49,48,48,48,45,32,98,97,115,101,100,
+    100,117,97,108,32,112,111,114,116,32,32,67,65,78,32,98,117,115,32,99,
+    97,114,100,0,80,67,73,45,56,49,51,51,0,80,67,73,45,56,53,53,
+    52,0,80,67,73,45,57,49,49,49,0,80,67,73,45,57,49,49,51,0,
+    80,67,73,45,57,49,49,52,0,78,101,120,116,77,111,118,101,32,80,67,
+    73,0,77,117,108,116,105,45,97,120,105,115,32,77,111,116,105,111,110,32,
+    67,111,110,116,114,111,108,108,101,114,0,78,101,120,116,77,111,118,101,32,
+    80,67,73,45,50,0,78,88,54,56,48,48,45,84,68,50,53,54,69,0,
+    56,56,51,0,65,117,100,105,111,32,99,111,110,116,114,111,108,108,101,114,
+    0,77,67,80,50,84,0,82,111,97,100,82,117,110,110,101,114,32,49,48,
+    0,65,68,83,76,32,80,67,73,0,82,65,68,69,79,78,32,57,48,48,
+    48,32,80,82,79,32,69,86,73,76,32,67,79,77,77,65,78,68,79,0,
+    48,120,49,48,48,50,0,48,120,50,48,55,57,0,82,111,99,107,119,101,
+    108,108,32,72,67,70,32,99,104,105,112,115,101,116,0,67,114,101,97,116,
+    105,118,101,32,77,111,100,101,109,66,108,97,115,116,101,114,32,86,46,57,
+    48,32,80,67,73,32,68,73,53,54,53,53,0,82,54,55,57,53,45,49,
+    50,0,82,72,53,54,68,45,80,67,73,0,57,102,102,45,117,115,97,45,
+    97,57,57,45,57,57,45,48,57,55,48,0,68,83,76,32,78,73,67,0,
+    83,99,111,112,101,0,80,117,108,115,97,114,0,80,117,108,115,97,114,32,
+    83,82,66,0,80,117,108,115,97,114,32,50,0,68,83,80,45,66,111,97,
+    114,100,0,83,121,109,112,104,111,110,121,32,52,49,49,48,0,112,99,105,
+    57,48,53,50,0,80,67,52,56,48,48,0,119,101,114,119,101,114,119,101,
+    114,119,101,0,67,105,115,99,111,32,83,121,115,116,101,109,115,32,51,52,
+    48,32,80,67,73,32,87,105,114,101,108,101,115,115,32,76,65,78,32,65,
+    100,112,116,114,0,80,67,50,53,48,48,32,68,83,0,87,105,114,101,108,
+    101,115,115,32,80,67,73,32,76,65,78,32,65,100,97,112,116,101,114,0,
+    80,67,51,49,48,48,32,70,72,0,80,67,51,53,48,48,32,70,72,0,
+    80,67,52,53,48,48,32,68,83,0,80,67,52,56,48,48,32,68,83,0,
+    65,53,48,52,32,67,105,115,99,111,32,77,65,67,0,67,105,115,99,111,
+    32,65,105,114,111,110,101,116,32,51,53,48,32,83,101,114,105,101,115,32,
+    77,105,110,105,45,80,67,73,32,40,77,80,73,51,53,48,41,0,65,73,
+    82,45,77,80,50,49,71,0,56,48,50,46,49,49,98,47,103,32,119,105,
+    114,101,108,101,115,115,32,97,100,97,112,116,101,114,0,76,65,78,97,105,
+    32,57,46,50,32,48,49,50,57,0,77,121,114,105,78,101,116,0,70,80,
+    77,67,45,70,73,79,49,45,70,49,48,48,45,49,0,83,101,114,105,97,
+    108,32,73,47,79,32,67,111,110,116,114,111,108,108,101,114,32,97,107,97,
+    32,70,80,77,67,45,68,70,76,69,88,54,52,0,80,97,110,97,99,111,
+    109,32,55,0,73,110,116,101,114,102,97,99,101,32,99,104,105,112,0,65,
+    80,49,48,49,49,47,83,80,49,48,49,49,0,83,116,117,114,103,101,111,
+    110,32,72,121,112,101,114,84,114,97,110,115,112,111,114,116,45,80,67,73,
+    32,66,114,105,100,103,101,0,80,67,73,32,73,79,32,49,83,0,80,67,
+    73,32,73,79,32,49,83,45,54,53,48,0,80,67,73,32,73,79,32,49,
+    83,45,56,53,48,0,80,67,73,32,73,79,32,49,83,49,80,0,80,67,
+    73,32,73,79,32,49,83,49,80,45,54,53,48,0,80,67,73,32,73,79,
+    32,49,83,49,80,45,56,53,48,0,84,75,57,57,48,50,0,80,97,114,
+    97,108,108,101,108,32,80,111,114,116,32,100,101,118,105,99,101,0,80,67,
+    73,32,73,79,32,50,80,0,80,67,73,32,73,79,32,50,83,0,50,32,
+    80,111,114,116,32,80,67,73,32,83,101,114,105,97,108,32,67,97,114,100,
+    0,80,67,73,32,73,79,32,50,83,45,54,53,48,0,80,67,73,32,73,
+    79,32,50,83,45,56,53,48,0,80,67,73,32,73,79,32,50,80,49,83,
+    0,80,67,73,32,73,79,32,50,80,49,83,45,54,53,48,0,80,67,73,
+    32,73,79,32,50,80,49,83,45,56,53,48,0,80,67,73,32,73,79,32,
+    50,80,50,83,0,80,67,73,32,73,79,32,50,80,50,83,45,54,53,48,
+    0,80,67,73,32,73,79,32,50,80,50,83,45,56,53,48,0,80,67,73,
+    32,73,79,32,52,83,0,80,67,73,32,73,79,32,52,83,45,54,53,52,
+    0,80,67,73,32,73,79,32,52,83,45,56,53,48,0,80,67,73,32,73,
+    79,32,50,83,49,80,0,80,67,73,32,73,79,32,50,83,49,80,45,54,
+    53,48,0,80,67,73,32,73,79,32,50,83,49,80,45,56,53,48,0,80,
+    67,73,32,73,79,32,56,83,0,86,69,78,95,49,52,68,66,38,97,109,
+    112,59,68,69,86,95,50,49,56,48,38,97,109,112,59,83,85,66,83,89,
+    83,95,50,49,56,48,49,52,68,66,38,97,109,112,59,82,69,86,95,48,
+    48,0,80,67,73,32,73,79,32,56,83,45,54,53,52,0,65,118,108,97,
+    98,32,84,101,99,104,110,111,108,111,103,121,32,73,110,99,0,80,67,73,
+    32,73,79,32,56,83,45,56,53,48,0,80,67,73,32,50,51,48,0,80,
+    67,73,50,52,50,72,0,52,45,112,111,114,116,32,104,105,103,104,32,115,
+    112,101,101,100,32,82,83,45,50,51,50,0,80,67,73,50,52,52,72,0,
+    56,45,112,111,114,116,32,104,105,103,104,32,115,112,101,101,100,32,82,83,
+    45,50,51,50,0,80,67,73,50,52,55,72,0,50,45,112,111,114,116,32,
+    104,105,103,104,32,115,112,101,101,100,32,82,83,45,50,51,50,0,80,67,
+    73,50,52,56,72,0,50,45,112,111,114,116,32,104,105,103,104,32,115,112,
+    101,101,100,32,82,83,45,52,50,50,47,52,56,53,0,80,67,73,50,52,
+    57,72,0,50,45,112,111,114,116,32,104,105,103,104,32,115,112,101,101,100,
+    32,82,83,45,50,51,50,32,97,110,100,32,82,83,45,52,50,50,47,52,
+    56,53,0,80,67,73,50,54,48,0,49,54,45,99,104,97,110,110,101,108,
+    32,97,110,97,108,111,103,32,105,110,112,117,116,32,40,119,105,116,104,32,
+    116,105,109,101,114,115,41,0,80,67,73,50,50,52,0,49,54,45,99,104,
+    97,110,32,49,50,45,98,105,116,32,97,110,97,108,111,103,32,111,117,116,
+    112,117,116,32,40,119,47,32,116,105,109,101,114,115,41,0,80,67,73,50,
+    51,52,0,52,45,99,104,97,110,32,49,54,45,98,105,116,32,97,110,97,
+    108,111,103,32,111,117,116,112,117,116,32,40,119,47,32,116,105,109,101,114,
+    115,41,0,80,67,73,50,51,54,0,50,52,45,99,104,97,110,110,101,108,
+    32,100,105,103,105,116,97,108,32,73,47,79,0,80,67,73,50,55,50,0,
+    55,50,45,99,104,97,110,110,101,108,32,100,105,103,105,116,97,108,32,73,
+    47,79,0,80,67,73,50,49,53,0,52,56,45,99,104,97,110,110,101,108,
+    32,100,105,103,105,116,97,108,32,73,47,79,32,40,119,47,32,54,32,116,
+    105,109,101,114,115,41,0,80,67,73,50,54,51,0,49,54,45,99,104,97,
+    110,110,101,108,32,114,101,101,100,32,114,101,108,97,121,32,111,117,116,112,
+    117,116,0,66,67,77,51,51,120,120,47,52,55,120,120,0,83,101,110,116,
+    114,121,53,32,67,104,105,112,99,111,109,109,111,110,32,73,47,79,32,67,
+    111,110,116,114,111,108,108,101,114,0,83,101,110,116,114,121,53,32,80,67,
+    73,32,66,114,105,100,103,101,0,83,101,110,116,114,121,53,32,77,73,80,
+    83,51,50,32,67,80,85,0,83,101,110,116,114,121,53,32,69,116,104,101,
+    114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,0,83,101,110,116,
+    114,121,53,32,67,114,121,112,116,111,32,65,99,99,101,108,101,114,97,116,
+    111,114,0,83,101,110,116,114,121,53,32,68,68,82,47,83,68,82,32,82,
+    65,77,32,67,111,110,116,114,111,108,108,101,114,0,83,101,110,116,114,121,
+    53,32,69,120,116,101,114,110,97,108,32,73,110,116,101,114,102,97,99,101,
+    0,66,67,77,51,51,48,50,0,66,67,77,53,55,53,50,0,78,101,116,
+    88,116,114,101,109,101,32,66,67,77,53,55,53,50,32,71,105,103,97,98,
+    105,116,32,69,116,104,101,114,110,101,116,32,80,67,73,32,69,120,112,114,
+    101,115,115,0,66,67,77,53,55,53,49,70,0,78,101,116,88,116,114,101,
+    109,101,32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,
+    67,111,110,116,114,111,108,108,101,114,0,66,67,77,53,55,48,49,0,78,
+    101,116,88,116,114,101,109,101,32,66,67,77,53,55,48,49,32,71,105,103,
+    97,98,105,116,32,69,116,104,101,114,110,101,116,0,66,67,77,53,55,48,
+    50,120,49,0,78,101,116,88,116,114,101,109,101,32,71,105,103,97,98,105,
+    116,32,69,116,104,101,114,110,101,116,0,66,67,77,53,55,48,51,0,66,
+    67,77,53,55,48,52,0,78,101,116,88,116,114,101,109,101,32,68,117,97,
+    108,32,71,105,103,97,98,105,116,32,65,100,97,112,116,101,114,0,53,55,
+    48,56,0,66,114,111,97,100,99,111,109,32,78,101,116,88,116,114,101,109,
+    101,32,73,73,32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,
+    116,32,65,100,97,112,116,101,114,0,66,67,77,53,55,48,50,70,69,0,
+    78,101,116,88,116,114,101,109,101,32,70,97,115,116,32,69,116,104,101,114,
+    110,101,116,32,67,111,110,116,114,111,108,108,101,114,0,66,67,77,53,55,
+    56,56,0,66,114,111,97,100,99,111,109,32,78,101,116,88,116,114,101,109,
+    101,32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,0,66,
+    67,77,53,55,48,53,45,50,0,66,67,77,53,55,50,49,0,78,101,116,
+    88,116,114,101,109,101,32,71,105,103,97,98,105,116,32,69,116,104,101,114,
+    110,101,116,32,80,67,73,32,69,120,112,114,101,115,115,0,66,67,77,53,
+    55,48,53,77,0,53,55,48,53,77,0,53,55,56,48,0,66,114,111,97,
+    100,99,111,109,32,78,101,116,88,116,114,101,109,101,32,71,105,103,97,98,
+    105,116,32,69,116,104,101,114,110,101,116,32,53,55,56,48,0,66,53,55,
+    120,120,0,66,67,77,53,55,53,48,65,49,0,66,67,77,53,55,53,52,
+    0,66,114,111,97,100,99,111,109,32,78,101,116,88,116,114,101,109,101,32,
+    71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,66,67,77,53,55,53,53,47,53,55,56,48,
+    0,66,67,77,53,55,53,49,77,0,66,67,77,53,55,53,49,70,75,70,
+    66,0,118,105,101,114,107,97,110,116,0,66,67,77,32,53,55,56,55,65,
+    0,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,
+    32,66,114,111,97,100,99,111,109,32,78,101,116,108,105,110,107,32,71,105,
+    103,97,98,105,116,0,66,67,77,53,55,56,50,0,66,114,111,97,100,99,
+    111,109,32,78,101,116,88,116,114,101,109,101,32,71,105,103,97,98,105,116,
+    32,69,116,104,101,114,110,101,116,32,102,111,114,32,104,112,0,66,114,111,
+    97,100,99,111,109,32,78,101,116,76,105,110,107,32,40,84,77,41,32,71,
+    105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,0,66,67,77,53,
+    55,56,50,107,32,70,66,0,66,114,111,97,100,99,111,109,32,69,116,104,
+    101,114,110,101,116,32,65,100,97,112,116,101,114,0,66,67,77,53,55,48,
+    50,88,0,66,67,77,53,55,48,51,88,0,66,48,54,66,68,82,86,0,
+    66,114,111,97,100,67,111,109,32,78,101,116,69,120,116,114,101,109,101,32,
+    73,73,32,83,101,114,118,101,114,0,66,67,77,53,55,48,50,65,51,0,
+    66,67,77,32,53,55,48,51,67,75,72,66,0,66,67,77,53,55,53,51,
+    0,78,101,116,88,116,114,101,109,101,32,66,67,77,53,55,53,51,32,71,
+    105,103,97,98,105,116,32,80,67,73,32,69,120,112,114,101,115,115,0,66,
+    67,77,53,55,53,51,77,0,78,101,116,88,116,114,101,109,101,32,71,105,
+    103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,80,99,105,88,112,
+    114,101,115,115,0,66,67,77,52,52,48,49,0,66,114,111,97,100,99,111,
+    109,32,78,101,116,76,105,110,107,32,52,52,48,49,32,49,48,47,49,48,
+    48,32,69,116,104,101,114,110,101,116,32,78,73,67,0,66,67,77,53,57,
+    48,49,0,78,101,116,88,116,114,101,109,101,32,49,48,48,66,97,115,101,
+    45,84,88,0,66,67,77,53,57,48,54,0,66,114,111,97,100,99,111,109,
+    32,78,101,116,76,105,110,107,32,40,84,77,41,32,70,97,115,116,32,69,
+    116,104,101,114,110,101,116,0,66,67,77,51,51,53,50,0,66,67,77,51,
+    51,53,50,32,81,65,77,76,105,110,107,-62,-82,32,83,105,110,103,108,101,
+    45,67,104,105,112,32,52,45,76,105,110,101,32,86,111,73,80,0,66,67,
+    77,51,51,54,48,0,65,100,118,97,110,99,101,100,32,80,72,89,32,66,
+    114,111,97,100,98,97,110,100,32,71,97,116,101,119,97,121,32,67,97,98,
+    108,101,32,77,111,100,101,109,0,66,67,77,32,72,80,78,65,0,49,48,
+    77,98,47,115,32,78,73,67,0,66,67,77,32,86,46,57,50,0,53,54,
+    107,32,77,111,100,101,109,0,66,67,77,52,51,48,49,32,56,48,50,46,
+    49,49,98,0,73,69,69,69,32,56,48,50,46,49,49,98,32,87,76,65,
+    78,32,99,108,105,101,110,116,32,99,104,105,112,115,101,116,0,66,67,77,
+    52,51,48,51,0,66,67,77,52,51,48,49,32,56,48,50,46,49,49,98,
+    56,48,50,46,49,49,98,32,87,105,114,101,108,101,115,115,32,76,65,78,
+    32,67,111,110,116,114,111,108,108,101,114,0,66,67,77,52,51,48,55,0,
+    86,46,57,48,32,53,54,107,32,77,111,100,101,109,0,66,67,77,52,51,
+    48,54,0,85,110,107,110,111,119,110,32,100,101,118,105,99,101,32,52,51,
+    48,54,32,40,114,101,118,32,48,50,41,0,56,48,50,46,49,49,98,32,
+    87,105,114,101,108,101,115,115,32,76,65,78,32,67,111,110,116,114,111,108,
+    108,101,114,0,66,67,77,52,51,49,48,0,66,67,77,52,51,48,49,32,
+    56,48,50,46,49,49,98,67,104,105,112,99,111,109,109,111,110,32,73,47,
+    79,32,67,111,110,116,114,111,108,108,101,114,0,66,67,77,52,51,49,49,
+    0,66,114,111,97,100,99,111,109,32,67,111,114,112,111,114,97,116,105,111,
+    110,32,68,101,108,108,32,87,105,114,101,108,101,115,115,32,49,51,57,48,
+    32,87,76,65,78,32,77,105,110,105,45,80,67,73,32,67,97,114,100,0,
+    98,114,111,97,100,99,111,109,32,119,105,114,101,108,101,115,115,32,49,52,
+    57,48,32,40,100,101,108,108,41,0,69,116,110,101,114,110,101,116,32,67,
+    111,110,116,114,111,108,108,101,114,0,66,67,77,52,51,88,88,0,66,114,
+    111,97,100,99,111,109,32,56,48,50,46,49,49,98,47,103,0,66,67,77,
+    57,52,51,48,57,0,56,48,50,46,49,49,98,47,103,32,87,105,114,101,
+    108,101,115,115,32,76,65,78,32,67,111,110,116,114,111,108,108,101,114,0,
+    56,48,50,46,49,49,97,32,87,105,114,101,108,101,115,115,32,76,65,78,
+    32,67,111,110,116,114,111,108,108,101,114,0,85,65,82,84,0,66,67,77,
+    52,51,48,57,0,56,48,50,46,49,49,97,47,98,47,103,32,87,105,114,
+    101,108,101,115,115,32,76,65,78,32,67,111,110,116,114,111,108,108,101,114,
+    0,67,104,105,112,99,111,109,109,111,110,32,73,47,79,32,67,111,110,116,
+    114,111,108,108,101,114,63,0,66,67,77,57,52,51,50,49,75,70,66,71,
+    0,66,114,111,97,100,99,111,109,32,52,51,50,49,65,71,78,32,56,48,
+    50,46,49,49,97,47,98,47,103,47,100,114,97,102,116,45,110,32,87,105,
+    45,70,105,32,83,111,108,117,116,105,111,110,0,49,48,47,49,48,48,32,
+    73,110,116,101,103,114,97,116,101,100,32,69,116,104,101,114,110,101,116,32,
+    67,111,110,116,114,111,108,108,101,114,0,66,67,77,52,52,48,50,0,66,
+    67,77,52,52,49,51,0,105,76,105,110,101,51,50,32,72,111,109,101,80,
+    78,65,32,50,46,48,0,66,67,77,52,50,49,50,0,66,67,77,52,52,
+    49,50,0,49,48,47,49,48,48,66,97,115,101,84,32,69,116,104,101,114,
+    110,101,116,0,66,67,77,52,52,120,120,0,67,97,114,100,66,117,115,32,
+    105,76,105,110,101,51,50,32,72,111,109,101,80,78,65,32,50,46,48,0,
+    67,97,114,100,66,117,115,32,49,48,47,49,48,48,66,97,115,101,84,32,
+    69,116,104,101,114,110,101,116,0,66,67,77,52,54,49,48,0,83,101,110,
+    116,114,121,53,32,80,67,73,32,116,111,32,83,66,32,66,114,105,100,103,
+    101,0,83,101,110,116,114,121,53,32,105,76,105,110,101,51,50,32,72,111,
+    109,101,80,78,65,32,49,46,48,0,83,101,110,116,114,121,53,32,86,46,
+    57,48,32,53,54,107,32,77,111,100,101,109,0,83,101,110,116,114,121,53,
+    32,85,83,66,32,67,111,110,116,114,111,108,108,101,114,0,66,67,77,52,
+    55,48,52,0,67,114,121,112,116,111,32,65,99,99,101,108,101,114,97,116,
+    111,114,0,66,67,77,52,55,49,48,0,66,67,77,52,55,120,120,0,83,
+    101,110,116,114,121,53,32,105,76,105,110,101,51,50,32,72,111,109,101,80,
+    78,65,32,50,46,48,0,83,101,110,116,114,121,53,32,86,46,57,50,32,
+    53,54,107,32,109,111,100,101,109,0,83,101,110,116,114,121,53,32,85,83,
+    66,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,83,101,
+    110,116,114,121,53,32,85,83,66,32,68,101,118,105,99,101,32,67,111,110,
+    116,114,111,108,108,101,114,0,66,67,77,52,55,49,50,0,77,73,80,83,
+    32,67,80,85,0,66,67,77,53,51,54,53,80,0,66,67,77,53,54,48,
+    48,0,83,116,114,97,116,97,83,119,105,116,99,104,32,50,52,43,50,32,
+    69,116,104,101,114,110,101,116,32,83,119,105,116,99,104,32,67,111,110,116,
+    114,111,108,108,101,114,0,66,67,77,53,54,48,53,0,66,67,77,53,54,
+    49,53,0,66,67,77,53,54,50,53,0,66,67,77,53,54,52,53,0,66,
+    67,77,53,54,55,48,0,56,45,80,111,114,116,32,49,48,71,69,32,69,
+    116,104,101,114,110,101,116,32,83,119,105,116,99,104,32,70,97,98,114,105,
+    99,0,66,67,77,53,54,56,48,0,71,45,83,119,105,116,99,104,32,56,
+    45,80,111,114,116,32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,
+    101,116,32,83,119,105,116,99,104,32,67,111,110,116,114,111,108,108,101,114,
+    0,66,67,77,53,54,57,48,0,49,50,45,112,111,114,116,32,77,117,108,
+    116,105,45,76,97,121,101,114,32,71,105,103,97,98,105,116,32,69,116,104,
+    101,114,110,101,116,32,83,119,105,116,99,104,0,66,67,77,53,54,57,49,
+    0,71,69,47,49,48,71,69,32,56,43,50,32,71,105,103,97,98,105,116,
+    32,69,116,104,101,114,110,101,116,32,83,119,105,116,99,104,32,67,111,110,
+    116,114,111,108,108,101,114,0,66,67,77,53,56,48,50,0,84,104,101,32,
+    66,67,77,53,56,48,50,32,83,101,99,117,114,105,116,121,32,80,114,111,
+    99,101,115,115,111,114,32,105,110,116,101,103,114,97,116,101,115,32,66,114,
+    111,97,100,99,111,109,-30,-128,-103,115,32,73,80,83,101,99,32,101,110,103,
+    105,110,101,32,40,68,69,83,44,32,51,68,69,83,44,32,72,77,65,67,
+    45,83,72,65,45,49,44,32,72,77,65,67,45,77,68,53,41,44,0,66,
+    67,77,53,56,48,53,0,84,104,101,32,66,67,77,53,56,48,53,32,83,
+    101,99,117,114,105,116,121,32,80,114,111,99,101,115,115,111,114,32,105,110,
+    116,101,103,114,97,116,101,115,32,97,32,104,105,103,104,45,112,101,114,102,
+    111,114,109,97,110,99,101,32,73,80,83,101,99,32,101,110,103,105,110,101,
+    32,40,68,69,83,44,32,51,68,69,83,44,32,72,77,65,67,45,83,72,
+    65,45,49,44,32,72,77,0,66,67,77,53,56,50,48,0,66,67,77,53,
+    56,50,49,0,66,67,77,53,56,50,50,0,66,67,77,53,56,50,51,0,
+    66,67,77,53,56,50,52,0,66,67,77,53,56,52,48,0,66,67,77,53,
+    56,52,49,0,66,67,77,53,56,53,48,0,53,55,53,49,0,110,101,116,
+    119,111,114,107,32,99,97,114,100,32,105,110,116,101,103,114,97,116,101,100,
+    0,66,67,77,55,52,49,49,0,72,105,103,104,32,68,101,102,105,110,105,
+    116,105,111,110,32,86,105,100,101,111,47,65,117,100,105,111,32,68,101,99,
+    111,100,101,114,0,70,78,87,45,51,54,48,51,45,84,88,0,49,48,47,
+    49,48,48,32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,67,97,
+    114,100,66,117,115,32,40,82,84,76,56,49,51,57,41,0,66,69,77,120,
+    46,120,0,80,67,73,32,116,111,32,83,53,85,49,51,120,120,120,66,48,
+    48,66,32,66,114,105,100,103,101,32,65,100,97,112,116,101,114,0,83,49,
+    68,49,51,56,48,56,0,69,109,98,101,100,100,101,100,32,77,101,109,111,
+    114,121,32,68,105,115,112,108,97,121,32,67,111,110,116,114,111,108,108,101,
+    114,0,68,73,49,53,54,51,48,45,53,44,32,68,73,53,54,51,49,44,
+    32,68,73,53,54,51,51,0,83,109,97,114,116,72,67,70,0,65,99,99,
+    101,115,115,82,117,110,110,101,114,32,65,68,83,76,32,77,111,100,101,109,
+    0,99,120,49,49,50,53,50,45,49,53,0,72,83,70,112,32,111,114,32,
+    83,111,102,116,32,86,57,50,32,68,97,116,97,32,70,97,120,32,77,111,
+    100,101,109,0,72,68,65,32,68,49,48,48,32,77,68,67,32,118,46,57,
+    50,32,77,111,100,101,109,0,49,48,52,68,49,55,48,48,0,72,68,65,
+    85,68,73,79,32,83,111,102,116,32,68,97,116,97,32,102,97,120,32,77,
+    111,100,101,109,32,119,105,116,104,32,83,109,97,114,116,80,67,0,48,48,
+    49,48,49,55,54,55,0,72,83,70,32,53,54,107,32,72,83,70,105,32,
+    77,111,100,101,109,0,67,88,49,49,50,53,50,45,49,49,0,72,83,70,
+    32,80,67,73,32,73,110,116,101,114,110,97,108,32,77,111,100,101,109,0,
+    114,99,52,49,53,115,116,45,104,109,0,104,112,47,99,111,109,112,97,113,
+    32,97,108,104,101,110,97,32,53,45,103,108,54,0,67,111,110,101,120,97,
+    110,116,32,77,111,100,101,109,63,0,52,46,48,46,51,46,49,0,66,101,
+    108,105,118,101,100,32,116,111,32,98,101,32,97,32,67,88,50,51,52,49,
+    56,0,83,105,110,103,108,101,45,67,104,105,112,32,77,80,69,71,45,50,
+    32,69,110,99,111,100,101,114,32,119,105,116,104,32,73,110,116,101,103,114,
+    97,116,101,100,32,65,110,97,108,111,103,32,86,105,100,101,111,47,66,114,
+    111,97,100,99,97,115,116,32,65,117,100,105,111,32,68,101,99,111,100,101,
+    114,0,50,51,56,56,48,0,67,111,110,101,120,97,110,116,32,50,51,56,
+    56,48,32,86,105,100,101,111,32,67,97,112,116,117,114,101,32,40,78,84,
+    83,67,41,0,48,120,55,55,49,55,0,77,101,100,105,97,32,99,108,97,
+    115,115,58,32,38,97,109,112,59,35,56,50,48,54,59,77,85,76,84,73,
+    77,69,68,73,65,95,86,73,68,69,79,0,77,111,115,101,108,108,101,32,
+    83,112,108,105,116,32,66,114,105,100,103,101,0,67,97,112,105,108,97,110,
+    111,32,83,112,108,105,116,32,66,114,105,100,103,101,0,77,101,114,108,105,
+    110,32,83,112,108,105,116,32,66,114,105,100,103,101,0,80,67,73,32,83,
+    101,114,105,97,108,32,80,111,114,116,0,80,67,73,32,80,83,47,50,32,
+    75,101,121,98,111,97,114,100,32,80,111,114,116,0,51,49,48,51,0,80,
+    67,73,32,80,83,47,50,32,77,111,117,115,101,32,80,111,114,116,0,72,
+    50,54,48,117,0,72,50,54,48,117,32,112,114,105,110,116,101,114,32,115,
+    101,114,118,101,114,32,102,111,114,32,72,80,32,80,114,105,110,116,101,114,
+    0,77,80,67,49,48,53,32,69,97,103,108,101,0,77,80,67,49,48,54,
+    32,71,114,97,99,107,108,101,0,77,80,67,56,50,52,48,32,75,97,104,
+    108,117,97,0,77,80,67,49,52,53,53,55,53,32,72,70,67,45,80,67,
+    73,0,75,84,73,56,50,57,99,32,49,48,48,86,71,0,77,84,68,56,
+    48,48,0,77,121,115,111,110,32,77,84,68,56,48,51,47,84,65,77,65,
+    82,65,67,75,32,84,67,54,48,50,48,0,80,67,73,32,69,116,104,101,
+    114,110,101,116,32,99,111,110,116,114,111,108,108,101,114,0,77,84,68,56,
+    57,49,0,49,48,47,49,48,48,47,49,48,48,48,32,77,98,112,115,32,
+    71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,48,120,49,0,80,67,73,32,73,110,116,101,
+    114,102,97,99,101,32,98,117,115,0,80,67,73,45,49,48,48,50,0,52,
+    51,56,51,0,80,67,73,45,49,48,48,52,0,80,67,73,45,49,48,48,
+    56,0,109,101,53,57,52,118,48,50,49,48,48,32,99,111,109,98,111,120,
+    0,99,111,109,98,111,120,32,99,98,32,51,48,48,97,0,49,46,48,46,
+    49,46,56,0,53,54,107,32,73,110,116,101,114,110,97,108,32,68,97,116,
+    97,32,70,97,120,32,86,111,105,99,101,32,77,111,100,101,109,0,80,66,
+    114,105,100,103,101,43,0,80,67,73,32,73,110,116,101,114,102,97,99,101,
+    32,67,104,105,112,0,77,85,57,67,56,75,54,52,0,67,111,110,116,101,
+    110,116,32,65,100,100,114,101,115,115,97,98,108,101,32,77,101,109,111,114,
+    121,0,49,46,52,46,53,46,48,0,80,67,73,32,77,101,109,111,114,121,
+    32,67,97,114,100,32,82,101,97,100,101,114,32,67,111,110,116,114,111,108,
+    108,101,114,0,67,66,45,55,49,50,47,55,49,52,47,56,49,48,0,77,
+    101,109,111,114,121,32,83,116,105,99,107,32,67,97,114,100,32,82,101,97,
+    100,101,114,0,83,101,99,117,114,101,32,68,105,103,105,116,97,108,32,67,
+    97,114,100,32,82,101,97,100,101,114,0,80,67,73,32,83,109,97,114,116,
+    32,67,97,114,100,32,82,101,97,100,101,114,32,67,111,110,116,114,111,108,
+    108,101,114,0,67,66,45,49,50,49,49,0,67,66,45,49,50,50,53,0,
+    67,66,45,49,52,50,48,0,67,66,45,55,49,48,47,50,47,52,47,56,
+    49,48,0,67,66,45,55,49,50,47,52,0,67,66,45,55,50,48,47,50,
+    47,52,0,67,66,45,55,50,50,47,52,0,73,67,69,49,55,49,50,32,
+    69,110,118,121,50,52,0,73,67,32,69,110,115,101,109,98,108,101,32,73,
+    110,99,32,73,67,69,49,55,49,50,32,69,110,118,121,50,52,32,77,117,
+    108,116,105,99,104,97,110,110,101,108,32,65,117,100,105,111,32,67,111,110,
+    116,114,111,108,108,101,114,0,83,65,65,55,49,51,52,72,76,0,80,104,
+    105,108,105,112,115,32,83,101,109,105,99,111,110,100,117,99,116,111,114,115,
+    32,83,65,65,55,49,51,52,72,76,32,77,117,108,116,105,109,101,100,105,
+    97,32,67,97,112,116,117,114,101,32,68,101,118,105,99,101,0,67,83,52,
+    54,49,52,47,50,50,47,50,52,0,120,120,49,50,51,52,53,0,78,111,
+    116,32,97,32,99,104,105,112,32,46,46,46,0,115,97,97,55,49,51,52,
+    0,80,65,76,47,83,69,67,65,77,32,84,86,32,99,97,114,100,32,119,
+    47,32,70,77,49,50,49,54,77,69,32,77,75,51,32,116,117,110,101,114,
+    32,40,43,70,77,32,114,97,100,105,111,41,0,51,48,50,48,49,53,52,
+    51,0,77,111,100,101,109,32,68,101,118,105,99,101,32,111,110,32,72,105,
+    103,104,32,68,101,102,105,110,105,116,105,111,110,32,65,117,100,105,111,32,
+    66,117,115,0,80,67,73,45,73,83,65,45,48,48,49,0,80,67,73,47,
+    73,83,65,32,66,117,115,32,66,114,105,100,103,101,0,80,76,88,32,80,
+    67,73,32,57,48,53,48,0,69,97,115,121,108,111,110,32,80,67,73,32,
+    66,117,115,32,73,110,116,101,114,102,97,99,101,0,77,70,67,51,0,77,
+    117,108,116,105,32,70,117,110,99,116,105,111,110,32,67,97,114,100,32,86,
+    101,114,115,105,111,110,32,51,0,76,65,45,52,49,120,51,0,83,112,101,
+    99,116,114,117,109,50,52,32,87,105,114,101,108,101,115,115,32,76,65,78,
+    32,80,67,73,32,67,97,114,100,0,76,65,45,53,48,51,48,0,83,121,
+    109,98,111,108,32,87,105,114,101,108,101,115,115,32,78,101,116,119,111,114,
+    107,101,114,32,56,48,50,46,49,49,97,47,103,32,67,97,114,100,66,117,
+    115,0,76,65,45,53,48,51,51,0,83,121,109,98,111,108,32,87,105,114,
+    101,108,101,115,115,32,78,101,116,119,111,114,107,101,114,32,56,48,50,46,
+    49,49,97,47,103,32,80,67,73,0,78,65,0,87,105,100,101,98,97,110,
+    100,32,65,100,118,97,110,99,101,100,32,83,105,103,110,97,108,32,80,114,
+    111,99,101,115,115,111,114,0,72,105,103,104,32,68,97,116,97,32,82,97,
+    116,101,32,82,97,100,105,111,0,67,67,83,73,32,80,67,73,50,48,45,
+    52,56,53,0,65,82,67,78,69,84,32,98,97,99,107,112,108,97,110,101,
+    0,67,67,83,73,32,80,67,73,50,48,45,52,56,53,68,0,65,82,67,
+    110,101,116,0,67,67,83,73,32,80,67,73,50,48,45,52,56,53,88,0,
+    67,67,83,73,32,80,67,73,50,48,45,67,88,66,0,67,67,83,73,32,
+    80,67,73,50,48,45,67,88,83,0,67,67,83,73,32,80,67,73,50,48,
+    45,70,79,71,45,83,77,65,0,67,67,83,73,32,80,67,73,50,48,45,
+    70,79,71,45,83,84,0,67,67,83,73,32,80,67,73,50,48,45,84,66,
+    53,0,67,67,83,73,32,80,67,73,50,48,45,53,45,52,56,53,0,53,
+    32,77,98,105,116,32,65,82,67,110,101,116,0,67,67,83,73,32,80,67,
+    73,50,48,45,53,45,52,56,53,68,0,67,67,83,73,32,80,67,73,50,
+    48,45,53,45,52,56,53,88,0,67,67,83,73,32,80,73,67,50,48,45,
+    53,45,70,79,71,45,83,84,0,67,67,83,73,32,80,67,73,50,48,45,
+    53,45,70,79,71,45,83,77,65,0,67,79,77,50,48,48,67,50,50,0,
+    65,82,67,78,69,84,0,67,67,83,73,32,80,67,73,50,50,45,52,56,
+    53,0,49,48,32,77,98,105,116,32,65,82,67,110,101,116,0,67,67,83,
+    73,32,80,67,73,50,50,45,52,56,53,68,0,67,67,83,73,32,80,67,
+    73,50,50,45,52,56,53,88,0,67,67,83,73,32,80,67,73,50,50,45,
+    67,72,66,0,67,67,83,73,32,80,67,73,50,50,45,70,79,71,45,83,
+    84,0,67,67,83,73,32,80,67,73,50,50,45,84,72,66,0,70,105,120,
+    50,48,48,48,0,80,67,73,32,89,50,75,32,67,111,109,112,108,105,97,
+    110,99,101,32,67,97,114,100,0,80,65,88,46,112,111,114,116,32,49,49,
+    48,48,0,80,65,88,46,119,97,114,101,32,49,49,48,48,32,100,117,97,
+    108,32,71,98,32,99,108,97,115,115,105,102,105,101,114,32,101,110,103,105,
+    110,101,0,65,77,68,32,39,57,55,49,0,83,78,80,32,56,48,50,51,
+    32,112,97,99,107,101,116,32,99,108,97,115,115,105,102,105,101,114,32,45,
+    32,65,77,68,32,99,111,109,112,111,110,101,110,116,0,83,78,80,56,48,
+    50,51,0,80,65,88,46,119,97,114,101,32,49,48,48,32,112,97,99,107,
+    101,116,32,99,108,97,115,115,105,102,105,101,114,0,72,76,70,45,86,77,
+    80,69,85,53,54,48,45,67,0,83,116,97,110,100,97,114,32,72,83,80,
+    32,77,111,100,101,109,32,83,101,114,105,101,115,0,87,56,51,55,56,55,
+    73,70,0,87,56,51,55,56,55,49,70,0,80,97,114,97,108,108,101,108,
+    32,80,111,114,116,32,67,97,114,100,32,40,69,80,80,41,0,84,67,51,
+    50,48,48,49,32,80,67,73,32,73,47,79,0,57,48,55,97,98,49,56,
+    52,55,52,48,56,48,50,0,87,105,110,98,111,110,100,32,119,56,51,55,
+    56,55,105,102,0,119,105,110,98,111,110,100,32,119,56,51,55,56,55,105,
+    102,0,77,117,108,116,105,45,73,79,32,67,97,114,100,32,50,32,115,101,
+    114,105,101,115,0,119,56,51,55,56,55,49,102,0,48,48,55,65,66,49,
+    57,50,51,54,55,48,48,50,78,68,0,84,65,55,48,48,0,80,67,73,
+    32,66,117,115,32,65,110,97,108,121,122,101,114,47,69,120,101,114,99,105,
+    115,101,114,0,86,71,65,32,52,46,48,46,53,0,86,105,114,116,117,97,
+    108,32,83,86,71,65,0,86,77,88,78,69,84,0,86,77,119,97,114,101,
+    32,80,67,73,32,69,116,104,101,114,110,101,116,32,65,100,97,112,116,101,
+    114,0,70,77,45,49,55,56,57,0,80,99,116,101,108,0,50,66,68,48,
+    0,115,111,102,116,53,54,107,32,118,111,105,99,101,44,100,97,116,97,44,
+    102,97,120,32,67,65,82,80,0,77,84,50,49,49,48,56,0,73,110,102,
+    105,110,105,66,114,105,100,103,101,0,77,84,50,53,50,48,56,65,48,45,
+    70,67,67,0,73,110,102,105,110,105,72,111,115,116,32,84,77,32,73,73,
+    73,32,69,120,0,120,80,67,73,45,51,53,48,52,0,65,110,97,108,111,
+    103,32,111,117,116,112,117,116,32,98,111,97,114,100,0,110,50,53,51,48,
+    97,0,68,88,50,43,32,70,67,45,65,76,32,65,100,97,112,116,101,114,
+    0,81,88,52,0,52,32,80,111,114,116,32,70,105,98,114,101,32,67,104,
+    97,110,110,101,108,32,67,111,110,116,114,111,108,108,101,114,0,72,80,32,
+    84,111,112,116,111,111,108,115,32,82,101,109,111,116,101,32,67,111,110,116,
+    114,111,108,32,65,100,97,112,116,101,114,0,69,50,57,50,57,65,0,80,
+    67,73,47,80,67,73,45,88,32,66,117,115,32,65,110,97,108,121,122,101,
+    114,0,84,67,49,49,73,66,0,84,114,105,67,111,114,101,32,51,50,45,
+    98,105,116,32,83,105,110,103,108,101,45,99,104,105,112,32,77,105,99,114,
+    111,99,116,114,108,114,0,80,69,66,32,50,48,53,52,52,32,69,32,118,
+    49,46,49,0,54,32,80,111,114,116,32,79,112,116,105,109,105,122,101,100,
+    32,67,111,109,109,32,67,116,114,108,114,32,40,83,80,79,67,67,41,0,
+    80,69,66,32,51,52,53,52,32,69,32,118,49,46,49,0,84,69,51,45,
+    83,80,73,67,67,69,32,54,32,80,111,114,116,32,73,110,116,101,103,114,
+    97,116,101,100,32,67,111,109,109,32,67,116,114,108,114,0,65,114,103,117,
+    115,32,51,48,48,0,80,67,73,32,67,114,121,112,116,111,103,114,97,112,
+    104,121,32,77,111,100,117,108,101,0,73,110,116,101,114,110,101,116,32,80,
+    104,111,110,101,74,97,99,107,32,80,67,73,32,67,97,114,100,0,78,67,
+    80,49,51,48,0,87,105,114,101,108,101,115,115,32,78,73,67,0,80,114,
+    105,115,109,32,73,73,0,73,110,115,116,97,110,116,87,97,118,101,32,72,
+    82,32,80,67,73,32,99,97,114,100,0,78,101,116,83,116,97,81,32,65,
+    68,77,65,45,49,48,48,0,65,84,65,32,99,111,110,116,114,111,108,108,
+    101,114,0,67,88,49,49,50,53,50,45,49,53,0,67,111,110,101,120,97,
+    110,116,32,72,83,70,105,0,83,112,111,116,32,82,84,0,83,112,111,116,
+    32,82,84,32,73,110,116,101,114,102,97,99,101,32,66,111,97,114,100,0,
+    83,112,111,116,32,82,84,32,35,50,0,83,112,111,116,32,73,110,115,105,
+    103,104,116,0,83,112,111,116,32,73,110,115,105,103,104,116,32,73,110,116,
+    101,114,102,97,99,101,32,66,111,97,114,100,0,70,97,114,83,121,110,99,
+    32,84,50,80,0,84,119,111,32,80,111,114,116,32,73,110,116,101,108,108,
+    105,103,101,110,116,32,83,121,110,99,32,67,111,109,109,115,32,67,97,114,
+    100,0,70,97,114,83,121,110,99,32,84,52,80,0,70,111,117,114,32,80,
+    111,114,116,32,73,110,116,101,108,108,105,103,101,110,116,32,83,121,110,99,
+    32,67,111,109,109,115,32,67,97,114,100,0,70,97,114,83,121,110,99,32,
+    84,49,85,0,79,110,101,32,80,111,114,116,32,73,110,116,101,108,108,105,
+    103,101,110,116,32,83,121,110,99,32,67,111,109,109,115,32,67,97,114,100,
+    0,70,97,114,83,121,110,99,32,84,50,85,0,70,97,114,83,121,110,99,
+    32,84,52,85,0,70,97,114,83,121,110,99,32,84,69,49,0,70,97,114,
+    83,121,110,99,32,84,69,49,67,0,67,104,97,110,110,101,108,105,122,101,
+    100,32,73,110,116,101,108,108,105,103,101,110,116,32,83,121,110,99,32,67,
+    111,109,109,115,32,67,97,114,100,0,70,97,114,83,121,110,99,32,68,83,
+    76,45,83,49,0,71,46,83,72,68,83,76,32,73,110,116,101,108,108,105,
+    103,101,110,116,32,83,121,110,99,32,67,111,109,109,115,32,67,97,114,100,
+    0,70,97,114,83,121,110,99,32,84,52,69,0,76,121,110,120,84,87,79,
+    45,65,0,52,32,105,110,47,52,32,111,117,116,32,80,114,111,102,101,115,
+    115,105,111,110,97,108,32,68,105,103,105,116,97,108,32,65,117,100,105,111,
+    32,67,97,114,100,0,76,121,110,120,84,87,79,45,66,0,50,32,105,110,
+    47,54,32,111,117,116,32,80,114,111,102,101,115,115,105,111,110,97,108,32,
+    68,105,103,105,116,97,108,32,65,117,100,105,111,32,67,97,114,100,0,76,
+    121,110,120,84,87,79,45,67,0,54,32,105,110,47,50,32,111,117,116,32,
+    80,114,111,102,101,115,115,105,111,110,97,108,32,68,105,103,105,116,97,108,
+    32,65,117,100,105,111,32,67,97,114,100,0,76,121,110,120,32,76,50,50,
+    0,50,32,105,110,47,50,32,111,117,116,32,80,114,111,102,101,115,115,105,
+    111,110,97,108,32,68,105,103,105,116,97,108,32,65,117,100,105,111,32,67,
+    97,114,100,0,76,121,110,120,32,65,69,83,49,54,0,49,54,32,105,110,
+    47,49,54,32,111,117,116,32,65,69,83,47,69,66,85,32,65,117,100,105,
+    111,32,67,97,114,100,0,76,121,110,120,32,65,69,83,49,54,45,83,82,
+    67,0,49,54,32,105,110,47,49,54,32,111,117,116,32,65,69,83,47,69,
+    66,85,32,65,117,100,105,111,32,67,97,114,100,32,119,47,83,82,67,0,
+    70,111,114,109,97,116,32,83,121,110,99,104,114,111,110,105,122,101,114,32,
+    118,51,46,48,0,70,97,115,116,32,85,110,105,118,101,114,115,97,108,32,
+    68,97,116,97,32,79,117,116,112,117,116,0,82,101,112,101,111,103,114,97,
+    112,104,105,99,115,32,99,111,110,116,114,111,108,108,101,114,0,82,101,112,
+    114,111,103,114,97,112,104,105,99,115,32,67,111,110,116,114,111,108,108,101,
+    114,0,84,83,45,80,82,76,49,0,71,101,110,101,114,97,108,32,80,117,
+    114,112,111,115,101,32,82,101,108,97,121,32,67,97,114,100,0,84,83,45,
+    80,77,65,0,77,97,116,114,105,120,32,67,97,114,100,0,87,76,49,49,
+    48,48,48,80,0,32,87,76,49,49,48,48,48,80,0,82,54,55,57,51,
+    45,49,49,0,82,83,53,54,47,72,83,80,45,80,67,73,0,83,76,49,
+    57,48,48,32,80,67,73,0,65,122,116,101,99,104,32,67,78,82,32,86,
+    46,57,50,32,77,111,100,101,109,0,80,76,88,32,57,48,53,52,0,80,
+    67,73,32,105,110,116,101,114,102,97,99,101,32,99,104,105,112,0,80,67,
+    73,32,105,110,116,101,114,97,102,97,99,101,32,99,104,105,112,0,57,48,
+    53,52,49,48,66,53,0,68,73,71,32,55,48,52,32,80,67,73,32,45,
+    32,73,110,116,101,114,102,97,99,101,32,119,105,116,104,32,77,105,108,108,
+    105,115,101,99,111,110,100,32,84,105,109,101,114,32,97,110,100,32,73,110,
+    116,101,114,114,117,112,116,115,0,80,73,88,67,73,32,67,76,49,0,80,
+    67,73,32,99,97,109,101,114,97,32,108,105,110,107,32,118,105,100,101,111,
+    32,99,97,112,116,117,114,101,32,98,111,97,114,100,0,80,73,88,67,73,
+    32,68,50,88,0,80,67,73,32,100,105,103,105,116,97,108,32,118,105,100,
+    101,111,32,99,97,112,116,117,114,101,32,98,111,97,114,100,0,80,73,88,
+    67,73,32,68,51,88,0,88,73,76,73,78,88,32,83,80,65,82,84,65,
+    78,0,49,54,32,67,104,97,110,110,101,108,32,65,117,100,105,111,32,67,
+    97,112,116,117,114,101,32,67,97,114,100,0,48,51,48,52,0,66,67,77,
+    49,49,50,53,47,66,67,77,49,50,53,48,32,80,67,73,32,67,111,110,
+    102,105,103,117,114,97,116,105,111,110,32,72,101,97,100,101,114,0,66,67,
+    77,49,49,50,53,47,66,67,77,49,50,53,48,32,72,121,112,101,114,84,
+    114,97,110,115,112,111,114,116,32,67,111,110,102,105,103,117,114,97,116,105,
+    111,110,32,72,101,97,100,101,0,77,73,80,83,32,66,67,77,49,49,50,
+    53,47,66,67,77,49,50,53,48,32,112,114,111,99,101,115,115,111,114,115,
+    0,53,65,67,80,67,73,46,77,70,73,79,45,75,48,49,0,80,114,111,
+    102,105,98,117,115,32,68,80,32,47,32,75,45,70,101,108,100,98,117,115,
+    32,47,32,67,79,77,0,70,79,66,45,73,79,32,67,97,114,100,0,76,
+    50,66,32,80,67,73,32,66,111,97,114,100,0,70,79,66,45,83,68,32,
+    67,97,114,100,0,70,79,66,45,84,68,67,32,67,97,114,100,0,65,82,
+    53,48,48,48,0,56,48,50,46,49,49,97,32,87,105,114,101,108,101,115,
+    115,32,65,100,97,112,116,101,114,0,65,82,53,50,49,48,0,65,82,53,
+    50,49,49,0,56,48,50,46,49,49,97,47,98,47,103,32,77,105,110,105,
+    45,80,67,73,32,87,105,114,101,108,101,115,115,32,65,100,97,112,116,101,
+    114,0,65,82,53,50,49,50,44,32,65,82,53,50,49,51,0,56,48,50,
+    46,49,49,97,47,98,47,103,32,87,105,114,101,108,101,115,115,32,65,100,
+    97,112,116,101,114,0,65,116,104,101,114,111,115,32,65,82,53,48,48,53,
+    71,0,65,116,104,101,114,111,115,32,65,82,53,48,48,53,71,32,56,48,
+    50,46,49,49,97,98,103,32,78,73,67,32,67,104,105,112,115,101,116,32,
+    47,32,84,80,45,76,105,110,107,32,40,84,76,45,87,78,53,53,49,71,
+    41,0,65,82,53,48,48,54,88,0,56,48,50,46,49,49,97,98,103,32,
+    78,73,67,0,65,82,53,48,48,54,0,65,116,104,101,114,111,115,32,97,
+    47,98,47,103,0,65,82,53,48,48,56,0,65,116,104,101,114,111,115,32,
+    56,48,50,46,49,49,97,47,98,47,103,47,110,32,40,112,114,101,45,78,
+    41,32,114,97,100,105,111,0,65,82,53,50,49,50,0,65,116,104,101,114,
+    111,115,32,65,82,53,50,49,50,32,56,48,50,46,49,49,97,98,103,32,
+    119,105,114,101,108,101,115,115,0,76,65,78,45,69,120,112,114,101,115,115,
+    32,65,83,32,73,69,69,69,32,56,48,50,46,49,49,103,32,109,105,110,
+    105,80,67,73,32,97,100,97,112,116,101,114,0,80,76,88,32,80,67,73,
+    57,48,53,52,0,69,80,79,78,73,78,69,32,69,83,82,45,80,67,73,
+    32,66,111,97,114,100,0,77,111,116,111,114,111,108,97,32,77,80,67,56,
+    50,52,53,0,69,80,79,78,73,78,69,32,77,84,77,49,50,48,32,80,
+    67,73,32,66,111,97,114,100,0,82,111,99,107,101,116,32,68,114,105,118,
+    101,0,83,111,108,105,100,32,83,116,97,116,101,32,68,105,115,107,0,82,
+    84,76,56,49,54,57,83,0,82,101,97,108,84,101,107,32,56,49,54,57,
+    83,32,99,104,105,112,0,48,54,51,55,0,85,46,83,46,32,82,111,98,
+    111,116,105,99,115,32,53,54,75,32,87,105,110,32,73,78,84,0,49,49,
+    51,50,51,65,0,85,46,83,46,32,82,111,98,111,116,105,99,115,32,53,
+    54,75,32,86,111,105,99,101,32,72,111,115,116,32,73,110,116,0,85,83,
+    82,111,98,111,116,105,99,115,32,53,54,54,48,65,32,45,32,73,110,116,
+    101,114,110,97,108,32,83,111,102,116,32,77,111,100,101,109,0,104,116,116,
+    112,58,47,47,119,119,119,46,117,115,114,46,99,111,109,47,115,117,112,112,
+    111,114,116,47,112,114,111,100,117,99,116,45,116,101,109,112,108,97,116,101,
+    46,97,115,112,63,112,114,111,100,61,53,54,54,48,97,0,69,49,50,57,
+    51,51,54,45,49,0,85,46,83,46,82,111,98,111,116,105,99,32,40,65,
+    45,32,77,111,100,101,109,47,80,67,73,41,0,87,105,114,101,108,101,115,
+    115,32,65,99,99,101,115,115,32,65,100,97,112,116,101,114,32,77,111,100,
+    101,108,32,48,50,50,52,49,53,0,85,46,83,46,32,82,111,98,111,116,
+    105,99,115,32,53,54,75,32,86,111,105,99,101,32,72,111,115,116,32,73,
+    110,116,32,40,65,45,77,111,100,101,109,47,32,80,67,73,41,0,78,83,
+    80,50,48,48,48,45,83,83,76,0,67,114,121,112,116,111,32,65,99,101,
+    108,101,116,97,116,111,114,0,86,83,67,55,49,55,52,0,86,83,67,55,
+    49,55,52,32,80,67,73,47,80,67,73,45,88,32,83,65,84,65,32,67,
+    111,110,116,114,111,108,108,101,114,0,82,97,103,101,32,88,76,0,65,84,
+    73,32,82,97,103,101,32,88,76,32,40,114,101,118,32,50,55,41,0,65,
+    73,67,45,55,57,48,50,87,0,65,100,97,112,116,101,99,32,65,73,67,
+    45,55,57,48,50,32,68,117,97,108,32,67,104,97,110,110,101,108,32,85,
+    51,50,48,32,83,67,83,73,0,83,101,114,118,101,114,119,111,114,107,115,
+    32,83,111,117,116,104,98,114,105,100,103,101,32,119,105,116,104,32,82,65,
+    73,68,47,73,68,69,32,40,114,101,118,32,97,48,41,44,32,79,72,67,
+    73,32,85,83,66,32,40,114,101,118,32,48,53,41,44,32,71,67,76,69,
+    45,50,32,72,111,115,116,32,66,114,105,100,103,101,0,66,114,111,97,100,
+    99,111,109,32,67,111,114,112,46,32,78,101,116,88,116,114,101,109,101,32,
+    71,105,103,97,98,121,116,101,32,69,116,104,101,114,110,101,116,0,65,67,
+    49,48,48,48,0,65,67,49,48,48,50,0,82,79,76,47,70,45,49,48,
+    48,0,70,97,115,116,32,69,116,104,101,114,110,101,116,32,65,100,97,112,
+    116,101,114,32,119,105,116,104,32,82,79,76,0,83,97,112,104,105,114,101,
+    32,82,97,100,101,111,110,32,57,50,53,48,0,83,97,112,112,104,105,114,
+    101,32,82,97,100,101,111,110,32,57,50,53,48,32,45,32,83,101,99,111,
+    110,100,97,114,121,0,82,65,68,69,79,78,32,57,48,48,48,32,65,84,
+    76,65,78,84,73,83,32,80,82,79,0,82,65,68,69,79,78,32,57,48,
+    48,48,32,65,84,76,65,78,84,73,83,32,80,82,79,32,45,32,83,101,
+    99,111,110,100,97,114,121,0,82,65,68,69,79,78,32,57,50,48,48,32,
+    65,84,76,65,78,84,73,83,32,45,32,83,101,99,111,110,100,97,114,121,
+    0,82,65,68,69,79,78,32,57,50,48,48,32,65,84,76,65,78,84,73,
+    83,0,86,80,53,48,48,0,86,111,108,117,109,101,80,114,111,32,53,48,
+    48,0,86,80,49,48,48,48,0,86,111,108,117,109,101,80,114,111,32,49,
+    48,48,48,0,65,117,49,53,48,48,0,65,117,49,53,48,48,32,80,114,
+    111,99,101,115,115,111,114,0,50,48,48,0,72,73,83,32,69,120,99,97,
+    108,105,98,117,114,32,82,97,100,101,111,110,32,57,54,48,48,0,78,101,
+    116,32,50,50,56,48,0,85,83,66,32,50,46,48,32,68,101,118,105,99,
+    101,32,67,111,110,116,114,111,108,108,101,114,0,88,51,32,97,110,100,32,
+    88,52,0,88,102,114,97,109,101,32,49,48,71,98,69,32,80,67,73,45,
+    88,32,65,100,97,112,116,101,114,0,72,50,0,88,102,114,97,109,101,32,
+    73,73,32,49,48,71,98,69,32,80,67,73,45,88,32,50,46,48,32,65,
+    100,97,112,116,101,114,0,77,68,53,54,50,56,68,45,76,45,65,0,105,
+    110,116,101,108,32,86,46,57,50,32,72,97,77,32,77,111,100,101,109,0,
+    65,109,98,105,101,110,116,32,77,68,56,56,50,48,0,73,110,116,101,108,
+    32,72,97,77,32,86,46,57,50,32,77,111,100,101,109,0,50,52,54,48,
+    32,32,56,48,50,46,49,49,98,0,82,84,50,52,54,48,32,32,56,48,
+    50,46,49,49,98,32,66,97,115,101,98,97,110,100,47,77,65,67,32,105,
+    110,116,101,103,114,97,116,101,100,32,99,104,105,112,0,48,120,48,51,48,
+    49,49,56,49,52,0,90,111,110,101,116,32,90,69,87,49,54,48,49,32,
+    40,82,97,108,105,110,107,32,67,104,105,112,115,101,116,41,32,56,48,50,
+    46,49,49,98,47,103,32,87,76,65,78,32,67,97,114,100,0,98,56,51,
+    52,49,52,54,50,0,114,116,50,53,48,48,0,82,84,50,53,50,53,32,
+    50,46,52,71,72,122,32,116,114,97,110,115,99,101,105,118,101,114,32,43,
+    32,82,84,50,53,54,48,32,77,65,67,47,66,66,80,0,119,105,114,101,
+    108,101,115,115,32,97,47,98,0,66,116,56,56,49,0,110,86,105,100,105,
+    97,32,78,86,50,56,0,86,71,65,32,71,101,102,111,114,99,101,52,32,
+    77,88,52,52,48,0,86,71,65,32,71,101,102,111,114,99,101,52,32,84,
+    105,52,50,48,48,0,76,101,111,110,97,114,100,111,32,67,76,0,86,105,
+    100,101,111,32,112,114,111,99,101,115,115,111,114,0,76,101,111,110,97,114,
+    100,111,32,67,76,45,80,0,76,101,111,110,97,114,100,111,32,67,76,45,
+    68,66,0,76,101,111,110,97,114,100,111,32,67,76,45,80,45,68,66,0,
+    76,101,111,110,97,114,100,111,32,67,76,45,68,86,82,0,76,101,111,110,
+    97,114,100,111,32,67,76,45,68,86,82,45,68,66,0,80,105,99,97,115,
+    115,111,32,50,83,81,0,70,114,97,109,101,103,114,97,98,98,101,114,0,
+    80,105,99,97,115,115,111,32,51,67,47,51,67,112,114,111,0,80,105,99,
+    97,115,115,111,32,76,83,0,80,105,99,97,115,115,111,32,67,76,0,80,
+    105,99,97,115,115,111,32,70,73,0,80,105,99,97,115,115,111,32,83,68,
+    73,0,80,105,99,97,115,115,111,32,68,85,79,0,67,111,108,111,114,121,
+    0,86,97,108,101,110,116,105,110,111,0,86,105,100,101,111,32,79,117,116,
+    112,117,116,32,66,111,97,114,100,0,56,48,56,53,0,86,111,108,97,114,
+    105,32,70,97,109,105,108,121,0,69,83,67,67,45,80,67,73,45,51,51,
+    53,0,70,97,115,116,99,111,109,58,69,83,67,67,45,80,67,73,45,51,
+    51,53,32,83,121,110,99,114,111,110,111,117,115,32,82,83,52,50,50,47,
+    52,56,53,32,115,101,114,105,97,108,32,99,111,109,109,117,110,105,99,97,
+    116,105,111,110,32,97,100,97,112,116,101,114,0,52,50,50,47,52,45,80,
+    67,73,45,51,51,53,0,70,97,115,116,99,111,109,58,52,50,50,47,52,
+    45,80,67,73,45,51,51,53,32,65,115,121,110,99,114,111,110,111,117,115,
+    32,82,83,52,50,50,47,52,56,53,32,115,101,114,105,97,108,32,97,100,
+    97,112,116,101,114,0,52,50,50,47,50,45,80,67,73,45,51,51,53,0,
+    70,97,115,116,99,111,109,58,52,50,50,47,50,45,80,67,73,45,51,51,
+    53,32,65,115,121,110,99,114,111,110,111,117,115,32,82,83,52,50,50,47,
+    52,56,53,32,115,101,114,105,97,108,32,97,100,97,112,116,101,114,0,50,
+    51,50,47,52,45,80,67,73,45,51,51,53,0,70,97,115,116,99,111,109,
+    58,50,51,50,47,52,45,80,67,73,45,51,51,53,32,65,115,121,110,99,
+    114,111,110,111,117,115,32,82,83,50,51,50,32,115,101,114,105,97,108,32,
+    97,100,97,112,116,101,114,0,83,87,53,48,48,48,45,78,67,65,0,83,
+    101,97,119,97,121,32,78,101,116,119,111,114,107,32,67,111,110,116,101,110,
+    116,32,65,99,99,101,108,101,114,97,116,111,114,0,65,71,69,73,65,32,
+    80,104,121,115,88,32,49,48,48,32,83,101,114,105,101,115,32,80,67,73,
+    32,69,120,112,114,101,115,115,32,67,97,114,100,0,65,71,69,73,65,32,
+    80,104,121,115,88,32,49,48,48,32,83,101,114,105,101,115,32,80,67,73,
+    32,67,97,114,100,0,65,71,69,73,65,32,80,104,121,115,88,32,50,48,
+    48,32,83,101,114,105,101,115,32,80,67,73,32,69,120,112,114,101,115,115,
+    32,67,97,114,100,0,65,67,65,50,52,48,48,0,110,86,105,100,105,97,
+    32,67,111,114,112,111,114,97,116,105,111,110,32,78,86,49,55,0,83,67,
+    83,73,32,65,83,73,67,0,68,67,45,51,57,48,0,68,67,45,54,57,
+    48,67,0,73,68,69,32,67,97,99,104,101,32,67,111,110,116,114,111,108,
+    108,101,114,0,68,67,50,57,48,77,0,66,117,115,32,77,97,115,116,101,
+    114,32,73,68,69,32,80,67,73,32,50,32,99,111,110,116,114,111,108,108,
+    101,114,115,0,72,66,50,47,72,66,54,0,85,110,105,118,101,114,115,97,
+    108,32,80,67,73,45,80,67,73,32,66,114,105,100,103,101,32,40,116,114,
+    97,110,115,112,97,114,101,110,116,32,109,111,100,101,41,0,72,66,49,47,
+    49,45,83,69,47,72,66,54,0,85,110,105,118,101,114,115,97,108,32,80,
+    67,73,45,116,111,45,80,67,73,32,66,114,105,100,103,101,32,40,110,111,
+    110,45,116,114,97,110,115,112,97,114,101,110,116,32,109,111,100,101,41,0,
+    72,66,52,0,72,66,56,0,68,117,97,108,32,77,111,100,101,32,80,67,
+    73,45,88,45,116,111,45,80,67,73,45,88,32,66,114,105,100,103,101,32,
+    40,116,114,97,110,115,112,97,114,101,110,116,32,109,111,100,101,41,0,68,
+    117,97,108,32,77,111,100,101,32,80,67,73,45,88,45,116,111,45,80,67,
+    73,45,88,32,66,114,105,100,103,101,32,40,110,111,110,45,116,114,97,110,
+    115,112,97,114,101,110,116,32,109,111,100,101,41,0,72,66,55,0,84,114,
+    97,110,115,112,97,114,101,110,116,32,80,67,73,45,88,45,116,111,45,80,
+    67,73,45,88,32,66,114,105,100,103,101,0,80,67,73,32,54,49,53,54,
+    0,83,121,110,99,104,114,111,110,111,117,115,32,51,50,45,66,105,116,44,
+    32,51,51,32,77,72,122,32,80,67,73,45,116,111,45,80,67,73,32,66,
+    114,105,100,103,101,32,102,111,114,32,86,105,100,101,111,32,67,97,112,116,
+    117,114,101,32,65,112,112,108,105,99,97,116,105,111,110,115,0,99,109,105,
+    32,56,51,51,48,0,71,76,105,110,116,32,51,48,48,83,88,0,71,76,
+    105,110,116,32,53,48,48,84,88,0,83,97,112,112,104,105,114,101,32,51,
+    68,32,65,99,99,101,108,101,114,97,116,111,114,0,71,76,105,110,116,0,
+    68,101,108,116,97,32,71,101,111,109,101,116,114,121,32,112,114,111,99,101,
+    115,115,111,114,0,51,67,48,83,88,0,50,68,43,51,68,32,65,99,99,
+    101,108,101,114,97,116,111,114,0,71,76,105,110,116,32,77,88,0,51,68,
+    32,69,120,116,114,101,109,101,0,80,101,114,109,101,100,105,97,32,73,73,
+    32,50,68,43,51,68,32,65,99,99,101,108,101,114,97,116,111,114,0,71,
+    76,105,110,116,32,71,97,109,109,97,32,71,49,0,80,101,114,109,101,100,
+    105,97,50,118,0,50,100,43,51,100,32,99,104,105,112,115,101,116,44,32,
+    105,110,116,101,103,114,97,116,101,100,32,114,97,109,100,97,99,0,80,101,
+    114,109,101,100,105,97,32,51,0,71,76,73,78,84,32,82,52,0,71,76,
+    73,78,84,32,71,97,109,109,97,32,71,50,0,48,120,48,51,48,48,48,
+    48,0,51,68,108,97,98,115,32,87,105,108,100,99,97,116,32,82,101,97,
+    108,105,122,109,32,56,48,48,0,80,101,114,109,101,100,105,97,32,73,73,
+    0,51,68,43,51,68,32,65,99,99,101,108,101,114,97,116,111,114,0,71,
+    76,105,110,116,32,86,71,65,0,51,50,50,48,0,80,67,73,32,65,117,
+    100,105,111,32,68,101,118,105,99,101,32,43,32,109,111,100,101,109,0,65,
+    76,83,51,48,48,43,0,80,67,73,32,73,110,112,117,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,65,76,71,50,48,54,52,0,65,76,71,50,
+    51,54,52,65,0,65,76,71,50,51,48,49,0,65,76,71,50,51,48,50,
+    0,65,86,71,50,51,48,50,0,65,76,71,50,51,54,52,0,65,76,71,
+    50,52,54,52,0,65,76,71,50,53,54,52,65,47,50,53,49,50,56,65,
+    0,65,76,83,52,48,48,48,0,65,117,100,105,111,32,67,104,105,112,115,
+    101,116,0,65,68,77,45,88,82,67,0,86,105,114,116,101,120,45,69,32,
+    66,114,105,100,103,101,0,65,68,77,45,88,82,67,45,73,73,32,76,105,
+    116,101,0,86,105,114,116,101,120,45,73,73,32,66,114,105,100,103,101,0,
+    65,68,77,45,88,82,67,45,73,73,0,65,68,77,45,88,80,76,0,86,
+    105,114,116,101,120,45,73,73,32,80,114,111,32,66,114,105,100,103,101,0,
+    65,68,77,45,88,80,0,86,105,114,116,101,120,45,73,73,32,80,114,111,
+    32,80,67,73,47,80,67,73,45,88,32,66,114,105,100,103,101,0,65,68,
+    80,45,87,82,67,45,73,73,0,65,68,80,45,68,82,67,45,73,73,0,
+    65,68,80,45,88,80,73,0,86,105,114,116,101,120,45,73,73,32,80,114,
+    111,32,80,67,73,0,65,68,80,45,88,80,73,32,40,80,67,73,45,88,
+    41,0,86,105,114,116,101,120,45,73,73,32,80,114,111,32,80,67,73,45,
+    88,32,66,114,105,100,103,101,0,65,68,77,45,88,82,67,45,52,70,88,
+    0,65,68,77,45,88,82,67,45,53,76,88,0,86,105,114,116,101,120,45,
+    52,76,88,32,66,114,105,100,103,101,0,65,68,77,45,88,82,67,45,53,
+    84,49,0,65,108,108,97,100,105,110,67,65,82,68,0,67,80,67,0,80,
+    76,85,83,84,69,83,84,0,68,105,97,103,110,111,115,116,105,99,115,32,
+    68,101,118,105,99,101,0,77,81,45,50,48,48,0,68,97,121,116,111,110,
+    97,32,65,117,100,105,111,32,65,100,97,112,116,101,114,0,56,54,67,53,
+    53,49,0,80,108,97,116,111,47,80,88,0,118,105,97,0,56,54,67,51,
+    50,53,0,86,105,114,103,101,32,51,68,32,71,85,73,32,65,99,99,101,
+    108,101,114,97,116,111,114,0,56,54,67,56,54,54,0,86,105,115,105,111,
+    110,32,56,54,54,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,
+    114,0,56,54,67,57,54,52,0,86,105,115,105,111,110,32,57,54,52,32,
+    71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,56,54,67,55,
+    51,50,0,84,114,105,111,32,51,50,32,71,85,73,32,65,99,99,101,108,
+    101,114,97,116,111,114,0,56,54,50,50,109,99,113,48,52,0,84,114,105,
+    111,32,54,52,47,54,52,86,0,56,54,67,77,54,53,63,0,65,117,114,
+    111,114,97,32,54,52,86,43,0,56,54,67,55,54,52,0,84,114,105,111,
+    32,51,50,47,54,52,32,71,85,73,32,65,99,99,101,108,101,114,97,116,
+    111,114,32,118,51,0,56,54,67,55,54,55,0,84,114,105,111,32,54,52,
+    85,86,43,0,56,54,67,77,54,54,0,65,117,114,111,114,97,49,50,56,
+    0,56,54,67,57,56,56,0,86,105,82,71,69,47,86,88,32,51,68,32,
+    71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,70,105,114,101,
+    32,71,76,0,56,54,67,56,54,56,0,86,105,115,105,111,110,32,56,54,
+    56,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,32,86,82,
+    65,77,32,114,101,118,46,32,48,0,86,105,115,105,111,110,32,56,54,56,
+    32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,32,86,82,65,
+    77,32,114,101,118,46,32,49,0,86,105,115,105,111,110,32,56,54,56,32,
+    71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,32,86,82,65,77,
+    32,114,101,118,46,32,50,0,86,105,115,105,111,110,32,56,54,56,32,71,
+    85,73,32,65,99,99,101,108,101,114,97,116,111,114,32,86,82,65,77,32,
+    114,101,118,46,32,51,0,56,54,67,57,50,56,0,86,105,115,105,111,110,
+    32,57,50,56,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,
+    32,86,82,65,77,32,114,101,118,46,32,48,0,86,105,115,105,111,110,32,
+    57,50,56,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,32,
+    86,82,65,77,32,114,101,118,46,32,49,0,86,105,115,105,111,110,32,57,
+    50,56,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,32,86,
+    82,65,77,32,114,101,118,46,32,50,0,86,105,115,105,111,110,32,57,50,
+    56,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,32,86,82,
+    65,77,32,114,101,118,46,32,51,0,56,54,67,56,54,52,0,86,105,115,
+    105,111,110,32,56,54,52,32,71,85,73,32,65,99,99,101,108,101,114,97,
+    116,111,114,32,68,82,65,77,32,114,101,118,46,32,48,0,86,105,115,105,
+    111,110,32,56,54,52,32,71,85,73,32,65,99,99,101,108,101,114,97,116,
+    111,114,32,68,82,65,77,32,114,101,118,46,32,49,0,86,105,115,105,111,
+    110,32,56,54,52,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,
+    114,32,68,82,65,77,32,114,101,118,46,32,50,0,86,105,115,105,111,110,
+    32,56,54,52,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,
+    32,68,82,65,77,32,114,101,118,46,32,51,0,86,105,115,105,111,110,32,
+    57,54,52,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,32,
+    86,82,65,77,32,114,101,118,46,32,48,0,86,105,115,105,111,110,32,57,
+    54,52,45,80,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,
+    32,86,82,65,77,32,114,101,118,46,32,49,0,86,105,115,105,111,110,32,
+    57,54,52,45,80,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,
+    114,32,68,82,65,77,32,114,101,118,32,50,0,86,105,115,105,111,110,32,
+    57,54,52,45,80,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,
+    114,32,86,82,65,77,32,114,101,118,46,32,51,0,56,54,67,57,54,56,
+    0,86,105,115,105,111,110,32,57,54,56,32,71,85,73,32,65,99,99,101,
+    108,101,114,97,116,111,114,32,86,82,65,77,32,114,101,118,46,32,48,0,
+    86,105,115,105,111,110,32,57,54,56,32,71,85,73,32,65,99,99,101,108,
+    101,114,97,116,111,114,32,86,82,65,77,32,114,101,118,46,32,49,0,86,
+    105,115,105,111,110,32,57,54,56,32,71,85,73,32,65,99,99,101,108,101,
+    114,97,116,111,114,32,86,82,65,77,32,114,101,118,46,32,50,0,86,105,
+    115,105,111,110,32,57,54,56,32,71,85,73,32,65,99,99,101,108,101,114,
+    97,116,111,114,32,86,82,65,77,32,114,101,118,46,32,51,0,56,54,67,
+    55,55,53,0,84,114,105,111,54,52,86,50,47,68,88,0,56,54,67,55,
+    52,67,54,0,84,114,105,111,54,52,86,50,47,68,88,45,47,71,88,32,
+    71,114,97,112,104,105,99,115,32,68,114,105,118,101,114,115,0,83,77,65,
+    32,70,97,109,105,108,121,0,84,114,105,111,86,32,70,97,109,105,108,121,
+    0,56,54,67,51,54,53,47,51,54,54,0,84,114,105,111,51,68,32,81,
+    70,80,47,66,71,65,0,56,54,99,55,54,53,0,56,54,67,55,54,53,
+    32,84,114,105,111,54,52,86,43,32,99,111,109,112,97,116,105,98,108,101,
+    0,57,55,49,49,32,77,67,78,55,52,0,55,54,57,57,54,56,56,0,
+    48,120,48,48,48,57,49,48,49,49,0,57,55,50,54,32,99,49,57,51,
+    57,52,46,48,48,0,56,54,67,51,55,53,47,56,54,67,51,56,53,0,
+    86,105,82,71,69,32,47,68,88,32,38,97,109,112,59,32,47,71,88,0,
+    56,54,67,51,53,55,0,86,105,82,71,69,32,47,71,88,50,0,56,54,
+    67,51,53,57,0,86,105,82,71,69,32,47,71,88,50,43,32,77,97,99,
+    114,111,118,105,115,105,111,110,0,86,105,82,71,69,32,47,71,88,50,43,
+    0,56,54,67,51,54,56,0,84,114,105,111,51,68,50,120,32,38,97,109,
+    112,59,32,84,114,105,111,51,68,50,120,43,32,65,71,80,32,47,32,84,
+    114,105,111,51,68,50,120,32,38,97,109,112,59,32,84,114,105,111,51,68,
+    50,120,43,32,56,77,66,0,56,54,67,51,57,49,0,83,51,115,97,118,
+    97,103,101,51,68,0,56,54,67,51,57,48,0,83,97,118,97,103,101,51,
+    68,47,77,86,0,56,54,99,51,57,56,0,83,97,118,97,103,101,32,52,
+    0,56,54,67,51,57,52,45,51,57,55,0,56,54,67,51,55,48,0,83,
+    97,118,97,103,101,52,0,56,54,67,51,57,53,66,0,80,114,111,83,97,
+    118,97,103,101,0,56,53,67,50,54,48,0,86,105,82,71,69,47,77,51,
+    32,40,86,105,82,71,69,47,77,88,41,0,56,54,67,50,54,48,0,86,
+    105,82,71,69,47,77,53,32,40,86,105,82,71,69,47,77,88,41,0,56,
+    54,67,50,52,48,0,86,105,82,71,69,47,77,88,67,0,56,54,67,50,
+    56,48,32,100,98,0,86,105,82,71,69,32,47,77,88,43,109,118,0,56,
+    54,67,50,55,48,47,50,55,52,47,50,57,48,47,50,57,52,0,83,97,
+    118,97,103,101,32,77,88,47,73,88,47,77,88,43,77,86,47,73,88,43,
+    77,86,0,56,50,67,50,57,52,0,83,65,86,65,71,69,32,73,88,0,
+    56,54,67,53,48,56,0,83,117,112,101,114,83,97,118,97,103,101,32,49,
+    50,56,47,77,88,0,56,54,67,53,52,52,0,83,117,112,101,114,83,97,
+    118,97,103,101,32,49,50,56,47,73,88,0,56,54,67,53,53,51,0,83,
+    117,112,101,114,83,97,118,97,103,101,32,49,50,56,47,73,88,32,68,68,
+    82,0,56,54,67,53,54,52,0,83,117,112,101,114,83,97,118,97,103,101,
+    47,73,88,0,56,54,67,53,55,51,0,83,117,112,101,114,83,97,118,97,
+    103,101,47,73,88,32,68,68,82,0,56,54,67,53,56,52,0,83,117,112,
+    101,114,83,97,118,97,103,101,47,73,88,67,32,83,68,82,65,77,0,56,
+    54,67,53,57,52,0,83,117,112,101,114,83,97,118,97,103,101,47,73,88,
+    67,32,68,68,82,0,56,54,67,51,56,48,47,51,56,49,0,84,119,105,
+    115,116,101,114,47,84,119,105,115,116,101,114,32,84,0,56,54,99,51,56,
+    55,0,84,119,105,115,116,101,114,32,75,0,56,54,67,52,49,48,0,80,
+    114,111,83,97,118,97,103,101,32,68,68,82,0,56,54,67,55,55,55,47,
+    55,56,55,0,68,101,108,116,97,67,104,114,111,109,101,32,83,56,47,70,
+    49,0,68,101,108,116,97,67,104,114,111,109,101,88,57,109,0,56,54,99,
+    52,49,48,0,73,110,110,111,32,83,97,118,97,103,101,32,50,48,48,48,
+    0,56,54,67,54,49,55,0,83,111,110,105,99,86,105,98,101,115,32,80,
+    67,73,32,65,117,100,105,111,32,65,99,99,101,108,101,114,97,116,111,114,
+    0,86,80,73,32,71,101,110,101,114,97,108,32,68,105,103,105,116,97,108,
+    32,86,105,100,101,111,32,67,111,109,112,111,110,101,110,116,0,68,105,103,
+    105,116,97,108,32,86,105,100,101,111,32,79,69,77,32,99,111,109,112,117,
+    116,101,114,32,109,111,100,117,108,101,0,56,49,53,0,80,67,67,79,77,
+    52,0,80,67,67,79,77,56,0,69,120,116,101,110,100,101,100,32,69,120,
+    112,114,101,115,115,32,83,121,115,116,101,109,32,83,117,112,112,111,114,116,
+    32,67,116,114,108,114,0,56,48,51,48,51,0,73,47,79,32,80,114,111,
+    99,101,115,115,111,114,32,80,67,73,45,116,111,45,80,67,73,32,66,114,
+    105,100,103,101,32,85,110,105,116,0,56,48,51,49,50,0,73,47,79,32,
+    67,111,109,112,97,110,105,111,110,32,85,110,105,116,32,80,67,73,45,116,
+    111,45,80,67,73,32,66,114,105,100,103,101,0,56,48,50,49,57,0,71,
+    101,110,101,114,97,108,32,80,117,114,112,111,115,101,32,80,67,73,32,80,
+    114,111,99,101,115,115,111,114,32,65,100,100,114,101,115,115,32,84,114,97,
+    110,115,108,97,116,105,111,110,32,85,110,105,116,0,54,55,48,120,80,88,
+    72,0,73,47,79,120,65,80,73,67,32,73,110,116,101,114,114,117,112,116,
+    32,67,111,110,116,114,111,108,108,101,114,0,54,55,48,48,80,88,72,0,
+    73,47,79,120,65,80,73,67,32,73,110,116,101,114,114,117,112,116,32,67,
+    111,110,116,114,111,108,108,101,114,32,66,0,80,67,73,32,69,120,112,114,
+    101,115,115,45,116,111,45,80,67,73,32,69,120,112,114,101,115,115,32,66,
+    114,105,100,103,101,32,65,0,80,67,73,32,69,120,112,114,101,115,115,45,
+    116,111,45,80,67,73,32,69,120,112,114,101,115,115,32,66,114,105,100,103,
+    101,32,66,0,54,55,48,50,80,88,72,0,80,67,73,32,69,120,112,114,
+    101,115,115,45,116,111,45,80,67,73,32,69,120,112,114,101,115,115,32,66,
+    114,105,100,103,101,0,56,48,51,51,50,0,65,45,83,101,103,109,101,110,
+    116,32,66,114,105,100,103,101,0,65,45,83,101,103,109,101,110,116,32,73,
+    79,65,80,73,67,0,66,45,83,101,103,109,101,110,116,32,66,114,105,100,
+    103,101,0,66,45,83,101,103,109,101,110,116,32,73,79,65,80,73,67,0,
+    65,100,100,114,101,115,115,32,84,114,97,110,115,108,97,116,105,111,110,32,
+    85,110,105,116,0,56,48,51,51,49,0,65,100,100,114,101,115,115,32,84,
+    114,97,110,115,108,97,116,105,111,110,32,85,110,105,116,32,40,65,84,85,
+    41,0,52,49,50,49,48,0,83,101,114,105,97,108,32,116,111,32,80,97,
+    114,97,108,108,101,108,32,80,67,73,32,66,114,105,100,103,101,32,65,0,
+    83,101,114,105,97,108,32,116,111,32,80,97,114,97,108,108,101,108,32,80,
+    67,73,32,66,114,105,100,103,101,32,66,0,56,48,51,51,51,0,83,101,
+    103,109,101,110,116,45,65,32,80,67,73,32,69,120,112,114,101,115,115,45,
+    116,111,45,80,67,73,32,69,120,112,114,101,115,115,32,66,114,105,100,103,
+    101,0,65,45,66,117,115,32,73,79,65,80,73,67,0,83,101,103,109,101,
+    110,116,45,66,32,80,67,73,32,69,120,112,114,101,115,115,45,116,111,45,
+    80,67,73,32,69,120,112,114,101,115,115,32,66,114,105,100,103,101,0,66,
+    45,66,117,115,32,73,79,65,80,73,67,0,56,50,51,55,53,77,66,0,
+    80,67,73,45,69,73,83,65,32,66,114,105,100,103,101,32,40,80,67,69,
+    66,41,0,56,50,52,50,52,84,88,47,90,88,0,67,80,85,32,40,105,
+    52,56,54,41,32,66,114,105,100,103,101,32,40,83,97,116,117,114,110,41,
+    0,56,50,51,55,56,90,66,47,73,66,0,83,73,79,32,73,83,65,32,
+    66,114,105,100,103,101,0,56,50,52,50,53,69,88,0,80,67,73,32,83,
+    121,115,116,101,109,32,67,111,110,116,114,111,108,108,101,114,32,40,80,83,
+    67,41,32,102,111,114,32,105,52,56,54,32,40,65,114,105,101,115,41,0,
+    56,50,52,51,52,76,88,47,78,88,0,77,101,114,99,117,114,121,47,78,
+    101,112,116,117,110,101,32,67,97,99,104,101,47,68,82,65,77,32,67,111,
+    110,116,114,111,108,108,101,114,0,69,56,56,55,48,0,80,114,111,99,101,
+    115,115,111,114,32,66,117,115,32,67,111,110,116,114,111,108,108,101,114,0,
+    83,99,97,108,97,98,105,108,105,116,121,32,80,111,114,116,32,48,0,83,
+    99,97,108,97,98,105,108,105,116,121,32,80,111,114,116,32,49,32,47,32,
+    71,108,111,98,46,32,80,101,114,102,46,32,77,111,110,105,116,111,114,0,
+    69,56,56,55,48,73,79,0,72,117,98,32,73,110,116,101,114,102,97,99,
+    101,32,80,111,114,116,32,48,32,40,56,45,98,105,116,32,99,111,109,112,
+    97,116,105,98,108,101,41,0,72,117,98,32,73,110,116,101,114,102,97,99,
+    101,32,80,111,114,116,32,49,0,72,117,98,32,73,110,116,101,114,102,97,
+    99,101,32,80,111,114,116,32,50,0,72,117,98,32,73,110,116,101,114,102,
+    97,99,101,32,80,111,114,116,32,51,0,72,117,98,32,73,110,116,101,114,
+    102,97,99,101,32,80,111,114,116,32,52,0,83,101,114,118,101,114,32,73,
+    47,79,32,72,117,98,32,40,83,73,79,72,41,0,82,101,108,105,97,98,
+    105,108,116,121,44,32,65,118,97,105,108,97,98,105,108,105,116,121,44,32,
+    83,101,114,118,105,99,101,97,98,105,108,105,116,121,0,69,56,56,55,48,
+    83,80,0,83,99,97,108,97,98,105,108,105,116,121,32,80,111,114,116,32,
+    49,0,83,99,97,108,97,98,105,108,105,116,121,32,80,111,114,116,32,50,
+    0,83,99,97,108,97,98,105,108,105,116,121,32,80,111,114,116,32,51,0,
+    83,99,97,108,97,98,105,108,105,116,121,32,80,111,114,116,32,52,0,83,
+    99,97,108,97,98,105,108,105,116,121,32,80,111,114,116,32,53,0,83,99,
+    97,108,97,98,105,108,105,116,121,32,80,111,114,116,32,83,119,105,116,99,
+    104,32,71,108,111,98,97,108,32,82,101,103,105,115,116,101,114,115,0,73,
+    110,116,101,114,108,101,97,118,101,32,67,111,110,102,105,103,117,114,97,116,
+    105,111,110,32,82,101,103,105,115,116,101,114,115,0,83,116,111,114,97,103,
+    101,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,0,56,48,
+    57,54,48,82,80,0,105,57,54,48,32,82,80,32,77,105,99,114,111,112,
+    114,111,99,101,115,115,111,114,47,66,114,105,100,103,101,0,56,48,57,54,
+    48,82,77,47,82,78,0,105,57,54,48,82,77,47,82,78,32,77,105,99,
+    114,111,112,114,111,99,101,115,115,111,114,47,66,114,105,100,103,101,0,105,
+    57,54,48,32,82,80,32,77,105,99,114,111,112,114,111,99,101,115,115,111,
+    114,32,66,114,105,100,103,101,0,56,50,53,52,50,0,50,53,55,50,0,
+    49,48,47,49,48,48,47,49,48,48,48,32,69,116,104,101,114,110,101,116,
+    32,67,111,110,116,114,111,108,108,101,114,32,40,70,105,98,101,114,41,0,
+    80,114,111,32,49,48,48,32,76,65,78,43,77,111,100,101,109,32,53,54,
+    32,67,97,114,100,66,117,115,32,73,73,0,56,50,53,52,51,71,67,0,
+    71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,
+    116,114,111,108,108,101,114,32,40,67,111,112,112,101,114,41,0,56,50,53,
+    52,52,69,73,47,71,67,0,56,50,53,52,52,69,73,0,71,105,103,97,
+    98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,
+    108,101,114,32,40,70,105,98,101,114,41,0,56,50,53,52,51,69,73,47,
+    71,67,0,56,50,53,52,52,71,67,0,71,105,103,97,98,105,116,32,69,
+    116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,32,40,
+    76,79,77,41,0,56,50,53,52,48,69,77,0,56,50,53,52,53,69,77,
+    0,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,
+    110,116,114,111,108,108,101,114,32,40,99,111,112,112,101,114,41,0,56,50,
+    53,52,54,69,66,0,68,117,97,108,32,80,111,114,116,32,71,105,103,97,
+    98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,
+    108,101,114,32,40,67,111,112,112,101,114,41,0,68,117,97,108,32,80,111,
+    114,116,32,71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,
+    67,111,110,116,114,111,108,108,101,114,32,40,70,105,98,101,114,41,0,56,
+    50,53,52,49,69,73,0,56,50,53,52,49,69,82,0,56,50,53,52,48,
+    69,80,0,80,82,79,47,49,48,48,48,32,77,84,32,77,111,98,105,108,
+    101,32,99,111,110,110,101,99,116,105,111,110,0,56,50,53,52,55,69,73,
+    0,68,117,97,108,32,80,111,114,116,32,71,105,103,97,98,105,116,32,69,
+    116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,0,71,
+    105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,
+    114,111,108,108,101,114,32,40,77,111,98,105,108,101,41,0,56,50,53,52,
+    53,71,77,0,56,50,53,53,57,0,70,97,115,116,32,69,116,104,101,114,
+    110,101,116,32,80,67,73,47,67,97,114,100,66,117,115,32,67,111,110,116,
+    114,111,108,108,101,114,0,56,50,53,53,57,51,0,80,67,73,32,78,101,
+    116,119,111,114,107,105,110,103,32,100,101,118,105,99,101,0,56,50,56,48,
+    49,67,65,77,0,80,82,79,47,49,48,48,32,86,69,32,78,101,116,119,
+    111,114,107,32,67,111,110,110,101,99,116,105,111,110,0,80,82,79,47,49,
+    48,48,32,86,77,32,78,101,116,119,111,114,107,32,67,111,110,110,101,99,
+    116,105,111,110,0,56,50,53,54,50,69,72,0,80,104,111,110,101,108,105,
+    110,101,32,78,101,116,119,111,114,107,32,67,111,110,110,101,99,116,105,111,
+    110,0,76,65,78,32,67,111,110,116,114,111,108,108,101,114,0,80,82,79,
+    47,49,48,48,32,86,77,47,75,77,32,78,101,116,119,111,114,107,32,67,
+    111,110,110,101,99,116,105,111,110,0,49,48,48,49,49,55,51,52,0,76,
+    65,78,32,67,111,110,116,114,111,108,108,101,114,32,119,105,116,104,32,56,
+    50,53,54,50,69,84,47,69,90,32,80,72,89,0,56,50,56,48,49,68,
+    66,0,76,65,78,32,67,111,110,116,114,111,108,108,101,114,32,119,105,116,
+    104,32,56,50,53,54,50,69,84,47,69,90,32,40,67,78,82,41,32,80,
+    72,89,0,76,65,78,32,67,111,110,116,114,111,108,108,101,114,32,119,105,
+    116,104,32,56,50,53,54,50,69,77,47,69,88,32,80,72,89,0,76,65,
+    78,32,67,111,110,116,114,111,108,108,101,114,32,119,105,116,104,32,56,50,
+    53,54,50,69,77,47,69,88,32,40,67,78,82,41,32,80,72,89,0,53,
+    51,54,69,80,0,86,46,57,50,32,80,67,73,32,40,68,83,80,41,32,
+    68,97,116,97,32,70,97,120,32,77,111,100,101,109,0,80,82,79,47,87,
+    105,114,101,108,101,115,115,32,50,48,49,49,32,76,65,78,32,80,67,73,
+    32,67,97,114,100,0,73,110,116,101,108,40,82,41,32,80,82,79,47,87,
+    105,114,101,108,101,115,115,32,50,49,48,48,32,76,65,78,32,67,97,114,
+    100,32,68,114,105,118,101,114,0,56,50,53,57,55,69,88,0,49,48,32,
+    71,105,103,97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,
+    116,114,111,108,108,101,114,0,56,50,53,54,54,68,77,0,56,50,56,48,
+    49,69,66,47,69,82,0,80,82,79,47,49,48,48,32,86,69,32,78,101,
+    116,119,111,114,107,32,67,111,110,110,101,99,116,105,111,110,32,40,109,111,
+    98,105,108,101,41,0,80,82,79,47,49,48,48,32,86,77,32,78,101,116,
+    119,111,114,107,32,67,111,110,110,101,99,116,105,111,110,32,40,109,111,98,
+    105,108,101,41,0,56,50,53,53,49,81,77,0,73,110,116,101,108,32,80,
+    114,111,32,86,69,0,56,50,53,54,50,69,90,32,80,76,67,0,56,50,
+    56,48,49,70,66,47,70,82,47,70,87,47,70,82,87,0,56,50,53,54,
+    50,0,49,48,54,56,104,32,56,50,53,54,50,69,84,47,69,90,47,71,
+    84,47,71,90,32,80,82,79,47,49,48,48,32,86,69,32,69,116,104,101,
+    114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,0,48,51,50,49,
+    67,71,69,65,48,52,0,80,67,56,50,53,55,51,86,0,73,110,116,101,
+    108,32,110,101,116,119,111,114,107,32,99,111,110,116,114,111,108,108,101,114,
+    32,40,80,67,73,69,32,71,105,103,97,98,105,116,32,69,116,104,101,114,
+    110,101,116,41,0,56,50,53,55,51,69,0,73,110,116,101,108,32,67,111,
+    114,112,111,114,97,116,105,111,110,32,56,50,53,55,51,69,32,71,105,103,
+    97,98,105,116,32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,
+    108,108,101,114,32,40,67,111,112,112,101,114,41,0,50,55,68,65,0,80,
+    82,79,47,49,48,48,32,86,69,32,78,101,116,119,111,114,107,32,67,111,
+    110,116,114,111,108,108,101,114,0,56,50,53,55,51,76,0,73,110,116,101,
+    108,32,80,82,79,47,49,48,48,48,32,80,76,32,78,101,116,119,111,114,
+    107,32,65,100,97,112,116,111,114,0,56,50,53,55,50,71,73,0,73,110,
+    116,101,108,32,80,82,79,47,49,48,48,48,32,80,84,32,68,101,115,107,
+    116,111,112,0,56,50,56,49,53,47,69,80,47,80,0,72,111,115,116,45,
+    72,117,98,32,73,110,116,101,114,102,97,99,101,32,66,114,105,100,103,101,
+    32,47,32,68,82,65,77,32,67,116,114,108,114,0,56,50,56,49,53,0,
+    73,110,116,101,114,110,97,108,32,71,114,97,112,104,105,99,115,32,68,101,
+    118,105,99,101,0,56,50,56,49,53,47,56,50,56,49,53,69,77,47,69,
+    80,0,54,53,52,49,54,0,73,110,116,101,114,110,97,108,32,71,114,97,
+    112,104,105,99,115,32,68,101,118,105,99,101,32,91,56,49,48,47,56,49,
+    53,32,99,104,105,112,115,101,116,32,65,71,80,93,0,56,50,56,48,54,
+    65,65,0,73,47,79,32,65,80,73,67,32,68,101,118,105,99,101,0,66,
+    69,67,67,0,88,83,99,97,108,101,32,56,48,50,48,48,32,67,111,109,
+    112,97,110,105,111,110,32,67,104,105,112,32,40,70,80,71,65,41,0,73,
+    88,80,49,50,48,48,0,78,101,116,119,111,114,107,32,80,114,111,99,101,
+    115,115,111,114,0,56,50,53,53,120,69,82,47,73,84,0,70,97,115,116,
+    32,69,116,104,101,114,110,101,116,32,67,111,110,116,114,111,108,108,101,114,
+    0,56,50,48,57,50,65,65,0,83,65,65,32,55,49,49,54,32,72,0,
+    56,50,52,53,50,75,88,47,71,88,0,79,114,105,111,110,32,69,120,116,
+    101,110,100,101,100,32,69,120,112,114,101,115,115,32,67,80,85,32,116,111,
+    32,80,67,73,32,66,114,105,100,103,101,0,56,50,53,57,54,0,69,116,
+    104,101,114,69,120,112,114,101,115,115,32,80,82,79,47,49,48,0,56,50,
+    56,54,53,103,0,69,116,104,101,114,69,120,112,114,101,115,115,32,80,82,
+    79,49,48,48,0,69,69,32,80,82,79,47,49,48,48,32,83,109,97,114,
+    116,0,73,110,116,101,108,108,105,103,101,110,116,32,49,48,47,49,48,48,
+    32,70,97,115,116,32,69,116,104,101,114,110,101,116,32,65,100,97,112,116,
+    101,114,0,56,50,53,53,55,47,56,47,57,47,48,47,49,0,70,97,115,
+    116,32,69,116,104,101,114,110,101,116,32,76,65,78,32,67,111,110,116,114,
+    111,108,108,101,114,0,56,50,52,51,55,70,88,0,83,121,115,116,101,109,
+    32,67,111,110,116,114,111,108,108,101,114,32,40,84,83,67,41,0,56,50,
+    51,55,49,70,66,0,80,67,73,32,116,111,32,73,83,65,32,66,114,105,
+    100,103,101,32,40,84,114,105,116,111,110,41,0,70,87,56,50,51,55,49,
+    65,66,0,73,68,69,32,73,110,116,101,114,102,97,99,101,32,40,84,114,
+    105,116,111,110,41,0,49,54,51,52,53,0,68,83,86,68,32,77,111,100,
+    101,109,0,56,50,51,55,49,77,88,0,77,111,98,105,108,101,32,80,67,
+    73,32,73,47,79,32,73,68,69,32,88,99,101,108,101,114,97,116,111,114,
+    32,40,77,80,73,73,88,41,0,56,50,52,51,57,84,88,0,77,111,98,
+    105,108,101,32,83,121,115,116,101,109,32,67,111,110,116,114,111,108,108,101,
+    114,32,40,77,84,83,67,41,0,56,50,52,52,48,76,88,47,69,88,0,
+    80,67,73,32,38,97,109,112,59,32,77,101,109,111,114,121,0,56,50,51,
+    56,48,80,66,0,80,67,73,32,116,111,32,80,67,73,32,68,111,99,107,
+    105,110,103,32,66,114,105,100,103,101,0,56,50,51,56,48,65,66,0,77,
+    111,98,105,108,101,32,80,67,73,45,116,111,45,73,83,65,32,66,114,105,
+    100,103,101,32,40,77,73,83,65,41,0,54,56,51,48,53,51,0,80,114,
+    111,103,114,97,109,109,97,98,108,101,32,73,110,116,101,114,114,117,112,116,
+    32,68,101,118,105,99,101,0,56,50,52,54,54,71,88,0,73,110,116,101,
+    103,114,97,116,101,100,32,72,111,116,45,80,108,117,103,32,67,111,110,116,
+    114,111,108,108,101,114,32,40,73,72,80,67,41,0,56,50,55,53,50,0,
+    65,71,80,32,71,114,97,112,104,105,99,115,32,65,99,99,101,108,101,114,
+    97,116,111,114,0,52,50,50,57,0,77,111,98,105,108,101,32,80,67,73,
+    45,116,111,45,80,67,73,32,66,114,105,100,103,101,32,40,77,80,67,73,
+    50,41,0,56,50,52,51,48,72,88,0,83,121,115,116,101,109,32,67,111,
+    110,116,114,111,108,108,101,114,32,40,84,88,67,41,0,57,50,88,88,0,
+    83,73,71,77,65,84,69,76,32,83,84,65,67,32,57,50,88,88,32,67,
+    45,77,97,106,111,114,32,72,68,32,65,117,100,105,111,0,72,117,98,32,
+    73,110,116,101,114,102,97,99,101,32,116,111,32,80,67,73,32,66,114,105,
+    100,103,101,0,65,100,118,97,110,99,101,100,32,73,110,116,101,114,114,117,
+    112,116,32,67,111,110,116,114,111,108,108,101,114,0,56,50,56,55,48,80,
+    50,0,72,117,98,32,73,110,116,101,114,102,97,99,101,45,116,111,45,80,
+    67,73,32,66,114,105,100,103,101,0,49,52,54,49,49,48,49,52,0,72,
+    111,116,32,80,108,117,103,32,67,111,110,116,114,111,108,108,101,114,0,105,
+    57,54,48,82,80,32,77,105,99,114,111,112,114,111,99,101,115,115,111,114,
+    0,80,114,111,109,105,115,101,32,83,117,112,101,114,84,114,97,107,32,83,
+    88,54,48,48,48,32,73,68,69,32,82,65,73,68,32,67,111,110,116,114,
+    111,108,108,101,114,0,69,105,99,111,110,32,68,73,86,65,32,83,101,114,
+    118,101,114,32,86,111,105,99,101,32,80,82,73,32,50,46,48,32,40,80,
+    67,73,41,0,56,50,56,52,48,0,72,111,115,116,45,72,117,98,32,73,
+    110,116,101,114,102,97,99,101,32,65,32,66,114,105,100,103,101,32,47,32,
+    68,82,65,77,32,67,116,114,108,114,0,72,111,115,116,32,116,111,32,73,
+    47,79,32,72,117,98,32,66,114,105,100,103,101,32,40,81,117,97,100,32,
+    80,67,73,41,0,72,117,98,32,73,110,116,101,114,102,97,99,101,32,66,
+    32,66,114,105,100,103,101,0,56,50,56,52,53,71,91,71,76,47,71,86,
+    47,71,69,47,80,69,93,0,72,111,115,116,45,72,117,98,32,73,110,116,
+    101,114,102,97,99,101,32,66,114,105,100,103,101,0,56,50,56,52,53,91,
+    77,80,47,77,90,93,0,53,48,48,48,0,53,48,48,48,32,83,101,114,
+    105,101,115,32,67,104,105,112,115,101,116,32,68,77,65,32,69,110,103,105,
+    110,101,0,56,50,56,48,49,65,65,0,65,67,57,55,32,65,117,100,105,
+    111,32,67,111,110,116,114,111,108,108,101,114,46,32,119,101,98,115,105,116,
+    101,32,116,111,32,100,111,119,110,108,111,97,100,32,45,32,104,116,116,112,
+    58,47,47,119,119,119,46,105,110,116,101,108,46,99,111,109,47,100,101,115,
+    105,103,110,47,99,104,105,112,115,101,116,115,47,109,97,110,117,97,108,115,
+    47,50,57,56,48,50,56,48,49,46,112,0,76,80,67,32,73,110,116,101,
+    114,102,97,99,101,0,73,68,69,32,67,111,110,116,114,111,108,108,101,114,
+    32,40,85,108,116,114,97,65,84,65,47,54,54,41,0,73,110,116,101,108,
+    32,56,50,56,48,49,68,66,77,32,83,77,47,66,85,83,32,67,111,110,
+    116,114,111,108,108,101,114,32,50,52,67,51,0,65,117,114,101,97,108,32,
+    40,65,68,49,56,56,49,32,83,79,85,78,68,77,65,88,41,32,80,108,
+    97,99,97,32,77,-61,-93,101,32,65,115,97,107,105,32,80,51,45,49,52,
+    49,0,65,67,39,57,55,32,77,111,100,101,109,32,67,111,110,116,114,111,
+    108,108,101,114,0,56,50,56,48,49,65,66,0,73,68,69,32,67,111,110,
+    116,114,111,108,108,101,114,32,40,85,108,116,114,97,65,84,65,47,51,51,
+    41,0,56,50,56,52,53,71,0,86,105,100,101,111,32,99,111,110,116,114,
+    111,108,101,114,0,65,67,57,55,32,77,111,100,101,109,32,67,111,110,116,
+    114,111,108,108,101,114,0,56,50,56,49,48,0,112,99,105,32,98,117,115,
+    0,56,50,56,48,49,66,65,0,76,80,67,32,73,110,116,101,114,102,97,
+    99,101,32,66,114,105,100,103,101,44,32,73,67,72,50,0,56,50,56,48,
+    49,66,65,47,66,65,77,0,85,83,66,32,67,111,110,116,114,111,108,108,
+    101,114,44,32,85,83,66,45,65,0,48,48,53,53,49,49,48,65,0,85,
+    83,66,32,67,111,110,116,114,111,108,108,101,114,44,32,85,83,66,45,66,
+    0,65,118,97,110,99,101,32,65,67,57,55,32,65,117,100,105,111,32,67,
+    111,110,116,114,111,108,108,101,114,0,56,50,56,48,49,66,65,77,47,67,
+    65,77,47,68,66,77,0,56,50,53,53,57,69,82,0,56,50,53,53,57,
+    69,82,32,73,110,116,101,103,114,97,116,101,100,32,49,48,66,97,115,101,
+    45,84,47,49,48,48,66,97,115,101,45,84,88,32,69,116,104,101,114,110,
+    101,116,32,67,111,110,116,114,111,108,108,101,114,0,56,50,56,48,49,66,
+    65,77,0,56,50,56,48,49,69,0,76,65,78,48,32,67,111,110,116,114,
+    111,108,108,101,114,0,76,65,78,49,32,67,111,110,116,114,111,108,108,101,
+    114,0,56,50,56,48,49,67,65,0,56,50,56,48,49,67,65,47,67,65,
+    77,0,65,67,57,55,32,65,117,100,105,111,32,67,111,110,116,114,111,108,
+    108,101,114,0,65,67,32,57,55,32,77,111,100,101,109,32,67,111,110,116,
+    114,111,108,108,101,114,0,85,108,116,114,97,65,84,65,32,73,68,69,32,
+    67,111,110,116,114,111,108,108,101,114,0,85,108,116,114,97,65,84,65,47,
+    49,48,48,32,73,68,69,32,67,111,110,116,114,111,108,108,101,114,0,76,
+    80,67,32,73,110,116,101,114,102,97,99,101,32,111,114,32,73,83,65,32,
+    98,114,105,100,103,101,58,32,115,101,101,32,78,111,116,101,115,0,56,50,
+    56,48,49,63,63,0,85,83,66,32,50,46,48,32,69,72,67,73,32,67,
+    111,110,116,111,114,111,108,108,101,114,0,56,50,56,48,49,68,66,47,68,
+    66,76,0,56,50,56,48,49,68,66,47,68,66,76,47,68,66,77,0,85,
+    83,66,32,85,72,67,73,32,67,111,110,116,114,111,108,108,101,114,32,35,
+    49,0,85,83,66,32,85,72,67,73,32,67,111,110,116,114,111,108,108,101,
+    114,0,65,76,67,54,53,53,0,82,101,97,108,84,101,107,0,85,83,66,
+    32,85,72,67,73,32,67,111,110,116,114,111,108,108,101,114,32,35,51,0,
+    56,50,56,48,49,68,66,77,0,73,68,69,32,67,111,110,116,114,111,108,
+    108,101,114,32,40,85,108,116,114,97,65,84,65,47,49,48,48,41,0,85,
+    83,66,32,69,72,67,73,32,67,111,110,116,114,111,108,108,101,114,0,56,
+    50,56,48,49,69,66,0,85,83,66,32,85,72,67,73,32,67,111,110,116,
+    114,111,108,108,101,114,32,35,50,0,56,49,53,66,49,48,52,68,0,109,
+    117,108,116,105,109,101,100,105,97,32,97,117,100,105,111,32,100,101,118,105,
+    99,101,32,40,99,111,100,101,99,32,65,67,57,55,41,32,83,111,117,110,
+    100,77,65,88,32,111,114,32,86,73,65,0,76,80,67,32,73,110,116,101,
+    114,102,97,99,101,32,67,111,110,116,114,111,108,108,101,114,0,85,83,66,
+    32,85,72,67,73,32,67,111,110,116,114,111,108,108,101,114,32,35,52,0,
+    56,50,56,48,49,69,82,0,83,65,84,65,32,67,111,110,116,114,111,108,
+    108,101,114,32,40,82,65,73,68,41,0,56,50,56,50,48,0,72,111,115,
+    116,32,66,114,105,100,103,101,32,40,77,67,72,41,0,56,50,56,48,53,
+    65,65,0,77,101,109,111,114,121,32,84,114,97,110,115,108,97,116,111,114,
+    32,72,117,98,32,40,77,84,72,41,0,56,50,56,48,52,65,65,0,77,
+    101,109,111,114,121,32,82,101,112,101,97,116,101,114,32,72,117,98,32,102,
+    111,114,32,83,68,82,65,77,32,40,77,82,72,45,83,41,0,56,50,56,
+    53,48,47,69,0,72,111,115,116,45,72,117,98,32,73,110,116,101,114,102,
+    97,99,101,32,66,114,105,100,103,101,40,65,50,32,115,116,101,112,41,0,
+    56,50,56,54,48,0,72,111,115,116,45,72,117,98,32,73,110,116,101,114,
+    102,97,99,101,95,65,32,66,114,105,100,103,101,32,40,68,80,32,109,111,
+    100,101,41,0,56,50,56,53,48,47,56,53,48,69,47,56,54,48,0,72,
+    117,98,32,73,110,116,101,114,102,97,99,101,95,66,32,66,114,105,100,103,
+    101,0,72,117,98,32,73,110,116,101,114,102,97,99,101,95,67,32,66,114,
+    105,100,103,101,0,40,81,117,97,100,32,80,114,111,99,101,115,115,111,114,
+    32,109,111,100,101,41,0,69,55,53,48,48,0,72,111,115,116,45,72,73,
+    32,66,114,105,100,103,101,32,38,97,109,112,59,32,68,82,65,77,32,67,
+    111,110,116,114,111,108,108,101,114,0,69,55,53,48,48,47,69,55,53,48,
+    49,0,68,82,65,77,32,67,111,110,116,114,111,108,108,101,114,32,69,114,
+    114,111,114,32,82,101,112,111,114,116,105,110,103,0,72,73,95,66,32,86,
+    105,114,116,117,97,108,32,80,67,73,45,116,111,45,80,67,73,32,66,114,
+    105,100,103,101,0,72,73,95,66,32,80,67,73,45,116,111,45,80,67,73,
+    32,66,114,105,100,103,101,32,69,114,114,111,114,32,82,101,112,111,114,116,
+    105,110,103,0,72,73,95,67,32,86,105,114,116,117,97,108,32,80,67,73,
+    45,116,111,45,80,67,73,32,66,114,105,100,103,101,0,72,73,95,67,32,
+    80,67,73,45,116,111,45,80,67,73,32,66,114,105,100,103,101,32,69,114,
+    114,111,114,32,82,101,112,111,114,116,105,110,103,0,72,73,95,68,32,86,
+    105,114,116,117,97,108,32,80,67,73,45,116,111,45,80,67,73,32,66,114,
+    105,100,103,101,0,72,73,95,68,32,80,67,73,45,116,111,45,80,67,73,
+    32,66,114,105,100,103,101,32,69,114,114,111,114,32,82,101,112,111,114,116,
+    105,110,103,0,69,55,53,48,49,0,72,111,115,116,32,67,111,110,116,114,
+    111,108,108,101,114,0,69,55,53,48,53,0,50,53,53,49,49,48,49,52,
+    0,72,111,115,116,32,82,65,83,32,67,111,110,116,114,111,108,108,101,114,
+    0,69,55,50,48,53,47,69,55,53,48,53,0,80,67,73,45,116,111,45,
+    65,71,80,32,66,114,105,100,103,101,0,72,117,98,32,73,110,116,101,114,
+    102,97,99,101,95,66,32,80,67,73,45,116,111,45,80,67,73,32,66,114,
+    105,100,103,101,0,72,117,98,32,73,47,70,95,66,32,80,67,73,45,116,
+    111,45,80,67,73,32,66,114,105,100,103,101,32,69,114,114,111,114,32,82,
+    101,112,111,114,116,0,69,55,50,48,53,0,56,50,56,52,53,71,47,71,
+    76,47,71,86,47,71,69,47,80,69,0,68,82,65,77,32,67,111,110,116,
+    114,111,108,108,101,114,32,47,32,72,111,115,116,45,72,117,98,32,73,47,
+    70,32,66,114,105,100,103,101,0,72,111,115,116,45,116,111,45,65,71,80,
+    32,66,114,105,100,103,101,0,73,110,116,101,103,114,97,116,101,100,32,71,
+    114,97,112,104,105,99,115,32,68,101,118,105,99,101,0,56,50,56,54,53,
+    71,47,80,69,47,80,44,32,56,50,56,52,56,80,0,68,82,65,77,32,
+    67,111,110,116,114,111,108,108,101,114,32,47,32,72,111,115,116,45,72,117,
+    98,32,73,110,116,101,114,102,97,99,101,0,56,50,56,54,53,71,0,80,
+    67,73,45,116,111,45,67,83,65,32,66,114,105,100,103,101,0,79,118,101,
+    114,102,108,111,119,32,67,111,110,102,105,103,117,114,97,116,105,111,110,0,
+    56,50,56,55,53,80,47,69,55,50,49,48,0,56,50,56,55,53,80,0,
+    80,67,73,32,116,111,32,67,83,65,32,66,114,105,100,103,101,0,57,49,
+    53,71,47,80,47,71,86,0,72,111,115,116,32,66,114,105,100,103,101,32,
+    47,32,68,82,65,77,32,67,111,110,116,114,111,108,108,101,114,0,57,49,
+    53,71,47,80,47,71,86,44,32,57,50,53,88,47,88,69,63,0,72,111,
+    115,116,45,80,67,73,32,69,120,112,114,101,115,115,32,66,114,105,100,103,
+    101,0,48,49,56,49,49,48,50,0,56,50,57,49,53,103,47,103,118,47,
+    57,49,48,103,108,32,69,120,112,114,101,115,115,32,67,104,105,112,115,101,
+    116,32,70,97,109,105,108,121,0,56,50,57,50,53,88,47,88,69,0,69,
+    55,50,50,49,0,72,111,115,116,32,66,114,105,100,103,101,47,68,82,65,
+    77,32,67,111,110,116,114,111,108,108,101,114,0,80,67,73,32,69,120,112,
+    114,101,115,115,32,66,114,105,100,103,101,0,73,110,116,101,114,110,97,108,
+    32,71,114,97,112,104,105,99,115,0,57,49,53,71,77,0,77,111,98,105,
+    108,101,32,73,110,116,101,108,40,82,41,32,57,49,53,71,77,47,80,77,
+    47,71,77,83,47,57,49,48,71,77,76,32,69,120,112,114,101,115,115,32,
+    80,114,111,99,101,115,115,111,114,32,116,111,32,68,82,65,77,32,67,111,
+    110,116,114,111,108,108,101,114,0,54,51,48,48,69,83,66,0,85,83,66,
+    32,49,46,49,32,85,72,67,73,32,67,111,110,116,114,111,108,108,101,114,
+    32,35,49,0,85,83,66,32,49,46,49,32,85,72,67,73,32,67,111,110,
+    116,114,111,108,108,101,114,32,35,50,0,87,97,116,99,104,100,111,103,32,
+    84,105,109,101,114,0,65,80,73,67,49,0,85,83,66,32,50,46,48,32,
+    69,72,67,73,32,67,111,110,116,114,111,108,108,101,114,0,72,117,98,32,
+    73,110,116,101,114,102,97,99,101,32,116,111,32,80,67,73,45,88,32,66,
+    114,105,100,103,101,0,83,101,114,105,97,108,32,65,84,65,32,67,111,110,
+    116,114,111,108,108,101,114,32,40,82,65,73,68,32,109,111,100,101,41,0,
+    69,56,53,48,48,0,72,117,98,32,73,110,116,101,114,102,97,99,101,32,
+    49,46,53,0,80,67,73,32,69,120,112,114,101,115,115,32,80,111,114,116,
+    32,68,0,80,67,73,32,69,120,112,114,101,115,115,32,80,111,114,116,32,
+    67,48,0,80,67,73,32,69,120,112,114,101,115,115,32,80,111,114,116,32,
+    67,49,0,80,67,73,32,69,120,112,114,101,115,115,32,80,111,114,116,32,
+    66,48,0,80,67,73,32,69,120,112,114,101,115,115,32,80,111,114,116,32,
+    66,49,0,80,67,73,32,69,120,112,114,101,115,115,32,80,111,114,116,32,
+    65,48,0,80,67,73,32,69,120,112,114,101,115,115,32,80,111,114,116,32,
+    65,49,0,56,50,56,48,49,70,66,47,70,82,0,56,50,56,48,49,70,
+    66,77,0,76,80,67,32,73,110,116,101,114,102,97,99,101,32,66,114,105,
+    100,103,101,32,40,73,67,72,54,45,77,41,0,56,50,56,48,49,70,98,
+    0,56,50,56,48,49,70,82,0,83,65,84,65,32,65,72,67,73,32,67,
+    111,110,116,114,111,108,108,101,114,0,80,67,73,32,69,120,112,114,101,115,
+    115,32,80,111,114,116,32,49,0,80,67,73,32,69,120,112,114,101,115,115,
+    32,80,111,114,116,32,50,0,56,50,56,48,49,70,66,0,80,67,73,32,
+    69,120,112,114,101,115,115,32,80,111,114,116,32,51,0,80,67,73,32,69,
+    120,112,114,101,115,115,32,80,111,114,116,32,52,0,49,49,53,56,51,54,
+    53,57,0,82,101,97,108,116,101,107,32,72,105,103,104,32,68,101,102,105,
+    110,105,116,105,111,110,32,65,117,100,105,111,32,67,111,110,116,114,111,108,
+    108,101,114,115,0,56,50,56,48,49,66,65,47,67,65,0,73,110,116,101,
+    103,114,97,116,101,100,32,73,110,116,101,108,32,72,105,103,104,32,68,101,
+    102,105,110,105,116,105,111,110,32,65,117,100,105,111,32,55,46,49,32,67,
+    104,97,110,110,101,108,0,73,110,116,101,108,32,56,50,56,48,49,68,66,
+    40,77,41,32,73,67,72,52,40,45,77,41,32,45,32,65,67,39,57,55,
+    32,65,117,100,105,111,32,67,111,110,116,114,111,108,108,101,114,32,91,66,
+    45,48,93,9,80,67,73,0,73,110,116,101,108,32,67,111,114,112,111,114,
+    97,116,105,111,110,32,32,56,50,56,51,48,77,47,77,71,32,83,68,82,
+    65,77,32,67,111,110,116,114,111,108,108,101,114,32,47,32,72,111,0,65,
+    67,32,39,57,55,32,65,117,100,105,111,32,67,111,110,116,114,111,108,108,
+    101,114,47,32,83,105,103,109,97,116,101,108,32,40,83,111,117,110,100,77,
+    65,88,32,73,110,116,101,103,114,97,116,101,100,32,68,105,103,105,116,97,
+    108,32,65,117,100,105,111,41,0,56,50,56,48,49,70,66,47,70,66,77,
+    0,85,108,116,114,97,32,65,84,65,32,83,116,111,114,97,103,101,32,67,
+    111,110,116,114,111,108,108,101,114,115,32,45,32,50,54,54,70,0,54,50,
+    48,56,57,65,50,0,76,83,73,32,76,79,71,73,67,44,32,54,50,48,
+    56,57,65,50,44,32,76,83,73,83,65,83,49,48,54,56,32,66,48,44,
+    32,84,32,48,54,50,48,44,32,87,69,32,49,49,57,50,48,48,46,49,
+    0,56,50,57,52,53,71,47,71,90,47,80,47,80,76,0,72,111,115,116,
+    32,116,111,32,80,67,73,32,69,120,112,114,101,115,115,32,66,114,105,100,
+    103,101,0,56,50,57,52,53,71,47,71,90,0,56,50,57,55,53,88,0,
+    73,110,116,101,108,32,57,55,53,88,32,69,120,112,114,101,115,115,32,67,
+    104,105,112,115,101,116,0,56,50,57,49,53,71,0,71,114,97,112,104,105,
+    99,115,32,100,101,118,105,99,101,0,71,114,97,112,104,105,99,115,32,100,
+    101,118,105,99,101,58,32,56,50,57,49,53,71,47,71,86,47,57,49,48,
+    71,76,32,69,120,112,114,101,115,115,32,67,104,105,112,115,101,116,32,70,
+    97,109,105,108,121,0,77,111,98,105,108,101,32,56,50,57,49,53,71,76,
+    120,47,120,47,120,0,77,111,98,105,108,101,32,73,110,116,101,108,40,82,
+    41,32,57,49,53,71,77,47,71,77,83,47,44,32,57,49,48,71,77,76,
+    32,69,120,112,114,101,115,115,32,67,104,105,112,115,101,116,32,70,97,109,
+    105,108,121,0,56,55,52,48,55,57,0,105,57,52,53,71,77,32,69,120,
+    112,114,101,115,115,32,67,104,105,112,115,101,116,0,57,52,53,71,77,0,
+    73,110,116,101,108,32,57,52,53,71,77,47,57,53,48,0,57,52,53,71,
+    76,0,73,110,116,101,108,32,56,50,56,48,49,71,66,47,71,82,32,40,
+    73,67,72,55,32,70,97,109,105,108,121,41,32,76,80,67,32,73,110,116,
+    101,114,102,97,99,101,32,67,111,110,116,114,111,108,108,101,114,32,45,32,
+    50,55,66,56,0,56,50,56,48,49,32,71,66,32,83,101,114,105,97,108,
+    32,65,84,65,32,83,116,111,114,97,103,101,32,67,111,110,116,114,111,108,
+    108,101,114,115,0,73,110,116,101,108,32,57,52,53,80,76,0,73,110,116,
+    101,108,32,77,101,103,97,82,65,73,68,32,83,116,111,114,97,103,101,32,
+    116,101,99,104,110,111,108,111,103,121,0,50,57,51,51,49,48,49,57,0,
+    77,105,99,114,111,115,111,102,116,32,85,65,65,32,66,117,115,32,72,68,
+    32,65,117,100,105,111,0,49,66,55,54,49,48,49,57,0,73,110,116,101,
+    108,32,80,82,79,47,49,48,48,0,73,110,116,101,108,40,82,41,32,80,
+    82,79,47,49,48,48,32,86,69,32,78,101,116,119,111,114,107,32,67,111,
+    110,110,101,99,116,105,111,110,0,56,50,56,48,49,71,0,85,108,116,114,
+    97,32,65,84,65,45,67,111,110,116,114,111,108,108,101,114,0,73,67,72,
+    56,32,52,32,112,111,114,116,32,83,101,114,105,97,108,32,65,84,65,32,
+    83,116,111,114,97,103,101,32,67,111,110,116,114,111,108,108,101,114,0,73,
+    67,72,56,32,50,32,112,111,114,116,32,83,101,114,105,97,108,32,65,84,
+    65,32,83,116,111,114,97,103,101,32,67,111,110,116,114,111,108,108,101,114,
+    0,73,67,72,56,77,32,51,32,112,111,114,116,32,83,101,114,105,97,108,
+    32,65,84,65,32,83,116,111,114,97,103,101,32,67,111,110,116,114,111,108,
+    108,101,114,0,83,97,110,116,97,32,82,111,115,97,0,73,110,116,101,108,
+    40,82,41,32,56,50,56,48,49,72,69,77,47,72,66,77,32,83,65,84,
+    65,32,65,72,67,73,32,67,111,110,116,114,111,108,108,101,114,0,56,49,
+    69,67,49,48,52,51,32,40,63,41,0,73,67,72,56,32,69,110,104,97,
+    110,99,101,100,32,85,83,66,50,32,69,110,104,97,110,99,101,100,32,72,
+    111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,65,65,0,73,110,
+    116,101,108,40,82,41,32,73,67,72,56,32,70,97,109,105,108,121,32,83,
+    77,66,117,115,32,67,111,110,116,114,111,108,108,101,114,0,56,50,56,48,
+    49,72,0,38,97,109,112,59,83,85,66,83,89,83,95,56,56,48,49,49,
+    48,51,51,38,97,109,112,59,82,69,86,95,48,50,0,73,67,72,56,77,
+    32,85,108,116,114,97,32,65,84,65,32,83,116,111,114,97,103,101,32,67,
+    111,110,116,114,111,108,108,101,114,115,32,45,32,50,56,53,48,0,73,67,
+    72,57,32,70,97,109,105,108,121,32,83,77,66,117,115,32,67,111,110,116,
+    114,111,108,108,101,114,0,73,110,116,101,108,40,82,41,32,69,120,112,114,
+    101,115,115,32,67,104,105,112,115,101,116,0,73,110,116,101,108,40,82,41,
+    32,69,120,112,114,101,115,115,32,67,104,105,112,115,101,116,32,40,68,101,
+    108,108,32,86,101,114,115,105,111,110,41,0,48,120,56,48,56,54,0,73,
+    110,116,101,108,40,82,41,32,77,97,110,97,103,101,109,101,110,116,32,69,
+    110,103,105,110,101,32,73,110,116,101,114,102,97,99,101,0,81,57,54,53,
+    47,81,57,54,51,0,73,110,116,101,108,32,80,67,73,32,83,101,114,105,
+    97,108,32,80,111,114,116,0,63,40,56,50,80,57,54,53,41,0,73,110,
+    116,101,108,32,80,57,54,53,47,71,57,54,53,32,80,114,111,99,101,115,
+    115,111,114,32,116,111,32,73,47,79,32,67,111,110,116,114,111,108,108,101,
+    114,0,63,40,56,50,81,57,54,53,44,32,56,50,71,57,54,53,44,32,
+    56,50,80,57,54,53,41,0,73,110,116,101,108,32,80,57,54,53,47,71,
+    57,54,53,32,80,67,73,32,69,120,112,114,101,115,115,32,82,111,111,116,
+    32,80,111,114,116,0,81,51,53,45,67,104,105,112,115,101,116,0,73,110,
+    116,101,108,40,82,41,32,77,97,110,97,103,101,109,101,110,116,32,69,110,
+    103,105,110,101,32,73,110,116,101,114,102,97,99,101,32,40,72,69,67,73,
+    41,0,83,101,114,105,97,108,32,79,118,101,114,32,76,65,78,0,73,110,
+    116,101,108,32,71,77,57,54,53,0,83,82,67,85,51,50,0,73,50,79,
+    32,49,46,53,32,82,65,73,68,32,67,111,110,116,114,111,108,108,101,114,
+    0,51,49,50,52,52,0,56,50,56,53,53,80,77,0,56,50,56,51,48,
+    91,77,80,93,0,72,111,115,116,45,72,117,98,32,73,47,70,32,66,114,
+    105,100,103,101,32,47,32,83,68,82,65,77,32,67,111,110,116,114,111,108,
+    108,101,114,0,56,50,56,51,48,77,47,77,80,0,72,111,115,116,45,65,
+    71,80,32,66,114,105,100,103,101,0,56,50,56,51,48,77,47,77,71,0,
+    67,80,85,32,116,111,32,73,47,79,32,66,114,105,100,103,101,0,56,50,
+    56,51,53,0,83,68,82,65,77,32,67,111,110,116,114,111,108,108,101,114,
+    32,47,32,72,111,115,116,45,104,117,98,32,73,110,116,101,114,102,97,99,
+    101,0,56,53,50,71,77,47,71,77,86,0,56,50,56,53,50,71,77,69,
+    47,80,77,0,86,105,114,116,117,97,108,32,80,67,73,32,116,111,32,65,
+    71,80,32,66,114,105,100,103,101,0,83,121,115,116,101,109,32,77,101,109,
+    111,114,121,32,67,111,110,116,114,111,108,108,101,114,0,56,53,50,71,77,
+    0,67,111,110,102,105,103,117,114,97,116,105,111,110,32,80,114,111,99,101,
+    115,115,0,69,55,53,50,48,0,77,101,109,111,114,121,32,67,111,110,116,
+    114,111,108,108,101,114,32,72,117,98,0,69,55,51,50,48,0,69,55,53,
+    50,53,0,77,67,72,32,69,114,114,111,114,32,82,101,112,111,114,116,105,
+    110,103,32,82,101,103,105,115,116,101,114,115,0,68,77,65,32,67,111,110,
+    116,114,111,108,108,101,114,32,82,101,103,105,115,116,101,114,115,0,80,67,
+    73,32,69,120,112,114,101,115,115,32,80,111,114,116,32,65,0,80,67,73,
+    32,69,120,112,114,101,115,115,32,80,111,114,116,32,66,0,80,67,73,32,
+    69,120,112,114,101,115,115,32,80,111,114,116,32,67,0,69,120,116,101,110,
+    100,101,100,32,67,111,110,102,105,103,117,114,97,116,105,111,110,32,82,101,
+    103,105,115,116,101,114,115,0,77,67,72,32,67,111,110,116,114,111,108,32,
+    82,101,103,105,115,116,101,114,115,0,67,114,101,97,116,105,120,0,86,46,
+    57,48,32,72,97,77,32,77,111,100,101,109,0,77,80,67,73,51,66,0,
+    32,100,114,105,118,101,114,73,110,116,101,108,32,80,82,79,47,87,105,114,
+    101,108,101,115,115,32,50,50,48,48,66,71,0,49,48,52,49,56,48,56,
+    54,0,73,110,116,101,108,32,51,57,52,53,65,66,71,32,87,105,114,101,
+    108,101,115,115,32,76,65,78,32,99,111,110,116,114,111,108,108,101,114,0,
+    50,57,49,53,65,66,71,0,73,110,116,101,108,32,40,82,41,32,80,82,
+    79,47,87,105,114,101,108,101,115,115,32,50,50,48,48,66,71,32,78,101,
+    116,119,111,114,107,32,67,111,110,110,101,99,116,105,111,110,44,32,40,82,
+    41,32,80,82,79,47,87,105,114,101,108,101,115,115,32,50,57,49,53,65,
+    66,71,32,78,101,116,119,111,114,107,32,67,111,110,110,101,99,116,105,111,
+    110,0,73,110,116,101,108,32,80,114,111,32,87,105,114,101,108,101,115,115,
+    32,50,57,49,53,65,66,71,0,56,48,50,46,49,49,97,47,98,47,103,
+    32,87,76,97,110,32,97,100,97,112,116,101,114,0,51,57,52,53,65,66,
+    71,0,73,110,116,101,108,40,82,41,32,80,82,79,47,87,105,114,101,108,
+    101,115,115,32,51,57,52,53,65,66,71,0,73,110,116,101,108,32,52,57,
+    54,53,65,71,78,0,73,110,116,101,108,-62,-82,32,87,105,114,101,108,101,
+    115,115,32,87,105,70,105,32,76,105,110,107,32,52,57,54,53,65,71,78,
+    40,115,117,112,112,111,114,116,105,110,103,32,56,48,50,46,49,49,97,47,
+    98,47,103,47,68,114,97,102,116,45,78,41,0,73,110,116,101,108,-62,-82,
+    32,87,105,114,101,108,101,115,115,32,87,105,70,105,32,76,105,110,107,32,
+    52,57,54,53,65,71,78,0,80,82,79,47,68,83,76,32,50,49,48,48,
+    0,77,111,100,101,109,32,45,32,80,80,80,0,80,82,79,47,68,83,76,
+    32,50,50,48,48,0,77,111,100,101,109,32,45,32,80,80,80,111,65,0,
+    73,47,79,32,80,114,111,99,101,115,115,111,114,32,65,100,100,114,101,115,
+    115,32,84,114,97,110,115,108,97,116,105,111,110,32,85,110,105,116,0,73,
+    47,79,32,67,111,109,112,97,110,105,111,110,32,85,110,105,116,32,65,100,
+    100,114,101,115,115,32,84,114,97,110,115,108,97,116,105,111,110,0,69,72,
+    67,73,32,57,54,48,32,101,109,117,108,97,116,111,114,0,56,50,51,55,
+    49,83,66,0,80,73,73,88,51,32,80,67,73,45,116,111,45,73,83,65,
+    32,66,114,105,100,103,101,32,40,84,114,105,116,111,110,32,73,73,41,0,
+    80,73,73,88,51,32,73,68,69,32,73,110,116,101,114,102,97,99,101,32,
+    40,84,114,105,116,111,110,32,73,73,41,0,80,73,73,88,51,32,85,83,
+    66,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,32,40,84,
+    114,105,116,111,110,32,73,73,41,0,56,50,52,51,55,86,88,0,80,66,
+    32,54,52,50,51,54,53,45,48,48,51,0,73,110,116,101,108,32,66,117,
+    115,105,110,101,115,115,32,86,105,100,101,111,32,67,111,110,102,101,114,101,
+    110,99,105,110,103,32,67,97,114,100,0,83,121,115,116,101,109,32,67,111,
+    110,116,114,111,108,108,101,114,32,40,77,84,88,67,41,44,32,112,97,114,
+    116,32,111,102,32,52,51,48,84,88,32,99,104,105,112,115,101,116,0,56,
+    50,51,55,49,65,66,47,69,66,47,77,66,0,80,73,73,88,52,47,52,
+    69,47,52,77,32,73,83,65,32,66,114,105,100,103,101,0,80,73,73,88,
+    52,47,52,69,47,52,77,32,73,68,69,32,67,111,110,116,114,111,108,108,
+    101,114,0,80,73,73,88,52,47,52,69,47,52,77,32,85,83,66,32,73,
+    110,116,101,114,102,97,99,101,0,80,73,73,88,52,47,52,69,47,52,77,
+    32,80,111,119,101,114,32,77,97,110,97,103,101,109,101,110,116,32,67,111,
+    110,116,114,111,108,108,101,114,0,71,114,97,112,104,105,99,115,32,67,111,
+    110,116,114,111,108,108,101,114,0,56,50,56,49,48,45,68,67,49,48,48,
+    0,73,110,116,101,108,-62,-82,32,56,50,56,49,48,32,71,114,97,112,104,
+    105,99,115,32,67,111,110,116,114,111,108,108,101,114,0,56,50,56,49,48,
+    69,0,73,110,116,101,108,32,68,105,114,101,99,116,32,65,71,80,32,56,
+    49,48,32,67,104,105,112,115,101,116,0,56,50,56,49,48,45,68,67,49,
+    51,51,0,72,111,115,116,32,66,114,105,100,103,101,32,97,110,100,32,77,
+    101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,72,117,98,
+    0,71,114,97,112,104,105,99,115,32,68,101,118,105,99,101,32,40,70,83,
+    66,32,49,51,51,32,77,72,122,41,0,56,50,56,49,48,45,77,32,68,
+    67,45,49,48,48,0,56,50,56,49,48,45,77,32,68,67,45,49,51,51,
+    0,73,110,116,101,108,32,56,50,56,48,49,40,114,41,32,65,65,65,32,
+    32,65,67,39,57,55,32,65,117,100,105,111,32,68,101,118,105,99,101,0,
+    72,111,115,116,47,80,67,73,32,98,114,105,100,103,101,32,105,110,32,52,
+    52,48,76,88,47,69,88,32,65,71,80,32,99,104,105,112,115,101,116,0,
+    56,50,52,52,51,32,101,120,47,108,120,0,65,71,80,32,100,101,118,105,
+    99,101,32,105,110,32,52,52,48,76,88,47,69,88,32,65,71,80,32,99,
+    104,105,112,115,101,116,0,52,52,48,76,88,47,69,88,0,56,50,52,52,
+    51,66,88,47,90,88,0,52,52,48,66,88,47,90,88,32,65,71,80,115,
+    101,116,32,72,111,115,116,32,66,114,105,100,103,101,0,52,52,48,66,88,
+    47,90,88,32,65,71,80,115,101,116,32,80,67,73,45,116,111,45,80,67,
+    73,32,98,114,105,100,103,101,0,52,52,48,66,88,47,90,88,32,99,104,
+    105,112,115,101,116,32,72,111,115,116,45,116,111,45,80,67,73,32,66,114,
+    105,100,103,101,0,56,50,52,52,51,77,88,0,65,67,39,57,55,32,65,
+    117,100,105,111,32,100,101,118,105,99,101,0,56,50,52,52,48,32,45,32,
+    52,52,51,77,88,0,65,67,57,55,32,77,111,100,101,109,32,67,111,110,
+    116,114,111,108,108,101,114,32,40,87,105,110,109,111,100,101,109,41,0,85,
+    83,66,32,85,110,105,118,101,114,115,97,108,32,72,111,115,116,32,67,111,
+    110,116,114,111,108,108,101,114,0,56,50,52,52,51,71,88,0,103,114,97,
+    112,104,105,99,115,32,100,101,118,105,99,101,0,56,50,51,55,50,70,66,
+    47,56,50,52,54,56,71,88,0,76,80,67,47,70,87,72,32,73,110,116,
+    101,114,102,97,99,101,0,83,77,32,66,117,115,32,67,111,110,116,114,111,
+    108,108,101,114,0,56,50,51,55,50,70,66,0,73,69,69,69,49,51,57,
+    52,32,79,112,101,110,72,67,73,32,72,111,115,116,32,67,111,110,116,114,
+    111,108,108,101,114,0,56,50,55,52,48,0,115,108,100,97,106,102,111,105,
+    97,115,106,108,107,0,108,115,100,117,114,106,108,107,0,56,50,52,53,52,
+    75,88,47,71,88,0,52,53,48,75,88,47,71,88,32,80,67,73,32,66,
+    114,105,100,103,101,32,40,79,114,105,111,110,41,0,56,50,52,53,51,75,
+    88,47,71,88,0,52,53,48,75,88,47,71,88,32,77,101,109,111,114,121,
+    32,67,111,110,116,114,111,108,108,101,114,32,40,79,114,105,111,110,41,0,
+    56,50,52,53,49,78,88,0,52,53,48,78,88,32,80,67,73,115,101,116,
+    32,77,101,109,111,114,121,32,38,97,109,112,59,32,73,47,79,32,67,111,
+    110,116,114,111,108,108,101,114,0,56,50,52,53,52,78,88,47,56,50,52,
+    54,55,71,88,0,80,67,73,32,69,120,112,97,110,100,101,114,32,66,114,
+    105,100,103,101,0,56,50,52,54,49,71,88,0,83,121,115,116,101,109,32,
+    65,100,100,114,101,115,115,32,99,111,110,116,114,111,108,108,101,114,0,56,
+    50,52,54,50,71,88,0,83,121,115,116,101,109,32,68,97,116,97,32,67,
+    111,110,116,114,111,108,108,101,114,0,56,50,52,54,53,71,88,0,71,114,
+    97,112,104,105,99,115,32,69,120,112,97,110,100,101,114,32,66,114,105,100,
+    103,101,0,56,50,52,54,51,71,88,0,77,101,109,111,114,121,32,65,100,
+    100,114,101,115,115,32,67,111,110,116,114,111,108,108,101,114,0,56,50,52,
+    54,52,71,88,0,77,101,109,111,114,121,32,68,97,116,97,32,67,111,110,
+    116,114,111,108,108,101,114,0,87,105,100,101,32,97,110,100,32,102,97,115,
+    116,32,80,67,73,32,101,88,112,97,110,100,101,114,32,66,114,105,100,103,
+    101,0,56,50,52,54,48,71,88,0,65,71,80,32,66,114,105,100,103,101,
+    32,40,71,88,66,32,102,117,110,99,116,105,111,110,32,49,41,0,73,50,
+    79,32,82,65,73,68,32,80,67,73,32,116,111,32,80,67,73,32,66,114,
+    105,100,103,101,0,83,82,67,85,50,49,0,83,82,67,85,120,120,0,83,
+    82,67,85,51,49,0,83,82,67,85,51,49,76,0,65,85,68,73,79,32,
+    67,79,78,84,82,79,76,76,69,82,0,105,56,52,53,0,105,110,116,101,
+    108,32,98,114,111,107,100,97,108,101,0,83,50,49,49,53,50,66,66,0,
+    83,50,49,49,53,52,65,69,47,66,69,0,50,49,53,53,53,0,78,111,
+    110,45,84,114,97,110,115,112,97,114,101,110,116,32,80,67,73,45,116,111,
+    45,80,67,73,32,66,114,105,100,103,101,0,97,105,99,45,55,56,56,48,
+    112,0,65,72,65,45,50,57,52,48,85,87,47,67,78,0,65,73,67,45,
+    55,56,49,48,67,0,82,65,73,68,32,67,111,112,114,111,99,101,115,115,
+    111,114,0,65,73,67,45,49,49,54,48,0,65,73,67,45,55,56,50,49,
+    0,65,73,67,45,50,57,51,48,85,32,85,108,116,114,97,32,83,67,83,
+    73,32,67,116,114,108,114,0,65,72,65,45,52,57,52,52,87,47,52,57,
+    52,52,85,87,0,81,117,97,100,67,104,97,110,110,101,108,32,70,97,115,
+    116,45,87,105,100,101,47,85,108,116,114,97,45,87,105,100,101,32,68,105,
+    102,102,46,32,83,67,83,73,32,67,116,114,108,114,0,65,73,67,45,55,
+    53,53,120,0,83,67,83,73,32,67,116,114,108,114,0,65,73,67,45,55,
+    56,53,48,80,0,70,97,115,116,47,87,105,100,101,32,83,67,83,73,32,
+    67,111,110,116,114,111,108,108,101,114,0,65,73,67,45,55,56,53,48,0,
+    70,65,83,84,45,83,67,83,73,32,67,116,114,108,114,0,70,97,115,116,
+    32,83,67,83,73,32,67,116,114,108,114,0,65,86,65,45,50,57,51,48,
+    0,65,73,67,45,55,56,53,53,0,65,73,67,45,55,56,53,54,0,65,
+    73,67,45,53,56,48,48,0,80,67,73,45,116,111,45,49,51,57,52,32,
+    67,116,114,108,114,0,65,78,65,45,53,57,49,48,47,51,48,47,52,48,
+    0,65,84,77,49,53,53,32,38,97,109,112,59,32,50,53,32,76,65,78,
+    32,67,111,110,116,114,111,108,108,101,114,0,65,78,65,45,53,57,49,48,
+    65,47,51,48,65,47,52,48,65,0,65,84,77,32,65,100,112,97,116,101,
+    114,0,65,72,65,45,50,57,51,48,67,0,85,108,116,114,97,32,83,67,
+    83,73,32,65,100,112,97,116,101,114,32,40,86,65,82,41,0,65,73,67,
+    45,55,53,54,48,63,0,67,97,114,100,66,117,115,32,85,108,116,114,97,
+    32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,65,73,67,
+    45,55,56,54,48,0,80,67,73,32,83,67,83,73,32,67,111,110,116,114,
+    111,108,108,101,114,0,65,73,67,45,55,56,54,49,0,65,73,67,45,55,
+    56,54,120,0,65,78,65,54,50,48,120,120,47,54,57,48,49,49,65,0,
+    65,73,67,45,55,56,55,48,0,70,97,115,116,32,97,110,100,32,87,105,
+    100,101,32,83,67,83,73,32,67,116,114,108,114,0,65,72,65,45,50,57,
+    52,48,47,50,57,52,48,87,0,70,97,115,116,47,70,97,115,116,45,87,
+    105,100,101,32,83,67,83,73,32,67,116,114,108,114,0,65,72,65,45,51,
+    57,52,48,47,51,57,52,48,87,0,77,117,108,116,105,99,104,97,110,110,
+    101,108,32,70,97,115,116,47,70,97,115,116,45,87,105,100,101,32,83,67,
+    83,73,32,67,116,114,108,114,0,65,72,65,45,51,57,56,53,0,52,45,
+    99,104,97,110,32,82,65,73,68,32,83,67,83,73,32,67,116,114,108,114,
+    0,65,72,65,45,50,57,52,52,0,65,72,65,45,51,57,52,52,47,51,
+    57,52,52,87,0,77,117,108,116,105,99,104,97,110,110,101,108,32,70,97,
+    115,116,47,70,97,115,116,45,87,105,100,101,32,68,105,102,102,46,32,83,
+    67,83,73,32,67,116,114,108,114,0,65,73,67,45,55,56,55,120,0,97,
+    105,99,32,55,56,49,48,0,77,101,109,111,114,121,32,99,111,110,116,114,
+    111,108,32,73,67,0,65,73,67,45,55,53,49,53,0,82,65,73,68,32,
+    43,32,77,101,109,111,114,121,32,67,111,110,116,114,111,108,108,101,114,32,
+    73,67,0,97,105,99,45,55,56,53,48,0,70,97,115,116,47,87,105,100,
+    101,32,83,67,83,73,45,50,32,67,111,110,116,114,111,108,108,101,114,0,
+    65,72,65,45,50,57,51,48,0,83,105,110,103,108,101,32,99,104,97,110,
+    110,101,108,32,83,67,83,73,32,72,111,115,116,32,65,100,97,112,116,101,
+    114,0,97,104,97,32,50,57,52,48,0,83,67,83,73,0,97,104,97,32,
+    51,57,52,48,0,77,117,108,116,105,112,108,101,32,83,67,83,73,32,99,
+    104,97,110,110,101,108,115,0,97,104,97,32,51,57,56,48,0,97,104,97,
+    32,50,57,52,52,0,68,105,102,102,101,114,101,110,116,105,97,108,32,83,
+    67,83,73,0,97,105,99,55,56,56,48,112,0,70,97,115,116,32,50,48,
+    32,83,67,83,73,0,65,73,67,45,55,56,57,48,0,83,67,83,73,32,
+    99,111,110,116,114,111,108,108,101,114,0,65,73,67,45,55,56,57,120,0,
+    65,73,67,45,55,56,57,53,0,85,108,116,114,97,45,87,105,100,101,32,
+    83,67,83,73,32,67,116,114,108,114,32,111,110,32,65,72,65,45,50,57,
+    52,48,32,65,72,65,45,51,57,52,120,0,65,73,67,45,55,56,56,48,
+    0,85,108,116,114,97,32,87,105,100,101,32,83,67,83,73,0,65,72,65,
+    45,50,57,52,48,85,47,50,57,52,48,85,87,0,85,108,116,114,97,47,
+    85,108,116,114,97,45,87,105,100,101,32,83,67,83,73,32,67,116,114,108,
+    114,0,65,72,65,45,51,57,52,48,85,120,120,0,65,72,65,45,51,57,
+    52,48,85,47,51,57,52,48,85,87,47,51,57,52,48,85,87,68,32,83,
+    67,83,73,32,67,116,114,108,114,0,65,73,67,45,55,56,56,51,85,0,
+    65,68,65,80,84,69,67,32,50,57,52,48,85,87,32,67,78,32,83,67,
+    83,73,0,85,108,116,114,97,45,87,105,100,101,32,68,105,102,102,46,32,
+    83,67,83,73,32,67,116,114,108,114,0,65,72,65,45,51,57,52,52,85,
+    47,51,57,52,52,85,87,68,0,70,97,115,116,45,87,105,100,101,47,85,
+    108,116,114,97,45,87,105,100,101,32,68,105,102,102,46,32,83,67,83,73,
+    32,67,116,114,108,114,0,65,72,65,45,52,57,52,52,85,87,0,81,117,
+    97,100,67,104,97,110,110,101,108,32,85,108,116,114,97,45,87,105,100,101,
+    32,68,105,102,102,46,32,83,67,83,73,32,67,116,114,108,114,0,65,73,
+    67,45,55,56,56,120,0,85,108,116,114,97,45,87,105,100,101,32,83,67,
+    83,73,32,67,116,114,108,114,0,65,73,67,45,55,56,56,56,63,0,65,
+    66,65,45,49,48,51,48,0,65,66,65,0,65,73,67,45,55,56,57,48,
+    65,66,32,115,99,115,105,32,99,111,110,116,114,111,108,108,101,114,0,65,
+    72,65,45,50,57,52,48,85,50,87,47,85,50,66,44,50,57,53,48,85,
+    50,87,32,85,108,116,114,97,50,32,83,67,83,73,0,49,49,49,49,49,
+    0,65,72,65,45,50,57,51,48,85,50,32,85,108,116,114,97,50,32,83,
+    67,83,73,32,72,111,115,116,32,65,100,97,112,116,101,114,0,65,73,67,
+    45,55,56,57,48,47,49,0,65,73,67,45,55,56,57,48,32,65,66,32,
+    102,111,114,32,87,105,110,100,111,119,115,32,32,88,80,0,85,108,116,114,
+    97,50,45,87,105,100,101,32,83,67,83,73,32,99,111,110,116,114,111,108,
+    108,101,114,0,65,72,65,45,51,57,52,48,85,50,120,47,51,57,53,48,
+    85,50,120,32,85,108,116,114,97,50,32,83,67,83,73,32,65,100,97,112,
+    116,101,114,0,65,72,65,45,51,57,53,48,85,50,120,32,85,108,116,114,
+    97,50,32,83,67,83,73,32,65,100,97,112,116,101,114,0,65,73,67,45,
+    55,56,57,54,0,65,73,67,45,55,56,57,54,47,55,0,85,108,116,114,
+    97,50,32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,65,
+    73,67,45,55,56,57,50,81,0,85,108,116,114,97,49,54,48,47,109,32,
+    80,67,73,32,83,67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,
+    65,73,67,45,55,56,57,50,66,0,85,108,116,114,97,49,54,48,32,83,
+    67,83,73,32,67,111,110,116,114,111,108,108,101,114,0,65,73,67,45,55,
+    56,57,50,68,0,65,73,67,45,55,56,57,50,0,65,73,67,45,55,56,
+    57,57,65,0,65,73,67,45,55,56,57,57,66,0,65,73,67,45,55,56,
+    57,57,68,0,82,65,73,68,32,83,117,98,115,121,115,116,101,109,32,72,
+    66,65,0,65,73,67,45,55,56,57,57,71,0,65,65,67,45,82,65,73,
+    68,0,65,100,97,112,116,101,99,32,65,65,82,45,50,52,49,48,83,65,
+    32,83,65,84,65,32,52,45,80,111,114,116,32,82,97,105,100,0,65,73,
+    67,32,57,52,49,48,0,83,65,83,47,83,65,84,65,32,67,111,110,116,
+    114,111,108,108,101,114,0,65,73,67,57,52,53,48,87,0,65,83,67,45,
+    50,57,51,50,48,65,0,85,108,116,114,97,51,50,48,32,83,67,83,73,
+    32,67,111,110,116,114,111,108,108,101,114,0,65,73,67,45,55,57,48,49,
+    0,65,83,67,45,51,57,51,50,48,0,65,83,67,45,51,57,51,50,48,
+    68,0,65,83,67,45,50,57,51,50,48,0,65,83,67,45,50,57,51,50,
+    48,76,80,0,65,83,67,45,51,57,51,50,48,65,0,65,83,67,45,50,
+    57,51,50,48,65,76,80,0,65,73,67,45,63,63,63,63,63,0,65,73,
+    67,45,55,57,48,50,66,0,65,73,67,45,55,57,48,50,0,85,108,116,
+    114,97,51,50,48,32,72,111,115,116,82,65,73,68,32,67,111,110,116,114,
+    111,108,108,101,114,0,72,111,115,116,82,65,73,68,32,83,67,83,73,32,
+    67,111,110,116,114,111,108,108,101,114,0,65,83,67,45,50,57,51,50,48,
+    66,0,65,73,67,45,55,57,48,49,65,0,72,84,54,53,54,53,0,73,
+    68,69,32,67,111,110,116,114,111,108,108,101,114,63,0,83,71,50,48,49,
+    48,0,80,67,73,32,116,111,32,104,105,103,104,32,115,112,101,101,100,32,
+    115,101,114,105,97,108,32,98,114,105,100,103,101,0,83,71,49,48,49,48,
+    0,54,32,112,111,114,116,32,115,101,114,105,97,108,32,115,119,105,116,99,
+    104,32,47,80,67,73,45,116,111,45,80,67,73,32,98,114,105,100,103,101,
+    0,57,52,48,48,45,48,57,51,49,0,67,104,97,114,75,101,121,0,54,
+    50,56,48,50,0,54,50,56,48,50,45,53,49,0,111,90,48,48,51,48,
+    0,80,67,73,32,77,101,122,122,97,110,105,110,101,32,67,97,114,100,0,
+    80,67,32,87,101,97,115,101,108,32,80,67,73,32,86,71,65,32,68,101,
+    118,105,99,101,0,80,67,32,87,101,97,115,101,108,32,80,67,73,32,83,
+    101,114,105,97,108,32,67,111,109,109,46,32,68,101,118,105,99,101,0,80,
+    67,32,87,101,97,115,101,108,32,80,67,73,0,65,109,98,105,101,110,116,
+    32,77,68,51,50,48,48,32,65,0,73,110,116,101,108,32,53,51,55,32,
+    68,97,116,97,32,70,97,120,32,86,111,105,99,101,32,118,46,57,50,32,
+    77,111,100,101,109,0,83,101,100,108,98,97,117,101,114,32,83,112,101,101,
+    100,32,80,67,73,0,84,105,103,101,114,32,54,48,48,0,68,65,71,32,
+    51,46,49,48,0,79,67,45,51,47,79,67,45,49,50,0,68,65,71,32,
+    51,46,50,120,0,68,65,71,32,51,46,50,69,0,68,65,71,32,51,46,
+    52,69,0,68,65,71,32,51,46,52,49,69,0,68,65,71,32,51,46,53,
+    0,68,65,71,32,51,46,53,69,67,77,0,68,65,71,32,52,46,49,48,
+    0,79,67,45,52,56,0,68,65,71,32,52,46,49,49,0,68,65,71,32,
+    52,46,50,0,68,65,71,32,52,46,50,69,0,68,117,97,108,32,71,105,
+    103,97,98,105,116,32,69,116,104,101,114,110,101,116,0,68,65,71,32,52,
+    46,51,69,0,65,82,75,49,48,48,48,80,86,0,83,116,105,110,103,114,
+    97,121,32,71,85,73,32,65,99,99,101,108,101,114,97,116,111,114,0,65,
+    82,75,50,48,48,48,80,86,0,65,82,75,50,48,48,48,77,84,0,83,
+    116,105,110,103,114,97,121,32,54,52,0,65,82,75,50,48,48,48,77,73,
+    0,81,117,97,100,114,111,54,52,53,32,71,85,73,32,65,99,99,101,108,
+    101,114,97,116,111,114,0,65,82,75,50,48,48,48,77,73,43,0,80,97,
+    116,116,101,114,110,32,77,97,116,99,104,105,110,103,32,67,104,105,112,0,
+    80,114,101,45,50,46,48,32,80,67,73,32,83,112,101,99,105,102,105,99,
+    97,116,105,111,110,32,68,101,118,105,99,101,0,78,111,110,45,86,71,65,
+    0,86,71,65,32,67,111,109,112,97,116,105,98,108,101,0,77,97,115,115,
+    32,83,116,111,114,97,103,101,32,67,111,110,116,114,111,108,108,101,114,0,
+    73,68,69,0,70,108,111,112,112,121,0,73,80,73,0,82,65,73,68,0,
+    83,101,114,105,97,108,32,65,116,116,97,99,104,101,100,32,83,67,83,73,
+    32,67,111,110,116,114,111,108,108,101,114,0,79,116,104,101,114,0,69,116,
+    104,101,114,110,101,116,47,87,105,70,105,0,68,105,115,112,108,97,121,32,
+    67,111,110,116,114,111,108,108,101,114,0,73,66,77,32,67,111,109,112,97,
+    116,105,98,108,101,0,56,53,49,52,0,88,71,65,0,51,68,32,71,114,
+    97,112,104,105,99,115,0,65,117,100,105,111,32,67,111,110,116,114,111,108,
+    108,101,114,0,84,101,108,101,112,104,111,110,121,32,67,111,110,116,114,111,
+    108,108,101,114,0,65,117,100,105,111,32,68,101,118,105,99,101,0,82,65,
+    77,0,70,108,97,115,104,0,66,114,105,100,103,101,32,68,101,118,105,99,
+    101,0,72,111,115,116,47,80,67,73,0,80,67,73,47,73,83,65,0,80,
+    67,73,47,69,73,83,65,0,80,67,73,47,77,105,99,114,111,32,67,104,
+    97,110,110,101,108,0,80,67,73,47,80,67,73,0,80,67,73,47,80,67,
+    77,67,73,65,0,80,67,73,47,78,117,66,117,115,0,80,67,73,47,67,
+    97,114,100,66,117,115,0,80,67,73,47,82,65,67,69,119,97,121,0,80,
+    67,73,47,73,110,102,105,110,105,66,97,110,100,0,83,105,109,112,108,101,
+    32,67,111,109,109,117,110,105,99,97,116,105,111,110,115,32,67,111,110,116,
+    114,111,108,108,101,114,0,83,101,114,105,97,108,0,71,101,110,101,114,105,
+    99,32,88,84,32,67,111,109,112,97,116,105,98,108,101,0,49,54,52,53,
+    48,32,67,111,109,112,97,116,105,98,108,101,0,49,54,53,53,48,32,67,
+    111,109,112,97,116,105,98,108,101,0,49,54,54,53,48,32,67,111,109,112,
+    97,116,105,98,108,101,0,49,54,55,53,48,32,67,111,109,112,97,116,105,
+    98,108,101,0,49,54,56,53,48,32,67,111,109,112,97,116,105,98,108,101,
+    0,49,54,57,53,48,32,67,111,109,112,97,116,105,98,108,101,0,80,97,
+    114,97,108,108,101,108,0,83,116,97,110,100,97,114,100,0,69,67,80,32,
+    49,46,88,32,67,111,109,112,108,105,97,110,116,0,69,67,80,32,50,46,
+    88,32,67,111,109,112,108,105,97,110,116,0,73,69,69,69,49,50,56,52,
+    32,67,111,109,112,108,105,97,110,116,0,77,117,108,116,105,112,111,114,116,
+    32,83,101,114,105,97,108,32,67,111,110,116,114,111,108,108,101,114,0,68,
+    105,97,108,45,117,112,32,109,111,100,101,109,0,66,97,115,101,32,83,121,
+    115,116,101,109,115,32,80,101,114,105,112,104,101,114,97,108,0,80,73,67,
+    32,40,80,114,111,103,114,97,109,109,97,98,108,101,32,73,110,116,101,114,
+    114,117,112,116,32,67,111,110,116,114,111,108,108,101,114,41,0,71,101,110,
+    101,114,105,99,32,56,50,53,57,0,73,83,65,0,69,73,83,65,47,80,
+    67,73,0,73,79,32,65,80,73,67,0,73,79,40,88,41,32,65,80,73,
+    67,0,68,77,65,32,40,68,105,114,101,99,116,32,77,101,109,111,114,121,
+    32,65,99,99,101,115,115,41,0,69,73,83,65,0,83,121,115,116,101,109,
+    32,84,105,109,101,114,0,82,84,67,32,40,82,101,97,108,32,84,105,109,
+    101,32,67,108,111,99,107,41,0,71,101,110,101,114,105,99,0,80,67,73,
+    32,72,111,116,45,112,108,117,103,32,99,111,110,116,114,111,108,108,101,114,
+    0,83,68,32,72,111,115,116,32,67,111,110,116,114,111,108,108,101,114,0,
+    73,110,112,117,116,32,68,101,118,105,99,101,0,75,101,121,98,111,97,114,
+    100,0,68,105,103,105,116,105,122,101,114,32,40,80,101,110,41,0,77,111,
+    117,115,101,0,68,111,99,107,105,110,103,32,83,116,97,116,105,111,110,0,
+    80,114,111,99,101,115,115,111,114,0,105,51,56,54,0,105,52,56,54,0,
+    80,101,110,116,105,117,109,0,65,108,112,104,97,0,80,111,119,101,114,32,
+    80,67,0,83,101,114,105,97,108,32,66,117,115,32,67,111,110,116,114,111,
+    108,108,101,114,0,70,105,114,101,119,105,114,101,32,40,73,69,69,69,32,
+    49,51,57,52,41,0,65,67,67,69,83,83,46,98,117,115,0,83,83,65,
+    32,40,83,101,114,105,97,108,32,83,116,111,114,97,103,101,32,65,114,99,
+    104,101,116,101,99,116,117,114,101,41,0,85,83,66,32,49,46,49,32,85,
+    72,67,73,0,85,83,66,32,49,46,49,32,79,72,67,73,0,85,83,66,
+    32,50,46,48,32,69,72,67,73,0,85,83,66,0,85,83,66,32,68,101,
+    118,105,99,101,0,83,77,98,117,115,0,73,110,102,105,110,105,66,97,110,
+    100,0,73,80,77,73,32,40,83,77,73,67,41,0,83,69,82,67,79,83,
+    0,87,105,114,101,108,101,115,115,32,67,111,110,116,114,111,108,108,101,114,
+    0,73,114,68,65,0,67,111,110,115,117,109,101,114,32,73,82,0,67,117,
+    115,116,111,109,32,82,70,0,66,108,117,101,116,111,111,116,104,0,66,114,
+    111,97,100,98,97,110,100,0,87,105,70,105,32,56,48,50,46,49,49,97,
+    0,87,105,70,105,32,56,48,50,46,49,49,98,0,68,101,118,105,99,101,
+    32,68,111,101,115,32,78,111,116,32,70,105,116,32,73,110,32,67,108,97,
+    115,115,32,67,111,100,101,115,0,85,68,70,0,
+};
+
+inline constexpr PciVendorRecord PciVendorRecords[] = {
+    {0x0033, 0, 1},
+    {0x003D, 16, 21},
+    {0x0070, 28, 39},
+    {0x0100, 69, 74},
+    {0x0123, 0, 92},
+    {0x0315, 0, 109},
+    {0x0A89, 136, 141},
+    {0x0E11, 164, 171},
+    {0x1000, 193, 197},
+    {0x1001, 221, 228},
+    {0x1002, 256, 256},
+    {0x1003, 260, 260},
+    {0x1004, 265, 270},
+    {0x1006, 286, 292},
+    {0x1007, 304, 313},
+    {0x1008, 335, 335},
+    {0x100A, 341, 349},
+    {0x100B, 375, 379},
+    {0x100C, 403, 409},
+    {0x100D, 420, 424},
+    {0x100E, 437, 437},
+    {0x1010, 444, 451},
+    {0x1011, 468, 472},
+    {0x1012, 502, 512},
+    {0x1013, 537, 544},
+    {0x1014, 557, 561},
+    {0x1016, 599, 611},
+    {0x1017, 633, 638},
+    {0x1018, 655, 662},
+    {0x1019, 677, 681},
+    {0x101A, 708, 712},
+    {0x101B, 728, 736},
+    {0x101E, 758, 762},
+    {0x101F, 787, 798},
+    {0x1020, 815, 823},
+    {0x1021, 852, 856},
+    {0x1022, 878, 882},
+    {0x1023, 905, 912},
+    {0x1025, 926, 931},
+    {0x1028, 949, 954},
+    {0x102A, 193, 980},
+    {0x102B, 1008, 1015},
+    {0x102C, 1046, 1054},
+    {0x102D, 1088, 1093},
+    {0x102E, 1111, 1120},
+    {0x102F, 1149, 1157},
+    {0x1030, 1173, 1177},
+    {0x1031, 1190, 1195},
+    {0x1033, 1221, 1225},
+    {0x1034, 1241, 1248},
+    {0x1036, 1267, 1275},
+    {0x1037, 815, 1289},
+    {0x1038, 1315, 1319},
+    {0x1039, 1336, 1340},
+    {0x103A, 1367, 1373},
+    {0x103B, 1397, 1404},
+    {0x103C, 1428, 1431},
+    {0x103E, 1455, 1464},
+    {0x103F, 1485, 1496},
+    {0x1041, 1511, 1511},
+    {0x1043, 1522, 1530},
+    {0x1044, 1552, 1556},
+    {0x1045, 1584, 1589},
+    {0x1046, 1599, 1603},
+    {0x1047, 1623, 1629},
+    {0x1048, 1649, 1654},
+    {0x1049, 1664, 1673},
+    {0x104A, 1693, 1697},
+    {0x104B, 0, 1716},
+    {0x104C, 1733, 1736},
+    {0x104D, 1754, 1759},
+    {0x104E, 1776, 1780},
+    {0x104F, 1795, 1803},
+    {0x1050, 1825, 1833},
+    {0x1051, 1859, 1866},
+    {0x1053, 1879, 1885},
+    {0x1054, 815, 1905},
+    {0x1055, 1917, 1922},
+    {0x1056, 1950, 1950},
+    {0x1057, 1954, 1954},
+    {0x1058, 1963, 1972},
+    {0x1059, 2012, 2020},
+    {0x105A, 2035, 2043},
+    {0x105B, 2062, 2070},
+    {0x105C, 2097, 2103},
+    {0x105D, 2126, 2138},
+    {0x105E, 2168, 2174},
+    {0x105F, 2204, 2215},
+    {0x1060, 2239, 2243},
+    {0x1061, 2267, 2271},
+    {0x1062, 2280, 2287},
+    {0x1063, 2309, 2313},
+    {0x1064, 2337, 2345},
+    {0x1065, 2357, 2360},
+    {0x1066, 2379, 2389},
+    {0x1067, 2410, 2421},
+    {0x1068, 2444, 2455},
+    {0x106A, 2478, 2483},
+    {0x106B, 2502, 2508},
+    {0x106C, 2528, 2536},
+    {0x106D, 2564, 2572},
+    {0x106E, 2597, 2601},
+    {0x106F, 2610, 2619},
+    {0x1070, 2645, 2652},
+    {0x1071, 2672, 2672},
+    {0x1072, 2678, 2682},
+    {0x1073, 2695, 2702},
+    {0x1074, 2721, 2728},
+    {0x1075, 2748, 2752},
+    {0x1077, 2782, 2789},
+    {0x1078, 2808, 2814},
+    {0x1079, 2832, 2832},
+    {0x107A, 2838, 2838},
+    {0x107B, 2847, 2855},
+    {0x107C, 2868, 2877},
+    {0x107D, 2895, 2903},
+    {0x107E, 2920, 2931},
+    {0x107F, 2941, 2945},
+    {0x1080, 2973, 2981},
+    {0x1081, 3003, 3003},
+    {0x1082, 3015, 3019},
+    {0x1083, 3046, 3052},
+    {0x1084, 3079, 3079},
+    {0x1085, 3087, 3093},
+    {0x1086, 3118, 3126},
+    {0x1087, 3151, 3157},
+    {0x1088, 3172, 3180},
+    {0x1089, 3210, 3213},
+    {0x108A, 3238, 3243},
+    {0x108C, 3259, 3268},
+    {0x108D, 3290, 3290},
+    {0x108E, 3297, 3301},
+    {0x108F, 3318, 3329},
+    {0x1090, 3352, 3359},
+    {0x1091, 3387, 3398},
+    {0x1092, 3421, 3429},
+    {0x1093, 3454, 3465},
+    {0x1094, 3486, 3490},
+    {0x1095, 3512, 3526},
+    {0x1096, 3546, 3546},
+    {0x1097, 3554, 3561},
+    {0x1098, 3577, 3585},
+    {0x1099, 3606, 3614},
+    {0x109A, 3643, 3656},
+    {0x109B, 3669, 3678},
+    {0x109C, 3701, 3711},
+    {0x109D, 3733, 3738},
+    {0x109E, 3761, 3771},
+    {0x109F, 3793, 3800},
+    {0x10A0, 3821, 3831},
+    {0x10A1, 3853, 3858},
+    {0x10A2, 3577, 3885},
+    {0x10A3, 3905, 3912},
+    {0x10A4, 3932, 3938},
+    {0x10A5, 3964, 3970},
+    {0x10A8, 3985, 3992},
+    {0x10A9, 4013, 4016},
+    {0x10AB, 4033, 4033},
+    {0x10AC, 4041, 4051},
+    {0x10AD, 1825, 4066},
+    {0x10AE, 4087, 4099},
+    {0x10AF, 4122, 4126},
+    {0x10B0, 4154, 4165},
+    {0x10B1, 4187, 4197},
+    {0x10B2, 4220, 4229},
+    {0x10B3, 4246, 4255},
+    {0x10B4, 4269, 4273},
+    {0x10B5, 4285, 4289},
+    {0x10B6, 4309, 4315},
+    {0x10B7, 4330, 4335},
+    {0x10B8, 4352, 4356},
+    {0x10B9, 4390, 4394},
+    {0x10BA, 2410, 4410},
+    {0x10BB, 4439, 4445},
+    {0x10BC, 4475, 4479},
+    {0x10BD, 4508, 4516},
+    {0x10BE, 403, 4535},
+    {0x10BF, 4565, 4570},
+    {0x10C0, 4581, 4586},
+    {0x10C1, 4605, 4609},
+    {0x10C2, 4624, 4631},
+    {0x10C3, 3606, 4651},
+    {0x10C4, 4674, 4678},
+    {0x10C5, 4704, 4710},
+    {0x10C6, 4728, 4735},
+    {0x10C8, 4747, 4756},
+    {0x10C9, 4777, 4788},
+    {0x10CA, 4811, 4819},
+    {0x10CB, 4835, 4841},
+    {0x10CD, 4859, 4868},
+    {0x10CF, 4811, 4893},
+    {0x10D1, 4906, 4914},
+    {0x10D2, 4930, 4936},
+    {0x10D3, 4955, 4961},
+    {0x10D4, 4980, 4987},
+    {0x10D5, 5011, 5021},
+    {0x10D6, 5036, 5036},
+    {0x10D7, 5042, 5046},
+    {0x10D8, 5068, 5072},
+    {0x10D9, 5098, 5107},
+    {0x10DB, 5139, 5144},
+    {0x10DC, 5158, 5163},
+    {0x10DD, 5203, 5211},
+    {0x10DE, 5234, 5234},
+    {0x10DF, 5241, 5248},
+    {0x10E1, 5267, 5274},
+    {0x10E2, 5303, 5309},
+    {0x10E3, 5327, 5334},
+    {0x10E4, 5361, 5368},
+    {0x10E5, 5385, 5389},
+    {0x10E6, 5418, 5427},
+    {0x10E7, 5459, 5459},
+    {0x10E8, 5465, 5470},
+    {0x10E9, 5499, 5504},
+    {0x10EA, 5531, 5536},
+    {0x10EB, 5547, 5554},
+    {0x10EC, 5570, 5578},
+    {0x10ED, 5600, 5606},
+    {0x10EE, 5624, 5631},
+    {0x10EF, 5650, 5657},
+    {0x10F0, 5682, 5713},
+    {0x10F1, 5756, 5761},
+    {0x10F2, 5775, 5781},
+    {0x10F3, 5813, 5820},
+    {0x10F4, 5832, 5838},
+    {0x10F5, 5852, 5856},
+    {0x10F6, 5872, 5876},
+    {0x10F7, 5907, 5918},
+    {0x10F8, 5955, 5961},
+    {0x10F9, 5978, 5988},
+    {0x10FA, 5998, 5998},
+    {0x10FB, 6009, 6016},
+    {0x10FC, 6041, 6045},
+    {0x10FD, 6066, 6071},
+    {0x10FE, 6098, 6103},
+    {0x10FF, 6124, 6124},
+    {0x1100, 6130, 6135},
+    {0x1101, 6151, 6158},
+    {0x1102, 6177, 6191},
+    {0x1103, 6216, 6226},
+    {0x1104, 6264, 6264},
+    {0x1105, 6274, 6280},
+    {0x1106, 6299, 6303},
+    {0x1107, 6318, 6326},
+    {0x1108, 6343, 6351},
+    {0x1109, 6364, 6371},
+    {0x110A, 6404, 6412},
+    {0x110B, 6431, 6441},
+    {0x110C, 6464, 6473},
+    {0x110D, 6498, 6503},
+    {0x110E, 6520, 6530},
+    {0x110F, 6545, 6550},
+    {0x1112, 6566, 6573},
+    {0x1113, 6598, 6605},
+    {0x1114, 6635, 6641},
+    {0x1116, 6653, 6670},
+    {0x1117, 6693, 6702},
+    {0x1118, 6716, 6721},
+    {0x1119, 6738, 6745},
+    {0x111A, 6777, 6787},
+    {0x111C, 6805, 6813},
+    {0x111D, 6834, 6838},
+    {0x111F, 6872, 6876},
+    {0x1120, 6901, 6905},
+    {0x1121, 6915, 6915},
+    {0x1123, 6921, 6925},
+    {0x1124, 6947, 6955},
+    {0x1125, 6973, 6982},
+    {0x1127, 6997, 7012},
+    {0x1129, 7025, 7025},
+    {0x112A, 7035, 7042},
+    {0x112C, 7070, 7077},
+    {0x112D, 7097, 7097},
+    {0x112E, 7105, 7105},
+    {0x1130, 7115, 7115},
+    {0x1131, 7130, 7143},
+    {0x1132, 7166, 7172},
+    {0x1133, 7184, 7188},
+    {0x1134, 4122, 7215},
+    {0x1135, 7245, 7250},
+    {0x1136, 7268, 7277},
+    {0x1137, 7299, 7305},
+    {0x1138, 7323, 7331},
+    {0x1139, 7351, 7362},
+    {0x113A, 7383, 7387},
+    {0x113B, 7396, 7400},
+    {0x113C, 7426, 7434},
+    {0x113D, 7460, 7473},
+    {0x113E, 7499, 7505},
+    {0x113F, 7523, 7531},
+    {0x1140, 7547, 7558},
+    {0x1141, 7573, 7579},
+    {0x1142, 7601, 7610},
+    {0x1143, 7633, 7642},
+    {0x1144, 7655, 7666},
+    {0x1145, 7686, 7694},
+    {0x1146, 7707, 7713},
+    {0x1147, 7729, 7739},
+    {0x1148, 7754, 7762},
+    {0x1149, 7797, 7808},
+    {0x114A, 7831, 7831},
+    {0x114B, 7836, 7844},
+    {0x114C, 7864, 7864},
+    {0x114D, 7874, 7883},
+    {0x114E, 7898, 7904},
+    {0x114F, 7922, 7927},
+    {0x1150, 1173, 7946},
+    {0x1151, 7976, 7980},
+    {0x1153, 8001, 8010},
+    {0x1154, 8035, 8041},
+    {0x1155, 8051, 8056},
+    {0x1156, 8076, 8086},
+    {0x1157, 8108, 8114},
+    {0x1158, 8132, 8138},
+    {0x1159, 8156, 8156},
+    {0x115A, 8163, 8173},
+    {0x115B, 8187, 8196},
+    {0x115C, 8214, 8222},
+    {0x115D, 8235, 8235},
+    {0x115E, 8242, 8247},
+    {0x115F, 8266, 8274},
+    {0x1160, 8293, 8302},
+    {0x1161, 8315, 8319},
+    {0x1162, 8327, 8334},
+    {0x1163, 8355, 8365},
+    {0x1164, 8379, 8383},
+    {0x1165, 8409, 8418},
+    {0x1166, 8439, 8456},
+    {0x1167, 8479, 8485},
+    {0x1168, 8506, 8512},
+    {0x1169, 8534, 8539},
+    {0x116A, 8571, 8579},
+    {0x116B, 8602, 8614},
+    {0x116C, 8630, 8639},
+    {0x116E, 8661, 8665},
+    {0x1170, 8689, 8698},
+    {0x1172, 8719, 8726},
+    {0x1173, 8745, 8751},
+    {0x1174, 8765, 8776},
+    {0x1175, 8796, 8803},
+    {0x1176, 8824, 8824},
+    {0x1177, 8828, 8841},
+    {0x1178, 8861, 8866},
+    {0x1179, 1149, 8875},
+    {0x117A, 8904, 8912},
+    {0x117B, 8931, 8934},
+    {0x117C, 8971, 8976},
+    {0x117D, 8992, 9000},
+    {0x117E, 9023, 9027},
+    {0x117F, 9039, 9043},
+    {0x1180, 9070, 9076},
+    {0x1183, 9096, 9105},
+    {0x1184, 9118, 9124},
+    {0x1185, 9134, 9134},
+    {0x1186, 9144, 9151},
+    {0x1187, 9169, 9173},
+    {0x1188, 9206, 9212},
+    {0x1189, 5907, 9243},
+    {0x118A, 9266, 9274},
+    {0x118B, 9293, 9302},
+    {0x118C, 9319, 9329},
+    {0x118D, 9343, 9351},
+    {0x118E, 9363, 9373},
+    {0x118F, 9386, 9392},
+    {0x1190, 9404, 9404},
+    {0x1191, 9412, 9418},
+    {0x1192, 9441, 9448},
+    {0x1194, 9463, 9470},
+    {0x1195, 9488, 9494},
+    {0x1196, 9511, 9517},
+    {0x1197, 9539, 9544},
+    {0x1198, 9570, 9577},
+    {0x1199, 9596, 9607},
+    {0x119A, 9624, 9635},
+    {0x119B, 9651, 9657},
+    {0x119C, 9674, 9678},
+    {0x119D, 9707, 9711},
+    {0x119E, 4811, 9729},
+    {0x119F, 9759, 9764},
+    {0x11A1, 9792, 9802},
+    {0x11A2, 3985, 9827},
+    {0x11A3, 9858, 9872},
+    {0x11A4, 9909, 9909},
+    {0x11A5, 9915, 9926},
+    {0x11A6, 9962, 9962},
+    {0x11A7, 9972, 9984},
+    {0x11A8, 10006, 10014},
+    {0x11A9, 10028, 10036},
+    {0x11AA, 10049, 10049},
+    {0x11AB, 7754, 10055},
+    {0x11AC, 10077, 10083},
+    {0x11AD, 10109, 10117},
+    {0x11AE, 10142, 10149},
+    {0x11AF, 10172, 10177},
+    {0x11B0, 10198, 10209},
+    {0x11B1, 10225, 10233},
+    {0x11B2, 10251, 10257},
+    {0x11B3, 10271, 10276},
+    {0x11B4, 10294, 10301},
+    {0x11B5, 10333, 10342},
+    {0x11B6, 10367, 10380},
+    {0x11B7, 1954, 1954},
+    {0x11B8, 10398, 10405},
+    {0x11B9, 10429, 10439},
+    {0x11BA, 10465, 10475},
+    {0x11BB, 10490, 10498},
+    {0x11BC, 10517, 10530},
+    {0x11BD, 10554, 10563},
+    {0x11BE, 10585, 10589},
+    {0x11BF, 10621, 10633},
+    {0x11C1, 10650, 10656},
+    {0x11C2, 10670, 10675},
+    {0x11C4, 10697, 10708},
+    {0x11C5, 10735, 10741},
+    {0x11C6, 10758, 10768},
+    {0x11C7, 10793, 10800},
+    {0x11C8, 10820, 10828},
+    {0x11C9, 10859, 10859},
+    {0x11CA, 10865, 10874},
+    {0x11CB, 10890, 10900},
+    {0x11CC, 10929, 10937},
+    {0x11CD, 10976, 10980},
+    {0x11CE, 11006, 11010},
+    {0x11CF, 11027, 11031},
+    {0x11D0, 11062, 11066},
+    {0x11D1, 11089, 11100},
+    {0x11D2, 11123, 11132},
+    {0x11D3, 11146, 11155},
+    {0x11D4, 11176, 11180},
+    {0x11D5, 11201, 11208},
+    {0x11D6, 11226, 11234},
+    {0x11D7, 11255, 11263},
+    {0x11D8, 11285, 11289},
+    {0x11D9, 11320, 11324},
+    {0x11DA, 11340, 11340},
+    {0x11DB, 11347, 11352},
+    {0x11DC, 11373, 11381},
+    {0x11DD, 11394, 11404},
+    {0x11DE, 11430, 11436},
+    {0x11E1, 11454, 11466},
+    {0x11E2, 3606, 11487},
+    {0x11E3, 10198, 10209},
+    {0x11E4, 11523, 11535},
+    {0x11E5, 11551, 11555},
+    {0x11E6, 11570, 11577},
+    {0x11E8, 11606, 11611},
+    {0x11E9, 11642, 11652},
+    {0x11EA, 11674, 11680},
+    {0x11EB, 11693, 11703},
+    {0x11EC, 11718, 11725},
+    {0x11ED, 11736, 11736},
+    {0x11EE, 11748, 11753},
+    {0x11EF, 11778, 11786},
+    {0x11F0, 11810, 11822},
+    {0x11F2, 11839, 11847},
+    {0x11F3, 11868, 11877},
+    {0x11F4, 11896, 11904},
+    {0x11F5, 11932, 11941},
+    {0x11F6, 11964, 11975},
+    {0x11F7, 12003, 12007},
+    {0x11F8, 12026, 12037},
+    {0x11F9, 12053, 12060},
+    {0x11FA, 12071, 12077},
+    {0x11FB, 12102, 12108},
+    {0x11FD, 12118, 12130},
+    {0x11FE, 12154, 12162},
+    {0x11FF, 12175, 12181},
+    {0x1200, 12192, 12196},
+    {0x1201, 12205, 12211},
+    {0x1202, 12231, 12243},
+    {0x1203, 12264, 12269},
+    {0x1204, 12296, 12304},
+    {0x1205, 12331, 12337},
+    {0x1206, 12348, 12355},
+    {0x1208, 12367, 12376},
+    {0x1209, 12390, 12398},
+    {0x120A, 12414, 12414},
+    {0x120B, 12423, 12432},
+    {0x120D, 12451, 12461},
+    {0x120E, 12483, 12492},
+    {0x120F, 12513, 12523},
+    {0x1210, 12548, 12562},
+    {0x1211, 12589, 12599},
+    {0x1213, 12613, 12618},
+    {0x1214, 12650, 12660},
+    {0x1215, 12689, 12699},
+    {0x1216, 12716, 12730},
+    {0x1217, 12748, 12756},
+    {0x1218, 12768, 12777},
+    {0x1219, 12791, 12805},
+    {0x121A, 12824, 12829},
+    {0x121B, 12850, 12854},
+    {0x121C, 12890, 12902},
+    {0x121D, 12921, 12929},
+    {0x121E, 12961, 12961},
+    {0x121F, 12966, 12972},
+    {0x1220, 12993, 12999},
+    {0x1221, 13017, 13024},
+    {0x1222, 13058, 13064},
+    {0x1223, 13089, 13111},
+    {0x1224, 13153, 13163},
+    {0x1225, 13182, 13191},
+    {0x1227, 13206, 13206},
+    {0x1228, 13218, 13224},
+    {0x1229, 13249, 13258},
+    {0x122A, 13276, 13289},
+    {0x122B, 13308, 13316},
+    {0x122C, 13347, 13356},
+    {0x122D, 13370, 13377},
+    {0x122E, 13395, 13395},
+    {0x122F, 13403, 13410},
+    {0x1230, 13423, 13432},
+    {0x1231, 13453, 13457},
+    {0x1233, 13479, 13488},
+    {0x1234, 13502, 13512},
+    {0x1236, 13527, 13541},
+    {0x1237, 13560, 13570},
+    {0x1238, 13592, 13592},
+    {0x1239, 13599, 13603},
+    {0x123A, 13619, 13627},
+    {0x123B, 13653, 13658},
+    {0x123C, 13679, 13691},
+    {0x123D, 13712, 13716},
+    {0x123F, 13745, 13752},
+    {0x1240, 13772, 13781},
+    {0x1241, 13809, 13813},
+    {0x1242, 13832, 13836},
+    {0x1243, 13852, 13852},
+    {0x1244, 13860, 13864},
+    {0x1245, 13908, 13912},
+    {0x1246, 13921, 13927},
+    {0x1247, 13950, 13956},
+    {0x1248, 13976, 13989},
+    {0x1249, 3606, 3614},
+    {0x124A, 14008, 14012},
+    {0x124C, 14032, 14041},
+    {0x124D, 14068, 14077},
+    {0x124E, 14099, 14099},
+    {0x124F, 14106, 14117},
+    {0x1250, 815, 14143},
+    {0x1251, 14177, 14187},
+    {0x1253, 14204, 14210},
+    {0x1254, 14238, 14253},
+    {0x1255, 14273, 14282},
+    {0x1256, 14296, 14307},
+    {0x1257, 14333, 14340},
+    {0x1258, 14361, 14370},
+    {0x1259, 14384, 14396},
+    {0x125A, 14425, 14433},
+    {0x125B, 14451, 14456},
+    {0x125C, 14479, 14486},
+    {0x125D, 14511, 14515},
+    {0x125E, 14530, 14540},
+    {0x125F, 14569, 14580},
+    {0x1260, 14609, 14618},
+    {0x1261, 5907, 14639},
+    {0x1262, 14676, 14685},
+    {0x1263, 14706, 14717},
+    {0x1264, 14733, 14743},
+    {0x1265, 14763, 14769},
+    {0x1266, 14793, 14803},
+    {0x1267, 14819, 14830},
+    {0x1268, 14854, 14854},
+    {0x1269, 14864, 14876},
+    {0x126A, 14892, 14900},
+    {0x126B, 14927, 14932},
+    {0x126C, 14942, 14949},
+    {0x126D, 14971, 14978},
+    {0x126E, 15001, 15010},
+    {0x126F, 15041, 15052},
+    {0x1270, 15067, 15075},
+    {0x1271, 15100, 15110},
+    {0x1272, 15125, 15136},
+    {0x1273, 15161, 15168},
+    {0x1274, 15191, 15191},
+    {0x1275, 15199, 15206},
+    {0x1276, 15224, 15236},
+    {0x1277, 15271, 15271},
+    {0x1278, 15281, 15291},
+    {0x1279, 15318, 15328},
+    {0x127B, 15344, 15351},
+    {0x127C, 15363, 15374},
+    {0x127D, 15400, 15405},
+    {0x127E, 15422, 15429},
+    {0x127F, 15441, 15441},
+    {0x1280, 15450, 15462},
+    {0x1281, 15485, 15494},
+    {0x1282, 15520, 15528},
+    {0x1283, 15555, 15572},
+    {0x1285, 15590, 15600},
+    {0x1286, 15627, 15633},
+    {0x1287, 15644, 15653},
+    {0x1288, 15667, 15676},
+    {0x1289, 15691, 15700},
+    {0x128A, 15720, 15727},
+    {0x128B, 15752, 15763},
+    {0x128C, 15780, 15786},
+    {0x128D, 15798, 15805},
+    {0x128F, 15822, 15829},
+    {0x1290, 15848, 15853},
+    {0x1291, 15873, 15882},
+    {0x1292, 15902, 15910},
+    {0x1293, 15944, 15954},
+    {0x1294, 15979, 15988},
+    {0x1295, 16002, 16014},
+    {0x1296, 16032, 16038},
+    {0x1297, 16059, 16059},
+    {0x1298, 16076, 16088},
+    {0x1299, 16124, 16134},
+    {0x129A, 16168, 16175},
+    {0x129B, 16187, 16198},
+    {0x129D, 16211, 16220},
+    {0x129E, 16245, 16256},
+    {0x129F, 16281, 16289},
+    {0x12A0, 16314, 16318},
+    {0x12A1, 16336, 16344},
+    {0x12A2, 16356, 16363},
+    {0x12A3, 16384, 16391},
+    {0x12A4, 16415, 16425},
+    {0x12A5, 16456, 16467},
+    {0x12A6, 16488, 16497},
+    {0x12A7, 16520, 16524},
+    {0x12A8, 16533, 16533},
+    {0x12A9, 16546, 16554},
+    {0x12AA, 16568, 16572},
+    {0x12AB, 16596, 16606},
+    {0x12AC, 16636, 16645},
+    {0x12AD, 16660, 16670},
+    {0x12AE, 16685, 16692},
+    {0x12AF, 16713, 16721},
+    {0x12B0, 16735, 16745},
+    {0x12B1, 16768, 16768},
+    {0x12B2, 16778, 16789},
+    {0x12B3, 16813, 16824},
+    {0x12B4, 16844, 16855},
+    {0x12B5, 16871, 16879},
+    {0x12B7, 16900, 16900},
+    {0x12B8, 16907, 16907},
+    {0x12B9, 4330, 4335},
+    {0x12BA, 16912, 16921},
+    {0x12BB, 16935, 16946},
+    {0x12BC, 16967, 16979},
+    {0x12BD, 16998, 17008},
+    {0x12BF, 15441, 17024},
+    {0x12C0, 17046, 17046},
+    {0x12C1, 17054, 17062},
+    {0x12C2, 17081, 17088},
+    {0x12C3, 17100, 17107},
+    {0x12C4, 17136, 17149},
+    {0x12C5, 17167, 17176},
+    {0x12C6, 17198, 17205},
+    {0x12C7, 17218, 17227},
+    {0x12C8, 17242, 17250},
+    {0x12C9, 17267, 17276},
+    {0x12CA, 17292, 17296},
+    {0x12CB, 17331, 17337},
+    {0x12CC, 17361, 17367},
+    {0x12CD, 17400, 17400},
+    {0x12CE, 17409, 17418},
+    {0x12CF, 17432, 17440},
+    {0x12D0, 17461, 17469},
+    {0x12D1, 17486, 17486},
+    {0x12D3, 17494, 17502},
+    {0x12D4, 17520, 17528},
+    {0x12D5, 17542, 17550},
+    {0x12D6, 17571, 17580},
+    {0x12D7, 17595, 17605},
+    {0x12D8, 17619, 17627},
+    {0x12D9, 17649, 17656},
+    {0x12DA, 17668, 17668},
+    {0x12DB, 17677, 17687},
+    {0x12DC, 17716, 17725},
+    {0x12DD, 17762, 17766},
+    {0x12DE, 17791, 17799},
+    {0x12DF, 17820, 17829},
+    {0x12E0, 17851, 17857},
+    {0x12E1, 17876, 17885},
+    {0x12E2, 17903, 17909},
+    {0x12E3, 17944, 17952},
+    {0x12E4, 17989, 18000},
+    {0x12E6, 18027, 18033},
+    {0x12E7, 18047, 18055},
+    {0x12E8, 18075, 18081},
+    {0x12E9, 18093, 18093},
+    {0x12EB, 18105, 18112},
+    {0x12EC, 18133, 18141},
+    {0x12ED, 18163, 18174},
+    {0x12EE, 18190, 18203},
+    {0x12EF, 18222, 18229},
+    {0x12F0, 18244, 18244},
+    {0x12F1, 18251, 18260},
+    {0x12F2, 18281, 18293},
+    {0x12F4, 18310, 18310},
+    {0x12F5, 9118, 9118},
+    {0x12F7, 18318, 18318},
+    {0x12F8, 18325, 18343},
+    {0x12F9, 18366, 18370},
+    {0x12FB, 18392, 18396},
+    {0x12FC, 18423, 18427},
+    {0x12FE, 18450, 18454},
+    {0x1303, 18488, 18491},
+    {0x1304, 0, 18514},
+    {0x1307, 18536, 18536},
+    {0x1308, 18551, 18556},
+    {0x130A, 2410, 18579},
+    {0x130B, 18613, 18626},
+    {0x130F, 0, 18659},
+    {0x1310, 0, 18672},
+    {0x1312, 18679, 18684},
+    {0x1313, 0, 18720},
+    {0x1316, 0, 18741},
+    {0x1317, 18755, 18762},
+    {0x1318, 18773, 18788},
+    {0x1319, 18809, 18822},
+    {0x131F, 0, 18834},
+    {0x1325, 0, 18839},
+    {0x1326, 0, 18862},
+    {0x1328, 18886, 18894},
+    {0x1331, 18922, 18930},
+    {0x1332, 18950, 18963},
+    {0x1335, 18981, 18991},
+    {0x133D, 0, 19006},
+    {0x133F, 0, 19021},
+    {0x1342, 0, 19038},
+    {0x1344, 19057, 19064},
+    {0x1347, 19088, 19099},
+    {0x134A, 2941, 19122},
+    {0x134B, 0, 19143},
+    {0x134C, 0, 19162},
+    {0x134D, 19188, 19194},
+    {0x135A, 0, 19205},
+    {0x135B, 0, 19225},
+    {0x135C, 0, 19238},
+    {0x135D, 19250, 19268},
+    {0x135E, 19291, 19300},
+    {0x135F, 0, 19322},
+    {0x1360, 19347, 19366},
+    {0x1361, 0, 19403},
+    {0x1363, 0, 19424},
+    {0x1365, 19449, 19459},
+    {0x1366, 19475, 19482},
+    {0x1367, 0, 19504},
+    {0x1368, 0, 19530},
+    {0x1369, 0, 19550},
+    {0x136B, 0, 19559},
+    {0x136C, 0, 19586},
+    {0x1375, 0, 19614},
+    {0x137A, 19633, 19638},
+    {0x137B, 0, 19662},
+    {0x137C, 0, 19673},
+    {0x137D, 0, 19696},
+    {0x137E, 19717, 19722},
+    {0x1380, 19747, 19755},
+    {0x1381, 0, 19781},
+    {0x1382, 19796, 19803},
+    {0x1384, 0, 19838},
+    {0x1385, 19864, 19864},
+    {0x1387, 19872, 5713},
+    {0x1388, 0, 19898},
+    {0x1389, 19936, 19945},
+    {0x138B, 0, 19968},
+    {0x138E, 0, 19980},
+    {0x138F, 0, 19992},
+    {0x1390, 20013, 20017},
+    {0x1393, 0, 20042},
+    {0x1394, 20067, 20077},
+    {0x1395, 0, 20102},
+    {0x1396, 0, 20114},
+    {0x1397, 20133, 20141},
+    {0x1398, 0, 20167},
+    {0x139A, 0, 20183},
+    {0x139D, 0, 20198},
+    {0x139E, 0, 20224},
+    {0x13A0, 0, 20247},
+    {0x13A1, 0, 20265},
+    {0x13A3, 20295, 20301},
+    {0x13A4, 0, 20312},
+    {0x13A7, 0, 20323},
+    {0x13A8, 20330, 20333},
+    {0x13A9, 0, 20344},
+    {0x13AA, 0, 20370},
+    {0x13AF, 0, 20401},
+    {0x13B1, 0, 20410},
+    {0x13B4, 0, 20429},
+    {0x13B5, 0, 20445},
+    {0x13B6, 20453, 20466},
+    {0x13B8, 0, 20476},
+    {0x13BD, 20504, 20510},
+    {0x13BF, 0, 20528},
+    {0x13C0, 20542, 20552},
+    {0x13C1, 20568, 20574},
+    {0x13C2, 0, 20585},
+    {0x13C3, 0, 20616},
+    {0x13C7, 0, 20633},
+    {0x13CC, 0, 20658},
+    {0x13CF, 0, 20678},
+    {0x13D0, 0, 20707},
+    {0x13D1, 20716, 20723},
+    {0x13D4, 0, 20743},
+    {0x13D6, 0, 20769},
+    {0x13D7, 0, 20792},
+    {0x13D8, 0, 20824},
+    {0x13D9, 0, 20843},
+    {0x13DC, 0, 20852},
+    {0x13DE, 0, 20873},
+    {0x13DF, 20898, 20905},
+    {0x13E0, 20917, 20921},
+    {0x13E3, 0, 20937},
+    {0x13E4, 0, 20946},
+    {0x13E5, 0, 20959},
+    {0x13E9, 0, 20979},
+    {0x13EA, 0, 21006},
+    {0x13F0, 0, 21027},
+    {0x13F1, 0, 21047},
+    {0x13F4, 0, 21069},
+    {0x13F6, 21089, 21097},
+    {0x13F9, 0, 21122},
+    {0x13FA, 21152, 21161},
+    {0x13FB, 0, 21183},
+    {0x13FD, 0, 21194},
+    {0x13FE, 21212, 21222},
+    {0x13FF, 0, 21242},
+    {0x1400, 21261, 21266},
+    {0x1402, 21275, 21295},
+    {0x1404, 0, 21328},
+    {0x1406, 21353, 21356},
+    {0x1407, 21391, 21396},
+    {0x1408, 0, 21419},
+    {0x1409, 21433, 21439},
+    {0x140A, 0, 21455},
+    {0x140B, 0, 21472},
+    {0x140D, 0, 21482},
+    {0x140F, 0, 21512},
+    {0x1412, 21533, 21545},
+    {0x1413, 0, 21563},
+    {0x1415, 21572, 21579},
+    {0x1418, 0, 21604},
+    {0x1419, 0, 21635},
+    {0x141B, 0, 21656},
+    {0x141E, 0, 21677},
+    {0x141F, 0, 21691},
+    {0x1420, 0, 21706},
+    {0x1425, 0, 21722},
+    {0x1428, 0, 21741},
+    {0x1429, 0, 21753},
+    {0x142A, 0, 21775},
+    {0x142B, 0, 21798},
+    {0x142C, 0, 21807},
+    {0x142D, 0, 21836},
+    {0x1430, 0, 21850},
+    {0x1433, 0, 21888},
+    {0x1435, 21908, 21912},
+    {0x1436, 0, 21944},
+    {0x1437, 0, 21963},
+    {0x1438, 0, 21977},
+    {0x143F, 0, 21989},
+    {0x1441, 0, 22021},
+    {0x1443, 22030, 22039},
+    {0x1445, 0, 22053},
+    {0x1446, 0, 22068},
+    {0x1447, 0, 22084},
+    {0x1448, 22093, 22100},
+    {0x144A, 22114, 22121},
+    {0x144B, 22143, 22151},
+    {0x144D, 0, 22185},
+    {0x1450, 0, 22191},
+    {0x1451, 0, 22218},
+    {0x1453, 0, 22240},
+    {0x1458, 22250, 22260},
+    {0x145C, 0, 22283},
+    {0x145F, 22291, 22298},
+    {0x1460, 0, 22322},
+    {0x1462, 22333, 22337},
+    {0x1463, 0, 22369},
+    {0x1464, 9039, 22386},
+    {0x1468, 0, 22425},
+    {0x1469, 0, 22450},
+    {0x146C, 0, 22476},
+    {0x146D, 0, 22492},
+    {0x146E, 0, 22505},
+    {0x1471, 0, 22516},
+    {0x1473, 0, 22547},
+    {0x1474, 0, 22570},
+    {0x1477, 0, 22599},
+    {0x1478, 0, 22611},
+    {0x147B, 0, 22632},
+    {0x147F, 0, 22652},
+    {0x1482, 0, 22670},
+    {0x1483, 0, 22710},
+    {0x1485, 0, 22728},
+    {0x1489, 0, 22751},
+    {0x148A, 0, 22775},
+    {0x148B, 0, 22783},
+    {0x148C, 22803, 22819},
+    {0x148D, 4033, 22843},
+    {0x148E, 0, 22864},
+    {0x148F, 0, 22885},
+    {0x1490, 0, 22906},
+    {0x1493, 0, 22923},
+    {0x1495, 0, 22944},
+    {0x1496, 0, 22982},
+    {0x1497, 23008, 23012},
+    {0x1498, 23031, 23036},
+    {0x1499, 0, 23054},
+    {0x149A, 23078, 23089},
+    {0x149B, 0, 23110},
+    {0x149E, 0, 23132},
+    {0x149F, 0, 23156},
+    {0x14A0, 0, 23171},
+    {0x14A2, 0, 23184},
+    {0x14A4, 0, 23211},
+    {0x14A9, 23237, 23237},
+    {0x14AB, 0, 23251},
+    {0x14B1, 0, 23273},
+    {0x14B3, 23286, 23292},
+    {0x14B4, 0, 23303},
+    {0x14B5, 23337, 23347},
+    {0x14B6, 0, 23362},
+    {0x14B7, 23381, 23388},
+    {0x14B9, 23400, 23408},
+    {0x14BA, 0, 23439},
+    {0x14BB, 0, 23453},
+    {0x14BE, 0, 23473},
+    {0x14C0, 23491, 23498},
+    {0x14C1, 0, 23523},
+    {0x14C2, 0, 23536},
+    {0x14C4, 0, 23549},
+    {0x14C5, 0, 23584},
+    {0x14C6, 0, 23611},
+    {0x14C7, 23625, 23633},
+    {0x14C8, 23657, 23667},
+    {0x14C9, 0, 23686},
+    {0x14CB, 0, 23707},
+    {0x14CD, 0, 23748},
+    {0x14CF, 23774, 23783},
+    {0x14D4, 23805, 23813},
+    {0x14D5, 0, 23844},
+    {0x14D6, 0, 23864},
+    {0x14D7, 0, 23876},
+    {0x14D8, 0, 23898},
+    {0x14D9, 0, 23919},
+    {0x14DB, 23939, 23945},
+    {0x14DC, 23967, 23976},
+    {0x14DD, 0, 24002},
+    {0x14DE, 0, 24013},
+    {0x14E3, 0, 24045},
+    {0x14E4, 24053, 24062},
+    {0x14EA, 24083, 24090},
+    {0x14EB, 0, 1373},
+    {0x14EC, 0, 24118},
+    {0x14ED, 0, 24126},
+    {0x14EF, 0, 24143},
+    {0x14F1, 24170, 24179},
+    {0x14F2, 24202, 24211},
+    {0x14F4, 0, 24238},
+    {0x14F5, 0, 24273},
+    {0x14F6, 0, 24283},
+    {0x14F7, 0, 24307},
+    {0x14F8, 0, 24327},
+    {0x14F9, 0, 24342},
+    {0x14FB, 0, 24360},
+    {0x14FC, 0, 24384},
+    {0x14FD, 24397, 24403},
+    {0x14FE, 0, 24425},
+    {0x14FF, 0, 24447},
+    {0x1501, 0, 24476},
+    {0x1502, 0, 24496},
+    {0x1503, 0, 24537},
+    {0x1504, 0, 24558},
+    {0x1506, 0, 24577},
+    {0x1507, 24599, 24604},
+    {0x1509, 3486, 24614},
+    {0x150B, 0, 24647},
+    {0x150C, 0, 24670},
+    {0x150D, 0, 24684},
+    {0x150E, 0, 24698},
+    {0x150F, 0, 24717},
+    {0x1510, 0, 24728},
+    {0x1511, 0, 24756},
+    {0x1512, 24783, 24789},
+    {0x1513, 0, 24812},
+    {0x1514, 0, 24820},
+    {0x1515, 0, 24832},
+    {0x1516, 0, 24843},
+    {0x1517, 0, 24864},
+    {0x1518, 0, 24884},
+    {0x1519, 0, 24944},
+    {0x151A, 24977, 24986},
+    {0x151B, 25000, 25006},
+    {0x151C, 0, 25017},
+    {0x151D, 0, 25040},
+    {0x151E, 0, 25077},
+    {0x151F, 0, 25090},
+    {0x1520, 0, 25115},
+    {0x1521, 0, 25134},
+    {0x1522, 25151, 25160},
+    {0x1523, 0, 25177},
+    {0x1524, 25198, 25204},
+    {0x1525, 0, 25223},
+    {0x1526, 0, 25243},
+    {0x1527, 0, 25251},
+    {0x1528, 0, 25261},
+    {0x1529, 0, 25268},
+    {0x152A, 0, 25294},
+    {0x152B, 0, 25319},
+    {0x152C, 0, 25345},
+    {0x152D, 0, 25367},
+    {0x152E, 0, 25387},
+    {0x152F, 0, 25397},
+    {0x1532, 0, 25414},
+    {0x1533, 0, 25434},
+    {0x1534, 0, 25444},
+    {0x1535, 0, 25461},
+    {0x1537, 0, 25488},
+    {0x1538, 25510, 25518},
+    {0x1539, 0, 25531},
+    {0x153A, 0, 25572},
+    {0x153B, 25582, 25587},
+    {0x153C, 0, 25612},
+    {0x153D, 0, 25629},
+    {0x153E, 25649, 25658},
+    {0x153F, 25671, 25676},
+    {0x1540, 0, 25699},
+    {0x1541, 0, 25726},
+    {0x1542, 0, 25740},
+    {0x1543, 0, 25761},
+    {0x1544, 25782, 25786},
+    {0x1545, 25808, 25818},
+    {0x1546, 0, 25828},
+    {0x1547, 0, 25849},
+    {0x1548, 0, 25870},
+    {0x1549, 25896, 25900},
+    {0x154A, 0, 25931},
+    {0x154B, 0, 25953},
+    {0x154C, 0, 25969},
+    {0x154D, 0, 25992},
+    {0x154E, 0, 26026},
+    {0x154F, 0, 26040},
+    {0x1550, 0, 26062},
+    {0x1551, 0, 26082},
+    {0x1553, 0, 26116},
+    {0x1554, 26143, 26147},
+    {0x1555, 26174, 26182},
+    {0x1556, 0, 26195},
+    {0x1557, 0, 26212},
+    {0x1558, 0, 26230},
+    {0x1559, 0, 26251},
+    {0x155A, 0, 26264},
+    {0x155B, 0, 26278},
+    {0x155C, 0, 26304},
+    {0x155D, 0, 26306},
+    {0x155E, 26324, 26327},
+    {0x155F, 0, 26345},
+    {0x1560, 0, 26367},
+    {0x1561, 0, 26398},
+    {0x1562, 0, 26415},
+    {0x1563, 0, 26441},
+    {0x1564, 0, 26467},
+    {0x1565, 26505, 26509},
+    {0x1566, 0, 26537},
+    {0x1567, 0, 26561},
+    {0x1568, 0, 26570},
+    {0x1569, 26590, 26599},
+    {0x156A, 26622, 26628},
+    {0x156B, 0, 26646},
+    {0x156C, 0, 26655},
+    {0x156D, 0, 26678},
+    {0x156E, 0, 26693},
+    {0x156F, 0, 26703},
+    {0x1570, 0, 26737},
+    {0x1571, 0, 26756},
+    {0x1572, 0, 26778},
+    {0x1573, 0, 26800},
+    {0x1574, 0, 26817},
+    {0x1575, 0, 26841},
+    {0x1576, 0, 26877},
+    {0x1578, 0, 26890},
+    {0x1579, 0, 26895},
+    {0x157A, 0, 26923},
+    {0x157B, 0, 26949},
+    {0x157C, 26971, 26980},
+    {0x157D, 0, 26994},
+    {0x157E, 0, 27011},
+    {0x157F, 0, 27031},
+    {0x1580, 0, 27061},
+    {0x1581, 0, 27082},
+    {0x1582, 0, 27107},
+    {0x1583, 0, 27125},
+    {0x1584, 0, 27147},
+    {0x1585, 0, 27170},
+    {0x1586, 0, 27199},
+    {0x1587, 0, 27211},
+    {0x1588, 27230, 27238},
+    {0x1589, 0, 27259},
+    {0x158A, 0, 27289},
+    {0x158B, 0, 27309},
+    {0x158C, 0, 27334},
+    {0x158D, 0, 27379},
+    {0x158E, 0, 27404},
+    {0x158F, 0, 27424},
+    {0x1590, 0, 27436},
+    {0x1591, 0, 27450},
+    {0x1592, 27454, 27459},
+    {0x1593, 0, 27474},
+    {0x1594, 0, 27483},
+    {0x1595, 0, 27495},
+    {0x1596, 0, 27514},
+    {0x1597, 0, 27534},
+    {0x1598, 0, 27556},
+    {0x1599, 0, 27577},
+    {0x159A, 0, 27599},
+    {0x159B, 0, 27618},
+    {0x159C, 0, 27642},
+    {0x159D, 0, 27667},
+    {0x159E, 0, 27702},
+    {0x159F, 0, 27726},
+    {0x15A0, 0, 27749},
+    {0x15A1, 0, 27765},
+    {0x15A2, 0, 27793},
+    {0x15A3, 0, 27818},
+    {0x15A4, 0, 27826},
+    {0x15A5, 0, 27835},
+    {0x15A6, 0, 27851},
+    {0x15A7, 0, 27888},
+    {0x15A8, 0, 27904},
+    {0x15AA, 0, 27945},
+    {0x15AB, 0, 27957},
+    {0x15AC, 0, 27980},
+    {0x15AD, 28007, 28014},
+    {0x15AE, 0, 28026},
+    {0x15B0, 0, 28053},
+    {0x15B1, 0, 28083},
+    {0x15B2, 0, 28105},
+    {0x15B3, 0, 28130},
+    {0x15B4, 0, 28150},
+    {0x15B5, 0, 28160},
+    {0x15B6, 0, 28174},
+    {0x15B7, 0, 28199},
+    {0x15B8, 0, 28213},
+    {0x15B9, 0, 28228},
+    {0x15BA, 0, 28259},
+    {0x15BB, 0, 28283},
+    {0x15BC, 28296, 28304},
+    {0x15BD, 0, 2601},
+    {0x15BE, 0, 28325},
+    {0x15BF, 0, 28342},
+    {0x15C0, 28372, 28376},
+    {0x15C1, 0, 28388},
+    {0x15C2, 0, 28396},
+    {0x15C3, 0, 28417},
+    {0x15C4, 0, 28438},
+    {0x15C5, 0, 28447},
+    {0x15C6, 0, 28471},
+    {0x15C7, 0, 28504},
+    {0x15C8, 0, 28538},
+    {0x15C9, 0, 28558},
+    {0x15CA, 0, 28580},
+    {0x15CB, 0, 28591},
+    {0x15CC, 0, 28610},
+    {0x15CD, 0, 28623},
+    {0x15CE, 0, 28640},
+    {0x15CF, 0, 28652},
+    {0x15D1, 28666, 28675},
+    {0x15D2, 0, 28700},
+    {0x15D3, 0, 28739},
+    {0x15D4, 0, 28767},
+    {0x15D5, 0, 28785},
+    {0x15D6, 0, 28796},
+    {0x15D7, 0, 28817},
+    {0x15D8, 0, 28838},
+    {0x15D9, 0, 28868},
+    {0x15DA, 0, 28893},
+    {0x15DB, 0, 28908},
+    {0x15DC, 28939, 28948},
+    {0x15DD, 0, 28962},
+    {0x15DE, 0, 28976},
+    {0x15E0, 0, 29003},
+    {0x15E1, 29017, 29021},
+    {0x15E2, 0, 29046},
+    {0x15E3, 0, 29072},
+    {0x15E4, 0, 29098},
+    {0x15E5, 0, 29114},
+    {0x15E6, 0, 29138},
+    {0x15E7, 0, 29149},
+    {0x15E8, 0, 29171},
+    {0x15E9, 0, 29195},
+    {0x15EA, 0, 29217},
+    {0x15EB, 0, 29241},
+    {0x15EC, 0, 29255},
+    {0x15ED, 0, 29269},
+    {0x15EE, 0, 29283},
+    {0x15EF, 0, 29307},
+    {0x15F0, 0, 29332},
+    {0x15F1, 0, 29351},
+    {0x15F2, 0, 29371},
+    {0x15F3, 0, 29398},
+    {0x15F4, 0, 29415},
+    {0x15F5, 0, 29425},
+    {0x15F6, 0, 29446},
+    {0x15F7, 0, 29472},
+    {0x15F8, 0, 29480},
+    {0x15F9, 0, 29500},
+    {0x15FA, 29531, 29537},
+    {0x15FB, 0, 29555},
+    {0x15FC, 0, 29566},
+    {0x15FD, 0, 29593},
+    {0x15FE, 0, 29605},
+    {0x15FF, 0, 29627},
+    {0x1600, 0, 29655},
+    {0x1601, 0, 29685},
+    {0x1602, 0, 29702},
+    {0x1603, 0, 29718},
+    {0x1604, 0, 29757},
+    {0x1605, 0, 29788},
+    {0x1606, 0, 29810},
+    {0x1607, 0, 29821},
+    {0x1608, 0, 29859},
+    {0x1609, 0, 29892},
+    {0x160A, 0, 29919},
+    {0x160B, 0, 29942},
+    {0x160C, 0, 29954},
+    {0x160D, 0, 29980},
+    {0x160E, 0, 30002},
+    {0x160F, 0, 30025},
+    {0x1610, 0, 30037},
+    {0x1611, 0, 30067},
+    {0x1612, 0, 30081},
+    {0x1613, 0, 30107},
+    {0x1614, 0, 30125},
+    {0x1615, 0, 30140},
+    {0x1616, 0, 30167},
+    {0x1617, 0, 30179},
+    {0x1618, 0, 30195},
+    {0x1619, 30203, 30211},
+    {0x161B, 0, 30242},
+    {0x161C, 0, 30262},
+    {0x161D, 0, 30281},
+    {0x161E, 0, 30287},
+    {0x161F, 30307, 30313},
+    {0x1620, 0, 30340},
+    {0x1621, 0, 30356},
+    {0x1622, 30383, 30387},
+    {0x1623, 0, 30413},
+    {0x1624, 0, 30426},
+    {0x1625, 0, 30442},
+    {0x1626, 0, 30464},
+    {0x1627, 0, 30488},
+    {0x1629, 0, 30509},
+    {0x162A, 0, 30533},
+    {0x162B, 0, 30559},
+    {0x162C, 0, 30589},
+    {0x162D, 0, 30614},
+    {0x162E, 0, 30631},
+    {0x162F, 0, 30649},
+    {0x1630, 0, 30686},
+    {0x1631, 0, 30704},
+    {0x1632, 0, 30731},
+    {0x1633, 0, 30743},
+    {0x1634, 0, 30760},
+    {0x1635, 0, 30787},
+    {0x1636, 0, 30794},
+    {0x1637, 0, 30811},
+    {0x1638, 30815, 30840},
+    {0x163A, 0, 30864},
+    {0x163B, 0, 30878},
+    {0x163C, 0, 30893},
+    {0x163D, 0, 30899},
+    {0x163E, 0, 30922},
+    {0x163F, 0, 30930},
+    {0x1640, 0, 30943},
+    {0x1641, 0, 30960},
+    {0x1642, 0, 30978},
+    {0x1643, 0, 30986},
+    {0x1644, 0, 31008},
+    {0x1645, 0, 31029},
+    {0x1646, 0, 31058},
+    {0x1647, 0, 31083},
+    {0x1648, 0, 31108},
+    {0x1649, 0, 31129},
+    {0x164A, 0, 31145},
+    {0x164C, 0, 31158},
+    {0x164D, 0, 31180},
+    {0x164E, 0, 31196},
+    {0x164F, 31208, 31218},
+    {0x1650, 0, 31239},
+    {0x1651, 0, 31262},
+    {0x1652, 0, 31288},
+    {0x1653, 31310, 31321},
+    {0x1654, 0, 31354},
+    {0x1655, 0, 31368},
+    {0x1656, 0, 31391},
+    {0x1657, 0, 31412},
+    {0x1658, 0, 31443},
+    {0x1659, 0, 31463},
+    {0x165A, 0, 31489},
+    {0x165B, 0, 31499},
+    {0x165C, 0, 31522},
+    {0x165D, 0, 31535},
+    {0x165E, 0, 31567},
+    {0x165F, 31592, 31599},
+    {0x1660, 0, 31618},
+    {0x1661, 0, 31658},
+    {0x1662, 0, 31675},
+    {0x1663, 0, 31684},
+    {0x1664, 0, 31700},
+    {0x1665, 0, 31729},
+    {0x1666, 0, 31739},
+    {0x1667, 0, 31758},
+    {0x1668, 31773, 31783},
+    {0x166A, 0, 31810},
+    {0x166B, 0, 31823},
+    {0x166C, 0, 31837},
+    {0x166D, 0, 31848},
+    {0x166E, 0, 31860},
+    {0x166F, 0, 31886},
+    {0x1670, 0, 31908},
+    {0x1671, 0, 31922},
+    {0x1672, 0, 31943},
+    {0x1673, 0, 31959},
+    {0x1675, 0, 31965},
+    {0x1676, 2847, 31988},
+    {0x1677, 0, 32003},
+    {0x1678, 0, 32022},
+    {0x1679, 0, 32040},
+    {0x167F, 32067, 32071},
+    {0x1680, 32098, 32104},
+    {0x1681, 32116, 32116},
+    {0x1682, 32125, 32130},
+    {0x1688, 32152, 32162},
+    {0x168A, 32188, 32192},
+    {0x168B, 0, 32212},
+    {0x168C, 32234, 32242},
+    {0x168D, 32270, 32274},
+    {0x168E, 32295, 32312},
+    {0x168F, 32347, 32351},
+    {0x1690, 32370, 32383},
+    {0x1693, 32402, 32402},
+    {0x1695, 32408, 32413},
+    {0x16AE, 32437, 32442},
+    {0x16B3, 0, 32455},
+    {0x16B8, 32476, 32496},
+    {0x16CA, 32522, 32530},
+    {0x16CB, 32543, 32551},
+    {0x16CC, 32568, 32574},
+    {0x16D0, 0, 32585},
+    {0x16E0, 32594, 32599},
+    {0x16E5, 0, 32636},
+    {0x16EC, 32657, 32661},
+    {0x16F0, 0, 32675},
+    {0x16F1, 32684, 32691},
+    {0x16F3, 32704, 32711},
+    {0x16F6, 32739, 32753},
+    {0x1700, 32772, 32779},
+    {0x1701, 0, 32790},
+    {0x1702, 32825, 32829},
+    {0x1703, 32853, 32860},
+    {0x1704, 32875, 32886},
+    {0x1705, 32906, 32906},
+    {0x1706, 32920, 32924},
+    {0x1707, 32957, 32965},
+    {0x1708, 32992, 32999},
+    {0x1709, 33012, 33020},
+    {0x170A, 33042, 33049},
+    {0x170B, 33073, 33083},
+    {0x170C, 33098, 33109},
+    {0x170D, 33125, 33129},
+    {0x170E, 33159, 33170},
+    {0x170F, 33195, 33205},
+    {0x1710, 33220, 33227},
+    {0x1711, 33243, 33253},
+    {0x1712, 33279, 33284},
+    {0x1713, 33302, 33309},
+    {0x1725, 728, 736},
+    {0x1734, 33322, 33338},
+    {0x1737, 33369, 33369},
+    {0x173B, 33377, 33384},
+    {0x1743, 33411, 33421},
+    {0x174B, 33434, 33456},
+    {0x1752, 33475, 33491},
+    {0x1753, 33522, 33532},
+    {0x1755, 33548, 33556},
+    {0x176A, 33583, 33587},
+    {0x1789, 33611, 33618},
+    {0x1793, 33643, 33651},
+    {0x17A7, 33680, 33694},
+    {0x17AA, 33729, 33736},
+    {0x17AB, 0, 33758},
+    {0x17AF, 33778, 33787},
+    {0x17BE, 33822, 7143},
+    {0x17C0, 33830, 33838},
+    {0x17C4, 0, 33852},
+    {0x17CC, 33859, 33859},
+    {0x17D5, 33867, 33876},
+    {0x17E9, 0, 33890},
+    {0x17EE, 33910, 33920},
+    {0x1813, 33945, 33953},
+    {0x1814, 33979, 33997},
+    {0x1815, 34021, 34028},
+    {0x1820, 34038, 34048},
+    {0x1824, 34072, 34072},
+    {0x1860, 34080, 34094},
+    {0x186C, 34113, 34122},
+    {0x1887, 34137, 34142},
+    {0x1888, 0, 34167},
+    {0x188D, 34183, 34192},
+    {0x1890, 0, 34206},
+    {0x18BC, 0, 34220},
+    {0x18C9, 34235, 34241},
+    {0x18CA, 34262, 34266},
+    {0x18F1, 34285, 34289},
+    {0x18F4, 34337, 34346},
+    {0x18F7, 34359, 34368},
+    {0x18FB, 0, 34383},
+    {0x1905, 34406, 34420},
+    {0x1910, 34441, 34441},
+    {0x1971, 0, 34457},
+    {0x19A8, 34482, 34490},
+    {0x19AC, 34503, 34516},
+    {0x19E2, 34546, 34553},
+    {0x1A08, 0, 34576},
+    {0x1A42, 0, 34590},
+    {0x1B13, 34600, 34611},
+    {0x1DE1, 5267, 5267},
+    {0x1FCF, 34633, 34641},
+    {0x2001, 0, 34667},
+    {0x2646, 34689, 34698},
+    {0x270F, 34722, 34732},
+    {0x2EC1, 0, 34760},
+    {0x3388, 34770, 34775},
+    {0x3411, 0, 34786},
+    {0x3513, 34814, 34820},
+    {0x38EF, 0, 34847},
+    {0x3D3D, 34854, 34861},
+    {0x4005, 34878, 34885},
+    {0x4144, 34903, 34903},
+    {0x416C, 0, 34914},
+    {0x4680, 34940, 34950},
+    {0x4843, 32116, 34970},
+    {0x4943, 0, 34999},
+    {0x4954, 35015, 35024},
+    {0x4978, 35046, 35051},
+    {0x4C48, 35070, 35079},
+    {0x4C53, 35100, 35104},
+    {0x4CA1, 0, 35132},
+    {0x4D51, 35154, 35161},
+    {0x4D54, 0, 35173},
+    {0x4DDC, 35194, 35198},
+    {0x5053, 35220, 35232},
+    {0x5136, 0, 35257},
+    {0x5143, 35274, 35283},
+    {0x5333, 35297, 35307},
+    {0x544C, 0, 35328},
+    {0x5555, 35342, 35350},
+    {0x6409, 0, 35363},
+    {0x6666, 35377, 35386},
+    {0x7604, 35422, 35427},
+    {0x8086, 35450, 35450},
+    {0x8866, 35456, 35465},
+    {0x8888, 35486, 35496},
+    {0x8E0E, 35510, 35520},
+    {0x9004, 35542, 35550},
+    {0x9005, 35542, 35550},
+    {0x919A, 0, 35562},
+    {0x9412, 17100, 17100},
+    {0x9699, 0, 35577},
+    {0x9902, 35604, 35612},
+    {0xA0A0, 35626, 35632},
+    {0xA0F1, 0, 35643},
+    {0xA200, 1221, 35662},
+    {0xA259, 0, 35672},
+    {0xA304, 1754, 1754},
+    {0xA727, 0, 35688},
+    {0xAA42, 10142, 35705},
+    {0xAC1E, 0, 35726},
+    {0xB1B3, 10735, 35758},
+    {0xB894, 0, 35776},
+    {0xBEEF, 35804, 35804},
+    {0xC001, 35825, 35829},
+    {0xC0A9, 35840, 35855},
+    {0xC0DE, 0, 1954},
+    {0xC0FE, 35881, 35891},
+    {0xC622, 0, 35915},
+    {0xCA50, 35934, 35941},
+    {0xCAFE, 0, 35968},
+    {0xCCCC, 0, 35982},
+    {0xD4D4, 36006, 5713},
+    {0xDC93, 0, 36017},
+    {0xDEAD, 36029, 36038},
+    {0xDEAF, 0, 36059},
+    {0xE159, 36079, 36089},
+    {0xE4BF, 0, 36111},
+    {0xEA01, 0, 36131},
+    {0xEABB, 36148, 36156},
+    {0xEACE, 36180, 36187},
+    {0xECC0, 36219, 36224},
+    {0xEDD8, 36255, 36265},
+    {0xF5F5, 0, 36280},
+    {0xFA57, 36297, 36307},
+};
+
+inline constexpr PciDeviceRecord PciDeviceRecords[] = {
+    {0x003D00D1, 36320, 36331},
+    {0x0E110001, 0, 36340},
+    {0x0E110002, 36359, 0},
+    {0x0E11000F, 36370, 36378},
+    {0x0E110012, 36413, 36413},
+    {0x0E110049, 36419, 36426},
+    {0x0E11004A, 36449, 36456},
+    {0x0E1100C0, 36479, 36497},
+    {0x0E110508, 36538, 36557},
+    {0x0E111000, 36580, 36599},
+    {0x0E112000, 36614, 36599},
+    {0x0E113032, 36633, 36651},
+    {0x0E113033, 36667, 36651},
+    {0x0E113034, 36685, 36651},
+    {0x0E114000, 36703, 36599},
+    {0x0E116010, 36722, 36733},
+    {0x0E117020, 0, 36752},
+    {0x0E11A0EC, 0, 36767},
+    {0x0E11A0F0, 0, 36801},
+    {0x0E11A0F3, 0, 36839},
+    {0x0E11A0F7, 0, 36869},
+    {0x0E11A0F8, 36892, 36900},
+    {0x0E11A0FC, 36925, 36936},
+    {0x0E11AE10, 0, 36968},
+    {0x0E11AE29, 36993, 36999},
+    {0x0E11AE2A, 37017, 37021},
+    {0x0E11AE2B, 37039, 37045},
+    {0x0E11AE31, 0, 37067},
+    {0x0E11AE32, 0, 37096},
+    {0x0E11AE33, 37135, 37143},
+    {0x0E11AE34, 0, 37164},
+    {0x0E11AE35, 0, 37198},
+    {0x0E11AE40, 0, 37230},
+    {0x0E11AE43, 0, 37271},
+    {0x0E11AE69, 37308, 36999},
+    {0x0E11AE6C, 37316, 37322},
+    {0x0E11AE6D, 37333, 37021},
+    {0x0E11B011, 0, 37343},
+    {0x0E11B012, 37375, 37394},
+    {0x0E11B01E, 37407, 37414},
+    {0x0E11B01F, 37432, 37414},
+    {0x0E11B02F, 37439, 37446},
+    {0x0E11B030, 37459, 37479},
+    {0x0E11B04A, 37517, 37528},
+    {0x0E11B060, 37556, 37561},
+    {0x0E11B0C6, 37585, 37592},
+    {0x0E11B0C7, 37633, 37414},
+    {0x0E11B0D7, 37640, 37414},
+    {0x0E11B0DD, 37662, 37414},
+    {0x0E11B0DE, 37669, 37414},
+    {0x0E11B0DF, 37676, 37683},
+    {0x0E11B0E0, 37698, 37683},
+    {0x0E11B0E1, 37705, 37712},
+    {0x0E11B123, 37733, 37740},
+    {0x0E11B134, 37752, 37414},
+    {0x0E11B13C, 37759, 37414},
+    {0x0E11B144, 37766, 37414},
+    {0x0E11B163, 37773, 37414},
+    {0x0E11B164, 37780, 37787},
+    {0x0E11B178, 37816, 37561},
+    {0x0E11B196, 37822, 37827},
+    {0x0E11B1A4, 37850, 36456},
+    {0x0E11B203, 37857, 37861},
+    {0x0E11B204, 37857, 37861},
+    {0x0E11F095, 37893, 37901},
+    {0x0E11F130, 0, 38001},
+    {0x0E11F150, 0, 38028},
+    {0x0E11F700, 0, 38064},
+    {0x0E11F800, 0, 38103},
+    {0x10000001, 38142, 38152},
+    {0x10000002, 38175, 38182},
+    {0x10000003, 38197, 38211},
+    {0x10000004, 38237, 38244},
+    {0x10000005, 38266, 38275},
+    {0x10000006, 38285, 38300},
+    {0x1000000A, 38332, 38343},
+    {0x1000000B, 38383, 38343},
+    {0x1000000C, 38397, 38407},
+    {0x1000000D, 38440, 38447},
+    {0x1000000F, 38473, 38300},
+    {0x10000010, 38332, 38494},
+    {0x10000012, 38531, 38542},
+    {0x10000013, 38572, 38583},
+    {0x10000020, 38197, 38612},
+    {0x10000021, 38650, 38681},
+    {0x10000030, 38713, 38729},
+    {0x10000031, 38763, 38776},
+    {0x10000032, 38798, 38729},
+    {0x10000035, 38798, 38776},
+    {0x10000040, 38798, 38729},
+    {0x10000050, 38809, 38820},
+    {0x10000054, 38841, 38820},
+    {0x10000056, 38852, 38865},
+    {0x10000058, 38892, 38865},
+    {0x1000005E, 38904, 38820},
+    {0x10000062, 38915, 38865},
+    {0x1000008F, 38926, 38933},
+    {0x10000621, 38967, 38976},
+    {0x10000622, 39004, 39013},
+    {0x10000623, 39004, 39054},
+    {0x10000624, 39095, 38976},
+    {0x10000625, 39095, 38976},
+    {0x10000626, 39104, 39114},
+    {0x10000628, 39136, 39114},
+    {0x10000630, 39146, 38976},
+    {0x10000640, 39155, 39114},
+    {0x10000642, 39165, 39114},
+    {0x10000646, 39175, 39114},
+    {0x10000701, 38440, 39186},
+    {0x10000702, 39207, 39223},
+    {0x10000901, 39251, 36752},
+    {0x10001000, 39258, 39265},
+    {0x10001001, 39286, 39293},
+    {0x10001010, 39324, 39338},
+    {0x10010010, 39369, 39381},
+    {0x10010011, 39369, 39413},
+    {0x10010012, 39369, 39445},
+    {0x10010013, 39369, 39478},
+    {0x10010014, 39369, 39523},
+    {0x10010015, 39369, 39566},
+    {0x10010016, 39369, 39607},
+    {0x10010017, 39369, 39637},
+    {0x10010020, 39369, 39678},
+    {0x10020B12, 39714, 39714},
+    {0x10023150, 39723, 39730},
+    {0x10023154, 39751, 39758},
+    {0x10023E50, 39765, 39771},
+    {0x10023E54, 39765, 39783},
+    {0x10024136, 39796, 39799},
+    {0x10024137, 39814, 39820},
+    {0x10024144, 39835, 39840},
+    {0x10024145, 39835, 39859},
+    {0x10024146, 39835, 39877},
+    {0x10024147, 0, 39889},
+    {0x10024148, 39923, 39928},
+    {0x10024150, 39943, 39949},
+    {0x10024151, 39965, 39971},
+    {0x10024152, 39983, 39989},
+    {0x10024153, 39965, 40004},
+    {0x10024158, 40016, 40025},
+    {0x10024164, 40033, 40063},
+    {0x10024167, 0, 40085},
+    {0x10024168, 39923, 40119},
+    {0x10024170, 39965, 40146},
+    {0x10024171, 39965, 40170},
+    {0x10024172, 39983, 40192},
+    {0x10024173, 39965, 40219},
+    {0x10024242, 40243, 40251},
+    {0x10024243, 0, 40272},
+    {0x10024336, 40309, 40315},
+    {0x10024337, 40331, 40338},
+    {0x10024341, 40355, 40362},
+    {0x10024342, 40385, 40393},
+    {0x10024345, 40385, 40404},
+    {0x10024347, 40385, 40424},
+    {0x10024348, 40385, 40447},
+    {0x10024349, 40385, 40470},
+    {0x1002434C, 40385, 40485},
+    {0x1002434D, 40500, 40509},
+    {0x10024353, 40385, 40542},
+    {0x10024354, 40559, 40571},
+    {0x10024358, 40577, 40588},
+    {0x10024370, 40598, 40612},
+    {0x10024372, 40639, 40644},
+    {0x10024376, 40654, 40656},
+    {0x10024378, 40703, 40708},
+    {0x1002437B, 40719, 40746},
+    {0x10024554, 40797, 0},
+    {0x10024654, 40807, 40817},
+    {0x10024742, 40832, 40842},
+    {0x10024744, 40868, 40868},
+    {0x10024747, 40887, 40899},
+    {0x10024749, 40907, 40940},
+    {0x1002474C, 40968, 40983},
+    {0x1002474D, 40991, 41006},
+    {0x1002474E, 41011, 0},
+    {0x1002474F, 41026, 41041},
+    {0x10024750, 41068, 41068},
+    {0x10024751, 41090, 41106},
+    {0x10024752, 41120, 0},
+    {0x10024753, 41132, 0},
+    {0x10024754, 41144, 41155},
+    {0x10024755, 41187, 41202},
+    {0x10024756, 41218, 41234},
+    {0x10024757, 41255, 41218},
+    {0x10024758, 41266, 41275},
+    {0x10024759, 40559, 41286},
+    {0x1002475A, 41311, 41322},
+    {0x10024966, 41335, 41341},
+    {0x10024967, 41335, 41362},
+    {0x1002496E, 41335, 41374},
+    {0x1002496F, 41335, 41407},
+    {0x10024A49, 41431, 41436},
+    {0x10024A4B, 41451, 41456},
+    {0x10024A6B, 41451, 41471},
+    {0x10024C42, 41496, 41505},
+    {0x10024C44, 41532, 41505},
+    {0x10024C45, 0, 41551},
+    {0x10024C46, 41572, 41588},
+    {0x10024C47, 41595, 41608},
+    {0x10024C49, 41621, 41625},
+    {0x10024C4D, 41640, 41649},
+    {0x10024C4E, 41674, 41687},
+    {0x10024C51, 41703, 41707},
+    {0x10024C52, 41726, 41734},
+    {0x10024C53, 41756, 41768},
+    {0x10024C54, 0, 41788},
+    {0x10024C57, 41799, 41804},
+    {0x10024C58, 0, 41826},
+    {0x10024C59, 41842, 41853},
+    {0x10024C5A, 0, 41879},
+    {0x10024C64, 0, 41901},
+    {0x10024C66, 41923, 41973},
+    {0x10024D46, 0, 41992},
+    {0x10024D4C, 0, 42017},
+    {0x10024D52, 42039, 42039},
+    {0x10024E44, 39835, 42059},
+    {0x10024E45, 39835, 42083},
+    {0x10024E46, 39835, 42099},
+    {0x10024E47, 0, 42113},
+    {0x10024E48, 42149, 42154},
+    {0x10024E49, 39923, 42170},
+    {0x10024E4A, 42149, 42182},
+    {0x10024E4B, 42197, 42207},
+    {0x10024E50, 42226, 42235},
+    {0x10024E54, 42260, 42269},
+    {0x10024E64, 39835, 42292},
+    {0x10024E65, 39835, 42308},
+    {0x10024E66, 39835, 42344},
+    {0x10024E67, 0, 42370},
+    {0x10024E68, 39923, 42410},
+    {0x10024E69, 39923, 42438},
+    {0x10024E6A, 39923, 42462},
+    {0x10024E6B, 42197, 42489},
+    {0x10025041, 42518, 42521},
+    {0x10025042, 0, 42541},
+    {0x10025043, 42564, 42575},
+    {0x10025044, 42598, 42604},
+    {0x10025045, 0, 42624},
+    {0x10025046, 42647, 42652},
+    {0x10025047, 42675, 42686},
+    {0x10025048, 42706, 42726},
+    {0x10025049, 42749, 42793},
+    {0x1002504A, 42816, 42836},
+    {0x1002504B, 42863, 42883},
+    {0x1002504C, 42913, 42933},
+    {0x1002504D, 42943, 42943},
+    {0x1002504E, 42963, 42983},
+    {0x1002504F, 43006, 43026},
+    {0x10025050, 43049, 43069},
+    {0x10025051, 43096, 43116},
+    {0x10025052, 43146, 43166},
+    {0x10025053, 43196, 43196},
+    {0x10025054, 43216, 43236},
+    {0x10025055, 43259, 43259},
+    {0x10025056, 43284, 43304},
+    {0x10025057, 43331, 43351},
+    {0x10025058, 43381, 43394},
+    {0x10025144, 43411, 43411},
+    {0x10025145, 0, 43434},
+    {0x10025146, 0, 43444},
+    {0x10025147, 0, 43454},
+    {0x10025148, 43464, 43469},
+    {0x10025149, 0, 43484},
+    {0x1002514A, 0, 43499},
+    {0x1002514B, 0, 43514},
+    {0x1002514C, 43464, 43529},
+    {0x1002514D, 43464, 43550},
+    {0x1002514E, 0, 43569},
+    {0x1002514F, 0, 43584},
+    {0x10025157, 43599, 43605},
+    {0x10025158, 43617, 43637},
+    {0x10025159, 43652, 43658},
+    {0x1002515A, 0, 43682},
+    {0x1002515E, 43695, 43695},
+    {0x10025168, 0, 43709},
+    {0x10025169, 0, 43724},
+    {0x1002516A, 0, 43739},
+    {0x1002516B, 0, 43754},
+    {0x1002516C, 0, 43529},
+    {0x1002516D, 43464, 43769},
+    {0x10025245, 43800, 43812},
+    {0x10025246, 43828, 43841},
+    {0x10025247, 0, 43851},
+    {0x1002524B, 43863, 43874},
+    {0x1002524C, 0, 43893},
+    {0x10025345, 0, 43915},
+    {0x10025346, 43934, 43934},
+    {0x10025347, 0, 43956},
+    {0x10025348, 0, 43978},
+    {0x1002534B, 43993, 44009},
+    {0x1002534C, 44028, 44047},
+    {0x1002534D, 44069, 44088},
+    {0x1002534E, 44110, 0},
+    {0x10025354, 0, 44122},
+    {0x10025446, 44133, 44152},
+    {0x1002544C, 0, 44186},
+    {0x10025452, 0, 44202},
+    {0x10025455, 0, 44218},
+    {0x10025460, 44240, 44246},
+    {0x1002554D, 44273, 44278},
+    {0x10025551, 44293, 44303},
+    {0x1002556D, 44273, 44335},
+    {0x10025571, 44293, 44362},
+    {0x10025653, 44396, 44401},
+    {0x10025654, 44415, 44426},
+    {0x10025655, 0, 44453},
+    {0x10025656, 44465, 44465},
+    {0x10025830, 44481, 44487},
+    {0x10025831, 44481, 44487},
+    {0x10025832, 44481, 44487},
+    {0x10025833, 44499, 44487},
+    {0x10025834, 44481, 44499},
+    {0x10025835, 44481, 44515},
+    {0x10025838, 44499, 44544},
+    {0x10025940, 44555, 44561},
+    {0x10025941, 44555, 44589},
+    {0x10025954, 44617, 44620},
+    {0x10025955, 44657, 44661},
+    {0x10025960, 44555, 44688},
+    {0x10025961, 44555, 44704},
+    {0x10025964, 44727, 44739},
+    {0x10025965, 44761, 44768},
+    {0x10025A33, 44780, 44786},
+    {0x10025A42, 44817, 44823},
+    {0x10025A61, 44880, 44906},
+    {0x10025B60, 44941, 44953},
+    {0x10025B62, 39765, 45006},
+    {0x10025B64, 45031, 45039},
+    {0x10025B70, 45047, 45047},
+    {0x10025C61, 45059, 45086},
+    {0x10025C63, 45107, 45086},
+    {0x10025D44, 44555, 45119},
+    {0x10025D45, 44555, 45153},
+    {0x10025D4A, 45183, 45204},
+    {0x10025D4D, 45253, 45253},
+    {0x10025D4F, 45266, 45271},
+    {0x10025D6D, 45253, 45253},
+    {0x1002700F, 45289, 45295},
+    {0x10027010, 39814, 45295},
+    {0x10027109, 45313, 45318},
+    {0x10027142, 45338, 45342},
+    {0x10027145, 45368, 45374},
+    {0x10027146, 45338, 45461},
+    {0x10027149, 45478, 45493},
+    {0x10027183, 45527, 45533},
+    {0x10027186, 45559, 0},
+    {0x10027187, 45581, 45581},
+    {0x100271A1, 40654, 45593},
+    {0x100271A7, 45581, 45606},
+    {0x100271C2, 45628, 45628},
+    {0x100271C5, 45648, 45655},
+    {0x10027249, 39714, 39714},
+    {0x1002724B, 45677, 45690},
+    {0x10027280, 45697, 45714},
+    {0x100272A0, 45751, 45778},
+    {0x10027833, 45815, 45821},
+    {0x1002791F, 45837, 45843},
+    {0x10027942, 45869, 45871},
+    {0x10029400, 45888, 45893},
+    {0x100294C3, 45915, 45921},
+    {0x100294C4, 45915, 45944},
+    {0x10029588, 45971, 45977},
+    {0x10029589, 45971, 45999},
+    {0x10029876, 46022, 46040},
+    {0x1002CAB0, 45289, 46063},
+    {0x1002CAB1, 45289, 46085},
+    {0x1002CAB2, 39814, 37021},
+    {0x1002CBB2, 39814, 37021},
+    {0x10030201, 46109, 36651},
+    {0x10040005, 46116, 46129},
+    {0x10040006, 46140, 36359},
+    {0x10040007, 46147, 46154},
+    {0x10040008, 46180, 46191},
+    {0x10040009, 46210, 0},
+    {0x1004000C, 46222, 0},
+    {0x1004000D, 46229, 0},
+    {0x10040100, 46236, 46245},
+    {0x10040101, 46276, 46283},
+    {0x10040102, 46305, 46312},
+    {0x10040103, 46330, 36999},
+    {0x10040104, 46337, 44487},
+    {0x10040105, 46344, 46351},
+    {0x10040200, 46367, 46374},
+    {0x10040280, 46395, 46374},
+    {0x10040304, 46402, 46410},
+    {0x10040305, 46402, 46444},
+    {0x10040306, 46402, 46470},
+    {0x10040307, 46493, 46502},
+    {0x10040308, 46527, 46529},
+    {0x10040702, 46564, 46573},
+    {0x100B0001, 46588, 46596},
+    {0x100B0002, 46616, 46624},
+    {0x100B000E, 46664, 46672},
+    {0x100B000F, 46694, 46701},
+    {0x100B0011, 46664, 46727},
+    {0x100B0012, 0, 36752},
+    {0x100B001B, 46742, 46749},
+    {0x100B0020, 46780, 46791},
+    {0x100B0021, 46836, 36999},
+    {0x100B0022, 46844, 46854},
+    {0x100B002A, 46888, 46895},
+    {0x100B002D, 46922, 46927},
+    {0x100B002E, 46948, 46964},
+    {0x100B002F, 46982, 36752},
+    {0x100B0030, 375, 46988},
+    {0x100B0500, 47016, 47023},
+    {0x100B0501, 47016, 47043},
+    {0x100B0502, 47063, 47077},
+    {0x100B0503, 47063, 47092},
+    {0x100B0504, 47016, 47104},
+    {0x100B0505, 47016, 47120},
+    {0x100B0510, 47146, 47023},
+    {0x100B0511, 47146, 47043},
+    {0x100B0515, 47146, 47120},
+    {0x100BD001, 47153, 47162},
+    {0x100C3202, 47180, 36651},
+    {0x100C3205, 47193, 36651},
+    {0x100C3206, 47206, 36651},
+    {0x100C3207, 47219, 36651},
+    {0x100C3208, 47232, 47239},
+    {0x100C4702, 47266, 0},
+    {0x100E0564, 47273, 44487},
+    {0x100E55CC, 47273, 47285},
+    {0x100E9000, 47298, 47304},
+    {0x100E9001, 47298, 36651},
+    {0x100E9100, 47332, 36651},
+    {0x10110001, 47338, 47346},
+    {0x10110002, 47361, 47369},
+    {0x10110004, 47392, 47400},
+    {0x10110007, 47425, 47432},
+    {0x10110008, 47439, 47445},
+    {0x10110009, 47466, 47474},
+    {0x1011000A, 47494, 47502},
+    {0x1011000C, 47514, 0},
+    {0x1011000D, 47519, 47524},
+    {0x1011000F, 47535, 47541},
+    {0x10110014, 47546, 47554},
+    {0x10110016, 47582, 12850},
+    {0x10110019, 47588, 47598},
+    {0x10110021, 47636, 47346},
+    {0x10110022, 47647, 47346},
+    {0x10110023, 47658, 46312},
+    {0x10110024, 47666, 47346},
+    {0x10110025, 47676, 47346},
+    {0x10110026, 47682, 47346},
+    {0x10110034, 47688, 47696},
+    {0x10110045, 47704, 46312},
+    {0x10110046, 47712, 47718},
+    {0x10111065, 47736, 47742},
+    {0x10112000, 47779, 47791},
+    {0x10130038, 47825, 47835},
+    {0x10130040, 47839, 47849},
+    {0x1013004C, 47876, 47886},
+    {0x101300A0, 47924, 36651},
+    {0x101300A2, 47934, 47944},
+    {0x101300A4, 47967, 47944},
+    {0x101300A8, 47967, 47944},
+    {0x101300AC, 47977, 47987},
+    {0x101300B8, 48009, 48019},
+    {0x101300BC, 48050, 48060},
+    {0x101300D0, 48089, 48099},
+    {0x101300D4, 48139, 48149},
+    {0x101300D5, 48186, 48196},
+    {0x101300D6, 48206, 48149},
+    {0x101300E8, 48216, 0},
+    {0x10131013, 48227, 48236},
+    {0x10131100, 48280, 48290},
+    {0x10131110, 48318, 48328},
+    {0x10131112, 48354, 48328},
+    {0x10131113, 48364, 48374},
+    {0x10131200, 48402, 48412},
+    {0x10131202, 48435, 48445},
+    {0x10131204, 48468, 48478},
+    {0x10134000, 48501, 48506},
+    {0x10134400, 48533, 48543},
+    {0x10136001, 48569, 48576},
+    {0x10136003, 48623, 48637},
+    {0x10136004, 48669, 48675},
+    {0x10136005, 48716, 48729},
+    {0x10139876, 48763, 48792},
+    {0x10140002, 48826, 48826},
+    {0x10140005, 48837, 46129},
+    {0x10140007, 48847, 46129},
+    {0x1014000A, 48855, 48866},
+    {0x10140017, 0, 37021},
+    {0x10140018, 48883, 48900},
+    {0x1014001B, 48920, 48929},
+    {0x1014001D, 48946, 48954},
+    {0x10140020, 0, 48826},
+    {0x10140022, 48978, 46312},
+    {0x1014002D, 48986, 0},
+    {0x1014002E, 48993, 49014},
+    {0x10140036, 49043, 49053},
+    {0x10140037, 49076, 49088},
+    {0x1014003A, 0, 37021},
+    {0x1014003E, 49127, 49135},
+    {0x10140045, 0, 49154},
+    {0x10140046, 49166, 49171},
+    {0x10140047, 0, 46312},
+    {0x10140048, 0, 46312},
+    {0x10140049, 0, 49192},
+    {0x1014004D, 49216, 49229},
+    {0x1014004E, 0, 49244},
+    {0x1014004F, 0, 49244},
+    {0x10140050, 0, 49244},
+    {0x10140053, 49259, 49267},
+    {0x10140057, 49290, 49298},
+    {0x1014005C, 49314, 49322},
+    {0x1014005D, 49350, 49358},
+    {0x1014007C, 0, 49244},
+    {0x1014007D, 49383, 49229},
+    {0x10140090, 49392, 0},
+    {0x10140095, 49402, 49410},
+    {0x10140096, 0, 49429},
+    {0x101400A1, 49460, 49475},
+    {0x101400A5, 0, 49244},
+    {0x101400A6, 0, 49494},
+    {0x101400B7, 49520, 49528},
+    {0x101400BE, 0, 49556},
+    {0x101400CE, 49579, 49587},
+    {0x101400F9, 49613, 49620},
+    {0x101400FC, 49653, 49660},
+    {0x10140105, 49653, 49674},
+    {0x1014010F, 0, 49688},
+    {0x1014011B, 0, 49729},
+    {0x10140142, 49745, 49751},
+    {0x10140144, 49745, 49774},
+    {0x10140153, 0, 0},
+    {0x10140156, 49798, 49804},
+    {0x10140170, 49822, 49829},
+    {0x10140188, 49859, 37322},
+    {0x101401A2, 49861, 49867},
+    {0x101401A7, 49946, 49954},
+    {0x101401BD, 49972, 49986},
+    {0x101401EF, 50016, 50022},
+    {0x10140246, 0, 0},
+    {0x1014027F, 50042, 50048},
+    {0x1014028C, 50069, 50073},
+    {0x10140295, 50097, 50113},
+    {0x10140297, 50097, 50147},
+    {0x10140302, 0, 50189},
+    {0x1014FFFF, 50207, 49171},
+    {0x10175343, 50214, 50228},
+    {0x10191B10, 50248, 50257},
+    {0x101A0005, 50269, 50274},
+    {0x101A0009, 50295, 50307},
+    {0x101E9010, 50331, 50344},
+    {0x101E9030, 0, 50377},
+    {0x101E9031, 0, 50377},
+    {0x101E9032, 0, 50393},
+    {0x101E9033, 50413, 50418},
+    {0x101E9040, 0, 50434},
+    {0x101E9060, 50450, 50463},
+    {0x101E9063, 50488, 0},
+    {0x10220840, 50496, 50499},
+    {0x10221100, 50571, 50591},
+    {0x10221101, 50571, 50631},
+    {0x10221102, 50571, 50643},
+    {0x10221103, 50571, 50659},
+    {0x10222000, 50681, 50700},
+    {0x10222001, 50736, 50745},
+    {0x10222003, 50785, 50792},
+    {0x10222020, 50813, 50418},
+    {0x10222040, 50822, 50831},
+    {0x10222081, 50851, 50859},
+    {0x10222082, 50884, 50888},
+    {0x1022208F, 50916, 46895},
+    {0x10222093, 50916, 50923},
+    {0x10222094, 50916, 50947},
+    {0x10222095, 50916, 50979},
+    {0x10222096, 51011, 51026},
+    {0x10222097, 50916, 51055},
+    {0x1022209A, 50916, 51081},
+    {0x10223000, 51103, 51109},
+    {0x10225E4B, 51146, 51152},
+    {0x10227004, 51168, 37021},
+    {0x10227006, 51168, 51176},
+    {0x10227007, 51168, 51215},
+    {0x1022700A, 51253, 51262},
+    {0x1022700B, 51253, 51285},
+    {0x1022700C, 51307, 51315},
+    {0x1022700D, 51307, 51347},
+    {0x1022700E, 51374, 51382},
+    {0x1022700F, 51374, 51395},
+    {0x10227400, 51423, 36999},
+    {0x10227401, 51423, 51431},
+    {0x10227403, 51423, 51457},
+    {0x10227404, 51423, 51485},
+    {0x10227408, 51517, 51525},
+    {0x10227409, 51517, 50377},
+    {0x1022740B, 51517, 51540},
+    {0x1022740C, 51517, 36900},
+    {0x10227410, 51557, 51565},
+    {0x10227411, 51557, 51587},
+    {0x10227412, 51557, 36752},
+    {0x10227413, 51557, 51457},
+    {0x10227414, 51557, 51611},
+    {0x10227440, 51639, 51647},
+    {0x10227441, 51639, 50377},
+    {0x10227443, 51639, 51658},
+    {0x10227445, 51639, 51676},
+    {0x10227446, 51639, 40708},
+    {0x10227448, 51639, 37322},
+    {0x10227449, 51639, 36752},
+    {0x10227450, 51687, 51696},
+    {0x10227451, 51687, 51709},
+    {0x10227454, 51722, 51731},
+    {0x10227455, 51722, 44544},
+    {0x10227458, 51749, 51696},
+    {0x10227459, 51749, 51709},
+    {0x10227460, 51758, 37322},
+    {0x10227461, 51758, 51767},
+    {0x10227462, 51758, 50831},
+    {0x10227463, 51758, 51786},
+    {0x10227464, 51758, 51611},
+    {0x10227468, 51758, 51647},
+    {0x10227469, 51758, 51815},
+    {0x1022746A, 51758, 51839},
+    {0x1022746B, 51758, 51658},
+    {0x1022746D, 51860, 51876},
+    {0x1022746E, 51758, 51894},
+    {0x1022756B, 51758, 51906},
+    {0x10230194, 51922, 51929},
+    {0x10232000, 51948, 51958},
+    {0x10232001, 51995, 52024},
+    {0x10232100, 52034, 52044},
+    {0x10232200, 52062, 52072},
+    {0x10238400, 52086, 52100},
+    {0x10238420, 52110, 52119},
+    {0x10238500, 52130, 52136},
+    {0x10238520, 52159, 52199},
+    {0x10238620, 52210, 52224},
+    {0x10238820, 52232, 52246},
+    {0x10239320, 52255, 52264},
+    {0x10239350, 52287, 52264},
+    {0x10239360, 0, 52296},
+    {0x10239382, 52314, 0},
+    {0x10239383, 52324, 0},
+    {0x10239385, 52334, 0},
+    {0x10239386, 52344, 52044},
+    {0x10239388, 52354, 52044},
+    {0x10239397, 52364, 52374},
+    {0x1023939A, 52395, 52044},
+    {0x10239420, 52408, 52417},
+    {0x10239430, 52437, 36651},
+    {0x10239440, 52446, 52455},
+    {0x10239460, 52474, 52264},
+    {0x10239470, 52483, 0},
+    {0x10239520, 52492, 52044},
+    {0x10239525, 52502, 52044},
+    {0x10239540, 52512, 52522},
+    {0x10239660, 52539, 36651},
+    {0x10239680, 52551, 36651},
+    {0x10239682, 52446, 52560},
+    {0x10239683, 52576, 36651},
+    {0x10239685, 52585, 52599},
+    {0x10239750, 52607, 52628},
+    {0x10239753, 52640, 52044},
+    {0x10239754, 52640, 52649},
+    {0x10239759, 52672, 52681},
+    {0x10239783, 52703, 0},
+    {0x10239785, 52712, 0},
+    {0x10239850, 52721, 52739},
+    {0x10239880, 52743, 52757},
+    {0x10239910, 52764, 52232},
+    {0x10239930, 52773, 0},
+    {0x10250028, 52788, 52813},
+    {0x10251435, 52843, 52849},
+    {0x10251445, 52884, 52890},
+    {0x10251449, 52911, 36359},
+    {0x10251451, 52917, 52923},
+    {0x10251461, 52939, 52945},
+    {0x10251489, 52958, 0},
+    {0x10251511, 52964, 0},
+    {0x10251512, 52970, 0},
+    {0x10251513, 52976, 0},
+    {0x10251521, 52982, 46129},
+    {0x10251523, 52988, 36359},
+    {0x10251531, 52994, 51382},
+    {0x10251533, 53000, 53006},
+    {0x10251535, 53023, 53029},
+    {0x10251541, 53046, 53052},
+    {0x10251542, 53086, 53092},
+    {0x10251543, 53113, 53120},
+    {0x10251561, 53151, 53157},
+    {0x10251621, 53169, 53175},
+    {0x10251631, 53207, 53213},
+    {0x10251641, 53246, 53252},
+    {0x10253141, 53284, 36651},
+    {0x10253143, 53290, 36651},
+    {0x10253145, 53296, 36651},
+    {0x10253147, 53302, 36651},
+    {0x10253149, 53308, 36651},
+    {0x10253151, 53314, 36651},
+    {0x10253307, 53320, 53326},
+    {0x10253309, 53341, 53347},
+    {0x10255212, 53360, 0},
+    {0x10255215, 53366, 50377},
+    {0x10255217, 53366, 53372},
+    {0x10255219, 53387, 53372},
+    {0x10255225, 53393, 50377},
+    {0x10255229, 53399, 50377},
+    {0x10255235, 53405, 53372},
+    {0x10255237, 53410, 53416},
+    {0x10255239, 0, 0},
+    {0x10255240, 0, 50377},
+    {0x10255241, 0, 53440},
+    {0x10255242, 0, 53454},
+    {0x10255243, 0, 46312},
+    {0x10255244, 0, 53481},
+    {0x10255247, 53046, 47346},
+    {0x10255427, 0, 45295},
+    {0x10255451, 53504, 53510},
+    {0x10255453, 53546, 53552},
+    {0x10257101, 53590, 53596},
+    {0x10280001, 53632, 53648},
+    {0x10280002, 53689, 53704},
+    {0x10280003, 53731, 53704},
+    {0x10280004, 53731, 53704},
+    {0x10280005, 53689, 53704},
+    {0x10280006, 53689, 53704},
+    {0x10280007, 0, 53746},
+    {0x10280008, 53689, 53768},
+    {0x1028000A, 53689, 53704},
+    {0x1028000C, 0, 53790},
+    {0x1028000D, 40654, 40654},
+    {0x1028000E, 53827, 53832},
+    {0x10280013, 53858, 53704},
+    {0x10280015, 53884, 53909},
+    {0x10280287, 53936, 53953},
+    {0x10281000, 53988, 53998},
+    {0x102A0000, 54044, 54050},
+    {0x102A0010, 54061, 54067},
+    {0x102B0010, 54080, 54086},
+    {0x102B0051, 54098, 54108},
+    {0x102B0518, 54115, 54126},
+    {0x102B0519, 54148, 54158},
+    {0x102B051A, 54181, 54194},
+    {0x102B051B, 54098, 1008},
+    {0x102B051E, 54233, 54244},
+    {0x102B051F, 54252, 54261},
+    {0x102B0520, 54269, 54290},
+    {0x102B0521, 54269, 54290},
+    {0x102B0522, 54304, 54314},
+    {0x102B0525, 54343, 54362},
+    {0x102B0527, 54389, 0},
+    {0x102B0528, 54402, 54411},
+    {0x102B0D10, 54080, 54442},
+    {0x102B1000, 54465, 54474},
+    {0x102B1001, 54465, 54482},
+    {0x102B1525, 54494, 0},
+    {0x102B1527, 54510, 0},
+    {0x102B2007, 54261, 54531},
+    {0x102B2527, 54550, 54559},
+    {0x102B2537, 54571, 54583},
+    {0x102B4536, 54604, 54624},
+    {0x102B6573, 54643, 54649},
+    {0x102B80A0, 54677, 54684},
+    {0x102B9876, 54702, 54710},
+    {0x102C00B8, 54728, 54734},
+    {0x102C00C0, 54774, 54780},
+    {0x102C00D0, 54819, 54825},
+    {0x102C00D8, 54851, 54857},
+    {0x102C00DC, 54887, 36651},
+    {0x102C00E0, 54893, 54899},
+    {0x102C00E4, 54918, 54924},
+    {0x102C00E5, 54959, 54965},
+    {0x102C00F0, 54985, 54991},
+    {0x102C00F4, 54985, 55006},
+    {0x102C00F5, 55021, 54991},
+    {0x102C01E0, 55027, 55033},
+    {0x102C0C30, 55068, 54780},
+    {0x102D50DC, 55074, 55079},
+    {0x102F0009, 55085, 46129},
+    {0x102F000A, 55091, 55098},
+    {0x102F0020, 55110, 55121},
+    {0x102F0030, 55137, 55147},
+    {0x102F0031, 55183, 55190},
+    {0x102F0105, 55233, 55244},
+    {0x102F0106, 55233, 55277},
+    {0x102F0107, 55233, 55304},
+    {0x102F0108, 55233, 55333},
+    {0x102F0180, 55368, 55375},
+    {0x102F0181, 55390, 55397},
+    {0x102F0182, 55429, 55397},
+    {0x10315601, 55436, 55451},
+    {0x10315607, 55466, 55495},
+    {0x10315631, 55550, 0},
+    {0x10316057, 55559, 55579},
+    {0x10330001, 55596, 55605},
+    {0x10330002, 0, 55632},
+    {0x10330003, 0, 49244},
+    {0x10330004, 55651, 55657},
+    {0x10330005, 0, 55672},
+    {0x10330006, 0, 36651},
+    {0x10330007, 0, 55710},
+    {0x10330008, 0, 55731},
+    {0x10330009, 0, 55764},
+    {0x1033001A, 55786, 0},
+    {0x1033001D, 55794, 55803},
+    {0x10330021, 55840, 55848},
+    {0x10330029, 55855, 55868},
+    {0x1033002A, 55883, 55868},
+    {0x1033002F, 55891, 55904},
+    {0x10330035, 55925, 55933},
+    {0x10330036, 55983, 55992},
+    {0x1033003E, 56030, 56039},
+    {0x10330046, 56067, 55868},
+    {0x1033005A, 56080, 56088},
+    {0x10330063, 56095, 56104},
+    {0x10330067, 56145, 56162},
+    {0x10330074, 0, 56199},
+    {0x1033009B, 56215, 0},
+    {0x103300A6, 0, 0},
+    {0x103300BE, 56223, 56230},
+    {0x103300CD, 56258, 56267},
+    {0x103300CE, 56304, 56267},
+    {0x103300E0, 56315, 56326},
+    {0x103300E7, 56350, 56359},
+    {0x103300F2, 56399, 56408},
+    {0x10330520, 55891, 56448},
+    {0x1033284B, 56458, 56458},
+    {0x10360000, 56462, 38275},
+    {0x10390001, 56472, 56479},
+    {0x10390002, 56511, 56516},
+    {0x10390003, 56548, 56516},
+    {0x10390005, 0, 56555},
+    {0x10390006, 56571, 56582},
+    {0x10390008, 56621, 56632},
+    {0x10390009, 56654, 56659},
+    {0x10390016, 56663, 40542},
+    {0x10390018, 56674, 56681},
+    {0x10390180, 56685, 56692},
+    {0x10390191, 56712, 56712},
+    {0x10390200, 56719, 56730},
+    {0x10390204, 56758, 56767},
+    {0x10390205, 56771, 56780},
+    {0x10390300, 56817, 56824},
+    {0x10390305, 56843, 56850},
+    {0x10390315, 56878, 56886},
+    {0x10390325, 56904, 56886},
+    {0x10390330, 56904, 56911},
+    {0x10390406, 56935, 56582},
+    {0x10390496, 56942, 52849},
+    {0x10390530, 56949, 56956},
+    {0x10390540, 56975, 56982},
+    {0x10390550, 57001, 51382},
+    {0x10390596, 57012, 57019},
+    {0x10390597, 57048, 57056},
+    {0x10390601, 57081, 57091},
+    {0x10390620, 57111, 56982},
+    {0x10390630, 57118, 56982},
+    {0x10390635, 57125, 56982},
+    {0x10390640, 57133, 56982},
+    {0x10390645, 57141, 56982},
+    {0x10390646, 57149, 56982},
+    {0x10390648, 57158, 56982},
+    {0x10390649, 57167, 56982},
+    {0x10390650, 57174, 56982},
+    {0x10390651, 57181, 56982},
+    {0x10390655, 57188, 56982},
+    {0x10390656, 44657, 37021},
+    {0x10390658, 57195, 37021},
+    {0x10390659, 57204, 37021},
+    {0x10390660, 0, 56982},
+    {0x10390661, 57213, 37021},
+    {0x10390662, 44657, 37021},
+    {0x10390663, 44657, 37021},
+    {0x10390730, 57222, 56982},
+    {0x10390735, 57230, 56982},
+    {0x10390740, 57238, 37322},
+    {0x10390741, 57246, 37021},
+    {0x10390745, 57253, 56982},
+    {0x10390746, 57260, 56982},
+    {0x10390748, 57267, 37021},
+    {0x10390755, 57274, 56982},
+    {0x10390756, 57283, 37021},
+    {0x10390760, 56548, 57292},
+    {0x10390761, 44657, 57292},
+    {0x10390762, 44657, 57292},
+    {0x10390900, 57320, 57327},
+    {0x10390901, 57354, 57378},
+    {0x10390962, 57409, 51647},
+    {0x10390963, 57416, 36999},
+    {0x10390964, 57423, 51647},
+    {0x10390999, 57430, 57437},
+    {0x10391039, 57503, 57511},
+    {0x10391040, 0, 0},
+    {0x103910EC, 0, 0},
+    {0x10393602, 57524, 47077},
+    {0x10395107, 57534, 57542},
+    {0x10395300, 56975, 57565},
+    {0x10395315, 57569, 36651},
+    {0x10395401, 57580, 57588},
+    {0x10395511, 57604, 57617},
+    {0x10395513, 57048, 57650},
+    {0x10395517, 57669, 37021},
+    {0x10395518, 57677, 57685},
+    {0x10395571, 57705, 57713},
+    {0x10395581, 57731, 57740},
+    {0x10395582, 57751, 36999},
+    {0x10395591, 57759, 57764},
+    {0x10395596, 57772, 57780},
+    {0x10395597, 57503, 57813},
+    {0x10395600, 57832, 56982},
+    {0x10395630, 57118, 56982},
+    {0x10395811, 0, 0},
+    {0x10396204, 57839, 57847},
+    {0x10396205, 57876, 57884},
+    {0x10396225, 57903, 56780},
+    {0x10396236, 57920, 57928},
+    {0x10396300, 57937, 56824},
+    {0x10396306, 57948, 57959},
+    {0x10396325, 57990, 57997},
+    {0x10396326, 58019, 58024},
+    {0x10396330, 58065, 57997},
+    {0x10396972, 0, 0},
+    {0x10397001, 58099, 58107},
+    {0x10397002, 58127, 58135},
+    {0x10397005, 58168, 58177},
+    {0x10397007, 0, 58201},
+    {0x10397012, 58236, 58244},
+    {0x10397013, 58266, 58274},
+    {0x10397015, 58301, 58308},
+    {0x10397016, 58323, 58331},
+    {0x10397018, 58355, 58363},
+    {0x10397019, 57001, 58380},
+    {0x10397300, 58266, 56824},
+    {0x10399876, 58395, 58403},
+    {0x103C1005, 58426, 58433},
+    {0x103C1008, 58446, 58457},
+    {0x103C100A, 58461, 58475},
+    {0x103C1028, 0, 58516},
+    {0x103C1029, 58549, 58560},
+    {0x103C102A, 58594, 58602},
+    {0x103C1030, 58640, 58647},
+    {0x103C1031, 58679, 58689},
+    {0x103C1040, 58711, 58718},
+    {0x103C1041, 58741, 58748},
+    {0x103C1042, 58772, 58779},
+    {0x103C1048, 58804, 0},
+    {0x103C1049, 58808, 0},
+    {0x103C104A, 58814, 0},
+    {0x103C104B, 58820, 0},
+    {0x103C104D, 58824, 58831},
+    {0x103C1064, 58854, 58861},
+    {0x103C10C1, 0, 58887},
+    {0x103C10ED, 58914, 58923},
+    {0x103C1200, 58946, 58953},
+    {0x103C1219, 0, 58964},
+    {0x103C121A, 0, 58998},
+    {0x103C121B, 0, 59024},
+    {0x103C121C, 0, 59058},
+    {0x103C1229, 59089, 59093},
+    {0x103C122A, 59089, 53372},
+    {0x103C122B, 59089, 59112},
+    {0x103C12FA, 59130, 59147},
+    {0x103C2910, 59188, 59195},
+    {0x103C2920, 0, 59213},
+    {0x103C2924, 59233, 59240},
+    {0x103C2925, 59267, 59274},
+    {0x103C2926, 59312, 59319},
+    {0x103C2927, 59357, 59364},
+    {0x103C2940, 59410, 59417},
+    {0x103C3220, 59468, 59473},
+    {0x103C3230, 59505, 59505},
+    {0x103C3302, 45039, 45039},
+    {0x10430675, 59533, 59538},
+    {0x10431969, 0, 0},
+    {0x10441012, 59551, 59558},
+    {0x1044A400, 59570, 59579},
+    {0x1044A500, 0, 37322},
+    {0x1044A501, 0, 59615},
+    {0x1044A511, 59642, 59649},
+    {0x10450005, 0, 0},
+    {0x1045A0F8, 59670, 59677},
+    {0x1045C101, 59696, 36651},
+    {0x1045C178, 59703, 59710},
+    {0x1045C556, 59731, 59738},
+    {0x1045C557, 59744, 59751},
+    {0x1045C558, 59770, 48866},
+    {0x1045C567, 59670, 59777},
+    {0x1045C568, 59670, 59807},
+    {0x1045C569, 59836, 59843},
+    {0x1045C621, 59865, 59872},
+    {0x1045C700, 59897, 59904},
+    {0x1045C701, 59938, 59945},
+    {0x1045C814, 59982, 59989},
+    {0x1045C822, 60030, 60037},
+    {0x1045C824, 60076, 60083},
+    {0x1045C825, 60117, 60135},
+    {0x1045C832, 60153, 60160},
+    {0x1045C861, 60193, 60200},
+    {0x1045C881, 60242, 60249},
+    {0x1045C895, 60284, 0},
+    {0x1045C935, 60291, 60298},
+    {0x1045D568, 60337, 60344},
+    {0x1045D768, 59670, 60374},
+    {0x10480253, 60399, 60406},
+    {0x10480C60, 60423, 60439},
+    {0x10480C71, 60459, 60476},
+    {0x10481000, 60499, 60515},
+    {0x10483000, 60531, 0},
+    {0x10488901, 0, 60546},
+    {0x104A0008, 60561, 60571},
+    {0x104A0009, 60579, 0},
+    {0x104A0010, 60589, 60597},
+    {0x104A0209, 60638, 60658},
+    {0x104A020A, 60678, 51382},
+    {0x104A0210, 60695, 36359},
+    {0x104A021A, 60706, 36359},
+    {0x104A021B, 60726, 36359},
+    {0x104A0228, 60695, 47077},
+    {0x104A0230, 60695, 36752},
+    {0x104A0500, 60743, 60751},
+    {0x104A0981, 0, 58331},
+    {0x104A1746, 60756, 0},
+    {0x104A2774, 60766, 60777},
+    {0x104A3520, 0, 60808},
+    {0x104B1040, 0, 60830},
+    {0x104B8130, 45869, 60854},
+    {0x104C014E, 60868, 60885},
+    {0x104C0500, 60892, 60911},
+    {0x104C0508, 60946, 60955},
+    {0x104C1000, 60991, 0},
+    {0x104C3D04, 61011, 61019},
+    {0x104C3D07, 61028, 61036},
+    {0x104C8000, 61051, 61061},
+    {0x104C8009, 61100, 61110},
+    {0x104C8010, 61150, 61160},
+    {0x104C8011, 61196, 61204},
+    {0x104C8017, 61235, 61204},
+    {0x104C8019, 61243, 61110},
+    {0x104C8020, 61150, 61110},
+    {0x104C8021, 61253, 61266},
+    {0x104C8023, 61307, 61319},
+    {0x104C8024, 61360, 61370},
+    {0x104C8025, 61411, 61420},
+    {0x104C8026, 61462, 61472},
+    {0x104C8027, 61509, 61204},
+    {0x104C8029, 61517, 61529},
+    {0x104C802E, 61574, 61582},
+    {0x104C8033, 61633, 61641},
+    {0x104C8034, 61674, 61683},
+    {0x104C8035, 45338, 61725},
+    {0x104C8038, 61764, 61773},
+    {0x104C803A, 44657, 61808},
+    {0x104C803B, 61849, 61857},
+    {0x104C803C, 61849, 61683},
+    {0x104C803D, 45338, 61891},
+    {0x104C8201, 61948, 61957},
+    {0x104C8204, 61994, 62013},
+    {0x104C8400, 62055, 62064},
+    {0x104C9065, 62097, 62109},
+    {0x104C9066, 62146, 62164},
+    {0x104CA001, 62203, 62211},
+    {0x104CA100, 62230, 62238},
+    {0x104CA102, 62257, 62267},
+    {0x104CA106, 62309, 62109},
+    {0x104CA828, 62321, 47718},
+    {0x104CAC10, 62333, 62341},
+    {0x104CAC11, 62360, 62341},
+    {0x104CAC12, 62373, 62381},
+    {0x104CAC13, 62408, 62416},
+    {0x104CAC15, 62503, 51929},
+    {0x104CAC16, 62512, 62520},
+    {0x104CAC17, 62547, 51929},
+    {0x104CAC18, 62555, 62381},
+    {0x104CAC19, 62563, 62381},
+    {0x104CAC1A, 62571, 62381},
+    {0x104CAC1B, 62579, 62381},
+    {0x104CAC1E, 62587, 62595},
+    {0x104CAC1F, 62617, 62381},
+    {0x104CAC20, 62626, 46312},
+    {0x104CAC21, 62634, 46312},
+    {0x104CAC22, 62642, 49410},
+    {0x104CAC23, 62650, 47718},
+    {0x104CAC28, 62658, 47718},
+    {0x104CAC30, 62555, 62381},
+    {0x104CAC40, 61196, 62381},
+    {0x104CAC41, 61235, 62381},
+    {0x104CAC42, 61509, 62381},
+    {0x104CAC43, 62672, 62381},
+    {0x104CAC44, 62680, 62696},
+    {0x104CAC46, 62735, 62743},
+    {0x104CAC47, 62769, 62779},
+    {0x104CAC50, 62787, 62795},
+    {0x104CAC51, 62822, 62831},
+    {0x104CAC52, 62854, 62381},
+    {0x104CAC53, 62862, 62870},
+    {0x104CAC54, 62924, 62933},
+    {0x104CAC55, 62972, 62743},
+    {0x104CAC56, 62980, 62743},
+    {0x104CAC57, 62988, 62743},
+    {0x104CAC58, 62996, 62743},
+    {0x104CAC59, 63004, 62933},
+    {0x104CAC5A, 63012, 62933},
+    {0x104CAC8E, 61574, 51929},
+    {0x104CAC8F, 63020, 63025},
+    {0x104CFE00, 63036, 63046},
+    {0x104CFE03, 63071, 63046},
+    {0x104D8009, 63078, 63086},
+    {0x104D8039, 63122, 63130},
+    {0x104D8056, 63169, 63176},
+    {0x104D808A, 63199, 58177},
+    {0x104E0017, 63207, 0},
+    {0x104E0107, 63217, 63224},
+    {0x104E0109, 0, 63249},
+    {0x104E0217, 63263, 0},
+    {0x104E0317, 63273, 0},
+    {0x104E0611, 63283, 63291},
+    {0x104F104F, 63297, 63307},
+    {0x10500000, 63317, 63331},
+    {0x10500001, 63371, 63379},
+    {0x10500033, 63398, 63405},
+    {0x10500105, 63453, 63461},
+    {0x10500628, 63478, 63491},
+    {0x10500840, 63513, 63522},
+    {0x10500940, 63553, 63562},
+    {0x10501050, 63583, 63591},
+    {0x10505A5A, 63610, 63619},
+    {0x10506692, 63658, 63673},
+    {0x10509921, 63700, 63709},
+    {0x10509922, 63728, 63736},
+    {0x10509960, 63753, 47502},
+    {0x10509961, 63761, 63769},
+    {0x10509970, 63793, 63801},
+    {0x10509971, 63816, 63816},
+    {0x10540001, 0, 37322},
+    {0x10540002, 0, 63824},
+    {0x10543505, 63839, 63846},
+    {0x10550810, 0, 63885},
+    {0x10550922, 0, 63906},
+    {0x10550926, 63931, 36359},
+    {0x10559130, 63983, 63992},
+    {0x10559460, 63983, 64020},
+    {0x10559461, 63983, 64048},
+    {0x10559462, 63983, 64079},
+    {0x10559463, 63983, 64109},
+    {0x10570001, 64147, 64154},
+    {0x10570002, 64195, 64202},
+    {0x10570003, 64241, 64249},
+    {0x10570004, 64270, 64277},
+    {0x10570006, 64314, 64249},
+    {0x10570100, 64322, 64331},
+    {0x10570431, 64339, 64347},
+    {0x10571801, 64373, 64382},
+    {0x10571802, 64414, 64423},
+    {0x105718C0, 64455, 64467},
+    {0x10573052, 64492, 64497},
+    {0x10573421, 64515, 64536},
+    {0x10574801, 64542, 64548},
+    {0x10574802, 64564, 64571},
+    {0x10574803, 64594, 0},
+    {0x10574806, 64599, 0},
+    {0x10574809, 64607, 64616},
+    {0x10575600, 64635, 64647},
+    {0x10575602, 64492, 64686},
+    {0x10575608, 64696, 64707},
+    {0x10575803, 64727, 64735},
+    {0x10576400, 64769, 64776},
+    {0x105A0D30, 64798, 64808},
+    {0x105A0D38, 64856, 64865},
+    {0x105A1275, 64897, 64906},
+    {0x105A3318, 64935, 64945},
+    {0x105A3319, 64977, 64945},
+    {0x105A3371, 64987, 64997},
+    {0x105A3373, 65033, 65042},
+    {0x105A3375, 65080, 64997},
+    {0x105A3376, 65090, 65099},
+    {0x105A3570, 65123, 65132},
+    {0x105A3571, 65167, 65174},
+    {0x105A3574, 65191, 65200},
+    {0x105A3D17, 65226, 65238},
+    {0x105A3D18, 65262, 65200},
+    {0x105A3D73, 65271, 65280},
+    {0x105A4D30, 65314, 65323},
+    {0x105A4D33, 65348, 65357},
+    {0x105A4D38, 65392, 65401},
+    {0x105A4D68, 65425, 65323},
+    {0x105A4D69, 65434, 65443},
+    {0x105A5275, 65468, 65477},
+    {0x105A5300, 65504, 50377},
+    {0x105A6268, 65511, 65521},
+    {0x105A6269, 65560, 65569},
+    {0x105A6621, 65601, 65614},
+    {0x105A6622, 65630, 65644},
+    {0x105A6629, 0, 65661},
+    {0x105A7275, 65688, 65698},
+    {0x105D2309, 65718, 36651},
+    {0x105D2339, 65730, 65737},
+    {0x105D493D, 65758, 65762},
+    {0x105D5348, 65776, 65776},
+    {0x10600001, 65790, 65799},
+    {0x10600002, 65811, 36359},
+    {0x10600101, 65820, 50377},
+    {0x10600881, 65828, 65835},
+    {0x10600886, 65855, 36359},
+    {0x10600891, 65863, 65872},
+    {0x10601001, 65898, 65905},
+    {0x1060673A, 65932, 50377},
+    {0x1060673B, 0, 65941},
+    {0x10608710, 65957, 65964},
+    {0x10608821, 0, 65975},
+    {0x10608822, 0, 65990},
+    {0x10608851, 0, 66005},
+    {0x10608852, 0, 66028},
+    {0x1060886A, 66051, 66059},
+    {0x10608881, 66080, 65835},
+    {0x10608886, 66088, 66095},
+    {0x1060888A, 66051, 0},
+    {0x10608891, 66124, 66131},
+    {0x10609017, 66143, 66151},
+    {0x10609018, 66160, 66151},
+    {0x10609026, 66167, 66174},
+    {0x1060E881, 65828, 65799},
+    {0x1060E886, 66188, 66196},
+    {0x1060E88A, 66188, 66214},
+    {0x1060E891, 66231, 66239},
+    {0x10610001, 66247, 36651},
+    {0x10610002, 66258, 53347},
+    {0x10658139, 0, 66266},
+    {0x10660000, 66293, 66302},
+    {0x10660001, 66312, 66321},
+    {0x10660002, 66354, 66363},
+    {0x10660003, 66389, 66398},
+    {0x10660004, 66421, 66430},
+    {0x10660005, 66456, 51731},
+    {0x10668002, 66354, 36359},
+    {0x10671002, 66464, 66470},
+    {0x106B0001, 66509, 66516},
+    {0x106B0002, 66540, 53372},
+    {0x106B0003, 66554, 0},
+    {0x106B0004, 66568, 66574},
+    {0x106B0007, 66583, 53372},
+    {0x106B000C, 0, 0},
+    {0x106B000E, 66589, 66595},
+    {0x106B0010, 66614, 66595},
+    {0x106B0017, 66623, 66595},
+    {0x106B0018, 66634, 66643},
+    {0x106B001F, 66634, 66663},
+    {0x106B0020, 66634, 66679},
+    {0x106B0026, 66693, 66700},
+    {0x106B0027, 66693, 66679},
+    {0x106B002D, 66714, 44544},
+    {0x106B002E, 66714, 37322},
+    {0x106B002F, 66714, 66727},
+    {0x106B0030, 66740, 66643},
+    {0x106B003B, 66756, 66765},
+    {0x106B004F, 66791, 66798},
+    {0x106B0050, 66791, 66816},
+    {0x106B0051, 66791, 66830},
+    {0x106B0052, 66791, 66856},
+    {0x106B0053, 66791, 37322},
+    {0x106B0054, 66791, 37322},
+    {0x106B0055, 66791, 37322},
+    {0x106B0058, 66875, 44544},
+    {0x106C8801, 0, 66879},
+    {0x106C8802, 66912, 66921},
+    {0x106C8803, 0, 66949},
+    {0x106C8804, 66982, 66989},
+    {0x106C8805, 0, 67008},
+    {0x106E4362, 67033, 67041},
+    {0x10730001, 0, 67090},
+    {0x10730002, 67109, 67116},
+    {0x10730003, 67144, 0},
+    {0x10730004, 67153, 67161},
+    {0x10730005, 67182, 67186},
+    {0x10730006, 67182, 67186},
+    {0x10730008, 67182, 67186},
+    {0x1073000A, 67196, 67203},
+    {0x1073000C, 67230, 67238},
+    {0x1073000D, 67265, 67273},
+    {0x10730010, 67301, 67311},
+    {0x10730012, 67153, 67337},
+    {0x10730020, 67364, 67368},
+    {0x10731000, 67379, 67388},
+    {0x10732000, 67401, 67408},
+    {0x10744E78, 67428, 67437},
+    {0x10771016, 67451, 67460},
+    {0x10771020, 67497, 67512},
+    {0x10771022, 67539, 38182},
+    {0x10771080, 67548, 67556},
+    {0x10771216, 67574, 67583},
+    {0x10771240, 67618, 67556},
+    {0x10771280, 67626, 67556},
+    {0x10772020, 67634, 67643},
+    {0x10772100, 67667, 67675},
+    {0x10772200, 67704, 67712},
+    {0x10772300, 67738, 67747},
+    {0x10772312, 67772, 39114},
+    {0x10772422, 67781, 67789},
+    {0x10772432, 67842, 67850},
+    {0x10773010, 56458, 56458},
+    {0x10774000, 0, 0},
+    {0x10774010, 0, 0},
+    {0x10776422, 67893, 67900},
+    {0x10776432, 67978, 67985},
+    {0x10780000, 68051, 36359},
+    {0x10780001, 68058, 68071},
+    {0x10780002, 68051, 36359},
+    {0x10780100, 68092, 68099},
+    {0x10780101, 68092, 68110},
+    {0x10780102, 68092, 47077},
+    {0x10780103, 68092, 47092},
+    {0x10780104, 68092, 68136},
+    {0x10780400, 36892, 37021},
+    {0x10780401, 36892, 51457},
+    {0x10780402, 36892, 47077},
+    {0x10780403, 36892, 68153},
+    {0x10790D01, 0, 0},
+    {0x107D0000, 68167, 68175},
+    {0x107E0001, 68193, 68201},
+    {0x107E0002, 0, 68238},
+    {0x107E0004, 68259, 68264},
+    {0x107E0005, 68291, 68264},
+    {0x107E0008, 68296, 68316},
+    {0x107E9003, 68352, 0},
+    {0x107E9007, 68367, 0},
+    {0x107E9008, 68381, 0},
+    {0x107E900C, 68392, 0},
+    {0x107E900E, 68406, 0},
+    {0x107E9011, 68419, 0},
+    {0x107E9013, 68431, 0},
+    {0x107E9023, 68352, 0},
+    {0x107E9027, 68443, 0},
+    {0x107E9031, 68419, 0},
+    {0x107E9033, 68457, 68469},
+    {0x107E9060, 68477, 68482},
+    {0x107E9070, 68522, 68527},
+    {0x107E9080, 68566, 68579},
+    {0x107E9081, 68619, 68579},
+    {0x107E9082, 68632, 68579},
+    {0x107E9090, 68645, 68659},
+    {0x107E90A0, 68699, 68704},
+    {0x107F0802, 68743, 68752},
+    {0x107F0803, 0, 68763},
+    {0x107F0806, 0, 50377},
+    {0x107F2015, 0, 50377},
+    {0x10800600, 68790, 52849},
+    {0x1080C691, 68799, 0},
+    {0x1080C693, 68817, 36999},
+    {0x10810D47, 68824, 68829},
+    {0x10830001, 68856, 68862},
+    {0x10830613, 0, 44487},
+    {0x10850001, 68887, 68894},
+    {0x10879200, 0, 0},
+    {0x108A0001, 68934, 68944},
+    {0x108A0010, 68964, 68974},
+    {0x108A0040, 68985, 0},
+    {0x108A3000, 68998, 68974},
+    {0x108D0001, 69009, 69020},
+    {0x108D0002, 69048, 69057},
+    {0x108D0004, 69098, 69109},
+    {0x108D0005, 69143, 69151},
+    {0x108D0006, 69182, 69190},
+    {0x108D0007, 69223, 69109},
+    {0x108D0008, 69231, 69239},
+    {0x108D000A, 69271, 69279},
+    {0x108D0011, 69317, 50831},
+    {0x108D0012, 69325, 69333},
+    {0x108D0013, 69367, 69378},
+    {0x108D0014, 69405, 69333},
+    {0x108D0019, 69413, 69424},
+    {0x108D0021, 69451, 69462},
+    {0x108D0022, 0, 69483},
+    {0x108E0001, 69495, 0},
+    {0x108E1000, 69506, 69511},
+    {0x108E1001, 69506, 69539},
+    {0x108E1100, 69559, 0},
+    {0x108E1101, 69568, 0},
+    {0x108E1102, 69576, 0},
+    {0x108E1103, 69585, 0},
+    {0x108E2BAD, 69593, 69597},
+    {0x108E5000, 69623, 69631},
+    {0x108E5043, 69666, 69673},
+    {0x108E7063, 69686, 69693},
+    {0x108E8000, 69730, 69741},
+    {0x108E8001, 69768, 69775},
+    {0x108EA000, 69790, 69805},
+    {0x108EA001, 69811, 69826},
+    {0x108EABBA, 69838, 69860},
+    {0x10910020, 0, 69889},
+    {0x10910021, 0, 69911},
+    {0x10910040, 0, 69945},
+    {0x10910041, 0, 69945},
+    {0x10910060, 0, 69970},
+    {0x109100E4, 69993, 0},
+    {0x10910720, 0, 70010},
+    {0x109200A0, 70028, 36651},
+    {0x109200A8, 70045, 36651},
+    {0x10920550, 70058, 0},
+    {0x109208D4, 70069, 70080},
+    {0x1092094C, 70089, 70089},
+    {0x109209C8, 70110, 70118},
+    {0x10921002, 70143, 70152},
+    {0x10921092, 70161, 0},
+    {0x10926120, 70172, 70180},
+    {0x10928810, 70184, 36651},
+    {0x10928811, 70195, 36651},
+    {0x10928880, 70209, 0},
+    {0x10928881, 70209, 36651},
+    {0x109288B0, 70223, 36651},
+    {0x109288B1, 70223, 36651},
+    {0x109288C0, 70240, 36651},
+    {0x109288C1, 70240, 36651},
+    {0x109288D0, 70240, 36651},
+    {0x109288D1, 70240, 36651},
+    {0x109288F0, 70223, 36651},
+    {0x109288F1, 70223, 36651},
+    {0x10929876, 0, 70251},
+    {0x10929999, 70279, 70293},
+    {0x10930160, 70319, 70330},
+    {0x10930161, 70364, 70373},
+    {0x10930162, 70410, 70426},
+    {0x10931150, 70440, 70453},
+    {0x10931170, 70482, 0},
+    {0x10931180, 70498, 0},
+    {0x10931190, 70512, 0},
+    {0x109311B0, 0, 0},
+    {0x109311C0, 0, 0},
+    {0x109311D0, 0, 0},
+    {0x109311E0, 0, 0},
+    {0x10931270, 70526, 70536},
+    {0x109312B0, 70572, 70581},
+    {0x10931310, 70596, 70605},
+    {0x10931320, 0, 0},
+    {0x10931330, 70629, 0},
+    {0x10931340, 70639, 70536},
+    {0x10931350, 70649, 70659},
+    {0x10931360, 0, 0},
+    {0x109317D0, 70704, 0},
+    {0x109318B0, 0, 0},
+    {0x109328B0, 70713, 70721},
+    {0x10932A60, 70763, 0},
+    {0x10932A70, 70773, 70536},
+    {0x10932A80, 70783, 70536},
+    {0x10932B20, 0, 0},
+    {0x10932C80, 70793, 0},
+    {0x10932CA0, 0, 0},
+    {0x109370AF, 70803, 70812},
+    {0x1093B001, 70847, 0},
+    {0x1093B011, 70861, 0},
+    {0x1093B021, 70875, 0},
+    {0x1093B031, 70889, 0},
+    {0x1093B041, 70903, 0},
+    {0x1093B051, 70917, 0},
+    {0x1093B061, 70931, 0},
+    {0x1093B071, 70945, 0},
+    {0x1093B081, 70959, 0},
+    {0x1093B091, 70973, 0},
+    {0x1093C801, 70987, 70996},
+    {0x1093C811, 0, 0},
+    {0x1093C821, 0, 0},
+    {0x1093C831, 0, 0},
+    {0x1093C840, 0, 0},
+    {0x1093D130, 71028, 71038},
+    {0x10950640, 71075, 68752},
+    {0x10950641, 71086, 71094},
+    {0x10950642, 71123, 71131},
+    {0x10950643, 71151, 71159},
+    {0x10950646, 71179, 71187},
+    {0x10950647, 71202, 71210},
+    {0x10950648, 71215, 71223},
+    {0x10950649, 71261, 71269},
+    {0x10950650, 71309, 71318},
+    {0x10950670, 71337, 71345},
+    {0x10950673, 71353, 71361},
+    {0x10950680, 71374, 71383},
+    {0x10952455, 71412, 71419},
+    {0x10953112, 71457, 71466},
+    {0x10953114, 71495, 71466},
+    {0x10953124, 71504, 71513},
+    {0x10953132, 71544, 71553},
+    {0x10953512, 71588, 71466},
+    {0x10953531, 71597, 71602},
+    {0x10961106, 71627, 71634},
+    {0x10970038, 0, 71652},
+    {0x10980001, 71682, 50377},
+    {0x10980002, 71689, 50377},
+    {0x109E0350, 71696, 71706},
+    {0x109E0351, 71756, 71767},
+    {0x109E0369, 71775, 71781},
+    {0x109E036C, 71795, 71809},
+    {0x109E036E, 71814, 71819},
+    {0x109E036F, 71834, 71781},
+    {0x109E0370, 71843, 71849},
+    {0x109E0878, 71889, 71939},
+    {0x109E0879, 71956, 71965},
+    {0x109E0880, 71843, 71965},
+    {0x109E109E, 71995, 72005},
+    {0x109E2115, 72009, 72027},
+    {0x109E2125, 72057, 72066},
+    {0x109E2164, 72093, 72102},
+    {0x109E2165, 72118, 72127},
+    {0x109E8230, 72150, 72159},
+    {0x109E8472, 72199, 72209},
+    {0x109E8474, 72240, 72247},
+    {0x10A45969, 0, 0},
+    {0x10A80000, 40654, 72275},
+    {0x10A90004, 72298, 0},
+    {0x10A90005, 72306, 0},
+    {0x10A90006, 72316, 0},
+    {0x10A90007, 72322, 0},
+    {0x10A90008, 72328, 0},
+    {0x10A90009, 16685, 72337},
+    {0x10A90010, 1315, 72354},
+    {0x10A90011, 72364, 0},
+    {0x10A90012, 72369, 0},
+    {0x10A91001, 72383, 0},
+    {0x10A91002, 72396, 0},
+    {0x10A91003, 72404, 0},
+    {0x10A91004, 72416, 0},
+    {0x10A91005, 72428, 0},
+    {0x10A91006, 72440, 0},
+    {0x10A91007, 72452, 0},
+    {0x10A91008, 72464, 0},
+    {0x10A92001, 0, 72471},
+    {0x10A92002, 72485, 0},
+    {0x10A98001, 72490, 0},
+    {0x10A98002, 72498, 0},
+    {0x10AB1005, 72507, 72560},
+    {0x10AD0001, 63371, 68752},
+    {0x10AD0103, 72574, 72583},
+    {0x10AD0105, 72607, 72615},
+    {0x10AD0565, 72652, 72661},
+    {0x10B50324, 0, 0},
+    {0x10B50480, 72676, 72684},
+    {0x10B50960, 72717, 72733},
+    {0x10B51030, 72771, 72782},
+    {0x10B51054, 72792, 72803},
+    {0x10B51078, 72826, 72835},
+    {0x10B51103, 72826, 72864},
+    {0x10B51146, 72826, 72893},
+    {0x10B51147, 72826, 72923},
+    {0x10B51151, 72953, 72782},
+    {0x10B51152, 72953, 72782},
+    {0x10B52724, 0, 72964},
+    {0x10B53001, 72990, 72998},
+    {0x10B55406, 73006, 73023},
+    {0x10B56520, 73065, 73073},
+    {0x10B58111, 73095, 73104},
+    {0x10B58516, 73130, 73139},
+    {0x10B58532, 73168, 73139},
+    {0x10B59030, 73177, 73186},
+    {0x10B59036, 73217, 73225},
+    {0x10B59050, 72826, 73251},
+    {0x10B59052, 73288, 73297},
+    {0x10B59054, 73336, 73345},
+    {0x10B59060, 73365, 73373},
+    {0x10B5906D, 73403, 73373},
+    {0x10B5906E, 73414, 73373},
+    {0x10B59080, 73425, 73434},
+    {0x10B60001, 73473, 73484},
+    {0x10B60002, 73473, 73501},
+    {0x10B60003, 73473, 73527},
+    {0x10B60004, 0, 73536},
+    {0x10B60006, 0, 73569},
+    {0x10B60007, 73599, 0},
+    {0x10B60009, 0, 73610},
+    {0x10B6000A, 0, 73641},
+    {0x10B6000B, 0, 73669},
+    {0x10B61000, 73695, 73703},
+    {0x10B61001, 73715, 73703},
+    {0x10B61002, 73715, 69483},
+    {0x10B70001, 73726, 73732},
+    {0x10B71000, 73761, 73774},
+    {0x10B71006, 73814, 73824},
+    {0x10B71007, 73880, 73886},
+    {0x10B71700, 73906, 73912},
+    {0x10B71F1F, 73939, 73949},
+    {0x10B73390, 73982, 73988},
+    {0x10B73590, 74008, 74014},
+    {0x10B74500, 74044, 7426},
+    {0x10B75055, 74050, 74056},
+    {0x10B75057, 74073, 74079},
+    {0x10B75157, 74116, 74079},
+    {0x10B75257, 74123, 74134},
+    {0x10B75900, 74172, 74178},
+    {0x10B75920, 74204, 74210},
+    {0x10B75950, 74239, 74245},
+    {0x10B75951, 74239, 74267},
+    {0x10B75952, 74239, 74289},
+    {0x10B75970, 74312, 74318},
+    {0x10B75B57, 74239, 74345},
+    {0x10B76055, 73880, 74374},
+    {0x10B76056, 74411, 74423},
+    {0x10B76560, 74473, 74482},
+    {0x10B76561, 74506, 74513},
+    {0x10B76562, 74550, 74482},
+    {0x10B76563, 74560, 74513},
+    {0x10B76564, 74550, 74482},
+    {0x10B76565, 74568, 74579},
+    {0x10B77646, 74617, 74631},
+    {0x10B77770, 44657, 74641},
+    {0x10B78811, 0, 74665},
+    {0x10B79000, 74676, 74686},
+    {0x10B79001, 74713, 74725},
+    {0x10B79004, 74676, 74757},
+    {0x10B79005, 74779, 74792},
+    {0x10B79006, 74824, 74835},
+    {0x10B7900A, 74852, 74862},
+    {0x10B79050, 74886, 74901},
+    {0x10B79051, 74930, 74939},
+    {0x10B79055, 74964, 74973},
+    {0x10B79056, 75006, 75016},
+    {0x10B79058, 75041, 75054},
+    {0x10B7905A, 75092, 75102},
+    {0x10B79200, 75131, 75145},
+    {0x10B79201, 75182, 75193},
+    {0x10B79202, 75182, 75229},
+    {0x10B79210, 75261, 75193},
+    {0x10B79300, 75276, 75290},
+    {0x10B79800, 75306, 75315},
+    {0x10B79805, 75306, 75349},
+    {0x10B79902, 75375, 75388},
+    {0x10B79903, 75428, 75388},
+    {0x10B79905, 75441, 75451},
+    {0x10B79908, 75478, 75490},
+    {0x10B79909, 75527, 75490},
+    {0x10B7D004, 75539, 75550},
+    {0x10B80005, 75567, 75583},
+    {0x10B80006, 75623, 75633},
+    {0x10B81000, 75674, 75681},
+    {0x10B81001, 75685, 75681},
+    {0x10B8A011, 75692, 75701},
+    {0x10B8B106, 75726, 51929},
+    {0x10B90101, 75735, 75748},
+    {0x10B90102, 75735, 75748},
+    {0x10B90111, 75771, 75784},
+    {0x10B90780, 44657, 75811},
+    {0x10B90782, 44657, 75811},
+    {0x10B910B9, 75825, 75838},
+    {0x10B91435, 52843, 66302},
+    {0x10B91445, 52884, 75861},
+    {0x10B91449, 52911, 36359},
+    {0x10B91451, 52917, 75903},
+    {0x10B91461, 52939, 52945},
+    {0x10B91489, 52958, 57588},
+    {0x10B91511, 52964, 75929},
+    {0x10B91513, 52976, 75951},
+    {0x10B91521, 52982, 75974},
+    {0x10B91523, 52988, 36359},
+    {0x10B91533, 75979, 53029},
+    {0x10B91535, 75986, 36359},
+    {0x10B91541, 53046, 75993},
+    {0x10B91543, 76022, 76031},
+    {0x10B91561, 53151, 51382},
+    {0x10B91563, 76062, 76068},
+    {0x10B91632, 76109, 51382},
+    {0x10B91641, 53246, 37021},
+    {0x10B91644, 76115, 76121},
+    {0x10B91646, 76143, 76121},
+    {0x10B91647, 76149, 37021},
+    {0x10B91651, 76155, 37021},
+    {0x10B91661, 76161, 76121},
+    {0x10B91667, 76167, 76121},
+    {0x10B91671, 76173, 76179},
+    {0x10B91672, 76201, 76121},
+    {0x10B91681, 76207, 76213},
+    {0x10B91687, 76249, 76255},
+    {0x10B93141, 53284, 36651},
+    {0x10B93143, 53290, 36651},
+    {0x10B93145, 53296, 36651},
+    {0x10B93147, 53302, 36651},
+    {0x10B93149, 53308, 36651},
+    {0x10B93151, 53314, 36651},
+    {0x10B93307, 53320, 53326},
+    {0x10B93309, 53341, 53347},
+    {0x10B93432, 76291, 76300},
+    {0x10B95212, 53360, 0},
+    {0x10B95215, 76307, 68752},
+    {0x10B95217, 76314, 76321},
+    {0x10B95219, 76329, 76335},
+    {0x10B95225, 53393, 47077},
+    {0x10B95228, 76370, 76376},
+    {0x10B95229, 76396, 50377},
+    {0x10B95235, 53169, 53372},
+    {0x10B95236, 76414, 76420},
+    {0x10B95237, 76433, 76461},
+    {0x10B95239, 76485, 76494},
+    {0x10B95249, 76517, 76523},
+    {0x10B95251, 76552, 76558},
+    {0x10B95253, 76592, 76558},
+    {0x10B95261, 76598, 50831},
+    {0x10B95281, 76604, 76610},
+    {0x10B95287, 76642, 76651},
+    {0x10B95450, 0, 76671},
+    {0x10B95451, 53504, 76696},
+    {0x10B95455, 76718, 40362},
+    {0x10B95457, 76737, 76744},
+    {0x10B95459, 76766, 76785},
+    {0x10B95461, 76815, 40746},
+    {0x10B95471, 76718, 76818},
+    {0x10B95473, 76718, 76836},
+    {0x10B97101, 53590, 51457},
+    {0x10B97471, 76718, 76818},
+    {0x10B99876, 76854, 76862},
+    {0x10BA0304, 0, 36651},
+    {0x10BD0803, 76875, 76926},
+    {0x10BD0E34, 76947, 76952},
+    {0x10BD5240, 76988, 76993},
+    {0x10BD5241, 0, 53440},
+    {0x10BD5242, 0, 77004},
+    {0x10BD5243, 77027, 77036},
+    {0x10BD5244, 0, 77047},
+    {0x10BD8139, 77058, 77108},
+    {0x10C80000, 0, 77122},
+    {0x10C80003, 77138, 77145},
+    {0x10C80004, 77179, 77186},
+    {0x10C80005, 77203, 77210},
+    {0x10C80006, 77227, 77234},
+    {0x10C80016, 77258, 77265},
+    {0x10C80025, 77283, 77290},
+    {0x10C80083, 77308, 77315},
+    {0x10C88005, 77203, 77360},
+    {0x10C88006, 77227, 77390},
+    {0x10C88016, 77258, 77420},
+    {0x10CD1100, 77451, 77459},
+    {0x10CD1200, 77481, 77489},
+    {0x10CD1300, 77502, 77502},
+    {0x10CD2300, 77512, 77521},
+    {0x10CD2500, 77554, 77570},
+    {0x10CD4000, 77604, 77615},
+    {0x10CF10C5, 77645, 77653},
+    {0x10CF2001, 77674, 77682},
+    {0x10CF2002, 77723, 77731},
+    {0x10CF2005, 77757, 77765},
+    {0x10CF200C, 77757, 77794},
+    {0x10CF2010, 0, 77822},
+    {0x10CF2011, 0, 77847},
+    {0x10CF2019, 77887, 77895},
+    {0x10CF201E, 77917, 77925},
+    {0x10D6FF51, 77948, 77955},
+    {0x10D90066, 77963, 77972},
+    {0x10D90512, 77977, 77985},
+    {0x10D90531, 78007, 78018},
+    {0x10D90532, 78059, 78071},
+    {0x10D90553, 78108, 63461},
+    {0x10D98625, 78116, 78124},
+    {0x10D98626, 78138, 0},
+    {0x10D98627, 78138, 0},
+    {0x10D98888, 78116, 78146},
+    {0x10D9C115, 78152, 0},
+    {0x10DC0001, 78161, 78171},
+    {0x10DC0002, 78195, 78213},
+    {0x10DC0004, 78244, 78253},
+    {0x10DC0010, 78268, 78285},
+    {0x10DC0011, 78320, 78337},
+    {0x10DC0012, 78372, 78381},
+    {0x10DC0021, 0, 78419},
+    {0x10DC0022, 0, 78437},
+    {0x10DC0033, 78450, 78469},
+    {0x10DC0101, 78504, 78520},
+    {0x10DC016A, 78569, 78579},
+    {0x10DC0324, 78590, 78603},
+    {0x10DC10DC, 78195, 78640},
+    {0x10DD0001, 0, 78677},
+    {0x10DE0001, 78699, 78713},
+    {0x10DE0008, 78747, 78751},
+    {0x10DE0009, 78747, 78751},
+    {0x10DE0010, 78759, 78763},
+    {0x10DE0018, 78774, 78778},
+    {0x10DE0019, 78774, 78787},
+    {0x10DE0020, 78798, 78802},
+    {0x10DE0028, 78811, 78815},
+    {0x10DE0029, 78811, 78831},
+    {0x10DE002A, 78811, 78842},
+    {0x10DE002B, 78811, 78847},
+    {0x10DE002C, 78857, 78861},
+    {0x10DE002D, 78811, 78876},
+    {0x10DE002E, 78910, 78914},
+    {0x10DE002F, 78910, 78914},
+    {0x10DE0040, 78920, 78927},
+    {0x10DE0041, 78946, 78953},
+    {0x10DE0042, 78966, 78973},
+    {0x10DE0043, 78988, 78995},
+    {0x10DE0045, 79007, 79014},
+    {0x10DE0049, 79030, 44657},
+    {0x10DE004E, 79030, 79037},
+    {0x10DE0053, 79052, 47077},
+    {0x10DE0054, 79052, 47077},
+    {0x10DE0055, 79052, 47077},
+    {0x10DE0057, 79072, 79086},
+    {0x10DE0059, 79116, 79131},
+    {0x10DE0060, 79151, 36359},
+    {0x10DE0064, 79163, 40542},
+    {0x10DE0065, 79151, 50377},
+    {0x10DE0066, 79163, 79176},
+    {0x10DE0067, 79151, 79221},
+    {0x10DE0068, 79151, 79244},
+    {0x10DE0069, 79268, 79281},
+    {0x10DE006A, 79151, 79310},
+    {0x10DE006B, 79332, 79346},
+    {0x10DE006C, 79384, 46312},
+    {0x10DE006D, 79163, 79310},
+    {0x10DE006E, 79151, 79391},
+    {0x10DE008C, 79427, 79437},
+    {0x10DE0092, 79481, 79497},
+    {0x10DE009C, 79512, 79518},
+    {0x10DE009D, 40654, 79533},
+    {0x10DE00A0, 78811, 79559},
+    {0x10DE00C0, 79572, 79579},
+    {0x10DE00C1, 79586, 79593},
+    {0x10DE00C2, 79613, 44657},
+    {0x10DE00C8, 79620, 79625},
+    {0x10DE00C9, 79620, 79644},
+    {0x10DE00CC, 79620, 79669},
+    {0x10DE00CD, 79687, 79694},
+    {0x10DE00CE, 79687, 79718},
+    {0x10DE00D0, 79739, 51647},
+    {0x10DE00D1, 79739, 44487},
+    {0x10DE00D2, 79748, 47718},
+    {0x10DE00D4, 79758, 40542},
+    {0x10DE00D5, 79770, 79783},
+    {0x10DE00D6, 79770, 79815},
+    {0x10DE00D7, 79770, 79837},
+    {0x10DE00D8, 79770, 79865},
+    {0x10DE00D9, 79739, 79901},
+    {0x10DE00DA, 16384, 78713},
+    {0x10DE00DD, 79770, 47718},
+    {0x10DE00DF, 79929, 79945},
+    {0x10DE00E0, 79961, 79973},
+    {0x10DE00E1, 79961, 79994},
+    {0x10DE00E2, 79961, 51262},
+    {0x10DE00E3, 80010, 80018},
+    {0x10DE00E4, 79961, 80040},
+    {0x10DE00E5, 79961, 80062},
+    {0x10DE00E7, 79961, 80086},
+    {0x10DE00E8, 79961, 80109},
+    {0x10DE00EA, 79961, 79310},
+    {0x10DE00ED, 79961, 47346},
+    {0x10DE00F0, 80140, 44657},
+    {0x10DE00F1, 80147, 80157},
+    {0x10DE00F2, 80177, 80182},
+    {0x10DE00F6, 79620, 80195},
+    {0x10DE00F8, 80140, 80210},
+    {0x10DE00F9, 80140, 80237},
+    {0x10DE00FA, 80254, 80263},
+    {0x10DE00FB, 80280, 80289},
+    {0x10DE00FC, 80306, 80315},
+    {0x10DE00FD, 80332, 80341},
+    {0x10DE00FE, 80332, 80362},
+    {0x10DE00FF, 80377, 80386},
+    {0x10DE0100, 80403, 80408},
+    {0x10DE0101, 80403, 80420},
+    {0x10DE0102, 80403, 80436},
+    {0x10DE0103, 80454, 80461},
+    {0x10DE0110, 80485, 80490},
+    {0x10DE0111, 80511, 80519},
+    {0x10DE0112, 44657, 80553},
+    {0x10DE0113, 80595, 80602},
+    {0x10DE0141, 80177, 80624},
+    {0x10DE0145, 80177, 80644},
+    {0x10DE014E, 80177, 80667},
+    {0x10DE014F, 80177, 80688},
+    {0x10DE0150, 80708, 80713},
+    {0x10DE0151, 80732, 80741},
+    {0x10DE0152, 80753, 80760},
+    {0x10DE0153, 80789, 80796},
+    {0x10DE0161, 80808, 80813},
+    {0x10DE0162, 80837, 80843},
+    {0x10DE0164, 80837, 80869},
+    {0x10DE0165, 80888, 80895},
+    {0x10DE016A, 80910, 80933},
+    {0x10DE0170, 80937, 80944},
+    {0x10DE0171, 80937, 80960},
+    {0x10DE0172, 80976, 80983},
+    {0x10DE0173, 80999, 81006},
+    {0x10DE0174, 81025, 81031},
+    {0x10DE0175, 81025, 81052},
+    {0x10DE0176, 81025, 81068},
+    {0x10DE0177, 81025, 81088},
+    {0x10DE0178, 81104, 81113},
+    {0x10DE0179, 81025, 81133},
+    {0x10DE017A, 81153, 81162},
+    {0x10DE017B, 81182, 81191},
+    {0x10DE017C, 81025, 81207},
+    {0x10DE0181, 81224, 81230},
+    {0x10DE0182, 81262, 81269},
+    {0x10DE0183, 81297, 81304},
+    {0x10DE0185, 81332, 81339},
+    {0x10DE0186, 81356, 81362},
+    {0x10DE0187, 81378, 81384},
+    {0x10DE018A, 81400, 81411},
+    {0x10DE018D, 81356, 81362},
+    {0x10DE0191, 81433, 81437},
+    {0x10DE0193, 81433, 81459},
+    {0x10DE019D, 81433, 81483},
+    {0x10DE019E, 81433, 81505},
+    {0x10DE01A0, 81526, 81536},
+    {0x10DE01A4, 79384, 81565},
+    {0x10DE01A5, 79384, 81565},
+    {0x10DE01A6, 79384, 81565},
+    {0x10DE01A8, 81580, 81591},
+    {0x10DE01A9, 81615, 81591},
+    {0x10DE01AA, 81626, 81641},
+    {0x10DE01AB, 81665, 81641},
+    {0x10DE01AC, 81684, 81703},
+    {0x10DE01AD, 81684, 81703},
+    {0x10DE01B0, 81721, 79346},
+    {0x10DE01B1, 81721, 79310},
+    {0x10DE01B2, 79384, 81732},
+    {0x10DE01B4, 81721, 40542},
+    {0x10DE01B7, 79384, 44544},
+    {0x10DE01B8, 79384, 37322},
+    {0x10DE01BC, 81721, 40470},
+    {0x10DE01C1, 81721, 40708},
+    {0x10DE01C2, 81721, 81746},
+    {0x10DE01C3, 81721, 81766},
+    {0x10DE01D7, 45039, 81785},
+    {0x10DE01DC, 81808, 81831},
+    {0x10DE01DD, 81853, 40654},
+    {0x10DE01E0, 80010, 81565},
+    {0x10DE01E1, 80010, 81565},
+    {0x10DE01E8, 80010, 51262},
+    {0x10DE01EA, 80010, 81860},
+    {0x10DE01EB, 80010, 81880},
+    {0x10DE01EC, 80010, 81900},
+    {0x10DE01ED, 80010, 81920},
+    {0x10DE01EE, 80010, 81940},
+    {0x10DE01EF, 80010, 81960},
+    {0x10DE0200, 81980, 81985},
+    {0x10DE0201, 78759, 81994},
+    {0x10DE0202, 82010, 82017},
+    {0x10DE0203, 82033, 82041},
+    {0x10DE0241, 82052, 82061},
+    {0x10DE0247, 82124, 82132},
+    {0x10DE0250, 82139, 82144},
+    {0x10DE0251, 82161, 82168},
+    {0x10DE0253, 82184, 82203},
+    {0x10DE0258, 82227, 82236},
+    {0x10DE0259, 82252, 82261},
+    {0x10DE025B, 82277, 82286},
+    {0x10DE0264, 82302, 82328},
+    {0x10DE0268, 82364, 82368},
+    {0x10DE026C, 82404, 82409},
+    {0x10DE0280, 82424, 82431},
+    {0x10DE0281, 82448, 82455},
+    {0x10DE0282, 82484, 82491},
+    {0x10DE0286, 44657, 82511},
+    {0x10DE0288, 82528, 82537},
+    {0x10DE0289, 82553, 82562},
+    {0x10DE028C, 82578, 82585},
+    {0x10DE0291, 82602, 82609},
+    {0x10DE029C, 82636, 82640},
+    {0x10DE029D, 82636, 82662},
+    {0x10DE02A0, 82677, 82682},
+    {0x10DE02E0, 44657, 82706},
+    {0x10DE0300, 82722, 82729},
+    {0x10DE0301, 82740, 82747},
+    {0x10DE0302, 82769, 82776},
+    {0x10DE0308, 82792, 82801},
+    {0x10DE0309, 82816, 82825},
+    {0x10DE030A, 82840, 82847},
+    {0x10DE0311, 82859, 82866},
+    {0x10DE0312, 82888, 82895},
+    {0x10DE0313, 82911, 44657},
+    {0x10DE0314, 82917, 82922},
+    {0x10DE0318, 82940, 44657},
+    {0x10DE0319, 82949, 44657},
+    {0x10DE031A, 82958, 82965},
+    {0x10DE031B, 82979, 82985},
+    {0x10DE031C, 83010, 83016},
+    {0x10DE0321, 83039, 83046},
+    {0x10DE0322, 83068, 83075},
+    {0x10DE0323, 83091, 83098},
+    {0x10DE0324, 82917, 83116},
+    {0x10DE0325, 83148, 83154},
+    {0x10DE0326, 83173, 83180},
+    {0x10DE0327, 83196, 83203},
+    {0x10DE0328, 83219, 83226},
+    {0x10DE0329, 83240, 83244},
+    {0x10DE032A, 83259, 83268},
+    {0x10DE032B, 83283, 83292},
+    {0x10DE032C, 83219, 83306},
+    {0x10DE032D, 83320, 83326},
+    {0x10DE032F, 83219, 44657},
+    {0x10DE0330, 44657, 83344},
+    {0x10DE0331, 44657, 83366},
+    {0x10DE0332, 44657, 83382},
+    {0x10DE0333, 83400, 83405},
+    {0x10DE0334, 83427, 83434},
+    {0x10DE0338, 83452, 83459},
+    {0x10DE0341, 83474, 83481},
+    {0x10DE0342, 83503, 82776},
+    {0x10DE0343, 83510, 83517},
+    {0x10DE0344, 83535, 83542},
+    {0x10DE0345, 83560, 44657},
+    {0x10DE0348, 83567, 83573},
+    {0x10DE034E, 83591, 83598},
+    {0x10DE034F, 83613, 44657},
+    {0x10DE0371, 83621, 83631},
+    {0x10DE0398, 61764, 83663},
+    {0x10DE03E0, 83672, 83683},
+    {0x10DE03F0, 83707, 83713},
+    {0x10DE0407, 83735, 83735},
+    {0x10DE0421, 83759, 83763},
+    {0x10DE0427, 45039, 83779},
+    {0x10DE0429, 50851, 83792},
+    {0x10DE042B, 83814, 83822},
+    {0x10DE10DE, 78774, 78778},
+    {0x10DF10DF, 83845, 39114},
+    {0x10DF1AE5, 83857, 68264},
+    {0x10DFF0A5, 83864, 83873},
+    {0x10DFF700, 83912, 68264},
+    {0x10DFF800, 83919, 68264},
+    {0x10DFF900, 83926, 83931},
+    {0x10DFF980, 83954, 83966},
+    {0x10DFFA00, 84000, 68264},
+    {0x10DFFD00, 84008, 84029},
+    {0x10DFFE00, 84044, 84056},
+    {0x10E10391, 84075, 0},
+    {0x10E1690C, 84085, 0},
+    {0x10E1DC20, 84093, 50377},
+    {0x10E30000, 84100, 84113},
+    {0x10E30148, 84139, 84153},
+    {0x10E30513, 84173, 84180},
+    {0x10E30850, 84212, 84219},
+    {0x10E30854, 84212, 84249},
+    {0x10E30860, 84281, 84290},
+    {0x10E30862, 84322, 84332},
+    {0x10E38260, 84368, 84383},
+    {0x10E38261, 84368, 84383},
+    {0x10E82011, 84422, 84439},
+    {0x10E84750, 84464, 84471},
+    {0x10E85920, 84491, 74210},
+    {0x10E88033, 84498, 84512},
+    {0x10E88043, 84538, 84547},
+    {0x10E88062, 84576, 84582},
+    {0x10E8807D, 84576, 84594},
+    {0x10E88088, 84600, 84603},
+    {0x10E88089, 84642, 84646},
+    {0x10E8809C, 84576, 84685},
+    {0x10E880B1, 84700, 84724},
+    {0x10E880D7, 84747, 84756},
+    {0x10E880D8, 84787, 84796},
+    {0x10E880D9, 84841, 84756},
+    {0x10E880DA, 0, 0},
+    {0x10E8811A, 84850, 84861},
+    {0x10E88170, 84576, 84890},
+    {0x10EA1680, 84930, 84939},
+    {0x10EA1682, 84944, 84953},
+    {0x10EA1683, 84959, 0},
+    {0x10EA2000, 84968, 84982},
+    {0x10EA2010, 85014, 85034},
+    {0x10EA5000, 85046, 0},
+    {0x10EA5050, 85060, 0},
+    {0x10EB0101, 85074, 85078},
+    {0x10EB8111, 85104, 85111},
+    {0x10EC0139, 85125, 85134},
+    {0x10EC0260, 85150, 85157},
+    {0x10EC0262, 85184, 85191},
+    {0x10EC0880, 85221, 85227},
+    {0x10EC0883, 85242, 85191},
+    {0x10EC0885, 85249, 85256},
+    {0x10EC0888, 85321, 85351},
+    {0x10EC8021, 85368, 85378},
+    {0x10EC8029, 85382, 85410},
+    {0x10EC8101, 85422, 85428},
+    {0x10EC8119, 85444, 85447},
+    {0x10EC8129, 85481, 85489},
+    {0x10EC8131, 85521, 0},
+    {0x10EC8138, 85532, 85542},
+    {0x10EC8139, 85572, 85594},
+    {0x10EC8167, 45869, 85624},
+    {0x10EC8168, 85645, 85654},
+    {0x10EC8169, 85675, 85685},
+    {0x10EC8180, 85729, 85737},
+    {0x10EC8197, 0, 0},
+    {0x10ED7310, 85781, 85787},
+    {0x10EE0314, 85813, 48543},
+    {0x10EE1001, 85829, 85837},
+    {0x10EE3FC0, 85866, 0},
+    {0x10EE3FC1, 85877, 0},
+    {0x10EE3FC2, 85890, 0},
+    {0x10EE3FC3, 85908, 85908},
+    {0x10EE3FC4, 85925, 85934},
+    {0x10EE3FC5, 85945, 50851},
+    {0x10EE5343, 85947, 85961},
+    {0x10EE8130, 85978, 85990},
+    {0x10EE8381, 86025, 85111},
+    {0x10EF8154, 86032, 86038},
+    {0x10F0A800, 86057, 86063},
+    {0x10F0B300, 86078, 86084},
+    {0x10F11566, 0, 86099},
+    {0x10F11677, 0, 86108},
+    {0x10F12013, 86119, 86132},
+    {0x10F41300, 86157, 86164},
+    {0x10F5A001, 86198, 86206},
+    {0x10F60111, 75771, 86220},
+    {0x10FA0000, 86261, 36651},
+    {0x10FA0001, 0, 36651},
+    {0x10FA0002, 0, 36651},
+    {0x10FA0003, 0, 36651},
+    {0x10FA0004, 0, 36651},
+    {0x10FA0005, 0, 36651},
+    {0x10FA0006, 0, 36651},
+    {0x10FA0007, 0, 36651},
+    {0x10FA0008, 0, 36651},
+    {0x10FA0009, 0, 36651},
+    {0x10FA000A, 0, 36651},
+    {0x10FA000B, 0, 36651},
+    {0x10FA000C, 86270, 86281},
+    {0x10FA000D, 0, 36651},
+    {0x10FA000E, 0, 36651},
+    {0x10FA000F, 0, 36651},
+    {0x10FA0010, 0, 36651},
+    {0x10FA0011, 0, 36651},
+    {0x10FA0012, 0, 36651},
+    {0x10FA0013, 0, 36651},
+    {0x10FA0014, 0, 36651},
+    {0x10FA0015, 0, 36651},
+    {0x10FB186F, 86314, 0},
+    {0x10FC8139, 86321, 85444},
+    {0x11003044, 86330, 86338},
+    {0x11010002, 86372, 86380},
+    {0x11011060, 86399, 86411},
+    {0x1101134A, 0, 86380},
+    {0x11019100, 86442, 77731},
+    {0x11019400, 86457, 77731},
+    {0x11019401, 86466, 77731},
+    {0x11019500, 86475, 50418},
+    {0x11019502, 86484, 86494},
+    {0x11019700, 0, 86520},
+    {0x11020002, 86535, 86550},
+    {0x11020003, 86612, 86620},
+    {0x11020004, 86640, 86670},
+    {0x11020005, 86693, 86700},
+    {0x11020006, 86730, 86739},
+    {0x11020007, 86762, 86781},
+    {0x11020008, 86791, 86798},
+    {0x11021017, 86821, 86828},
+    {0x11021020, 78811, 86858},
+    {0x11021047, 0, 86879},
+    {0x11021371, 86904, 86913},
+    {0x11022898, 86937, 86944},
+    {0x11024001, 86953, 86961},
+    {0x11027002, 86998, 87007},
+    {0x11027003, 87017, 87025},
+    {0x11027004, 87064, 87072},
+    {0x11027005, 44657, 87102},
+    {0x11027802, 87129, 87141},
+    {0x11028938, 87172, 87179},
+    {0x11030004, 87185, 87193},
+    {0x11030005, 87208, 87193},
+    {0x11030008, 87216, 87193},
+    {0x11055000, 0, 86108},
+    {0x11058300, 87224, 49229},
+    {0x11058400, 87224, 49229},
+    {0x11058475, 87231, 87238},
+    {0x11060130, 87253, 87260},
+    {0x11060198, 0, 37021},
+    {0x11060204, 87298, 87313},
+    {0x11060238, 87324, 37021},
+    {0x11060259, 45039, 44487},
+    {0x11060269, 87331, 37021},
+    {0x11060282, 87337, 37021},
+    {0x11060305, 87347, 44487},
+    {0x11060391, 87360, 44487},
+    {0x11060501, 87370, 44487},
+    {0x11060505, 87377, 87384},
+    {0x11060561, 87402, 47077},
+    {0x11060571, 87412, 51431},
+    {0x11060576, 87448, 87455},
+    {0x11060585, 87465, 87480},
+    {0x11060586, 87500, 60135},
+    {0x11060591, 87511, 87519},
+    {0x11060595, 87552, 87561},
+    {0x11060596, 87589, 87598},
+    {0x11060597, 87613, 87622},
+    {0x11060598, 87647, 44487},
+    {0x11060601, 87656, 51731},
+    {0x11060605, 87664, 87673},
+    {0x11060680, 87694, 87703},
+    {0x11060686, 87713, 87732},
+    {0x11060691, 87750, 87763},
+    {0x11060692, 0, 51382},
+    {0x11060693, 87773, 44487},
+    {0x11060926, 87782, 87791},
+    {0x11061000, 87822, 44487},
+    {0x11061106, 87831, 87838},
+    {0x11061204, 44657, 87313},
+    {0x11061238, 87324, 37021},
+    {0x11061259, 45039, 44487},
+    {0x11061269, 87331, 37021},
+    {0x11061282, 87337, 37021},
+    {0x11061571, 87855, 47077},
+    {0x11061595, 87864, 44487},
+    {0x11061708, 87876, 87883},
+    {0x11062006, 87905, 87913},
+    {0x11062204, 44657, 87313},
+    {0x11062238, 87324, 37021},
+    {0x11062259, 45039, 44487},
+    {0x11062269, 87331, 37021},
+    {0x11062282, 87337, 37021},
+    {0x11063038, 87960, 87977},
+    {0x11063040, 88026, 88034},
+    {0x11063041, 87822, 87838},
+    {0x11063043, 88038, 88048},
+    {0x11063044, 88078, 88085},
+    {0x11063050, 88126, 88144},
+    {0x11063051, 0, 51457},
+    {0x11063053, 87905, 88182},
+    {0x11063057, 88211, 88221},
+    {0x11063058, 88254, 88261},
+    {0x11063059, 88254, 88297},
+    {0x11063065, 88363, 88370},
+    {0x11063068, 88454, 88463},
+    {0x11063074, 88494, 36999},
+    {0x11063086, 88454, 88501},
+    {0x11063091, 88507, 37021},
+    {0x11063099, 88514, 37021},
+    {0x11063101, 88528, 37021},
+    {0x11063102, 88535, 37021},
+    {0x11063103, 88542, 37021},
+    {0x11063104, 88549, 58135},
+    {0x11063106, 88556, 88568},
+    {0x11063107, 88607, 36999},
+    {0x11063108, 50851, 88647},
+    {0x11063109, 88607, 36999},
+    {0x11063112, 88696, 37021},
+    {0x11063113, 0, 46312},
+    {0x11063116, 88078, 88703},
+    {0x11063118, 88721, 88730},
+    {0x11063119, 88747, 88768},
+    {0x11063122, 88808, 88815},
+    {0x11063123, 88808, 37021},
+    {0x11063128, 88844, 88703},
+    {0x11063133, 88851, 37021},
+    {0x11063147, 88494, 36999},
+    {0x11063148, 88858, 88703},
+    {0x11063149, 88865, 88880},
+    {0x11063156, 88901, 37021},
+    {0x11063158, 0, 88703},
+    {0x11063164, 88908, 88915},
+    {0x11063168, 88942, 88949},
+    {0x11063177, 88983, 36999},
+    {0x11063178, 0, 37021},
+    {0x11063188, 88990, 37021},
+    {0x11063189, 89001, 37021},
+    {0x11063198, 0, 88703},
+    {0x11063202, 0, 37021},
+    {0x11063204, 89008, 37021},
+    {0x11063205, 0, 37021},
+    {0x11063208, 89017, 37021},
+    {0x11063209, 0, 37021},
+    {0x11063213, 0, 46312},
+    {0x11063227, 88254, 60135},
+    {0x11063230, 89023, 89047},
+    {0x11063238, 87324, 88703},
+    {0x11063249, 89067, 89074},
+    {0x11063258, 89101, 88703},
+    {0x11063259, 44657, 37021},
+    {0x11063269, 87331, 37021},
+    {0x11063282, 87337, 37021},
+    {0x11063288, 44657, 89107},
+    {0x11063343, 89184, 40654},
+    {0x11063344, 89193, 89213},
+    {0x11063349, 89239, 89246},
+    {0x11064149, 44657, 89278},
+    {0x11064204, 44657, 37021},
+    {0x11064238, 44657, 37021},
+    {0x11064258, 44657, 37021},
+    {0x11064259, 44657, 37021},
+    {0x11064269, 87331, 37021},
+    {0x11064282, 87337, 37021},
+    {0x11065030, 87589, 88221},
+    {0x11066100, 89304, 89318},
+    {0x11067204, 89365, 37021},
+    {0x11067205, 89372, 89378},
+    {0x11067238, 87324, 37021},
+    {0x11067258, 89101, 37021},
+    {0x11067259, 89440, 37021},
+    {0x11067269, 87331, 37021},
+    {0x11067282, 87337, 37021},
+    {0x11068208, 89446, 45295},
+    {0x11068231, 89453, 36999},
+    {0x11068235, 88858, 51457},
+    {0x11068237, 88254, 88297},
+    {0x11068305, 89460, 45295},
+    {0x11068391, 87360, 45295},
+    {0x11068501, 87370, 45295},
+    {0x11068596, 87589, 45295},
+    {0x11068597, 87613, 89471},
+    {0x11068598, 87647, 89471},
+    {0x11068601, 89495, 89471},
+    {0x11068602, 0, 89504},
+    {0x11068605, 89522, 89529},
+    {0x11068691, 89552, 89471},
+    {0x11068693, 87773, 89471},
+    {0x11069238, 87324, 89571},
+    {0x11069398, 89580, 89587},
+    {0x11069876, 88607, 36999},
+    {0x1106A208, 89017, 47718},
+    {0x1106A238, 87324, 47718},
+    {0x1106B091, 88507, 89471},
+    {0x1106B099, 89614, 89471},
+    {0x1106B101, 88528, 89471},
+    {0x1106B102, 88535, 89471},
+    {0x1106B103, 88542, 89471},
+    {0x1106B112, 88696, 89471},
+    {0x1106B113, 0, 89571},
+    {0x1106B115, 89623, 89633},
+    {0x1106B116, 88078, 89471},
+    {0x1106B133, 89655, 89633},
+    {0x1106B148, 89662, 89471},
+    {0x1106B156, 88901, 89471},
+    {0x1106B158, 0, 89471},
+    {0x1106B168, 88983, 89676},
+    {0x1106B188, 0, 89676},
+    {0x1106B198, 89708, 89676},
+    {0x1106B213, 0, 89571},
+    {0x1106C208, 89017, 47718},
+    {0x1106C238, 87324, 47718},
+    {0x1106D208, 89017, 47718},
+    {0x1106D213, 0, 46312},
+    {0x1106D238, 87324, 47718},
+    {0x1106E208, 89017, 47718},
+    {0x1106E238, 87324, 47718},
+    {0x1106F208, 89017, 47718},
+    {0x1106F238, 87324, 47718},
+    {0x11078576, 0, 89715},
+    {0x11080100, 89731, 86038},
+    {0x11080101, 89744, 89757},
+    {0x11080105, 89783, 86038},
+    {0x11080108, 89783, 86038},
+    {0x11080138, 89783, 86038},
+    {0x11080139, 89783, 86038},
+    {0x1108013C, 89783, 86038},
+    {0x1108013D, 89783, 86038},
+    {0x11091400, 89793, 89801},
+    {0x110A2101, 89835, 89845},
+    {0x110A2102, 89896, 89906},
+    {0x110A3141, 89968, 89971},
+    {0x110B0001, 90014, 90020},
+    {0x110B0002, 90036, 90048},
+    {0x110B0004, 0, 0},
+    {0x11122200, 90067, 90072},
+    {0x11122300, 90085, 90090},
+    {0x11122340, 90112, 90117},
+    {0x11122400, 90157, 73703},
+    {0x11131211, 90162, 90175},
+    {0x11131216, 90188, 90197},
+    {0x11131217, 90214, 63461},
+    {0x11135105, 90222, 0},
+    {0x11139211, 90230, 77985},
+    {0x11139511, 90239, 90252},
+    {0x11139876, 90188, 90269},
+    {0x11140506, 90298, 90307},
+    {0x11143202, 90340, 90351},
+    {0x11160022, 90381, 0},
+    {0x11160023, 90388, 0},
+    {0x11160024, 90395, 0},
+    {0x11160025, 90402, 0},
+    {0x11160026, 90409, 0},
+    {0x11160027, 90416, 0},
+    {0x11160028, 90427, 0},
+    {0x11179500, 0, 90438},
+    {0x11179501, 0, 90455},
+    {0x11190000, 90485, 90503},
+    {0x11190001, 90528, 90541},
+    {0x11190002, 90576, 90541},
+    {0x11190003, 90589, 90602},
+    {0x11190004, 90637, 90645},
+    {0x11190005, 90680, 90688},
+    {0x11190006, 90723, 90736},
+    {0x11190007, 90763, 90736},
+    {0x11190008, 90776, 90736},
+    {0x11190009, 90784, 90736},
+    {0x1119000A, 90801, 90814},
+    {0x1119000B, 90836, 90849},
+    {0x1119000C, 90870, 90849},
+    {0x1119000D, 90878, 90849},
+    {0x11190100, 90895, 90912},
+    {0x11190101, 90938, 90955},
+    {0x11190102, 90975, 90955},
+    {0x11190103, 90985, 90955},
+    {0x11190104, 90995, 91012},
+    {0x11190105, 91027, 91012},
+    {0x11190110, 91044, 90955},
+    {0x11190111, 91061, 90955},
+    {0x11190112, 91078, 90955},
+    {0x11190113, 91088, 90955},
+    {0x11190114, 91098, 91012},
+    {0x11190115, 91061, 91012},
+    {0x11190118, 91115, 91125},
+    {0x11190119, 91146, 91125},
+    {0x1119011A, 91156, 91125},
+    {0x1119011B, 91173, 91125},
+    {0x11190120, 91190, 0},
+    {0x11190121, 91209, 0},
+    {0x11190122, 91228, 0},
+    {0x11190123, 91239, 0},
+    {0x11190124, 91250, 0},
+    {0x11190125, 91209, 0},
+    {0x11190136, 91269, 0},
+    {0x11190137, 91280, 91291},
+    {0x11190138, 91313, 0},
+    {0x11190139, 91324, 0},
+    {0x1119013A, 91335, 0},
+    {0x1119013B, 91346, 0},
+    {0x1119013C, 91357, 0},
+    {0x1119013D, 91368, 0},
+    {0x1119013E, 91379, 0},
+    {0x1119013F, 91390, 0},
+    {0x11190166, 91401, 0},
+    {0x11190167, 91412, 0},
+    {0x11190168, 91423, 91433},
+    {0x11190169, 91465, 91475},
+    {0x1119016A, 91507, 91475},
+    {0x1119016B, 91524, 91475},
+    {0x1119016C, 91541, 0},
+    {0x1119016D, 91552, 0},
+    {0x1119016E, 91563, 0},
+    {0x1119016F, 91574, 0},
+    {0x111901D6, 91585, 0},
+    {0x111901D7, 91596, 0},
+    {0x111901F6, 91607, 0},
+    {0x111901F7, 91618, 0},
+    {0x111901FC, 91629, 0},
+    {0x111901FD, 91640, 0},
+    {0x111901FE, 91651, 0},
+    {0x111901FF, 91662, 0},
+    {0x11190210, 91673, 91690},
+    {0x11190211, 91708, 91690},
+    {0x11190260, 91725, 91742},
+    {0x11190261, 91771, 91742},
+    {0x11190300, 91788, 0},
+    {0x111A0000, 91795, 0},
+    {0x111A0002, 91804, 0},
+    {0x111A0003, 91813, 69483},
+    {0x111C0001, 0, 91821},
+    {0x111D0001, 91837, 91850},
+    {0x111D0003, 91870, 91883},
+    {0x111D0004, 91916, 91883},
+    {0x111F4A47, 91926, 91939},
+    {0x111F5243, 0, 91962},
+    {0x11270200, 91990, 12850},
+    {0x11270210, 92009, 12850},
+    {0x11270250, 0, 12850},
+    {0x11270300, 92019, 73703},
+    {0x11270310, 0, 12850},
+    {0x11270400, 92028, 69483},
+    {0x112E0000, 0, 92042},
+    {0x112E000B, 0, 92042},
+    {0x1130F211, 92072, 92078},
+    {0x11311131, 92099, 92104},
+    {0x11311201, 92114, 92122},
+    {0x11311234, 0, 79244},
+    {0x11311301, 92144, 92152},
+    {0x11311562, 92168, 79244},
+    {0x11312780, 92176, 92186},
+    {0x11313400, 92211, 64536},
+    {0x11313401, 92211, 92219},
+    {0x11315400, 92243, 92264},
+    {0x11315402, 92285, 90020},
+    {0x11317130, 92304, 92314},
+    {0x11317133, 92358, 92376},
+    {0x11317134, 92397, 92407},
+    {0x11317145, 92429, 92436},
+    {0x11317146, 92442, 92450},
+    {0x11319730, 92468, 92476},
+    {0x11337711, 92496, 0},
+    {0x11337901, 92510, 0},
+    {0x11337902, 0, 0},
+    {0x11337911, 0, 0},
+    {0x11337912, 0, 0},
+    {0x11337941, 0, 0},
+    {0x11337942, 0, 0},
+    {0x11337943, 0, 92524},
+    {0x11337944, 0, 92524},
+    {0x1133B921, 0, 0},
+    {0x1133B922, 0, 0},
+    {0x1133B923, 0, 92538},
+    {0x1133E001, 92552, 0},
+    {0x1133E002, 92569, 0},
+    {0x1133E003, 92582, 0},
+    {0x1133E004, 92597, 0},
+    {0x1133E005, 92608, 92622},
+    {0x1133E00B, 92662, 92681},
+    {0x1133E010, 92717, 92725},
+    {0x1133E012, 92744, 92753},
+    {0x1133E013, 92772, 92783},
+    {0x1133E014, 92804, 92813},
+    {0x1133E015, 0, 92833},
+    {0x1133E018, 0, 92861},
+    {0x11340001, 0, 92884},
+    {0x11340002, 92899, 92904},
+    {0x11350001, 0, 92931},
+    {0x11388905, 92946, 92951},
+    {0x113C0000, 73365, 92965},
+    {0x113C0001, 73365, 92977},
+    {0x113C0911, 93011, 93018},
+    {0x113C0912, 93040, 93047},
+    {0x113C0913, 93069, 93076},
+    {0x113C0914, 93098, 93105},
+    {0x113F0808, 93143, 68469},
+    {0x113F1010, 93151, 68469},
+    {0x113F80C0, 0, 0},
+    {0x113F80C4, 0, 0},
+    {0x113F80C8, 0, 0},
+    {0x113F8888, 0, 0},
+    {0x113F9090, 0, 0},
+    {0x11410001, 0, 93160},
+    {0x11423210, 93185, 93200},
+    {0x11426410, 93229, 36651},
+    {0x11426412, 0, 36651},
+    {0x11426420, 0, 36651},
+    {0x11426422, 93239, 93239},
+    {0x11426424, 93254, 93268},
+    {0x11426425, 93299, 93314},
+    {0x11426426, 0, 36651},
+    {0x1142643D, 93325, 93330},
+    {0x11429876, 93299, 93345},
+    {0x11440001, 0, 93358},
+    {0x1145F020, 0, 93373},
+    {0x1145F021, 93400, 93408},
+    {0x1145F024, 93437, 93408},
+    {0x11471123, 41621, 93446},
+    {0x11484000, 93452, 90072},
+    {0x11484200, 0, 86038},
+    {0x11484300, 93459, 93478},
+    {0x11484320, 93510, 93524},
+    {0x11489000, 93572, 93595},
+    {0x11489E00, 93626, 93643},
+    {0x114A5565, 93681, 93693},
+    {0x114A5579, 93754, 93766},
+    {0x114A5588, 93789, 93801},
+    {0x114A6504, 0, 93836},
+    {0x114A7587, 93852, 0},
+    {0x114D2189, 93864, 93875},
+    {0x114F0002, 93897, 0},
+    {0x114F0003, 93912, 0},
+    {0x114F0004, 93929, 0},
+    {0x114F0005, 93944, 0},
+    {0x114F0006, 93958, 0},
+    {0x114F0007, 93973, 93992},
+    {0x114F0009, 94017, 0},
+    {0x114F000A, 94033, 0},
+    {0x114F000C, 94050, 0},
+    {0x114F000D, 94067, 94076},
+    {0x114F0011, 94091, 0},
+    {0x114F0012, 94112, 0},
+    {0x114F0013, 93944, 0},
+    {0x114F0014, 94112, 0},
+    {0x114F0015, 93929, 0},
+    {0x114F0016, 94133, 0},
+    {0x114F0017, 93958, 0},
+    {0x114F0019, 94150, 0},
+    {0x114F001A, 94167, 0},
+    {0x114F001B, 94184, 0},
+    {0x114F001D, 94205, 94218},
+    {0x114F001F, 0, 94228},
+    {0x114F0020, 0, 94244},
+    {0x114F0021, 0, 94260},
+    {0x114F0022, 0, 94273},
+    {0x114F0023, 94286, 0},
+    {0x114F0024, 94301, 0},
+    {0x114F0026, 94322, 0},
+    {0x114F0027, 94340, 0},
+    {0x114F0029, 94358, 0},
+    {0x114F0034, 94374, 0},
+    {0x114F0035, 94392, 94405},
+    {0x114F0040, 94428, 0},
+    {0x114F0042, 94442, 0},
+    {0x114F0070, 94460, 0},
+    {0x114F0071, 94460, 0},
+    {0x114F0072, 94460, 0},
+    {0x114F0073, 94460, 0},
+    {0x114F6001, 94477, 0},
+    {0x11550810, 0, 94486},
+    {0x11550922, 94505, 66005},
+    {0x11550926, 0, 65990},
+    {0x11583011, 0, 94510},
+    {0x11589050, 0, 94537},
+    {0x11589051, 0, 94537},
+    {0x11590001, 94556, 0},
+    {0x11590002, 94563, 85111},
+    {0x115D0003, 94571, 94583},
+    {0x115D0005, 0, 94616},
+    {0x115D0007, 0, 94616},
+    {0x115D000B, 0, 94616},
+    {0x115D000C, 94640, 94660},
+    {0x115D000F, 0, 94616},
+    {0x115D002B, 0, 94684},
+    {0x115D0076, 0, 94718},
+    {0x115D00D3, 94758, 94772},
+    {0x115D00D4, 94793, 94798},
+    {0x115D0101, 0, 94808},
+    {0x115D0103, 0, 94826},
+    {0x11610001, 0, 44487},
+    {0x11630001, 94855, 94867},
+    {0x11632000, 94878, 0},
+    {0x11650001, 0, 94890},
+    {0x11660005, 94919, 94937},
+    {0x11660006, 94975, 94993},
+    {0x11660007, 95032, 37021},
+    {0x11660008, 94975, 95053},
+    {0x11660009, 94919, 66679},
+    {0x11660010, 95094, 0},
+    {0x11660011, 95101, 0},
+    {0x11660012, 95109, 0},
+    {0x11660013, 95117, 95126},
+    {0x11660014, 95117, 44487},
+    {0x11660015, 95145, 95126},
+    {0x11660016, 95145, 44487},
+    {0x11660017, 95153, 0},
+    {0x11660101, 95161, 0},
+    {0x11660103, 95169, 95177},
+    {0x11660110, 95211, 95218},
+    {0x11660200, 95278, 36999},
+    {0x11660201, 95283, 68099},
+    {0x11660203, 95288, 36999},
+    {0x11660211, 95278, 50377},
+    {0x11660212, 95283, 95293},
+    {0x11660213, 95307, 57091},
+    {0x11660217, 95307, 95312},
+    {0x11660220, 95278, 95343},
+    {0x11660221, 95307, 95376},
+    {0x11660223, 95406, 95413},
+    {0x11660225, 95283, 37322},
+    {0x11660227, 95288, 37322},
+    {0x11660230, 44657, 95428},
+    {0x11660241, 95446, 95453},
+    {0x11690102, 95502, 95509},
+    {0x11690202, 95502, 95549},
+    {0x11690302, 95502, 95611},
+    {0x11690402, 95502, 95645},
+    {0x11690502, 95695, 95702},
+    {0x11690902, 95695, 95736},
+    {0x11692001, 95769, 95786},
+    {0x116A6100, 0, 95822},
+    {0x116A6800, 0, 95838},
+    {0x116A7100, 0, 95822},
+    {0x116A7800, 0, 95838},
+    {0x116E0500, 95852, 95858},
+    {0x11720001, 95871, 95887},
+    {0x11720004, 45869, 95901},
+    {0x11768474, 95919, 95928},
+    {0x1178AFA1, 0, 66174},
+    {0x11790102, 95997, 96026},
+    {0x11790103, 0, 96054},
+    {0x11790406, 96089, 96095},
+    {0x11790601, 0, 96116},
+    {0x11790602, 0, 96142},
+    {0x11790603, 96174, 96182},
+    {0x11790604, 0, 96218},
+    {0x11790605, 0, 96142},
+    {0x11790606, 0, 96142},
+    {0x11790609, 0, 96218},
+    {0x1179060A, 96250, 96259},
+    {0x1179060F, 96294, 51929},
+    {0x11790611, 0, 36999},
+    {0x11790617, 96302, 96311},
+    {0x11790618, 0, 96349},
+    {0x11790701, 96382, 96391},
+    {0x11790804, 96416, 96423},
+    {0x11790805, 96459, 96526},
+    {0x11790D01, 96545, 96552},
+    {0x11791179, 96568, 96575},
+    {0x117913A8, 96600, 96617},
+    {0x117B8320, 96640, 96650},
+    {0x117E0001, 0, 96664},
+    {0x11800475, 96677, 96685},
+    {0x11800476, 45039, 96704},
+    {0x11800552, 45039, 96725},
+    {0x11800592, 96734, 96743},
+    {0x11800822, 96778, 61683},
+    {0x11800832, 45039, 96793},
+    {0x11800843, 45039, 96826},
+    {0x11800852, 45039, 96852},
+    {0x11805551, 50851, 96890},
+    {0x11858929, 0, 50377},
+    {0x11860100, 96911, 63461},
+    {0x11861002, 96920, 77985},
+    {0x11861100, 0, 77985},
+    {0x11861300, 96946, 77985},
+    {0x11861301, 96995, 77985},
+    {0x11861340, 97005, 97016},
+    {0x11861561, 97032, 97016},
+    {0x11863065, 97042, 97051},
+    {0x11863106, 97100, 77985},
+    {0x11863300, 97118, 97157},
+    {0x11863B00, 97179, 97190},
+    {0x11864000, 97206, 97213},
+    {0x11864001, 97238, 97248},
+    {0x11864300, 97281, 97290},
+    {0x11864B01, 97323, 97213},
+    {0x11864C00, 97323, 97213},
+    {0x11891592, 0, 97332},
+    {0x118C0014, 97346, 97351},
+    {0x118C1117, 97388, 97401},
+    {0x118D0001, 56458, 97440},
+    {0x118D0012, 97464, 97473},
+    {0x118D0014, 97499, 97473},
+    {0x118D0024, 97508, 97473},
+    {0x118D0044, 97517, 97473},
+    {0x118D0112, 97464, 97473},
+    {0x118D0114, 97499, 97473},
+    {0x118D0124, 97508, 97473},
+    {0x118D0144, 97517, 97473},
+    {0x118D0212, 97464, 97473},
+    {0x118D0214, 97499, 97473},
+    {0x118D0224, 97508, 97473},
+    {0x118D0244, 97517, 97473},
+    {0x118D0312, 97464, 97473},
+    {0x118D0314, 97499, 97473},
+    {0x118D0324, 97508, 97473},
+    {0x118D0344, 97517, 97473},
+    {0x11902550, 97526, 97534},
+    {0x1190C721, 0, 97574},
+    {0x1190C731, 97579, 97594},
+    {0x11910001, 0, 97624},
+    {0x11910002, 97634, 97643},
+    {0x11910003, 0, 97682},
+    {0x11910004, 97702, 97710},
+    {0x11910005, 97634, 97643},
+    {0x11910006, 97737, 97745},
+    {0x11910007, 97782, 97790},
+    {0x11910008, 97827, 97834},
+    {0x11910009, 97827, 97834},
+    {0x1191000D, 97869, 97877},
+    {0x11918001, 97919, 97927},
+    {0x11918002, 97967, 97975},
+    {0x11918010, 98008, 98015},
+    {0x11918020, 98008, 90814},
+    {0x11918030, 98008, 90814},
+    {0x11918040, 98008, 50418},
+    {0x11918050, 0, 98015},
+    {0x11918060, 98042, 67556},
+    {0x11918081, 98050, 98060},
+    {0x1197010C, 98093, 98108},
+    {0x11990001, 0, 98138},
+    {0x11990002, 0, 98160},
+    {0x11990201, 0, 98186},
+    {0x119B1221, 98203, 98211},
+    {0x119E0001, 98229, 98237},
+    {0x119E0003, 98264, 98272},
+    {0x11A87302, 0, 98298},
+    {0x11A87308, 0, 98325},
+    {0x11A87402, 0, 98352},
+    {0x11A87408, 0, 98380},
+    {0x11A94240, 98408, 98420},
+    {0x11AB0146, 98443, 98454},
+    {0x11AB11AB, 98494, 98508},
+    {0x11AB13F8, 98535, 98541},
+    {0x11AB1FA6, 98556, 98564},
+    {0x11AB1FAA, 98593, 98598},
+    {0x11AB4320, 98641, 98649},
+    {0x11AB4350, 98663, 98671},
+    {0x11AB4351, 98663, 98671},
+    {0x11AB4353, 98708, 0},
+    {0x11AB4360, 98715, 98723},
+    {0x11AB4361, 98663, 98767},
+    {0x11AB4362, 67033, 98830},
+    {0x11AB4363, 67033, 98886},
+    {0x11AB4364, 98926, 98886},
+    {0x11AB4611, 98934, 51731},
+    {0x11AB4620, 98943, 98952},
+    {0x11AB4801, 99005, 99014},
+    {0x11AB4809, 99045, 99054},
+    {0x11AB5005, 99088, 99096},
+    {0x11AB5040, 99128, 99137},
+    {0x11AB5041, 99168, 99137},
+    {0x11AB5080, 99176, 99192},
+    {0x11AB5081, 99176, 99192},
+    {0x11AB6041, 99208, 99219},
+    {0x11AB6145, 40654, 99301},
+    {0x11AB6320, 99384, 99397},
+    {0x11AB6480, 99438, 99397},
+    {0x11AB6485, 99438, 99446},
+    {0x11AB9653, 99499, 99509},
+    {0x11ABF003, 99543, 99552},
+    {0x11ABF004, 99590, 99598},
+    {0x11ABF006, 99638, 99648},
+    {0x11AD0001, 99692, 77985},
+    {0x11AD0002, 99702, 99711},
+    {0x11ADC115, 99762, 99771},
+    {0x11AE4153, 0, 99791},
+    {0x11AE5842, 0, 99791},
+    {0x11AF0001, 99809, 99814},
+    {0x11B00001, 99821, 99833},
+    {0x11B00002, 99862, 99874},
+    {0x11B00004, 99905, 99917},
+    {0x11B00010, 99951, 99963},
+    {0x11B00021, 99993, 100001},
+    {0x11B00022, 99993, 99874},
+    {0x11B00024, 99993, 99917},
+    {0x11B00030, 99993, 99963},
+    {0x11B00100, 100032, 100040},
+    {0x11B00101, 100032, 100040},
+    {0x11B00102, 100032, 100077},
+    {0x11B00103, 100032, 100114},
+    {0x11B00200, 100151, 100159},
+    {0x11B00292, 100197, 100205},
+    {0x11B00500, 100223, 100231},
+    {0x11B00960, 100268, 100276},
+    {0x11B0C960, 100309, 100316},
+    {0x11B50001, 100337, 100349},
+    {0x11B50002, 100373, 100379},
+    {0x11B50003, 100397, 100404},
+    {0x11B50004, 100424, 100431},
+    {0x11B50005, 100454, 100462},
+    {0x11B50006, 100490, 100498},
+    {0x11B50007, 100527, 100533},
+    {0x11B50008, 100560, 100567},
+    {0x11B50009, 100600, 100608},
+    {0x11B5000A, 100628, 39114},
+    {0x11B5000B, 100636, 100643},
+    {0x11B5000C, 100673, 100680},
+    {0x11B50012, 100373, 100702},
+    {0x11B50013, 100725, 100349},
+    {0x11B50014, 100735, 100349},
+    {0x11B52200, 100744, 100752},
+    {0x11B80001, 100779, 0},
+    {0x11B9C0ED, 100795, 0},
+    {0x11BC0001, 100805, 100816},
+    {0x11BD0015, 100825, 100836},
+    {0x11BDBEBE, 100842, 100851},
+    {0x11BDBEDE, 100842, 100883},
+    {0x11C10440, 100893, 100909},
+    {0x11C10441, 100929, 100937},
+    {0x11C10442, 100943, 100951},
+    {0x11C10443, 100976, 100988},
+    {0x11C10444, 100976, 100996},
+    {0x11C10445, 100976, 0},
+    {0x11C10446, 100976, 0},
+    {0x11C10447, 100976, 101001},
+    {0x11C10448, 100893, 101011},
+    {0x11C10449, 100893, 101017},
+    {0x11C1044A, 100893, 0},
+    {0x11C1044B, 100976, 0},
+    {0x11C1044C, 100976, 101026},
+    {0x11C1044D, 100976, 0},
+    {0x11C1044E, 101036, 101051},
+    {0x11C1044F, 101097, 101105},
+    {0x11C10450, 101132, 101150},
+    {0x11C10451, 100976, 101166},
+    {0x11C10452, 100976, 101202},
+    {0x11C10453, 100976, 0},
+    {0x11C10454, 100976, 0},
+    {0x11C10455, 100976, 0},
+    {0x11C10456, 100976, 0},
+    {0x11C10457, 100976, 0},
+    {0x11C10458, 101210, 101216},
+    {0x11C10459, 100976, 0},
+    {0x11C1045A, 100976, 0},
+    {0x11C1045D, 101241, 101253},
+    {0x11C10461, 0, 101259},
+    {0x11C10462, 101278, 101283},
+    {0x11C10464, 101311, 101357},
+    {0x11C10480, 101390, 101405},
+    {0x11C1048C, 101433, 100937},
+    {0x11C1048E, 101438, 101448},
+    {0x11C1048F, 101462, 101472},
+    {0x11C10540, 0, 0},
+    {0x11C10600, 101501, 101508},
+    {0x11C10620, 101523, 101530},
+    {0x11C11040, 101568, 101575},
+    {0x11C13026, 101599, 101575},
+    {0x11C15400, 101610, 101618},
+    {0x11C15801, 0, 36900},
+    {0x11C15802, 101657, 101667},
+    {0x11C15803, 101704, 101712},
+    {0x11C15805, 101752, 101759},
+    {0x11C15811, 101788, 101794},
+    {0x11C19876, 101036, 100951},
+    {0x11C1AB20, 101833, 101841},
+    {0x11C1AB30, 101866, 101875},
+    {0x11C1ED00, 101898, 101906},
+    {0x11C63001, 46527, 101932},
+    {0x11C80658, 101961, 101968},
+    {0x11C8D665, 101999, 102005},
+    {0x11C8D667, 102036, 102042},
+    {0x11C90010, 0, 102081},
+    {0x11C90011, 0, 102107},
+    {0x11CB2000, 102132, 102152},
+    {0x11CB4000, 102166, 102173},
+    {0x11CB8000, 102186, 102191},
+    {0x11CE102B, 102207, 102212},
+    {0x11D101F7, 102221, 102228},
+    {0x11D101F8, 102221, 102228},
+    {0x11D101F9, 102248, 102255},
+    {0x11D41535, 102266, 102277},
+    {0x11D41805, 102308, 102317},
+    {0x11D41884, 102330, 102339},
+    {0x11D41889, 102376, 102383},
+    {0x11D41981, 102394, 102339},
+    {0x11D41983, 102403, 102339},
+    {0x11D41986, 102412, 102339},
+    {0x11D42192, 102420, 102430},
+    {0x11D4219A, 102420, 102462},
+    {0x11D4219E, 102420, 102494},
+    {0x11D42F44, 102526, 102536},
+    {0x11D50115, 102568, 102574},
+    {0x11D50116, 102621, 102627},
+    {0x11D50117, 102643, 102574},
+    {0x11D50118, 102621, 102627},
+    {0x11DB1234, 0, 102649},
+    {0x11DE6057, 102677, 102688},
+    {0x11DE6120, 102759, 102770},
+    {0x11DE9876, 0, 0},
+    {0x11EC2064, 0, 0},
+    {0x11F04231, 0, 0},
+    {0x11F04232, 102800, 0},
+    {0x11F04233, 102821, 0},
+    {0x11F04234, 102833, 0},
+    {0x11F04235, 102846, 0},
+    {0x11F04236, 102862, 0},
+    {0x11F04731, 102877, 97213},
+    {0x11F42915, 102886, 0},
+    {0x11F60112, 0, 102891},
+    {0x11F60113, 0, 102913},
+    {0x11F61401, 102929, 102943},
+    {0x11F62011, 102960, 102968},
+    {0x11F62201, 103014, 103022},
+    {0x11F69881, 103056, 103065},
+    {0x11F87364, 103105, 103112},
+    {0x11F87366, 103105, 103154},
+    {0x11F87367, 103199, 103206},
+    {0x11F87375, 103251, 103258},
+    {0x11F87380, 103276, 103283},
+    {0x11F87382, 103327, 103334},
+    {0x11F87384, 103378, 103385},
+    {0x11F88000, 103429, 103440},
+    {0x11F88010, 103463, 103474},
+    {0x11FE0001, 103502, 0},
+    {0x11FE0002, 103502, 0},
+    {0x11FE0003, 103502, 0},
+    {0x11FE0004, 103502, 0},
+    {0x11FE0005, 103502, 0},
+    {0x11FE0006, 103502, 0},
+    {0x11FE0007, 103502, 0},
+    {0x11FE0008, 103502, 0},
+    {0x11FE0009, 103502, 0},
+    {0x11FE000A, 103502, 0},
+    {0x11FE000B, 103502, 0},
+    {0x11FE000C, 103502, 0},
+    {0x11FE000D, 103502, 0},
+    {0x11FE8015, 103502, 103513},
+    {0x12020001, 103531, 103541},
+    {0x12084853, 0, 103557},
+    {0x12090100, 73336, 103572},
+    {0x120E0100, 103587, 103596},
+    {0x120E0101, 103587, 103596},
+    {0x120E0102, 103618, 103596},
+    {0x120E0103, 103618, 103596},
+    {0x120E0104, 103628, 103596},
+    {0x120E0105, 103628, 103596},
+    {0x120E0200, 103638, 103647},
+    {0x120E0201, 103638, 103676},
+    {0x120E0300, 103700, 0},
+    {0x120E0301, 103711, 0},
+    {0x120E0302, 103722, 0},
+    {0x120E0303, 103733, 0},
+    {0x120F0001, 103744, 0},
+    {0x121700F7, 103755, 103766},
+    {0x12176729, 103802, 103809},
+    {0x1217673A, 103830, 103809},
+    {0x12176832, 103837, 51929},
+    {0x12176836, 103846, 51929},
+    {0x12176872, 103858, 51929},
+    {0x12176925, 103865, 51929},
+    {0x12176933, 103872, 51929},
+    {0x12176972, 103879, 51929},
+    {0x12177110, 103886, 103894},
+    {0x12177113, 103920, 103929},
+    {0x12177114, 103952, 51929},
+    {0x12177120, 103960, 103975},
+    {0x12177130, 104012, 104020},
+    {0x12177134, 104058, 104071},
+    {0x121A0001, 104103, 104110},
+    {0x121A0002, 104138, 104146},
+    {0x121A0003, 104170, 104170},
+    {0x121A0005, 104185, 104193},
+    {0x121A0007, 104217, 0},
+    {0x121A0009, 104225, 0},
+    {0x121A0010, 104233, 104241},
+    {0x121A0057, 104281, 104295},
+    {0x12201220, 104303, 104311},
+    {0x12230001, 104349, 104358},
+    {0x12230002, 104436, 104444},
+    {0x12230003, 104481, 104492},
+    {0x12230004, 104521, 104492},
+    {0x12230005, 104532, 104543},
+    {0x12230006, 104570, 104543},
+    {0x12230007, 104581, 104590},
+    {0x12230008, 104617, 104623},
+    {0x12230009, 104681, 104690},
+    {0x12230010, 104761, 104774},
+    {0x12230011, 104807, 104821},
+    {0x12230012, 104865, 104875},
+    {0x12230013, 104944, 104963},
+    {0x12230014, 105004, 105019},
+    {0x12230015, 105066, 105077},
+    {0x12230044, 105151, 105151},
+    {0x12241000, 105169, 105176},
+    {0x122D1206, 105213, 105218},
+    {0x122D4201, 105223, 105231},
+    {0x122D50DC, 105245, 55079},
+    {0x122D80DA, 55074, 55079},
+    {0x12360000, 105257, 105272},
+    {0x12360531, 78007, 78018},
+    {0x12363D01, 40654, 105279},
+    {0x12366401, 105292, 105307},
+    {0x12369708, 105311, 105326},
+    {0x123D0010, 105333, 105340},
+    {0x123F00E4, 105371, 105378},
+    {0x123F6120, 105383, 105389},
+    {0x123F8120, 105400, 105404},
+    {0x123F8888, 105383, 105410},
+    {0x12411603, 46527, 105439},
+    {0x12421460, 105448, 105458},
+    {0x12421560, 105497, 105507},
+    {0x12424643, 105547, 105575},
+    {0x12440700, 105617, 105620},
+    {0x12440800, 105636, 60515},
+    {0x12440A00, 105639, 60515},
+    {0x12440E00, 0, 105642},
+    {0x12441100, 105672, 60515},
+    {0x12441200, 105675, 60515},
+    {0x12442700, 105678, 105700},
+    {0x124D0000, 105729, 0},
+    {0x124D0002, 105746, 0},
+    {0x124D0003, 105763, 0},
+    {0x124F0041, 105774, 105783},
+    {0x12551110, 105803, 0},
+    {0x12551210, 105814, 0},
+    {0x12552110, 105826, 105840},
+    {0x12552120, 105868, 105883},
+    {0x12552130, 105904, 0},
+    {0x12564201, 105915, 105925},
+    {0x12564401, 105938, 105948},
+    {0x12565201, 105966, 105975},
+    {0x12581988, 0, 0},
+    {0x12592503, 106001, 0},
+    {0x12592560, 0, 106015},
+    {0x1259C107, 106055, 0},
+    {0x125B0B95, 106069, 106077},
+    {0x125B1400, 106120, 106129},
+    {0x125B1720, 106174, 106182},
+    {0x125D0000, 106212, 106220},
+    {0x125D1961, 54684, 106248},
+    {0x125D1968, 106269, 106276},
+    {0x125D1969, 106308, 106316},
+    {0x125D1978, 106345, 106352},
+    {0x125D1988, 106382, 106389},
+    {0x125D1989, 106417, 106424},
+    {0x125D1990, 106465, 0},
+    {0x125D1998, 106473, 106473},
+    {0x125D199B, 106484, 106508},
+    {0x125D2808, 106539, 106546},
+    {0x125D2828, 106574, 106582},
+    {0x125D2838, 106592, 106601},
+    {0x125D2839, 94505, 106616},
+    {0x125D2898, 106649, 106654},
+    {0x12603872, 106694, 106702},
+    {0x12603873, 106739, 106748},
+    {0x12603890, 106782, 106790},
+    {0x12608130, 106834, 106842},
+    {0x12608131, 106865, 106842},
+    {0x12660001, 0, 106873},
+    {0x12661910, 0, 106900},
+    {0x12671016, 0, 106937},
+    {0x12674243, 0, 106952},
+    {0x12675352, 106993, 0},
+    {0x12675A4B, 107001, 0},
+    {0x12680204, 50851, 107013},
+    {0x126C1F1F, 0, 107082},
+    {0x126F0710, 107123, 107129},
+    {0x126F0712, 107136, 107142},
+    {0x126F0720, 107150, 107164},
+    {0x126F0810, 107172, 107178},
+    {0x126F0811, 107184, 107178},
+    {0x126F0820, 107190, 107196},
+    {0x126F0910, 107203, 107209},
+    {0x12730002, 107224, 107232},
+    {0x12741274, 107243, 107249},
+    {0x12741371, 107273, 107281},
+    {0x12741373, 107290, 107297},
+    {0x12745000, 107290, 107281},
+    {0x12745880, 107243, 107322},
+    {0x12780701, 107331, 107340},
+    {0x12790060, 107353, 107360},
+    {0x12790061, 107389, 107398},
+    {0x12790295, 0, 107418},
+    {0x12790395, 107438, 53157},
+    {0x12790396, 0, 107446},
+    {0x12790397, 0, 107463},
+    {0x12829009, 107479, 63461},
+    {0x12829100, 0, 0},
+    {0x12829102, 107486, 107498},
+    {0x12830801, 107535, 107545},
+    {0x1283673A, 107570, 47077},
+    {0x12838152, 107535, 107578},
+    {0x12838172, 107614, 107622},
+    {0x12838211, 107660, 107668},
+    {0x12838212, 107691, 107699},
+    {0x12838330, 107570, 44487},
+    {0x12838872, 107727, 107737},
+    {0x12838875, 107783, 107791},
+    {0x12838888, 107809, 107817},
+    {0x12838889, 107844, 107852},
+    {0x12839876, 107783, 107858},
+    {0x1283E886, 107570, 36999},
+    {0x12850100, 107871, 107878},
+    {0x1287001E, 107899, 107906},
+    {0x1287001F, 107918, 107906},
+    {0x12870020, 107925, 107931},
+    {0x128AF001, 107954, 107970},
+    {0x128D0021, 0, 69483},
+    {0x129A0415, 108009, 108017},
+    {0x129A0515, 108056, 108064},
+    {0x129A0615, 108097, 108105},
+    {0x129A0715, 108159, 108181},
+    {0x129ADD10, 108235, 108240},
+    {0x129ADD11, 108298, 108304},
+    {0x129ADD12, 108362, 108371},
+    {0x12A3ECB8, 100988, 108429},
+    {0x12AA5568, 108447, 108454},
+    {0x12AA556C, 0, 108487},
+    {0x12AB3000, 108516, 56767},
+    {0x12AE0001, 108527, 108533},
+    {0x12AE0002, 108570, 108578},
+    {0x12B903F0, 108610, 108618},
+    {0x12B91006, 108685, 108690},
+    {0x12B91007, 108717, 108726},
+    {0x12B91008, 108760, 108769},
+    {0x12BA0032, 108832, 108852},
+    {0x12C19080, 108891, 108910},
+    {0x12C30058, 108935, 108943},
+    {0x12C35598, 108975, 108983},
+    {0x12C40005, 109020, 109038},
+    {0x12C5007F, 109073, 109077},
+    {0x12C50081, 109106, 109113},
+    {0x12C50085, 0, 109137},
+    {0x12C50086, 109160, 109165},
+    {0x12C70546, 109189, 109197},
+    {0x12C70561, 0, 109213},
+    {0x12C70647, 0, 109244},
+    {0x12C70648, 0, 109261},
+    {0x12C70649, 0, 109261},
+    {0x12C70651, 0, 109278},
+    {0x12C70673, 0, 109291},
+    {0x12C70674, 0, 109308},
+    {0x12C70675, 0, 109325},
+    {0x12C70676, 0, 109341},
+    {0x12C70685, 0, 109354},
+    {0x12C70687, 0, 109372},
+    {0x12C70689, 109399, 109412},
+    {0x12C70707, 0, 109438},
+    {0x12C70708, 0, 109468},
+    {0x12CB0027, 109498, 0},
+    {0x12CB002D, 109509, 0},
+    {0x12CB002E, 109515, 0},
+    {0x12CB002F, 109523, 0},
+    {0x12CB0030, 109529, 0},
+    {0x12CB0031, 109535, 0},
+    {0x12CB0032, 109541, 109548},
+    {0x12CB0033, 109587, 0},
+    {0x12CB0034, 109594, 0},
+    {0x12CB0035, 109599, 0},
+    {0x12D40301, 109606, 109611},
+    {0x12D51000, 109652, 109659},
+    {0x12D51002, 109686, 109695},
+    {0x12D871E2, 109720, 109729},
+    {0x12D88150, 109754, 109763},
+    {0x12D88152, 109788, 109797},
+    {0x12D8E130, 109822, 51696},
+    {0x12DB0003, 0, 109832},
+    {0x12DE0200, 0, 109843},
+    {0x12DF2102, 109859, 48543},
+    {0x12DF8236, 50851, 109878},
+    {0x12E00010, 109893, 109902},
+    {0x12E00020, 109893, 109902},
+    {0x12E00030, 109893, 109902},
+    {0x12E41000, 109912, 109923},
+    {0x12E41140, 0, 60515},
+    {0x12E4B005, 109938, 109949},
+    {0x12E4B006, 109938, 109949},
+    {0x12EB0001, 109964, 109971},
+    {0x12EB0002, 110004, 110013},
+    {0x12EB0003, 110038, 110053},
+    {0x12EC8139, 110070, 110070},
+    {0x12F21002, 110076, 110090},
+    {0x12F23059, 88254, 88297},
+    {0x12F80002, 110110, 110121},
+    {0x12FC5CEC, 110129, 110142},
+    {0x13030001, 110151, 110156},
+    {0x13030002, 46527, 110181},
+    {0x13030003, 46527, 110200},
+    {0x13030004, 46527, 110220},
+    {0x13030005, 46527, 110259},
+    {0x13030006, 46527, 110291},
+    {0x13030007, 46527, 110309},
+    {0x13030008, 46527, 110327},
+    {0x13030009, 46527, 110343},
+    {0x13070001, 110364, 0},
+    {0x13070006, 70987, 0},
+    {0x1307000B, 110379, 0},
+    {0x1307000C, 110390, 0},
+    {0x1307000D, 110401, 0},
+    {0x1307000F, 110413, 0},
+    {0x13070010, 110425, 0},
+    {0x13070014, 110440, 0},
+    {0x13070015, 110451, 0},
+    {0x13070016, 110467, 0},
+    {0x13070017, 110484, 0},
+    {0x13070018, 110495, 0},
+    {0x13070019, 110505, 0},
+    {0x1307001A, 110520, 0},
+    {0x1307001B, 110532, 0},
+    {0x1307001C, 110544, 0},
+    {0x1307001D, 110561, 0},
+    {0x1307001E, 110576, 0},
+    {0x1307001F, 110591, 0},
+    {0x13070020, 110604, 0},
+    {0x13070021, 110617, 0},
+    {0x13070022, 110630, 0},
+    {0x13070023, 110643, 0},
+    {0x13070024, 110656, 0},
+    {0x13070025, 110669, 0},
+    {0x13070026, 110682, 0},
+    {0x13070027, 110698, 0},
+    {0x13070028, 110714, 110724},
+    {0x13070029, 110758, 0},
+    {0x1307002C, 110768, 0},
+    {0x13070033, 110778, 0},
+    {0x13070034, 110791, 0},
+    {0x13070035, 110802, 0},
+    {0x13070036, 110818, 0},
+    {0x13070037, 110834, 0},
+    {0x1307004C, 110850, 0},
+    {0x1307004D, 110862, 0},
+    {0x13070064, 110873, 110883},
+    {0x13080001, 0, 110945},
+    {0x13100003, 110966, 110971},
+    {0x1310000D, 0, 110992},
+    {0x13170531, 111008, 111030},
+    {0x13170981, 111044, 111050},
+    {0x13170985, 111087, 111050},
+    {0x13171985, 111094, 111100},
+    {0x13172850, 111140, 111144},
+    {0x13175120, 111161, 111169},
+    {0x13177892, 111197, 111144},
+    {0x13178201, 111208, 111216},
+    {0x13179511, 111242, 111250},
+    {0x13179513, 111283, 111250},
+    {0x13180911, 111291, 111300},
+    {0x13190801, 111330, 111337},
+    {0x13190802, 111375, 111384},
+    {0x13191000, 111375, 52024},
+    {0x13191001, 111403, 111409},
+    {0x13191319, 111422, 111432},
+    {0x13194901, 111459, 111468},
+    {0x131F2002, 0, 111494},
+    {0x131F2011, 0, 111512},
+    {0x131F2012, 0, 111530},
+    {0x131F2020, 111548, 111563},
+    {0x131F2042, 0, 111588},
+    {0x131F2050, 111606, 111606},
+    {0x131F2051, 0, 111642},
+    {0x131F2052, 0, 111494},
+    {0x131F2060, 0, 111660},
+    {0x131F2061, 0, 111678},
+    {0x131F2062, 0, 111696},
+    {0x13288888, 111714, 111722},
+    {0x13325410, 111754, 111763},
+    {0x13325415, 111791, 111801},
+    {0x13325425, 111834, 111844},
+    {0x13326140, 111882, 111891},
+    {0x133D1000, 111905, 111922},
+    {0x13443240, 0, 111942},
+    {0x13443320, 111977, 51382},
+    {0x13443321, 111990, 51382},
+    {0x13443470, 111996, 47285},
+    {0x13444020, 0, 112009},
+    {0x13444030, 0, 112050},
+    {0x134A0001, 112091, 112107},
+    {0x134A0002, 0, 112142},
+    {0x134A3510, 112177, 112186},
+    {0x134D2188, 112191, 112201},
+    {0x134D2189, 112207, 31959},
+    {0x134D2486, 112215, 112221},
+    {0x134D7890, 112191, 30893},
+    {0x134D7891, 112236, 112245},
+    {0x134D7892, 111197, 111144},
+    {0x134D7893, 112263, 112245},
+    {0x134D7894, 112273, 112245},
+    {0x134D7895, 112278, 112245},
+    {0x134D7896, 112286, 112245},
+    {0x134D7897, 112296, 112305},
+    {0x134D9714, 112331, 19188},
+    {0x134DD800, 112342, 112352},
+    {0x135A0224, 112368, 112376},
+    {0x135E5101, 112394, 112399},
+    {0x135E5102, 112408, 112416},
+    {0x135E7101, 0, 112440},
+    {0x135E7201, 0, 112471},
+    {0x135E7202, 0, 112506},
+    {0x135E7401, 0, 112533},
+    {0x135E7402, 0, 112560},
+    {0x135E7801, 0, 112591},
+    {0x135E8001, 112619, 112624},
+    {0x13600101, 112644, 112650},
+    {0x13600102, 112668, 112650},
+    {0x13600103, 112675, 112650},
+    {0x13600104, 112682, 112650},
+    {0x13600105, 112689, 112696},
+    {0x13600201, 112711, 112721},
+    {0x13600202, 112734, 112721},
+    {0x13600203, 112744, 112721},
+    {0x13600204, 112754, 112721},
+    {0x13600205, 112764, 112721},
+    {0x13600301, 112774, 112784},
+    {0x13600302, 112805, 112784},
+    {0x13600303, 112815, 112784},
+    {0x13600304, 112825, 112835},
+    {0x13659050, 112858, 0},
+    {0x137A0001, 0, 0},
+    {0x13822009, 112864, 112912},
+    {0x13822048, 0, 112958},
+    {0x13822088, 112981, 112993},
+    {0x13854100, 113016, 113022},
+    {0x13854105, 0, 0},
+    {0x1385620A, 113047, 0},
+    {0x1385622A, 113053, 0},
+    {0x1385630A, 113059, 0},
+    {0x13858169, 113065, 97213},
+    {0x1385F311, 113071, 77985},
+    {0x1385F312, 0, 0},
+    {0x13875310, 45338, 113077},
+    {0x13890001, 113092, 113103},
+    {0x13890104, 113132, 113142},
+    {0x13931010, 0, 0},
+    {0x13931020, 0, 0},
+    {0x13931040, 113160, 113170},
+    {0x13931041, 0, 0},
+    {0x13931042, 0, 0},
+    {0x13931140, 0, 0},
+    {0x13931141, 0, 0},
+    {0x13931320, 113178, 113185},
+    {0x13931321, 0, 0},
+    {0x13931340, 0, 0},
+    {0x13931401, 0, 0},
+    {0x13931680, 113194, 113170},
+    {0x13931681, 113204, 113212},
+    {0x13932040, 113239, 113247},
+    {0x13932180, 113256, 113261},
+    {0x13932210, 113280, 113280},
+    {0x13932240, 113280, 113280},
+    {0x13933200, 113284, 113261},
+    {0x13935020, 0, 0},
+    {0x13936800, 113289, 113296},
+    {0x13940001, 113313, 97213},
+    {0x13970B4D, 113321, 113337},
+    {0x13972BD0, 113363, 113337},
+    {0x13978B4D, 113384, 113337},
+    {0x1397B000, 113404, 113409},
+    {0x1397B006, 113422, 113409},
+    {0x1397B007, 113427, 113409},
+    {0x1397B008, 113432, 113409},
+    {0x1397B009, 113437, 113409},
+    {0x1397B00A, 113442, 113409},
+    {0x1397B00B, 113447, 113409},
+    {0x1397B00C, 113452, 113409},
+    {0x1397B100, 113457, 113409},
+    {0x139A0007, 113462, 113470},
+    {0x13A30005, 113498, 113503},
+    {0x13A30006, 113522, 113527},
+    {0x13A30007, 113548, 113503},
+    {0x13A30012, 113553, 113503},
+    {0x13A30014, 113558, 113503},
+    {0x13A30015, 113573, 113503},
+    {0x13A30016, 113573, 113503},
+    {0x13A30017, 113578, 113503},
+    {0x13A30018, 113583, 113503},
+    {0x13A3001D, 113588, 113593},
+    {0x13A30020, 113617, 113593},
+    {0x13A76240, 113627, 113646},
+    {0x13A80152, 113657, 113666},
+    {0x13A80154, 113676, 113685},
+    {0x13A80158, 113711, 113720},
+    {0x13B613B6, 113752, 113759},
+    {0x13C00010, 113765, 113782},
+    {0x13C00020, 113823, 113836},
+    {0x13C00030, 113887, 113911},
+    {0x13C00070, 113947, 113782},
+    {0x13C00080, 113967, 113911},
+    {0x13C00090, 113988, 114008},
+    {0x13C000A0, 114045, 114066},
+    {0x13C00210, 114102, 113782},
+    {0x13C11000, 114136, 114144},
+    {0x13C11001, 114164, 114181},
+    {0x13C11002, 114208, 114220},
+    {0x13C11003, 114249, 114270},
+    {0x13C11004, 114292, 114306},
+    {0x13C70ADC, 0, 114340},
+    {0x13C70B10, 114380, 114382},
+    {0x13C70D10, 114380, 114400},
+    {0x13C75744, 114380, 114417},
+    {0x13D02103, 114431, 114439},
+    {0x13D02200, 0, 0},
+    {0x13D1AB02, 0, 0},
+    {0x13D1AB03, 0, 0},
+    {0x13D1AB06, 114490, 114499},
+    {0x13D1AB08, 114540, 114550},
+    {0x13D78086, 114598, 114603},
+    {0x13DF0001, 114608, 64536},
+    {0x13EA3131, 114617, 114624},
+    {0x13EA3134, 114661, 114668},
+    {0x13F00200, 114710, 114719},
+    {0x13F00201, 114768, 114774},
+    {0x13F00300, 114796, 114803},
+    {0x13F01023, 114819, 39223},
+    {0x13F013F0, 114826, 114893},
+    {0x13F60100, 114921, 56767},
+    {0x13F60101, 114938, 114950},
+    {0x13F60111, 114967, 114984},
+    {0x13F60112, 115009, 115027},
+    {0x13F60211, 115042, 115060},
+    {0x13F60300, 115067, 115074},
+    {0x13FE1240, 115091, 115100},
+    {0x13FE1680, 115133, 115145},
+    {0x13FE1713, 115203, 115212},
+    {0x13FE1724, 115250, 115259},
+    {0x14000001, 0, 0},
+    {0x14000003, 0, 0},
+    {0x14000004, 115306, 115306},
+    {0x14001401, 115314, 115322},
+    {0x14022E00, 115332, 115345},
+    {0x14024610, 115379, 115387},
+    {0x14024650, 115431, 115387},
+    {0x14070100, 115439, 115444},
+    {0x14070101, 0, 115469},
+    {0x14070102, 0, 115490},
+    {0x14070110, 0, 115511},
+    {0x14070111, 0, 115535},
+    {0x14070120, 0, 115559},
+    {0x14070121, 0, 115584},
+    {0x14070180, 0, 115609},
+    {0x14070181, 0, 115636},
+    {0x14070200, 115663, 115668},
+    {0x14070201, 0, 115690},
+    {0x14070202, 0, 115716},
+    {0x14070220, 0, 115690},
+    {0x14070221, 0, 115716},
+    {0x14070400, 0, 115742},
+    {0x14070500, 0, 115760},
+    {0x14070510, 0, 115787},
+    {0x14070511, 0, 115810},
+    {0x14070520, 0, 115837},
+    {0x14070600, 115855, 115864},
+    {0x14070A00, 115881, 115894},
+    {0x14078000, 0, 115915},
+    {0x14078001, 0, 115929},
+    {0x14078002, 115663, 115929},
+    {0x14078003, 0, 115955},
+    {0x14078800, 0, 115981},
+    {0x14097168, 116002, 116011},
+    {0x14097268, 116061, 116112},
+    {0x140B0610, 0, 0},
+    {0x14121712, 116130, 116138},
+    {0x14121724, 116173, 116183},
+    {0x14158401, 116230, 116237},
+    {0x14158403, 116230, 116264},
+    {0x14159500, 116278, 116289},
+    {0x14159501, 116278, 109902},
+    {0x14159505, 116310, 113666},
+    {0x1415950A, 116278, 116322},
+    {0x1415950B, 116337, 116345},
+    {0x14159510, 116278, 116378},
+    {0x14159511, 116403, 116410},
+    {0x14159512, 116278, 116443},
+    {0x14159513, 116278, 116264},
+    {0x14159521, 116471, 113666},
+    {0x14159523, 116471, 116482},
+    {0x141F6181, 116507, 116512},
+    {0x14350531, 116525, 116525},
+    {0x14356020, 116532, 116540},
+    {0x14356030, 116558, 116566},
+    {0x14356420, 116588, 116566},
+    {0x14356430, 116598, 116566},
+    {0x14357520, 116608, 116615},
+    {0x14357540, 116638, 116646},
+    {0x14480001, 116683, 116693},
+    {0x144A7230, 0, 0},
+    {0x144A7248, 116707, 116716},
+    {0x144A7250, 116728, 116716},
+    {0x144A7296, 116737, 116761},
+    {0x144A7432, 116784, 0},
+    {0x144A7433, 116793, 116802},
+    {0x144A7434, 116827, 0},
+    {0x144A7841, 116836, 116845},
+    {0x144A8133, 116884, 0},
+    {0x144A8554, 116893, 0},
+    {0x144A9111, 116902, 0},
+    {0x144A9113, 116911, 0},
+    {0x144A9114, 116920, 0},
+    {0x144B0601, 0, 0},
+    {0x145F0001, 116929, 116942},
+    {0x145F0002, 116971, 116942},
+    {0x146200C1, 79586, 116986},
+    {0x14624720, 117000, 117004},
+    {0x14625071, 117000, 117004},
+    {0x14627120, 0, 0},
+    {0x14627960, 117021, 117021},
+    {0x14710188, 117027, 117041},
+    {0x148C4011, 41335, 117050},
+    {0x148C4152, 117080, 117087},
+    {0x148D1003, 117094, 117115},
+    {0x14A9AD1F, 46527, 46527},
+    {0x14B11033, 117153, 117162},
+    {0x14B30000, 117172, 117192},
+    {0x14B50200, 117200, 0},
+    {0x14B50300, 117206, 0},
+    {0x14B50400, 117213, 0},
+    {0x14B50600, 117224, 0},
+    {0x14B50800, 0, 117233},
+    {0x14B50900, 0, 117233},
+    {0x14B50A00, 0, 117233},
+    {0x14B50B00, 0, 117233},
+    {0x14B70001, 117243, 117257},
+    {0x14B90001, 117265, 117272},
+    {0x14B90340, 0, 117284},
+    {0x14B92500, 117325, 117335},
+    {0x14B93100, 117360, 117335},
+    {0x14B93101, 117360, 117335},
+    {0x14B93500, 117370, 117335},
+    {0x14B94500, 117380, 117335},
+    {0x14B94800, 117390, 117335},
+    {0x14B9A504, 117400, 117415},
+    {0x14B9A506, 117458, 117468},
+    {0x14C18043, 117495, 117510},
+    {0x14CF2920, 117518, 117535},
+    {0x14D40400, 117574, 117584},
+    {0x14D90010, 117599, 117613},
+    {0x14DB2100, 117648, 0},
+    {0x14DB2101, 117658, 0},
+    {0x14DB2102, 117672, 0},
+    {0x14DB2110, 117686, 116471},
+    {0x14DB2111, 117698, 0},
+    {0x14DB2112, 117714, 0},
+    {0x14DB2120, 117730, 117737},
+    {0x14DB2121, 117758, 0},
+    {0x14DB2130, 117768, 117778},
+    {0x14DB2131, 117801, 0},
+    {0x14DB2132, 117815, 0},
+    {0x14DB2140, 117829, 0},
+    {0x14DB2141, 117841, 0},
+    {0x14DB2142, 117857, 0},
+    {0x14DB2144, 117873, 0},
+    {0x14DB2145, 117885, 0},
+    {0x14DB2146, 117901, 0},
+    {0x14DB2150, 117917, 0},
+    {0x14DB2151, 117927, 0},
+    {0x14DB2152, 117941, 0},
+    {0x14DB2160, 117955, 0},
+    {0x14DB2161, 117967, 0},
+    {0x14DB2162, 117983, 0},
+    {0x14DB2180, 117999, 118009},
+    {0x14DB2181, 118062, 118076},
+    {0x14DB2182, 118097, 118076},
+    {0x14DC0000, 118111, 0},
+    {0x14DC0001, 118119, 118127},
+    {0x14DC0002, 118152, 118160},
+    {0x14DC0003, 118185, 118193},
+    {0x14DC0004, 118218, 118226},
+    {0x14DC0005, 118255, 118263},
+    {0x14DC0006, 118303, 118310},
+    {0x14DC0007, 118348, 118355},
+    {0x14DC0008, 118396, 118403},
+    {0x14DC0009, 118443, 118450},
+    {0x14DC000A, 118473, 118480},
+    {0x14DC000B, 118503, 118510},
+    {0x14DC000C, 118547, 118554},
+    {0x14E4034F, 83613, 44657},
+    {0x14E40800, 118583, 118596},
+    {0x14E40804, 118583, 118630},
+    {0x14E40805, 118583, 118649},
+    {0x14E40806, 118583, 118668},
+    {0x14E4080B, 118583, 118696},
+    {0x14E4080F, 118583, 118723},
+    {0x14E40811, 118583, 118754},
+    {0x14E40816, 118781, 118649},
+    {0x14E41600, 118789, 118797},
+    {0x14E41644, 118844, 118853},
+    {0x14E41645, 118891, 118899},
+    {0x14E41646, 118934, 118944},
+    {0x14E41647, 118971, 118944},
+    {0x14E41648, 118979, 118987},
+    {0x14E4164C, 119018, 119023},
+    {0x14E4164D, 119070, 119080},
+    {0x14E41653, 119115, 119123},
+    {0x14E41654, 119159, 118944},
+    {0x14E41659, 119169, 119177},
+    {0x14E4165D, 119216, 119123},
+    {0x14E4165E, 119225, 118944},
+    {0x14E4166A, 119231, 119236},
+    {0x14E41670, 118844, 119080},
+    {0x14E41673, 119277, 119123},
+    {0x14E41677, 119283, 119177},
+    {0x14E4167A, 119293, 119301},
+    {0x14E4167B, 119348, 118944},
+    {0x14E4167D, 119361, 119123},
+    {0x14E4167E, 119370, 119382},
+    {0x14E41693, 119391, 119401},
+    {0x14E41696, 119446, 119454},
+    {0x14E4169C, 119115, 119497},
+    {0x14E4169D, 119536, 119548},
+    {0x14E416A6, 119574, 72337},
+    {0x14E416A7, 119583, 72337},
+    {0x14E416A8, 118979, 118944},
+    {0x14E416AA, 119592, 119600},
+    {0x14E416C6, 119630, 118944},
+    {0x14E416C7, 119640, 72337},
+    {0x14E416F7, 119653, 119661},
+    {0x14E416FD, 119699, 119708},
+    {0x14E4170C, 119745, 119753},
+    {0x14E4170D, 119795, 119803},
+    {0x14E4170E, 119795, 119803},
+    {0x14E41713, 119824, 119832},
+    {0x14E43352, 119868, 119876},
+    {0x14E43360, 119918, 119926},
+    {0x14E44211, 119969, 119978},
+    {0x14E44212, 119989, 119998},
+    {0x14E44301, 120008, 120024},
+    {0x14E44303, 120057, 120065},
+    {0x14E44305, 120112, 120120},
+    {0x14E44306, 120135, 120143},
+    {0x14E44307, 120112, 120172},
+    {0x14E44310, 120204, 120212},
+    {0x14E44311, 120253, 120261},
+    {0x14E44312, 120204, 120320},
+    {0x14E44313, 120204, 120350},
+    {0x14E44315, 120204, 36752},
+    {0x14E44318, 120370, 120378},
+    {0x14E44320, 120397, 120406},
+    {0x14E44321, 120135, 120440},
+    {0x14E44322, 120135, 120472},
+    {0x14E44323, 120135, 120120},
+    {0x14E44324, 120477, 120485},
+    {0x14E44325, 120135, 120406},
+    {0x14E44326, 120135, 120521},
+    {0x14E44328, 120548, 120561},
+    {0x14E44401, 119745, 120613},
+    {0x14E44402, 120651, 120613},
+    {0x14E44403, 120651, 120120},
+    {0x14E44410, 120659, 120667},
+    {0x14E44411, 120687, 120120},
+    {0x14E44412, 120695, 120703},
+    {0x14E44430, 120724, 120732},
+    {0x14E44432, 120724, 120760},
+    {0x14E44610, 120789, 120797},
+    {0x14E44611, 120789, 120822},
+    {0x14E44612, 120789, 120850},
+    {0x14E44613, 120789, 118668},
+    {0x14E44614, 120789, 118754},
+    {0x14E44615, 120789, 120873},
+    {0x14E44704, 120896, 120797},
+    {0x14E44708, 120896, 120904},
+    {0x14E44710, 120923, 120797},
+    {0x14E44711, 120931, 120939},
+    {0x14E44712, 120931, 120967},
+    {0x14E44713, 120931, 118668},
+    {0x14E44714, 120931, 118754},
+    {0x14E44715, 120931, 120873},
+    {0x14E44716, 120931, 120990},
+    {0x14E44717, 120931, 121018},
+    {0x14E44718, 120931, 118696},
+    {0x14E44720, 121048, 121056},
+    {0x14E45365, 121065, 120797},
+    {0x14E45600, 121074, 121082},
+    {0x14E45605, 121127, 121082},
+    {0x14E45615, 121135, 121082},
+    {0x14E45625, 121143, 121082},
+    {0x14E45645, 121151, 121082},
+    {0x14E45670, 121159, 121167},
+    {0x14E45680, 121202, 121210},
+    {0x14E45690, 121261, 121269},
+    {0x14E45691, 121313, 121321},
+    {0x14E45802, 121368, 121376},
+    {0x14E45805, 121479, 121487},
+    {0x14E45820, 121588, 120904},
+    {0x14E45821, 121596, 120904},
+    {0x14E45822, 121604, 120904},
+    {0x14E45823, 121612, 120904},
+    {0x14E45824, 121620, 120904},
+    {0x14E45840, 121628, 120904},
+    {0x14E45841, 121636, 120904},
+    {0x14E45850, 121644, 120904},
+    {0x14E47321, 121652, 121657},
+    {0x14E47411, 121681, 121689},
+    {0x14EAAB06, 121725, 121737},
+    {0x14EB0020, 121776, 121783},
+    {0x14EB0C01, 121818, 121827},
+    {0x14F11035, 45039, 45039},
+    {0x14F11059, 121862, 121888},
+    {0x14F11611, 40654, 121897},
+    {0x14F12400, 45039, 45039},
+    {0x14F12702, 121921, 121932},
+    {0x14F12BFA, 50851, 121964},
+    {0x14F12C06, 121988, 121997},
+    {0x14F12F00, 122038, 122047},
+    {0x14F12F20, 122066, 122077},
+    {0x14F12F30, 122100, 122111},
+    {0x14F12F40, 83926, 122134},
+    {0x14F15045, 122150, 121997},
+    {0x14F15B7A, 122158, 122182},
+    {0x14F18800, 122262, 122268},
+    {0x14F18852, 122304, 122311},
+    {0x14F20001, 0, 122352},
+    {0x14F20002, 0, 122373},
+    {0x14F20120, 0, 122395},
+    {0x14F20121, 0, 107791},
+    {0x14F20122, 0, 122415},
+    {0x14F20123, 0, 122431},
+    {0x14F20124, 122454, 122459},
+    {0x14FD0001, 122479, 122485},
+    {0x15070001, 122521, 0},
+    {0x15070002, 122534, 0},
+    {0x15070003, 122549, 0},
+    {0x15070100, 122564, 0},
+    {0x15070431, 122582, 0},
+    {0x15074801, 64542, 0},
+    {0x15074802, 64564, 0},
+    {0x15074803, 64594, 0},
+    {0x15074806, 64599, 0},
+    {0x15160800, 122596, 107498},
+    {0x15160803, 122603, 122632},
+    {0x15160891, 122656, 122663},
+    {0x15192004, 122708, 122712},
+    {0x151A1002, 122730, 122739},
+    {0x151A1004, 122744, 0},
+    {0x151A1008, 122753, 0},
+    {0x151B9080, 122762, 122781},
+    {0x151F0568, 122796, 122804},
+    {0x15220100, 122838, 122847},
+    {0x15230008, 122866, 122875},
+    {0x15240510, 122902, 122910},
+    {0x15240530, 122944, 122959},
+    {0x15240550, 122944, 122984},
+    {0x15240610, 44657, 123011},
+    {0x15241211, 123044, 51929},
+    {0x15241225, 123052, 51929},
+    {0x15241410, 123060, 51929},
+    {0x15241411, 123068, 96685},
+    {0x15241412, 123083, 96685},
+    {0x15241420, 123060, 51929},
+    {0x15241421, 123092, 51929},
+    {0x15241422, 123103, 51929},
+    {0x153B1115, 123112, 123127},
+    {0x153B1143, 123188, 123198},
+    {0x153B6003, 123257, 48675},
+    {0x153FDEAD, 123270, 123278},
+    {0x15409524, 123293, 123301},
+    {0x15433052, 123353, 100937},
+    {0x15433155, 50851, 123362},
+    {0x154980FF, 123404, 123416},
+    {0x15550002, 123435, 123448},
+    {0x15581558, 0, 0},
+    {0x155E0020, 123474, 123479},
+    {0x15620001, 123509, 123517},
+    {0x15620002, 123550, 123558},
+    {0x15620003, 123602, 123610},
+    {0x156A5000, 123650, 123653},
+    {0x156A5100, 123650, 123688},
+    {0x1571A001, 123709, 123724},
+    {0x1571A002, 123741, 123757},
+    {0x1571A003, 123764, 123757},
+    {0x1571A004, 123780, 123757},
+    {0x1571A005, 123795, 123757},
+    {0x1571A006, 123810, 123757},
+    {0x1571A007, 123829, 123757},
+    {0x1571A008, 123847, 123757},
+    {0x1571A009, 123862, 123879},
+    {0x1571A00A, 123893, 123879},
+    {0x1571A00B, 123911, 123879},
+    {0x1571A00C, 123929, 123879},
+    {0x1571A00D, 123949, 123879},
+    {0x1571A00E, 123970, 123980},
+    {0x1571A201, 123987, 124002},
+    {0x1571A202, 124017, 124002},
+    {0x1571A203, 124033, 124002},
+    {0x1571A204, 124049, 124002},
+    {0x1571A205, 124064, 124002},
+    {0x1571A206, 124082, 124002},
+    {0x157C8001, 124097, 124105},
+    {0x15881100, 124129, 124143},
+    {0x15882000, 124183, 124192},
+    {0x15888023, 124235, 124243},
+    {0x158B0015, 124274, 124289},
+    {0x15920781, 124314, 75811},
+    {0x15920782, 124323, 124332},
+    {0x15920783, 124357, 75811},
+    {0x15920785, 124373, 75811},
+    {0x15920786, 124388, 75811},
+    {0x15920787, 124405, 124422},
+    {0x15920788, 124445, 75811},
+    {0x1592078A, 124454, 75811},
+    {0x15A20001, 124471, 124477},
+    {0x15AD0405, 124504, 124514},
+    {0x15AD0710, 0, 124514},
+    {0x15AD0720, 124527, 124534},
+    {0x15AD0801, 56458, 56458},
+    {0x15B00001, 124562, 124570},
+    {0x15B02BD0, 124576, 124581},
+    {0x15B35274, 124609, 124617},
+    {0x15B36278, 124630, 124644},
+    {0x15B83009, 124665, 124675},
+    {0x15BC0101, 124695, 124702},
+    {0x15BC0103, 124721, 124725},
+    {0x15BC2530, 44657, 58923},
+    {0x15BC2531, 44657, 124757},
+    {0x15BC2532, 44657, 124757},
+    {0x15BC2929, 124792, 124799},
+    {0x15D10001, 124822, 124829},
+    {0x15D10003, 124867, 124884},
+    {0x15D10004, 124920, 124936},
+    {0x15DC0001, 124976, 124986},
+    {0x15E20500, 0, 125010},
+    {0x15E80130, 125038, 125045},
+    {0x15E80131, 125058, 125067},
+    {0x15E91841, 125091, 125108},
+    {0x15F12F30, 125123, 125134},
+    {0x15F20001, 125148, 125156},
+    {0x15F20002, 125180, 125156},
+    {0x15F20003, 125191, 125204},
+    {0x16190400, 125233, 125245},
+    {0x16190440, 125282, 125294},
+    {0x16190610, 125332, 125344},
+    {0x16190620, 125381, 125245},
+    {0x16190640, 125393, 125294},
+    {0x16191610, 125405, 125344},
+    {0x16191612, 125417, 125430},
+    {0x16192610, 125470, 125485},
+    {0x16193640, 125521, 125294},
+    {0x16210020, 125533, 125543},
+    {0x16210021, 125586, 125596},
+    {0x16210022, 125639, 125649},
+    {0x16210023, 125692, 125701},
+    {0x16210024, 125744, 125755},
+    {0x16210025, 125787, 125802},
+    {0x16291003, 0, 125840},
+    {0x16292002, 0, 125865},
+    {0x162D0100, 0, 125892},
+    {0x162D0101, 0, 125917},
+    {0x162D0102, 0, 125917},
+    {0x162D0103, 0, 125917},
+    {0x162F1111, 125942, 125950},
+    {0x162F1112, 125977, 125984},
+    {0x16381100, 125996, 126005},
+    {0x163C3052, 126015, 126024},
+    {0x163CFF02, 126037, 126048},
+    {0x164F0001, 126070, 126079},
+    {0x164F0002, 126070, 126098},
+    {0x16580704, 126118, 126127},
+    {0x165AC100, 126189, 126199},
+    {0x165AD200, 126235, 126245},
+    {0x165AD300, 126277, 126245},
+    {0x165F2000, 126287, 126302},
+    {0x16680100, 126332, 46312},
+    {0x166D0001, 126337, 0},
+    {0x166D0002, 126378, 126429},
+    {0x167720AD, 126461, 126477},
+    {0x167F4634, 0, 126507},
+    {0x167F4C32, 0, 126519},
+    {0x167F5344, 0, 126533},
+    {0x167F5443, 0, 126545},
+    {0x168C0007, 126558, 126565},
+    {0x168C0011, 126590, 126565},
+    {0x168C0012, 126597, 126604},
+    {0x168C0013, 126642, 126657},
+    {0x168C001A, 126686, 126702},
+    {0x168C001B, 126762, 126770},
+    {0x168C001C, 126784, 126791},
+    {0x168C0024, 126805, 126812},
+    {0x168C1014, 126848, 126855},
+    {0x168CFF96, 126848, 126889},
+    {0x16930212, 126933, 126945},
+    {0x16930213, 126967, 126984},
+    {0x16CA0001, 127009, 127022},
+    {0x16EC0116, 127039, 127048},
+    {0x16EC1007, 127067, 127072},
+    {0x16EC2013, 127098, 127105},
+    {0x16EC2F00, 127138, 127177},
+    {0x16EC2F12, 127236, 127246},
+    {0x16EC3685, 44657, 127273},
+    {0x16EC5685, 127236, 127310},
+    {0x170B0100, 127358, 127370},
+    {0x17257174, 127388, 127396},
+    {0x1734007A, 127430, 127438},
+    {0x17341011, 127459, 127469},
+    {0x17341012, 95288, 127509},
+    {0x17341013, 118971, 127595},
+    {0x173B03E8, 127638, 97213},
+    {0x173B03EA, 127645, 97213},
+    {0x17438139, 127652, 127662},
+    {0x174B0260, 44555, 127693},
+    {0x174B0261, 44555, 127713},
+    {0x174B7176, 41335, 127746},
+    {0x174B7177, 44555, 127771},
+    {0x174B7C12, 44555, 127808},
+    {0x174B7C13, 44555, 127841},
+    {0x17531001, 127862, 127868},
+    {0x17531004, 127882, 127889},
+    {0x17550000, 127904, 127911},
+    {0x17AF4150, 127928, 127932},
+    {0x17CC2280, 127958, 127967},
+    {0x17D55831, 127993, 128003},
+    {0x17D55832, 128030, 128033},
+    {0x17EE4153, 39965, 40004},
+    {0x18133059, 88254, 88297},
+    {0x18134000, 128067, 128079},
+    {0x18134100, 128100, 128115},
+    {0x18140101, 128136, 128150},
+    {0x18140201, 128195, 128206},
+    {0x18140301, 128257, 128266},
+    {0x18140302, 128273, 128316},
+    {0x18882503, 128329, 71849},
+    {0x18882504, 71775, 71781},
+    {0x18883503, 128335, 128347},
+    {0x18883505, 128335, 128366},
+    {0x18C91011, 128386, 128398},
+    {0x18C91012, 128414, 128398},
+    {0x18C91013, 128428, 128398},
+    {0x18C91014, 128443, 128398},
+    {0x18C91015, 128460, 128398},
+    {0x18C91016, 128476, 128398},
+    {0x18C92011, 128495, 128507},
+    {0x18C92012, 128520, 128507},
+    {0x18C92013, 128537, 128507},
+    {0x18C92014, 128548, 128507},
+    {0x18C92015, 128559, 128507},
+    {0x18C92016, 128570, 128507},
+    {0x18C92017, 128582, 128507},
+    {0x18C92021, 128594, 128507},
+    {0x18C93011, 128601, 128611},
+    {0x18CA0040, 128630, 128635},
+    {0x18F70001, 128649, 128662},
+    {0x18F70002, 128733, 128747},
+    {0x18F70004, 128806, 128820},
+    {0x18F7000A, 128879, 128893},
+    {0x19100001, 128948, 128959},
+    {0x19710001, 0, 128994},
+    {0x19711011, 0, 129034},
+    {0x19711021, 0, 129066},
+    {0x19AC0001, 129106, 120904},
+    {0x1B130001, 80960, 129114},
+    {0x1DE10391, 84075, 129138},
+    {0x1DE12020, 129148, 50418},
+    {0x1DE1690C, 129155, 129163},
+    {0x1DE1DC29, 129184, 129191},
+    {0x33880020, 129224, 129232},
+    {0x33880021, 129276, 129289},
+    {0x33880022, 129340, 47718},
+    {0x33880028, 129344, 129348},
+    {0x33880029, 129344, 129399},
+    {0x33880030, 129454, 129458},
+    {0x33880031, 129492, 129501},
+    {0x33888011, 18488, 37021},
+    {0x33888012, 129577, 36999},
+    {0x33888013, 0, 50377},
+    {0x3D3D0001, 129586, 55868},
+    {0x3D3D0002, 129598, 129610},
+    {0x3D3D0003, 129634, 129640},
+    {0x3D3D0004, 129665, 129671},
+    {0x3D3D0005, 61019, 129671},
+    {0x3D3D0006, 129689, 55868},
+    {0x3D3D0007, 129698, 129709},
+    {0x3D3D0008, 129739, 0},
+    {0x3D3D0009, 129754, 129765},
+    {0x3D3D000A, 129798, 0},
+    {0x3D3D000C, 129798, 0},
+    {0x3D3D000D, 129809, 55868},
+    {0x3D3D000E, 129818, 0},
+    {0x3D3D0030, 129833, 129842},
+    {0x3D3D0100, 129869, 129671},
+    {0x3D3D1004, 61019, 129881},
+    {0x3D3D3D04, 61019, 129671},
+    {0x3D3DFFFF, 129899, 0},
+    {0x40050300, 129909, 114950},
+    {0x40050308, 129909, 129914},
+    {0x40050309, 129939, 129947},
+    {0x40051064, 129968, 36651},
+    {0x40052128, 129976, 36651},
+    {0x40052301, 129985, 36651},
+    {0x40052302, 129993, 36651},
+    {0x40052303, 130001, 36651},
+    {0x40052364, 130009, 36651},
+    {0x40052464, 130017, 36651},
+    {0x40052501, 130025, 36651},
+    {0x40054000, 130041, 130049},
+    {0x41440040, 130063, 130071},
+    {0x41440041, 130087, 130103},
+    {0x41440042, 130120, 130103},
+    {0x41440043, 130131, 130139},
+    {0x41440044, 130160, 130167},
+    {0x41440045, 130198, 130103},
+    {0x41440046, 130209, 130103},
+    {0x41440049, 130220, 130228},
+    {0x4144004A, 130246, 130262},
+    {0x4144004F, 130289, 130262},
+    {0x41440050, 130301, 130313},
+    {0x41440051, 130331, 130331},
+    {0x416C0100, 130343, 0},
+    {0x416C0200, 130355, 0},
+    {0x4C530000, 130359, 130368},
+    {0x4D510200, 130387, 0},
+    {0x50532010, 0, 130394},
+    {0x53330551, 130416, 130423},
+    {0x53335333, 35297, 130432},
+    {0x53335631, 130436, 130443},
+    {0x53338800, 130468, 130475},
+    {0x53338801, 130502, 130509},
+    {0x53338810, 130536, 130543},
+    {0x53338811, 130567, 130577},
+    {0x53338812, 130589, 130597},
+    {0x53338813, 130609, 130616},
+    {0x53338814, 130646, 130653},
+    {0x53338815, 130664, 130671},
+    {0x5333883D, 130681, 130688},
+    {0x53338870, 130716, 0},
+    {0x53338880, 130724, 130731},
+    {0x53338881, 130724, 130770},
+    {0x53338882, 130724, 130809},
+    {0x53338883, 130724, 130848},
+    {0x533388B0, 130887, 130894},
+    {0x533388B1, 130887, 130933},
+    {0x533388B2, 130887, 130972},
+    {0x533388B3, 130887, 131011},
+    {0x533388C0, 131050, 131057},
+    {0x533388C1, 131050, 131096},
+    {0x533388C2, 131050, 131135},
+    {0x533388C3, 131050, 131174},
+    {0x533388D0, 130502, 131213},
+    {0x533388D1, 130502, 131252},
+    {0x533388D2, 130502, 131293},
+    {0x533388D3, 130502, 131333},
+    {0x533388F0, 131374, 131381},
+    {0x533388F1, 131374, 131420},
+    {0x533388F2, 131374, 131459},
+    {0x533388F3, 131374, 131498},
+    {0x53338900, 131537, 131544},
+    {0x53338901, 131556, 131564},
+    {0x53338902, 130416, 131597},
+    {0x53338903, 0, 131608},
+    {0x53338904, 131621, 131632},
+    {0x53338905, 131647, 131654},
+    {0x53338906, 131647, 131654},
+    {0x53338907, 131647, 131654},
+    {0x53338908, 131681, 131654},
+    {0x53338909, 131692, 131654},
+    {0x5333890A, 131700, 131654},
+    {0x5333890B, 131711, 131654},
+    {0x5333890C, 0, 131654},
+    {0x5333890D, 0, 131654},
+    {0x5333890E, 131681, 131654},
+    {0x5333890F, 131647, 131654},
+    {0x53338A01, 131726, 131740},
+    {0x53338A10, 131760, 131767},
+    {0x53338A11, 131778, 131785},
+    {0x53338A12, 131778, 131809},
+    {0x53338A13, 131821, 131828},
+    {0x53338A20, 131888, 131895},
+    {0x53338A21, 131906, 131913},
+    {0x53338A22, 131925, 131932},
+    {0x53338A23, 131941, 131932},
+    {0x53338A25, 131952, 131959},
+    {0x53338A26, 131967, 131975},
+    {0x53338C00, 131985, 131992},
+    {0x53338C01, 132012, 132019},
+    {0x53338C02, 132039, 132046},
+    {0x53338C03, 132056, 132066},
+    {0x53338C10, 132079, 132098},
+    {0x53338C12, 132079, 132098},
+    {0x53338C13, 132123, 132130},
+    {0x53338C22, 132140, 132147},
+    {0x53338C2A, 132166, 132173},
+    {0x53338C2B, 132192, 132199},
+    {0x53338C2C, 132222, 132229},
+    {0x53338C2D, 132244, 132251},
+    {0x53338C2E, 132270, 132277},
+    {0x53338C2F, 132299, 132306},
+    {0x53338D01, 132326, 132337},
+    {0x53338D02, 132355, 132362},
+    {0x53338D04, 132372, 132379},
+    {0x53338E00, 132393, 132404},
+    {0x53338E01, 130536, 132422},
+    {0x53339102, 132437, 132444},
+    {0x5333CA00, 132461, 132468},
+    {0x544C0350, 0, 0},
+    {0x55550003, 132501, 132537},
+    {0x66660001, 132571, 132575},
+    {0x66660002, 0, 132582},
+    {0x80860008, 0, 132589},
+    {0x80860309, 132627, 132633},
+    {0x8086030D, 132670, 132676},
+    {0x80860318, 132713, 132719},
+    {0x80860319, 132713, 132719},
+    {0x80860326, 132774, 132782},
+    {0x80860327, 132812, 132820},
+    {0x80860329, 132812, 132852},
+    {0x8086032A, 132812, 132888},
+    {0x8086032C, 132924, 132932},
+    {0x80860330, 132966, 132972},
+    {0x80860331, 132966, 132989},
+    {0x80860332, 132966, 133006},
+    {0x80860333, 132966, 133023},
+    {0x80860334, 132966, 133040},
+    {0x80860335, 133065, 51696},
+    {0x80860336, 133065, 133071},
+    {0x80860340, 133102, 133108},
+    {0x80860341, 133102, 133140},
+    {0x80860370, 133172, 133178},
+    {0x80860371, 133172, 133222},
+    {0x80860372, 133172, 133235},
+    {0x80860373, 133172, 133279},
+    {0x80860374, 133172, 133040},
+    {0x80860482, 133292, 133300},
+    {0x80860483, 133323, 133334},
+    {0x80860484, 133361, 133372},
+    {0x80860486, 133387, 133395},
+    {0x808604A3, 133440, 133451},
+    {0x80860500, 133489, 133495},
+    {0x80860501, 133489, 81703},
+    {0x80860502, 133489, 133520},
+    {0x80860503, 133489, 133539},
+    {0x80860510, 133580, 133588},
+    {0x80860511, 133580, 133628},
+    {0x80860512, 133580, 133649},
+    {0x80860513, 133580, 133670},
+    {0x80860514, 133580, 133691},
+    {0x80860515, 133580, 133712},
+    {0x80860516, 133580, 133734},
+    {0x80860530, 133775, 133520},
+    {0x80860531, 133775, 133783},
+    {0x80860532, 133775, 133802},
+    {0x80860533, 133775, 133821},
+    {0x80860534, 133775, 133840},
+    {0x80860535, 133775, 133859},
+    {0x80860536, 133775, 133878},
+    {0x80860537, 133775, 133919},
+    {0x80860600, 0, 133954},
+    {0x80860960, 133978, 133986},
+    {0x80860962, 134016, 134027},
+    {0x80860964, 133978, 134059},
+    {0x80861000, 134089, 39223},
+    {0x80861001, 134095, 134100},
+    {0x80861002, 0, 134140},
+    {0x80861004, 134172, 134180},
+    {0x80861008, 134217, 134180},
+    {0x80861009, 134228, 134236},
+    {0x8086100C, 134272, 134180},
+    {0x8086100D, 134283, 134291},
+    {0x8086100E, 134325, 39223},
+    {0x8086100F, 134333, 134341},
+    {0x80861010, 134378, 134386},
+    {0x80861011, 134333, 134236},
+    {0x80861012, 134378, 134433},
+    {0x80861013, 134479, 134180},
+    {0x80861014, 134487, 39223},
+    {0x80861015, 134325, 134291},
+    {0x80861016, 134495, 134291},
+    {0x80861017, 134495, 134291},
+    {0x80861018, 134479, 134503},
+    {0x80861019, 134533, 134291},
+    {0x8086101A, 134533, 134291},
+    {0x8086101D, 134378, 134541},
+    {0x8086101E, 134495, 134579},
+    {0x80861026, 134616, 39223},
+    {0x80861027, 134616, 134236},
+    {0x80861028, 134616, 39223},
+    {0x80861029, 134624, 134630},
+    {0x80861030, 134667, 134674},
+    {0x80861031, 134696, 134705},
+    {0x80861032, 134696, 134705},
+    {0x80861033, 134696, 134735},
+    {0x80861034, 134696, 134735},
+    {0x80861035, 134765, 134773},
+    {0x80861036, 134765, 134773},
+    {0x80861037, 134696, 134802},
+    {0x80861038, 134696, 134817},
+    {0x80861039, 134850, 134859},
+    {0x8086103A, 134894, 134902},
+    {0x8086103B, 134894, 134943},
+    {0x8086103C, 134894, 134978},
+    {0x8086103D, 134894, 134705},
+    {0x8086103E, 134894, 134735},
+    {0x80861040, 135019, 135025},
+    {0x80861042, 0, 135055},
+    {0x80861043, 49861, 135086},
+    {0x80861048, 135129, 135137},
+    {0x8086104A, 135168, 72337},
+    {0x80861050, 135176, 134705},
+    {0x80861051, 135176, 134705},
+    {0x80861052, 135176, 134735},
+    {0x80861053, 135176, 134735},
+    {0x80861054, 135176, 135187},
+    {0x80861055, 135176, 135226},
+    {0x80861059, 135265, 134630},
+    {0x80861064, 135273, 135286},
+    {0x80861065, 135298, 134802},
+    {0x80861068, 135316, 135322},
+    {0x80861075, 134533, 39223},
+    {0x80861076, 134479, 39223},
+    {0x80861077, 134533, 134579},
+    {0x80861078, 134487, 39223},
+    {0x80861079, 134378, 134541},
+    {0x8086107A, 134378, 134433},
+    {0x8086107B, 134378, 134386},
+    {0x80861080, 135376, 53988},
+    {0x8086108B, 135387, 135396},
+    {0x8086108C, 135445, 135452},
+    {0x80861092, 135514, 135519},
+    {0x8086109A, 135549, 135556},
+    {0x808610B9, 135590, 135598},
+    {0x80861100, 135624, 135635},
+    {0x80861101, 135624, 44544},
+    {0x80861102, 135674, 135680},
+    {0x80861110, 135674, 135635},
+    {0x80861112, 135674, 135680},
+    {0x80861120, 135674, 135635},
+    {0x80861121, 135674, 44544},
+    {0x80861130, 135705, 135635},
+    {0x80861131, 135705, 44544},
+    {0x80861132, 135722, 135728},
+    {0x80861161, 135775, 135783},
+    {0x80861162, 135799, 135804},
+    {0x80861179, 134378, 134541},
+    {0x80861200, 135839, 135847},
+    {0x80861209, 135865, 135876},
+    {0x80861221, 135901, 53440},
+    {0x80861222, 135901, 97624},
+    {0x80861223, 135909, 68136},
+    {0x80861225, 135920, 135931},
+    {0x80861226, 135972, 135978},
+    {0x80861227, 135998, 136005},
+    {0x80861228, 136025, 136042},
+    {0x80861229, 136083, 136097},
+    {0x8086122D, 136126, 136134},
+    {0x8086122E, 136158, 136166},
+    {0x80861230, 136193, 136203},
+    {0x80861231, 136226, 136232},
+    {0x80861234, 136243, 136251},
+    {0x80861235, 136289, 136297},
+    {0x80861237, 136329, 136340},
+    {0x80861239, 136158, 136203},
+    {0x8086123B, 136357, 136365},
+    {0x8086123C, 136391, 136399},
+    {0x8086123D, 136431, 136438},
+    {0x8086123E, 136468, 136476},
+    {0x8086123F, 136468, 136476},
+    {0x80861240, 136514, 136520},
+    {0x8086124B, 136545, 136550},
+    {0x80861250, 136583, 136591},
+    {0x808612D8, 136615, 136620},
+    {0x80861360, 135775, 136656},
+    {0x80861361, 135775, 136684},
+    {0x80861460, 136714, 136722},
+    {0x80861461, 136750, 132782},
+    {0x80861462, 136714, 136759},
+    {0x80861960, 133978, 136779},
+    {0x80861962, 44657, 136801},
+    {0x80861A12, 44657, 136846},
+    {0x80861A13, 44657, 136846},
+    {0x80861A20, 136884, 0},
+    {0x80861A21, 136884, 136890},
+    {0x80861A22, 136884, 136931},
+    {0x80861A23, 136884, 44544},
+    {0x80861A24, 136884, 136965},
+    {0x80861A30, 136988, 137008},
+    {0x80861A31, 137034, 44544},
+    {0x80861A38, 137047, 137052},
+    {0x80862125, 137083, 137091},
+    {0x80862410, 137083, 137192},
+    {0x80862411, 137083, 137206},
+    {0x80862412, 137083, 36752},
+    {0x80862413, 137083, 40542},
+    {0x80862415, 137235, 137273},
+    {0x80862416, 137083, 137322},
+    {0x80862418, 137083, 136722},
+    {0x80862420, 137345, 137192},
+    {0x80862421, 137345, 137353},
+    {0x80862422, 137345, 36752},
+    {0x80862423, 137345, 40542},
+    {0x80862425, 137382, 137389},
+    {0x80862426, 137345, 137405},
+    {0x80862428, 137345, 136722},
+    {0x80862431, 137427, 137433},
+    {0x80862440, 137441, 137449},
+    {0x80862441, 137441, 137206},
+    {0x80862442, 137476, 137488},
+    {0x80862443, 137510, 40542},
+    {0x80862444, 137476, 137519},
+    {0x80862445, 137476, 137541},
+    {0x80862446, 137476, 137405},
+    {0x80862448, 137570, 136656},
+    {0x80862449, 137587, 137595},
+    {0x8086244A, 137654, 47077},
+    {0x8086244B, 137441, 47077},
+    {0x8086244C, 137654, 79973},
+    {0x8086244E, 134894, 136656},
+    {0x80862450, 137663, 79973},
+    {0x80862452, 137663, 36752},
+    {0x80862453, 137663, 40542},
+    {0x80862459, 137663, 137670},
+    {0x8086245B, 137663, 47077},
+    {0x8086245D, 137663, 137686},
+    {0x8086245E, 137663, 136656},
+    {0x80862480, 137702, 79973},
+    {0x80862481, 137702, 137206},
+    {0x80862482, 137710, 36752},
+    {0x80862483, 137710, 40542},
+    {0x80862484, 137710, 36752},
+    {0x80862485, 137710, 137722},
+    {0x80862486, 137710, 137744},
+    {0x80862487, 137710, 36752},
+    {0x8086248A, 134696, 137767},
+    {0x8086248B, 137702, 137791},
+    {0x8086248C, 134696, 137819},
+    {0x8086248D, 137858, 137866},
+    {0x808624C0, 137891, 79973},
+    {0x808624C2, 137903, 137919},
+    {0x808624C3, 137903, 100937},
+    {0x808624C4, 137903, 137942},
+    {0x808624C5, 137962, 137969},
+    {0x808624C6, 49861, 137405},
+    {0x808624C7, 137903, 137977},
+    {0x808624CA, 138000, 138009},
+    {0x808624CB, 137891, 138009},
+    {0x808624CC, 138000, 79973},
+    {0x808624CD, 137903, 138039},
+    {0x808624D0, 135176, 79973},
+    {0x808624D1, 138059, 99192},
+    {0x808624D2, 135176, 137919},
+    {0x808624D3, 135176, 40542},
+    {0x808624D4, 135176, 138067},
+    {0x808624D5, 138090, 138099},
+    {0x808624D6, 135176, 137322},
+    {0x808624D7, 135176, 137977},
+    {0x808624DB, 135176, 50377},
+    {0x808624DC, 138059, 138152},
+    {0x808624DD, 135176, 138039},
+    {0x808624DE, 135176, 138177},
+    {0x808624DF, 138200, 138208},
+    {0x80862500, 138231, 135635},
+    {0x80862501, 138231, 138237},
+    {0x80862502, 138231, 0},
+    {0x80862503, 138231, 0},
+    {0x80862504, 138231, 0},
+    {0x8086250B, 138231, 138237},
+    {0x8086250F, 138231, 44544},
+    {0x80862520, 138255, 138263},
+    {0x80862521, 138291, 138299},
+    {0x80862530, 138337, 138345},
+    {0x80862531, 138380, 138386},
+    {0x80862532, 138424, 44544},
+    {0x80862533, 138380, 138439},
+    {0x80862534, 138380, 138462},
+    {0x80862535, 138380, 37322},
+    {0x80862536, 138380, 37322},
+    {0x80862539, 138380, 138485},
+    {0x80862540, 138507, 138513},
+    {0x80862541, 138550, 138562},
+    {0x80862543, 138550, 138594},
+    {0x80862544, 138550, 138625},
+    {0x80862545, 138550, 138664},
+    {0x80862546, 138550, 138695},
+    {0x80862547, 138550, 138734},
+    {0x80862548, 138550, 138765},
+    {0x8086254C, 138804, 138810},
+    {0x80862550, 138826, 138810},
+    {0x80862551, 138832, 138841},
+    {0x80862552, 138861, 138873},
+    {0x80862553, 138826, 138891},
+    {0x80862554, 138826, 138925},
+    {0x8086255D, 138966, 138810},
+    {0x80862560, 138972, 138991},
+    {0x80862561, 138972, 139029},
+    {0x80862562, 137382, 139048},
+    {0x80862570, 139075, 139095},
+    {0x80862571, 139075, 138873},
+    {0x80862572, 139132, 139048},
+    {0x80862573, 139075, 139139},
+    {0x80862576, 139075, 139157},
+    {0x80862578, 139180, 139095},
+    {0x80862579, 139193, 138873},
+    {0x8086257A, 0, 0},
+    {0x8086257B, 139180, 139200},
+    {0x8086257E, 139180, 139157},
+    {0x80862580, 139218, 139228},
+    {0x80862581, 139258, 139278},
+    {0x80862582, 139302, 139310},
+    {0x80862584, 139349, 139228},
+    {0x80862588, 139359, 139365},
+    {0x80862589, 139359, 139393},
+    {0x8086258A, 139359, 139412},
+    {0x80862590, 139430, 139436},
+    {0x80862592, 0, 0},
+    {0x808625A1, 139509, 79973},
+    {0x808625A2, 139509, 47077},
+    {0x808625A3, 139509, 99192},
+    {0x808625A4, 139509, 40542},
+    {0x808625A6, 139509, 40362},
+    {0x808625A7, 139509, 137322},
+    {0x808625A9, 139509, 139517},
+    {0x808625AA, 139509, 139544},
+    {0x808625AB, 139509, 139571},
+    {0x808625AC, 139509, 139586},
+    {0x808625AD, 139509, 139592},
+    {0x808625AE, 139509, 139616},
+    {0x808625B0, 139509, 139646},
+    {0x80862600, 139680, 139686},
+    {0x80862601, 139680, 139704},
+    {0x80862602, 139680, 139723},
+    {0x80862603, 139680, 139743},
+    {0x80862604, 139680, 139763},
+    {0x80862605, 139680, 139783},
+    {0x80862606, 139680, 139803},
+    {0x80862607, 139680, 139823},
+    {0x80862640, 139843, 79973},
+    {0x80862641, 139854, 139863},
+    {0x80862651, 139893, 99192},
+    {0x80862652, 139901, 88880},
+    {0x80862653, 139854, 139909},
+    {0x80862658, 135298, 137919},
+    {0x80862659, 135298, 138067},
+    {0x8086265A, 135298, 137977},
+    {0x8086265B, 135298, 138177},
+    {0x8086265C, 135298, 139592},
+    {0x80862660, 135298, 139930},
+    {0x80862662, 135298, 139949},
+    {0x80862664, 139968, 139976},
+    {0x80862666, 135298, 139995},
+    {0x80862668, 140014, 140023},
+    {0x8086266A, 140065, 40542},
+    {0x8086266C, 135298, 134802},
+    {0x8086266D, 140076, 140127},
+    {0x8086266E, 140188, 140239},
+    {0x8086266F, 140309, 140321},
+    {0x80862681, 140358, 140366},
+    {0x80862770, 140421, 139365},
+    {0x80862771, 140421, 140436},
+    {0x80862772, 140463, 139048},
+    {0x8086277C, 140473, 140480},
+    {0x80862780, 140507, 140514},
+    {0x80862782, 140507, 140530},
+    {0x80862792, 140586, 140606},
+    {0x808627A0, 140664, 140671},
+    {0x808627A6, 140694, 140700},
+    {0x808627B8, 140716, 140722},
+    {0x808627C0, 49861, 140785},
+    {0x808627C3, 140825, 140837},
+    {0x808627C8, 45869, 137942},
+    {0x808627C9, 45869, 137942},
+    {0x808627CA, 45869, 137942},
+    {0x808627CB, 0, 137942},
+    {0x808627D8, 140871, 140880},
+    {0x808627DA, 140907, 40542},
+    {0x808627DC, 140916, 140930},
+    {0x808627DF, 140969, 140976},
+    {0x80862820, 140997, 40654},
+    {0x80862825, 40654, 141039},
+    {0x80862828, 141081, 141124},
+    {0x80862829, 49861, 141135},
+    {0x8086283A, 141178, 141191},
+    {0x8086283E, 141235, 141238},
+    {0x8086284B, 141276, 141283},
+    {0x80862850, 141315, 141124},
+    {0x80862930, 40654, 141358},
+    {0x80862992, 0, 141387},
+    {0x80862993, 0, 141412},
+    {0x80862994, 141452, 141459},
+    {0x80862997, 141496, 141506},
+    {0x808629A0, 141528, 141538},
+    {0x808629A1, 141582, 141608},
+    {0x808629B4, 141646, 141658},
+    {0x808629B7, 141646, 141702},
+    {0x80862A02, 50851, 141718},
+    {0x80863092, 141730, 141737},
+    {0x80863200, 141761, 71513},
+    {0x80863340, 141767, 137008},
+    {0x80863341, 141767, 44544},
+    {0x80863342, 141767, 51540},
+    {0x8086348D, 134479, 39223},
+    {0x80863575, 141775, 141785},
+    {0x80863576, 141824, 141834},
+    {0x80863577, 141850, 139048},
+    {0x80863578, 141775, 141860},
+    {0x80863579, 141878, 141884},
+    {0x8086357B, 141878, 139048},
+    {0x80863580, 141922, 137008},
+    {0x80863581, 141932, 141944},
+    {0x80863582, 141922, 139048},
+    {0x80863584, 141922, 141970},
+    {0x80863585, 141995, 142001},
+    {0x80863590, 142023, 142029},
+    {0x80863591, 142023, 142029},
+    {0x80863592, 142051, 142029},
+    {0x80863593, 142057, 142063},
+    {0x80863594, 142023, 142093},
+    {0x80863595, 142057, 142118},
+    {0x80863596, 142057, 142137},
+    {0x80863597, 142057, 142137},
+    {0x80863598, 142023, 139783},
+    {0x80863599, 142023, 142156},
+    {0x8086359A, 142023, 139743},
+    {0x8086359B, 142057, 142175},
+    {0x8086359E, 142057, 142208},
+    {0x80864000, 142230, 142238},
+    {0x80864220, 142253, 142260},
+    {0x80864222, 142293, 142302},
+    {0x80864223, 142340, 142348},
+    {0x80864224, 142442, 142469},
+    {0x80864227, 142494, 142502},
+    {0x80864229, 142532, 142546},
+    {0x8086422D, 142532, 142613},
+    {0x80864230, 142532, 142613},
+    {0x80864233, 142532, 142613},
+    {0x80865001, 142648, 142661},
+    {0x80865005, 142673, 142686},
+    {0x80865200, 0, 46312},
+    {0x80865201, 0, 113627},
+    {0x80865309, 132627, 142700},
+    {0x8086530D, 132670, 142739},
+    {0x80866960, 0, 142778},
+    {0x80867000, 142796, 142804},
+    {0x80867010, 142796, 142840},
+    {0x80867020, 142796, 142872},
+    {0x80867030, 142910, 51731},
+    {0x80867051, 142918, 142932},
+    {0x80867100, 136289, 142971},
+    {0x80867110, 143019, 143033},
+    {0x80867111, 143019, 143056},
+    {0x80867112, 143019, 143083},
+    {0x80867113, 143019, 143109},
+    {0x80867120, 137427, 135635},
+    {0x80867121, 137427, 143149},
+    {0x80867122, 143169, 135635},
+    {0x80867123, 143169, 143181},
+    {0x80867124, 143215, 135635},
+    {0x80867125, 143215, 143222},
+    {0x80867126, 143251, 143263},
+    {0x80867127, 143251, 143301},
+    {0x80867128, 143331, 143263},
+    {0x8086712A, 143346, 143263},
+    {0x80867180, 143361, 143400},
+    {0x80867181, 143440, 143452},
+    {0x80867182, 143487, 30893},
+    {0x80867190, 143496, 143507},
+    {0x80867191, 143496, 143535},
+    {0x80867192, 143496, 143569},
+    {0x80867194, 143605, 143613},
+    {0x80867195, 50069, 137722},
+    {0x80867196, 143632, 143646},
+    {0x80867198, 143605, 36999},
+    {0x80867199, 143605, 50377},
+    {0x8086719A, 143605, 143679},
+    {0x8086719B, 143605, 51457},
+    {0x808671A0, 143709, 56982},
+    {0x808671A1, 143605, 35450},
+    {0x808671A2, 143709, 56982},
+    {0x80867221, 137427, 143717},
+    {0x80867600, 143733, 143749},
+    {0x80867601, 143733, 50377},
+    {0x80867602, 143733, 58107},
+    {0x80867603, 143733, 143767},
+    {0x80867605, 143785, 143793},
+    {0x80867800, 143826, 136520},
+    {0x80868086, 143832, 143846},
+    {0x808684C4, 143855, 143866},
+    {0x808684C5, 143894, 143905},
+    {0x808684CA, 143940, 143948},
+    {0x808684CB, 143989, 144005},
+    {0x808684E0, 144025, 144033},
+    {0x808684E1, 144059, 144067},
+    {0x808684E2, 144090, 144098},
+    {0x808684E3, 144123, 144131},
+    {0x808684E4, 144157, 144165},
+    {0x808684E6, 136468, 144188},
+    {0x808684EA, 144222, 144230},
+    {0x808685A1, 139509, 51647},
+    {0x808685A2, 139509, 47077},
+    {0x808685A3, 139509, 80018},
+    {0x808685A4, 139509, 40542},
+    {0x808685A6, 139509, 40362},
+    {0x808685A7, 139509, 137322},
+    {0x808685A9, 139509, 139517},
+    {0x808685AA, 139509, 139544},
+    {0x80869620, 0, 144258},
+    {0x80869621, 144285, 141737},
+    {0x80869622, 144292, 141737},
+    {0x80869641, 144299, 141737},
+    {0x808696A1, 144306, 141737},
+    {0x80869874, 40703, 144314},
+    {0x80869876, 144331, 144336},
+    {0x8086B152, 144351, 46312},
+    {0x8086B154, 144360, 46312},
+    {0x8086B555, 144372, 144378},
+    {0x90040078, 144412, 144422},
+    {0x90041078, 144436, 144446},
+    {0x90041160, 144463, 39114},
+    {0x90042178, 144472, 50418},
+    {0x90043860, 0, 144481},
+    {0x90043B78, 144508, 144525},
+    {0x90045075, 144575, 144584},
+    {0x90045078, 144595, 144605},
+    {0x90045175, 144575, 144584},
+    {0x90045178, 144631, 144640},
+    {0x90045275, 144575, 144584},
+    {0x90045278, 144631, 144656},
+    {0x90045375, 144575, 144584},
+    {0x90045378, 144631, 144656},
+    {0x90045475, 144575, 144584},
+    {0x90045478, 144631, 144656},
+    {0x90045575, 144672, 144584},
+    {0x90045578, 144681, 144656},
+    {0x90045675, 144575, 144584},
+    {0x90045678, 144690, 144656},
+    {0x90045775, 144575, 144584},
+    {0x90045778, 144631, 144656},
+    {0x90045800, 144699, 144708},
+    {0x90045900, 144726, 144741},
+    {0x90045905, 144772, 144790},
+    {0x90046038, 144802, 144812},
+    {0x90046075, 144837, 144847},
+    {0x90046078, 144877, 144886},
+    {0x90046178, 144906, 144886},
+    {0x90046278, 144877, 144584},
+    {0x90046378, 144877, 144584},
+    {0x90046478, 144915, 144584},
+    {0x90046578, 144915, 144584},
+    {0x90046678, 144915, 144584},
+    {0x90046778, 144915, 144584},
+    {0x90046915, 144924, 66174},
+    {0x90047078, 144940, 144949},
+    {0x90047178, 144974, 144989},
+    {0x90047278, 145015, 145030},
+    {0x90047378, 145069, 145078},
+    {0x90047478, 145101, 144584},
+    {0x90047578, 145110, 145125},
+    {0x90047678, 144508, 144525},
+    {0x90047778, 145170, 144584},
+    {0x90047810, 145179, 145188},
+    {0x90047815, 145206, 145215},
+    {0x90047850, 145243, 145252},
+    {0x90047855, 145280, 145289},
+    {0x90047860, 144877, 144886},
+    {0x90047870, 144940, 145252},
+    {0x90047871, 145322, 145331},
+    {0x90047872, 145336, 145345},
+    {0x90047873, 145368, 145345},
+    {0x90047874, 145377, 145386},
+    {0x90047880, 145404, 145413},
+    {0x90047890, 145426, 145435},
+    {0x90047891, 145451, 145435},
+    {0x90047892, 145451, 145435},
+    {0x90047893, 145451, 145435},
+    {0x90047894, 145451, 145435},
+    {0x90047895, 145460, 145469},
+    {0x90047896, 145451, 145435},
+    {0x90047897, 145451, 145435},
+    {0x90048078, 145512, 145521},
+    {0x90048178, 145537, 145554},
+    {0x90048278, 145582, 145594},
+    {0x90048378, 145630, 50418},
+    {0x90048478, 145640, 145663},
+    {0x90048578, 145691, 145709},
+    {0x90048678, 145747, 145758},
+    {0x90048778, 145798, 145807},
+    {0x90048878, 145829, 98015},
+    {0x90048B78, 145839, 145848},
+    {0x9004EC78, 144508, 144525},
+    {0x90050010, 145852, 145879},
+    {0x90050011, 145915, 145921},
+    {0x90050013, 145957, 50418},
+    {0x9005001F, 145968, 145996},
+    {0x90050020, 145451, 50418},
+    {0x9005002F, 145451, 50418},
+    {0x90050030, 145451, 50418},
+    {0x9005003F, 145451, 50418},
+    {0x90050050, 0, 146024},
+    {0x90050051, 0, 146064},
+    {0x90050053, 146096, 50418},
+    {0x9005005F, 146105, 146116},
+    {0x90050080, 146139, 146149},
+    {0x90050081, 146180, 146190},
+    {0x90050083, 146215, 146190},
+    {0x9005008F, 146225, 146190},
+    {0x900500C0, 146234, 146190},
+    {0x900500C1, 146244, 146190},
+    {0x900500C3, 146254, 146190},
+    {0x900500C5, 0, 146264},
+    {0x900500CF, 146283, 146190},
+    {0x90050258, 146293, 146302},
+    {0x9005041F, 146338, 146347},
+    {0x9005043E, 146367, 146347},
+    {0x90058000, 146376, 146387},
+    {0x9005800F, 146412, 146387},
+    {0x90058010, 146421, 146387},
+    {0x90058011, 146431, 146387},
+    {0x90058012, 146442, 146387},
+    {0x90058014, 146452, 146387},
+    {0x90058015, 146421, 146387},
+    {0x90058016, 146464, 146387},
+    {0x90058017, 146475, 146387},
+    {0x9005801C, 146488, 146387},
+    {0x9005801D, 146498, 146387},
+    {0x9005801E, 146412, 146387},
+    {0x9005801F, 146508, 146387},
+    {0x90058080, 146376, 146517},
+    {0x9005808F, 146412, 146517},
+    {0x90058090, 146421, 146546},
+    {0x90058091, 146431, 146546},
+    {0x90058092, 146442, 146546},
+    {0x90058093, 146571, 146546},
+    {0x90058094, 146452, 146546},
+    {0x90058095, 146421, 146546},
+    {0x90058096, 146464, 146546},
+    {0x90058097, 146475, 146546},
+    {0x9005809C, 146431, 146546},
+    {0x9005809D, 146498, 146546},
+    {0x9005809E, 146582, 146546},
+    {0x9005809F, 146498, 146546},
+    {0x94126565, 146592, 146599},
+    {0x99020001, 146615, 47718},
+    {0x99020002, 146615, 146622},
+    {0x99020003, 146654, 146661},
+    {0xAA4203A3, 146701, 146711},
+    {0xC0DE5600, 146719, 0},
+    {0xC0DEC0DE, 146725, 146734},
+    {0xD4D40601, 0, 146741},
+    {0xDEAF9050, 0, 146760},
+    {0xDEAF9051, 0, 146785},
+    {0xDEAF9052, 0, 146819},
+    {0xE1590001, 146833, 146850},
+    {0xE1590002, 0, 146886},
+    {0xE1590600, 146906, 47718},
+    {0xEACE3100, 146916, 146925},
+    {0xEACE3200, 146936, 146925},
+    {0xEACE320E, 146945, 66174},
+    {0xEACE340E, 146954, 66174},
+    {0xEACE341E, 146963, 66174},
+    {0xEACE3500, 146973, 146925},
+    {0xEACE351C, 146981, 66174},
+    {0xEACE4100, 146992, 147001},
+    {0xEACE4110, 147007, 147001},
+    {0xEACE4200, 147016, 147001},
+    {0xEACE420E, 147024, 147033},
+    {0xEACE430E, 147055, 147033},
+    {0xEDD8A091, 147064, 147074},
+    {0xEDD8A099, 147099, 147074},
+    {0xEDD8A0A1, 147109, 147119},
+    {0xEDD8A0A9, 147131, 147141},
+    {0xEDD8A0B1, 147167, 36651},
+    {0xFA570001, 26143, 147178},
+};
+
+inline constexpr PciClassRecord PciClassRecords[] = {
+    {0x00, 0x00, 0x00, 147200, 147233, 0},
+    {0x00, 0x01, 0x00, 147200, 147241, 0},
+    {0x01, 0x00, 0x00, 147256, 145331, 0},
+    {0x01, 0x01, 0x00, 147256, 147280, 0},
+    {0x01, 0x02, 0x00, 147256, 147284, 0},
+    {0x01, 0x03, 0x00, 147256, 147291, 0},
+    {0x01, 0x04, 0x00, 147256, 147295, 0},
+    {0x01, 0x05, 0x00, 147256, 40470, 0},
+    {0x01, 0x06, 0x00, 147256, 80018, 0},
+    {0x01, 0x07, 0x00, 147256, 147300, 0},
+    {0x01, 0x80, 0x00, 147256, 147332, 0},
+    {0x02, 0x00, 0x00, 113627, 147338, 0},
+    {0x02, 0x01, 0x00, 113627, 74665, 0},
+    {0x02, 0x02, 0x00, 113627, 47541, 0},
+    {0x02, 0x03, 0x00, 113627, 12850, 0},
+    {0x02, 0x80, 0x00, 113627, 147332, 0},
+    {0x03, 0x00, 0x00, 147352, 147241, 80933},
+    {0x03, 0x00, 0x01, 147352, 147371, 147386},
+    {0x03, 0x01, 0x00, 147352, 147391, 0},
+    {0x03, 0x02, 0x00, 147352, 147395, 0},
+    {0x03, 0x80, 0x00, 147352, 147332, 0},
+    {0x04, 0x00, 0x00, 54684, 68136, 0},
+    {0x04, 0x01, 0x00, 54684, 147407, 0},
+    {0x04, 0x02, 0x00, 54684, 147424, 0},
+    {0x04, 0x03, 0x00, 54684, 147445, 0},
+    {0x04, 0x80, 0x00, 54684, 147332, 0},
+    {0x05, 0x00, 0x00, 81703, 147458, 0},
+    {0x05, 0x01, 0x00, 81703, 147462, 0},
+    {0x05, 0x80, 0x00, 81703, 147332, 0},
+    {0x06, 0x00, 0x00, 147468, 147482, 0},
+    {0x06, 0x01, 0x00, 147468, 147491, 0},
+    {0x06, 0x02, 0x00, 147468, 147499, 0},
+    {0x06, 0x03, 0x00, 147468, 147508, 0},
+    {0x06, 0x04, 0x00, 147468, 147526, 0},
+    {0x06, 0x05, 0x00, 147468, 147534, 0},
+    {0x06, 0x06, 0x00, 147468, 147545, 0},
+    {0x06, 0x07, 0x00, 147468, 147555, 0},
+    {0x06, 0x08, 0x00, 147468, 147567, 0},
+    {0x06, 0x09, 0x00, 147468, 147526, 0},
+    {0x06, 0x0A, 0x00, 147468, 147579, 0},
+    {0x06, 0x80, 0x00, 147468, 147332, 0},
+    {0x07, 0x00, 0x00, 147594, 147627, 147634},
+    {0x07, 0x00, 0x01, 147594, 147627, 147656},
+    {0x07, 0x00, 0x02, 147594, 147627, 147673},
+    {0x07, 0x00, 0x03, 147594, 147627, 147690},
+    {0x07, 0x00, 0x04, 147594, 147627, 147707},
+    {0x07, 0x00, 0x05, 147594, 147627, 147724},
+    {0x07, 0x00, 0x06, 147594, 147627, 147741},
+    {0x07, 0x01, 0x00, 147594, 147758, 147767},
+    {0x07, 0x01, 0x01, 147594, 147758, 147776},
+    {0x07, 0x01, 0x02, 147594, 147758, 147794},
+    {0x07, 0x01, 0x03, 147594, 147758, 147812},
+    {0x07, 0x02, 0x00, 147594, 147831, 0},
+    {0x07, 0x03, 0x00, 147594, 147859, 0},
+    {0x07, 0x80, 0x02, 147594, 147332, 0},
+    {0x08, 0x00, 0x00, 147873, 147897, 147937},
+    {0x08, 0x00, 0x01, 147873, 147897, 147950},
+    {0x08, 0x00, 0x02, 147873, 147897, 147954},
+    {0x08, 0x00, 0x10, 147873, 147897, 147963},
+    {0x08, 0x00, 0x20, 147873, 147897, 147971},
+    {0x08, 0x01, 0x00, 147873, 147982, 147937},
+    {0x08, 0x01, 0x01, 147873, 147982, 147950},
+    {0x08, 0x01, 0x02, 147873, 147982, 148009},
+    {0x08, 0x02, 0x00, 147873, 148014, 147937},
+    {0x08, 0x02, 0x01, 147873, 148014, 147950},
+    {0x08, 0x02, 0x02, 147873, 148014, 148009},
+    {0x08, 0x03, 0x00, 147873, 148027, 148049},
+    {0x08, 0x03, 0x01, 147873, 148027, 147950},
+    {0x08, 0x04, 0x00, 147873, 148057, 0},
+    {0x08, 0x05, 0x00, 147873, 148081, 0},
+    {0x08, 0x80, 0x00, 147873, 147332, 0},
+    {0x09, 0x00, 0x00, 148100, 148113, 0},
+    {0x09, 0x01, 0x00, 148100, 148122, 0},
+    {0x09, 0x02, 0x00, 148100, 148138, 0},
+    {0x09, 0x80, 0x00, 148100, 147332, 0},
+    {0x0A, 0x00, 0x00, 148144, 148049, 0},
+    {0x0A, 0x80, 0x00, 148144, 147332, 0},
+    {0x0B, 0x00, 0x00, 148160, 148170, 0},
+    {0x0B, 0x01, 0x00, 148160, 148175, 0},
+    {0x0B, 0x02, 0x00, 148160, 148180, 0},
+    {0x0B, 0x10, 0x00, 148160, 148188, 0},
+    {0x0B, 0x20, 0x00, 148160, 148194, 0},
+    {0x0B, 0x30, 0x00, 148160, 25671, 0},
+    {0x0B, 0x80, 0x00, 148160, 69673, 0},
+    {0x0C, 0x00, 0x00, 148203, 148225, 0},
+    {0x0C, 0x01, 0x00, 148203, 148246, 0},
+    {0x0C, 0x02, 0x00, 148203, 148257, 0},
+    {0x0C, 0x03, 0x00, 148203, 148291, 0},
+    {0x0C, 0x03, 0x10, 148203, 148304, 0},
+    {0x0C, 0x03, 0x20, 148203, 148317, 0},
+    {0x0C, 0x03, 0x80, 148203, 148330, 50851},
+    {0x0C, 0x03, 0xFE, 148203, 148330, 148334},
+    {0x0C, 0x04, 0x00, 148203, 72471, 0},
+    {0x0C, 0x05, 0x00, 148203, 148345, 0},
+    {0x0C, 0x06, 0x00, 148203, 148351, 0},
+    {0x0C, 0x07, 0x00, 148203, 148362, 0},
+    {0x0C, 0x08, 0x00, 148203, 148374, 0},
+    {0x0D, 0x00, 0x00, 148381, 148401, 0},
+    {0x0D, 0x01, 0x00, 148381, 148406, 0},
+    {0x0D, 0x10, 0x00, 148381, 148418, 0},
+    {0x0D, 0x11, 0x00, 148381, 148428, 0},
+    {0x0D, 0x12, 0x00, 148381, 148438, 0},
+    {0x0D, 0x20, 0x00, 148381, 148448, 0},
+    {0x0D, 0x21, 0x00, 148381, 148461, 0},
+    {0xFF, 0x00, 0x00, 50851, 148474, 148509},
+};
+
+#endif // PCICODES_H
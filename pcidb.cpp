@@ -0,0 +1,174 @@
+#include "pcidb.h"
+#include "idsdatabase.h"
+#include "pcicodes.h"
+#include <QStringList>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+constexpr quint32 vendorKey(const PciVendorRecord &record)
+{
+    return record.venId;
+}
+
+constexpr quint32 deviceKey(const PciDeviceRecord &record)
+{
+    return record.key;
+}
+
+// Индекс первой записи, нарушающей строгий порядок (повтор ключа или беспорядок), либо N
+template <typename Entry, size_t N>
+constexpr size_t firstOutOfOrder(const Entry (&table)[N], quint32 (*keyOf)(const Entry &))
+{
+    for (size_t i = 1; i < N; ++i) {
+        if (!(keyOf(table[i - 1]) < keyOf(table[i]))) return i;
+    }
+    return N;
+}
+
+// Двоичный поиск без ветвлений: условие превращается в cmov, длина шага известна заранее
+template <typename Entry, size_t N>
+constexpr const Entry *findEntry(const Entry (&table)[N], quint32 key, quint32 (*keyOf)(const Entry &))
+{
+    const Entry *base = table;
+    size_t length = N;
+    while (length > 1) {
+        const size_t half = length / 2;
+        base += keyOf(base[half]) <= key ? half : 0;
+        length -= half;
+    }
+    return keyOf(*base) == key ? base : nullptr;
+}
+
+// При повторе ключа компилятор покажет индекс записи в сравнении ниже
+static_assert(firstOutOfOrder(PciVendorRecords, vendorKey) == std::size(PciVendorRecords),
+              "PciVendorRecords must be sorted by VenId without duplicates");
+static_assert(firstOutOfOrder(PciDeviceRecords, deviceKey) == std::size(PciDeviceRecords),
+              "PciDeviceRecords must be sorted by (VenId, DevId) without duplicates");
+static_assert(findEntry(PciVendorRecords, 0x8086, vendorKey) != nullptr
+              && findEntry(PciDeviceRecords, 0x80861229, deviceKey) != nullptr
+              && findEntry(PciDeviceRecords, 0x80860000, deviceKey) == nullptr,
+              "PCI table lookup");
+
+// В pci.ids классов вместе с prog-if больше 255, номера строк хранятся в quint16
+static_assert(std::size(PciClassRecords) < 0xFFFF, "PciClassRecords row numbers must fit in quint16");
+
+const char *poolString(quint32 offset)
+{
+    return PciStringPool + offset;
+}
+
+struct ClassIndex {
+    static constexpr quint16 NoRow = 0xFFFF;
+
+    quint16 base[0x100];
+    quint16 sub[0x10000];        // (класс << 8 | подкласс) -> строка
+    quint8 progBlock[0x10000];   // 0 — у пары нет строк с ненулевым prog-if, иначе блок + 1
+    std::vector<std::array<quint16, 0x100>> progRows;
+
+    ClassIndex()
+    {
+        std::fill(std::begin(base), std::end(base), NoRow);
+        std::fill(std::begin(sub), std::end(sub), NoRow);
+        std::memset(progBlock, 0, sizeof(progBlock));
+        for (size_t row = 0; row < std::size(PciClassRecords); ++row) {
+            const PciClassRecord &entry = PciClassRecords[row];
+            const quint16 pair = quint16(entry.baseClass << 8 | entry.subClass);
+            if (base[entry.baseClass] == NoRow) base[entry.baseClass] = quint16(row);
+            // Для пары описанием служит строка с prog-if 0, иначе первая встреченная
+            if (sub[pair] == NoRow || (entry.progIf == 0 && PciClassRecords[sub[pair]].progIf != 0)) {
+                sub[pair] = quint16(row);
+            }
+            if (entry.progIf != 0) {
+                if (progBlock[pair] == 0) {
+                    progRows.emplace_back();
+                    progRows.back().fill(NoRow);
+                    progBlock[pair] = quint8(progRows.size());
+                }
+                progRows[progBlock[pair] - 1][entry.progIf] = quint16(row);
+            }
+        }
+    }
+};
+
+const char *nonEmpty(quint32 offset)
+{
+    return offset ? poolString(offset) : nullptr;
+}
+
+}
+
+QString PciDatabase::vendorName(quint16 vendorId)
+{
+    const QString systemName = IdsDatabase::pci().vendorName(vendorId);
+    return systemName.isEmpty() ? builtinVendorName(vendorId) : systemName;
+}
+
+QString PciDatabase::deviceName(quint16 vendorId, quint16 deviceId)
+{
+    const QString systemName = IdsDatabase::pci().deviceName(vendorId, deviceId);
+    return systemName.isEmpty() ? builtinDeviceName(vendorId, deviceId) : systemName;
+}
+
+QString PciDatabase::builtinVendorName(quint16 vendorId)
+{
+    const PciVendorRecord *record = findEntry(PciVendorRecords, vendorId, vendorKey);
+    if (!record) return QString();
+    return QString::fromUtf8(poolString(record->fullName ? record->fullName : record->shortName));
+}
+
+QString PciDatabase::builtinDeviceName(quint16 vendorId, quint16 deviceId)
+{
+    const PciDeviceRecord *record = findEntry(PciDeviceRecords, quint32(vendorId) << 16 | deviceId, deviceKey);
+    if (!record) return QString();
+    return QString::fromUtf8(poolString(record->chipDesc ? record->chipDesc : record->chip));
+}
+
+QString PciDatabase::displayName(quint16 vendorId, quint16 deviceId)
+{
+    const QString vendor = vendorName(vendorId);
+    const QString device = deviceName(vendorId, deviceId);
+    if (vendor.isEmpty()) return device;
+    if (device.isEmpty()) return vendor;
+    return vendor + ' ' + device;
+}
+
+PciDatabase::ClassInfo PciDatabase::classInfo(quint32 classCode)
+{
+    static const ClassIndex index;
+    const quint8 baseClass = quint8(classCode >> 16);
+    const quint16 pair = quint16(classCode >> 8);
+    const quint8 progIf = quint8(classCode);
+    ClassInfo info;
+
+    quint16 row = ClassIndex::NoRow;
+    if (progIf != 0 && index.progBlock[pair] != 0) {
+        row = index.progRows[index.progBlock[pair] - 1][progIf];
+    }
+    if (row == ClassIndex::NoRow) row = index.sub[pair];
+    if (row != ClassIndex::NoRow) {
+        const PciClassRecord &entry = PciClassRecords[row];
+        info.base = nonEmpty(entry.baseDesc);
+        info.sub = nonEmpty(entry.subDesc);
+        if (entry.progIf == progIf) info.progIf = nonEmpty(entry.progDesc);
+        return info;
+    }
+    row = index.base[baseClass];
+    if (row != ClassIndex::NoRow) info.base = nonEmpty(PciClassRecords[row].baseDesc);
+    return info;
+}
+
+QString PciDatabase::className(quint32 classCode)
+{
+    const ClassInfo info = classInfo(classCode);
+    QStringList parts;
+    for (const char *part : {info.base, info.sub, info.progIf}) {
+        if (part) parts << QString::fromUtf8(part);
+    }
+    return parts.join(" / ");
+}
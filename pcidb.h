@@ -0,0 +1,38 @@
+#ifndef PCIDB_H
+#define PCIDB_H
+
+#include <QByteArray>
+#include <QString>
+
+// Названия производителей и устройств PCI из встроенных таблиц pcicodes.h
+// (tools/pci_codes_gen.py). Таблицы отсортированы по ключу ещё в исходнике
+// и проверяются при компиляции, поэтому поиск — двоичный без ветвлений
+// по готовому массиву, без построения индексов при запуске. Для кодов
+// классов строится плотный индекс (один раз, при первом обращении):
+// поиск идёт от prog-if к подклассу и базовому классу за O(1).
+// Производители и устройства сначала ищутся в системном pci.ids
+// (IdsDatabase): он свежее встроенных таблиц, те остаются запасным путём.
+class PciDatabase {
+public:
+    // Описания из PciClassRecords в UTF-8; nullptr — на этом уровне описания нет
+    struct ClassInfo {
+        const char *base = nullptr;
+        const char *sub = nullptr;
+        const char *progIf = nullptr;
+    };
+
+    // Пустая строка, если ID нет ни в pci.ids, ни в таблице
+    static QString vendorName(quint16 vendorId);
+    static QString deviceName(quint16 vendorId, quint16 deviceId);
+    // "Производитель Устройство" для списка, если система не дала своего названия
+    static QString displayName(quint16 vendorId, quint16 deviceId);
+    // Только встроенные таблицы, без системного pci.ids
+    static QString builtinVendorName(quint16 vendorId);
+    static QString builtinDeviceName(quint16 vendorId, quint16 deviceId);
+
+    // classCode — 0xCCSSPP: базовый класс, подкласс, prog-if
+    static ClassInfo classInfo(quint32 classCode);
+    static QString className(quint32 classCode);
+};
+
+#endif // PCIDB_H
@@ -0,0 +1,144 @@
+#include "pcihotplugmonitor.h"
+#include <QDebug>
+#if defined(Q_OS_LINUX)
+#include <QSocketNotifier>
+#include <cerrno>
+#include <cstring>
+#include <linux/netlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+PciHotplugMonitor::PciHotplugMonitor(QObject *parent) : QObject(parent)
+{
+    coalesce.setSingleShot(true);
+    coalesce.setInterval(CoalesceMs);
+    connect(&coalesce, &QTimer::timeout, this, &PciHotplugMonitor::flush);
+#if defined(Q_OS_LINUX)
+    if (!watchUevents()) {
+        qDebug() << "PCI hotplug notifications are not available";
+    }
+#endif
+}
+
+PciHotplugMonitor::~PciHotplugMonitor()
+{
+#if defined(Q_OS_LINUX)
+    delete ueventNotifier;
+    if (ueventFd >= 0) {
+        ::close(ueventFd);
+    }
+#endif
+}
+
+bool PciHotplugMonitor::isWatching() const
+{
+#if defined(Q_OS_LINUX)
+    return ueventNotifier;
+#elif defined(Q_OS_WIN)
+    // Уведомления приходят в окно; MainWindow передаёт их через requestRescan
+    return true;
+#else
+    return false;
+#endif
+}
+
+quint64 PciHotplugMonitor::events() const
+{
+    return eventCount;
+}
+
+void PciHotplugMonitor::requestRescan()
+{
+    ++eventCount;
+    pendingRescan = true;
+    if (!coalesce.isActive()) coalesce.start();
+}
+
+void PciHotplugMonitor::flush()
+{
+    // Полный обход и так перечитает все функции — отдельные адреса уже не нужны
+    if (pendingRescan) {
+        pendingRescan = false;
+        pendingDevices.clear();
+        emit rescanNeeded();
+        return;
+    }
+    if (pendingDevices.isEmpty()) {
+        return;
+    }
+    QStringList bdfs(pendingDevices.cbegin(), pendingDevices.cend());
+    pendingDevices.clear();
+    bdfs.sort();
+    emit devicesChanged(bdfs);
+}
+
+#if defined(Q_OS_LINUX)
+bool PciHotplugMonitor::watchUevents()
+{
+    ueventFd = ::socket(AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+    if (ueventFd < 0) {
+        return false;
+    }
+    // Док Thunderbolt шлёт сотни событий подряд; буфер по умолчанию переполняется.
+    // SO_RCVBUFFORCE обходит rmem_max, но только с CAP_NET_ADMIN
+    const int receiveBuffer = ReceiveBufferBytes;
+    if (::setsockopt(ueventFd, SOL_SOCKET, SO_RCVBUFFORCE, &receiveBuffer, sizeof(receiveBuffer)) < 0) {
+        ::setsockopt(ueventFd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    }
+    // Группа 1 — сообщения самого ядра (группу 2 рассылает udev в своём формате)
+    sockaddr_nl address = {};
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = 1;
+    if (::bind(ueventFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+        ::close(ueventFd);
+        ueventFd = -1;
+        return false;
+    }
+    ueventNotifier = new QSocketNotifier(ueventFd, QSocketNotifier::Read);
+    connect(ueventNotifier, &QSocketNotifier::activated, this, &PciHotplugMonitor::readUevents);
+    return true;
+}
+
+void PciHotplugMonitor::readUevents()
+{
+    // Сообщение: "add@/devices/...\0ACTION=add\0SUBSYSTEM=pci\0PCI_SLOT_NAME=0000:3b:00.0\0..."
+    char buffer[8192];
+    for (;;) {
+        sockaddr_nl sender = {};
+        socklen_t senderSize = sizeof(sender);
+        const ssize_t size = ::recvfrom(ueventFd, buffer, sizeof(buffer) - 1, 0,
+                                        reinterpret_cast<sockaddr *>(&sender), &senderSize);
+        if (size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (size < 0 && errno == ENOBUFS) {
+            // Очередь переполнилась и часть событий потеряна — какие, неизвестно
+            qDebug() << "PCI hotplug: uevent queue overflow, full rescan";
+            requestRescan();
+            continue;
+        }
+        if (size <= 0) {
+            break;
+        }
+        // Чужие процессы тоже могут слать в netlink; ядро — это nl_pid 0
+        if (sender.nl_pid != 0) continue;
+        buffer[size] = '\0';
+
+        bool pci = false;
+        const char *slot = nullptr;
+        for (const char *field = buffer; field < buffer + size; field += std::strlen(field) + 1) {
+            if (std::strcmp(field, "SUBSYSTEM=pci") == 0) pci = true;
+            else if (std::strncmp(field, "PCI_SLOT_NAME=", 14) == 0) slot = field + 14;
+        }
+        if (!pci) continue;
+        ++eventCount;
+        if (slot && *slot) {
+            pendingDevices.insert(QString::fromLatin1(slot));
+        } else {
+            pendingRescan = true;
+        }
+        if (!coalesce.isActive()) coalesce.start();
+    }
+}
+#endif
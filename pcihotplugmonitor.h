@@ -0,0 +1,55 @@
+#ifndef PCIHOTPLUGMONITOR_H
+#define PCIHOTPLUGMONITOR_H
+
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+
+class QSocketNotifier;
+
+// Сообщает об изменениях на шине PCI: подключение и отключение функций,
+// привязка драйвера. Linux: uevent ядра (netlink NETLINK_KOBJECT_UEVENT)
+// с SUBSYSTEM=pci — известен адрес функции (BDF), перечитывать нужно
+// только её. Windows: WM_DEVICECHANGE/DBT_DEVNODES_CHANGED без адреса,
+// MainWindow передаёт его в requestRescan. События за CoalesceMs
+// собираются в один сигнал: у дока Thunderbolt их десятки подряд.
+// Если очередь сокета всё же переполнилась, нужен полный обход (rescanNeeded).
+class PciHotplugMonitor : public QObject {
+    Q_OBJECT
+public:
+    explicit PciHotplugMonitor(QObject *parent = nullptr);
+    ~PciHotplugMonitor();
+
+    bool isWatching() const;
+    quint64 events() const;
+
+public slots:
+    // Что-то изменилось, но неизвестно что — нужен полный обход
+    void requestRescan();
+
+signals:
+    void devicesChanged(const QStringList &bdfs);
+    void rescanNeeded();
+
+private:
+    static constexpr int CoalesceMs = 100;
+    static constexpr int ReceiveBufferBytes = 1024 * 1024;
+
+    void flush();
+#if defined(Q_OS_LINUX)
+    bool watchUevents();
+    void readUevents();
+
+    int ueventFd = -1;
+    QSocketNotifier *ueventNotifier = nullptr;
+#endif
+
+    QTimer coalesce;
+    QSet<QString> pendingDevices;
+    bool pendingRescan = false;
+    quint64 eventCount = 0;
+};
+
+#endif // PCIHOTPLUGMONITOR_H
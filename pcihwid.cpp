@@ -0,0 +1,123 @@
+#include "pcihwid.h"
+#include <cstring>
+
+namespace {
+
+const char VendorTag[] = "PCI\\VEN_";
+const char DeviceTag[] = "&DEV_";
+const char SubsystemTag[] = "&SUBSYS_";
+const char RevisionTag[] = "&REV_";
+const char ClassTag[] = "CC_";
+
+int hexDigit(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// digits шестнадцатеричных цифр подряд с позиции p
+bool readHex(const char *p, const char *end, int digits, quint32 &value)
+{
+    if (end - p < digits) return false;
+    quint32 result = 0;
+    for (int i = 0; i < digits; ++i) {
+        const int digit = hexDigit(p[i]);
+        if (digit < 0) return false;
+        result = (result << 4) | quint32(digit);
+    }
+    value = result;
+    return true;
+}
+
+template <size_t N>
+bool hasTag(const char *p, const char *end, const char (&tag)[N])
+{
+    return size_t(end - p) >= N - 1 && std::memcmp(p, tag, N - 1) == 0;
+}
+
+}
+
+bool parsePciHardwareId(const char *id, size_t length, PciHardwareId &result)
+{
+    const char *end = id + length;
+    const size_t vendorTagLength = sizeof(VendorTag) - 1;
+    // Как regex_search: если у первого вхождения формат не тот, ищем дальше
+    for (const char *p = id; size_t(end - p) >= vendorTagLength; ++p) {
+        p = static_cast<const char *>(std::memchr(p, 'P', size_t(end - p)));
+        if (!p) return false;
+        if (!hasTag(p, end, VendorTag)) continue;
+
+        const char *cursor = p + vendorTagLength;
+        quint32 vendor = 0, device = 0;
+        if (!readHex(cursor, end, 4, vendor)) continue;
+        cursor += 4;
+        if (!hasTag(cursor, end, DeviceTag)) continue;
+        cursor += sizeof(DeviceTag) - 1;
+        if (!readHex(cursor, end, 4, device)) continue;
+        cursor += 4;
+
+        PciHardwareId parsed;
+        parsed.vendor = quint16(vendor);
+        parsed.device = quint16(device);
+        quint32 value = 0;
+        // SUBSYS_ssssvvvv: старшие четыре цифры — устройство, младшие — производитель
+        if (hasTag(cursor, end, SubsystemTag) && readHex(cursor + sizeof(SubsystemTag) - 1, end, 8, value)) {
+            parsed.subsystemDevice = quint16(value >> 16);
+            parsed.subsystemVendor = quint16(value & 0xFFFF);
+            parsed.hasSubsystem = true;
+            cursor += sizeof(SubsystemTag) - 1 + 8;
+        }
+        if (hasTag(cursor, end, RevisionTag) && readHex(cursor + sizeof(RevisionTag) - 1, end, 2, value)) {
+            parsed.revision = quint8(value);
+            parsed.hasRevision = true;
+        }
+        result = parsed;
+        return true;
+    }
+    return false;
+}
+
+bool findPciHardwareId(const char *multiSz, size_t size, PciHardwareId &result)
+{
+    // Строки идут подряд через '\0', список заканчивается пустой строкой
+    const char *p = multiSz;
+    const char *end = multiSz + size;
+    while (p < end && *p != '\0') {
+        const char *terminator = static_cast<const char *>(std::memchr(p, '\0', size_t(end - p)));
+        const size_t length = terminator ? size_t(terminator - p) : size_t(end - p);
+        if (parsePciHardwareId(p, length, result)) return true;
+        p += length + 1;
+    }
+    return false;
+}
+
+bool findPciClassCode(const char *multiSz, size_t size, quint32 &classCode)
+{
+    // Первым идёт самый подробный ID, но полный код с prog-if ищем по всему списку
+    bool found = false;
+    const char *p = multiSz;
+    const char *end = multiSz + size;
+    while (p < end && *p != '\0') {
+        const char *terminator = static_cast<const char *>(std::memchr(p, '\0', size_t(end - p)));
+        const char *stringEnd = terminator ? terminator : end;
+        for (const char *cursor = p; stringEnd - cursor > 3; ++cursor) {
+            if (!hasTag(cursor, stringEnd, ClassTag) || (cursor > p && cursor[-1] != '&' && cursor[-1] != '\\')) {
+                continue;
+            }
+            const char *digits = cursor + sizeof(ClassTag) - 1;
+            quint32 value = 0;
+            if (readHex(digits, stringEnd, 6, value) && (stringEnd - digits == 6 || hexDigit(digits[6]) < 0)) {
+                classCode = value;
+                return true;
+            }
+            if (!found && readHex(digits, stringEnd, 4, value) && (stringEnd - digits == 4 || hexDigit(digits[4]) < 0)) {
+                classCode = value << 8;
+                found = true;
+            }
+        }
+        p = stringEnd + 1;
+    }
+    return found;
+}
@@ -0,0 +1,30 @@
+#ifndef PCIHWID_H
+#define PCIHWID_H
+
+#include <QtGlobal>
+#include <cstddef>
+
+// Разбор идентификаторов оборудования Windows вида
+// PCI\VEN_8086&DEV_A370&SUBSYS_00348086&REV_10 прямо в буфере
+// SetupAPI, без регулярных выражений и выделений памяти.
+// VEN и DEV обязательны и ищутся так же, как выражение
+// PCI\\VEN_([0-9A-Fa-f]{4})&DEV_([0-9A-Fa-f]{4}); SUBSYS и REV
+// разбираются, если идут сразу за ними.
+struct PciHardwareId {
+    quint16 vendor = 0;
+    quint16 device = 0;
+    quint16 subsystemVendor = 0;
+    quint16 subsystemDevice = 0;
+    quint8 revision = 0;
+    bool hasSubsystem = false;
+    bool hasRevision = false;
+};
+
+// Одна строка длиной length (без завершающего нуля)
+bool parsePciHardwareId(const char *id, size_t length, PciHardwareId &result);
+// Список REG_MULTI_SZ размером size байт: первая строка с PCI\VEN_&DEV_
+bool findPciHardwareId(const char *multiSz, size_t size, PciHardwareId &result);
+// Код класса 0xCCSSPP из совместимых ID (…&CC_ccsspp или PCI\CC_ccss); CC_ccss даёт prog-if 0
+bool findPciClassCode(const char *multiSz, size_t size, quint32 &classCode);
+
+#endif // PCIHWID_H
@@ -0,0 +1,213 @@
+#include "pcitablemodel.h"
+#include "pcidb.h"
+#include <algorithm>
+
+PciTableModel::PciTableModel(QObject *parent) : QAbstractTableModel(parent)
+{
+}
+
+void PciTableModel::clear()
+{
+    if (rows.isEmpty()) {
+        return;
+    }
+    beginResetModel();
+    rows.clear();
+    rowIndex.clear();
+    endResetModel();
+}
+
+void PciTableModel::append(const QList<PCIDevice> &devices)
+{
+    renumberFrom(insertSorted(devices));
+}
+
+void PciTableModel::apply(const PciDelta &delta)
+{
+    int firstShifted = removeKeys(delta.removed);
+    for (const PCIDevice &device : delta.changed) {
+        const int row = rowIndex.value(device.bdf, -1);
+        if (row < 0) continue;
+        rows[row] = device;
+        emit dataChanged(index(row, 0), index(row, ColumnCount - 1));
+    }
+    firstShifted = qMin(firstShifted, insertSorted(delta.added));
+    renumberFrom(firstShifted);
+}
+
+int PciTableModel::insertSorted(QList<PCIDevice> devices)
+{
+    if (devices.isEmpty()) {
+        return int(rows.size());
+    }
+    const auto byKey = [](const PCIDevice &a, const PCIDevice &b) { return a.bdf < b.bdf; };
+    std::sort(devices.begin(), devices.end(), byKey);
+    // Перечисление в Linux идёт по адресу, поэтому обычно все новые строки встают в конец
+    if (rows.isEmpty() || !(devices.constFirst().bdf < rows.constLast().bdf)) {
+        const int first = int(rows.size());
+        beginInsertRows(QModelIndex(), first, first + int(devices.size()) - 1);
+        rows.append(devices);
+        endInsertRows();
+        reindexFrom(first);
+        return int(rows.size());
+    }
+    // Иначе — снизу вверх, по одной вставке на каждый промежуток между старыми строками:
+    // вставка ниже не сдвигает места тех, что выше
+    int firstInserted = int(rows.size());
+    for (qsizetype last = devices.size() - 1; last >= 0;) {
+        const int position = int(std::upper_bound(rows.cbegin(), rows.cend(), devices[last], byKey) - rows.cbegin());
+        qsizetype first = last;
+        while (first > 0 && (position == 0 || !(devices[first - 1].bdf < rows[position - 1].bdf))) {
+            --first;
+        }
+        const int count = int(last - first + 1);
+        beginInsertRows(QModelIndex(), position, position + count - 1);
+        rows.insert(position, count, PCIDevice());
+        std::copy(devices.cbegin() + first, devices.cbegin() + last + 1, rows.begin() + position);
+        endInsertRows();
+        firstInserted = position;
+        last = first - 1;
+    }
+    reindexFrom(firstInserted);
+    return firstInserted;
+}
+
+int PciTableModel::removeKeys(const QStringList &keys)
+{
+    QList<int> doomed;
+    doomed.reserve(keys.size());
+    for (const QString &key : keys) {
+        const int row = rowIndex.value(key, -1);
+        if (row >= 0) doomed.append(row);
+    }
+    if (doomed.isEmpty()) {
+        return int(rows.size());
+    }
+    std::sort(doomed.begin(), doomed.end());
+    doomed.erase(std::unique(doomed.begin(), doomed.end()), doomed.end());
+    // Подряд идущие строки уходят одним диапазоном, снизу вверх
+    for (qsizetype last = doomed.size() - 1; last >= 0;) {
+        qsizetype first = last;
+        while (first > 0 && doomed[first - 1] == doomed[first] - 1) {
+            --first;
+        }
+        const int count = int(last - first + 1);
+        beginRemoveRows(QModelIndex(), doomed[first], doomed[first] + count - 1);
+        for (int row = doomed[first]; row < doomed[first] + count; ++row) {
+            rowIndex.remove(rows.at(row).bdf);
+        }
+        rows.remove(doomed[first], count);
+        endRemoveRows();
+        last = first - 1;
+    }
+    reindexFrom(doomed.constFirst());
+    return doomed.constFirst();
+}
+
+void PciTableModel::reindexFrom(int row)
+{
+    for (; row < rows.size(); ++row) {
+        rowIndex.insert(rows.at(row).bdf, row);
+    }
+}
+
+void PciTableModel::renumberFrom(int row)
+{
+    // Номера строк сдвинулись у всех, кто ниже вставки или удаления
+    if (row < rows.size()) {
+        emit dataChanged(index(row, NumberColumn), index(rowCount() - 1, NumberColumn), {Qt::DisplayRole});
+    }
+}
+
+const QList<PCIDevice> &PciTableModel::devices() const
+{
+    return rows;
+}
+
+int PciTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : int(rows.size());
+}
+
+int PciTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QString PciTableModel::text(const PCIDevice &device, int row, int column) const
+{
+    switch (column) {
+    case NumberColumn:
+        return QString::number(row + 1);
+    case VendorColumn:
+        return device.vendorID;
+    case DeviceColumn:
+        return device.deviceID;
+    case NameColumn:
+        return device.friendlyName;
+    case BusColumn:
+        return device.instanceID;
+    default:
+        return QString();
+    }
+}
+
+QVariant PciTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= rows.size()) {
+        return QVariant();
+    }
+    const PCIDevice &device = rows.at(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+    case FullTextRole:
+        return text(device, index.row(), index.column());
+    case Qt::TextAlignmentRole:
+        return index.column() == NameColumn ? int(Qt::AlignLeft | Qt::AlignVCenter) : int(Qt::AlignCenter);
+    case Qt::ToolTipRole:
+        if (index.column() == NameColumn) {
+            // Название класса ищется только при наведении
+            const QString className = PciDatabase::className(device.classCode);
+            return className.isEmpty() ? device.friendlyName : device.friendlyName + "\n" + className;
+        }
+        if (index.column() == BusColumn) {
+            return device.instanceID;
+        }
+        return QVariant();
+    case ClassCodeRole:
+        return device.classCode;
+    case BaseClassRole:
+        return int(device.classCode >> 16);
+    default:
+        return QVariant();
+    }
+}
+
+QVariant PciTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    static const char *const titles[ColumnCount] = {"№", "VendorID", "DeviceID", "Название", "Шина"};
+    return section >= 0 && section < ColumnCount ? QString(titles[section]) : QVariant();
+}
+
+PciElideDelegate::PciElideDelegate(int maxWidth, QObject *parent)
+    : QStyledItemDelegate(parent), maxWidth(maxWidth)
+{
+}
+
+QSize PciElideDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    QSize size = QStyledItemDelegate::sizeHint(option, index);
+    size.setWidth(qMin(size.width(), maxWidth));
+    return size;
+}
+
+void PciElideDelegate::initStyleOption(QStyleOptionViewItem *option, const QModelIndex &index) const
+{
+    QStyledItemDelegate::initStyleOption(option, index);
+    // Одна строка с многоточием: стиль обрезает текст по прямоугольнику ячейки при отрисовке
+    option->features.setFlag(QStyleOptionViewItem::WrapText, false);
+    option->textElideMode = Qt::ElideRight;
+}
@@ -0,0 +1,69 @@
+#ifndef PCITABLEMODEL_H
+#define PCITABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QList>
+#include <QStyledItemDelegate>
+#include "envirconfigpci.h"
+
+// Таблица панели PCI поверх снимка PCIDevice. Ячейки не хранятся:
+// текст, подсказка и выравнивание строятся в data() только для тех
+// строк, которые представление действительно рисует, поэтому размер
+// таблицы не зависит от числа функций на шине (хоть 10 000 VF SR-IOV).
+// Строки всегда упорядочены по ключу bdf; строку по ключу даёт индекс.
+class PciTableModel : public QAbstractTableModel {
+    Q_OBJECT
+public:
+    enum Column { NumberColumn, VendorColumn, DeviceColumn, NameColumn, BusColumn, ColumnCount };
+    enum Roles {
+        FullTextRole = Qt::UserRole,   // полный текст ячейки для копирования
+        ClassCodeRole,                 // quint32 0xCCSSPP
+        BaseClassRole                  // базовый класс числом, по нему работает фильтр
+    };
+
+    explicit PciTableModel(QObject *parent = nullptr);
+
+    void clear();
+    // Новые строки встают на место по ключу; при перечислении по адресу — просто в конец
+    void append(const QList<PCIDevice> &devices);
+    // Изменения после hotplug: затрагиваются только строки из delta,
+    // соседние вставки и удаления уходят в представление одним диапазоном
+    void apply(const PciDelta &delta);
+    const QList<PCIDevice> &devices() const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+    QString text(const PCIDevice &device, int row, int column) const;
+    // Возвращают первую строку, чей номер сдвинулся (rowCount(), если таких нет)
+    int insertSorted(QList<PCIDevice> devices);
+    int removeKeys(const QStringList &keys);
+    void reindexFrom(int row);
+    void renumberFrom(int row);
+
+    QList<PCIDevice> rows;
+    QHash<QString, int> rowIndex;
+};
+
+// Текст обрезается многоточием в момент отрисовки и только у видимых
+// ячеек; при изменении ширины столбца строки не перебираются. Ширина по
+// содержимому не больше maxWidth, чтобы длинные названия не раздували столбец.
+class PciElideDelegate : public QStyledItemDelegate {
+    Q_OBJECT
+public:
+    explicit PciElideDelegate(int maxWidth, QObject *parent = nullptr);
+
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+protected:
+    void initStyleOption(QStyleOptionViewItem *option, const QModelIndex &index) const override;
+
+private:
+    int maxWidth;
+};
+
+#endif // PCITABLEMODEL_H
@@ -1,5 +1,5 @@
 #include "powermonitor.h"
-#include <QTimer>
+#include "timerscheduler.h"
 #include <QDebug>
 #include <QProcess>
 #include <QMessageBox>
@@ -14,11 +14,13 @@
 #pragma comment(lib, "advapi32.lib") // Для RegOpenKeyExA и RegQueryValueExA
 #endif
 
-PowerMonitor::PowerMonitor(QObject *parent) : QObject(parent),
+PowerMonitor::PowerMonitor(TimerScheduler *scheduler, QObject *parent) : QObject(parent),
     lastBatteryLevel(0), batteryLevel(0), powerSavingEnabled(false),
     isBatteryDischarging(false), lastRemainingSeconds(0) {
-    timer = new QTimer(this);
-    connect(timer, &QTimer::timeout, this, &PowerMonitor::updateData);
+    // Опрос нужен только для надписей панели: пока окно не видно, он стоит,
+    // а после показа первый же опрос догоняет все изменения
+    timer = new ScheduledTimer(scheduler, TimerScheduler::Cosmetic, this);
+    connect(timer, &ScheduledTimer::timeout, this, &PowerMonitor::updateData);
     powerSource = "Неизвестно";
     batteryType = "Неизвестно";
     dischargeDuration = QTime(0, 0, 0);
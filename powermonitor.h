@@ -5,12 +5,13 @@
 #include <QTime>
 #include <QElapsedTimer>
 
-class QTimer;
+class TimerScheduler;
+class ScheduledTimer;
 
 class PowerMonitor : public QObject {
     Q_OBJECT
 public:
-    explicit PowerMonitor(QObject *parent = nullptr);
+    explicit PowerMonitor(TimerScheduler *scheduler, QObject *parent = nullptr);
     ~PowerMonitor();
 
     void startMonitoring();
@@ -39,7 +40,7 @@ private slots:
     void updateData();
 
 private:
-    QTimer *timer;
+    ScheduledTimer *timer;
     QString powerSource;
     QString batteryType;
     QString currentPowerMode;
@@ -0,0 +1,387 @@
+#include "renderbenchmark.h"
+#include "mainwindow.h"
+#include "animationcatalog.h"
+#include "theme.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QEventLoop>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QTimer>
+#include <QVBoxLayout>
+#include <QPainter>
+#include <QSvgRenderer>
+
+// Таблицы стилей панели USB в том виде, в каком они были до Theme: точка отсчёта для сравнения
+static const char *LegacyPanelStyle = R"(
+    QWidget {
+        background: qlineargradient(x1:0, y1:0, x2:1, y2:1,
+            stop:0 rgba(255, 255, 255, 250),
+            stop:1 rgba(240, 245, 255, 230));
+        border-radius: 15px;
+    }
+)";
+static const char *LegacyTableStyle = R"(
+    QTableWidget {
+        background: rgba(255, 255, 255, 240);
+        font-family: 'Segoe UI', Arial;
+        font-size: 14px;
+        color: #333333;
+        border: 1px solid rgba(74, 144, 226, 100);
+        border-radius: 12px;
+        gridline-color: rgba(74, 144, 226, 40);
+        alternate-background-color: rgba(248, 250, 255, 200);
+    }
+    QHeaderView::section {
+        background: qlineargradient(x1:0, y1:0, x2:0, y2:1,
+            stop:0 rgba(74, 144, 226, 240),
+            stop:1 rgba(53, 122, 189, 220));
+        color: white;
+        font-weight: bold;
+        font-size: 15px;
+        padding: 12px 8px;
+        border: none;
+    }
+    QHeaderView::section:hover {
+        background: qlineargradient(x1:0, y1:0, x2:0, y2:1,
+            stop:0 rgba(53, 122, 189, 255),
+            stop:1 rgba(44, 90, 160, 240));
+    }
+    QTableWidget::item {
+        padding: 12px 8px;
+    }
+    QTableWidget::item:hover {
+        background: qlineargradient(x1:0, y1:0, x2:1, y2:0,
+            stop:0 rgba(74, 144, 226, 15),
+            stop:1 rgba(74, 144, 226, 5));
+        color: #2C5AA0;
+    }
+    QTableWidget::item:selected {
+        background: rgba(74, 144, 226, 100);
+        color: white;
+    }
+)";
+static const char *LegacyButtonStyle = R"(
+    QPushButton {
+        background-color: rgba(74, 144, 226, 220);
+        color: white;
+        border-radius: 8px;
+        font-size: 15px;
+        font-weight: bold;
+    }
+    QPushButton:hover {
+        background-color: rgba(53, 122, 189, 220);
+    }
+    QPushButton:pressed {
+        background-color: rgba(44, 90, 160, 240);
+    }
+    QPushButton:disabled {
+        background-color: rgba(74, 144, 226, 100);
+    }
+)";
+
+RenderBenchmark::RenderBenchmark(const QString &assetsPath, QTextStream &out, int rounds)
+    : assetsPath(assetsPath), out(out), rounds(qMax(2, rounds)), cache(assetsPath)
+{
+    if (pack.open(QCoreApplication::applicationDirPath() + "/assets.pack")) {
+        cache.setAssetPack(&pack);
+    }
+    const QImage background(assetsPath + "krosh_house.jpg");
+    backgroundFrame = QImage(SceneWidth, SceneHeight, QImage::Format_RGB32);
+    backgroundFrame.fill(Qt::lightGray);
+    if (!background.isNull()) {
+        QPainter painter(&backgroundFrame);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform);
+        painter.drawImage(backgroundFrame.rect(), background);
+    }
+    scene.setFixedSize(SceneWidth, SceneHeight);
+    scene.setBackgroundImage(background);
+    scene.show();
+    flushScene();
+}
+
+void RenderBenchmark::run()
+{
+    out << "assets: " << assetsPath << (pack.isOpen() ? " (assets.pack)" : " (svg)")
+        << ", rounds: " << rounds << ", allocations: "
+        << (BenchmarkStats::allocationsTracked() ? "tracked" : "n/a") << Qt::endl;
+    BenchmarkStats::printHeader(out);
+
+    for (const AssetPack::SequenceSpec &spec : AnimationCatalog::sequences()) {
+        BenchmarkStats::report(out, "updateFrame " + spec.prefix, measureSequence(spec));
+    }
+    BenchmarkStats::report(out, "drawBackground", measureBackground());
+    BenchmarkStats::report(out, "BatteryWidget::paintEvent", measureBattery());
+    BenchmarkStats::report(out, "rescale (svg)", measureRescale(false));
+    BenchmarkStats::report(out, "rescale (display list)", measureRescale(true));
+    for (SpriteCompositor::Kernel kernel : SpriteCompositor::availableKernels()) {
+        BenchmarkStats::report(out, QString("SpriteCompositor ") + SpriteCompositor::kernelName(kernel),
+                               measureCompositor(kernel));
+    }
+    // Таблицы стилей меряются до установки Theme, как это было в приложении
+    BenchmarkStats::report(out, "panel build (stylesheet)", measurePanelConstruction(false));
+    BenchmarkStats::report(out, "button hover (stylesheet)", measureHoverRepaint(false));
+    Theme::install();
+    BenchmarkStats::report(out, "panel build (Theme)", measurePanelConstruction(true));
+    BenchmarkStats::report(out, "button hover (Theme)", measureHoverRepaint(true));
+    BenchmarkStats::report(out, "MainWindow first frame", measureStartup());
+
+    const FrameCache::Stats cacheStats = cache.stats();
+    out << "cache: " << cacheStats.hits << " hits, " << cacheStats.misses << " misses, "
+        << cacheStats.residentBytes / 1024 << " of " << cacheStats.budgetBytes / 1024 << " KiB resident, "
+        << cacheStats.evictions << " evictions" << Qt::endl;
+}
+
+BenchmarkSamples RenderBenchmark::measureSequence(const AssetPack::SequenceSpec &spec)
+{
+    BenchmarkSamples samples;
+    cache.clear();
+    for (int round = 0; round < rounds; ++round) {
+        const quint64 allocationsBefore = BenchmarkStats::allocations();
+        for (int number = spec.first; number <= spec.last; ++number) {
+            const qint64 elapsed = paintSprite(spec.prefix + QString::number(number), spec.size);
+            (round == 0 ? samples.cold : samples.warm) << elapsed;
+        }
+        if (round > 0) {
+            samples.warmAllocations += BenchmarkStats::allocations() - allocationsBefore;
+        }
+    }
+    return samples;
+}
+
+BenchmarkSamples RenderBenchmark::measureBackground()
+{
+    // Тот же кадр, что ставит MainWindow::drawBackground в обычном режиме
+    BenchmarkSamples samples;
+    cache.clear();
+    const QSize kroshSize(276, 386);
+    samples.cold << paintSprite("Frame1", kroshSize);
+    const quint64 allocationsBefore = BenchmarkStats::allocations();
+    for (int i = 0; i < BackgroundRepeats * rounds; ++i) {
+        samples.warm << paintSprite("Frame1", kroshSize);
+    }
+    samples.warmAllocations = BenchmarkStats::allocations() - allocationsBefore;
+    return samples;
+}
+
+BenchmarkSamples RenderBenchmark::measureBattery()
+{
+    // Первая отрисовка собирает атлас, дальше уровень меняется на каждом кадре
+    BenchmarkSamples samples;
+    BatteryWidget battery;
+    battery.show();
+    QElapsedTimer timer;
+    quint64 allocationsBefore = 0;
+    for (int i = 0; i <= BackgroundRepeats * rounds; ++i) {
+        if (i == 1) {
+            allocationsBefore = BenchmarkStats::allocations();
+        }
+        battery.setBatteryLevel(100 - (i * 7) % 101);
+        timer.start();
+        battery.repaint();
+        (i == 0 ? samples.cold : samples.warm) << timer.nsecsElapsed();
+    }
+    samples.warmAllocations = BenchmarkStats::allocations() - allocationsBefore;
+    return samples;
+}
+
+BenchmarkSamples RenderBenchmark::measureRescale(bool displayList)
+{
+    // Каждый шаг — новый размер и DPR кадра, как при перетаскивании окна между экранами
+    BenchmarkSamples samples;
+    const QString svgPath = assetsPath + "Frame1.svg";
+    const QSize kroshSize(276, 386);
+    DisplayList list;
+    QElapsedTimer timer;
+    quint64 allocationsBefore = 0;
+    for (int i = 0; i <= RescaleSteps * rounds; ++i) {
+        if (i == 1) {
+            allocationsBefore = BenchmarkStats::allocations();
+        }
+        const qreal dpr = 1.0 + (i % RescaleSteps) * 0.25;
+        const QSize size = kroshSize * (1.0 + (i % 3) * 0.1);
+        timer.start();
+        QImage image;
+        if (displayList) {
+            if (list.isNull()) {
+                list = DisplayList::compile(svgPath);
+            }
+            image = list.rasterize(size, dpr);
+        } else {
+            QSvgRenderer renderer(svgPath);
+            image = QImage(size * dpr, QImage::Format_ARGB32_Premultiplied);
+            image.setDevicePixelRatio(dpr);
+            image.fill(Qt::transparent);
+            QPainter painter(&image);
+            painter.setRenderHint(QPainter::Antialiasing);
+            renderer.render(&painter, QRectF(QPointF(0, 0), QSizeF(size)));
+        }
+        (i == 0 ? samples.cold : samples.warm) << timer.nsecsElapsed();
+    }
+    samples.warmAllocations = BenchmarkStats::allocations() - allocationsBefore;
+    return samples;
+}
+
+BenchmarkSamples RenderBenchmark::measureCompositor(SpriteCompositor::Kernel kernel)
+{
+    // Только само наложение кадров Eat на готовый фон, без QPainter и виджета
+    BenchmarkSamples samples;
+    const AssetPack::SequenceSpec spec = AnimationCatalog::sequences().constFirst();
+    QImage target = backgroundFrame.copy();
+    const QPoint at = spriteRect(spec.size).topLeft();
+    QElapsedTimer timer;
+    const quint64 allocationsBefore = BenchmarkStats::allocations();
+    for (int round = 0; round < rounds; ++round) {
+        for (int number = spec.first; number <= spec.last; ++number) {
+            const QImage sprite = cache.frame(spec.prefix + QString::number(number), spec.size, 1.0);
+            timer.start();
+            SpriteCompositor::blendOver(target, sprite, at, kernel);
+            samples.warm << timer.nsecsElapsed();
+        }
+    }
+    samples.warmAllocations = BenchmarkStats::allocations() - allocationsBefore;
+    return samples;
+}
+
+QWidget *RenderBenchmark::buildPanel(bool themed)
+{
+    // Та же раскладка, что у панели USB: заголовок, таблица, две кнопки действий и «Назад»
+    QWidget *panel = themed ? new ThemePanel(ThemePanel::UsbPanel) : new QWidget;
+    panel->setFixedSize(640, 600);
+    if (!themed) panel->setStyleSheet(LegacyPanelStyle);
+    QVBoxLayout *layout = new QVBoxLayout(panel);
+    layout->setContentsMargins(20, 20, 20, 20);
+    QLabel *title = new QLabel("Подключенные USB устройства", panel);
+    title->setFont(QFont("Arial", 20, QFont::Bold));
+    title->setAlignment(Qt::AlignCenter);
+    if (themed) {
+        Theme::applyTitle(title, 8);
+    } else {
+        title->setStyleSheet("background: transparent; color: #2C5AA0; padding: 8px;");
+    }
+    QTableWidget *table = new QTableWidget(PanelTableRows, 3, panel);
+    table->setHorizontalHeaderLabels({"Тип устройства", "Название", "Диск"});
+    table->setAlternatingRowColors(true);
+    table->verticalHeader()->setVisible(false);
+    table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    for (int row = 0; row < PanelTableRows; ++row) {
+        table->setItem(row, 0, new QTableWidgetItem("USB-НАКОПИТЕЛЬ"));
+        table->setItem(row, 1, new QTableWidgetItem("Запоминающее устройство " + QString::number(row + 1)));
+        table->setItem(row, 2, new QTableWidgetItem("E:"));
+    }
+    if (themed) {
+        Theme::applyTable(table, Theme::UsbTable);
+    } else {
+        table->setStyleSheet(LegacyTableStyle);
+    }
+    layout->addWidget(title);
+    layout->addWidget(table, 1);
+    for (const char *text : {"Безопасное извлечение", "Выкл безопасного извлечения", "Назад"}) {
+        QPushButton *button = new QPushButton(QString::fromUtf8(text), panel);
+        button->setFixedHeight(50);
+        if (themed) {
+            Theme::applyButton(button, 15);
+        } else {
+            button->setStyleSheet(LegacyButtonStyle);
+        }
+        layout->addWidget(button);
+    }
+    return panel;
+}
+
+BenchmarkSamples RenderBenchmark::measurePanelConstruction(bool themed)
+{
+    // Создание, полировка стилем, раскладка и первая отрисовка панели
+    BenchmarkSamples samples;
+    QElapsedTimer timer;
+    quint64 allocationsBefore = 0;
+    for (int i = 0; i <= rounds; ++i) {
+        if (i == 1) {
+            allocationsBefore = BenchmarkStats::allocations();
+        }
+        timer.start();
+        QWidget *panel = buildPanel(themed);
+        panel->show();
+        panel->repaint();
+        (i == 0 ? samples.cold : samples.warm) << timer.nsecsElapsed();
+        delete panel;
+    }
+    samples.warmAllocations = BenchmarkStats::allocations() - allocationsBefore;
+    return samples;
+}
+
+BenchmarkSamples RenderBenchmark::measureHoverRepaint(bool themed)
+{
+    // Наведение и уход мыши с каждой кнопки панели: ровно то, что перерисовывается при движении курсора
+    BenchmarkSamples samples;
+    QWidget *panel = buildPanel(themed);
+    panel->show();
+    panel->repaint();
+    const QList<QPushButton *> buttons = panel->findChildren<QPushButton *>();
+    QElapsedTimer timer;
+    const quint64 allocationsBefore = BenchmarkStats::allocations();
+    for (int i = 0; i < BackgroundRepeats * rounds; ++i) {
+        QPushButton *button = buttons[i % buttons.size()];
+        const bool entering = (i / buttons.size()) % 2 == 0;
+        timer.start();
+        button->setAttribute(Qt::WA_UnderMouse, entering);
+        button->repaint();
+        samples.warm << timer.nsecsElapsed();
+    }
+    samples.warmAllocations = BenchmarkStats::allocations() - allocationsBefore;
+    delete panel;
+    return samples;
+}
+
+BenchmarkSamples RenderBenchmark::measureStartup()
+{
+    // Главное окно целиком, от начала конструктора до первого отрисованного кадра (MainWindow::startupStats)
+    BenchmarkSamples samples;
+    quint64 allocationsBefore = 0;
+    for (int round = 0; round < rounds; ++round) {
+        if (round == 1) {
+            allocationsBefore = BenchmarkStats::allocations();
+        }
+        MainWindow *window = new MainWindow;
+        QEventLoop loop;
+        QObject::connect(window, &MainWindow::startupMeasured, &loop, &QEventLoop::quit);
+        QTimer::singleShot(StartupTimeoutMs, &loop, &QEventLoop::quit);
+        window->show();
+        if (window->startupStats().firstFrameMs < 0) {
+            loop.exec();
+        }
+        const MainWindow::StartupStats stats = window->startupStats();
+        delete window;
+        if (stats.firstFrameMs < 0) {
+            out << "MainWindow: no frame within " << StartupTimeoutMs << " ms" << Qt::endl;
+            break;
+        }
+        (round == 0 ? samples.cold : samples.warm) << stats.firstFrameMs * 1000000;
+    }
+    samples.warmAllocations = BenchmarkStats::allocations() - allocationsBefore;
+    return samples;
+}
+
+qint64 RenderBenchmark::paintSprite(const QString &assetName, const QSize &size)
+{
+    QElapsedTimer timer;
+    timer.start();
+    scene.setSprite(cache.frame(assetName, size, scene.devicePixelRatioF()), spriteRect(size));
+    flushScene();
+    return timer.nsecsElapsed();
+}
+
+void RenderBenchmark::flushScene()
+{
+    // Отложенный update() отрисовывается синхронно, без ожидания цикла событий
+    QCoreApplication::sendPostedEvents(&scene, QEvent::UpdateRequest);
+}
+
+QRect RenderBenchmark::spriteRect(const QSize &size)
+{
+    // Положение спрайта на главном экране без открытых панелей
+    return QRect(QPoint((SceneWidth - size.width()) / 2, (SceneHeight - size.height()) / 2 + 150), size);
+}
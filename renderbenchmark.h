@@ -0,0 +1,61 @@
+#ifndef RENDERBENCHMARK_H
+#define RENDERBENCHMARK_H
+
+#include <QList>
+#include <QWidget>
+#include <QString>
+#include <QTextStream>
+#include "assetpack.h"
+#include "benchmarkstats.h"
+#include "framecache.h"
+#include "scenewidget.h"
+#include "spritecompositor.h"
+
+// Замеры отрисовки без окна (платформа offscreen): проигрывает все
+// последовательности кадров через FrameCache и SceneWidget так же, как
+// MainWindow::updateFrame, отдельно меряет drawBackground и
+// BatteryWidget::paintEvent. Печатает p50/p99 времени кадра и число
+// выделений памяти на кадр. Заодно меряет каждое ядро SpriteCompositor
+// и сравнивает создание и перерисовку панели на прежних таблицах стилей
+// и на Theme, а смену размера и DPR кадра — разбором SVG и
+// воспроизведением DisplayList. Время до первого кадра главного окна
+// берётся из MainWindow::startupStats().
+// Собирается только с qmake CONFIG+=benchmark.
+class RenderBenchmark {
+public:
+    RenderBenchmark(const QString &assetsPath, QTextStream &out, int rounds);
+
+    void run();
+
+private:
+    static constexpr int SceneWidth = 1245;
+    static constexpr int SceneHeight = 720;
+    static constexpr int BackgroundRepeats = 50;
+    static constexpr int PanelTableRows = 12;
+    static constexpr int RescaleSteps = 8;
+    static constexpr int StartupTimeoutMs = 10000;
+
+    BenchmarkSamples measureSequence(const AssetPack::SequenceSpec &spec);
+    BenchmarkSamples measureBackground();
+    BenchmarkSamples measureBattery();
+    BenchmarkSamples measureRescale(bool displayList);
+    BenchmarkSamples measureCompositor(SpriteCompositor::Kernel kernel);
+    BenchmarkSamples measurePanelConstruction(bool themed);
+    BenchmarkSamples measureHoverRepaint(bool themed);
+    BenchmarkSamples measureStartup();
+    static QWidget *buildPanel(bool themed);
+    qint64 paintSprite(const QString &assetName, const QSize &size);
+    void flushScene();
+
+    static QRect spriteRect(const QSize &size);
+
+    QString assetsPath;
+    QTextStream &out;
+    int rounds;
+    AssetPack pack;
+    FrameCache cache;
+    SceneWidget scene;
+    QImage backgroundFrame;
+};
+
+#endif // RENDERBENCHMARK_H
@@ -0,0 +1,152 @@
+#include "scenewidget.h"
+#include "spritecompositor.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QRegion>
+#include <cstring>
+
+SceneWidget::SceneWidget(QWidget *parent) : QWidget(parent)
+{
+    // Сцена всегда полностью перекрывает свою область, очищать её перед отрисовкой не нужно
+    setAttribute(Qt::WA_OpaquePaintEvent);
+}
+
+void SceneWidget::setBackgroundImage(const QImage &image)
+{
+    backgroundImage = image;
+    backgroundLayer = QImage();
+    frameBuffer = QImage();
+    update();
+}
+
+void SceneWidget::setSprite(const QImage &sprite, const QRect &rect)
+{
+    QRegion dirty(spriteRect);
+    dirty += rect;
+    // Буфер правится сразу: старое место спрайта закрывается фоном, новое получает спрайт
+    if (!frameBuffer.isNull()) {
+        restoreBackground(spriteRect);
+    }
+    spriteImage = sprite;
+    spriteRect = rect;
+    if (!frameBuffer.isNull()) {
+        composeSprite();
+    }
+    spritePending = true;
+    update(dirty);
+}
+
+void SceneWidget::setOverlayVisible(bool visible)
+{
+    if (visible == overlayVisible) {
+        return;
+    }
+    overlayVisible = visible;
+    update(overlayRect());
+}
+
+bool SceneWidget::isOverlayVisible() const
+{
+    return overlayVisible;
+}
+
+void SceneWidget::setOverlayText(const QString &text)
+{
+    if (text == overlayText) {
+        return;
+    }
+    overlayText = text;
+    if (overlayVisible) {
+        update(overlayRect());
+    }
+}
+
+QRect SceneWidget::overlayRect() const
+{
+    return QRect(10, height() - 100, 320, 90);
+}
+
+void SceneWidget::resizeEvent(QResizeEvent *event)
+{
+    backgroundLayer = QImage();
+    frameBuffer = QImage();
+    QWidget::resizeEvent(event);
+}
+
+void SceneWidget::ensureFrameBuffer()
+{
+    // Слой пересобирается из уже декодированного JPEG только при смене размера или DPR
+    const qreal dpr = devicePixelRatioF();
+    if (!frameBuffer.isNull() && qFuzzyCompare(frameBuffer.devicePixelRatio(), dpr)) {
+        return;
+    }
+    backgroundLayer = QImage(size() * dpr, QImage::Format_RGB32);
+    backgroundLayer.setDevicePixelRatio(dpr);
+    if (backgroundImage.isNull()) {
+        backgroundLayer.fill(Qt::lightGray);
+    } else {
+        QPainter painter(&backgroundLayer);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform);
+        painter.drawImage(QRectF(rect()), backgroundImage);
+    }
+    frameBuffer = backgroundLayer.copy();
+    frameBuffer.setDevicePixelRatio(dpr);
+    composeSprite();
+}
+
+QRect SceneWidget::deviceRect(const QRect &rect) const
+{
+    const qreal dpr = frameBuffer.devicePixelRatio();
+    return QRect(QPoint(qRound(rect.x() * dpr), qRound(rect.y() * dpr)),
+                 QSize(qRound(rect.width() * dpr), qRound(rect.height() * dpr)));
+}
+
+void SceneWidget::restoreBackground(const QRect &rect)
+{
+    const QRect area = deviceRect(rect) & frameBuffer.rect();
+    const size_t rowBytes = size_t(area.width()) * sizeof(QRgb);
+    for (int y = area.top(); y <= area.bottom(); ++y) {
+        std::memcpy(frameBuffer.scanLine(y) + area.x() * sizeof(QRgb),
+                    backgroundLayer.constScanLine(y) + area.x() * sizeof(QRgb), rowBytes);
+    }
+}
+
+void SceneWidget::composeSprite()
+{
+    if (spriteImage.isNull()) {
+        return;
+    }
+    const QRect target = deviceRect(spriteRect);
+    if (spriteImage.size() == target.size()) {
+        SpriteCompositor::blendOver(frameBuffer, spriteImage, target.topLeft());
+        return;
+    }
+    // Кадр не того размера (нет готового растра под текущий DPR) — общий путь с масштабированием
+    QPainter painter(&frameBuffer);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    painter.drawImage(QRectF(spriteRect), spriteImage);
+}
+
+void SceneWidget::paintEvent(QPaintEvent *event)
+{
+    ensureFrameBuffer();
+    QPainter painter(this);
+    for (const QRect &dirtyRect : event->region()) {
+        painter.drawImage(QRectF(dirtyRect), frameBuffer, QRectF(deviceRect(dirtyRect)));
+    }
+    if (overlayVisible && event->region().intersects(overlayRect())) {
+        const QRect box = overlayRect();
+        painter.fillRect(box, QColor(0, 0, 0, 170));
+        painter.setPen(Qt::white);
+        painter.setFont(QFont("Consolas", 9));
+        painter.drawText(box.adjusted(8, 6, -8, -6), Qt::AlignLeft | Qt::AlignTop, overlayText);
+    }
+    if (spritePending) {
+        spritePending = false;
+        emit spritePresented();
+    }
+    if (!firstFrameReported) {
+        firstFrameReported = true;
+        emit firstFramePainted();
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef SCENEWIDGET_H
+#define SCENEWIDGET_H
+
+#include <QWidget>
+#include <QImage>
+#include <QRect>
+#include <QString>
+
+// Сцена главного окна: фон рисуется из готового слоя, поверх — спрайт Кроша.
+// При смене кадра перерисовывается только объединение старого и нового
+// прямоугольников спрайта, а не всё окно 1245x720. Спрайт накладывается
+// на кадровый буфер через SpriteCompositor, paintEvent только копирует буфер.
+class SceneWidget : public QWidget {
+    Q_OBJECT
+public:
+    explicit SceneWidget(QWidget *parent = nullptr);
+
+    void setBackgroundImage(const QImage &image);
+    void setSprite(const QImage &sprite, const QRect &rect);
+    // Отладочная плашка поверх сцены (F12): рисуется в окно, в кадровый буфер не попадает
+    void setOverlayVisible(bool visible);
+    bool isOverlayVisible() const;
+    void setOverlayText(const QString &text);
+
+signals:
+    // Первая отрисовка сцены — по ней меряется время запуска
+    void firstFramePainted();
+    // Спрайт из последнего setSprite выведен на экран
+    void spritePresented();
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+
+private:
+    void ensureFrameBuffer();
+    QRect deviceRect(const QRect &rect) const;
+    void restoreBackground(const QRect &rect);
+    void composeSprite();
+    QRect overlayRect() const;
+
+    QImage backgroundImage;
+    QImage backgroundLayer;
+    QImage frameBuffer;
+    QImage spriteImage;
+    QRect spriteRect;
+    QString overlayText;
+    bool overlayVisible = false;
+    bool spritePending = false;
+    bool firstFrameReported = false;
+};
+
+#endif // SCENEWIDGET_H
@@ -0,0 +1,195 @@
+#include "spritecompositor.h"
+#include <QRect>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPRITECOMPOSITOR_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__)
+#define SPRITECOMPOSITOR_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define SPRITECOMPOSITOR_AVX2_TARGET
+#endif
+
+namespace {
+
+using BlendRow = void (*)(quint32 *dst, const quint32 *src, int count);
+
+// BYTE_MUL из qdrawhelper: x * a / 255 по всем четырём каналам с тем же округлением
+inline quint32 byteMul(quint32 x, quint32 a)
+{
+    quint32 t = (x & 0xff00ff) * a;
+    t = (t + ((t >> 8) & 0xff00ff) + 0x800080) >> 8;
+    t &= 0xff00ff;
+    x = ((x >> 8) & 0xff00ff) * a;
+    x = (x + ((x >> 8) & 0xff00ff) + 0x800080);
+    x &= 0xff00ff00;
+    return x | t;
+}
+
+inline quint32 blendPixel(quint32 d, quint32 s)
+{
+    const quint32 alpha = s >> 24;
+    if (alpha == 255) return s;
+    if (alpha == 0) return d;
+    return s + byteMul(d, 255 - alpha);
+}
+
+void blendRowScalar(quint32 *dst, const quint32 *src, int count)
+{
+    for (int x = 0; x < count; ++x) {
+        dst[x] = blendPixel(dst[x], src[x]);
+    }
+}
+
+#ifdef SPRITECOMPOSITOR_X86
+void blendRowSse2(quint32 *dst, const quint32 *src, int count)
+{
+    const __m128i alphaMask = _mm_set1_epi32(int(0xff000000));
+    const __m128i colorMask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i half = _mm_set1_epi16(0x80);
+    const __m128i one = _mm_set1_epi16(0xff);
+    const __m128i zero = _mm_setzero_si128();
+    int x = 0;
+    for (; x + 4 <= count; x += 4) {
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+        const __m128i alpha = _mm_and_si128(s, alphaMask);
+        // Целиком прозрачные и целиком непрозрачные четвёрки — самые частые на спрайте
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) == 0xffff) continue;
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xffff) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), s);
+            continue;
+        }
+        __m128i inverse = _mm_srli_epi32(s, 24);
+        inverse = _mm_or_si128(inverse, _mm_slli_epi32(inverse, 16));
+        inverse = _mm_sub_epi16(one, inverse);
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + x));
+        __m128i ag = _mm_mullo_epi16(_mm_srli_epi16(d, 8), inverse);
+        __m128i rb = _mm_mullo_epi16(_mm_and_si128(d, colorMask), inverse);
+        rb = _mm_add_epi16(_mm_add_epi16(rb, _mm_srli_epi16(rb, 8)), half);
+        ag = _mm_add_epi16(_mm_add_epi16(ag, _mm_srli_epi16(ag, 8)), half);
+        rb = _mm_srli_epi16(rb, 8);
+        ag = _mm_andnot_si128(colorMask, ag);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), _mm_add_epi8(s, _mm_or_si128(ag, rb)));
+    }
+    blendRowScalar(dst + x, src + x, count - x);
+}
+
+SPRITECOMPOSITOR_AVX2_TARGET
+void blendRowAvx2(quint32 *dst, const quint32 *src, int count)
+{
+    const __m256i alphaMask = _mm256_set1_epi32(int(0xff000000));
+    const __m256i colorMask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i half = _mm256_set1_epi16(0x80);
+    const __m256i one = _mm256_set1_epi16(0xff);
+    const __m256i zero = _mm256_setzero_si256();
+    int x = 0;
+    for (; x + 8 <= count; x += 8) {
+        const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + x));
+        const __m256i alpha = _mm256_and_si256(s, alphaMask);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(alpha, zero)) == -1) continue;
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(alpha, alphaMask)) == -1) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x), s);
+            continue;
+        }
+        __m256i inverse = _mm256_srli_epi32(s, 24);
+        inverse = _mm256_or_si256(inverse, _mm256_slli_epi32(inverse, 16));
+        inverse = _mm256_sub_epi16(one, inverse);
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + x));
+        __m256i ag = _mm256_mullo_epi16(_mm256_srli_epi16(d, 8), inverse);
+        __m256i rb = _mm256_mullo_epi16(_mm256_and_si256(d, colorMask), inverse);
+        rb = _mm256_add_epi16(_mm256_add_epi16(rb, _mm256_srli_epi16(rb, 8)), half);
+        ag = _mm256_add_epi16(_mm256_add_epi16(ag, _mm256_srli_epi16(ag, 8)), half);
+        rb = _mm256_srli_epi16(rb, 8);
+        ag = _mm256_andnot_si256(colorMask, ag);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x), _mm256_add_epi8(s, _mm256_or_si256(ag, rb)));
+    }
+    blendRowSse2(dst + x, src + x, count - x);
+}
+
+bool cpuHasAvx2()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    // AVX2 годится, только если ОС сохраняет регистры YMM (OSXSAVE + XCR0)
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave || (_xgetbv(0) & 0x6) != 0x6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif defined(__GNUC__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+#endif // SPRITECOMPOSITOR_X86
+
+BlendRow rowFunction(SpriteCompositor::Kernel kernel)
+{
+#ifdef SPRITECOMPOSITOR_X86
+    if (kernel == SpriteCompositor::Avx2) return blendRowAvx2;
+    if (kernel == SpriteCompositor::Sse2) return blendRowSse2;
+#else
+    Q_UNUSED(kernel);
+#endif
+    return blendRowScalar;
+}
+
+} // namespace
+
+SpriteCompositor::Kernel SpriteCompositor::bestKernel()
+{
+    static const Kernel best = availableKernels().constLast();
+    return best;
+}
+
+QList<SpriteCompositor::Kernel> SpriteCompositor::availableKernels()
+{
+    QList<Kernel> kernels{Scalar};
+#ifdef SPRITECOMPOSITOR_X86
+    kernels << Sse2;
+    if (cpuHasAvx2()) kernels << Avx2;
+#endif
+    return kernels;
+}
+
+const char *SpriteCompositor::kernelName(Kernel kernel)
+{
+    switch (kernel) {
+    case Avx2: return "avx2";
+    case Sse2: return "sse2";
+    default: return "scalar";
+    }
+}
+
+void SpriteCompositor::blendOver(QImage &target, const QImage &sprite, const QPoint &at)
+{
+    blendOver(target, sprite, at, bestKernel());
+}
+
+void SpriteCompositor::blendOver(QImage &target, const QImage &sprite, const QPoint &at, Kernel kernel)
+{
+    Q_ASSERT(target.format() == QImage::Format_RGB32 || target.format() == QImage::Format_ARGB32_Premultiplied);
+    if (sprite.isNull() || target.isNull()) return;
+    const QImage source = sprite.format() == QImage::Format_ARGB32_Premultiplied
+                              ? sprite : sprite.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    const QRect area = QRect(at, source.size()) & target.rect();
+    if (area.isEmpty()) return;
+
+    const BlendRow blendRow = rowFunction(kernel);
+    const int sourceX = area.x() - at.x();
+    const int sourceY = area.y() - at.y();
+    for (int y = 0; y < area.height(); ++y) {
+        quint32 *dst = reinterpret_cast<quint32 *>(target.scanLine(area.y() + y)) + area.x();
+        const quint32 *src = reinterpret_cast<const quint32 *>(source.constScanLine(sourceY + y)) + sourceX;
+        blendRow(dst, src, area.width());
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef SPRITECOMPOSITOR_H
+#define SPRITECOMPOSITOR_H
+
+#include <QImage>
+#include <QList>
+#include <QPoint>
+
+// Наложение спрайта (ARGB32_Premultiplied) поверх непрозрачного фона
+// (RGB32 или ARGB32_Premultiplied) режимом SourceOver. Округление то же,
+// что у растрового движка QPainter, поэтому результат совпадает с
+// drawImage попиксельно. Ядро SSE2/AVX2 выбирается по процессору при запуске.
+class SpriteCompositor {
+public:
+    enum Kernel { Scalar, Sse2, Avx2 };
+
+    static Kernel bestKernel();
+    static QList<Kernel> availableKernels();
+    static const char *kernelName(Kernel kernel);
+
+    // Спрайт ставится левым верхним углом в точку at (в пикселях target) и обрезается по target
+    static void blendOver(QImage &target, const QImage &sprite, const QPoint &at);
+    static void blendOver(QImage &target, const QImage &sprite, const QPoint &at, Kernel kernel);
+};
+
+#endif // SPRITECOMPOSITOR_H
@@ -0,0 +1,33 @@
+#include "pciidsfixture.h"
+#include "pcicodes.h"
+#include "pcidb.h"
+#include <QString>
+#include <iterator>
+
+QByteArray pciIdsFromBuiltinTables()
+{
+    // В старой таблице в названиях встречаются переводы строк — они схлопываются.
+    // Производитель без названия получает заглушку, иначе строка pci.ids не разберётся
+    QByteArray text = "# pci.ids built from pcicodes.h\n\n";
+    const PciDeviceRecord *device = std::begin(PciDeviceRecords);
+    auto writeVendor = [&](quint16 vendorId) {
+        const QString name = PciDatabase::builtinVendorName(vendorId).simplified();
+        text += QString::asprintf("%04x  ", vendorId).toLatin1() + (name.isEmpty() ? "(unnamed)" : name.toUtf8()) + '\n';
+        for (; device != std::end(PciDeviceRecords) && device->key >> 16 == vendorId; ++device) {
+            const QString deviceName = PciDatabase::builtinDeviceName(vendorId, quint16(device->key)).simplified();
+            if (deviceName.isEmpty()) continue;
+            text += QString::asprintf("\t%04x  ", device->key & 0xFFFF).toLatin1() + deviceName.toUtf8() + '\n';
+        }
+    };
+    for (const PciVendorRecord &vendor : PciVendorRecords) {
+        // Устройства производителей, которых нет в таблице производителей
+        while (device != std::end(PciDeviceRecords) && device->key >> 16 < vendor.venId) {
+            writeVendor(quint16(device->key >> 16));
+        }
+        writeVendor(vendor.venId);
+    }
+    while (device != std::end(PciDeviceRecords)) {
+        writeVendor(quint16(device->key >> 16));
+    }
+    return text;
+}
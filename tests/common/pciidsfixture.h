@@ -0,0 +1,10 @@
+#ifndef PCIIDSFIXTURE_H
+#define PCIIDSFIXTURE_H
+
+#include <QByteArray>
+
+// Встроенные таблицы pcicodes.h в формате pci.ids, названия в одну строку.
+// Только для тестов и замеров IdsDatabase, в приложение не входит
+QByteArray pciIdsFromBuiltinTables();
+
+#endif // PCIIDSFIXTURE_H
@@ -0,0 +1,24 @@
+QT = core testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_idsdatabase
+TEMPLATE = app
+
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    tst_idsdatabase.cpp \
+    $$PWD/../common/pciidsfixture.cpp \
+    $$PWD/../../idsdatabase.cpp \
+    $$PWD/../../pcidb.cpp
+
+HEADERS += \
+    $$PWD/../common/pciidsfixture.h \
+    $$PWD/../../idsdatabase.h \
+    $$PWD/../../pcicodes.h \
+    $$PWD/../../pcidb.h
+
+DISTFILES += \
+    pci.ids
@@ -0,0 +1,177 @@
+#include "idsdatabase.h"
+#include "pcicodes.h"
+#include "pcidb.h"
+#include "tests/common/pciidsfixture.h"
+#include <QDateTime>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// IdsDatabase на маленьком pci.ids, написанном вручную (подсистемы, классы,
+// повторы ID), и на большом, собранном из встроенных таблиц pcicodes.h
+class TestIdsDatabase : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void parsesHandWrittenFile();
+    void rejectsIndexAfterTouch();
+    void rejectsIndexAfterResize();
+    void buildsAndReusesIndex();
+    void namesMatchBuiltinTables();
+
+private:
+    QString copyHandWritten(const QString &name);
+
+    QTemporaryDir scratch;
+    QString idsPath;
+};
+
+void TestIdsDatabase::initTestCase()
+{
+    QVERIFY(scratch.isValid());
+    idsPath = scratch.filePath("pci.ids");
+    const QByteArray text = pciIdsFromBuiltinTables();
+    QFile file(idsPath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write(text), text.size());
+}
+
+QString TestIdsDatabase::copyHandWritten(const QString &name)
+{
+    // Копия в scratch: индекс пишется рядом с файлом, а время изменения меняют тесты
+    const QString path = scratch.filePath(name);
+    QFile::remove(path);
+    QFile::remove(path + ".idx");
+    if (!QFile::copy(QFINDTESTDATA("pci.ids"), path)) {
+        return QString();
+    }
+    QFile::setPermissions(path, QFile::ReadOwner | QFile::WriteOwner);
+    return path;
+}
+
+void TestIdsDatabase::parsesHandWrittenFile()
+{
+    const QString path = copyHandWritten("parse.ids");
+    QVERIFY(!path.isEmpty());
+    IdsDatabase database;
+    QVERIFY(database.open(path));
+    QCOMPARE(database.vendorCount(), 3);
+    QCOMPARE(database.deviceCount(), 5);
+
+    QCOMPARE(database.vendorName(0x8086), QString("Intel Corporation"));
+    QCOMPARE(database.vendorName(0x10de), QString("NVIDIA Corporation"));
+    QCOMPARE(database.vendorName(0x1af4), QString("Red Hat, Inc."));
+    QCOMPARE(database.deviceName(0x8086, 0x1229), QString("82557/8/9/0/1 Ethernet Pro 100"));
+    QCOMPARE(database.deviceName(0x8086, 0x10d3), QString("82574L Gigabit Network Connection"));
+    QCOMPARE(database.deviceName(0x10de, 0x2684), QString("AD102 [GeForce RTX 4090]"));
+    QCOMPARE(database.deviceName(0x1af4, 0x1000), QString("Virtio network device"));
+    // Устройство под повтором производителя всё равно принадлежит ему
+    QCOMPARE(database.deviceName(0x8086, 0xabcd), QString("Device listed under the duplicate vendor"));
+
+    // Подсистемы не становятся ни устройствами, ни производителями
+    QVERIFY(database.deviceName(0x8086, 0x8086).isEmpty());
+    QVERIFY(database.deviceName(0x8086, 0x1028).isEmpty());
+    QVERIFY(database.deviceName(0x10de, 0x10de).isEmpty());
+    QVERIFY(database.vendorName(0x1028).isEmpty());
+    // Строки раздела классов не прилипают к последнему производителю
+    QVERIFY(database.deviceName(0x1af4, 0x2000).isEmpty());
+    QVERIFY(database.deviceName(0x1af4, 0x0003).isEmpty());
+    QVERIFY(database.vendorName(0x0002).isEmpty());
+    QVERIFY(database.vendorName(0x000c).isEmpty());
+}
+
+void TestIdsDatabase::rejectsIndexAfterTouch()
+{
+    const QString path = copyHandWritten("touch.ids");
+    QVERIFY(!path.isEmpty());
+    {
+        IdsDatabase database;
+        QVERIFY(database.open(path));
+        QVERIFY(!database.isIndexCached());
+    }
+    QVERIFY(QFile::exists(path + ".idx"));
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.setFileTime(file.fileTime(QFileDevice::FileModificationTime).addSecs(60),
+                             QFileDevice::FileModificationTime));
+    file.close();
+
+    // Старый индекс отвергнут и заменён новым
+    IdsDatabase touched;
+    QVERIFY(touched.open(path));
+    QVERIFY(!touched.isIndexCached());
+    QCOMPARE(touched.vendorName(0x8086), QString("Intel Corporation"));
+    IdsDatabase reopened;
+    QVERIFY(reopened.open(path));
+    QVERIFY(reopened.isIndexCached());
+}
+
+void TestIdsDatabase::rejectsIndexAfterResize()
+{
+    const QString path = copyHandWritten("resize.ids");
+    QVERIFY(!path.isEmpty());
+    {
+        IdsDatabase database;
+        QVERIFY(database.open(path));
+        QVERIFY(!database.isIndexCached());
+    }
+
+    // Новый производитель в конце, время изменения возвращено прежним: отличается только размер
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadWrite | QIODevice::Append));
+    const QDateTime modified = file.fileTime(QFileDevice::FileModificationTime);
+    QVERIFY(file.write("10ec  Realtek Semiconductor Co., Ltd.\n") > 0);
+    QVERIFY(file.flush());
+    QVERIFY(file.setFileTime(modified, QFileDevice::FileModificationTime));
+    file.close();
+
+    IdsDatabase resized;
+    QVERIFY(resized.open(path));
+    QVERIFY(!resized.isIndexCached());
+    QCOMPARE(resized.vendorCount(), 4);
+    QCOMPARE(resized.vendorName(0x10ec), QString("Realtek Semiconductor Co., Ltd."));
+}
+
+void TestIdsDatabase::buildsAndReusesIndex()
+{
+    QFile::remove(idsPath + ".idx");
+    IdsDatabase first;
+    QVERIFY(first.open(idsPath));
+    QVERIFY(!first.isIndexCached());
+    QVERIFY(first.vendorCount() > 0);
+    QVERIFY(first.deviceCount() > 0);
+
+    // Второе открытие берёт индекс с диска, а не разбирает текст заново
+    IdsDatabase second;
+    QVERIFY(second.open(idsPath));
+    QVERIFY(second.isIndexCached());
+    QCOMPARE(second.vendorCount(), first.vendorCount());
+    QCOMPARE(second.deviceCount(), first.deviceCount());
+}
+
+void TestIdsDatabase::namesMatchBuiltinTables()
+{
+    // Каждая запись встроенных таблиц должна находиться в pci.ids с тем же названием
+    IdsDatabase database;
+    QVERIFY(database.open(idsPath));
+    for (const PciVendorRecord &vendor : PciVendorRecords) {
+        const QString expected = PciDatabase::builtinVendorName(vendor.venId).simplified();
+        if (expected.isEmpty()) continue;
+        QVERIFY2(database.vendorName(vendor.venId) == expected,
+                 qPrintable(QString::asprintf("vendor %04x", vendor.venId)));
+    }
+    for (const PciDeviceRecord &device : PciDeviceRecords) {
+        const quint16 vendorId = quint16(device.key >> 16);
+        const quint16 deviceId = quint16(device.key);
+        const QString expected = PciDatabase::builtinDeviceName(vendorId, deviceId).simplified();
+        if (expected.isEmpty()) continue;
+        QVERIFY2(database.deviceName(vendorId, deviceId) == expected,
+                 qPrintable(QString::asprintf("device %04x:%04x", vendorId, deviceId)));
+    }
+}
+
+QTEST_GUILESS_MAIN(TestIdsDatabase)
+
+#include "tst_idsdatabase.moc"
@@ -0,0 +1,16 @@
+QT = core testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_pcihwid
+TEMPLATE = app
+
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    tst_pcihwid.cpp \
+    $$PWD/../../pcihwid.cpp
+
+HEADERS += \
+    $$PWD/../../pcihwid.h
@@ -0,0 +1,164 @@
+#include "pcihwid.h"
+#include <QByteArrayList>
+#include <QRandomGenerator>
+#include <QtTest>
+#include <regex>
+#include <string>
+
+// Список REG_MULTI_SZ: строки через '\0' и пустая строка в конце
+static QByteArray multiSz(const QByteArrayList &ids)
+{
+    QByteArray result;
+    for (const QByteArray &id : ids) {
+        result += id + '\0';
+    }
+    return result + '\0';
+}
+
+class TestPciHwid : public QObject {
+    Q_OBJECT
+
+private slots:
+    void parse_data();
+    void parse();
+    void findInList_data();
+    void findInList();
+    void classCode_data();
+    void classCode();
+    void matchesRegex();
+};
+
+void TestPciHwid::parse_data()
+{
+    // subsystem и revision: -1 — не разобраны
+    QTest::addColumn<QByteArray>("id");
+    QTest::addColumn<bool>("found");
+    QTest::addColumn<int>("vendor");
+    QTest::addColumn<int>("device");
+    QTest::addColumn<qint64>("subsystem");
+    QTest::addColumn<int>("revision");
+
+    QTest::newRow("full") << QByteArray("PCI\\VEN_8086&DEV_A370&SUBSYS_00348086&REV_10")
+                          << true << 0x8086 << 0xA370 << qint64(0x00348086) << 0x10;
+    QTest::newRow("lowercase") << QByteArray("PCI\\VEN_10de&DEV_1c82") << true << 0x10DE << 0x1C82 << qint64(-1) << -1;
+    QTest::newRow("revision only") << QByteArray("PCI\\VEN_8086&DEV_A370&REV_03")
+                                   << true << 0x8086 << 0xA370 << qint64(-1) << 0x03;
+    QTest::newRow("short subsystem") << QByteArray("PCI\\VEN_8086&DEV_A370&SUBSYS_0034")
+                                     << true << 0x8086 << 0xA370 << qint64(-1) << -1;
+    QTest::newRow("second occurrence") << QByteArray("PCI\\VEN_XYZ1&DEV_0000PCI\\VEN_1234&DEV_5678")
+                                       << true << 0x1234 << 0x5678 << qint64(-1) << -1;
+    QTest::newRow("short device") << QByteArray("PCI\\VEN_8086&DEV_A37") << false << 0 << 0 << qint64(-1) << -1;
+    QTest::newRow("usb") << QByteArray("USB\\VID_046D&PID_C52B") << false << 0 << 0 << qint64(-1) << -1;
+    QTest::newRow("empty") << QByteArray() << false << 0 << 0 << qint64(-1) << -1;
+}
+
+void TestPciHwid::parse()
+{
+    QFETCH(QByteArray, id);
+    QFETCH(bool, found);
+    QFETCH(int, vendor);
+    QFETCH(int, device);
+    QFETCH(qint64, subsystem);
+    QFETCH(int, revision);
+
+    PciHardwareId hwid;
+    QCOMPARE(parsePciHardwareId(id.constData(), size_t(id.size()), hwid), found);
+    if (!found) {
+        return;
+    }
+    QCOMPARE(int(hwid.vendor), vendor);
+    QCOMPARE(int(hwid.device), device);
+    QCOMPARE(hwid.hasSubsystem, subsystem >= 0);
+    if (hwid.hasSubsystem) {
+        QCOMPARE(int(hwid.subsystemDevice), int(subsystem >> 16));
+        QCOMPARE(int(hwid.subsystemVendor), int(subsystem & 0xFFFF));
+    }
+    QCOMPARE(hwid.hasRevision, revision >= 0);
+    if (hwid.hasRevision) {
+        QCOMPARE(int(hwid.revision), revision);
+    }
+}
+
+void TestPciHwid::findInList_data()
+{
+    QTest::addColumn<QByteArray>("ids");
+    QTest::addColumn<bool>("found");
+    QTest::addColumn<int>("vendor");
+
+    QTest::newRow("first") << multiSz({"PCI\\VEN_1AF4&DEV_1000&SUBSYS_00011AF4", "PCI\\VEN_1AF4&DEV_1000"})
+                           << true << 0x1AF4;
+    QTest::newRow("after usb") << multiSz({"USB\\VID_1D6B&PID_0002", "PCI\\VEN_15B3&DEV_101E"}) << true << 0x15B3;
+    QTest::newRow("acpi") << multiSz({"ACPI\\PNP0C0A", "*PNP0C0A"}) << false << 0;
+    QTest::newRow("empty list") << multiSz({}) << false << 0;
+    // Последняя строка без завершающего нуля не должна выводить за конец буфера
+    QTest::newRow("unterminated") << QByteArray("ACPI\\PNP0A08\0PCI\\VEN_8086&DEV_1237", 34) << true << 0x8086;
+}
+
+void TestPciHwid::findInList()
+{
+    QFETCH(QByteArray, ids);
+    QFETCH(bool, found);
+    QFETCH(int, vendor);
+
+    PciHardwareId hwid;
+    QCOMPARE(findPciHardwareId(ids.constData(), size_t(ids.size()), hwid), found);
+    if (found) {
+        QCOMPARE(int(hwid.vendor), vendor);
+    }
+}
+
+void TestPciHwid::classCode_data()
+{
+    QTest::addColumn<QByteArray>("ids");
+    QTest::addColumn<bool>("found");
+    QTest::addColumn<int>("classCode");
+
+    QTest::newRow("full code") << multiSz({"PCI\\VEN_8086&DEV_A370&CC_030000", "PCI\\CC_0300"}) << true << 0x030000;
+    QTest::newRow("subclass only") << multiSz({"PCI\\CC_0C03"}) << true << 0x0C0300;
+    QTest::newRow("full code later") << multiSz({"PCI\\CC_0C03", "PCI\\VEN_8086&CC_0C0330"}) << true << 0x0C0330;
+    QTest::newRow("inside another tag") << multiSz({"PCI\\VEN_8086&DEV_ACC_123456"}) << false << 0;
+    QTest::newRow("too many digits") << multiSz({"PCI\\CC_0C03301"}) << false << 0;
+    QTest::newRow("empty list") << multiSz({}) << false << 0;
+}
+
+void TestPciHwid::classCode()
+{
+    QFETCH(QByteArray, ids);
+    QFETCH(bool, found);
+    QFETCH(int, classCode);
+
+    quint32 parsed = 0;
+    QCOMPARE(findPciClassCode(ids.constData(), size_t(ids.size()), parsed), found);
+    if (found) {
+        QCOMPARE(int(parsed), classCode);
+    }
+}
+
+void TestPciHwid::matchesRegex()
+{
+    // Случайные склейки из обрывков ID: совпадение с прежним регулярным выражением и по наличию, и по значениям
+    static const char *const pieces[] = {"PCI\\VEN_", "&DEV_", "&SUBSYS_", "&REV_", "8086", "A3", "7", "0",
+                                         "g", "PCI", "\\", "&", "USB\\VID_", "f", "Ff9", "PCI\\VEN_10DE&DEV_"};
+    const std::regex pciRe(R"(PCI\\VEN_([0-9A-Fa-f]{4})&DEV_([0-9A-Fa-f]{4}))");
+    QRandomGenerator random(18);
+    for (int i = 0; i < 100000; ++i) {
+        std::string id;
+        const int count = random.bounded(8);
+        for (int k = 0; k < count; ++k) {
+            id += pieces[random.bounded(int(std::size(pieces)))];
+        }
+        std::smatch match;
+        const bool expected = std::regex_search(id, match, pciRe);
+        PciHardwareId hwid;
+        const bool parsed = parsePciHardwareId(id.data(), id.size(), hwid);
+        QVERIFY2(parsed == expected, id.c_str());
+        if (expected) {
+            QVERIFY2(hwid.vendor == std::stoul(match[1], nullptr, 16), id.c_str());
+            QVERIFY2(hwid.device == std::stoul(match[2], nullptr, 16), id.c_str());
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(TestPciHwid)
+
+#include "tst_pcihwid.moc"
@@ -0,0 +1,16 @@
+QT = core gui testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_spritecompositor
+TEMPLATE = app
+
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    tst_spritecompositor.cpp \
+    $$PWD/../../spritecompositor.cpp
+
+HEADERS += \
+    $$PWD/../../spritecompositor.h
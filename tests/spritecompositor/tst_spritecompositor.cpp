@@ -0,0 +1,172 @@
+#include "spritecompositor.h"
+#include <QPainter>
+#include <QRandomGenerator>
+#include <QtTest>
+
+// Каждое ядро SpriteCompositor сверяется попиксельно с QPainter::drawImage
+// и со скалярным ядром. Ширины строк подобраны под хвосты SSE2 (4 пикселя)
+// и AVX2 (8 пикселей), смещения — под невыровненное начало строки фона.
+class TestSpriteCompositor : public QObject {
+    Q_OBJECT
+
+private slots:
+    void blendRows_data();
+    void blendRows();
+    void clipping_data();
+    void clipping();
+    void premultipliedTarget();
+    void unpremultipliedSprite();
+
+private:
+    static constexpr int TargetWidth = 64;
+    static constexpr int TargetHeight = 16;
+
+    static void addKernelRows(const QList<int> &widths, const QList<QPoint> &positions);
+    static QImage background(QImage::Format format);
+    static QImage sprite(int width, int height, quint32 seed);
+    static QImage painted(const QImage &target, const QImage &sprite, const QPoint &at);
+    static QImage blended(const QImage &target, const QImage &sprite, const QPoint &at,
+                          SpriteCompositor::Kernel kernel);
+};
+
+void TestSpriteCompositor::addKernelRows(const QList<int> &widths, const QList<QPoint> &positions)
+{
+    QTest::addColumn<int>("kernel");
+    QTest::addColumn<int>("width");
+    QTest::addColumn<QPoint>("at");
+
+    // Все три ядра: недоступные на этом процессоре пропускаются в самом тесте
+    for (SpriteCompositor::Kernel kernel : {SpriteCompositor::Scalar, SpriteCompositor::Sse2, SpriteCompositor::Avx2}) {
+        for (int width : widths) {
+            for (const QPoint &at : positions) {
+                QTest::addRow("%s w%d at %d,%d", SpriteCompositor::kernelName(kernel), width, at.x(), at.y())
+                    << int(kernel) << width << at;
+            }
+        }
+    }
+}
+
+QImage TestSpriteCompositor::background(QImage::Format format)
+{
+    // Непрозрачный шум: у каждого пикселя свои каналы
+    QImage image(TargetWidth, TargetHeight, format);
+    QRandomGenerator random(7);
+    for (int y = 0; y < image.height(); ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < image.width(); ++x) {
+            line[x] = random.generate() | 0xFF000000u;
+        }
+    }
+    return image;
+}
+
+QImage TestSpriteCompositor::sprite(int width, int height, quint32 seed)
+{
+    // Премультиплицированные пиксели; полностью прозрачные и непрозрачные идут вперемешку с остальными
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    QRandomGenerator random(seed);
+    for (int y = 0; y < image.height(); ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < image.width(); ++x) {
+            const int kind = int(random.bounded(4));
+            const int alpha = kind == 0 ? 0 : kind == 1 ? 255 : int(random.bounded(256));
+            line[x] = qRgba(int(random.bounded(alpha + 1)), int(random.bounded(alpha + 1)),
+                            int(random.bounded(alpha + 1)), alpha);
+        }
+    }
+    return image;
+}
+
+QImage TestSpriteCompositor::painted(const QImage &target, const QImage &sprite, const QPoint &at)
+{
+    QImage reference = target.copy();
+    QPainter painter(&reference);
+    painter.drawImage(at, sprite);
+    painter.end();
+    return reference;
+}
+
+QImage TestSpriteCompositor::blended(const QImage &target, const QImage &sprite, const QPoint &at,
+                                     SpriteCompositor::Kernel kernel)
+{
+    QImage composed = target.copy();
+    SpriteCompositor::blendOver(composed, sprite, at, kernel);
+    return composed;
+}
+
+void TestSpriteCompositor::blendRows_data()
+{
+    addKernelRows({0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 33},
+                  {QPoint(0, 0), QPoint(1, 2), QPoint(3, 5), QPoint(5, 1)});
+}
+
+void TestSpriteCompositor::blendRows()
+{
+    QFETCH(int, kernel);
+    QFETCH(int, width);
+    QFETCH(QPoint, at);
+    if (!SpriteCompositor::availableKernels().contains(SpriteCompositor::Kernel(kernel))) {
+        QSKIP("kernel is not available on this CPU");
+    }
+
+    const QImage target = background(QImage::Format_RGB32);
+    const QImage source = sprite(width, 4, quint32(width));
+    const QImage composed = blended(target, source, at, SpriteCompositor::Kernel(kernel));
+    if (width == 0) {
+        // Пустой спрайт ничего не меняет
+        QCOMPARE(composed, target);
+        return;
+    }
+    QCOMPARE(composed, blended(target, source, at, SpriteCompositor::Scalar));
+    QCOMPARE(composed, painted(target, source, at));
+}
+
+void TestSpriteCompositor::clipping_data()
+{
+    // Спрайт шире фона: видимая часть у правого края — 0, 1, 7, 8 и 9 пикселей,
+    // дальше обрезка слева, сверху, снизу и спрайт целиком за краем
+    addKernelRows({40}, {QPoint(TargetWidth, 3), QPoint(TargetWidth - 1, 3), QPoint(TargetWidth - 7, 3),
+                         QPoint(TargetWidth - 8, 3), QPoint(TargetWidth - 9, 3), QPoint(-13, 3),
+                         QPoint(-39, 3), QPoint(5, -3), QPoint(5, TargetHeight - 2), QPoint(-40, -6),
+                         QPoint(-20, 0)});
+}
+
+void TestSpriteCompositor::clipping()
+{
+    QFETCH(int, kernel);
+    QFETCH(int, width);
+    QFETCH(QPoint, at);
+    if (!SpriteCompositor::availableKernels().contains(SpriteCompositor::Kernel(kernel))) {
+        QSKIP("kernel is not available on this CPU");
+    }
+
+    const QImage target = background(QImage::Format_RGB32);
+    const QImage source = sprite(width, 6, 11);
+    const QImage composed = blended(target, source, at, SpriteCompositor::Kernel(kernel));
+    QCOMPARE(composed, painted(target, source, at));
+}
+
+void TestSpriteCompositor::premultipliedTarget()
+{
+    const QImage target = background(QImage::Format_ARGB32_Premultiplied);
+    const QImage source = sprite(37, 9, 23);
+    const QPoint at(3, 4);
+    for (SpriteCompositor::Kernel kernel : SpriteCompositor::availableKernels()) {
+        QCOMPARE(blended(target, source, at, kernel), painted(target, source, at));
+    }
+}
+
+void TestSpriteCompositor::unpremultipliedSprite()
+{
+    // Спрайт в ARGB32 переводится в премультиплицированный формат перед наложением
+    const QImage target = background(QImage::Format_RGB32);
+    const QImage source = sprite(21, 5, 31).convertToFormat(QImage::Format_ARGB32);
+    const QPoint at(1, 1);
+    for (SpriteCompositor::Kernel kernel : SpriteCompositor::availableKernels()) {
+        QCOMPARE(blended(target, source, at, kernel), painted(target, source, at));
+    }
+}
+
+QTEST_GUILESS_MAIN(TestSpriteCompositor)
+
+#include "tst_spritecompositor.moc"
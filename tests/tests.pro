@@ -0,0 +1,7 @@
+# Модульные тесты: make check из каталога сборки
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    idsdatabase \
+    pcihwid \
+    spritecompositor
@@ -0,0 +1,367 @@
+#include "theme.h"
+#include <QApplication>
+#include <QHash>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QPushButton>
+#include <QStyleOption>
+#include <QTableView>
+
+namespace {
+
+// Градиент в долях прямоугольника: одна кисть годится для любого размера
+QBrush gradient(qreal x2, qreal y2, const QColor &from, const QColor &to)
+{
+    QLinearGradient linear(0, 0, x2, y2);
+    linear.setCoordinateMode(QGradient::ObjectBoundingMode);
+    linear.setColorAt(0, from);
+    linear.setColorAt(1, to);
+    return QBrush(linear);
+}
+
+QFont pixelFont(const QString &family, int pixelSize, bool bold)
+{
+    QFont font(family);
+    font.setPixelSize(pixelSize);
+    font.setBold(bold);
+    return font;
+}
+
+struct TableLook {
+    QColor base;
+    QColor alternate;
+    QColor text;
+    QColor grid;
+    QColor border;
+    QColor selection;
+    QColor hoverText;
+    QBrush item;
+    QBrush itemHover;
+    QBrush header;
+    QBrush headerHover;
+    QFont font;
+    QFont headerFont;
+    int radius;
+    QSize itemPadding;
+    QSize headerPadding;
+};
+
+struct PanelLook {
+    QBrush fill;
+    QColor border;
+    int borderWidth;
+    int radius;
+};
+
+struct Look {
+    QColor accent{74, 144, 226, 220};
+    QColor accentHover{53, 122, 189, 220};
+    QColor accentPressed{44, 90, 160, 240};
+    QColor accentDisabled{74, 144, 226, 100};
+    QColor title{0x2C, 0x5A, 0xA0};
+    QColor caption{0x33, 0x33, 0x33};
+    QSize buttonPadding{20, 20};
+    int buttonRadius = 8;
+    TableLook usb;
+    TableLook pci;
+    PanelLook panels[4];
+
+    Look()
+    {
+        usb.base = QColor(255, 255, 255, 240);
+        usb.alternate = QColor(248, 250, 255, 200);
+        usb.text = caption;
+        usb.grid = QColor(74, 144, 226, 40);
+        usb.border = QColor(74, 144, 226, 100);
+        usb.selection = QColor(74, 144, 226, 100);
+        usb.hoverText = title;
+        usb.item = Qt::NoBrush;
+        usb.itemHover = gradient(1, 0, QColor(74, 144, 226, 15), QColor(74, 144, 226, 5));
+        usb.header = gradient(0, 1, QColor(74, 144, 226, 240), QColor(53, 122, 189, 220));
+        usb.headerHover = gradient(0, 1, QColor(53, 122, 189, 255), QColor(44, 90, 160, 240));
+        usb.font = pixelFont("Segoe UI", 14, false);
+        usb.headerFont = pixelFont("Segoe UI", 15, true);
+        usb.radius = 12;
+        usb.itemPadding = QSize(16, 24);
+        usb.headerPadding = QSize(16, 24);
+
+        pci.base = Qt::transparent;
+        pci.alternate = QColor(240, 248, 255, 120);
+        pci.text = caption;
+        pci.grid = QColor(74, 144, 226, 100);
+        pci.border = QColor(74, 144, 226, 150);
+        pci.selection = QColor(74, 144, 226, 160);
+        pci.hoverText = caption;
+        pci.item = QColor(255, 255, 255, 200);
+        pci.itemHover = QColor(53, 122, 189, 120);
+        pci.header = QColor(74, 144, 226, 200);
+        pci.headerHover = QColor(53, 122, 189, 200);
+        pci.font = pixelFont("Arial", 16, false);
+        pci.headerFont = pixelFont("Arial", 20, true);
+        pci.radius = 8;
+        pci.itemPadding = QSize(24, 24);
+        pci.headerPadding = QSize(20, 20);
+
+        panels[ThemePanel::PowerPanel] = {QColor(255, 255, 255, 220), QColor(74, 144, 226, 100), 1, 12};
+        panels[ThemePanel::PciPanel] = {QColor(255, 255, 255, 230), QColor(74, 144, 226, 120), 1, 12};
+        panels[ThemePanel::WebcamPanel] = {QColor(255, 255, 255, 240), QColor(74, 144, 226, 150), 2, 15};
+        panels[ThemePanel::UsbPanel] = {gradient(1, 1, QColor(255, 255, 255, 250), QColor(240, 245, 255, 230)),
+                                        Qt::transparent, 0, 15};
+    }
+
+    const TableLook &table(Theme::Role role) const
+    {
+        return role == Theme::PciTable ? pci : usb;
+    }
+};
+
+// Тема разбирается один раз на процесс
+const Look &look()
+{
+    static const Look instance;
+    return instance;
+}
+
+QHash<const QWidget *, Theme::Role> &roles()
+{
+    static QHash<const QWidget *, Theme::Role> map;
+    return map;
+}
+
+// Заголовок, угловая кнопка и viewport таблицы берут роль у самой таблицы
+Theme::Role tableRole(const QWidget *widget)
+{
+    for (int depth = 0; widget && depth < 2; ++depth, widget = widget->parentWidget()) {
+        const Theme::Role role = Theme::role(widget);
+        if (role == Theme::UsbTable || role == Theme::PciTable) return role;
+    }
+    return Theme::NoRole;
+}
+
+} // namespace
+
+void Theme::install()
+{
+    QApplication::setStyle(new ThemeStyle);
+}
+
+void Theme::applyButton(QPushButton *button, int pixelSize)
+{
+    setRole(button, Button);
+    button->setFont(pixelFont(button->font().family(), pixelSize, true));
+    button->setAttribute(Qt::WA_Hover);
+}
+
+void Theme::applyTitle(QLabel *label, int padding)
+{
+    QPalette palette = label->palette();
+    palette.setColor(QPalette::WindowText, look().title);
+    label->setPalette(palette);
+    label->setMargin(padding);
+}
+
+void Theme::applyText(QLabel *label, const QColor &color)
+{
+    QPalette palette = label->palette();
+    palette.setColor(QPalette::WindowText, color);
+    label->setPalette(palette);
+}
+
+void Theme::applyTable(QTableView *table, Role role)
+{
+    const TableLook &tableLook = look().table(role);
+    setRole(table, role);
+    QPalette palette = table->palette();
+    palette.setColor(QPalette::Base, tableLook.base);
+    palette.setColor(QPalette::AlternateBase, tableLook.alternate);
+    palette.setColor(QPalette::Text, tableLook.text);
+    palette.setColor(QPalette::Highlight, tableLook.selection);
+    palette.setColor(QPalette::HighlightedText, Qt::white);
+    table->setPalette(palette);
+    table->setFont(tableLook.font);
+    table->horizontalHeader()->setFont(tableLook.headerFont);
+    // Подсветка строки и секции под курсором требует событий наведения
+    table->viewport()->setAttribute(Qt::WA_Hover);
+    table->horizontalHeader()->setAttribute(Qt::WA_Hover);
+}
+
+Theme::Role Theme::role(const QWidget *widget)
+{
+    return widget ? roles().value(widget, NoRole) : NoRole;
+}
+
+void Theme::setRole(QWidget *widget, Role role)
+{
+    if (!roles().contains(widget)) {
+        QObject::connect(widget, &QObject::destroyed, [widget]() { roles().remove(widget); });
+    }
+    roles().insert(widget, role);
+}
+
+ThemePanel::ThemePanel(Kind kind, QWidget *parent) : QWidget(parent), kind(kind)
+{
+}
+
+void ThemePanel::paintEvent(QPaintEvent *)
+{
+    const qreal dpr = devicePixelRatioF();
+    if (background.isNull() || background.size() != size() * dpr
+        || !qFuzzyCompare(background.devicePixelRatio(), dpr)) {
+        const PanelLook &panel = look().panels[kind];
+        background = QPixmap(size() * dpr);
+        background.setDevicePixelRatio(dpr);
+        background.fill(Qt::transparent);
+        QPainter painter(&background);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(panel.borderWidth > 0 ? QPen(panel.border, panel.borderWidth) : QPen(Qt::NoPen));
+        painter.setBrush(panel.fill);
+        const qreal inset = panel.borderWidth / 2.0;
+        painter.drawRoundedRect(QRectF(rect()).adjusted(inset, inset, -inset, -inset), panel.radius, panel.radius);
+    }
+    QPainter painter(this);
+    painter.drawPixmap(0, 0, background);
+}
+
+ThemeStyle::ThemeStyle() : QProxyStyle()
+{
+}
+
+void ThemeStyle::drawPrimitive(PrimitiveElement element, const QStyleOption *option, QPainter *painter,
+                               const QWidget *widget) const
+{
+    if (element == PE_PanelItemViewItem) {
+        const Theme::Role role = tableRole(widget);
+        if (role != Theme::NoRole) {
+            const TableLook &tableLook = look().table(role);
+            const auto *item = qstyleoption_cast<const QStyleOptionViewItem *>(option);
+            if (option->state & State_Selected) {
+                painter->fillRect(option->rect, tableLook.selection);
+            } else if (option->state & State_MouseOver) {
+                painter->fillRect(option->rect, tableLook.itemHover);
+            } else if (item && (item->features & QStyleOptionViewItem::Alternate)) {
+                painter->fillRect(option->rect, tableLook.alternate);
+            } else if (tableLook.item.style() != Qt::NoBrush) {
+                painter->fillRect(option->rect, tableLook.item);
+            }
+            return;
+        }
+    }
+    if (element == PE_FrameFocusRect && (Theme::role(widget) == Theme::Button || tableRole(widget) != Theme::NoRole)) {
+        return;
+    }
+    QProxyStyle::drawPrimitive(element, option, painter, widget);
+}
+
+void ThemeStyle::drawControl(ControlElement element, const QStyleOption *option, QPainter *painter,
+                             const QWidget *widget) const
+{
+    switch (element) {
+    case CE_PushButton:
+        if (Theme::role(widget) == Theme::Button) {
+            const Look &theme = look();
+            QColor fill = theme.accent;
+            if (!(option->state & State_Enabled)) {
+                fill = theme.accentDisabled;
+            } else if (option->state & (State_Sunken | State_On)) {
+                fill = theme.accentPressed;
+            } else if (option->state & State_MouseOver) {
+                fill = theme.accentHover;
+            }
+            painter->save();
+            painter->setRenderHint(QPainter::Antialiasing);
+            painter->setPen(Qt::NoPen);
+            painter->setBrush(fill);
+            painter->drawRoundedRect(QRectF(option->rect), theme.buttonRadius, theme.buttonRadius);
+            painter->setPen(Qt::white);
+            if (const auto *button = qstyleoption_cast<const QStyleOptionButton *>(option)) {
+                painter->drawText(option->rect, Qt::AlignCenter | Qt::TextShowMnemonic, button->text);
+            }
+            painter->restore();
+            return;
+        }
+        break;
+    case CE_HeaderSection:
+    case CE_HeaderEmptyArea:
+        if (const Theme::Role role = tableRole(widget)) {
+            const TableLook &tableLook = look().table(role);
+            painter->fillRect(option->rect, (option->state & State_MouseOver) ? tableLook.headerHover : tableLook.header);
+            return;
+        }
+        break;
+    case CE_HeaderLabel:
+        if (tableRole(widget) != Theme::NoRole) {
+            if (const auto *header = qstyleoption_cast<const QStyleOptionHeader *>(option)) {
+                QStyleOptionHeader white(*header);
+                white.palette.setColor(QPalette::ButtonText, Qt::white);
+                QProxyStyle::drawControl(element, &white, painter, widget);
+                return;
+            }
+        }
+        break;
+    case CE_ItemViewItem:
+        if (const Theme::Role role = tableRole(widget)) {
+            const auto *item = qstyleoption_cast<const QStyleOptionViewItem *>(option);
+            if (item && (option->state & State_MouseOver) && !(option->state & State_Selected)) {
+                QStyleOptionViewItem hovered(*item);
+                hovered.palette.setColor(QPalette::Text, look().table(role).hoverText);
+                QProxyStyle::drawControl(element, &hovered, painter, widget);
+                return;
+            }
+        }
+        break;
+    case CE_ShapedFrame:
+        if (const Theme::Role role = tableRole(widget)) {
+            const TableLook &tableLook = look().table(role);
+            painter->save();
+            painter->setRenderHint(QPainter::Antialiasing);
+            painter->setPen(QPen(tableLook.border, 1));
+            painter->setBrush(Qt::NoBrush);
+            painter->drawRoundedRect(QRectF(option->rect).adjusted(0.5, 0.5, -0.5, -0.5),
+                                     tableLook.radius, tableLook.radius);
+            painter->restore();
+            return;
+        }
+        break;
+    default:
+        break;
+    }
+    QProxyStyle::drawControl(element, option, painter, widget);
+}
+
+QSize ThemeStyle::sizeFromContents(ContentsType type, const QStyleOption *option, const QSize &size,
+                                   const QWidget *widget) const
+{
+    switch (type) {
+    case CT_PushButton:
+        if (Theme::role(widget) == Theme::Button) {
+            return size + look().buttonPadding;
+        }
+        break;
+    case CT_ItemViewItem:
+        if (const Theme::Role role = tableRole(widget)) {
+            return QProxyStyle::sizeFromContents(type, option, size, widget) + look().table(role).itemPadding;
+        }
+        break;
+    case CT_HeaderSection:
+        if (const Theme::Role role = tableRole(widget)) {
+            return QProxyStyle::sizeFromContents(type, option, size, widget) + look().table(role).headerPadding;
+        }
+        break;
+    default:
+        break;
+    }
+    return QProxyStyle::sizeFromContents(type, option, size, widget);
+}
+
+int ThemeStyle::styleHint(StyleHint hint, const QStyleOption *option, const QWidget *widget,
+                          QStyleHintReturn *returnData) const
+{
+    if (hint == SH_Table_GridLineColor) {
+        if (const Theme::Role role = tableRole(widget)) {
+            return int(look().table(role).grid.rgba());
+        }
+    }
+    return QProxyStyle::styleHint(hint, option, widget, returnData);
+}
@@ -0,0 +1,67 @@
+#ifndef THEME_H
+#define THEME_H
+
+#include <QColor>
+#include <QPixmap>
+#include <QProxyStyle>
+#include <QWidget>
+
+class QLabel;
+class QPushButton;
+class QTableView;
+
+// Общая тема окна вместо setStyleSheet у каждого виджета. Цвета, кисти и
+// градиенты собираются один раз, рисует их ThemeStyle (QProxyStyle поверх
+// системного стиля), поэтому ни при создании панелей, ни при наведении
+// мыши никакие строки стилей не разбираются.
+class Theme {
+public:
+    enum Role { NoRole, Button, UsbTable, PciTable };
+
+    // Ставит ThemeStyle стилем приложения; вызывается до создания окон
+    static void install();
+
+    static void applyButton(QPushButton *button, int pixelSize);
+    static void applyTitle(QLabel *label, int padding = 0);
+    static void applyText(QLabel *label, const QColor &color = Qt::black);
+    static void applyTable(QTableView *table, Role role);
+
+    static Role role(const QWidget *widget);
+
+private:
+    static void setRole(QWidget *widget, Role role);
+};
+
+// Подложка панели лабораторной: скруглённый прямоугольник, один раз
+// нарисованный в QPixmap под текущие размер и DPR
+class ThemePanel : public QWidget {
+    Q_OBJECT
+public:
+    enum Kind { PowerPanel, PciPanel, WebcamPanel, UsbPanel };
+
+    explicit ThemePanel(Kind kind, QWidget *parent = nullptr);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    Kind kind;
+    QPixmap background;
+};
+
+class ThemeStyle : public QProxyStyle {
+    Q_OBJECT
+public:
+    ThemeStyle();
+
+    void drawPrimitive(PrimitiveElement element, const QStyleOption *option, QPainter *painter,
+                       const QWidget *widget = nullptr) const override;
+    void drawControl(ControlElement element, const QStyleOption *option, QPainter *painter,
+                     const QWidget *widget = nullptr) const override;
+    QSize sizeFromContents(ContentsType type, const QStyleOption *option, const QSize &size,
+                           const QWidget *widget = nullptr) const override;
+    int styleHint(StyleHint hint, const QStyleOption *option = nullptr, const QWidget *widget = nullptr,
+                  QStyleHintReturn *returnData = nullptr) const override;
+};
+
+#endif // THEME_H
@@ -0,0 +1,263 @@
+#include "timerscheduler.h"
+#include <QDebug>
+#include <QEvent>
+#include <QWidget>
+#include <QWindow>
+
+TimerScheduler::TimerScheduler(QObject *parent) : QObject(parent)
+{
+    // Допуски считаются здесь же, поэтому системному таймеру нужна точность
+    wakeup.setSingleShot(true);
+    wakeup.setTimerType(Qt::PreciseTimer);
+    connect(&wakeup, &QTimer::timeout, this, &TimerScheduler::dispatch);
+    clock.start();
+}
+
+void TimerScheduler::watchWindow(QWidget *window)
+{
+    watchedWindow = window;
+    window->installEventFilter(this);
+    // Перекрытие окна видно только по Expose у QWindow, поэтому окно уже должно быть создано
+    if (QWindow *handle = window->windowHandle()) {
+        handle->installEventFilter(this);
+    }
+    updateVisibility();
+}
+
+void TimerScheduler::setCosmeticPaused(bool paused)
+{
+    if (paused == cosmeticPaused) {
+        return;
+    }
+    const qint64 now = clock.elapsed();
+    for (ScheduledTimer *timer : std::as_const(armed)) {
+        if (timer->timerCategory != Cosmetic) continue;
+        // На паузе хранится остаток интервала, после неё отсчёт продолжается с него
+        if (paused) {
+            timer->remaining = qMax<qint64>(0, timer->deadline - now);
+        } else {
+            timer->deadline = now + timer->remaining;
+        }
+    }
+    cosmeticPaused = paused;
+    reschedule();
+    emit cosmeticPausedChanged(paused);
+}
+
+bool TimerScheduler::isCosmeticPaused() const
+{
+    return cosmeticPaused;
+}
+
+TimerScheduler::Stats TimerScheduler::stats() const
+{
+    Stats result;
+    result.wakeups = wakeupCount;
+    result.dispatched = dispatchCount;
+    result.armedTimers = armed.size();
+    result.cosmeticPaused = cosmeticPaused;
+    const qint64 now = clock.elapsed();
+    int recent = 0;
+    for (qint64 at : recentWakeups) {
+        if (at > now - StatsWindowMs) ++recent;
+    }
+    const qint64 window = qBound<qint64>(1, now, StatsWindowMs);
+    result.wakeupsPerSecond = recent * 1000.0 / window;
+    return result;
+}
+
+bool TimerScheduler::eventFilter(QObject *watched, QEvent *event)
+{
+    switch (event->type()) {
+    case QEvent::Show:
+    case QEvent::Hide:
+    case QEvent::WindowStateChange:
+    case QEvent::Expose:
+        updateVisibility();
+        break;
+    default:
+        break;
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void TimerScheduler::updateVisibility()
+{
+    if (!watchedWindow) {
+        return;
+    }
+    const QWindow *handle = watchedWindow->windowHandle();
+    const bool visible = watchedWindow->isVisible() && !watchedWindow->isMinimized()
+                         && (!handle || handle->isExposed());
+    setCosmeticPaused(!visible);
+}
+
+void TimerScheduler::arm(ScheduledTimer *timer)
+{
+    timer->deadline = clock.elapsed() + timer->intervalMs;
+    timer->remaining = timer->intervalMs;
+    if (!armed.contains(timer)) {
+        armed.append(timer);
+    }
+    reschedule();
+}
+
+void TimerScheduler::disarm(ScheduledTimer *timer)
+{
+    if (armed.removeOne(timer)) {
+        reschedule();
+    }
+}
+
+bool TimerScheduler::isRunnable(const ScheduledTimer *timer) const
+{
+    return !(cosmeticPaused && timer->timerCategory == Cosmetic);
+}
+
+void TimerScheduler::reschedule()
+{
+    // Будим в самый поздний момент, который ещё допускает хоть одна задача
+    qint64 wakeAt = -1;
+    for (const ScheduledTimer *timer : std::as_const(armed)) {
+        if (!isRunnable(timer)) continue;
+        const qint64 latest = timer->deadline + timer->slackMs();
+        if (wakeAt < 0 || latest < wakeAt) wakeAt = latest;
+    }
+    if (wakeAt < 0) {
+        wakeup.stop();
+        return;
+    }
+    wakeup.start(int(qMax<qint64>(0, wakeAt - clock.elapsed())));
+}
+
+void TimerScheduler::dispatch()
+{
+    const qint64 now = clock.elapsed();
+    ++wakeupCount;
+    recentWakeups.append(now);
+    while (!recentWakeups.isEmpty() && recentWakeups.constFirst() <= now - StatsWindowMs) {
+        recentWakeups.removeFirst();
+    }
+
+    // Срабатывает всё, чей срок уже наступил: так задачи собираются на одно пробуждение
+    struct Due {
+        QPointer<ScheduledTimer> timer;
+        quint64 serial;
+    };
+    QList<Due> due;
+    for (ScheduledTimer *timer : std::as_const(armed)) {
+        if (isRunnable(timer) && timer->deadline <= now) {
+            due.append({timer, timer->serial});
+        }
+    }
+    for (const Due &entry : std::as_const(due)) {
+        ScheduledTimer *timer = entry.timer;
+        if (timer->singleShot) {
+            timer->active = false;
+            armed.removeOne(timer);
+        } else {
+            timer->deadline += timer->intervalMs;
+            if (timer->deadline <= now) {
+                timer->deadline = now + timer->intervalMs;
+            }
+        }
+    }
+    reschedule();
+
+    // Обработчик может остановить или перезапустить соседнюю задачу — её тогда пропускаем
+    for (const Due &entry : std::as_const(due)) {
+        if (!entry.timer || entry.timer->serial != entry.serial) continue;
+        ++dispatchCount;
+        emit entry.timer->timeout();
+    }
+}
+
+ScheduledTimer::ScheduledTimer(TimerScheduler *scheduler, TimerScheduler::Category category, QObject *parent)
+    : QObject(parent), scheduler(scheduler), timerCategory(category)
+{
+}
+
+ScheduledTimer::~ScheduledTimer()
+{
+    if (scheduler) {
+        scheduler->disarm(this);
+    }
+}
+
+void ScheduledTimer::setSingleShot(bool singleShot)
+{
+    this->singleShot = singleShot;
+}
+
+bool ScheduledTimer::isSingleShot() const
+{
+    return singleShot;
+}
+
+void ScheduledTimer::setInterval(int msec)
+{
+    intervalMs = qMax(0, msec);
+    if (active) {
+        start();
+    }
+}
+
+int ScheduledTimer::interval() const
+{
+    return intervalMs;
+}
+
+bool ScheduledTimer::isActive() const
+{
+    return active;
+}
+
+TimerScheduler::Category ScheduledTimer::category() const
+{
+    return timerCategory;
+}
+
+void ScheduledTimer::start()
+{
+    if (!scheduler) {
+        return;
+    }
+    ++serial;
+    active = true;
+    scheduler->arm(this);
+}
+
+void ScheduledTimer::start(int msec)
+{
+    intervalMs = qMax(0, msec);
+    start();
+}
+
+void ScheduledTimer::stop()
+{
+    ++serial;
+    if (!active) {
+        return;
+    }
+    active = false;
+    if (scheduler) {
+        scheduler->disarm(this);
+    }
+}
+
+qint64 ScheduledTimer::slackMs() const
+{
+    if (timerCategory == TimerScheduler::Cosmetic) {
+        return qMin(intervalMs / 4, 1000);
+    }
+    return qMin(intervalMs / 20, 50);
+}
+
+QDebug operator<<(QDebug debug, const TimerScheduler::Stats &stats)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace() << "TimerScheduler(wakeups=" << stats.wakeups << ", dispatched=" << stats.dispatched
+                    << ", wakeupsPerSecond=" << stats.wakeupsPerSecond << ", armed=" << stats.armedTimers
+                    << ", cosmeticPaused=" << stats.cosmeticPaused << ')';
+    return debug;
+}
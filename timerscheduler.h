@@ -0,0 +1,113 @@
+#ifndef TIMERSCHEDULER_H
+#define TIMERSCHEDULER_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+
+class QDebug;
+class QWidget;
+class ScheduledTimer;
+
+// Общий планировщик таймеров окна. Все периодические задачи MainWindow
+// (моргание, опрос питания, фото в режиме слежки) ставятся сюда через
+// ScheduledTimer. Планировщик держит один системный таймер, будит процесс
+// в самый поздний допустимый момент и заодно выполняет всё, чей срок
+// уже наступил. Косметические задачи ставятся на паузу, пока окно скрыто,
+// свёрнуто или полностью перекрыто.
+class TimerScheduler : public QObject {
+    Q_OBJECT
+public:
+    enum Category {
+        Essential,  // работает всегда, допуск до 1/20 интервала (не больше 50 мс)
+        Cosmetic    // только при видимом окне, допуск до 1/4 интервала (не больше 1 с)
+    };
+
+    struct Stats {
+        quint64 wakeups = 0;
+        quint64 dispatched = 0;
+        double wakeupsPerSecond = 0;
+        int armedTimers = 0;
+        bool cosmeticPaused = false;
+    };
+
+    explicit TimerScheduler(QObject *parent = nullptr);
+
+    // Следит за показом, сворачиванием и перекрытием окна
+    void watchWindow(QWidget *window);
+    void setCosmeticPaused(bool paused);
+    bool isCosmeticPaused() const;
+    Stats stats() const;
+
+signals:
+    void cosmeticPausedChanged(bool paused);
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private slots:
+    void dispatch();
+
+private:
+    friend class ScheduledTimer;
+
+    static constexpr int StatsWindowMs = 10000;
+
+    void arm(ScheduledTimer *timer);
+    void disarm(ScheduledTimer *timer);
+    void reschedule();
+    void updateVisibility();
+    bool isRunnable(const ScheduledTimer *timer) const;
+
+    QTimer wakeup;
+    QElapsedTimer clock;
+    QList<ScheduledTimer *> armed;
+    QList<qint64> recentWakeups;
+    QPointer<QWidget> watchedWindow;
+    bool cosmeticPaused = false;
+    quint64 wakeupCount = 0;
+    quint64 dispatchCount = 0;
+};
+
+// Замена QTimer с тем же набором методов, работающая через TimerScheduler
+class ScheduledTimer : public QObject {
+    Q_OBJECT
+public:
+    ScheduledTimer(TimerScheduler *scheduler, TimerScheduler::Category category, QObject *parent = nullptr);
+    ~ScheduledTimer();
+
+    void setSingleShot(bool singleShot);
+    bool isSingleShot() const;
+    void setInterval(int msec);
+    int interval() const;
+    bool isActive() const;
+    TimerScheduler::Category category() const;
+
+public slots:
+    void start();
+    void start(int msec);
+    void stop();
+
+signals:
+    void timeout();
+
+private:
+    friend class TimerScheduler;
+
+    qint64 slackMs() const;
+
+    QPointer<TimerScheduler> scheduler;
+    TimerScheduler::Category timerCategory;
+    int intervalMs = 0;
+    bool singleShot = false;
+    bool active = false;
+    qint64 deadline = 0;
+    qint64 remaining = 0;
+    quint64 serial = 0;
+};
+
+QDebug operator<<(QDebug debug, const TimerScheduler::Stats &stats);
+
+#endif // TIMERSCHEDULER_H
@@ -0,0 +1,22 @@
+#include <QDir>
+#include <QGuiApplication>
+#include "animationcatalog.h"
+#include "assetpack.h"
+
+// Собирает assets.pack на машине сборки: packassets <каталог assets> <файл пакета>.
+// Отдельная утилита, а не ключ самого приложения: при кросс-сборке её
+// собирают под хост, и ей не нужны окно, мониторы и системные библиотеки.
+int main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        qWarning("usage: packassets <assets dir> <pack file>");
+        return 2;
+    }
+    // Кадры рисуются только в QImage; экранный плагин не нужен
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication a(argc, argv);
+    const QString assetsDir = QDir(QString::fromLocal8Bit(argv[1])).absolutePath() + "/";
+    const bool written = AssetPack::write(QString::fromLocal8Bit(argv[2]), assetsDir, AnimationCatalog::sequences(),
+                                          AnimationCatalog::packedDevicePixelRatios());
+    return written ? 0 : 1;
+}
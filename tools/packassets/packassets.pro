@@ -0,0 +1,24 @@
+# Утилита машины сборки: растеризует кадры анимаций в assets.pack
+QT += core gui svg
+QT -= widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle debug_and_release
+
+TARGET = packassets
+TEMPLATE = app
+# Путь к утилите нужен app.pro, поэтому без подкаталогов debug/release
+DESTDIR = $$OUT_PWD
+
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    main.cpp \
+    $$PWD/../../animationcatalog.cpp \
+    $$PWD/../../assetpack.cpp \
+    $$PWD/../../displaylist.cpp
+
+HEADERS += \
+    $$PWD/../../animationcatalog.h \
+    $$PWD/../../assetpack.h \
+    $$PWD/../../displaylist.h
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""Generates pcicodes.h: PCI vendor, device and class tables as one string pool.
+
+All names go into a single byte array, PciStringPool, and the tables hold
+only integers: IDs and offsets into the pool. The whole thing is
+relocation-free .rodata and can be included from any number of translation
+units.
+
+Usage:
+    tools/pci_codes_gen.py pci.ids -o pcicodes.h
+    tools/pci_codes_gen.py "(PCI_DEVS)pci_codes.h" -o pcicodes.h   # legacy header
+
+The input is either the upstream pci.ids (https://pci-ids.ucw.cz/) or the
+old struct-initializer header. Duplicate keys are reported and the entry
+with the fuller description is kept. Input is read as UTF-8, like pci.ids
+itself; the legacy header predates that and falls back to Windows-1252.
+Names go into the pool as UTF-8.
+"""
+
+import argparse
+import codecs
+import re
+import sys
+
+BYTES_PER_LINE = 20
+
+
+class Pool:
+    """Deduplicated NUL-terminated strings; offset 0 is the empty string."""
+
+    def __init__(self):
+        self.data = bytearray(b"\0")
+        self.offsets = {b"": 0}
+
+    def add(self, text):
+        raw = text.encode("utf-8")
+        if raw not in self.offsets:
+            self.offsets[raw] = len(self.data)
+            self.data += raw + b"\0"
+        return self.offsets[raw]
+
+
+def keep_better(table, key, entry, what):
+    """Keeps one entry per key, preferring non-empty descriptions."""
+    if key in table:
+        old = table[key]
+        print("warning: duplicate %s %s: %r / %r" % (what, key, old, entry), file=sys.stderr)
+        score = lambda e: (e[-1] != "", e[0] != "")
+        if score(entry) <= score(old):
+            return
+    table[key] = entry
+
+
+def unescape_c(literal):
+    return codecs.escape_decode(literal.encode("utf-8"))[0].decode("utf-8", errors="replace")
+
+
+def read_text(path):
+    data = open(path, "rb").read()
+    try:
+        return data.decode("utf-8")
+    except UnicodeDecodeError as error:
+        print("warning: %s is not UTF-8 (%s), reading as Windows-1252" % (path, error), file=sys.stderr)
+        return data.decode("cp1252", errors="replace")
+
+
+def parse_legacy_header(text):
+    vendors, devices, classes = {}, {}, {}
+    string = r'"((?:[^"\\]|\\.)*)"'
+    hex_id = r"0[xX]([0-9A-Fa-f]+)"
+    vendor_re = re.compile(r"^\s*\{\s*%s\s*,\s*%s\s*,\s*%s\s*\}" % (hex_id, string, string))
+    device_re = re.compile(r"^\s*\{\s*%s\s*,\s*%s\s*,\s*%s\s*,\s*%s\s*\}" % (hex_id, hex_id, string, string))
+    class_re = re.compile(r"^\s*\{\s*%s\s*,\s*%s\s*,\s*%s\s*,\s*%s\s*,\s*%s\s*,\s*%s\s*\}"
+                          % (hex_id, hex_id, hex_id, string, string, string))
+    section = None
+    for line in text.splitlines():
+        if "PciVenTable" in line:
+            section = "vendors"
+        elif "PciDevTable" in line:
+            section = "devices"
+        elif "PciClassCodeTable" in line:
+            section = "classes"
+        elif line.strip().startswith("} ;"):
+            section = None
+        elif section == "classes" and (m := class_re.match(line)):
+            key = (int(m[1], 16), int(m[2], 16), int(m[3], 16))
+            keep_better(classes, key, tuple(unescape_c(m[i]) for i in (4, 5, 6)), "class")
+        elif section == "devices" and (m := device_re.match(line)):
+            key = (int(m[1], 16), int(m[2], 16))
+            keep_better(devices, key, (unescape_c(m[3]), unescape_c(m[4])), "device")
+        elif section == "vendors" and (m := vendor_re.match(line)):
+            keep_better(vendors, int(m[1], 16), (unescape_c(m[2]), unescape_c(m[3])), "vendor")
+    return vendors, devices, classes
+
+
+def parse_pci_ids(text):
+    vendors, devices, classes = {}, {}, {}
+    vendor = None
+    base = sub = None
+    base_name = sub_name = ""
+    for line in text.splitlines():
+        if not line.strip() or line.startswith("#"):
+            continue
+        if line.startswith("C "):
+            base, base_name = int(line[2:4], 16), line[4:].strip()
+            sub, vendor = None, None
+            classes[(base, 0, 0)] = (base_name, "", "")
+        elif base is not None and line.startswith("\t\t"):
+            prog, name = int(line[2:4], 16), line[4:].strip()
+            classes[(base, sub, prog)] = (base_name, sub_name, name)
+        elif base is not None and line.startswith("\t"):
+            sub, sub_name = int(line[1:3], 16), line[3:].strip()
+            classes[(base, sub, 0)] = (base_name, sub_name, "")
+        elif line.startswith("\t\t"):
+            continue  # подсистемы в таблицу не входят
+        elif line.startswith("\t") and vendor is not None:
+            keep_better(devices, (vendor, int(line[1:5], 16)), ("", line[5:].strip()), "device")
+        elif not line.startswith("\t"):
+            base = None
+            vendor = int(line[:4], 16)
+            keep_better(vendors, vendor, ("", line[4:].strip()), "vendor")
+    return vendors, devices, classes
+
+
+def emit(vendors, devices, classes, source):
+    pool = Pool()
+    vendor_rows = [(vid, pool.add(short), pool.add(full)) for vid, (short, full) in sorted(vendors.items())]
+    device_rows = [((vid << 16) | did, pool.add(chip), pool.add(desc))
+                   for (vid, did), (chip, desc) in sorted(devices.items())]
+    class_rows = [(b, s, p, pool.add(bd), pool.add(sd), pool.add(pd))
+                  for (b, s, p), (bd, sd, pd) in sorted(classes.items())]
+
+    out = []
+    out.append("// Generated by tools/pci_codes_gen.py from %s, do not edit." % source)
+    out.append("// Names live in one UTF-8 string pool; records hold only IDs and pool offsets,")
+    out.append("// so the tables are relocation-free .rodata.")
+    out.append("#ifndef PCICODES_H")
+    out.append("#define PCICODES_H")
+    out.append("")
+    out.append("#include <QtGlobal>")
+    out.append("")
+    out.append("struct PciVendorRecord {")
+    out.append("    quint16 venId;")
+    out.append("    quint32 shortName;")
+    out.append("    quint32 fullName;")
+    out.append("};")
+    out.append("")
+    out.append("struct PciDeviceRecord {")
+    out.append("    quint32 key;        // VenId << 16 | DevId")
+    out.append("    quint32 chip;")
+    out.append("    quint32 chipDesc;")
+    out.append("};")
+    out.append("")
+    out.append("struct PciClassRecord {")
+    out.append("    quint8 baseClass;")
+    out.append("    quint8 subClass;")
+    out.append("    quint8 progIf;")
+    out.append("    quint32 baseDesc;")
+    out.append("    quint32 subDesc;")
+    out.append("    quint32 progDesc;")
+    out.append("};")
+    out.append("")
+    # Массив байтов, а не строковый литерал: MSVC не принимает литералы длиннее 64 КБ
+    out.append("inline constexpr char PciStringPool[%d] = {" % len(pool.data))
+    for i in range(0, len(pool.data), BYTES_PER_LINE):
+        out.append("    " + ",".join(str(b if b < 128 else b - 256) for b in pool.data[i:i + BYTES_PER_LINE]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("inline constexpr PciVendorRecord PciVendorRecords[] = {")
+    out += ["    {0x%04X, %d, %d}," % row for row in vendor_rows]
+    out.append("};")
+    out.append("")
+    out.append("inline constexpr PciDeviceRecord PciDeviceRecords[] = {")
+    out += ["    {0x%08X, %d, %d}," % row for row in device_rows]
+    out.append("};")
+    out.append("")
+    out.append("inline constexpr PciClassRecord PciClassRecords[] = {")
+    out += ["    {0x%02X, 0x%02X, 0x%02X, %d, %d, %d}," % row for row in class_rows]
+    out.append("};")
+    out.append("")
+    out.append("#endif // PCICODES_H")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="pci.ids or the legacy (PCI_DEVS)pci_codes.h")
+    parser.add_argument("-o", "--output", default="pcicodes.h")
+    args = parser.parse_args()
+
+    text = read_text(args.input)
+    legacy = args.input.endswith(".h")
+    vendors, devices, classes = parse_legacy_header(text) if legacy else parse_pci_ids(text)
+    source = "the legacy pci_codes.h" if legacy else "pci.ids"
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(emit(vendors, devices, classes, source))
+    print("%d vendors, %d devices, %d classes" % (len(vendors), len(devices), len(classes)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()